@@ -51,6 +51,7 @@ public class KawaiiFluidEditor : ModuleRules
 				"Renderer",
 				"Projects",
 				"ApplicationCore",
+				"AssetRegistry",
 			}
 			);
 
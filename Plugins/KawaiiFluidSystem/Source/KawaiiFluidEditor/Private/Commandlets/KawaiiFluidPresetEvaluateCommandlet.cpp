@@ -0,0 +1,205 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Commandlets/KawaiiFluidPresetEvaluateCommandlet.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+#include "Tests/KawaiiFluidPresetEvaluator.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogKawaiiFluidPresetEvaluate, Log, All);
+
+namespace
+{
+	/**
+	 * @struct FPresetEvaluationRow
+	 * @brief One evaluated preset of the report.
+	 * @param AssetPath Object path of the preset.
+	 * @param Evaluation Evaluator result.
+	 * @param Failure Reason the preset failed validation, empty if it passed.
+	 */
+	struct FPresetEvaluationRow
+	{
+		FString AssetPath;
+		FKawaiiFluidPresetEvaluation Evaluation;
+		FString Failure;
+
+		/** Solver cost normalized to 10k particles (ms per frame) */
+		double GetMsPer10kParticles() const
+		{
+			return Evaluation.ParticleCount > 0 ? Evaluation.GetMsPerFrame() * 10000.0 / Evaluation.ParticleCount : 0.0;
+		}
+	};
+
+	/**
+	 * @brief Helper: Collect the presets to evaluate, sorted by path.
+	 * @param PresetList Explicit object paths separated by '+' or ',' (takes precedence), or empty.
+	 * @param PackagePath Content path searched recursively when no list is given, empty for all content.
+	 * @return Preset asset data.
+	 */
+	TArray<FAssetData> FindPresets(const FString& PresetList, const FString& PackagePath)
+	{
+		IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+		TArray<FAssetData> Assets;
+
+		if (!PresetList.IsEmpty())
+		{
+			TArray<FString> Paths;
+			PresetList.Replace(TEXT(","), TEXT("+")).ParseIntoArray(Paths, TEXT("+"));
+			for (const FString& Path : Paths)
+			{
+				const FAssetData Asset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Path));
+				if (Asset.IsValid())
+				{
+					Assets.Add(Asset);
+				}
+				else
+				{
+					UE_LOG(LogKawaiiFluidPresetEvaluate, Error, TEXT("Preset not found: %s"), *Path);
+				}
+			}
+		}
+		else
+		{
+			AssetRegistry.SearchAllAssets(true);
+
+			FARFilter Filter;
+			Filter.ClassPaths.Add(UKawaiiFluidPresetDataAsset::StaticClass()->GetClassPathName());
+			Filter.bRecursiveClasses = true;
+			if (!PackagePath.IsEmpty())
+			{
+				Filter.PackagePaths.Add(FName(*PackagePath));
+				Filter.bRecursivePaths = true;
+			}
+			AssetRegistry.GetAssets(Filter, Assets);
+		}
+
+		Assets.Sort([](const FAssetData& A, const FAssetData& B)
+		{
+			return A.GetObjectPathString() < B.GetObjectPathString();
+		});
+		return Assets;
+	}
+}
+
+/**
+ * @brief Default constructor: headless, client and server content not needed.
+ */
+UKawaiiFluidPresetEvaluateCommandlet::UKawaiiFluidPresetEvaluateCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+/**
+ * @brief Evaluate every requested preset in the canonical scene and write the cost-ranked report.
+ * @param Params Commandlet parameters (see class comment).
+ * @return 0 if every preset passed, 1 if any failed or none was found.
+ */
+int32 UKawaiiFluidPresetEvaluateCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	FKawaiiFluidPresetEvaluationSettings Settings;
+	if (const FString* Value = ParamValues.Find(TEXT("Seconds")))
+	{
+		Settings.SimulatedSeconds = FCString::Atof(**Value);
+	}
+	if (const FString* Value = ParamValues.Find(TEXT("MaxParticles")))
+	{
+		Settings.MaxParticles = FCString::Atoi(**Value);
+	}
+
+	const FString* MaxDensityErrorValue = ParamValues.Find(TEXT("MaxDensityError"));
+	const float MaxDensityError = MaxDensityErrorValue ? FCString::Atof(**MaxDensityErrorValue) : 0.0f;
+	const bool bRequireSettled = Switches.Contains(TEXT("RequireSettled"));
+
+	const FString* OutputValue = ParamValues.Find(TEXT("Output"));
+	const FString OutputPath = OutputValue ? *OutputValue : FPaths::ProjectSavedDir() / TEXT("KawaiiFluid") / TEXT("PresetEvaluation.csv");
+
+	const FString* PresetList = ParamValues.Find(TEXT("Presets"));
+	const FString* PackagePath = ParamValues.Find(TEXT("Path"));
+	const TArray<FAssetData> Assets = FindPresets(PresetList ? *PresetList : FString(), PackagePath ? *PackagePath : FString());
+	if (Assets.Num() == 0)
+	{
+		UE_LOG(LogKawaiiFluidPresetEvaluate, Error, TEXT("No fluid presets to evaluate"));
+		return 1;
+	}
+
+	TArray<FPresetEvaluationRow> Rows;
+	Rows.Reserve(Assets.Num());
+	int32 NumFailed = 0;
+
+	for (const FAssetData& Asset : Assets)
+	{
+		FPresetEvaluationRow& Row = Rows.AddDefaulted_GetRef();
+		Row.AssetPath = Asset.GetObjectPathString();
+
+		const UKawaiiFluidPresetDataAsset* Preset = Cast<UKawaiiFluidPresetDataAsset>(Asset.GetAsset());
+		Row.Evaluation = FKawaiiFluidPresetEvaluator::Evaluate(Preset, Settings);
+
+		const FKawaiiFluidPresetEvaluation& Evaluation = Row.Evaluation;
+		if (!Preset || Evaluation.ParticleCount == 0)
+		{
+			Row.Failure = TEXT("NotSimulated");
+		}
+		else if (!Evaluation.IsStable())
+		{
+			Row.Failure = TEXT("Unstable");
+		}
+		else if (MaxDensityError > 0.0f && Evaluation.Final.AverageConstraintError > MaxDensityError)
+		{
+			Row.Failure = TEXT("DensityError");
+		}
+		else if (bRequireSettled && !Evaluation.bSettled)
+		{
+			Row.Failure = TEXT("NotSettled");
+		}
+		NumFailed += Row.Failure.IsEmpty() ? 0 : 1;
+
+		UE_LOG(LogKawaiiFluidPresetEvaluate, Display, TEXT("%s: %d particles, %.2f ms/frame (%.1fx real time), density error %.3f, spread %.2f, settled %s%s"),
+			*Row.AssetPath, Evaluation.ParticleCount, Evaluation.GetMsPerFrame(), Evaluation.GetRealTimeFactor(),
+			Evaluation.Final.AverageConstraintError, Evaluation.Spread, Evaluation.bSettled ? TEXT("yes") : TEXT("no"),
+			Row.Failure.IsEmpty() ? TEXT("") : *FString::Printf(TEXT(" -> FAILED (%s)"), *Row.Failure));
+	}
+
+	// Most expensive first
+	Rows.StableSort([](const FPresetEvaluationRow& A, const FPresetEvaluationRow& B)
+	{
+		return A.GetMsPer10kParticles() > B.GetMsPer10kParticles();
+	});
+
+	FString Csv = TEXT("Rank,Preset,Result,Particles,Frames,Substeps,MsPerFrame,MsPer10kParticles,RealTimeFactor,")
+		TEXT("AvgDensityError,MaxDensityError,DensityRatio,Spread,Settled,SettleSeconds,FinalMaxVelocity,PeakMaxVelocity,")
+		TEXT("PredictMs,NeighborMs,DensityMs,CollisionMs,FinalizeMs,ViscosityMs,CohesionMs,OtherMs\n");
+	for (int32 Rank = 0; Rank < Rows.Num(); ++Rank)
+	{
+		const FPresetEvaluationRow& Row = Rows[Rank];
+		const FKawaiiFluidPresetEvaluation& Evaluation = Row.Evaluation;
+		const FKawaiiFluidStageTimings& Timings = Evaluation.Timings;
+		Csv += FString::Printf(TEXT("%d,%s,%s,%d,%d,%d,%.4f,%.4f,%.2f,%.5f,%.5f,%.4f,%.3f,%d,%.3f,%.2f,%.2f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n"),
+			Rank + 1, *Row.AssetPath, Row.Failure.IsEmpty() ? TEXT("Pass") : *Row.Failure,
+			Evaluation.ParticleCount, Evaluation.Frames, Evaluation.Substeps,
+			Evaluation.GetMsPerFrame(), Row.GetMsPer10kParticles(), Evaluation.GetRealTimeFactor(),
+			Evaluation.Final.AverageConstraintError, Evaluation.Final.MaxConstraintError, Evaluation.Final.DensityRatio,
+			Evaluation.Spread, Evaluation.bSettled ? 1 : 0, Evaluation.SettleSeconds,
+			Evaluation.Final.MaxVelocity, Evaluation.PeakMaxVelocity,
+			Timings.PredictMs, Timings.NeighborMs, Timings.DensityMs, Timings.CollisionMs,
+			Timings.FinalizeMs, Timings.ViscosityMs, Timings.CohesionMs, Timings.GetOtherMs());
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *OutputPath))
+	{
+		UE_LOG(LogKawaiiFluidPresetEvaluate, Error, TEXT("Failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogKawaiiFluidPresetEvaluate, Display, TEXT("Evaluated %d presets, %d failed. Report: %s"), Rows.Num(), NumFailed, *OutputPath);
+	return NumFailed > 0 ? 1 : 0;
+}
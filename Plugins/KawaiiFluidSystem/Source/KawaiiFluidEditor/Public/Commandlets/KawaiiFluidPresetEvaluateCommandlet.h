@@ -0,0 +1,30 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "KawaiiFluidPresetEvaluateCommandlet.generated.h"
+
+/**
+ * @brief UKawaiiFluidPresetEvaluateCommandlet
+ *
+ * Batch-validates and cost-ranks fluid presets headless with FKawaiiFluidPresetEvaluator (CPU solver, no viewport or GPU).
+ * Writes one CSV row per preset, most expensive first, and returns non-zero if any preset fails validation.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=KawaiiFluidPresetEvaluate
+ *        [-Presets=/Game/A.A+/Game/B.B] [-Path=/Game/Fluids] [-Seconds=4] [-MaxParticles=16384]
+ *        [-MaxDensityError=0.1] [-RequireSettled] [-Output=<file.csv>]
+ */
+UCLASS()
+class KAWAIIFLUIDEDITOR_API UKawaiiFluidPresetEvaluateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UKawaiiFluidPresetEvaluateCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
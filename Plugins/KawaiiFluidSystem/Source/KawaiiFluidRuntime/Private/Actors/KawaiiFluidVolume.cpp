@@ -21,6 +21,7 @@
 #include "Engine/DirectionalLight.h"
 #include "EngineUtils.h"
 #include "Async/ParallelFor.h"
+#include "Algo/AllOf.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
@@ -117,14 +118,8 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 
 	// Set readback request for ISM/Point debug modes (required for GPU->CPU data transfer)
 	// Without this, ISM renderer won't get updated particle data
-	{
-		const bool bNeedReadback = RequiresGPUReadback(VolumeComponent->DebugDrawMode)
-#if WITH_EDITORONLY_DATA
-		                           || VolumeComponent->bBrushModeActive
-#endif
-		                           ;
-		GetFluidStatsCollector().SetReadbackRequested(bNeedReadback);
-	}
+	// Brush mode only needs the max speed (sleep detection), registered as its own readback consumer below
+	GetFluidStatsCollector().SetReadbackRequested(RequiresGPUReadback(VolumeComponent->DebugDrawMode));
 
 #if WITH_EDITOR
 	// Editor-specific: Run GPU simulation for brush mode (like UKawaiiFluidComponent)
@@ -148,11 +143,23 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 				SimulationModule->SetGPUSimulationActive(true);
 			}
 
+			// Entering brush mode wakes the simulation; max speed feedback tells when the fluid has settled
+			FGPUFluidSimulator* BrushGPUSim = Context->GetGPUSimulator();
+			if (BrushGPUSim && VolumeComponent->bBrushModeActive != bEditorBrushModeWasActive)
+			{
+				bEditorBrushModeWasActive = VolumeComponent->bBrushModeActive;
+				BrushGPUSim->SetMaxVelocityFeedbackEnabled(bEditorBrushModeWasActive, EGPUReadbackConsumer::EditorSleep);
+				if (bEditorBrushModeWasActive)
+				{
+					WakeEditorSimulation();
+				}
+			}
+
 			// Process simulation OR pending ops (OUTSIDE GPU ready check - like UKawaiiFluidComponent)
 			// This ensures pending despawn requests are processed even when GPU state changes
-			if (VolumeComponent->bBrushModeActive)
+			if (VolumeComponent->bBrushModeActive && bEditorSimulationAwake)
 			{
-				// Brush mode: Run full simulation
+				// Brush mode: Run full simulation while particles are awake
 				FKawaiiFluidSimulationParams Params = SimulationModule->BuildSimulationParams();
 				Params.ExternalForce += SimulationModule->GetAccumulatedExternalForce();
 
@@ -175,10 +182,29 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 				);
 				SimulationModule->SetAccumulatedTime(AccumulatedTime);
 				SimulationModule->ResetExternalForce();
+
+				// Sleep once the fastest particle stays below the sleep speed (readback lags 2-3 frames);
+				// a missing readback resets the timer and a stale one holds it, so neither puts the fluid to sleep
+				const float MaxSpeed = BrushGPUSim ? BrushGPUSim->GetReadbackMaxVelocity() : -1.0f;
+				const uint32 MaxSpeedSerial = BrushGPUSim ? BrushGPUSim->GetReadbackMaxVelocitySerial() : 0;
+				const float SleepSpeed = Preset ? Preset->SleepVelocityThreshold : 5.0f;
+				if (MaxSpeed < 0.0f || MaxSpeed >= SleepSpeed)
+				{
+					EditorSettledSeconds = 0.0f;
+				}
+				else if (MaxSpeedSerial != EditorMaxSpeedSerial)
+				{
+					EditorSettledSeconds += DeltaSeconds;
+				}
+				EditorMaxSpeedSerial = MaxSpeedSerial;
+				if (EditorSettledSeconds >= EditorSleepDelaySeconds)
+				{
+					bEditorSimulationAwake = false;
+				}
 			}
 			else
 			{
-				// Not brush mode: Process pending spawn/despawn only (no physics simulation)
+				// Not brush mode or asleep: Process pending spawn/despawn only (no physics simulation)
 				FGPUFluidSimulator* GPUSim = Context->GetGPUSimulator();
 				if (GPUSim && GPUSim->IsReady())
 				{
@@ -262,9 +288,14 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 	{
 		// Use member buffer to avoid per-frame allocation
 		ShadowPredictionBuffer.Reset();
+		ShadowParticleIDBuffer.Reset();
 		TArray<FVector>& Positions = ShadowPredictionBuffer;
+		TArray<int32>& ParticleIDs = ShadowParticleIDBuffer;
 		int32 NumParticles = 0;
 
+		// Every particle asleep: shadow instances cannot have moved since the last registration
+		bool bParticlesSettled = false;
+
 		// Check if GPU simulation is active
 		FGPUFluidSimulator* GPUSimulator = SimulationModule->GetGPUSimulator();
 		const bool bGPUActive = SimulationModule->IsGPUSimulationActive() && GPUSimulator != nullptr;
@@ -276,6 +307,8 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 			CachedShadowPositions.Empty();
 			CachedShadowVelocities.Empty();
 			CachedNeighborCounts.Empty();
+			CachedShadowParticleIDs.Empty();
+			CachedShadowFlags.Empty();
 			return;
 		}
 
@@ -340,6 +373,9 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 			
 			// Only enable readback when actually needed (avoids GPU barrier overhead)
 			GPUSimulator->SetShadowReadbackEnabled(bNeedReadback);
+			GPUSimulator->SetReadbackConsumerFields(EGPUReadbackConsumer::DebugDraw, bNeedDebug
+				? (EGPUReadbackField::Position | EGPUReadbackField::ParticleID | EGPUReadbackField::Flags | EGPUReadbackField::AcceptQuantizedPosition)
+				: EGPUReadbackField::None);
 			GPUSimulator->SetAnisotropyReadbackEnabled(bNeedShadow); // Anisotropy only for shadow rendering
 			GPUSimulator->SetDebugZOrderIndexEnabled(bNeedDebugZOrder); // Enable Z-Order index recording for debug visualization
 
@@ -367,6 +403,9 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 
 					// Also cache neighbor counts for isolation detection
 					GPUSimulator->GetShadowNeighborCounts(CachedNeighborCounts);
+
+					// IDs keep shadow instances in stable slots, flags report sleeping
+					GPUSimulator->GetShadowParticleStates(CachedShadowParticleIDs, CachedShadowFlags);
 				}
 			}
 			else if (bNeedReadback && CachedShadowPositions.Num() > 0 && CachedShadowVelocities.Num() == CachedShadowPositions.Num())
@@ -396,6 +435,15 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 				NumParticles = Positions.Num();
 			}
 			// If !bNeedReadback, NumParticles remains 0 and no readback processing occurs
+
+			if (NumParticles > 0 && CachedShadowParticleIDs.Num() == NumParticles)
+			{
+				ParticleIDs = CachedShadowParticleIDs;
+				bParticlesSettled = CachedShadowFlags.Num() == NumParticles && Algo::AllOf(CachedShadowFlags, [](uint32 Flags)
+				{
+					return (Flags & EGPUParticleFlags::IsSleeping) != 0;
+				});
+			}
 		}
 		else
 		{
@@ -406,14 +454,18 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 			if (NumParticles > 0)
 			{
 				Positions.SetNum(NumParticles);
+				ParticleIDs.SetNum(NumParticles);
 				CachedShadowVelocities.SetNum(NumParticles);
 				CachedNeighborCounts.SetNum(NumParticles);
 
+				bParticlesSettled = true;
 				for (int32 i = 0; i < NumParticles; ++i)
 				{
 					Positions[i] = Particles[i].Position;
+					ParticleIDs[i] = Particles[i].ParticleID;
 					CachedShadowVelocities[i] = Particles[i].Velocity;
 					CachedNeighborCounts[i] = Particles[i].NeighborIndices.Num();
+					bParticlesSettled &= Particles[i].bIsSleeping;
 				}
 			}
 		}
@@ -422,6 +474,7 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 		{
 			const bool bHasVel = (CachedShadowVelocities.Num() == NumParticles);
 			const bool bHasNbr = (CachedNeighborCounts.Num() == NumParticles);
+			const bool bHasIDs = (ParticleIDs.Num() == NumParticles);
 			int32 Out = 0;
 			for (int32 i = 0; i < NumParticles; ++i)
 			{
@@ -429,9 +482,11 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 				Positions[Out] = Positions[i];
 				if (bHasVel) CachedShadowVelocities[Out] = CachedShadowVelocities[i];
 				if (bHasNbr) CachedNeighborCounts[Out] = CachedNeighborCounts[i];
+				if (bHasIDs) ParticleIDs[Out] = ParticleIDs[i];
 				Out++;
 			}
 			NumParticles = Out;
+			if (bHasIDs) ParticleIDs.SetNum(NumParticles, EAllowShrinking::No);
 		}
 
 		if (NumParticles > 0)
@@ -503,13 +558,65 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 					// Apply user-defined radius offset to fine-tune shadow coverage
 					ShadowParticleRadius = FMath::Max(0.1f, ShadowParticleRadius + VolumeComponent->ShadowRadiusOffset);
 					
+					// Distant volumes refresh shadows every ShadowThrottleInterval frames and re-register
+					// their last positions in between (unchanged instances cost no upload)
+					bool bThrottled = false;
+					if (VolumeComponent->ShadowThrottleDistance > 0.0f)
+					{
+						APlayerCameraManager* CameraManager = World->GetFirstPlayerController() ? World->GetFirstPlayerController()->PlayerCameraManager : nullptr;
+						const float DistToBounds = CameraManager
+							? FMath::Max(0.0f, FVector::Dist(CameraManager->GetCameraLocation(), VolumeComponent->Bounds.Origin) - VolumeComponent->Bounds.SphereRadius)
+							: 0.0f;
+						bThrottled = DistToBounds > VolumeComponent->ShadowThrottleDistance;
+					}
+
+					const uint32 OwnerKey = VolumeComponent->GetUniqueID();
+					const bool bThrottledFrame = bThrottled && LastRegisteredShadowPositions.Num() > 0
+						&& GFrameCounter - LastShadowRegisterFrame < static_cast<uint64>(FMath::Max(1, VolumeComponent->ShadowThrottleInterval));
+
 					// Register shadow particles for aggregation (will be rendered in Subsystem Tick)
-					RendererSubsystem->RegisterShadowParticles(
-						Positions.GetData(),
-						NumParticles,
-						ShadowParticleRadius,
-						VolumeComponent->ShadowMeshQuality
-					);
+					if (bThrottledFrame)
+					{
+						RendererSubsystem->RegisterShadowParticles(
+							LastRegisteredShadowPositions.GetData(),
+							LastRegisteredShadowPositions.Num(),
+							ShadowParticleRadius,
+							VolumeComponent->ShadowMeshQuality,
+							LastRegisteredShadowParticleIDs.Num() == LastRegisteredShadowPositions.Num() ? LastRegisteredShadowParticleIDs.GetData() : nullptr,
+							OwnerKey,
+							true
+						);
+					}
+					else
+					{
+						const int32* RegisterIDs = ParticleIDs.Num() == NumParticles ? ParticleIDs.GetData() : nullptr;
+						RendererSubsystem->RegisterShadowParticles(
+							Positions.GetData(),
+							NumParticles,
+							ShadowParticleRadius,
+							VolumeComponent->ShadowMeshQuality,
+							RegisterIDs,
+							OwnerKey,
+							bParticlesSettled
+						);
+
+						LastShadowRegisterFrame = GFrameCounter;
+						if (bThrottled)
+						{
+							LastRegisteredShadowPositions.Reset(NumParticles);
+							LastRegisteredShadowPositions.Append(Positions.GetData(), NumParticles);
+							LastRegisteredShadowParticleIDs.Reset(NumParticles);
+							if (RegisterIDs)
+							{
+								LastRegisteredShadowParticleIDs.Append(RegisterIDs, NumParticles);
+							}
+						}
+						else
+						{
+							LastRegisteredShadowPositions.Reset();
+							LastRegisteredShadowParticleIDs.Reset();
+						}
+					}
 				}
 			}
 
@@ -661,9 +768,28 @@ void AKawaiiFluidVolume::QueueSpawnRequests(const TArray<FVector>& Positions, co
 	}
 }
 
+int32 AKawaiiFluidVolume::QueueSpawnDescriptor(const FKawaiiFluidSpawnDescriptor& Descriptor)
+{
+	FKawaiiFluidSpawnDescriptor Resolved = Descriptor;
+	if (Resolved.Mass <= 0.0f && SimulationModule && SimulationModule->Preset)
+	{
+		Resolved.Mass = SimulationModule->Preset->ParticleMass;
+	}
+
+	FKawaiiFluidSpawnPlan Plan;
+	Plan.Build(Resolved);
+	const int32 Count = Plan.Num();
+	if (Count > 0)
+	{
+		PendingSpawnPlans.Add(MoveTemp(Plan));
+		PendingSpawnPlanParticleCount += Count;
+	}
+	return Count;
+}
+
 void AKawaiiFluidVolume::ProcessPendingSpawnRequests()
 {
-	if (PendingSpawnRequests.Num() == 0 || !SimulationModule)
+	if ((PendingSpawnRequests.Num() == 0 && PendingSpawnPlans.Num() == 0) || !SimulationModule)
 	{
 		return;
 	}
@@ -675,6 +801,8 @@ void AKawaiiFluidVolume::ProcessPendingSpawnRequests()
 		UE_LOG(LogTemp, Warning, TEXT("AKawaiiFluidVolume [%s]: No GPU simulator available for spawn requests"),
 			*GetName());
 		PendingSpawnRequests.Empty();
+		PendingSpawnPlans.Empty();
+		PendingSpawnPlanParticleCount = 0;
 		return;
 	}
 
@@ -697,10 +825,18 @@ void AKawaiiFluidVolume::ProcessPendingSpawnRequests()
 	// Send all requests directly to GPU (preserving each request's SourceID)
 	GPUSimulator->AddSpawnRequests(PendingSpawnRequests);
 
-	UE_LOG(LogTemp, Verbose, TEXT("AKawaiiFluidVolume [%s]: Sent %d spawn requests to GPU"),
-		*GetName(), PendingSpawnRequests.Num());
+	// Plans go over as-is; the GPU expands them after the individual requests
+	for (FKawaiiFluidSpawnPlan& Plan : PendingSpawnPlans)
+	{
+		GPUSimulator->AddSpawnPlan(MoveTemp(Plan));
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("AKawaiiFluidVolume [%s]: Sent %d spawn requests and %d spawn plans (%d particles) to GPU"),
+		*GetName(), PendingSpawnRequests.Num(), PendingSpawnPlans.Num(), PendingSpawnPlanParticleCount);
 
 	PendingSpawnRequests.Empty();
+	PendingSpawnPlans.Empty();
+	PendingSpawnPlanParticleCount = 0;
 }
 
 void AKawaiiFluidVolume::RegisterEmitter(AKawaiiFluidEmitter* Emitter)
@@ -961,6 +1097,12 @@ void AKawaiiFluidVolume::InitializeRendering()
 }
 
 #if WITH_EDITOR
+void AKawaiiFluidVolume::WakeEditorSimulation()
+{
+	bEditorSimulationAwake = true;
+	EditorSettledSeconds = 0.0f;
+}
+
 void AKawaiiFluidVolume::InitializeEditorRendering()
 {
 	// Skip if already initialized
@@ -1115,22 +1257,19 @@ void AKawaiiFluidVolume::DrawDebugParticles()
 			return;
 		}
 
-		TArray<FVector3f> Positions;
-		TArray<int32> ParticleIDs;
-		TArray<int32> SourceIDs;
-		if (!Simulator->GetParticlePositionsAndIDs(Positions, ParticleIDs, SourceIDs))
-		{
-			return;
-		}
+		// Pin the latest readback snapshot for the whole draw (no copy, no lock)
+		const FGPUFluidReadbackSnapshotView Snapshot = Simulator->AcquireReadbackSnapshot();
+		const TConstArrayView<FVector3f> Positions = Snapshot.GetPositions();
+		const TConstArrayView<int32> ParticleIDs = Snapshot.GetParticleIDs();
 
 		const int32 TotalCount = Positions.Num();
-		if (TotalCount == 0)
+		if (TotalCount == 0 || ParticleIDs.Num() != TotalCount)
 		{
 			return;
 		}
 
 		// Get flags for Point_IsAttached debug mode
-		const TArray<uint32>* Flags = Simulator->GetParticleFlags();
+		const TConstArrayView<uint32> Flags = Snapshot.GetFlags();
 
 		// Get Z-Order array indices for Point_ZOrderArrayIndex debug mode
 		TArray<int32> ZOrderIndices;
@@ -1151,7 +1290,7 @@ void AKawaiiFluidVolume::DrawDebugParticles()
 		for (int32 i = 0; i < TotalCount; ++i)
 		{
 			FVector Pos(Positions[i]);
-			const bool bNearBoundary = Flags && i < Flags->Num() && ((*Flags)[i] & EGPUParticleFlags::NearBoundary);
+			const bool bNearBoundary = i < Flags.Num() && (Flags[i] & EGPUParticleFlags::NearBoundary);
 			
 			// Get Z-Order array index if available (ParticleID → ZOrderIndex mapping)
 			const int32 ZOrderIndex = (bHasZOrderIndices && ParticleIDs[i] < ZOrderIndices.Num()) ? ZOrderIndices[ParticleIDs[i]] : -1;
@@ -1662,24 +1801,30 @@ void AKawaiiFluidVolume::AddParticlesInRadius(const FVector& WorldCenter, float
 		return;
 	}
 
-	// Hemisphere distribution above surface
-	for (int32 i = 0; i < Count; ++i)
+	if (!SimulationModule->GetGPUSimulator())
 	{
-		// Random point in unit sphere
-		FVector RandomDir = FMath::VRand();
+		return;
+	}
 
-		// Ensure above surface (dot with normal > 0)
-		if (FVector::DotProduct(RandomDir, SurfaceNormal) < 0)
-		{
-			RandomDir = -RandomDir;
-		}
+	const float ParticleRadius = SimulationModule->Preset ? SimulationModule->Preset->ParticleRadius : 5.0f;
 
-		// Apply randomness to radius
-		const float RandomRadius = Radius * FMath::FRandRange(1.0f - Randomness, 1.0f);
-		const FVector SpawnPos = WorldCenter + RandomDir * RandomRadius;
+	// One record per stroke: the GPU samples the hemisphere shell above the surface and drops samples
+	// whose particle-sized cell already holds fluid (or an earlier sample of the stroke)
+	FKawaiiFluidSpawnDescriptor Descriptor;
+	Descriptor.Shape = EKawaiiFluidSpawnShape::Hemisphere;
+	Descriptor.Center = WorldCenter;
+	Descriptor.Rotation = KawaiiFluidSpawnLattice::MakeHemisphereRotation(SurfaceNormal);
+	Descriptor.Extent = FVector(Radius, Radius * FMath::Clamp(1.0f - Randomness, 0.0f, 1.0f), 0.0);
+	Descriptor.JitterSeed = SimulationModule->NextSpawnRandom().GetStreamSeed();
+	Descriptor.Velocity = FVector3f(Velocity);
+	Descriptor.MaxCount = Count;
+	Descriptor.SourceID = SimulationModule->GetSourceID();
+	Descriptor.MinSeparation = ParticleRadius * 2.0f;
+	QueueSpawnDescriptor(Descriptor);
 
-		SimulationModule->SpawnParticle(SpawnPos, Velocity);
-	}
+#if WITH_EDITOR
+	WakeEditorSimulation();
+#endif
 }
 
 void AKawaiiFluidVolume::RemoveParticlesInRadiusGPU(const FVector& WorldCenter, float Radius)
@@ -1695,6 +1840,11 @@ void AKawaiiFluidVolume::RemoveParticlesInRadiusGPU(const FVector& WorldCenter,
 	{
 		GPUSimulator->AddGPUDespawnBrushRequest(FVector3f(WorldCenter), Radius);
 	}
+
+#if WITH_EDITOR
+	// Fluid around the hole starts moving again
+	WakeEditorSimulation();
+#endif
 }
 
 void AKawaiiFluidVolume::RemoveParticlesBySourceGPU(int32 SourceID)
@@ -4,6 +4,8 @@
 
 #include "EditorFramework/ThumbnailInfo.h"
 #include "Simulation/Shaders/GPUFluidSimulatorShaders.h"
+#include "Tests/KawaiiFluidPresetCostModel.h"
+#include "Misc/ScopedSlowTask.h"
 
 /**
  * @brief Default constructor initializing default physical properties and calculating derived values.
@@ -78,6 +80,12 @@ void UKawaiiFluidPresetDataAsset::PostEditChangeProperty(FPropertyChangedEvent&
 		OnPropertyChanged.Broadcast(this);
 	}
 	
+	// Keep the cost estimate current once the session model exists (never calibrates from here)
+	if (const FKawaiiFluidPresetCostModel* CostModel = FKawaiiFluidPresetCostModel::FindSessionModel())
+	{
+		EstimatedMsPer10kParticles = static_cast<float>(CostModel->PredictMsPer10kParticles(*this));
+	}
+
 	// Notify thumbnail if available
 	if (ThumbnailInfo)
 	{
@@ -85,4 +93,80 @@ void UKawaiiFluidPresetDataAsset::PostEditChangeProperty(FPropertyChangedEvent&
 		ThumbnailInfo->PostEditChange();
 	}
 }
+
+/**
+ * @brief Prices the current solver settings with the session cost model.
+ * 
+ * The first call in a session calibrates the model by running the CPU canonical scene.
+ */
+void UKawaiiFluidPresetDataAsset::EstimateSolverCost()
+{
+	FScopedSlowTask SlowTask(1.0f, NSLOCTEXT("KawaiiFluid", "EstimateSolverCost", "Estimating fluid solver cost..."));
+	SlowTask.MakeDialog();
+
+	const FKawaiiFluidPresetCostModel& CostModel = FKawaiiFluidPresetCostModel::GetSessionModel();
+	SlowTask.EnterProgressFrame();
+
+	EstimatedMsPer10kParticles = static_cast<float>(CostModel.PredictMsPer10kParticles(*this));
+	UE_LOG(LogTemp, Log, TEXT("[%s] Estimated solver cost: %.2f ms per frame for 10k particles"), *GetName(), EstimatedMsPer10kParticles);
+}
+
+/**
+ * @brief Runs the auto-tuner on a transient copy and stores its result as SolverRecommendation.
+ * 
+ * Solver settings are left untouched; ApplySolverRecommendation copies the recommendation over.
+ */
+void UKawaiiFluidPresetDataAsset::AutoTuneSolver()
+{
+	FScopedSlowTask SlowTask(2.0f, NSLOCTEXT("KawaiiFluid", "AutoTuneSolver", "Tuning fluid solver iterations and substeps..."));
+	SlowTask.MakeDialog();
+
+	const FKawaiiFluidPresetCostModel& CostModel = FKawaiiFluidPresetCostModel::GetSessionModel();
+	SlowTask.EnterProgressFrame();
+
+	const FKawaiiFluidPresetTuningResult Result = FKawaiiFluidPresetAutoTuner::Tune(
+		this, TuningTargetDensityError, TuningBudgetMsPer10kParticles, CostModel);
+	SlowTask.EnterProgressFrame();
+
+	Modify();
+	SolverRecommendation = FKawaiiFluidSolverRecommendation();
+	SolverRecommendation.bValid = Result.bFound;
+	SolverRecommendation.bMeetsTarget = Result.bMeetsTarget;
+	SolverRecommendation.SolverIterations = Result.SolverIterations;
+	SolverRecommendation.SubstepDeltaTime = Result.SubstepDeltaTime;
+	SolverRecommendation.MaxSubsteps = Result.MaxSubsteps;
+	SolverRecommendation.EstimatedMsPer10kParticles = static_cast<float>(Result.PredictedMsPer10kParticles);
+	SolverRecommendation.DensityError = Result.DensityError;
+
+	if (!Result.bFound)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Auto-tune found no stable solver settings within %.2f ms per 10k particles (%d runs)"),
+			*GetName(), TuningBudgetMsPer10kParticles, Result.Evaluations);
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[%s] Auto-tune: %d iterations, %d substeps/frame -> density error %.3f%s, %.2f ms per 10k particles (%d runs)"),
+		*GetName(), Result.SolverIterations, Result.SubstepsPerFrame, Result.DensityError,
+		Result.bMeetsTarget ? TEXT("") : TEXT(" (target not reached)"), Result.PredictedMsPer10kParticles, Result.Evaluations);
+}
+
+/**
+ * @brief Copies SolverRecommendation into SolverIterations, SubstepDeltaTime and MaxSubsteps.
+ */
+void UKawaiiFluidPresetDataAsset::ApplySolverRecommendation()
+{
+	if (!SolverRecommendation.bValid)
+	{
+		return;
+	}
+
+	Modify();
+	SolverIterations = SolverRecommendation.SolverIterations;
+	SubstepDeltaTime = SolverRecommendation.SubstepDeltaTime;
+	MaxSubsteps = SolverRecommendation.MaxSubsteps;
+	EstimatedMsPer10kParticles = SolverRecommendation.EstimatedMsPer10kParticles;
+
+	RecalculateDerivedParameters();
+	OnPropertyChanged.Broadcast(this);
+}
 #endif
@@ -9,6 +9,7 @@
 #include "Simulation/Physics/KawaiiFluidViscositySolver.h"
 #include "Simulation/Physics/KawaiiFluidAdhesionSolver.h"
 #include "Simulation/Physics/KawaiiFluidStackPressureSolver.h"
+#include "Simulation/Physics/KawaiiFluidSleepSolver.h"
 #include "Simulation/Collision/KawaiiFluidCollider.h"
 #include "Simulation/Collision/KawaiiFluidMeshCollider.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
@@ -363,6 +364,7 @@ void UKawaiiFluidSimulationContext::InitializeSolvers(const UKawaiiFluidPresetDa
 	ViscositySolver = MakeShared<FKawaiiFluidViscositySolver>();
 	AdhesionSolver = MakeShared<FKawaiiFluidAdhesionSolver>();
 	StackPressureSolver = MakeShared<FKawaiiFluidStackPressureSolver>();
+	SleepSolver = MakeShared<FKawaiiFluidSleepSolver>();
 
 	bSolversInitialized = true;
 }
@@ -396,12 +398,14 @@ void UKawaiiFluidSimulationContext::InitializeGPUSimulator(int32 MaxParticleCoun
 		{
 			GPUSimulator->Release();
 			GPUSimulator->Initialize(MaxParticleCount);
+			GPUCollisionExportSignature.Reset();
 		}
 		return;
 	}
 
 	GPUSimulator = MakeShared<FGPUFluidSimulator>();
 	GPUSimulator->Initialize(MaxParticleCount);
+	GPUCollisionExportSignature.Reset();
 
 	UE_LOG(LogTemp, Log, TEXT("GPU Fluid Simulator initialized with capacity: %d"), MaxParticleCount);
 }
@@ -416,6 +420,7 @@ void UKawaiiFluidSimulationContext::ReleaseGPUSimulator()
 		GPUSimulator->Release();
 		GPUSimulator.Reset();
 	}
+	GPUCollisionExportSignature.Reset();
 }
 
 //=============================================================================
@@ -876,8 +881,39 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 			CurrentGPUCount, PendingSpawnCount, GPUSimulator.Get());
 	}
 
+	// Decoupled mode: each simulation tick spans a whole number of substeps at (or just below) SubstepDeltaTime
+	const bool bDecoupled = Preset->bDecoupledSimulationRate && Preset->SimulationRate > 0.0f;
+	const float TickDT = bDecoupled ? 1.0f / Preset->SimulationRate : Preset->SubstepDeltaTime;
+	const int32 SubstepsPerTick = bDecoupled ? FMath::Max(1, FMath::CeilToInt(TickDT / Preset->SubstepDeltaTime - KINDA_SMALL_NUMBER)) : 1;
+
+	// Adaptive mode: substep count follows the CFL limit of the last read-back max particle speed
+	const bool bAdaptive = !bDecoupled && Preset->bAdaptiveSubsteps;
+	GPUSimulator->SetMaxVelocityFeedbackEnabled(bAdaptive);
+
+	FKawaiiFluidSubstepDecision SubstepDecision;
+	if (bAdaptive)
+	{
+		FKawaiiFluidAdaptiveSubstepSettings AdaptiveSettings;
+		AdaptiveSettings.CFLNumber = Preset->CFLNumber;
+		AdaptiveSettings.ParticleRadius = Preset->ParticleRadius;
+		AdaptiveSettings.GravityMagnitude = static_cast<float>(Preset->Gravity.Size());
+		AdaptiveSettings.MaxSubsteps = Preset->MaxSubsteps;
+		AdaptiveSettings.FallbackSubstepDeltaTime = Preset->SubstepDeltaTime;
+		AdaptiveSettings.HysteresisRatio = Preset->SubstepHysteresis;
+		AdaptiveSettings.DownshiftFrames = Preset->SubstepDownshiftFrames;
+
+		// Same frame-time clamp as the fixed scheme (hitches drop time instead of stretching substeps)
+		const float FrameTime = FMath::Min(DeltaTime, Preset->SubstepDeltaTime * Preset->MaxSubsteps);
+		SubstepDecision = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(
+			AdaptiveSubstepState, AdaptiveSettings, FrameTime, GPUSimulator->GetReadbackMaxVelocity());
+	}
+	else
+	{
+		AdaptiveSubstepState.Reset();
+	}
+
 	// Build GPU simulation parameters
-	const float SubstepDT = Preset->SubstepDeltaTime;
+	const float SubstepDT = (bAdaptive && SubstepDecision.SubstepCount > 0) ? SubstepDecision.SubstepDeltaTime : TickDT / SubstepsPerTick;
 	FGPUFluidSimulationParams GPUParams = BuildGPUSimParams(Preset, Params, SubstepDT);
 
 	// ParticleCount will be updated by GPU after spawn processing
@@ -921,90 +957,110 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 		// Check if adhesion is enabled (use bone-aware export path)
 		const bool bUseGPUAdhesion = (Preset->Adhesion > 0.0f || Preset->AdhesionVelocityStrength > 0.0f);
 
-		// Collect FluidCollider owner actors to exclude from World Collision query (avoid duplicate collision)
-		TSet<const AActor*> FluidColliderOwners;
-		for (const UKawaiiFluidCollider* Collider : Params.Colliders)
-		{
-			if (Collider && Collider->GetOwner())
-			{
-				FluidColliderOwners.Add(Collider->GetOwner());
-			}
-		}
+		// Without adhesion the export only depends on collider shape revisions and the world collision cache:
+		// when neither changed, the primitives uploaded last frame are still current
+		// (the bone-aware path re-exports every frame to track bone velocities)
+		TArray<uint32> ExportSignature;
+		const bool bReuseUploadedPrimitives = !bUseGPUAdhesion
+			&& BuildGPUCollisionExportSignature(Params, GPUWorldQueryBounds, DefaultFriction, DefaultRestitution, ExportSignature)
+			&& ExportSignature == GPUCollisionExportSignature;
 
-		for (UKawaiiFluidCollider* Collider : Params.Colliders)
+		if (!bReuseUploadedPrimitives)
 		{
-			if (!Collider || !Collider->IsColliderEnabled())
+			// Collect FluidCollider owner actors to exclude from World Collision query (avoid duplicate collision)
+			TSet<const AActor*> FluidColliderOwners;
+			for (const UKawaiiFluidCollider* Collider : Params.Colliders)
 			{
-				continue;
+				if (Collider && Collider->GetOwner())
+				{
+					FluidColliderOwners.Add(Collider->GetOwner());
+				}
 			}
 
-			AActor* ColliderOwner = Collider->GetOwner();
-
-			// Check if this is a MeshFluidCollider (has ExportToGPUPrimitives)
-			UKawaiiFluidMeshCollider* MeshCollider = Cast<UKawaiiFluidMeshCollider>(Collider);
-			if (MeshCollider)
+			for (UKawaiiFluidCollider* Collider : Params.Colliders)
 			{
-				// Cache collider shape if needed
-				MeshCollider->CacheCollisionShapes();
+				if (!Collider || !Collider->IsColliderEnabled())
+				{
+					continue;
+				}
 
-				if (MeshCollider->IsCacheValid())
+				AActor* ColliderOwner = Collider->GetOwner();
+
+				// Check if this is a MeshFluidCollider (has ExportToGPUPrimitives)
+				UKawaiiFluidMeshCollider* MeshCollider = Cast<UKawaiiFluidMeshCollider>(Collider);
+				if (MeshCollider)
 				{
-					// Get OwnerID for collision feedback filtering
-					// Use the owner actor's UniqueID to identify which actor owns these primitives
-					int32 OwnerID = ColliderOwner ? ColliderOwner->GetUniqueID() : 0;
+					// Cache collider shape if needed
+					MeshCollider->CacheCollisionShapes();
 
-					// Use bone-aware export for GPU adhesion
-					if (bUseGPUAdhesion)
-					{
-						MeshCollider->ExportToGPUPrimitivesWithBones(
-							CollisionPrimitives.Spheres,
-							CollisionPrimitives.Capsules,
-							CollisionPrimitives.Boxes,
-							CollisionPrimitives.Convexes,
-							CollisionPrimitives.ConvexPlanes,
-							CollisionPrimitives.BoneTransforms,
-							PersistentBoneNameToIndex,  // Use persistent mapping
-							DefaultFriction,
-							DefaultRestitution,
-							OwnerID
-						);
-					}
-					else
+					if (MeshCollider->IsCacheValid())
 					{
-						// Legacy path without bone tracking
-						MeshCollider->ExportToGPUPrimitives(
-							CollisionPrimitives.Spheres,
-							CollisionPrimitives.Capsules,
-							CollisionPrimitives.Boxes,
-							CollisionPrimitives.Convexes,
-							CollisionPrimitives.ConvexPlanes,
-							DefaultFriction,
-							DefaultRestitution,
-							OwnerID
-						);
+						// Get OwnerID for collision feedback filtering
+						// Use the owner actor's UniqueID to identify which actor owns these primitives
+						int32 OwnerID = ColliderOwner ? ColliderOwner->GetUniqueID() : 0;
+
+						// Use bone-aware export for GPU adhesion
+						if (bUseGPUAdhesion)
+						{
+							MeshCollider->ExportToGPUPrimitivesWithBones(
+								CollisionPrimitives.Spheres,
+								CollisionPrimitives.Capsules,
+								CollisionPrimitives.Boxes,
+								CollisionPrimitives.Convexes,
+								CollisionPrimitives.ConvexPlanes,
+								CollisionPrimitives.BoneTransforms,
+								PersistentBoneNameToIndex,  // Use persistent mapping
+								DefaultFriction,
+								DefaultRestitution,
+								OwnerID
+							);
+						}
+						else
+						{
+							// Legacy path without bone tracking
+							MeshCollider->ExportToGPUPrimitives(
+								CollisionPrimitives.Spheres,
+								CollisionPrimitives.Capsules,
+								CollisionPrimitives.Boxes,
+								CollisionPrimitives.Convexes,
+								CollisionPrimitives.ConvexPlanes,
+								DefaultFriction,
+								DefaultRestitution,
+								OwnerID
+							);
+						}
 					}
 				}
 			}
-		}
 
-		// Auto-collect Simple Collision from StaticMeshes within Simulation Volume
-		// FluidColliderOwners are excluded to avoid duplicate collision processing
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_WorldCollision);
-			AppendGPUWorldCollisionPrimitives(
-				CollisionPrimitives,
-				Params,
-				GPUWorldQueryBounds,
-				DefaultFriction,
-				DefaultRestitution,
-				FluidColliderOwners
-			);
+			// Auto-collect Simple Collision from StaticMeshes within Simulation Volume
+			// FluidColliderOwners are excluded to avoid duplicate collision processing
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_WorldCollision);
+				AppendGPUWorldCollisionPrimitives(
+					CollisionPrimitives,
+					Params,
+					GPUWorldQueryBounds,
+					DefaultFriction,
+					DefaultRestitution,
+					FluidColliderOwners
+				);
+			}
+
+			// Remember what was just exported (the world cache is current after the append)
+			GPUCollisionExportSignature.Reset();
+			if (!bUseGPUAdhesion && !BuildGPUCollisionExportSignature(Params, GPUWorldQueryBounds, DefaultFriction, DefaultRestitution, GPUCollisionExportSignature))
+			{
+				GPUCollisionExportSignature.Reset();
+			}
+			bGPUCollisionExportHasPrimitives = !CollisionPrimitives.IsEmpty();
 		}
 
 		// Upload to GPU only if we have primitives
-		if (!CollisionPrimitives.IsEmpty())
+		if (bGPUCollisionExportHasPrimitives)
 		{
 			// 1. Upload collision primitives to GPU
+			if (!bReuseUploadedPrimitives)
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_Upload_Primitives);
 				GPUSimulator->UploadCollisionPrimitives(CollisionPrimitives);
@@ -1175,7 +1231,7 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 			BoundaryAdhesionParams.SmoothingRadius = Preset->SmoothingRadius;
 			BoundaryAdhesionParams.BoundaryParticleCount = TotalBoundaryParticles;
 			BoundaryAdhesionParams.FluidParticleCount = GPUSimulator->GetParticleCount();
-			BoundaryAdhesionParams.DeltaTime = Preset->SubstepDeltaTime;
+			BoundaryAdhesionParams.DeltaTime = SubstepDT;
 
 			GPUSimulator->SetBoundaryAdhesionParams(BoundaryAdhesionParams);
 		}
@@ -1192,6 +1248,56 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 	// Simulate with fixed dt substeps for frame-rate independence
 	// =====================================================
 	int32 SubstepCount = 0;
+	GPUSimulator->SetRenderInterpolationEnabled(bDecoupled);
+	if (bDecoupled)
+	{
+		// =====================================================
+		// Decoupled simulation rate: whole ticks on a fixed cadence, rendering
+		// interpolates between the last two ticks (one tick of latency).
+		// Time beyond MaxSimulationTicksPerFrame is dropped instead of spiralling.
+		// =====================================================
+		TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_FixedTicks);
+		const float MaxAllowedTime = TickDT * FMath::Max(Preset->MaxSimulationTicksPerFrame, 1);
+		AccumulatedTime = FMath::Min(AccumulatedTime + DeltaTime, MaxAllowedTime);
+
+		GPUSimulator->BeginFrame();
+
+		while (AccumulatedTime >= TickDT)
+		{
+			GPUSimulator->MarkSimulationTickStart();
+			for (int32 TickSubstep = 0; TickSubstep < SubstepsPerTick; ++TickSubstep)
+			{
+				GPUParams.SubstepIndex = TickSubstep;
+				GPUParams.TotalSubsteps = SubstepsPerTick;
+				GPUSimulator->SimulateSubstep(GPUParams);
+				++SubstepCount;
+			}
+			AccumulatedTime -= TickDT;
+		}
+
+		GPUSimulator->EndFrame();
+		GPUSimulator->SetRenderInterpolationAlpha(AccumulatedTime / TickDT);
+	}
+	else if (bAdaptive)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_AdaptiveSubsteps);
+
+		// Adaptive substeps consume the whole clamped frame time, nothing carries over
+		AccumulatedTime = 0.0f;
+
+		GPUSimulator->BeginFrame();
+
+		for (; SubstepCount < SubstepDecision.SubstepCount; ++SubstepCount)
+		{
+			GPUParams.SubstepIndex = SubstepCount;
+			GPUParams.TotalSubsteps = SubstepDecision.SubstepCount;
+
+			GPUSimulator->SimulateSubstep(GPUParams);
+		}
+
+		GPUSimulator->EndFrame();
+	}
+	else
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_Substeps);
 		const int32 MaxSubstepsPerFrame = Preset->MaxSubsteps;
@@ -1220,6 +1326,13 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 		GPUSimulator->EndFrame();
 	}
 
+	if (!bAdaptive)
+	{
+		SubstepDecision.SubstepCount = SubstepCount;
+		SubstepDecision.SubstepDeltaTime = SubstepDT;
+	}
+	LastSubstepDecision = SubstepDecision;
+
 	//========================================
 	// GPU Statistics Collection
 	// For GPU comparison, collect basic stats without particle readback
@@ -1258,6 +1371,9 @@ void UKawaiiFluidSimulationContext::Simulate(
 
 /**
  * @brief Perform a single substep of the simulation.
+ * With particle sleeping enabled, sleeping islands are deactivated per cell: the steps run only on
+ * awake cells, their neighbors and a frozen halo, and are skipped entirely once everything sleeps.
+ * Only reached by direct CPU callers (e.g. the preset evaluator); runtime Simulate() uses the GPU sleeping pass.
  * @param Particles In/Out particle array.
  * @param Preset Read-only preset data asset.
  * @param Params Simulation parameters.
@@ -1273,6 +1389,75 @@ void UKawaiiFluidSimulationContext::SimulateSubstep(
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_SimulateSubstep);
 
+	if (!Preset->bEnableParticleSleeping || !SleepSolver.IsValid())
+	{
+		RunSubstepSteps(Particles, Preset, Params, SpatialHash, SubstepDT);
+		return;
+	}
+
+	FKawaiiFluidSleepParams SleepParams;
+	SleepParams.SleepVelocityThreshold = Preset->SleepVelocityThreshold;
+	SleepParams.SleepFrameThreshold = Preset->SleepFrameThreshold;
+	SleepParams.WakeVelocityThreshold = Preset->WakeVelocityThreshold;
+	SleepParams.CellSize = Preset->SmoothingRadius;
+
+	// Colliders wake everything they overlap (the GPU path uses the collision flag for this)
+	for (UKawaiiFluidCollider* Collider : Params.Colliders)
+	{
+		if (Collider && Collider->IsColliderEnabled() && Collider->IsCacheValid())
+		{
+			SleepSolver->WakeInBounds(Particles, Collider->GetCachedBounds().ExpandBy(Params.ParticleRadius));
+		}
+	}
+
+	// Fluid spawned onto a settled pool pushes on it
+	SleepSolver->WakeNearSpawned(Particles, SleepParams.CellSize);
+
+	if (!SleepSolver->BuildActiveSet(Particles, SleepParams.CellSize))
+	{
+		// Whole fluid asleep: nothing to simulate
+		return;
+	}
+
+	if (SleepSolver->HasInactiveParticles())
+	{
+		TArray<FKawaiiFluidParticle>& WorkingParticles = SleepSolver->GatherWorkingSet(Particles);
+		RunSubstepSteps(WorkingParticles, Preset, Params, SpatialHash, SubstepDT);
+		SleepSolver->UpdateSleepStates(WorkingParticles, SleepParams);
+		SleepSolver->ScatterWorkingSet(Particles);
+
+		// The working set ran on the shared hash with compacted indices; rebuild it over the full array
+		// so consumers that index Particles through it (volume queries, world collision) stay valid
+		TArray<FVector> Positions;
+		Positions.Reserve(Particles.Num());
+		for (const FKawaiiFluidParticle& Particle : Particles)
+		{
+			Positions.Add(Particle.Position);
+		}
+		SpatialHash.BuildFromPositions(Positions);
+	}
+	else
+	{
+		RunSubstepSteps(Particles, Preset, Params, SpatialHash, SubstepDT);
+		SleepSolver->UpdateSleepStates(Particles, SleepParams);
+	}
+}
+
+/**
+ * @brief Run the solver pipeline (predict, neighbors, density, collisions, finalize, viscosity, cohesion) on a particle array.
+ * @param Particles In/Out particle array (full array or the sleeping working set).
+ * @param Preset Read-only preset data asset.
+ * @param Params Simulation parameters.
+ * @param SpatialHash Spatial hash for neighbor search.
+ * @param SubstepDT Time step for this specific substep.
+ */
+void UKawaiiFluidSimulationContext::RunSubstepSteps(
+	TArray<FKawaiiFluidParticle>& Particles,
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	FKawaiiFluidSpatialHash& SpatialHash,
+	float SubstepDT)
+{
 	// 1. Predict positions
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ContextPredictPositions);
@@ -1423,6 +1608,14 @@ void UKawaiiFluidSimulationContext::PredictPositions(
 	{
 		FKawaiiFluidParticle& Particle = Particles[i];
 
+		// Sleeping particles stay frozen and act as static neighbors
+		if (Particle.bIsSleeping)
+		{
+			Particle.Velocity = FVector::ZeroVector;
+			Particle.PredictedPosition = Particle.Position;
+			return;
+		}
+
 		FVector AppliedForce = TotalForce;
 
 		// Attached particles: apply only tangent gravity (sliding effect)
@@ -1571,6 +1764,50 @@ void UKawaiiFluidSimulationContext::CacheColliderShapes(const TArray<TObjectPtr<
 
 
 
+/**
+ * @brief Describe the non-bone collision export of this frame: every exported mesh collider with its shape revision
+ * and owner, the default material, and whether the cached world collision primitives are appended.
+ * @param Params Simulation parameters.
+ * @param QueryBounds World collision query bounds.
+ * @param DefaultFriction Friction written into every primitive.
+ * @param DefaultRestitution Restitution written into every primitive.
+ * @param OutSignature Signature to append to.
+ * @return False if the world collision cache would be rebuilt, so the export cannot be compared with an earlier one.
+ */
+bool UKawaiiFluidSimulationContext::BuildGPUCollisionExportSignature(
+	const FKawaiiFluidSimulationParams& Params,
+	const FBox& QueryBounds,
+	float DefaultFriction,
+	float DefaultRestitution,
+	TArray<uint32>& OutSignature) const
+{
+	// Same conditions as AppendGPUWorldCollisionPrimitives
+	const bool bAppendsWorldCollision = Params.bUseWorldCollision && Params.World && QueryBounds.IsValid;
+	if (bAppendsWorldCollision && (bGPUWorldCollisionCacheDirty
+		|| CachedGPUWorldCollisionWorld.Get() != Params.World
+		|| !AreBoundsEqual(CachedGPUWorldCollisionBounds, QueryBounds)))
+	{
+		return false;
+	}
+
+	for (const UKawaiiFluidCollider* Collider : Params.Colliders)
+	{
+		const UKawaiiFluidMeshCollider* MeshCollider = Cast<UKawaiiFluidMeshCollider>(Collider);
+		if (MeshCollider && MeshCollider->IsColliderEnabled() && MeshCollider->IsCacheValid())
+		{
+			const AActor* ColliderOwner = MeshCollider->GetOwner();
+			OutSignature.Add(MeshCollider->GetUniqueID());
+			OutSignature.Add(MeshCollider->GetShapeRevision());
+			OutSignature.Add(ColliderOwner ? ColliderOwner->GetUniqueID() : 0);
+		}
+	}
+
+	OutSignature.Add(FMath::AsUInt(DefaultFriction));
+	OutSignature.Add(FMath::AsUInt(DefaultRestitution));
+	OutSignature.Add(bAppendsWorldCollision ? 1u : 0u);
+	return true;
+}
+
 /**
 
  * @brief Append world geometry primitives to the GPU collision structure.
@@ -2563,6 +2800,15 @@ void UKawaiiFluidSimulationContext::FinalizePositions(
 	ParallelFor(Particles.Num(), [&](int32 i)
 	{
 		FKawaiiFluidParticle& Particle = Particles[i];
+
+		// Discard solver corrections on sleeping particles
+		if (Particle.bIsSleeping)
+		{
+			Particle.PredictedPosition = Particle.Position;
+			Particle.Velocity = FVector::ZeroVector;
+			return;
+		}
+
 		Particle.Velocity = (Particle.PredictedPosition - Particle.Position) * InvDeltaTime;
 		Particle.Position = Particle.PredictedPosition;
 	});
@@ -2808,6 +3054,7 @@ void UKawaiiFluidSimulationContext::CollectGPUSimulationStats(
 
 		// Use actual substep count from simulation
 		Stats.SetSubstepCount(SubstepCount);
+		Stats.SetSubstepTiming(LastSubstepDecision.SubstepDeltaTime, LastSubstepDecision.CFLTimeStep, LastSubstepDecision.bAdaptive);
 	}
 
 	// GPU mode: Basic stats only (no sync readback for performance)
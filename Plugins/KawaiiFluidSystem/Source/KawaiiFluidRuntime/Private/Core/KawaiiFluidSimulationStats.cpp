@@ -16,11 +16,17 @@ DEFINE_STAT(STAT_FluidCohesion);
 DEFINE_STAT(STAT_FluidCollision);
 DEFINE_STAT(STAT_FluidGPUSimulation);
 DEFINE_STAT(STAT_FluidGPUReadback);
+DEFINE_STAT(STAT_FluidShadowClustering);
+DEFINE_STAT(STAT_FluidShadowInstanceUpdate);
 
 DEFINE_STAT(STAT_FluidParticleCount);
 DEFINE_STAT(STAT_FluidActiveParticles);
 DEFINE_STAT(STAT_FluidAttachedParticles);
 DEFINE_STAT(STAT_FluidSubstepCount);
+DEFINE_STAT(STAT_FluidSubstepDeltaTime);
+DEFINE_STAT(STAT_FluidCFLTimeStep);
+DEFINE_STAT(STAT_FluidShadowParticles);
+DEFINE_STAT(STAT_FluidShadowInstances);
 
 DEFINE_STAT(STAT_FluidAvgVelocity);
 DEFINE_STAT(STAT_FluidMaxVelocity);
@@ -97,8 +103,9 @@ void FKawaiiFluidSimulationStats::LogStats(const FString& Label) const
 		BoundsCollisionCount, PrimitiveCollisionCount, GroundContactCount);
 
 	// Solver
-	UE_LOG(LogTemp, Log, TEXT("Solver: Substeps=%d, SolverIter=%d"),
-		SubstepCount, SolverIterations);
+	UE_LOG(LogTemp, Log, TEXT("Solver: Substeps=%d (%s), dt=%.2fms, CFL dt=%.2fms, SolverIter=%d"),
+		SubstepCount, bAdaptiveSubsteps ? TEXT("Adaptive") : TEXT("Fixed"),
+		SubstepDeltaTime * 1000.0f, CFLTimeStep * 1000.0f, SolverIterations);
 
 	// Performance
 	UE_LOG(LogTemp, Log, TEXT("Performance (ms): Total=%.3f, Hash=%.3f, Density=%.3f"),
@@ -144,6 +151,9 @@ FString FKawaiiFluidSimulationStats::ToString() const
 		AvgPressureCorrection, AvgViscosityForce, AvgCohesionForce);
 	Result += FString::Printf(TEXT("Collisions: Bounds=%d, Prim=%d, Ground=%d\n"),
 		BoundsCollisionCount, PrimitiveCollisionCount, GroundContactCount);
+	Result += FString::Printf(TEXT("Substeps: %d %s (dt=%.2fms, CFL=%.2fms)\n"),
+		SubstepCount, bAdaptiveSubsteps ? TEXT("Adaptive") : TEXT("Fixed"),
+		SubstepDeltaTime * 1000.0f, CFLTimeStep * 1000.0f);
 	Result += FString::Printf(TEXT("Time: %.2fms (Hash=%.2f, Density=%.2f, Visc=%.2f, Coh=%.2f, Col=%.2f)"),
 		TotalSimulationTimeMs, SpatialHashTimeMs, DensitySolveTimeMs,
 		ViscosityTimeMs, CohesionTimeMs, CollisionTimeMs);
@@ -599,6 +609,8 @@ void FKawaiiFluidSimulationStatsCollector::UpdateEngineStats() const
 	SET_DWORD_STAT(STAT_FluidActiveParticles, CurrentStats.ActiveParticleCount);
 	SET_DWORD_STAT(STAT_FluidAttachedParticles, CurrentStats.AttachedParticleCount);
 	SET_DWORD_STAT(STAT_FluidSubstepCount, CurrentStats.SubstepCount);
+	SET_FLOAT_STAT(STAT_FluidSubstepDeltaTime, CurrentStats.SubstepDeltaTime * 1000.0f);
+	SET_FLOAT_STAT(STAT_FluidCFLTimeStep, CurrentStats.CFLTimeStep * 1000.0f);
 
 	SET_FLOAT_STAT(STAT_FluidAvgVelocity, CurrentStats.AvgVelocity);
 	SET_FLOAT_STAT(STAT_FluidMaxVelocity, CurrentStats.MaxVelocity);
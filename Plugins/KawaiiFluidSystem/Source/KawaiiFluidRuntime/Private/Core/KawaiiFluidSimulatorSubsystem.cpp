@@ -6,6 +6,8 @@
 #include "Core/KawaiiFluidPresetDataAsset.h"
 #include "Components/KawaiiFluidVolumeComponent.h"
 #include "Actors/KawaiiFluidVolume.h"
+#include "Actors/KawaiiFluidEmitter.h"
+#include "Components/KawaiiFluidEmitterComponent.h"
 #include "Modules/KawaiiFluidSimulationModule.h"
 #include "Modules/KawaiiFluidRenderingModule.h"
 #include "Rendering/KawaiiFluidRenderer.h"
@@ -15,6 +17,8 @@
 #include "Simulation/GPUFluidSimulator.h"
 #include "Engine/Level.h"
 #include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
 
 // Profiling
 DECLARE_STATS_GROUP(TEXT("KawaiiFluidSubsystem"), STATGROUP_KawaiiFluidSubsystem, STATCAT_Advanced);
@@ -23,6 +27,78 @@ DECLARE_CYCLE_STAT(TEXT("Simulate Independent"), STAT_SimulateIndependent, STATG
 DECLARE_CYCLE_STAT(TEXT("Simulate Batched"), STAT_SimulateBatched, STATGROUP_KawaiiFluidSubsystem);
 DECLARE_CYCLE_STAT(TEXT("Merge Particles"), STAT_MergeParticles, STATGROUP_KawaiiFluidSubsystem);
 DECLARE_CYCLE_STAT(TEXT("Split Particles"), STAT_SplitParticles, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_CYCLE_STAT(TEXT("Budget Update"), STAT_BudgetUpdate, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Particle Cap"), STAT_BudgetParticleCap, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Particle Count"), STAT_BudgetParticleCount, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Throttled Contexts"), STAT_BudgetThrottled, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Suspended Contexts"), STAT_BudgetSuspended, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Estimated Work (particle substeps)"), STAT_BudgetEstimatedWork, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Simulated Work (particle substeps)"), STAT_BudgetSimulatedWork, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GPU Memory Reserved (MB)"), STAT_GPUMemoryReservedMB, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GPU Memory Used (MB)"), STAT_GPUMemoryUsedMB, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_CYCLE_STAT(TEXT("Query Index Build"), STAT_QueryIndexBuild, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Query Index Particles"), STAT_QueryIndexParticles, STATGROUP_KawaiiFluidSubsystem);
+
+// =====================================================
+// World Budget CVars
+// =====================================================
+static int32 GFluidBudgetMaxParticles = 0;  // 0 = unlimited
+static FAutoConsoleVariableRef CVarFluidBudgetMaxParticles(
+	TEXT("r.Fluid.Budget.MaxParticles"),
+	GFluidBudgetMaxParticles,
+	TEXT("World-wide particle cap shared by all fluid volumes.\n")
+	TEXT("  0 = Unlimited (default)\n")
+	TEXT("  N = Volumes nearest to the player are served first; the rest recycle their oldest particles\n")
+	TEXT("The default context (modules without a preset) counts toward the cap and is served last."),
+	ECVF_Default
+);
+
+static int32 GFluidBudgetMaxParticleSubsteps = 0;  // 0 = unlimited
+static FAutoConsoleVariableRef CVarFluidBudgetMaxParticleSubsteps(
+	TEXT("r.Fluid.Budget.MaxParticleSubsteps"),
+	GFluidBudgetMaxParticleSubsteps,
+	TEXT("World-wide simulation work budget per frame, in particles x substeps summed over all volumes.\n")
+	TEXT("The GPU solver cost grows with both, so the estimate follows solver load and ignores game-thread hitches.\n")
+	TEXT("  0 = Unlimited (default)\n")
+	TEXT("  N = Farthest volumes are suspended while the estimate exceeds N; the nearest volume always runs"),
+	ECVF_Default
+);
+
+static float GFluidBudgetReleaseMargin = 0.1f;
+static FAutoConsoleVariableRef CVarFluidBudgetReleaseMargin(
+	TEXT("r.Fluid.Budget.ReleaseMargin"),
+	GFluidBudgetReleaseMargin,
+	TEXT("Spare particle budget, as a fraction of a throttled volume's particle count, required before its emitter caps are released (default 0.1)."),
+	ECVF_Default
+);
+
+static int32 GFluidBudgetReleaseFrames = 30;
+static FAutoConsoleVariableRef CVarFluidBudgetReleaseFrames(
+	TEXT("r.Fluid.Budget.ReleaseFrames"),
+	GFluidBudgetReleaseFrames,
+	TEXT("Consecutive frames the spare budget must exceed r.Fluid.Budget.ReleaseMargin before a throttled volume's emitter caps are released (default 30)."),
+	ECVF_Default
+);
+
+// =====================================================
+// Particle Query CVars
+// =====================================================
+static float GFluidQueryCellSize = 20.0f;
+static FAutoConsoleVariableRef CVarFluidQueryCellSize(
+	TEXT("r.Fluid.Query.CellSize"),
+	GFluidQueryCellSize,
+	TEXT("Cell size (cm) of the world particle query index (default 20, minimum 1).\n")
+	TEXT("  The grid is sparse, so it only needs to match typical query radii, not the particle bounds"),
+	ECVF_Default
+);
+
+static int32 GFluidQueryReadbackIdleFrames = 60;
+static FAutoConsoleVariableRef CVarFluidQueryReadbackIdleFrames(
+	TEXT("r.Fluid.Query.ReadbackIdleFrames"),
+	GFluidQueryReadbackIdleFrames,
+	TEXT("Frames without a particle query before GPU query readback is switched off (default 60)."),
+	ECVF_Default
+);
 
 /**
  * @brief Default constructor for UKawaiiFluidSimulatorSubsystem.
@@ -100,6 +176,9 @@ void UKawaiiFluidSimulatorSubsystem::Deinitialize()
 		FWorldDelegates::OnWorldPostActorTick.Remove(OnPostActorTickHandle);
 	}
 
+	ReleaseBudgetCaps();
+	ContextBudgetTiers.Empty();
+
 	AllModules.Empty();
 	AllVolumes.Empty();
 	AllVolumeComponents.Empty();
@@ -132,6 +211,8 @@ void UKawaiiFluidSimulatorSubsystem::Tick(float DeltaTime)
 	// NOTE: Simulation moved to HandlePostActorTick() for correct bone transform timing
 	// Reset event counter at frame start
 	EventCountThisFrame.store(0, std::memory_order_relaxed);
+
+	UpdateQueryReadback();
 }
 
 /**
@@ -163,6 +244,8 @@ void UKawaiiFluidSimulatorSubsystem::HandlePostActorTick(UWorld* World, ELevelTi
 	//========================================
 	if (AllModules.Num() > 0)
 	{
+		UpdateSimulationBudget();
+
 		SimulateIndependentFluidComponents(DeltaTime);
 		SimulateBatchedFluidComponents(DeltaTime);
 
@@ -430,6 +513,160 @@ TArray<FKawaiiFluidParticle> UKawaiiFluidSimulatorSubsystem::GetAllParticlesInRa
 	return Result;
 }
 
+/**
+ * @brief Get the world particle query index, rebuilding it on the first query of a frame.
+ * GPU particles come from the async readback cache (2-3 frames old); CPU particles from the module arrays.
+ * The first call also enables query readback on every GPU simulator, so GPU data appears a few frames later.
+ * @return Spatial index valid until the next frame's first query.
+ */
+const FKawaiiFluidParticleQueryIndex& UKawaiiFluidSimulatorSubsystem::GetParticleQueryIndex() const
+{
+	LastParticleQueryFrame = GFrameCounter;
+	if (ParticleQueryIndexFrame == GFrameCounter && ParticleQueryIndex.IsBuilt())
+	{
+		return ParticleQueryIndex;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_QueryIndexBuild);
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidSubsystem_BuildQueryIndex);
+
+	ParticleQueryIndex.Reset();
+
+	TArray<FGPUFluidSimulator*> Simulators;
+	GetAllGPUSimulators(Simulators);
+	for (FGPUFluidSimulator* Simulator : Simulators)
+	{
+		Simulator->SetQueryReadbackEnabled(true);
+		Simulator->ReadParticleQueryData([this](TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> Velocities, TConstArrayView<int32> SourceIDs)
+		{
+			ParticleQueryIndex.AddParticles(Positions, Velocities, SourceIDs);
+		});
+	}
+	bQueryReadbackActive = Simulators.Num() > 0;
+
+	for (const UKawaiiFluidSimulationModule* Module : AllModules)
+	{
+		if (!Module || Module->IsGPUSimulationActive())
+		{
+			continue;
+		}
+
+		const int32 ModuleSourceID = Module->GetSourceID();
+		for (const FKawaiiFluidParticle& Particle : Module->GetParticles())
+		{
+			ParticleQueryIndex.AddParticle(Particle.Position, Particle.Velocity, Particle.SourceID >= 0 ? Particle.SourceID : ModuleSourceID);
+		}
+	}
+
+	ParticleQueryIndex.Build(GFluidQueryCellSize);
+	ParticleQueryIndexFrame = GFrameCounter;
+
+	SET_DWORD_STAT(STAT_QueryIndexParticles, ParticleQueryIndex.Num());
+
+	return ParticleQueryIndex;
+}
+
+/**
+ * @brief Switch GPU query readback off once gameplay stopped issuing particle queries.
+ */
+void UKawaiiFluidSimulatorSubsystem::UpdateQueryReadback()
+{
+	if (!bQueryReadbackActive || GFrameCounter - LastParticleQueryFrame <= static_cast<uint64>(FMath::Max(GFluidQueryReadbackIdleFrames, 1)))
+	{
+		return;
+	}
+
+	TArray<FGPUFluidSimulator*> Simulators;
+	GetAllGPUSimulators(Simulators);
+	for (FGPUFluidSimulator* Simulator : Simulators)
+	{
+		Simulator->SetQueryReadbackEnabled(false);
+	}
+
+	bQueryReadbackActive = false;
+	ParticleQueryIndex.Reset();
+	ParticleQueryIndexFrame = MAX_uint64;
+}
+
+/**
+ * @brief Find all particles within a sphere using the world query index.
+ * @param Location World-space center.
+ * @param Radius Search radius.
+ * @return Position, velocity and source ID of each particle found.
+ */
+TArray<FKawaiiFluidParticleRecord> UKawaiiFluidSimulatorSubsystem::QueryParticlesInSphere(FVector Location, float Radius) const
+{
+	const FKawaiiFluidParticleQueryIndex& Index = GetParticleQueryIndex();
+
+	TArray<int32> Indices;
+	Index.QuerySphere(Location, Radius, Indices);
+
+	TArray<FKawaiiFluidParticleRecord> Result;
+	Index.GetRecords(Indices, Result);
+	return Result;
+}
+
+/**
+ * @brief Find all particles inside an axis-aligned box using the world query index.
+ * @param Center World-space box center.
+ * @param Extent Box half-extent.
+ * @return Position, velocity and source ID of each particle found.
+ */
+TArray<FKawaiiFluidParticleRecord> UKawaiiFluidSimulatorSubsystem::QueryParticlesInBox(FVector Center, FVector Extent) const
+{
+	const FKawaiiFluidParticleQueryIndex& Index = GetParticleQueryIndex();
+
+	TArray<int32> Indices;
+	Index.QueryBox(FBox(Center - Extent.GetAbs(), Center + Extent.GetAbs()), Indices);
+
+	TArray<FKawaiiFluidParticleRecord> Result;
+	Index.GetRecords(Indices, Result);
+	return Result;
+}
+
+/**
+ * @brief Find the particles nearest to a location using the world query index.
+ * @param Location World-space query point.
+ * @param Count Maximum number of particles to return.
+ * @param MaxDistance Search radius limit, <= 0 for unlimited.
+ * @return Records sorted by distance, closest first.
+ */
+TArray<FKawaiiFluidParticleRecord> UKawaiiFluidSimulatorSubsystem::QueryNearestParticles(FVector Location, int32 Count, float MaxDistance) const
+{
+	const FKawaiiFluidParticleQueryIndex& Index = GetParticleQueryIndex();
+
+	TArray<int32> Indices;
+	Index.QueryNearest(Location, Count, MaxDistance, Indices);
+
+	TArray<FKawaiiFluidParticleRecord> Result;
+	Index.GetRecords(Indices, Result);
+	return Result;
+}
+
+/**
+ * @brief Trace a segment against particles treated as spheres.
+ * @param Start Segment start.
+ * @param End Segment end.
+ * @param HitRadius Particle sphere radius used for the test.
+ * @param OutRecord Receives the first particle hit.
+ * @param OutDistance Receives the distance from Start to the hit.
+ * @return True if a particle was hit.
+ */
+bool UKawaiiFluidSimulatorSubsystem::RaycastParticles(FVector Start, FVector End, float HitRadius, FKawaiiFluidParticleRecord& OutRecord, float& OutDistance) const
+{
+	const FKawaiiFluidParticleQueryIndex& Index = GetParticleQueryIndex();
+
+	const FKawaiiFluidRayQueryHit Hit = Index.Raycast(Start, End, HitRadius);
+	if (!Hit.IsValidHit())
+	{
+		return false;
+	}
+
+	OutRecord = Index.GetRecord(Hit.Index);
+	OutDistance = Hit.Distance;
+	return true;
+}
+
 /**
  * @brief Get the total number of fluid particles currently simulated in the world.
  * @return Total particle count.
@@ -509,6 +746,430 @@ void UKawaiiFluidSimulatorSubsystem::GetAllGPUSimulators(TArray<FGPUFluidSimulat
 	}
 }
 
+/**
+ * @brief Collect GPU memory accounting per volume.
+ * 
+ * Contexts sharing a volume are summed; a simulator shared by several contexts is counted once.
+ * 
+ * @param OutStats Volume component (nullptr = no volume) paired with its reserved/used bytes.
+ */
+void UKawaiiFluidSimulatorSubsystem::GetVolumeMemoryStats(TArray<TPair<UKawaiiFluidVolumeComponent*, FGPUFluidMemoryStats>>& OutStats) const
+{
+	OutStats.Reset();
+	TSet<const FGPUFluidSimulator*> VisitedSimulators;
+
+	auto AddContext = [&OutStats, &VisitedSimulators](UKawaiiFluidVolumeComponent* Volume, const UKawaiiFluidSimulationContext* Context)
+	{
+		const FGPUFluidSimulator* Simulator = Context ? Context->GetGPUSimulator() : nullptr;
+		if (!Simulator || VisitedSimulators.Contains(Simulator))
+		{
+			return;
+		}
+		VisitedSimulators.Add(Simulator);
+
+		const FGPUFluidMemoryStats SimStats = Simulator->GetMemoryStats();
+		TPair<UKawaiiFluidVolumeComponent*, FGPUFluidMemoryStats>* Entry = OutStats.FindByPredicate(
+			[Volume](const TPair<UKawaiiFluidVolumeComponent*, FGPUFluidMemoryStats>& Pair) { return Pair.Key == Volume; });
+		if (!Entry)
+		{
+			Entry = &OutStats.Emplace_GetRef(Volume, FGPUFluidMemoryStats());
+		}
+
+		Entry->Value.MaxParticleCount += SimStats.MaxParticleCount;
+		Entry->Value.AllocatedCapacity += SimStats.AllocatedCapacity;
+		Entry->Value.ParticleCount += SimStats.ParticleCount;
+		Entry->Value.ReservedBytes += SimStats.ReservedBytes;
+		Entry->Value.UsedBytes += SimStats.UsedBytes;
+	};
+
+	for (const auto& Pair : ContextCache)
+	{
+		AddContext(Pair.Key.VolumeComponent, Pair.Value);
+	}
+	AddContext(nullptr, DefaultContext);
+}
+
+//========================================
+// World Budget
+//========================================
+
+/**
+ * @brief Get the budget tier assigned to a context by the last budget update.
+ * @param Context The simulation context to query.
+ * @return Assigned tier (Full if the context is not tracked).
+ */
+EKawaiiFluidBudgetTier UKawaiiFluidSimulatorSubsystem::GetContextBudgetTier(const UKawaiiFluidSimulationContext* Context) const
+{
+	const EKawaiiFluidBudgetTier* Tier = ContextBudgetTiers.Find(Context);
+	return Tier ? *Tier : EKawaiiFluidBudgetTier::Full;
+}
+
+/**
+ * @brief Distribute the world particle and work budget across simulation contexts.
+ *
+ * Contexts are ranked by distance to the player viewpoint; the default context (modules without
+ * a preset) has no volume and is ranked last, but still counts toward both budgets. The particle budget is granted
+ * nearest-first; contexts that receive less than their live count are Throttled and their
+ * sources get per-source emitter caps, so the GPU recycles their oldest particles through
+ * the existing FluidDespawnOldest path. A throttled context keeps its caps until the spare budget
+ * has exceeded the release margin for r.Fluid.Budget.ReleaseFrames frames, so a capped context that
+ * fits its grant exactly does not flip between capped and uncapped. The work budget estimates each context's solver
+ * cost as particles x substeps (substeps from its last simulated frame); contexts beyond the budget are Suspended.
+ * The solver runs on the GPU, so game-thread time is not a measure of its cost.
+ */
+void UKawaiiFluidSimulatorSubsystem::UpdateSimulationBudget()
+{
+	SCOPE_CYCLE_COUNTER(STAT_BudgetUpdate);
+
+	const bool bParticleBudget = GFluidBudgetMaxParticles > 0;
+	const bool bWorkBudget = GFluidBudgetMaxParticleSubsteps > 0;
+
+	struct FBudgetEntry
+	{
+		UKawaiiFluidSimulationContext* Context = nullptr;
+		int32 ParticleCount = 0;
+		int32 Capacity = 0;
+		int64 Work = 0;
+		double DistanceSq = 0.0;
+	};
+
+	// Player viewpoint for proximity priority (no viewpoint = registration order)
+	FVector ViewLocation = FVector::ZeroVector;
+	bool bHasViewpoint = false;
+	if (UWorld* World = GetWorld())
+	{
+		if (APlayerController* PC = World->GetFirstPlayerController())
+		{
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			bHasViewpoint = true;
+		}
+	}
+
+	TArray<FBudgetEntry> Entries;
+	Entries.Reserve(ContextCache.Num() + 1);
+	int64 TotalParticles = 0;
+	int64 TotalCapacity = 0;
+	int64 TotalWork = 0;
+
+	auto AddEntry = [&](UKawaiiFluidSimulationContext* Context, double DistanceSq)
+	{
+		FGPUFluidSimulator* Simulator = Context ? Context->GetGPUSimulator() : nullptr;
+		if (!Simulator)
+		{
+			return;
+		}
+
+		FBudgetEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Context = Context;
+		Entry.ParticleCount = Simulator->GetParticleCount() + Simulator->GetPendingSpawnCount();
+		Entry.Capacity = Simulator->GetMaxParticleCount();
+		Entry.Work = static_cast<int64>(Entry.ParticleCount) * FMath::Max(1, Context->GetLastSubstepDecision().SubstepCount);
+		Entry.DistanceSq = DistanceSq;
+
+		TotalParticles += Entry.ParticleCount;
+		TotalCapacity += Entry.Capacity;
+		TotalWork += Entry.Work;
+	};
+
+	for (const auto& Pair : ContextCache)
+	{
+		double DistanceSq = 0.0;
+		if (bHasViewpoint && Pair.Key.VolumeComponent)
+		{
+			DistanceSq = FVector::DistSquared(ViewLocation, Pair.Key.VolumeComponent->Bounds.Origin);
+		}
+		AddEntry(Pair.Value, DistanceSq);
+	}
+
+	// The default context has no volume bounds to rank by, so it is served last
+	AddEntry(DefaultContext, TNumericLimits<double>::Max());
+
+	Entries.StableSort([](const FBudgetEntry& A, const FBudgetEntry& B)
+	{
+		return A.DistanceSq < B.DistanceSq;
+	});
+
+	const int64 ParticleBudget = bParticleBudget ? GFluidBudgetMaxParticles : 0;
+	const int64 WorkBudget = bWorkBudget ? GFluidBudgetMaxParticleSubsteps : 0;
+
+	ContextBudgetTiers.Reset();
+	TMap<int32, FAppliedSourceCap> NewCaps;
+	TMap<const UKawaiiFluidSimulationContext*, int32> NewReleaseFrames;
+	int64 RemainingParticles = ParticleBudget;
+	int64 SimulatedWork = 0;
+	int32 FullCount = 0;
+	int32 ThrottledCount = 0;
+	int32 SuspendedCount = 0;
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		const FBudgetEntry& Entry = Entries[i];
+		EKawaiiFluidBudgetTier Tier = EKawaiiFluidBudgetTier::Full;
+
+		if (bParticleBudget)
+		{
+			const int64 SpareParticles = RemainingParticles - Entry.ParticleCount;
+			const int32 Grant = static_cast<int32>(FMath::Clamp<int64>(RemainingParticles, 0, Entry.ParticleCount));
+			RemainingParticles -= Grant;
+
+			if (Grant < Entry.ParticleCount)
+			{
+				Tier = EKawaiiFluidBudgetTier::Throttled;
+				ApplyContextParticleGrant(Entry.Context, Entry.ParticleCount, Grant, NewCaps);
+				NewReleaseFrames.Add(Entry.Context, 0);
+			}
+			else if (const int32* ReleaseFrames = BudgetReleaseFrames.Find(Entry.Context))
+			{
+				// A capped context shrinks to exactly its grant, so release only after the spare budget
+				// has stayed above the margin for a while; otherwise refilled emitters re-throttle it
+				const int64 Margin = FMath::Max<int64>(1, FMath::CeilToInt64(Entry.ParticleCount * FMath::Max(0.0f, GFluidBudgetReleaseMargin)));
+				const int32 Frames = SpareParticles >= Margin ? *ReleaseFrames + 1 : 0;
+				if (Frames < GFluidBudgetReleaseFrames)
+				{
+					Tier = EKawaiiFluidBudgetTier::Throttled;
+					HoldContextCaps(Entry.Context, NewCaps);
+					NewReleaseFrames.Add(Entry.Context, Frames);
+				}
+			}
+		}
+
+		// The nearest context always runs, whatever its estimated work
+		if (bWorkBudget && i > 0 && SimulatedWork + Entry.Work > WorkBudget)
+		{
+			Tier = EKawaiiFluidBudgetTier::Suspended;
+		}
+		else
+		{
+			SimulatedWork += Entry.Work;
+		}
+
+		ContextBudgetTiers.Add(Entry.Context, Tier);
+		switch (Tier)
+		{
+		case EKawaiiFluidBudgetTier::Full:		++FullCount; break;
+		case EKawaiiFluidBudgetTier::Throttled:	++ThrottledCount; break;
+		case EKawaiiFluidBudgetTier::Suspended:	++SuspendedCount; break;
+		}
+	}
+
+	// Restore caps for sources that are no longer throttled
+	for (const TPair<int32, FAppliedSourceCap>& Pair : AppliedSourceCaps)
+	{
+		if (!NewCaps.Contains(Pair.Key))
+		{
+			RestoreSourceCap(Pair.Key, Pair.Value);
+		}
+	}
+	AppliedSourceCaps = MoveTemp(NewCaps);
+	BudgetReleaseFrames = MoveTemp(NewReleaseFrames);
+
+	BudgetStats.ParticleBudget = static_cast<int32>(FMath::Min<int64>(ParticleBudget, MAX_int32));
+	BudgetStats.TotalParticleCount = static_cast<int32>(FMath::Min<int64>(TotalParticles, MAX_int32));
+	BudgetStats.WorkBudget = WorkBudget;
+	BudgetStats.EstimatedWork = TotalWork;
+	BudgetStats.SimulatedWork = SimulatedWork;
+	BudgetStats.FullCount = FullCount;
+	BudgetStats.ThrottledCount = ThrottledCount;
+	BudgetStats.SuspendedCount = SuspendedCount;
+
+	SET_DWORD_STAT(STAT_BudgetParticleCap, BudgetStats.ParticleBudget);
+	SET_DWORD_STAT(STAT_BudgetParticleCount, BudgetStats.TotalParticleCount);
+	SET_DWORD_STAT(STAT_BudgetThrottled, ThrottledCount);
+	SET_DWORD_STAT(STAT_BudgetSuspended, SuspendedCount);
+	SET_DWORD_STAT(STAT_BudgetEstimatedWork, FMath::Min<int64>(TotalWork, MAX_int32));
+	SET_DWORD_STAT(STAT_BudgetSimulatedWork, FMath::Min<int64>(SimulatedWork, MAX_int32));
+
+#if STATS
+	TArray<TPair<UKawaiiFluidVolumeComponent*, FGPUFluidMemoryStats>> VolumeMemory;
+	GetVolumeMemoryStats(VolumeMemory);
+	int64 ReservedBytes = 0;
+	int64 UsedBytes = 0;
+	for (const TPair<UKawaiiFluidVolumeComponent*, FGPUFluidMemoryStats>& Pair : VolumeMemory)
+	{
+		ReservedBytes += Pair.Value.ReservedBytes;
+		UsedBytes += Pair.Value.UsedBytes;
+	}
+	SET_FLOAT_STAT(STAT_GPUMemoryReservedMB, ReservedBytes / (1024.0 * 1024.0));
+	SET_FLOAT_STAT(STAT_GPUMemoryUsedMB, UsedBytes / (1024.0 * 1024.0));
+#endif
+}
+
+/**
+ * @brief Split a context's particle grant across its sources as per-source emitter caps.
+ * @param Context The throttled context.
+ * @param ContextParticleCount Live particle count of the context.
+ * @param Grant Number of particles the context may keep.
+ * @param OutCaps Caps to apply this frame, keyed by SourceID.
+ */
+void UKawaiiFluidSimulatorSubsystem::ApplyContextParticleGrant(UKawaiiFluidSimulationContext* Context,
+	int32 ContextParticleCount, int32 Grant, TMap<int32, FAppliedSourceCap>& OutCaps)
+{
+	TSharedPtr<FGPUFluidSimulator> Simulator = Context ? Context->GetGPUSimulatorShared() : nullptr;
+	if (!Simulator.IsValid() || ContextParticleCount <= 0)
+	{
+		return;
+	}
+
+	// Grant ratio applied uniformly to every source (cap 0 means "no limit", so keep at least 1)
+	const double GrantRatio = static_cast<double>(Grant) / ContextParticleCount;
+
+	auto CapSource = [&](const UKawaiiFluidSimulationModule* Module, int32 SourceID, int32 BaseCap)
+	{
+		if (SourceID < 0 || OutCaps.Contains(SourceID))
+		{
+			return;
+		}
+
+		const int32 SourceCount = Module->GetParticleCountForSource(SourceID);
+		if (SourceCount <= 0)
+		{
+			return;
+		}
+
+		int32 Cap = FMath::Max(1, FMath::FloorToInt32(SourceCount * GrantRatio));
+		if (BaseCap > 0)
+		{
+			Cap = FMath::Min(Cap, BaseCap);
+		}
+
+		const FAppliedSourceCap* Previous = AppliedSourceCaps.Find(SourceID);
+		if (!Previous || Previous->AppliedCap != Cap)
+		{
+			Simulator->SetSourceEmitterMax(SourceID, Cap);
+		}
+
+		FAppliedSourceCap& Applied = OutCaps.Add(SourceID);
+		Applied.Simulator = Simulator;
+		Applied.AppliedCap = Cap;
+	};
+
+	for (UKawaiiFluidSimulationModule* Module : AllModules)
+	{
+		if (!Module || Module->GetSimulationContext() != Context)
+		{
+			continue;
+		}
+
+		// Emitter sources restore to their own recycle limit when the budget releases them
+		if (AKawaiiFluidVolume* OwnerVolume = Cast<AKawaiiFluidVolume>(Module->GetOuter()))
+		{
+			for (const TWeakObjectPtr<AKawaiiFluidEmitter>& WeakEmitter : OwnerVolume->GetRegisteredEmitters())
+			{
+				const AKawaiiFluidEmitter* Emitter = WeakEmitter.Get();
+				const UKawaiiFluidEmitterComponent* EmitterComp = Emitter ? Emitter->GetEmitterComponent() : nullptr;
+				if (!EmitterComp)
+				{
+					continue;
+				}
+
+				CapSource(Module, EmitterComp->GetSourceID(), GetEmitterRecycleCap(EmitterComp));
+			}
+		}
+
+		CapSource(Module, Module->GetSourceID(), 0);
+	}
+}
+
+/**
+ * @brief Keep the caps a context had last frame while it waits to be released.
+ * @param Context The context whose caps are held.
+ * @param OutCaps Caps to apply this frame, keyed by SourceID.
+ */
+void UKawaiiFluidSimulatorSubsystem::HoldContextCaps(const UKawaiiFluidSimulationContext* Context, TMap<int32, FAppliedSourceCap>& OutCaps) const
+{
+	const FGPUFluidSimulator* ContextSimulator = Context ? Context->GetGPUSimulator() : nullptr;
+	for (const TPair<int32, FAppliedSourceCap>& Pair : AppliedSourceCaps)
+	{
+		TSharedPtr<FGPUFluidSimulator> Simulator = Pair.Value.Simulator.Pin();
+		if (Simulator.IsValid() && Simulator.Get() == ContextSimulator)
+		{
+			OutCaps.Add(Pair.Key, Pair.Value);
+		}
+	}
+}
+
+/**
+ * @brief Emitter cap a source has without the budget: its recycle limit, or 0 (no limit).
+ * @param EmitterComp The emitter component owning the source.
+ * @return The emitter's own per-source cap.
+ */
+int32 UKawaiiFluidSimulatorSubsystem::GetEmitterRecycleCap(const UKawaiiFluidEmitterComponent* EmitterComp)
+{
+	return (EmitterComp->bRecycleOldestParticles && EmitterComp->MaxParticleCount > 0) ? EmitterComp->MaxParticleCount : 0;
+}
+
+/**
+ * @brief Find the current unbudgeted cap of a source from its live owner.
+ * @param SourceID The source to resolve.
+ * @param OutBaseCap The emitter's recycle limit, or 0 for module sources.
+ * @return false if neither a registered emitter nor a module owns the source anymore.
+ */
+bool UKawaiiFluidSimulatorSubsystem::ResolveSourceBaseCap(int32 SourceID, int32& OutBaseCap) const
+{
+	for (const UKawaiiFluidSimulationModule* Module : AllModules)
+	{
+		if (!Module)
+		{
+			continue;
+		}
+
+		if (Module->GetSourceID() == SourceID)
+		{
+			OutBaseCap = 0;
+			return true;
+		}
+
+		if (const AKawaiiFluidVolume* OwnerVolume = Cast<AKawaiiFluidVolume>(Module->GetOuter()))
+		{
+			for (const TWeakObjectPtr<AKawaiiFluidEmitter>& WeakEmitter : OwnerVolume->GetRegisteredEmitters())
+			{
+				const AKawaiiFluidEmitter* Emitter = WeakEmitter.Get();
+				const UKawaiiFluidEmitterComponent* EmitterComp = Emitter ? Emitter->GetEmitterComponent() : nullptr;
+				if (EmitterComp && EmitterComp->GetSourceID() == SourceID)
+				{
+					OutBaseCap = GetEmitterRecycleCap(EmitterComp);
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Hand a budget-capped source back its own cap, resolved now rather than when it was capped.
+ * @param SourceID The source to release.
+ * @param Applied The budget cap being released.
+ */
+void UKawaiiFluidSimulatorSubsystem::RestoreSourceCap(int32 SourceID, const FAppliedSourceCap& Applied) const
+{
+	// The emitter's recycle settings may have changed while capped; a vanished source keeps nothing to restore
+	int32 BaseCap = 0;
+	if (!ResolveSourceBaseCap(SourceID, BaseCap))
+	{
+		return;
+	}
+
+	if (TSharedPtr<FGPUFluidSimulator> Simulator = Applied.Simulator.Pin())
+	{
+		Simulator->SetSourceEmitterMax(SourceID, BaseCap);
+	}
+}
+
+/**
+ * @brief Restore every budget-imposed emitter cap to the source's current value.
+ */
+void UKawaiiFluidSimulatorSubsystem::ReleaseBudgetCaps()
+{
+	for (const TPair<int32, FAppliedSourceCap>& Pair : AppliedSourceCaps)
+	{
+		RestoreSourceCap(Pair.Key, Pair.Value);
+	}
+	AppliedSourceCaps.Empty();
+	BudgetReleaseFrames.Empty();
+}
+
 /**
  * @brief Get an existing simulation context or create a new one for a volume/preset pair.
  * @param VolumeComponent The volume component defining the spatial hash bounds.
@@ -553,7 +1214,7 @@ void UKawaiiFluidSimulatorSubsystem::SimulateIndependentFluidComponents(float De
 
 		UKawaiiFluidVolumeComponent* TargetVolume = Module->GetTargetVolumeComponent();
 		UKawaiiFluidSimulationContext* Context = GetOrCreateContext(TargetVolume, EffectivePreset);
-		if (!Context) continue;
+		if (!Context || GetContextBudgetTier(Context) == EKawaiiFluidBudgetTier::Suspended) continue;
 
 		FKawaiiFluidSpatialHash* SpatialHash = Module->GetSpatialHash();
 		if (!SpatialHash) continue;
@@ -602,7 +1263,7 @@ void UKawaiiFluidSimulatorSubsystem::SimulateBatchedFluidComponents(float DeltaT
 		if (!Preset || Modules.Num() == 0) continue;
 
 		UKawaiiFluidSimulationContext* Context = GetOrCreateContext(CacheKey.VolumeComponent, Preset);
-		if (!Context) continue;
+		if (!Context || GetContextBudgetTier(Context) == EKawaiiFluidBudgetTier::Suspended) continue;
 
 		SharedSpatialHash->SetCellSize(Preset->SmoothingRadius);
 		MergeModuleParticles(Modules);
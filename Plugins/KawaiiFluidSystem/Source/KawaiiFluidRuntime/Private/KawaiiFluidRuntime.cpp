@@ -1,6 +1,7 @@
 ﻿// Copyright 2026 Team_Bruteforce. All Rights Reserved.
 
 #include "KawaiiFluidRuntime.h"
+#include "Simulation/Collision/KawaiiFluidCollisionShapeCache.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/Paths.h"
 #include "ShaderCore.h"
@@ -13,6 +14,8 @@ void FKawaiiFluidRuntimeModule::StartupModule()
 	FString PluginShaderPath = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("KawaiiFluidSystem"))->GetBaseDir(), TEXT("Shaders"));
 	AddShaderSourceDirectoryMapping(TEXT("/Plugin/KawaiiFluidSystem"), PluginShaderPath);
 
+	FKawaiiFluidCollisionShapeCache::Startup();
+
 	UE_LOG(LogTemp, Log, TEXT("KawaiiFluidRuntime Module Started: Shader Directory: %s"), *PluginShaderPath);
 }
 
@@ -20,6 +23,7 @@ void FKawaiiFluidRuntimeModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FKawaiiFluidCollisionShapeCache::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -107,13 +107,23 @@ void UKawaiiFluidRenderingModule::UpdateRenderers()
 		return;
 	}
 
-	if (MetaballRenderer && MetaballRenderer->IsEnabled())
+	const bool bMetaballActive = MetaballRenderer && MetaballRenderer->IsEnabled();
+	if (bMetaballActive)
 	{
 		MetaballRenderer->UpdateRendering(DataProviderPtr, 0.0f);
 	}
-	else if (ISMRenderer && ISMRenderer->IsEnabled())
+
+	if (ISMRenderer)
 	{
-		ISMRenderer->UpdateRendering(DataProviderPtr, 0.0f);
+		if (!bMetaballActive && ISMRenderer->IsEnabled())
+		{
+			ISMRenderer->UpdateRendering(DataProviderPtr, 0.0f);
+		}
+		else
+		{
+			// Proxy not drawn this frame: stop its GPU readback
+			ISMRenderer->ReleaseReadback(DataProviderPtr);
+		}
 	}
 }
 
@@ -12,6 +12,8 @@
 #include "Simulation/GPUFluidSimulator.h"
 #include "Simulation/Shaders/GPUFluidSimulatorShaders.h"  // For GPU_MORTON_GRID_AXIS_BITS
 #include "Simulation/Resources/GPUFluidParticle.h"  // For FGPUSpawnRequest
+#include "Simulation/Utils/KawaiiFluidLatticeTemplateCache.h"
+#include "Simulation/Utils/KawaiiFluidSpawnRandom.h"
 #include "UObject/UObjectGlobals.h"  // For FCoreUObjectDelegates
 #include "UObject/ObjectSaveContext.h"  // For FObjectPreSaveContext
 #include "Engine/World.h"
@@ -158,6 +160,7 @@ void UKawaiiFluidSimulationModule::UploadCPUParticlesToGPU()
 
 	const int32 UploadCount = Particles.Num();
 	int32 StartID = 0;
+	int32 QueuedCount = 0;
 
 	// Upload particles if any
 	if (UploadCount > 0)
@@ -170,11 +173,14 @@ void UKawaiiFluidSimulationModule::UploadCPUParticlesToGPU()
 			Particles[i].SourceID = CachedSourceID;
 		}
 
-		// Upload from CPU to GPU (bAppend=true: preserve particles from other components in batching environment)
-		GPUSim->UploadParticles(Particles, /*bAppend=*/true);
-
-		// After all appends, create/update GPU buffer + reset SpawnManager state
-		GPUSim->FinalizeUpload();
+		// Streams into the live buffer over the next frames (particles from other components are preserved)
+		QueuedCount = GPUSim->QueueParticleUpload(Particles);
+		if (QueuedCount < UploadCount)
+		{
+			// Registration uploads once; particles that did not fit the volume are lost, so say so
+			UE_LOG(LogTemp, Warning, TEXT("UploadCPUParticlesToGPU: Only %d of %d particles queued (SourceID=%d, %d resident + %d pending of %d capacity), the rest are dropped"),
+				QueuedCount, UploadCount, CachedSourceID, GPUSim->GetParticleCount(), GPUSim->GetPendingSpawnCount(), GPUSim->GetMaxParticleCount());
+		}
 	}
 
 	// Run initialization simulation to preload collision/landscape data (runs even with 0 particles)
@@ -209,8 +215,11 @@ void UKawaiiFluidSimulationModule::UploadCPUParticlesToGPU()
 	if (UploadCount > 0)
 	{
 		Particles.Empty();
-		UE_LOG(LogTemp, Log, TEXT("UploadCPUParticlesToGPU: Uploaded %d particles (SourceID=%d, IDs=%d~%d) to GPU"),
-			UploadCount, CachedSourceID, StartID, StartID + UploadCount - 1);
+		if (QueuedCount > 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("UploadCPUParticlesToGPU: Uploaded %d particles (SourceID=%d, IDs=%d~%d) to GPU"),
+				QueuedCount, CachedSourceID, StartID, StartID + QueuedCount - 1);
+		}
 	}
 	else
 	{
@@ -380,6 +389,9 @@ void UKawaiiFluidSimulationModule::Initialize(UKawaiiFluidPresetDataAsset* InPre
 
 	Preset = InPreset;
 
+	// Every initialization replays the same spawn streams
+	SpawnRandomStream = 0;
+
 	float SpatialHashCellSize = 20.0f;
 	if (Preset)
 	{
@@ -764,13 +776,30 @@ int32 UKawaiiFluidSimulationModule::SpawnParticle(FVector Position, FVector Velo
 	Request.Radius = Radius;
 	Request.SourceID = CachedSourceID;
 
-	TArray<FGPUSpawnRequest> Requests;
-	Requests.Add(Request);
-	GPUSim->AddSpawnRequests(Requests);
+	GPUSim->AddSpawnRequest(Request);
 
 	return -1;
 }
 
+/**
+ * @brief Restarts the spawn random streams; the following spawn calls repeat the same jitter for the same seed.
+ * @param Seed New value of SpawnRandomSeed.
+ */
+void UKawaiiFluidSimulationModule::ResetSpawnRandom(int32 Seed)
+{
+	SpawnRandomSeed = Seed;
+	SpawnRandomStream = 0;
+}
+
+/**
+ * @brief Random stream for the next spawn call, seeded by SpawnRandomSeed and this module's SourceID.
+ * @return Stateless generator indexed by particle or lattice point.
+ */
+FKawaiiFluidSpawnRandom UKawaiiFluidSimulationModule::NextSpawnRandom()
+{
+	return FKawaiiFluidSpawnRandom(FKawaiiFluidSpawnRandom::MakeSeed(SpawnRandomSeed, CachedSourceID), SpawnRandomStream++);
+}
+
 /**
  * @brief Spawns multiple particles with a random distribution within a radius.
  * @param Location Center of the spawn region.
@@ -791,9 +820,12 @@ void UKawaiiFluidSimulationModule::SpawnParticles(FVector Location, int32 Count,
 	TArray<FGPUSpawnRequest> SpawnRequests;
 	SpawnRequests.Reserve(Count);
 
+	const FKawaiiFluidSpawnRandom Random = NextSpawnRandom();
 	for (int32 i = 0; i < Count; ++i)
 	{
-		FVector RandomOffset = FMath::VRand() * FMath::FRandRange(0.0f, SpawnRadius);
+		// Random direction (two values) scaled by a random distance (third value)
+		const FVector3f U = Random.Unit(i);
+		FVector RandomOffset = FVector(FKawaiiFluidSpawnRandom::ToUnitVector(U.X, U.Y)) * (U.Z * SpawnRadius);
 		FVector SpawnPos = Location + RandomOffset;
 
 		FGPUSpawnRequest Request;
@@ -841,6 +873,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesSphere(FVector Center, float R
 	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
 
 	int32 SpawnedCount = 0;
+	const FKawaiiFluidSpawnRandom Random = NextSpawnRandom();
 
 	// Calculate estimated particle count (sphere volume / particle volume)
 	const float EstimatedCount = (4.0f / 3.0f * PI * Radius * Radius * Radius) / (Spacing * Spacing * Spacing);
@@ -869,11 +902,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesSphere(FVector Center, float R
 
 						if (bJitter && JitterRange > 0.0f)
 						{
-							SpawnPos += FVector(
-								FMath::FRandRange(-JitterRange, JitterRange),
-								FMath::FRandRange(-JitterRange, JitterRange),
-								FMath::FRandRange(-JitterRange, JitterRange)
-							);
+							SpawnPos += FVector(Random.Jitter(SpawnedCount, FVector3f(JitterRange)));
 						}
 
 						FGPUSpawnRequest Request;
@@ -923,6 +952,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesBox(FVector Center, FVector Ex
 	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
 
 	int32 SpawnedCount = 0;
+	const FKawaiiFluidSpawnRandom Random = NextSpawnRandom();
 	const int32 TotalCount = CountX * CountY * CountZ;
 	Particles.Reserve(Particles.Num() + TotalCount);
 
@@ -938,11 +968,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesBox(FVector Center, FVector Ex
 				// Apply jitter (in local space)
 				if (bJitter && JitterRange > 0.0f)
 				{
-					LocalPos += FVector(
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange)
-					);
+					LocalPos += FVector(Random.Jitter(SpawnedCount, FVector3f(JitterRange)));
 				}
 
 				// Calculate world position after applying rotation
@@ -979,6 +1005,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesCylinder(FVector Center, float
 	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
 
 	int32 SpawnedCount = 0;
+	const FKawaiiFluidSpawnRandom Random = NextSpawnRandom();
 
 	// Calculate estimated particle count (cylinder volume / particle volume)
 	const float EstimatedCount = (PI * Radius * Radius * HalfHeight * 2.0f) / (Spacing * Spacing * Spacing);
@@ -1003,11 +1030,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesCylinder(FVector Center, float
 				// Apply jitter (in local space)
 				if (bJitter && JitterRange > 0.0f)
 				{
-					LocalPos += FVector(
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange)
-					);
+					LocalPos += FVector(Random.Jitter(SpawnedCount, FVector3f(JitterRange)));
 				}
 
 				// Calculate world position after applying rotation
@@ -1026,87 +1049,64 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesCylinder(FVector Center, float
 // Hexagonal Close Packing Spawn Functions
 //=============================================================================
 
-int32 UKawaiiFluidSimulationModule::SpawnParticlesBoxHexagonal(FVector Center, FVector Extent, float Spacing,
-                                                                bool bJitter, float JitterAmount, FVector Velocity,
-                                                                FRotator Rotation)
+/**
+ * @brief Spawns a cached shape-local lattice (see FKawaiiFluidLatticeTemplateCache) as one GPU batch.
+ * @param Key Lattice shape, size and spacing.
+ * @param Center World position of the shape center.
+ * @param Rotation Shape orientation.
+ * @param Velocity Local-space initial velocity (rotated with the shape).
+ * @param JitterRange Uniform per-axis jitter range in local space, 0 = none.
+ * @return Number of requested particles.
+ */
+int32 UKawaiiFluidSimulationModule::SpawnLatticeTemplate(const FKawaiiFluidLatticeTemplateKey& Key, const FVector& Center, const FQuat& Rotation,
+                                                         const FVector& Velocity, float JitterRange)
 {
-	if (Spacing <= 0.0f)
+	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
+	if (!GPUSim)
 	{
 		return 0;
 	}
 
-	// HCP density compensation: HCP is ~1.42x denser than cubic for the same spacing
-	// To achieve similar number density, multiply spacing by (1/0.707)^(1/3) ≈ 1.122
-	const float HCPCompensation = 1.122f;
-	const float AdjustedSpacing = Spacing * HCPCompensation;
-
-	// Hexagonal Close Packing (HCP) constants
-	// XY plane: hexagonal grid with row offset
-	// Z layers: alternating offset for close packing
-	const float RowSpacingY = AdjustedSpacing * 0.866025f;  // sqrt(3)/2
-	const float LayerSpacingZ = AdjustedSpacing * 0.816497f;  // sqrt(2/3)
-	const float JitterRange = AdjustedSpacing * JitterAmount;
-
-	// Calculate grid counts
-	const int32 CountX = FMath::Max(1, FMath::CeilToInt(Extent.X * 2.0f / AdjustedSpacing));
-	const int32 CountY = FMath::Max(1, FMath::CeilToInt(Extent.Y * 2.0f / RowSpacingY));
-	const int32 CountZ = FMath::Max(1, FMath::CeilToInt(Extent.Z * 2.0f / LayerSpacingZ));
+	const FKawaiiFluidLatticeTemplateRef Template = FKawaiiFluidLatticeTemplateCache::Get().FindOrBuild(Key);
 
-	const FQuat RotationQuat = Rotation.Quaternion();
-	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
+	FGPUSpawnRequest Prototype;
+	Prototype.Velocity = FVector3f(Rotation.RotateVector(Velocity));
+	Prototype.Mass = Preset ? Preset->ParticleMass : 1.0f;
+	Prototype.Radius = Preset ? Preset->ParticleRadius : 5.0f;
+	Prototype.SourceID = CachedSourceID;
 
-	int32 SpawnedCount = 0;
-	const int32 EstimatedTotal = CountX * CountY * CountZ;
-	Particles.Reserve(Particles.Num() + EstimatedTotal);
-
-	// Start position (bottom-left-back corner)
-	const FVector LocalStart(-Extent.X + AdjustedSpacing * 0.5f, -Extent.Y + RowSpacingY * 0.5f, -Extent.Z + LayerSpacingZ * 0.5f);
+	TArray<FGPUSpawnRequest> SpawnRequests;
+	const int32 SpawnedCount = Template->AppendSpawnRequests(
+		FVector3f(Center), FVector3f(Rotation.GetAxisX()), FVector3f(Rotation.GetAxisY()), FVector3f(Rotation.GetAxisZ()),
+		FVector3f(JitterRange), NextSpawnRandom(), -1.0f, Prototype, SpawnRequests);
 
-	for (int32 z = 0; z < CountZ; ++z)
+	if (SpawnedCount > 0)
 	{
-		// Z layer offset for HCP (ABC stacking pattern)
-		const float ZLayerOffsetX = (z % 3 == 1) ? AdjustedSpacing * 0.5f : ((z % 3 == 2) ? AdjustedSpacing * 0.25f : 0.0f);
-		const float ZLayerOffsetY = (z % 3 == 1) ? RowSpacingY / 3.0f : ((z % 3 == 2) ? RowSpacingY * 2.0f / 3.0f : 0.0f);
-
-		for (int32 y = 0; y < CountY; ++y)
-		{
-			// Row offset for hexagonal pattern in XY plane
-			const float RowOffsetX = (y % 2 == 1) ? AdjustedSpacing * 0.5f : 0.0f;
+		GPUSim->AddSpawnRequests(SpawnRequests);
+	}
 
-			for (int32 x = 0; x < CountX; ++x)
-			{
-				FVector LocalPos(
-					LocalStart.X + x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX,
-					LocalStart.Y + y * RowSpacingY + ZLayerOffsetY,
-					LocalStart.Z + z * LayerSpacingZ
-				);
+	return SpawnedCount;
+}
 
-				// Check bounds
-				if (FMath::Abs(LocalPos.X) > Extent.X ||
-				    FMath::Abs(LocalPos.Y) > Extent.Y ||
-				    FMath::Abs(LocalPos.Z) > Extent.Z)
-				{
-					continue;
-				}
+int32 UKawaiiFluidSimulationModule::SpawnParticlesBoxHexagonal(FVector Center, FVector Extent, float Spacing,
+                                                                bool bJitter, float JitterAmount, FVector Velocity,
+                                                                FRotator Rotation)
+{
+	if (Spacing <= 0.0f)
+	{
+		return 0;
+	}
 
-				// Apply jitter
-				if (bJitter && JitterRange > 0.0f)
-				{
-					LocalPos += FVector(
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange)
-					);
-				}
+	// HCP density compensation: HCP is ~1.42x denser than cubic for the same spacing
+	// To achieve similar number density, multiply spacing by (1/0.707)^(1/3) ≈ 1.122
+	const float JitterRange = bJitter ? Spacing * KawaiiFluidSpawnLattice::HCPCompensation * JitterAmount : 0.0f;
 
-				const FVector WorldPos = Center + RotationQuat.RotateVector(LocalPos);
-				SpawnParticle(WorldPos, WorldVelocity);
-				++SpawnedCount;
-			}
-		}
-	}
+	FKawaiiFluidLatticeTemplateKey Key;
+	Key.Shape = EKawaiiFluidSpawnShape::Box;
+	Key.Extent = FVector3f(Extent);
+	Key.Spacing = Spacing;
 
-	return SpawnedCount;
+	return SpawnLatticeTemplate(Key, Center, Rotation.Quaternion(), Velocity, JitterRange);
 }
 
 int32 UKawaiiFluidSimulationModule::SpawnParticlesSphereHexagonal(FVector Center, float Radius, float Spacing,
@@ -1119,67 +1119,14 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesSphereHexagonal(FVector Center
 	}
 
 	// HCP density compensation: HCP is ~1.42x denser than cubic for the same spacing
-	const float HCPCompensation = 1.122f;
-	const float AdjustedSpacing = Spacing * HCPCompensation;
+	const float JitterRange = bJitter ? Spacing * KawaiiFluidSpawnLattice::HCPCompensation * JitterAmount : 0.0f;
 
-	// Use Box Hexagonal spawn and filter by sphere radius
-	const float RowSpacingY = AdjustedSpacing * 0.866025f;
-	const float LayerSpacingZ = AdjustedSpacing * 0.816497f;
-	const float JitterRange = AdjustedSpacing * JitterAmount;
-	const float RadiusSq = Radius * Radius;
-
-	const int32 GridSize = FMath::CeilToInt(Radius / AdjustedSpacing) + 1;
-	const int32 GridSizeY = FMath::CeilToInt(Radius / RowSpacingY) + 1;
-	const int32 GridSizeZ = FMath::CeilToInt(Radius / LayerSpacingZ) + 1;
-
-	const FQuat RotationQuat = Rotation.Quaternion();
-	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
+	FKawaiiFluidLatticeTemplateKey Key;
+	Key.Shape = EKawaiiFluidSpawnShape::Sphere;
+	Key.Extent = FVector3f(Radius);
+	Key.Spacing = Spacing;
 
-	int32 SpawnedCount = 0;
-	const float EstimatedCount = (4.0f / 3.0f) * PI * Radius * Radius * Radius / (AdjustedSpacing * AdjustedSpacing * AdjustedSpacing);
-	Particles.Reserve(Particles.Num() + FMath::CeilToInt(EstimatedCount));
-
-	for (int32 z = -GridSizeZ; z <= GridSizeZ; ++z)
-	{
-		const float ZLayerOffsetX = (((z + GridSizeZ) % 3) == 1) ? AdjustedSpacing * 0.5f : ((((z + GridSizeZ) % 3) == 2) ? AdjustedSpacing * 0.25f : 0.0f);
-		const float ZLayerOffsetY = (((z + GridSizeZ) % 3) == 1) ? RowSpacingY / 3.0f : ((((z + GridSizeZ) % 3) == 2) ? RowSpacingY * 2.0f / 3.0f : 0.0f);
-
-		for (int32 y = -GridSizeY; y <= GridSizeY; ++y)
-		{
-			const float RowOffsetX = (((y + GridSizeY) % 2) == 1) ? AdjustedSpacing * 0.5f : 0.0f;
-
-			for (int32 x = -GridSize; x <= GridSize; ++x)
-			{
-				FVector LocalPos(
-					x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX,
-					y * RowSpacingY + ZLayerOffsetY,
-					z * LayerSpacingZ
-				);
-
-				// Check sphere bounds
-				if (LocalPos.SizeSquared() > RadiusSq)
-				{
-					continue;
-				}
-
-				// Apply jitter
-				if (bJitter && JitterRange > 0.0f)
-				{
-					LocalPos += FVector(
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange)
-					);
-				}
-
-				const FVector WorldPos = Center + RotationQuat.RotateVector(LocalPos);
-				SpawnParticle(WorldPos, WorldVelocity);
-				++SpawnedCount;
-			}
-		}
-	}
-
-	return SpawnedCount;
+	return SpawnLatticeTemplate(Key, Center, Rotation.Quaternion(), Velocity, JitterRange);
 }
 
 int32 UKawaiiFluidSimulationModule::SpawnParticlesCylinderHexagonal(FVector Center, float Radius, float HalfHeight, float Spacing,
@@ -1192,73 +1139,14 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesCylinderHexagonal(FVector Cent
 	}
 
 	// HCP density compensation: HCP is ~1.42x denser than cubic for the same spacing
-	const float HCPCompensation = 1.122f;
-	const float AdjustedSpacing = Spacing * HCPCompensation;
+	const float JitterRange = bJitter ? Spacing * KawaiiFluidSpawnLattice::HCPCompensation * JitterAmount : 0.0f;
 
-	const float RowSpacingY = AdjustedSpacing * 0.866025f;
-	const float LayerSpacingZ = AdjustedSpacing * 0.816497f;
-	const float JitterRange = AdjustedSpacing * JitterAmount;
-	const float RadiusSq = Radius * Radius;
+	FKawaiiFluidLatticeTemplateKey Key;
+	Key.Shape = EKawaiiFluidSpawnShape::Cylinder;
+	Key.Extent = FVector3f(Radius, Radius, HalfHeight);
+	Key.Spacing = Spacing;
 
-	const int32 GridSizeXY = FMath::CeilToInt(Radius / AdjustedSpacing) + 1;
-	const int32 GridSizeY = FMath::CeilToInt(Radius / RowSpacingY) + 1;
-	const int32 GridSizeZ = FMath::CeilToInt(HalfHeight / LayerSpacingZ);
-
-	const FQuat RotationQuat = Rotation.Quaternion();
-	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
-
-	int32 SpawnedCount = 0;
-	const float EstimatedCount = PI * Radius * Radius * HalfHeight * 2.0f / (AdjustedSpacing * AdjustedSpacing * AdjustedSpacing);
-	Particles.Reserve(Particles.Num() + FMath::CeilToInt(EstimatedCount));
-
-	for (int32 z = -GridSizeZ; z <= GridSizeZ; ++z)
-	{
-		const float ZLayerOffsetX = (((z + GridSizeZ) % 3) == 1) ? AdjustedSpacing * 0.5f : ((((z + GridSizeZ) % 3) == 2) ? AdjustedSpacing * 0.25f : 0.0f);
-		const float ZLayerOffsetY = (((z + GridSizeZ) % 3) == 1) ? RowSpacingY / 3.0f : ((((z + GridSizeZ) % 3) == 2) ? RowSpacingY * 2.0f / 3.0f : 0.0f);
-
-		for (int32 y = -GridSizeY; y <= GridSizeY; ++y)
-		{
-			const float RowOffsetX = (((y + GridSizeY) % 2) == 1) ? AdjustedSpacing * 0.5f : 0.0f;
-
-			for (int32 x = -GridSizeXY; x <= GridSizeXY; ++x)
-			{
-				FVector LocalPos(
-					x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX,
-					y * RowSpacingY + ZLayerOffsetY,
-					z * LayerSpacingZ
-				);
-
-				// Check cylinder XY bounds
-				const float DistSqXY = LocalPos.X * LocalPos.X + LocalPos.Y * LocalPos.Y;
-				if (DistSqXY > RadiusSq)
-				{
-					continue;
-				}
-
-				// Check Z bounds
-				if (FMath::Abs(LocalPos.Z) > HalfHeight)
-				{
-					continue;
-				}
-
-				// Apply jitter
-				if (bJitter && JitterRange > 0.0f)
-				{
-					LocalPos += FVector(
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange)
-					);
-				}
-
-				const FVector WorldPos = Center + RotationQuat.RotateVector(LocalPos);
-				SpawnParticle(WorldPos, WorldVelocity);
-				++SpawnedCount;
-			}
-		}
-	}
-
-	return SpawnedCount;
+	return SpawnLatticeTemplate(Key, Center, Rotation.Quaternion(), Velocity, JitterRange);
 }
 
 int32 UKawaiiFluidSimulationModule::SpawnParticleDirectional(FVector Position, FVector Direction, float Speed,
@@ -1274,6 +1162,9 @@ int32 UKawaiiFluidSimulationModule::SpawnParticleDirectional(FVector Position, F
 	FVector SpawnPos = Position;
 	FVector SpawnVel = Dir * Speed;
 
+	// Index 0 drives the position dispersion, index 1 the spray direction
+	const FKawaiiFluidSpawnRandom Random = NextSpawnRandom();
+
 	// Apply stream radius (position dispersion)
 	if (Radius > 0.0f)
 	{
@@ -1281,8 +1172,9 @@ int32 UKawaiiFluidSimulationModule::SpawnParticleDirectional(FVector Position, F
 		FVector Right, Up;
 		Dir.FindBestAxisVectors(Right, Up);
 
-		const float RandomAngle = FMath::FRandRange(0.0f, 2.0f * PI);
-		const float RandomRadius = FMath::FRandRange(0.0f, Radius);
+		const FVector3f U = Random.Unit(0);
+		const float RandomAngle = U.X * 2.0f * PI;
+		const float RandomRadius = U.Y * Radius;
 
 		SpawnPos += Right * FMath::Cos(RandomAngle) * RandomRadius;
 		SpawnPos += Up * FMath::Sin(RandomAngle) * RandomRadius;
@@ -1293,8 +1185,9 @@ int32 UKawaiiFluidSimulationModule::SpawnParticleDirectional(FVector Position, F
 	{
 		// Random direction within spray angle range
 		const float HalfAngleRad = FMath::DegreesToRadians(ConeAngle * 0.5f);
-		const float RandomPhi = FMath::FRandRange(0.0f, 2.0f * PI);
-		const float RandomTheta = FMath::FRandRange(0.0f, HalfAngleRad);
+		const FVector3f U = Random.Unit(1);
+		const float RandomPhi = U.X * 2.0f * PI;
+		const float RandomTheta = U.Y * HalfAngleRad;
 
 		// Generate random direction in local coordinate system
 		FVector Right, Up;
@@ -1346,79 +1239,30 @@ int32 UKawaiiFluidSimulationModule::SpawnParticleDirectionalHexLayerBatch(FVecto
 
 	// Limit jitter range (0 ~ 0.5)
 	Jitter = FMath::Clamp(Jitter, 0.0f, 0.5f);
-	const float MaxJitterOffset = Spacing * Jitter;
 	const bool bApplyJitter = Jitter > KINDA_SMALL_NUMBER;
 
 	// Create local coordinate system perpendicular to direction
 	FVector Right, Up;
 	Dir.FindBestAxisVectors(Right, Up);
 
-	// Hexagonal packing constants
-	const float RowSpacing = Spacing * FMath::Sqrt(3.0f) * 0.5f;  // ~0.866 * Spacing
-	const float RadiusSq = Radius * Radius;
-
-	// Calculate number of rows
-	const int32 NumRows = FMath::CeilToInt(Radius / RowSpacing) * 2 + 1;
-	const int32 HalfRows = NumRows / 2;
-
-	int32 SpawnedCount = 0;
-	const FVector SpawnVel = Dir * Speed;
-
-	const float ParticleMass = Preset ? Preset->ParticleMass : 1.0f;
-	const float ParticleRadius = Preset ? Preset->ParticleRadius : 5.0f;
+	// The layer only depends on radius and spacing, so repeated stream steps reuse the cached template
+	FKawaiiFluidLatticeTemplateKey Key;
+	Key.Shape = EKawaiiFluidSpawnShape::Disc;
+	Key.Extent = FVector3f(Radius, Radius, 0.0f);
+	Key.Spacing = Spacing;
+	const FKawaiiFluidLatticeTemplateRef Template = FKawaiiFluidLatticeTemplateCache::Get().FindOrBuild(Key);
 
-	// Iterate through hexagonal grid
-	for (int32 RowIdx = -HalfRows; RowIdx <= HalfRows; ++RowIdx)
-	{
-		const float LocalY = RowIdx * RowSpacing;
-		const float LocalYSq = LocalY * LocalY;
-
-		// Calculate maximum X range inside circle for this row
-		if (LocalYSq > RadiusSq)
-		{
-			continue;  // Row outside circle
-		}
-
-		const float MaxX = FMath::Sqrt(RadiusSq - LocalYSq);
+	FGPUSpawnRequest Prototype;
+	Prototype.Velocity = FVector3f(Dir * Speed);
+	Prototype.Mass = Preset ? Preset->ParticleMass : 1.0f;
+	Prototype.Radius = Preset ? Preset->ParticleRadius : 5.0f;
+	Prototype.SourceID = CachedSourceID;
 
-		// Apply X offset for odd rows (Hexagonal Packing)
-		const float XOffset = (FMath::Abs(RowIdx) % 2 != 0) ? Spacing * 0.5f : 0.0f;
-
-		// Calculate X start point (symmetric around center)
-		const int32 NumCols = FMath::FloorToInt(MaxX / Spacing);
-
-		for (int32 ColIdx = -NumCols; ColIdx <= NumCols; ++ColIdx)
-		{
-			float LocalX = ColIdx * Spacing + XOffset;
-			float LocalYFinal = LocalY;
-
-			// Apply jitter: add random offset
-			if (bApplyJitter)
-			{
-				LocalX += FMath::FRandRange(-MaxJitterOffset, MaxJitterOffset);
-				LocalYFinal += FMath::FRandRange(-MaxJitterOffset, MaxJitterOffset);
-			}
-
-			// Check if inside circle (verify still inside after jitter)
-			if (LocalX * LocalX + LocalYFinal * LocalYFinal <= RadiusSq)
-			{
-				FVector SpawnPos = Position + Right * LocalX + Up * LocalYFinal;
-				
-				// Create request and add to batch
-				FGPUSpawnRequest Request;
-				Request.Position = FVector3f(SpawnPos);
-				Request.Velocity = FVector3f(SpawnVel);
-				Request.Mass = ParticleMass;
-				Request.Radius = ParticleRadius;
-				Request.SourceID = CachedSourceID;
-
-				OutBatch.Add(Request);
-				++SpawnedCount;
-			}
-		}
-	}
-
-	return SpawnedCount;
+	// Jittered points are re-checked against the circle
+	const float MaxJitterOffset = bApplyJitter ? Spacing * Jitter : 0.0f;
+	return Template->AppendSpawnRequests(
+		FVector3f(Position), FVector3f(Right), FVector3f(Up), FVector3f(Dir),
+		FVector3f(MaxJitterOffset, MaxJitterOffset, 0.0f), NextSpawnRandom(), Radius, Prototype, OutBatch);
 }
 
 void UKawaiiFluidSimulationModule::ClearAllParticles()
@@ -1644,6 +1488,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesSphereByCount(FVector Center,
 	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
 
 	int32 SpawnedCount = 0;
+	const FKawaiiFluidSpawnRandom Random = NextSpawnRandom();
 	Particles.Reserve(Particles.Num() + Count);
 
 	// Iterate through grid
@@ -1663,11 +1508,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesSphereByCount(FVector Center,
 					// Apply jitter
 					if (bJitter && JitterRange > 0.0f)
 					{
-						SpawnPos += FVector(
-							FMath::FRandRange(-JitterRange, JitterRange),
-							FMath::FRandRange(-JitterRange, JitterRange),
-							FMath::FRandRange(-JitterRange, JitterRange)
-						);
+						SpawnPos += FVector(Random.Jitter(SpawnedCount, FVector3f(JitterRange)));
 					}
 
 					SpawnParticle(SpawnPos, WorldVelocity);
@@ -1716,6 +1557,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesBoxByCount(FVector Center, FVe
 	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
 
 	int32 SpawnedCount = 0;
+	const FKawaiiFluidSpawnRandom Random = NextSpawnRandom();
 	Particles.Reserve(Particles.Num() + Count);
 
 	for (int32 x = 0; x < CountX && SpawnedCount < Count; ++x)
@@ -1730,11 +1572,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesBoxByCount(FVector Center, FVe
 				// Apply jitter (in local space)
 				if (bJitter && JitterRange > 0.0f)
 				{
-					LocalPos += FVector(
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange)
-					);
+					LocalPos += FVector(Random.Jitter(SpawnedCount, FVector3f(JitterRange)));
 				}
 
 				// Calculate world position after applying rotation
@@ -1774,6 +1612,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesCylinderByCount(FVector Center
 	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
 
 	int32 SpawnedCount = 0;
+	const FKawaiiFluidSpawnRandom Random = NextSpawnRandom();
 	Particles.Reserve(Particles.Num() + Count);
 
 	// Iterate through grid
@@ -1795,11 +1634,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesCylinderByCount(FVector Center
 				// Apply jitter (in local space)
 				if (bJitter && JitterRange > 0.0f)
 				{
-					LocalPos += FVector(
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange),
-						FMath::FRandRange(-JitterRange, JitterRange)
-					);
+					LocalPos += FVector(Random.Jitter(SpawnedCount, FVector3f(JitterRange)));
 				}
 
 				// Calculate world position after applying rotation
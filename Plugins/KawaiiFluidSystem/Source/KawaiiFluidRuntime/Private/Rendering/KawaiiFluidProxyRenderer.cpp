@@ -7,6 +7,77 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Simulation/GPUFluidSimulator.h"
 #include "Engine/StaticMesh.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/**
+	 * @struct FProxyInstanceSettings
+	 * @brief Per-frame inputs of the instance build.
+	 */
+	struct FProxyInstanceSettings
+	{
+		FVector Scale;
+		FVector ParkLocation;
+		FLinearColor MinColor;
+		FLinearColor MaxColor;
+		float MaxSpeedForColor;
+		bool bRotateByVelocity;
+	};
+
+	/**
+	 * @brief Helper: Build one instance per particle in parallel.
+	 *
+	 * Instance i always belongs to particle i, so the ISM can be updated in place. Non-finite positions
+	 * (stale readback after despawn compaction) become zero-scale instances instead of being skipped.
+	 *
+	 * @param NumParticles Particle count.
+	 * @param Settings Scale, colors and rotation mode.
+	 * @param bWriteColors Also fill OutCustomData (4 floats per instance).
+	 * @param OutTransforms Instance transforms (resized, allocation kept).
+	 * @param OutCustomData Instance RGBA colors (resized, allocation kept).
+	 * @param GetParticle Reads position and velocity of particle i from the source in place.
+	 */
+	template <typename GetParticleFunc>
+	void BuildProxyInstances(int32 NumParticles, const FProxyInstanceSettings& Settings, bool bWriteColors,
+		TArray<FTransform>& OutTransforms, TArray<float>& OutCustomData, GetParticleFunc&& GetParticle)
+	{
+		OutTransforms.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+		OutCustomData.SetNumUninitialized(bWriteColors ? NumParticles * 4 : 0, EAllowShrinking::No);
+
+		const FTransform ParkedTransform(FQuat::Identity, Settings.ParkLocation, FVector::ZeroVector);
+
+		ParallelFor(NumParticles, [&](int32 i)
+		{
+			FVector3f Position, Velocity;
+			GetParticle(i, Position, Velocity);
+
+			if (!FMath::IsFinite(Position.X) || !FMath::IsFinite(Position.Y) || !FMath::IsFinite(Position.Z))
+			{
+				OutTransforms[i] = ParkedTransform;
+			}
+			else
+			{
+				// Velocity-based rotation (optional)
+				const FQuat Rotation = Settings.bRotateByVelocity && !Velocity.IsNearlyZero()
+					? FVector(Velocity).ToOrientationQuat()
+					: FQuat::Identity;
+				OutTransforms[i] = FTransform(Rotation, FVector(Position), Settings.Scale);
+			}
+
+			if (bWriteColors)
+			{
+				const float T = FMath::Clamp(Velocity.Size() / Settings.MaxSpeedForColor, 0.0f, 1.0f);
+				const FLinearColor Color = FMath::Lerp(Settings.MinColor, Settings.MaxColor, T);
+				float* CustomData = OutCustomData.GetData() + i * 4;
+				CustomData[0] = Color.R;
+				CustomData[1] = Color.G;
+				CustomData[2] = Color.B;
+				CustomData[3] = Color.A;
+			}
+		});
+	}
+}
 
 UKawaiiFluidProxyRenderer::UKawaiiFluidProxyRenderer()
 {
@@ -78,7 +149,9 @@ void UKawaiiFluidProxyRenderer::SetEnabled(bool bInEnabled)
 /**
  * @brief Synchronizes Proxy instance transforms with current particle data from the provider.
  * 
- * Handles both CPU and GPU simulation modes by reading back positions and velocities.
+ * GPU mode reads the pinned readback snapshot in place and registers only the fields the current
+ * settings need; CPU mode reads the particle array in place. Instance data is built in parallel
+ * into persistent buffers.
  * 
  * @param DataProvider Source of particle simulation data.
  * @param DeltaTime Current frame's time step.
@@ -90,6 +163,7 @@ void UKawaiiFluidProxyRenderer::UpdateRendering(const IKawaiiFluidDataProvider*
 
 	if (!bEnabled)
 	{
+		ReleaseReadback(DataProvider);
 		return;
 	}
 
@@ -105,49 +179,81 @@ void UKawaiiFluidProxyRenderer::UpdateRendering(const IKawaiiFluidDataProvider*
 		return;
 	}
 
-	// Get simulation data from DataProvider (GPU or CPU)
-	TArray<FVector3f> Positions;
-	TArray<FVector3f> Velocities;
+	// Get ParticleRadius from Preset (simulation radius for accurate debug visualization)
+	float ParticleRadius = 5.0f; // Default fallback
+	if (CachedPreset)
+	{
+		ParticleRadius = CachedPreset->ParticleRadius;
+	}
+
+	// Scale factor based on ParticleRadius (Default Sphere has 50cm radius)
+	const FProxyInstanceSettings Settings = {
+		FVector(ParticleRadius / 50.0f),
+		ISMComponent->GetComponentLocation(),
+		MinVelocityColor,
+		MaxVelocityColor,
+		MaxVelocityForColor,
+		bRotateByVelocity };
+
+	int32 NumParticles = 0;
+	bool bWriteColors = false;
 
 	if (DataProvider->IsGPUSimulationActive())
 	{
-		// GPU mode: Use lightweight readback API (Position + Velocity only)
 		FGPUFluidSimulator* Simulator = DataProvider->GetGPUSimulator();
-		if (Simulator)
+		if (!Simulator)
 		{
-			// Enable velocity readback for Proxy rendering
-			Simulator->SetFullReadbackEnabled(true);
+			return;
+		}
 
-			if (!Simulator->GetParticlePositionsAndVelocities(Positions, Velocities))
-			{
-				// Readback not available: clear instances when particle count is confirmed zero
-				if (Simulator->GetParticleCount() <= 0 && ISMComponent->GetInstanceCount() > 0)
-				{
-					ISMComponent->ClearInstances();
-				}
-				return;
-			}
+		// Request only what this renderer draws (velocity for color / rotation)
+		const uint32 ReadbackFields = GetReadbackFields();
+		if (ReadbackFields != RegisteredReadbackFields)
+		{
+			Simulator->SetReadbackConsumerFields(EGPUReadbackConsumer::Proxy, ReadbackFields);
+			RegisteredReadbackFields = ReadbackFields;
 		}
-		else
+
+		// Pinned for the rest of this function; instance data is built straight from it
+		const FGPUFluidReadbackSnapshotView Snapshot = Simulator->AcquireReadbackSnapshot();
+		if (Snapshot.Num() == 0)
 		{
+			// Readback not available: clear instances when particle count is confirmed zero
+			if (Simulator->GetParticleCount() <= 0 && ISMComponent->GetInstanceCount() > 0)
+			{
+				ISMComponent->ClearInstances();
+			}
 			return;
 		}
+
+		const TConstArrayView<FVector3f> Positions = Snapshot.GetPositions();
+		const TConstArrayView<FVector3f> Velocities = Snapshot.GetVelocities();
+		const bool bHasVelocities = Velocities.Num() == Positions.Num();
+		NumParticles = Positions.Num();
+		bWriteColors = bColorByVelocity && bHasVelocities;
+
+		BuildProxyInstances(NumParticles, Settings, bWriteColors, InstanceTransforms, InstanceCustomData,
+			[&](int32 i, FVector3f& OutPosition, FVector3f& OutVelocity)
+			{
+				OutPosition = Positions[i];
+				OutVelocity = bHasVelocities ? Velocities[i] : FVector3f::ZeroVector;
+			});
 	}
 	else
 	{
-		// CPU mode: Extract positions and velocities from particle array
 		const TArray<FKawaiiFluidParticle>& CPUParticles = DataProvider->GetParticles();
-		const int32 Count = CPUParticles.Num();
-		Positions.SetNumUninitialized(Count);
-		Velocities.SetNumUninitialized(Count);
-		for (int32 i = 0; i < Count; ++i)
-		{
-			Positions[i] = FVector3f(CPUParticles[i].Position);
-			Velocities[i] = FVector3f(CPUParticles[i].Velocity);
-		}
+		NumParticles = CPUParticles.Num();
+		bWriteColors = bColorByVelocity;
+
+		BuildProxyInstances(NumParticles, Settings, bWriteColors, InstanceTransforms, InstanceCustomData,
+			[&](int32 i, FVector3f& OutPosition, FVector3f& OutVelocity)
+			{
+				OutPosition = FVector3f(CPUParticles[i].Position);
+				OutVelocity = FVector3f(CPUParticles[i].Velocity);
+			});
 	}
 
-	if (Positions.Num() == 0)
+	if (NumParticles == 0)
 	{
 		ISMComponent->ClearInstances();
 		return;
@@ -156,7 +262,7 @@ void UKawaiiFluidProxyRenderer::UpdateRendering(const IKawaiiFluidDataProvider*
 	if (bShouldLog)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("=== Proxy Debug: Particles=%d, Registered=%d, Visible=%d, Mesh=%s, Material=%s, InstanceCount=%d ==="),
-			Positions.Num(),
+			NumParticles,
 			ISMComponent->IsRegistered() ? 1 : 0,
 			ISMComponent->IsVisible() ? 1 : 0,
 			ISMComponent->GetStaticMesh() ? TEXT("OK") : TEXT("NULL"),
@@ -164,71 +270,73 @@ void UKawaiiFluidProxyRenderer::UpdateRendering(const IKawaiiFluidDataProvider*
 			ISMComponent->GetInstanceCount());
 	}
 
-	// Use all particles without limit for the debug/proxy view
-	const int32 NumInstances = Positions.Num();
-
-	// Clear existing instances and preallocate memory
-	ISMComponent->ClearInstances();
-	ISMComponent->PreAllocateInstancesMemory(NumInstances);
+	ApplyInstances(bWriteColors);
+}
 
-	// Get ParticleRadius from Preset (simulation radius for accurate debug visualization)
-	float ParticleRadius = 5.0f; // Default fallback
-	if (CachedPreset)
+/**
+ * @brief Unregister this renderer's readback fields from the GPU simulator.
+ * @param DataProvider Source the fields were registered with.
+ */
+void UKawaiiFluidProxyRenderer::ReleaseReadback(const IKawaiiFluidDataProvider* DataProvider)
+{
+	if (RegisteredReadbackFields == EGPUReadbackField::None || !DataProvider)
 	{
-		ParticleRadius = CachedPreset->ParticleRadius;
+		return;
 	}
 
-	// Scale factor based on ParticleRadius (Default Sphere has 50cm radius)
-	float ScaleFactor = ParticleRadius / 50.0f;
-	FVector ScaleVec(ScaleFactor, ScaleFactor, ScaleFactor);
-
-	// Check if velocities available
-	const bool bHasVelocities = Velocities.Num() == Positions.Num();
-
-	// Add each particle as an instance
-	int32 InstanceIndex = 0;
-	for (int32 i = 0; i < NumInstances; ++i)
+	if (FGPUFluidSimulator* Simulator = DataProvider->GetGPUSimulator())
 	{
-		const FVector3f& Position = Positions[i];
-
-		// Skip NaN/Inf positions (can occur from stale readback after despawn compaction)
-		if (!FMath::IsFinite(Position.X) || !FMath::IsFinite(Position.Y) || !FMath::IsFinite(Position.Z))
-		{
-			continue;
-		}
+		Simulator->SetReadbackConsumerFields(EGPUReadbackConsumer::Proxy, EGPUReadbackField::None);
+	}
+	RegisteredReadbackFields = EGPUReadbackField::None;
+}
 
-		const FVector3f Velocity = bHasVelocities ? Velocities[i] : FVector3f::ZeroVector;
+/**
+ * @brief Readback fields for the current settings.
+ * @return Positions (quantized is enough for display), plus half velocities for color or rotation.
+ */
+uint32 UKawaiiFluidProxyRenderer::GetReadbackFields() const
+{
+	uint32 Fields = EGPUReadbackField::Position | EGPUReadbackField::AcceptQuantizedPosition;
+	if (bColorByVelocity || bRotateByVelocity)
+	{
+		Fields |= EGPUReadbackField::Velocity | EGPUReadbackField::AcceptHalfVelocity;
+	}
+	return Fields;
+}
 
-		// Create transform
-		FTransform InstanceTransform;
-		InstanceTransform.SetLocation(FVector(Position));
-		InstanceTransform.SetScale3D(ScaleVec);
+/**
+ * @brief Upload the built instance data.
+ * @param bWriteColors InstanceCustomData holds colors for every instance.
+ */
+void UKawaiiFluidProxyRenderer::ApplyInstances(bool bWriteColors)
+{
+	const int32 NumInstances = InstanceTransforms.Num();
 
-		// Velocity-based rotation (optional)
-		if (bRotateByVelocity && bHasVelocities && !Velocity.IsNearlyZero())
-		{
-			FRotator Rotation = FVector(Velocity).ToOrientationRotator();
-			InstanceTransform.SetRotation(Rotation.Quaternion());
-		}
+	if (bWriteColors && ISMComponent->NumCustomDataFloats != 4)
+	{
+		ISMComponent->SetNumCustomDataFloats(4); // RGBA
+	}
 
-		// Add instance to the ISM component
-		ISMComponent->AddInstance(InstanceTransform, false);
+	// Same count: rewrite in place instead of rebuilding the instance set
+	if (ISMComponent->GetInstanceCount() == NumInstances)
+	{
+		ISMComponent->BatchUpdateInstancesTransforms(0, InstanceTransforms, false, false, false);
+	}
+	else
+	{
+		ISMComponent->ClearInstances();
+		ISMComponent->PreAllocateInstancesMemory(NumInstances);
+		ISMComponent->AddInstances(InstanceTransforms, false, false, false);
+	}
 
-		// Velocity-based color (optional)
-		if (bColorByVelocity && bHasVelocities)
+	// Velocity-based color (optional), passed as custom data (available in material)
+	if (bWriteColors)
+	{
+		for (int32 i = 0; i < NumInstances; ++i)
 		{
-			float VelocityMagnitude = Velocity.Size();
-			float T = FMath::Clamp(VelocityMagnitude / MaxVelocityForColor, 0.0f, 1.0f);
-			FLinearColor Color = FMath::Lerp(MinVelocityColor, MaxVelocityColor, T);
-
-			// Pass color as custom data (available in material)
-			ISMComponent->SetCustomDataValue(InstanceIndex, 0, Color.R, false);
-			ISMComponent->SetCustomDataValue(InstanceIndex, 1, Color.G, false);
-			ISMComponent->SetCustomDataValue(InstanceIndex, 2, Color.B, false);
-			ISMComponent->SetCustomDataValue(InstanceIndex, 3, Color.A, false);
+			ISMComponent->SetCustomData(i, TArrayView<const float>(InstanceCustomData.GetData() + i * 4, 4), false);
 		}
-
-		++InstanceIndex;
 	}
 
 	// Update bounds and render state - essential for Virtual Shadow Maps (VSM) and Cascaded Shadows
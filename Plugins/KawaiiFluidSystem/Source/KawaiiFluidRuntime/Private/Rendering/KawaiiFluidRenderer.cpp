@@ -166,13 +166,15 @@ void UKawaiiFluidRenderer::UpdateRendering(const IKawaiiFluidDataProvider* DataP
 	// Update anisotropy parameters to GPU simulator
 	Simulator->SetAnisotropyParams(GetLocalParameters().AnisotropyParams);
 
-	// Use MaxParticleCount for buffer sizing (immune to CPU/GPU count desync)
-	const int32 MaxParticleCount = Simulator->GetMaxParticleCount();
+	// Use the simulator's allocated capacity for buffer sizing (immune to CPU/GPU count desync,
+	// grows with the simulator instead of reserving MaxParticleCount up front)
+	const int32 AllocatedCapacity = Simulator->GetAllocatedCapacity();
+	const int32 BufferParticleCount = AllocatedCapacity > 0 ? AllocatedCapacity : Simulator->GetMaxParticleCount();
 
 	// Access GPU buffers through RenderResource on render thread
 	if (FKawaiiFluidRenderResource* RR = GetFluidRenderResource())
 	{
-		RR->SetGPUSimulatorReference(Simulator, MaxParticleCount, RenderRadius);
+		RR->SetGPUSimulatorReference(Simulator, BufferParticleCount, RenderRadius);
 	}
 
 	// Update stats (stale CPU count is fine for UI display)
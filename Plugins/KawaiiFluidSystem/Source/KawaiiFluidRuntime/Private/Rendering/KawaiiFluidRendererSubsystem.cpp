@@ -12,6 +12,7 @@
 #include "Async/ParallelFor.h"
 #include "MeshDescription.h"
 #include "StaticMeshAttributes.h"
+#include "Core/KawaiiFluidSimulationStats.h"
 
 /**
  * @brief Determine if the subsystem should be created for the given world context.
@@ -514,8 +515,12 @@ UInstancedStaticMeshComponent* UKawaiiFluidRendererSubsystem::GetOrCreateShadowI
  * @param NumParticles Number of particles.
  * @param ParticleRadius Radius of each particle.
  * @param Quality Shadow mesh quality level.
+ * @param ParticleIDs Persistent particle IDs aligned with positions, or nullptr to key by index.
+ * @param OwnerKey Identifies the registering volume.
+ * @param bSettled Positions unchanged since the previous registration.
  */
-void UKawaiiFluidRendererSubsystem::RegisterShadowParticles(const FVector* ParticlePositions, int32 NumParticles, float ParticleRadius, EFluidShadowMeshQuality Quality)
+void UKawaiiFluidRendererSubsystem::RegisterShadowParticles(const FVector* ParticlePositions, int32 NumParticles, float ParticleRadius, EFluidShadowMeshQuality Quality,
+	const int32* ParticleIDs, uint32 OwnerKey, bool bSettled)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FluidShadow_RegisterParticles);
 
@@ -536,17 +541,26 @@ void UKawaiiFluidRendererSubsystem::RegisterShadowParticles(const FVector* Parti
 
 	// Reserve space to avoid frequent reallocations
 	TArray<FVector>& Buffer = AggregatedPositions[QualityIndex];
+	TArray<uint64>& KeyBuffer = AggregatedKeys[QualityIndex];
 	Buffer.Reserve(Buffer.Num() + NumToAdd);
+	KeyBuffer.Reserve(KeyBuffer.Num() + NumToAdd);
+
+	// Key = owner (31 bits, top bit is reserved for cluster keys) | particle ID or index
+	const uint64 OwnerBits = static_cast<uint64>(OwnerKey & 0x7FFFFFFFu) << 32;
 
 	// Add positions with skip factor (no validation - simulation guarantees valid data)
 	for (int32 i = 0; i < NumParticles; i += SkipFactor)
 	{
 		Buffer.Add(ParticlePositions[i]);
+		KeyBuffer.Add(OwnerBits | static_cast<uint32>(ParticleIDs ? ParticleIDs[i] : i));
 	}
 
 	// Track max radius for this quality level
 	AggregatedRadius[QualityIndex] = FMath::Max(AggregatedRadius[QualityIndex], ParticleRadius);
 	bHasParticlesThisFrame[QualityIndex] = true;
+	bAllSettledThisFrame[QualityIndex] &= bSettled;
+	FrameSignature[QualityIndex] = HashCombineFast(FrameSignature[QualityIndex],
+		HashCombineFast(GetTypeHash(OwnerKey), HashCombineFast(GetTypeHash(NumParticles), GetTypeHash(ParticleRadius))));
 }
 
 /**
@@ -558,12 +572,16 @@ void UKawaiiFluidRendererSubsystem::FlushShadowInstances()
 
 	check(IsInGameThread());
 
+	int32 TotalShadowParticles = 0;
+	int32 TotalShadowInstances = 0;
+
 	for (int32 QualityIndex = 0; QualityIndex < NUM_SHADOW_QUALITY_LEVELS; ++QualityIndex)
 	{
 		const EFluidShadowMeshQuality Quality = static_cast<EFluidShadowMeshQuality>(QualityIndex);
 		TArray<FVector>& Positions = AggregatedPositions[QualityIndex];
 		const float Radius = AggregatedRadius[QualityIndex];
 		const bool bHasParticles = bHasParticlesThisFrame[QualityIndex];
+		FKawaiiFluidShadowInstanceTracker& Tracker = ShadowTrackers[QualityIndex];
 
 		// Get or create ISM component for this quality
 		UInstancedStaticMeshComponent* ISM = ShadowInstanceComponents[QualityIndex];
@@ -571,11 +589,13 @@ void UKawaiiFluidRendererSubsystem::FlushShadowInstances()
 		// If no particles registered this frame
 		if (!bHasParticles || Positions.Num() == 0)
 		{
-			// Clear existing instances if any
-			if (IsValid(ISM) && ISM->GetInstanceCount() > 0)
+			// Park existing instances (released once the pool stays far below capacity)
+			SettledSignature[QualityIndex] = 0;
+			if (IsValid(ISM) && Tracker.GetNumSlots() > 0)
 			{
-				ISM->ClearInstances();
-				ISM->MarkRenderStateDirty();
+				SCOPE_CYCLE_COUNTER(STAT_FluidShadowInstanceUpdate);
+				Tracker.Update({}, {}, ShadowUpdateTolerance, 50.0f);
+				ApplyShadowInstanceUpdates(ISM, QualityIndex);
 			}
 			continue;
 		}
@@ -583,6 +603,8 @@ void UKawaiiFluidRendererSubsystem::FlushShadowInstances()
 		// Create ISM if needed
 		if (!IsValid(ISM))
 		{
+			Tracker.Reset();
+			SettledSignature[QualityIndex] = 0;
 			ISM = GetOrCreateShadowISM(Quality);
 			if (!ISM)
 			{
@@ -590,48 +612,155 @@ void UKawaiiFluidRendererSubsystem::FlushShadowInstances()
 			}
 		}
 
-		const int32 NumInstances = Positions.Num();
+		TotalShadowParticles += Positions.Num();
+
+		// Same settled registrations as the last flush: nothing can have moved, skip clustering and uploads
+		const uint64 Signature = bAllSettledThisFrame[QualityIndex] ? FrameSignature[QualityIndex] : 0;
+		if (Signature != 0 && Signature == SettledSignature[QualityIndex])
+		{
+			TotalShadowInstances += Tracker.GetNumSlots();
+			continue;
+		}
+		SettledSignature[QualityIndex] = Signature;
+
+		// Merge particles into blobs, or one sphere per particle when clustering is off
+		{
+			SCOPE_CYCLE_COUNTER(STAT_FluidShadowClustering);
+			if (bEnableShadowClustering)
+			{
+				FKawaiiFluidShadowClusterParams ClusterParams;
+				ClusterParams.ParticleRadius = Radius;
+				ClusterParams.CellSizeScale = ShadowClusterCellScale;
+				ClusterParams.MinClusterParticles = ShadowClusterMinParticles;
+				ShadowClusterer.Cluster(Positions, AggregatedKeys[QualityIndex], ClusterParams, CachedShadowBlobs);
+			}
+			else
+			{
+				CachedShadowBlobs.SetNumUninitialized(Positions.Num());
+				for (int32 i = 0; i < Positions.Num(); ++i)
+				{
+					CachedShadowBlobs[i] = { Positions[i], FVector(Radius), AggregatedKeys[QualityIndex][i] };
+				}
+			}
+		}
+
+		const int32 NumInstances = CachedShadowBlobs.Num();
+		TotalShadowInstances += NumInstances;
 
-		// Prepare transforms
-		CachedInstanceTransforms.SetNumUninitialized(NumInstances);
-		const FVector SphereScale = FVector(Radius / 50.0f);
+		// Prepare transforms (shadow sphere mesh has radius 50)
+		CachedInstanceTransforms.SetNumUninitialized(NumInstances, EAllowShrinking::No);
+		CachedInstanceKeys.SetNumUninitialized(NumInstances, EAllowShrinking::No);
 
 		// Generate transforms (parallelize only when count is large enough to offset overhead)
 		constexpr int32 ParallelThreshold = 1024;
-		if (NumInstances >= ParallelThreshold)
+		ParallelFor(NumInstances, [&](int32 i)
 		{
-			ParallelFor(NumInstances, [&](int32 i)
-			{
-				FTransform& T = CachedInstanceTransforms[i];
-				T.SetTranslation(Positions[i]);
-				T.SetRotation(FQuat::Identity);
-				T.SetScale3D(SphereScale);
-			});
+			FTransform& T = CachedInstanceTransforms[i];
+			T.SetTranslation(CachedShadowBlobs[i].Center);
+			T.SetRotation(FQuat::Identity);
+			T.SetScale3D(CachedShadowBlobs[i].HalfExtent / 50.0);
+			CachedInstanceKeys[i] = CachedShadowBlobs[i].Key;
+		}, NumInstances < ParallelThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		// Update ISM: only instances that appeared, vanished or moved beyond the tolerance
+		SCOPE_CYCLE_COUNTER(STAT_FluidShadowInstanceUpdate);
+		Tracker.Update(CachedInstanceKeys, CachedInstanceTransforms, ShadowUpdateTolerance, 50.0f);
+		ApplyShadowInstanceUpdates(ISM, QualityIndex);
+	}
+
+	SET_DWORD_STAT(STAT_FluidShadowParticles, TotalShadowParticles);
+	SET_DWORD_STAT(STAT_FluidShadowInstances, TotalShadowInstances);
+}
+
+/**
+ * @brief Upload the tracker's changed slots to the ISM without clearing it.
+ *
+ * The ISM keeps a high-water capacity: slots past the tracker's count are parked at zero scale instead of
+ * removed, growth appends only the missing slots (with slack), and the pool is rebuilt only when it is mostly
+ * unused. Only dirty slots and slots freed this frame are rewritten.
+ *
+ * @param ISM Target component.
+ * @param QualityIndex Quality level the component belongs to.
+ */
+void UKawaiiFluidRendererSubsystem::ApplyShadowInstanceUpdates(UInstancedStaticMeshComponent* ISM, int32 QualityIndex)
+{
+	constexpr int32 MinParkedCapacity = 1024;
+
+	const FKawaiiFluidShadowInstanceTracker& Tracker = ShadowTrackers[QualityIndex];
+	const TArray<FTransform>& SlotTransforms = Tracker.GetSlotTransforms();
+	const TConstArrayView<int32> DirtySlots = Tracker.GetDirtySlots();
+	const int32 NumSlots = Tracker.GetNumSlots();
+
+	int32 Capacity = ISM->GetInstanceCount();
+	int32 PrevActive = FMath::Min(Tracker.GetPrevNumSlots(), Capacity);
+
+	// Mostly unused pool: release it in one rebuild
+	if (Capacity > MinParkedCapacity && NumSlots < Capacity / 4)
+	{
+		ISM->ClearInstances();
+		Capacity = 0;
+		PrevActive = 0;
+	}
+
+	// Parked slots sit on the first active instance so they do not inflate component bounds
+	const FVector ParkLocation = NumSlots > 0 ? SlotTransforms[0].GetTranslation() : ISM->GetComponentLocation();
+	const FTransform ParkedTransform(FQuat::Identity, ParkLocation, FVector::ZeroVector);
+
+	bool bChanged = false;
+
+	// Grow: append only the missing slots, plus slack
+	if (NumSlots > Capacity)
+	{
+		const int32 NewCapacity = NumSlots + NumSlots / 4;
+		CachedInstanceTransforms.Reset();
+		for (int32 Slot = Capacity; Slot < NewCapacity; ++Slot)
+		{
+			CachedInstanceTransforms.Add(Slot < NumSlots ? SlotTransforms[Slot] : ParkedTransform);
 		}
-		else
+		ISM->AddInstances(CachedInstanceTransforms, false, true, false);
+		bChanged = true;
+	}
+
+	// Most of the pool changed: one batch write beats per-instance updates
+	const int32 NumExisting = FMath::Min(NumSlots, Capacity);
+	const int32 NumToPark = FMath::Max(0, PrevActive - NumSlots);
+	if (DirtySlots.Num() + NumToPark > NumExisting / 2 && NumExisting + NumToPark > 0)
+	{
+		CachedInstanceTransforms.Reset();
+		CachedInstanceTransforms.Append(SlotTransforms.GetData(), NumExisting);
+		for (int32 Slot = NumExisting; Slot < NumExisting + NumToPark; ++Slot)
 		{
-			for (int32 i = 0; i < NumInstances; ++i)
+			CachedInstanceTransforms.Add(ParkedTransform);
+		}
+		ISM->BatchUpdateInstancesTransforms(0, CachedInstanceTransforms, true, false, false);
+		bChanged = true;
+	}
+	else
+	{
+		for (const int32 Slot : DirtySlots)
+		{
+			if (Slot >= Capacity)
 			{
-				FTransform& T = CachedInstanceTransforms[i];
-				T.SetTranslation(Positions[i]);
-				T.SetRotation(FQuat::Identity);
-				T.SetScale3D(SphereScale);
+				break;
 			}
+			ISM->UpdateInstanceTransform(Slot, SlotTransforms[Slot], true, false, false);
+			bChanged = true;
 		}
 
-		// Update ISM
-		const int32 CurrentCount = ISM->GetInstanceCount();
-				if (CurrentCount == NumInstances)
-				{
-					// Fast path: Update existing instances (Always update bounds to ensure correct shadow frustum/VSM pages)
-					ISM->BatchUpdateInstancesTransforms(0, CachedInstanceTransforms, true, true, false);
-				}
-				else
-				{
-					// Rebuild: Clear and add new instances with bounds update
-					ISM->ClearInstances();
-					ISM->AddInstances(CachedInstanceTransforms, true, true);
-				}	}
+		// Slots freed by swap-remove since last frame
+		for (int32 Slot = NumSlots; Slot < PrevActive; ++Slot)
+		{
+			ISM->UpdateInstanceTransform(Slot, ParkedTransform, true, false, false);
+			bChanged = true;
+		}
+	}
+
+	// Always update bounds to ensure correct shadow frustum/VSM pages
+	if (bChanged)
+	{
+		ISM->UpdateBounds();
+		ISM->MarkRenderStateDirty();
+	}
 }
 
 /**
@@ -642,8 +771,11 @@ void UKawaiiFluidRendererSubsystem::ClearAggregationBuffers()
 	for (int32 i = 0; i < NUM_SHADOW_QUALITY_LEVELS; ++i)
 	{
 		AggregatedPositions[i].Reset();
+		AggregatedKeys[i].Reset();
 		AggregatedRadius[i] = 0.0f;
 		bHasParticlesThisFrame[i] = false;
+		bAllSettledThisFrame[i] = true;
+		FrameSignature[i] = 0;
 	}
 }
 
@@ -655,6 +787,8 @@ void UKawaiiFluidRendererSubsystem::CleanupShadowResources()
 	// Destroy ISM components
 	for (int32 i = 0; i < NUM_SHADOW_QUALITY_LEVELS; ++i)
 	{
+		ShadowTrackers[i].Reset();
+		SettledSignature[i] = 0;
 		if (IsValid(ShadowInstanceComponents[i]))
 		{
 			ShadowInstanceComponents[i]->ClearInstances();
@@ -674,4 +808,6 @@ void UKawaiiFluidRendererSubsystem::CleanupShadowResources()
 	// Clear buffers
 	ClearAggregationBuffers();
 	CachedInstanceTransforms.Empty();
+	CachedInstanceKeys.Empty();
+	CachedShadowBlobs.Empty();
 }
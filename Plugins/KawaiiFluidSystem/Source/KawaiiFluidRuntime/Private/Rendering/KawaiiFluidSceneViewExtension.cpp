@@ -206,7 +206,20 @@ void FKawaiiFluidSceneViewExtension::PreRenderViewFamily_RenderThread(
 		);
 		FRDGBufferSRVRef CountBufferSRV = GraphBuilder.CreateSRV(CountBuffer);
 
-		const int32 MaxParticleCount = GPUSimulator->GetMaxParticleCount();
+		// Dispatch bound: simulator's allocated capacity, never past the render buffers (GPU count bounds-checks the rest)
+		const int32 MaxParticleCount = FMath::Min(
+			FMath::Max(GPUSimulator->GetAllocatedCapacity(), 1), RenderResource->GetBufferCapacity());
+
+		// Fixed-timestep render interpolation: blend tick-start positions toward the latest tick
+		FRDGBufferSRVRef PreviousPositionsSRV = nullptr;
+		int32 PreviousPositionCount = 0;
+		const float InterpolationAlpha = GPUSimulator->GetRenderInterpolationAlpha();
+		if (GPUSimulator->HasRenderInterpolationSource())
+		{
+			PreviousPositionsSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(
+				GPUSimulator->AccessPreviousPositionsBuffer(), TEXT("PreviousPositions_Extract")));
+			PreviousPositionCount = GPUSimulator->GetPreviousPositionsCount();
+		}
 
 		// Get Pooled buffers
 		TRefCountPtr<FRDGPooledBuffer> PositionPooledBuffer = RenderResource->GetPooledPositionBuffer();
@@ -217,13 +230,14 @@ void FKawaiiFluidSceneViewExtension::PreRenderViewFamily_RenderThread(
 		// Extract RenderParticle + Bounds buffers
 		float BoundsMargin = ParticleRadius * 2.0f + 5.0f;
 
+		FRDGBufferRef BoundsBuffer = nullptr;
 		if (RenderParticlePooled.IsValid() && BoundsPooled.IsValid())
 		{
 			FRDGBufferRef RenderParticleBuffer = GraphBuilder.RegisterExternalBuffer(
 				RenderParticlePooled, TEXT("RenderParticles_Extract"));
 			FRDGBufferUAVRef RenderParticleUAV = GraphBuilder.CreateUAV(RenderParticleBuffer);
 
-			FRDGBufferRef BoundsBuffer = GraphBuilder.RegisterExternalBuffer(
+			BoundsBuffer = GraphBuilder.RegisterExternalBuffer(
 				BoundsPooled, TEXT("ParticleBounds_Extract"));
 			FRDGBufferUAVRef BoundsBufferUAV = GraphBuilder.CreateUAV(BoundsBuffer);
 
@@ -234,7 +248,10 @@ void FKawaiiFluidSceneViewExtension::PreRenderViewFamily_RenderThread(
 				BoundsBufferUAV,
 				CountBufferSRV,
 				ParticleRadius,
-				BoundsMargin
+				BoundsMargin,
+				PreviousPositionsSRV,
+				PreviousPositionCount,
+				InterpolationAlpha
 			);
 
 			// Enqueue particle bounds readback for Unlimited Simulation Range world collision
@@ -251,9 +268,57 @@ void FKawaiiFluidSceneViewExtension::PreRenderViewFamily_RenderThread(
 			}
 		}
 
+		// Extract packed buffers (quantized against the bounds just computed); replaces the SoA extract
+		TRefCountPtr<FRDGPooledBuffer> PackedParticlePooled = RenderResource->GetPooledPackedParticleBuffer();
+		TRefCountPtr<FRDGPooledBuffer> PackedAnisotropyPooled = RenderResource->GetPooledPackedAnisotropyBuffer();
+		const bool bExtractPacked = FKawaiiFluidRenderResource::IsPackedFormatRequested()
+			&& BoundsBuffer && PackedParticlePooled.IsValid() && PackedAnisotropyPooled.IsValid();
+
+		if (bExtractPacked)
+		{
+			FRDGBufferUAVRef PackedParticleUAV = GraphBuilder.CreateUAV(GraphBuilder.RegisterExternalBuffer(
+				PackedParticlePooled, TEXT("RenderParticlesPacked_Extract")));
+
+			FRDGBufferSRVRef AnisotropyAxis1SRV = nullptr;
+			FRDGBufferSRVRef AnisotropyAxis2SRV = nullptr;
+			FRDGBufferSRVRef AnisotropyAxis3SRV = nullptr;
+			FRDGBufferSRVRef RenderOffsetSRV = nullptr;
+			FRDGBufferUAVRef PackedAnisotropyUAV = nullptr;
+			const bool bPackAnisotropy = RenderResource->GetAnisotropyBufferSRVs(
+				GraphBuilder, AnisotropyAxis1SRV, AnisotropyAxis2SRV, AnisotropyAxis3SRV);
+			if (bPackAnisotropy)
+			{
+				RenderOffsetSRV = RenderResource->GetRenderOffsetBufferSRV(GraphBuilder);
+				PackedAnisotropyUAV = GraphBuilder.CreateUAV(GraphBuilder.RegisterExternalBuffer(
+					PackedAnisotropyPooled, TEXT("RenderAnisotropyPacked_Extract")));
+			}
+
+			FGPUFluidSimulatorPassBuilder::AddExtractRenderDataPackedPass(
+				GraphBuilder,
+				PhysicsBufferSRV,
+				PackedParticleUAV,
+				PackedAnisotropyUAV,
+				GraphBuilder.CreateSRV(BoundsBuffer),
+				RenderOffsetSRV,
+				AnisotropyAxis1SRV,
+				AnisotropyAxis2SRV,
+				AnisotropyAxis3SRV,
+				CountBufferSRV,
+				MaxParticleCount,
+				PreviousPositionsSRV,
+				PreviousPositionCount,
+				InterpolationAlpha
+			);
+			RenderResource->SetPackedBuffersWritten(true, bPackAnisotropy);
+		}
+		else
+		{
+			RenderResource->SetPackedBuffersWritten(false, false);
+		}
+
 		// Extract SoA buffers (Position/Velocity)
 
-		if (PositionPooledBuffer.IsValid() && VelocityPooledBuffer.IsValid())
+		if (!bExtractPacked && PositionPooledBuffer.IsValid() && VelocityPooledBuffer.IsValid())
 		{
 			FRDGBufferRef PositionBuffer = GraphBuilder.RegisterExternalBuffer(
 				PositionPooledBuffer, TEXT("RenderPositions_Extract"));
@@ -270,7 +335,10 @@ void FKawaiiFluidSceneViewExtension::PreRenderViewFamily_RenderThread(
 				VelocityUAV,
 				CountBufferSRV,
 				MaxParticleCount,
-				ParticleRadius
+				ParticleRadius,
+				PreviousPositionsSRV,
+				PreviousPositionCount,
+				InterpolationAlpha
 			);
 		}
 
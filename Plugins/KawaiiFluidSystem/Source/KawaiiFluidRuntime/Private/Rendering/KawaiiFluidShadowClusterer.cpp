@@ -0,0 +1,137 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Rendering/KawaiiFluidShadowClusterer.h"
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+	constexpr int32 ParallelThreshold = 4096;
+	constexpr int64 CellCoordBias = 1 << 20;
+	constexpr int64 CellCoordMask = (1 << 21) - 1;
+
+	/** @brief Pack a grid cell coordinate (21 bits per axis, biased) into a map key. */
+	uint64 PackCellKey(const FVector& Position, double InvCellSize)
+	{
+		const int64 X = FMath::Clamp<int64>(FMath::FloorToInt64(Position.X * InvCellSize) + CellCoordBias, 0, CellCoordMask);
+		const int64 Y = FMath::Clamp<int64>(FMath::FloorToInt64(Position.Y * InvCellSize) + CellCoordBias, 0, CellCoordMask);
+		const int64 Z = FMath::Clamp<int64>(FMath::FloorToInt64(Position.Z * InvCellSize) + CellCoordBias, 0, CellCoordMask);
+		return static_cast<uint64>(X) | (static_cast<uint64>(Y) << 21) | (static_cast<uint64>(Z) << 42);
+	}
+
+	/** @brief World-space center of a packed cell. */
+	FVector GetCellCenter(uint64 Key, double CellSize)
+	{
+		const int64 X = static_cast<int64>(Key & CellCoordMask) - CellCoordBias;
+		const int64 Y = static_cast<int64>((Key >> 21) & CellCoordMask) - CellCoordBias;
+		const int64 Z = static_cast<int64>((Key >> 42) & CellCoordMask) - CellCoordBias;
+		return (FVector(X, Y, Z) + FVector(0.5)) * CellSize;
+	}
+}
+
+/**
+ * @brief Bin particles into grid cells and emit one density-scaled blob per populated cell.
+ * @param Positions Particle world positions.
+ * @param ParticleKeys Stable key per particle, or empty to use the index.
+ * @param Params Clustering settings.
+ * @param OutBlobs Receives the blobs.
+ */
+void FKawaiiFluidShadowClusterer::Cluster(TConstArrayView<FVector> Positions, TConstArrayView<uint64> ParticleKeys, const FKawaiiFluidShadowClusterParams& Params, TArray<FKawaiiFluidShadowBlob>& OutBlobs)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FluidShadow_Cluster);
+
+	OutBlobs.Reset();
+	const int32 NumParticles = Positions.Num();
+	if (NumParticles == 0)
+	{
+		return;
+	}
+
+	const double Radius = FMath::Max(Params.ParticleRadius, UE_KINDA_SMALL_NUMBER);
+	const double CellSize = Params.GetCellSize();
+	const double InvCellSize = 1.0 / CellSize;
+
+	// 1. Cell keys (parallel, the only per-particle floating point work besides accumulation)
+	CellKeys.SetNumUninitialized(NumParticles);
+	ParallelFor(NumParticles, [&](int32 i)
+	{
+		CellKeys[i] = PackCellKey(Positions[i], InvCellSize);
+	}, NumParticles < ParallelThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// 2. Accumulate per cell. Z-ordered input puts neighbors next to each other,
+	//    so the last-key shortcut skips most map lookups.
+	ParticleClusters.SetNumUninitialized(NumParticles);
+	Clusters.Reset();
+	CellToCluster.Reset();
+
+	uint64 LastKey = ~0ull;
+	int32 LastCluster = INDEX_NONE;
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const uint64 Key = CellKeys[i];
+		if (Key != LastKey)
+		{
+			int32& ClusterIndex = CellToCluster.FindOrAdd(Key, INDEX_NONE);
+			if (ClusterIndex == INDEX_NONE)
+			{
+				ClusterIndex = Clusters.AddDefaulted();
+				Clusters[ClusterIndex].CellKey = Key;
+				Clusters[ClusterIndex].Origin = GetCellCenter(Key, CellSize);
+			}
+			LastKey = Key;
+			LastCluster = ClusterIndex;
+		}
+
+		// Accumulate relative to the cell center to keep the variance well conditioned
+		FClusterAccum& Accum = Clusters[LastCluster];
+		const FVector Offset = Positions[i] - Accum.Origin;
+		Accum.Sum += Offset;
+		Accum.SumSq += Offset * Offset;
+		++Accum.Count;
+		ParticleClusters[i] = LastCluster;
+	}
+
+	// 3. Emit in first-occurrence order; sparse cells fall back to per-particle spheres
+	const bool bHasParticleKeys = ParticleKeys.Num() == NumParticles;
+	const int32 MinClusterParticles = FMath::Max(1, Params.MinClusterParticles);
+	const double MaxHalfExtent = CellSize * 0.5 + Radius;
+	const double ParticleCubeVolume = FMath::Cube(2.0 * Radius);
+	OutBlobs.Reserve(Clusters.Num());
+
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		FClusterAccum& Accum = Clusters[ParticleClusters[i]];
+		if (Accum.Count < MinClusterParticles)
+		{
+			if (Accum.Count > 0)
+			{
+				const uint64 ParticleKey = bHasParticleKeys ? ParticleKeys[i] : static_cast<uint64>(i);
+				OutBlobs.Add({ Positions[i], FVector(Radius), ParticleKey & ~FKawaiiFluidShadowBlob::ClusterKeyBit });
+			}
+			continue;
+		}
+
+		const double InvCount = 1.0 / Accum.Count;
+		const FVector Mean = Accum.Sum * InvCount;
+		const FVector Variance = (Accum.SumSq * InvCount - Mean * Mean).ComponentMax(FVector::ZeroVector);
+
+		// Uniform spread of half-width a has variance a^2/3; pad by the particle radius
+		FVector HalfExtent(
+			FMath::Min(FMath::Sqrt(3.0 * Variance.X) + Radius, MaxHalfExtent),
+			FMath::Min(FMath::Sqrt(3.0 * Variance.Y) + Radius, MaxHalfExtent),
+			FMath::Min(FMath::Sqrt(3.0 * Variance.Z) + Radius, MaxHalfExtent));
+
+		// Density: shrink the blob so its box holds no more volume than the particles occupy at rest spacing
+		const double BoxVolume = 8.0 * HalfExtent.X * HalfExtent.Y * HalfExtent.Z;
+		const double FluidVolume = Accum.Count * ParticleCubeVolume;
+		if (FluidVolume < BoxVolume)
+		{
+			HalfExtent = (HalfExtent * FMath::Pow(FluidVolume / BoxVolume, 1.0 / 3.0)).ComponentMax(FVector(Radius));
+		}
+
+		OutBlobs.Add({ Accum.Origin + Mean, HalfExtent, Accum.CellKey | FKawaiiFluidShadowBlob::ClusterKeyBit });
+
+		// Emitted; later particles of this cell are skipped
+		Accum.Count = 0;
+	}
+}
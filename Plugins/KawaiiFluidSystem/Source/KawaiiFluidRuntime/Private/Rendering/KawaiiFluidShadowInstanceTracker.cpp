@@ -0,0 +1,149 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Rendering/KawaiiFluidShadowInstanceTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+	/** @brief True when an instance moved or resized by more than Tolerance (cm). */
+	bool HasChanged(const FTransform& Uploaded, const FTransform& Desired, float Tolerance, float MeshRadius)
+	{
+		const double ToleranceSq = FMath::Square(static_cast<double>(Tolerance));
+		if (FVector::DistSquared(Uploaded.GetTranslation(), Desired.GetTranslation()) > ToleranceSq)
+		{
+			return true;
+		}
+		const FVector ExtentDelta = (Uploaded.GetScale3D() - Desired.GetScale3D()) * MeshRadius;
+		return ExtentDelta.GetAbsMax() > Tolerance || !Uploaded.GetRotation().Equals(Desired.GetRotation(), UE_KINDA_SMALL_NUMBER);
+	}
+}
+
+/**
+ * @brief Reconcile the frame's instances with the tracked slots.
+ * @param Keys Stable identity per instance.
+ * @param Transforms Desired transform per instance.
+ * @param Tolerance Minimum change (cm) that triggers a rewrite.
+ * @param MeshRadius Radius of the instanced mesh.
+ */
+void FKawaiiFluidShadowInstanceTracker::Update(TConstArrayView<uint64> Keys, TConstArrayView<FTransform> Transforms, float Tolerance, float MeshRadius)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FluidShadow_TrackInstances);
+	check(Keys.Num() == Transforms.Num());
+
+	PrevNumSlots = SlotKeys.Num();
+	DirtySlots.Reset();
+	NewInputs.Reset();
+	StaleSlots.Reset();
+
+	// Epoch 0 marks never-seen slots, skip it on wrap
+	if (++Epoch == 0)
+	{
+		Epoch = 1;
+		FMemory::Memzero(SlotSeenEpoch.GetData(), SlotSeenEpoch.Num() * sizeof(uint32));
+	}
+
+	// 1. Match known keys; rewrite only the ones that moved
+	for (int32 i = 0; i < Keys.Num(); ++i)
+	{
+		if (const int32* Slot = KeyToSlot.Find(Keys[i]))
+		{
+			// Negative: key first seen earlier this frame; already matched: duplicate
+			if (*Slot < 0 || SlotSeenEpoch[*Slot] == Epoch)
+			{
+				continue;
+			}
+			SlotSeenEpoch[*Slot] = Epoch;
+			if (HasChanged(SlotTransforms[*Slot], Transforms[i], Tolerance, MeshRadius))
+			{
+				SlotTransforms[*Slot] = Transforms[i];
+				DirtySlots.Add(*Slot);
+			}
+		}
+		else
+		{
+			KeyToSlot.Add(Keys[i], INDEX_NONE);
+			NewInputs.Add(i);
+		}
+	}
+
+	for (int32 Slot = 0; Slot < SlotKeys.Num(); ++Slot)
+	{
+		if (SlotSeenEpoch[Slot] != Epoch)
+		{
+			StaleSlots.Add(Slot);
+		}
+	}
+
+	// 2. Refill stale slots with new keys in place
+	int32 NextNew = 0;
+	int32 NumStaleReused = 0;
+	for (; NumStaleReused < StaleSlots.Num() && NextNew < NewInputs.Num(); ++NumStaleReused)
+	{
+		const int32 Slot = StaleSlots[NumStaleReused];
+		const uint64 Key = Keys[NewInputs[NextNew]];
+		KeyToSlot.Remove(SlotKeys[Slot]);
+		KeyToSlot[Key] = Slot;
+		SlotKeys[Slot] = Key;
+		SlotTransforms[Slot] = Transforms[NewInputs[NextNew++]];
+		SlotSeenEpoch[Slot] = Epoch;
+		DirtySlots.Add(Slot);
+	}
+
+	// 3. Swap-remove the rest, highest first so the moved tail slot is always live
+	for (int32 s = StaleSlots.Num() - 1; s >= NumStaleReused; --s)
+	{
+		const int32 Slot = StaleSlots[s];
+		const int32 Last = SlotKeys.Num() - 1;
+		KeyToSlot.Remove(SlotKeys[Slot]);
+		if (Slot != Last)
+		{
+			SlotKeys[Slot] = SlotKeys[Last];
+			SlotTransforms[Slot] = SlotTransforms[Last];
+			SlotSeenEpoch[Slot] = SlotSeenEpoch[Last];
+			KeyToSlot.Add(SlotKeys[Slot], Slot);
+			DirtySlots.Add(Slot);
+		}
+		SlotKeys.Pop(EAllowShrinking::No);
+		SlotTransforms.Pop(EAllowShrinking::No);
+		SlotSeenEpoch.Pop(EAllowShrinking::No);
+	}
+
+	// 4. Append the remaining new keys
+	for (; NextNew < NewInputs.Num(); ++NextNew)
+	{
+		const int32 Input = NewInputs[NextNew];
+		const int32 Slot = SlotKeys.Num();
+		KeyToSlot[Keys[Input]] = Slot;
+		SlotKeys.Add(Keys[Input]);
+		SlotTransforms.Add(Transforms[Input]);
+		SlotSeenEpoch.Add(Epoch);
+		DirtySlots.Add(Slot);
+	}
+
+	// Moved-then-swapped slots may be listed twice or point past the new end
+	const int32 NumSlots = SlotKeys.Num();
+	DirtySlots.Sort();
+	int32 NumDirty = 0;
+	for (int32 i = 0; i < DirtySlots.Num(); ++i)
+	{
+		const int32 Slot = DirtySlots[i];
+		if (Slot < NumSlots && (NumDirty == 0 || DirtySlots[NumDirty - 1] != Slot))
+		{
+			DirtySlots[NumDirty++] = Slot;
+		}
+	}
+	DirtySlots.SetNum(NumDirty, EAllowShrinking::No);
+}
+
+/**
+ * @brief Forget every tracked slot.
+ */
+void FKawaiiFluidShadowInstanceTracker::Reset()
+{
+	KeyToSlot.Reset();
+	SlotKeys.Reset();
+	SlotTransforms.Reset();
+	SlotSeenEpoch.Reset();
+	DirtySlots.Reset();
+	PrevNumSlots = 0;
+}
@@ -0,0 +1,557 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Rendering/KawaiiFluidSurfaceMesher.h"
+#include "KawaiiFluidMarchingCubesTables.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "HAL/PlatformTime.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+
+namespace
+{
+	constexpr int32 SamplesPerAxis = FKawaiiFluidSurfaceMesher::BlockCells + 1;
+	constexpr int32 SamplesPerBlock = SamplesPerAxis * SamplesPerAxis * SamplesPerAxis;
+
+	/** Block coordinates are packed into 21 bits per axis */
+	constexpr int32 BlockCoordOffset = 1 << 20;
+
+	/** Sample coordinates are packed into 20 bits per axis (+2 axis bits) for edge keys */
+	constexpr int32 SampleCoordOffset = 1 << 19;
+	constexpr int32 SampleCoordLimit = SampleCoordOffset - 2 * FKawaiiFluidSurfaceMesher::BlockCells;
+
+	/** Smallest anisotropy axis scale (keeps the inverse metric finite) */
+	constexpr float MinAnisotropyScale = 0.05f;
+
+	FORCEINLINE int32 FloorDiv(int32 A, int32 B)
+	{
+		return A >= 0 ? A / B : -((-A + B - 1) / B);
+	}
+
+	FORCEINLINE uint64 PackBlockKey(const FIntVector& Block)
+	{
+		return static_cast<uint64>(Block.X + BlockCoordOffset)
+			| (static_cast<uint64>(Block.Y + BlockCoordOffset) << 21)
+			| (static_cast<uint64>(Block.Z + BlockCoordOffset) << 42);
+	}
+
+	/**
+	 * @brief Helper: Global key of a grid edge (shared by every block that meshes it).
+	 * @param Sample Global sample coordinate of the edge's lower end.
+	 * @param Axis Edge axis (0-2).
+	 * @return Packed key.
+	 */
+	FORCEINLINE uint64 PackEdgeKey(const FIntVector& Sample, int32 Axis)
+	{
+		return static_cast<uint64>(Axis)
+			| (static_cast<uint64>(Sample.X + SampleCoordOffset) << 2)
+			| (static_cast<uint64>(Sample.Y + SampleCoordOffset) << 22)
+			| (static_cast<uint64>(Sample.Z + SampleCoordOffset) << 42);
+	}
+
+	FORCEINLINE int32 SampleIndex(int32 X, int32 Y, int32 Z)
+	{
+		return (Z * SamplesPerAxis + Y) * SamplesPerAxis + X;
+	}
+
+	/**
+	 * @brief Helper: Inclusive range of global samples inside one particle's kernel bounds.
+	 * Used for both block binning and splatting, so a particle reaches exactly the same samples in every block.
+	 */
+	FORCEINLINE void GetSampleRange(const FVector3f& Position, const FVector3f& Extent, float InvCellSize, FIntVector& OutMin, FIntVector& OutMax)
+	{
+		OutMin = FIntVector(
+			FMath::CeilToInt((Position.X - Extent.X) * InvCellSize),
+			FMath::CeilToInt((Position.Y - Extent.Y) * InvCellSize),
+			FMath::CeilToInt((Position.Z - Extent.Z) * InvCellSize));
+		OutMax = FIntVector(
+			FMath::FloorToInt((Position.X + Extent.X) * InvCellSize),
+			FMath::FloorToInt((Position.Y + Extent.Y) * InvCellSize),
+			FMath::FloorToInt((Position.Z + Extent.Z) * InvCellSize));
+	}
+}
+
+//=============================================================================
+// FKawaiiFluidSurfaceMesh
+//=============================================================================
+
+void FKawaiiFluidSurfaceMesh::Reset()
+{
+	Positions.Reset();
+	Normals.Reset();
+	Indices.Reset();
+}
+
+/**
+ * @brief Convert to a mesh description with one shared vertex instance per vertex (smooth normals).
+ * @param OutMeshDescription Mesh description to fill (emptied first).
+ */
+void FKawaiiFluidSurfaceMesh::BuildMeshDescription(FMeshDescription& OutMeshDescription) const
+{
+	OutMeshDescription.Empty();
+	FStaticMeshAttributes Attributes(OutMeshDescription);
+	Attributes.Register();
+
+	TVertexAttributesRef<FVector3f> VertexPositions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector3f> VertexInstanceNormals = Attributes.GetVertexInstanceNormals();
+
+	const FPolygonGroupID PolygonGroup = OutMeshDescription.CreatePolygonGroup();
+	OutMeshDescription.ReserveNewVertices(Positions.Num());
+	OutMeshDescription.ReserveNewVertexInstances(Positions.Num());
+	OutMeshDescription.ReserveNewTriangles(NumTriangles());
+
+	TArray<FVertexInstanceID> Instances;
+	Instances.SetNumUninitialized(Positions.Num());
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		const FVertexID VertexID = OutMeshDescription.CreateVertex();
+		VertexPositions[VertexID] = Positions[i];
+		Instances[i] = OutMeshDescription.CreateVertexInstance(VertexID);
+		VertexInstanceNormals[Instances[i]] = Normals.IsValidIndex(i) ? Normals[i] : FVector3f::UpVector;
+	}
+
+	// Engine front faces are the reverse of Cross(B - A, C - A)
+	for (int32 i = 0; i + 2 < Indices.Num(); i += 3)
+	{
+		const FVertexInstanceID Triangle[3] = { Instances[Indices[i]], Instances[Indices[i + 2]], Instances[Indices[i + 1]] };
+		OutMeshDescription.CreateTriangle(PolygonGroup, Triangle);
+	}
+}
+
+//=============================================================================
+// FKawaiiFluidSurfaceMesher
+//=============================================================================
+
+void FKawaiiFluidSurfaceMesher::ClearCache()
+{
+	BlockCache.Empty();
+}
+
+bool FKawaiiFluidSurfaceMesher::IsCacheCompatible(const FKawaiiFluidSurfaceMeshParams& Params) const
+{
+	return CachedParams.ParticleRadius == Params.ParticleRadius
+		&& CachedParams.SmoothingRadiusScale == Params.SmoothingRadiusScale
+		&& CachedParams.GetCellSize() == Params.GetCellSize()
+		&& CachedParams.IsoThreshold == Params.IsoThreshold
+		&& CachedParams.bUseAnisotropy == Params.bUseAnisotropy;
+}
+
+/**
+ * @brief Splat particles, bin them into sparse blocks, mesh changed blocks in parallel and weld the result.
+ * @param Positions Particle positions.
+ * @param AnisotropyAxis1 First ellipsoid axis per particle (xyz = direction, w = scale), or empty.
+ * @param AnisotropyAxis2 Second ellipsoid axis.
+ * @param AnisotropyAxis3 Third ellipsoid axis.
+ * @param Params Reconstruction settings.
+ * @param OutMesh Receives the welded surface.
+ */
+void FKawaiiFluidSurfaceMesher::Build(TConstArrayView<FVector3f> Positions,
+	TConstArrayView<FVector4f> AnisotropyAxis1,
+	TConstArrayView<FVector4f> AnisotropyAxis2,
+	TConstArrayView<FVector4f> AnisotropyAxis3,
+	const FKawaiiFluidSurfaceMeshParams& Params,
+	FKawaiiFluidSurfaceMesh& OutMesh)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluid_SurfaceMesher_Build);
+	const double StartTime = FPlatformTime::Seconds();
+
+	OutMesh.Reset();
+	LastStats = FKawaiiFluidSurfaceMeshStats();
+
+	if (!Params.bEnableBlockCache || !IsCacheCompatible(Params))
+	{
+		BlockCache.Empty();
+	}
+	CachedParams = Params;
+
+	const int32 NumParticles = Positions.Num();
+	const float CellSize = Params.GetCellSize();
+	const float SmoothingRadius = Params.GetSmoothingRadius();
+	if (NumParticles == 0 || CellSize <= KINDA_SMALL_NUMBER || SmoothingRadius <= KINDA_SMALL_NUMBER)
+	{
+		BlockCache.Empty();
+		return;
+	}
+	const float InvCellSize = 1.0f / CellSize;
+	const bool bAnisotropic = Params.bUseAnisotropy
+		&& AnisotropyAxis1.Num() == NumParticles && AnisotropyAxis2.Num() == NumParticles && AnisotropyAxis3.Num() == NumParticles;
+
+	//========================================
+	// Per-particle kernel metric, bounds and hash
+	//========================================
+	// q^2 = sum_k dot(InvAxes[k], X - P)^2, so spheres and ellipsoids share the splat loop
+	TArray<FVector3f> InvAxes;
+	TArray<FVector3f> Extents;
+	TArray<uint64> ParticleHashes;
+	TArray<bool> bValidParticle;
+	InvAxes.SetNumUninitialized(NumParticles * 3);
+	Extents.SetNumUninitialized(NumParticles);
+	ParticleHashes.SetNumUninitialized(NumParticles);
+	bValidParticle.SetNumUninitialized(NumParticles);
+
+	ParallelFor(NumParticles, [&](int32 i)
+	{
+		const FVector3f& P = Positions[i];
+		FVector3f* Axes = &InvAxes[i * 3];
+		if (bAnisotropic)
+		{
+			const FVector4f Axis[3] = { AnisotropyAxis1[i], AnisotropyAxis2[i], AnisotropyAxis3[i] };
+			FVector3f ExtentSq = FVector3f::ZeroVector;
+			for (int32 k = 0; k < 3; ++k)
+			{
+				const FVector3f Dir = FVector3f(Axis[k].X, Axis[k].Y, Axis[k].Z).GetSafeNormal(UE_SMALL_NUMBER, FVector3f(k == 0 ? 1.0f : 0.0f, k == 1 ? 1.0f : 0.0f, k == 2 ? 1.0f : 0.0f));
+				const float Radius = SmoothingRadius * FMath::Max(Axis[k].W, MinAnisotropyScale);
+				Axes[k] = Dir / Radius;
+				ExtentSq += (Dir * Radius) * (Dir * Radius);
+			}
+			Extents[i] = FVector3f(FMath::Sqrt(ExtentSq.X), FMath::Sqrt(ExtentSq.Y), FMath::Sqrt(ExtentSq.Z));
+		}
+		else
+		{
+			const float InvRadius = 1.0f / SmoothingRadius;
+			Axes[0] = FVector3f(InvRadius, 0.0f, 0.0f);
+			Axes[1] = FVector3f(0.0f, InvRadius, 0.0f);
+			Axes[2] = FVector3f(0.0f, 0.0f, InvRadius);
+			Extents[i] = FVector3f(SmoothingRadius);
+		}
+
+		// Skip NaNs and particles outside the packable sample range
+		const FVector3f Sample = P * InvCellSize;
+		bValidParticle[i] = !P.ContainsNaN() && Sample.GetAbsMax() + Extents[i].GetMax() * InvCellSize < SampleCoordLimit;
+
+		// Hash of everything that shapes this particle's kernel (combined order-independently per block)
+		FVector4f HashData[4] = { FVector4f(P, 0.0f), FVector4f::Zero(), FVector4f::Zero(), FVector4f::Zero() };
+		if (bAnisotropic)
+		{
+			HashData[1] = AnisotropyAxis1[i];
+			HashData[2] = AnisotropyAxis2[i];
+			HashData[3] = AnisotropyAxis3[i];
+		}
+		ParticleHashes[i] = CityHash64(reinterpret_cast<const char*>(HashData), sizeof(HashData));
+	});
+
+	//========================================
+	// Sparse block binning (ascending particle order per block)
+	//========================================
+	TMap<uint64, int32> BlockLookup;
+	TArray<FIntVector> BlockCoords;
+	TArray<uint64> BlockKeys;
+	TArray<uint64> BlockHashes;
+	TArray<TArray<int32>> BlockParticles;
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluid_SurfaceMesher_Bin);
+		BlockLookup.Reserve(NumParticles / 4 + 16);
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			if (!bValidParticle[i])
+			{
+				continue;
+			}
+
+			FIntVector SampleMin, SampleMax;
+			GetSampleRange(Positions[i], Extents[i], InvCellSize, SampleMin, SampleMax);
+
+			// Blocks own samples [B * Block, B * Block + B] inclusive, so face samples are splatted by both neighbors
+			const FIntVector BlockMin(
+				FloorDiv(SampleMin.X + BlockCells - 1, BlockCells) - 1,
+				FloorDiv(SampleMin.Y + BlockCells - 1, BlockCells) - 1,
+				FloorDiv(SampleMin.Z + BlockCells - 1, BlockCells) - 1);
+			const FIntVector BlockMax(FloorDiv(SampleMax.X, BlockCells), FloorDiv(SampleMax.Y, BlockCells), FloorDiv(SampleMax.Z, BlockCells));
+
+			for (int32 Z = BlockMin.Z; Z <= BlockMax.Z; ++Z)
+			{
+				for (int32 Y = BlockMin.Y; Y <= BlockMax.Y; ++Y)
+				{
+					for (int32 X = BlockMin.X; X <= BlockMax.X; ++X)
+					{
+						const FIntVector Block(X, Y, Z);
+						const uint64 Key = PackBlockKey(Block);
+						int32& BlockIndex = BlockLookup.FindOrAdd(Key, INDEX_NONE);
+						if (BlockIndex == INDEX_NONE)
+						{
+							BlockIndex = BlockCoords.Add(Block);
+							BlockKeys.Add(Key);
+							BlockHashes.Add(0);
+							BlockParticles.AddDefaulted();
+						}
+						BlockParticles[BlockIndex].Add(i);
+						BlockHashes[BlockIndex] += ParticleHashes[i];
+					}
+				}
+			}
+		}
+	}
+
+	const int32 NumBlocks = BlockCoords.Num();
+	for (int32 b = 0; b < NumBlocks; ++b)
+	{
+		BlockHashes[b] ^= static_cast<uint64>(BlockParticles[b].Num()) * 0x9E3779B97F4A7C15ull;
+	}
+
+	//========================================
+	// Mesh changed blocks in parallel
+	//========================================
+	TArray<FBlockMesh> NewMeshes;
+	TArray<bool> bReused;
+	NewMeshes.SetNum(NumBlocks);
+	bReused.SetNumZeroed(NumBlocks);
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluid_SurfaceMesher_MeshBlocks);
+		const bool bUseCache = Params.bEnableBlockCache && BlockCache.Num() > 0;
+		ParallelFor(NumBlocks, [&](int32 b)
+		{
+			if (bUseCache)
+			{
+				const FCachedBlock* Cached = BlockCache.Find(BlockKeys[b]);
+				if (Cached && Cached->Hash == BlockHashes[b])
+				{
+					bReused[b] = true;
+					return;
+				}
+			}
+			MeshBlock(BlockCoords[b], BlockParticles[b], Positions, InvAxes, Extents, Params, NewMeshes[b]);
+		}, EParallelForFlags::Unbalanced);
+	}
+
+	TMap<uint64, FCachedBlock> NewCache;
+	NewCache.Reserve(NumBlocks);
+	for (int32 b = 0; b < NumBlocks; ++b)
+	{
+		FCachedBlock& Entry = NewCache.Add(BlockKeys[b]);
+		if (bReused[b])
+		{
+			Entry = MoveTemp(BlockCache.FindChecked(BlockKeys[b]));
+			++LastStats.NumReusedBlocks;
+		}
+		else
+		{
+			Entry.Hash = BlockHashes[b];
+			Entry.Mesh = MoveTemp(NewMeshes[b]);
+		}
+	}
+
+	//========================================
+	// Weld blocks along shared faces
+	//========================================
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluid_SurfaceMesher_Weld);
+		int32 TotalVertices = 0;
+		int32 TotalIndices = 0;
+		for (int32 b = 0; b < NumBlocks; ++b)
+		{
+			const FBlockMesh& Mesh = NewCache.FindChecked(BlockKeys[b]).Mesh;
+			TotalVertices += Mesh.Positions.Num();
+			TotalIndices += Mesh.Indices.Num();
+		}
+		OutMesh.Positions.Reserve(TotalVertices);
+		OutMesh.Indices.Reserve(TotalIndices);
+
+		TMap<uint64, int32> FaceVertices;
+		TArray<int32> Remap;
+		for (int32 b = 0; b < NumBlocks; ++b)
+		{
+			const FBlockMesh& Mesh = NewCache.FindChecked(BlockKeys[b]).Mesh;
+			if (Mesh.Indices.Num() == 0)
+			{
+				continue;
+			}
+			++LastStats.NumSurfaceBlocks;
+
+			Remap.SetNumUninitialized(Mesh.Positions.Num(), EAllowShrinking::No);
+			for (int32 v = 0; v < Mesh.Positions.Num(); ++v)
+			{
+				if (Mesh.bOnFace[v])
+				{
+					int32& Welded = FaceVertices.FindOrAdd(Mesh.EdgeKeys[v], INDEX_NONE);
+					if (Welded == INDEX_NONE)
+					{
+						Welded = OutMesh.Positions.Add(Mesh.Positions[v]);
+					}
+					Remap[v] = Welded;
+				}
+				else
+				{
+					Remap[v] = OutMesh.Positions.Add(Mesh.Positions[v]);
+				}
+			}
+			for (const int32 LocalIndex : Mesh.Indices)
+			{
+				OutMesh.Indices.Add(static_cast<uint32>(Remap[LocalIndex]));
+			}
+		}
+	}
+
+	// Area-weighted vertex normals
+	OutMesh.Normals.SetNumZeroed(OutMesh.Positions.Num());
+	for (int32 i = 0; i < OutMesh.Indices.Num(); i += 3)
+	{
+		const uint32 A = OutMesh.Indices[i];
+		const uint32 B = OutMesh.Indices[i + 1];
+		const uint32 C = OutMesh.Indices[i + 2];
+		const FVector3f FaceNormal = FVector3f::CrossProduct(OutMesh.Positions[B] - OutMesh.Positions[A], OutMesh.Positions[C] - OutMesh.Positions[A]);
+		OutMesh.Normals[A] += FaceNormal;
+		OutMesh.Normals[B] += FaceNormal;
+		OutMesh.Normals[C] += FaceNormal;
+	}
+	for (FVector3f& Normal : OutMesh.Normals)
+	{
+		Normal = Normal.GetSafeNormal();
+	}
+
+	if (Params.bEnableBlockCache)
+	{
+		BlockCache = MoveTemp(NewCache);
+	}
+	else
+	{
+		BlockCache.Empty();
+	}
+
+	LastStats.NumParticles = NumParticles;
+	LastStats.NumBlocks = NumBlocks;
+	LastStats.BuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+/**
+ * @brief Splat one block's particles onto its (BlockCells + 1)^3 samples and run marching cubes over its cells.
+ * @param BlockCoord Block coordinate.
+ * @param ParticleIndices Particles whose kernel reaches the block.
+ * @param Positions All particle positions.
+ * @param InvAxes Inverse kernel axes, 3 per particle.
+ * @param Extents Kernel half-extents per particle (world axes).
+ * @param Params Reconstruction settings.
+ * @param OutMesh Receives the block's triangles (unwelded).
+ */
+void FKawaiiFluidSurfaceMesher::MeshBlock(const FIntVector& BlockCoord, TConstArrayView<int32> ParticleIndices,
+	TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> InvAxes, TConstArrayView<FVector3f> Extents,
+	const FKawaiiFluidSurfaceMeshParams& Params, FBlockMesh& OutMesh)
+{
+	using namespace KawaiiFluidMarchingCubes;
+
+	const float CellSize = Params.GetCellSize();
+	const float InvCellSize = 1.0f / CellSize;
+	const float IsoThreshold = Params.IsoThreshold;
+	const FIntVector Origin = BlockCoord * BlockCells;
+
+	// Splat: poly6-shaped kernel (1 - q^2)^3 under the particle's (possibly anisotropic) metric
+	float Field[SamplesPerBlock];
+	FMemory::Memzero(Field, sizeof(Field));
+	bool bAnyInside = false;
+
+	for (const int32 ParticleIndex : ParticleIndices)
+	{
+		const FVector3f& P = Positions[ParticleIndex];
+		const FVector3f& Axis0 = InvAxes[ParticleIndex * 3];
+		const FVector3f& Axis1 = InvAxes[ParticleIndex * 3 + 1];
+		const FVector3f& Axis2 = InvAxes[ParticleIndex * 3 + 2];
+
+		// Same sample range as binning, so face samples get identical sums in both neighbors
+		FIntVector SampleMin, SampleMax;
+		GetSampleRange(P, Extents[ParticleIndex], InvCellSize, SampleMin, SampleMax);
+
+		const FIntVector LocalMin(
+			FMath::Max(SampleMin.X - Origin.X, 0), FMath::Max(SampleMin.Y - Origin.Y, 0), FMath::Max(SampleMin.Z - Origin.Z, 0));
+		const FIntVector LocalMax(
+			FMath::Min(SampleMax.X - Origin.X, BlockCells), FMath::Min(SampleMax.Y - Origin.Y, BlockCells), FMath::Min(SampleMax.Z - Origin.Z, BlockCells));
+
+		for (int32 Z = LocalMin.Z; Z <= LocalMax.Z; ++Z)
+		{
+			for (int32 Y = LocalMin.Y; Y <= LocalMax.Y; ++Y)
+			{
+				for (int32 X = LocalMin.X; X <= LocalMax.X; ++X)
+				{
+					const FVector3f D = FVector3f(
+						static_cast<float>(Origin.X + X) * CellSize - P.X,
+						static_cast<float>(Origin.Y + Y) * CellSize - P.Y,
+						static_cast<float>(Origin.Z + Z) * CellSize - P.Z);
+					const float Q0 = Axis0 | D;
+					const float Q1 = Axis1 | D;
+					const float Q2 = Axis2 | D;
+					const float QSq = Q0 * Q0 + Q1 * Q1 + Q2 * Q2;
+					if (QSq < 1.0f)
+					{
+						const float T = 1.0f - QSq;
+						float& Value = Field[SampleIndex(X, Y, Z)];
+						Value += T * T * T;
+						bAnyInside |= Value >= IsoThreshold;
+					}
+				}
+			}
+		}
+	}
+
+	if (!bAnyInside)
+	{
+		return;
+	}
+
+	// Marching cubes; vertices are shared within the block through a per-edge index grid
+	int32 EdgeVertex[3][SamplesPerBlock];
+	FMemory::Memset(EdgeVertex, 0xFF, sizeof(EdgeVertex));
+
+	auto GetEdgeVertex = [&](int32 CellX, int32 CellY, int32 CellZ, int32 Edge) -> int32
+	{
+		const int32 Axis = EdgeAxes[Edge];
+		const int32 X0 = CellX + EdgeOrigins[Edge][0];
+		const int32 Y0 = CellY + EdgeOrigins[Edge][1];
+		const int32 Z0 = CellZ + EdgeOrigins[Edge][2];
+		const int32 Index0 = SampleIndex(X0, Y0, Z0);
+
+		int32& Vertex = EdgeVertex[Axis][Index0];
+		if (Vertex != INDEX_NONE)
+		{
+			return Vertex;
+		}
+
+		const int32 X1 = X0 + (Axis == 0);
+		const int32 Y1 = Y0 + (Axis == 1);
+		const int32 Z1 = Z0 + (Axis == 2);
+		const float F0 = Field[Index0];
+		const float F1 = Field[SampleIndex(X1, Y1, Z1)];
+		const float T = FMath::Clamp((IsoThreshold - F0) / (F1 - F0), 0.0f, 1.0f);
+
+		const FVector3f P0 = FVector3f(static_cast<float>(Origin.X + X0), static_cast<float>(Origin.Y + Y0), static_cast<float>(Origin.Z + Z0)) * CellSize;
+		const FVector3f P1 = FVector3f(static_cast<float>(Origin.X + X1), static_cast<float>(Origin.Y + Y1), static_cast<float>(Origin.Z + Z1)) * CellSize;
+
+		// Edges in a block face plane are also meshed by the neighbor block and get welded
+		const int32 Local[3] = { X0, Y0, Z0 };
+		bool bOnFace = false;
+		for (int32 k = 0; k < 3; ++k)
+		{
+			bOnFace |= k != Axis && (Local[k] == 0 || Local[k] == BlockCells);
+		}
+
+		Vertex = OutMesh.Positions.Add(FMath::Lerp(P0, P1, T));
+		OutMesh.EdgeKeys.Add(PackEdgeKey(Origin + FIntVector(X0, Y0, Z0), Axis));
+		OutMesh.bOnFace.Add(bOnFace);
+		return Vertex;
+	};
+
+	for (int32 Z = 0; Z < BlockCells; ++Z)
+	{
+		for (int32 Y = 0; Y < BlockCells; ++Y)
+		{
+			for (int32 X = 0; X < BlockCells; ++X)
+			{
+				int32 CaseIndex = 0;
+				for (int32 Corner = 0; Corner < 8; ++Corner)
+				{
+					const float Value = Field[SampleIndex(X + CornerOffsets[Corner][0], Y + CornerOffsets[Corner][1], Z + CornerOffsets[Corner][2])];
+					CaseIndex |= (Value >= IsoThreshold) ? (1 << Corner) : 0;
+				}
+				if (EdgeTable[CaseIndex] == 0)
+				{
+					continue;
+				}
+
+				const int8* Triangles = TriTable[CaseIndex];
+				for (int32 t = 0; Triangles[t] != -1; t += 3)
+				{
+					OutMesh.Indices.Add(GetEdgeVertex(X, Y, Z, Triangles[t]));
+					OutMesh.Indices.Add(GetEdgeVertex(X, Y, Z, Triangles[t + 1]));
+					OutMesh.Indices.Add(GetEdgeVertex(X, Y, Z, Triangles[t + 2]));
+				}
+			}
+		}
+	}
+}
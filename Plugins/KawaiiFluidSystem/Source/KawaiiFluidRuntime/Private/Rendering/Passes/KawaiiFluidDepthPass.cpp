@@ -211,6 +211,26 @@ void KawaiiFluidRenderer::RenderKawaiiFluidDepthPass(
 			AnisotropyAxis2SRV,
 			AnisotropyAxis3SRV);
 
+		// Quantized render format: positions (with render offset), velocities and anisotropy from the packed buffers
+		const bool bUsePacked = RR->HasValidPackedBuffers();
+		FRDGBufferSRVRef PackedParticlesSRV = nullptr;
+		FRDGBufferSRVRef PackedAnisotropySRV = nullptr;
+		FRDGBufferSRVRef PackedBoundsSRV = nullptr;
+		if (bUsePacked)
+		{
+			PackedParticlesSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(
+				RR->GetPooledPackedParticleBuffer(), TEXT("SSFRPackedParticles")));
+			PackedBoundsSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(
+				RR->GetPooledBoundsBuffer(), TEXT("SSFRPackedBounds")));
+
+			bUseAnisotropy &= RR->HasValidPackedAnisotropy();
+			if (bUseAnisotropy)
+			{
+				PackedAnisotropySRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(
+					RR->GetPooledPackedAnisotropyBuffer(), TEXT("SSFRPackedAnisotropy")));
+			}
+		}
+
 		// RenderOffset buffer (for surface particle rendering offset)
 		FRDGBufferSRVRef RenderOffsetSRV = RR->GetRenderOffsetBufferSRV(GraphBuilder);
 		if (!RenderOffsetSRV)
@@ -252,6 +272,11 @@ void KawaiiFluidRenderer::RenderKawaiiFluidDepthPass(
 		// Velocity buffer for flow texture
 		PassParameters->ParticleVelocities = VelocityBufferSRV;
 
+		// Packed render format (USE_PACKED_PARTICLES)
+		PassParameters->PackedParticles = PackedParticlesSRV;
+		PassParameters->PackedAnisotropy = PackedAnisotropySRV;
+		PassParameters->PackedBounds = PackedBoundsSRV;
+
 		// RenderOffset buffer for surface particle rendering
 		PassParameters->RenderOffset = RenderOffsetSRV;
 
@@ -288,6 +313,7 @@ void KawaiiFluidRenderer::RenderKawaiiFluidDepthPass(
 		FKawaiiFluidDepthVS::FPermutationDomain VSPermutationDomain;
 		FKawaiiFluidDepthPS::FPermutationDomain PSPermutationDomain;
 		VSPermutationDomain.Set<FUseAnisotropyDim>(bUseAnisotropy);
+		VSPermutationDomain.Set<FKawaiiFluidDepthVS::FUsePackedParticlesDim>(bUsePacked);
 		PSPermutationDomain.Set<FUseAnisotropyDim>(bUseAnisotropy);
 
 		TShaderMapRef<FKawaiiFluidDepthVS> VertexShader(GlobalShaderMap, VSPermutationDomain);
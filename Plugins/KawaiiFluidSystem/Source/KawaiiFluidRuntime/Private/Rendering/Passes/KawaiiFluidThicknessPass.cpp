@@ -126,6 +126,16 @@ void KawaiiFluidRenderer::RenderThicknessPass(
 		PassParameters->ProjectionMatrix = FMatrix44f(ProjectionMatrix);
 		PassParameters->ThicknessScale = ThicknessScale; // Use from LocalParameters
 
+		// Quantized render format (written by the extract pass when r.Fluid.PackedRenderParticles is on)
+		const bool bUsePacked = RR->HasValidPackedBuffers();
+		if (bUsePacked)
+		{
+			PassParameters->PackedParticles = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(
+				RR->GetPooledPackedParticleBuffer(), TEXT("SSFRThicknessPackedParticles")));
+			PassParameters->PackedBounds = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(
+				RR->GetPooledBoundsBuffer(), TEXT("SSFRThicknessPackedBounds")));
+		}
+
 		// SceneDepth parameters for occlusion test
 		PassParameters->SceneDepthTexture = SceneDepthTexture;
 		PassParameters->SceneDepthSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
@@ -142,7 +152,9 @@ void KawaiiFluidRenderer::RenderThicknessPass(
 			OutThicknessTexture, ERenderTargetLoadAction::ELoad);
 
 		FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
-		TShaderMapRef<FKawaiiFluidThicknessVS> VertexShader(GlobalShaderMap);
+		FKawaiiFluidThicknessVS::FPermutationDomain VSPermutationDomain;
+		VSPermutationDomain.Set<FKawaiiFluidThicknessVS::FUsePackedParticlesDim>(bUsePacked);
+		TShaderMapRef<FKawaiiFluidThicknessVS> VertexShader(GlobalShaderMap, VSPermutationDomain);
 		TShaderMapRef<FKawaiiFluidThicknessPS> PixelShader(GlobalShaderMap);
 
 		GraphBuilder.AddPass(
@@ -0,0 +1,292 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Rendering/Resources/KawaiiFluidPackedRenderParticle.h"
+#include "Math/Float16.h"
+
+namespace
+{
+	constexpr float Unorm16Max = 65535.0f;
+	constexpr float Snorm16Max = 32767.0f;
+	constexpr float Unorm10Max = 1023.0f;
+
+	/** Largest finite half (speeds above it saturate instead of becoming infinity) */
+	constexpr float MaxHalfValue = 65504.0f;
+
+	/** Quaternion components other than the largest lie in [-1/sqrt(2), 1/sqrt(2)] */
+	constexpr float QuatComponentRange = 0.70710678f;
+
+	/** @brief Round a [0, 1] value to an unsigned code (floor(x + 0.5), matching the shader). */
+	uint32 QuantizeUnorm(float Value, float MaxCode)
+	{
+		return static_cast<uint32>(FMath::FloorToFloat(FMath::Clamp(Value, 0.0f, 1.0f) * MaxCode + 0.5f));
+	}
+
+	/** @brief Round a [-1, 1] value to a 16-bit two's complement snorm code. */
+	uint32 QuantizeSnorm16(float Value)
+	{
+		const int32 Code = static_cast<int32>(FMath::FloorToFloat(FMath::Clamp(Value, -1.0f, 1.0f) * Snorm16Max + 0.5f));
+		return static_cast<uint32>(Code) & 0xFFFFu;
+	}
+
+	/** @brief Sign-extend a 16-bit snorm code back to [-1, 1]. */
+	float DequantizeSnorm16(uint32 Code)
+	{
+		const int32 Signed = static_cast<int32>(Code << 16) >> 16;
+		return FMath::Max(static_cast<float>(Signed) / Snorm16Max, -1.0f);
+	}
+
+	float SignNotZero(float Value)
+	{
+		return Value >= 0.0f ? 1.0f : -1.0f;
+	}
+}
+
+/**
+ * @brief Quantization box size used by the pack/unpack pair.
+ * @param BoundsMin Box minimum.
+ * @param BoundsMax Box maximum.
+ * @return Per-axis size, at least 1 cm.
+ */
+FVector3f KawaiiFluidRenderPacking::GetBoundsExtent(const FVector3f& BoundsMin, const FVector3f& BoundsMax)
+{
+	return (BoundsMax - BoundsMin).ComponentMax(FVector3f(1.0f));
+}
+
+/**
+ * @brief Octahedral encoding: project onto the L1 sphere, fold the lower hemisphere over the diagonals.
+ * @param Direction Non-zero direction (need not be normalized).
+ * @return Coordinates in [-1, 1]^2.
+ */
+FVector2f KawaiiFluidRenderPacking::EncodeOctahedral(const FVector3f& Direction)
+{
+	const FVector3f N = Direction / (FMath::Abs(Direction.X) + FMath::Abs(Direction.Y) + FMath::Abs(Direction.Z));
+	if (N.Z >= 0.0f)
+	{
+		return FVector2f(N.X, N.Y);
+	}
+	return FVector2f(
+		(1.0f - FMath::Abs(N.Y)) * SignNotZero(N.X),
+		(1.0f - FMath::Abs(N.X)) * SignNotZero(N.Y));
+}
+
+/**
+ * @brief Inverse octahedral mapping.
+ * @param Encoded Coordinates in [-1, 1]^2.
+ * @return Unit direction.
+ */
+FVector3f KawaiiFluidRenderPacking::DecodeOctahedral(const FVector2f& Encoded)
+{
+	FVector3f N(Encoded.X, Encoded.Y, 1.0f - FMath::Abs(Encoded.X) - FMath::Abs(Encoded.Y));
+	const float T = FMath::Clamp(-N.Z, 0.0f, 1.0f);
+	N.X += N.X >= 0.0f ? -T : T;
+	N.Y += N.Y >= 0.0f ? -T : T;
+	return N * FMath::InvSqrt(N.SizeSquared());
+}
+
+/**
+ * @brief Pack a particle exactly like ExtractRenderDataPackedCS.
+ * @param Position World position.
+ * @param Velocity World velocity.
+ * @param BoundsMin Quantization box minimum.
+ * @param BoundsExtent Quantization box size.
+ * @return Packed particle.
+ */
+FKawaiiFluidPackedRenderParticle KawaiiFluidRenderPacking::PackParticle(const FVector3f& Position, const FVector3f& Velocity, const FVector3f& BoundsMin, const FVector3f& BoundsExtent)
+{
+	const FVector3f Normalized = (Position - BoundsMin) * (FVector3f(1.0f) / BoundsExtent);
+	const uint32 X = QuantizeUnorm(Normalized.X, Unorm16Max);
+	const uint32 Y = QuantizeUnorm(Normalized.Y, Unorm16Max);
+	const uint32 Z = QuantizeUnorm(Normalized.Z, Unorm16Max);
+
+	const float Speed = Velocity.Size();
+	const FFloat16 HalfSpeed(FMath::Min(Speed, MaxHalfValue));
+	const FVector2f Oct = Speed > 0.0f ? EncodeOctahedral(Velocity) : FVector2f::ZeroVector;
+
+	FKawaiiFluidPackedRenderParticle Packed;
+	Packed.PositionXY = X | (Y << 16);
+	Packed.PositionZSpeed = Z | (static_cast<uint32>(HalfSpeed.Encoded) << 16);
+	Packed.Direction = QuantizeSnorm16(Oct.X) | (QuantizeSnorm16(Oct.Y) << 16);
+	return Packed;
+}
+
+FKawaiiFluidPackedRenderParticle KawaiiFluidRenderPacking::MakeCulledParticle()
+{
+	FKawaiiFluidPackedRenderParticle Packed;
+	Packed.Direction = CulledDirection;
+	return Packed;
+}
+
+/**
+ * @brief Unpack a particle exactly like FluidRenderPacking.ush.
+ * @param Packed Packed particle.
+ * @param BoundsMin Quantization box minimum used when packing.
+ * @param BoundsExtent Quantization box size used when packing.
+ * @param OutPosition World position.
+ * @param OutVelocity World velocity.
+ * @return False if the particle was culled.
+ */
+bool KawaiiFluidRenderPacking::UnpackParticle(const FKawaiiFluidPackedRenderParticle& Packed, const FVector3f& BoundsMin, const FVector3f& BoundsExtent, FVector3f& OutPosition, FVector3f& OutVelocity)
+{
+	if ((Packed.Direction & 0xFFFFu) == CulledDirection)
+	{
+		return false;
+	}
+
+	const FVector3f Codes(
+		static_cast<float>(Packed.PositionXY & 0xFFFFu),
+		static_cast<float>(Packed.PositionXY >> 16),
+		static_cast<float>(Packed.PositionZSpeed & 0xFFFFu));
+	OutPosition = BoundsMin + Codes * (BoundsExtent / Unorm16Max);
+
+	FFloat16 HalfSpeed;
+	HalfSpeed.Encoded = static_cast<uint16>(Packed.PositionZSpeed >> 16);
+	const FVector2f Oct(DequantizeSnorm16(Packed.Direction & 0xFFFFu), DequantizeSnorm16(Packed.Direction >> 16));
+	OutVelocity = DecodeOctahedral(Oct) * HalfSpeed.GetFloat();
+	return true;
+}
+
+/**
+ * @brief Smallest-three quaternion packing.
+ * @param Rotation Unit quaternion.
+ * @return Bits 0-1 largest component index (X, Y, Z, W), then the remaining three as unorm10 in XYZW order.
+ */
+uint32 KawaiiFluidRenderPacking::PackQuaternion(const FQuat4f& Rotation)
+{
+	float Components[4] = { Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+
+	uint32 Largest = 0;
+	for (uint32 i = 1; i < 4; ++i)
+	{
+		if (FMath::Abs(Components[i]) > FMath::Abs(Components[Largest]))
+		{
+			Largest = i;
+		}
+	}
+
+	// q and -q are the same rotation: keep the dropped component positive
+	const float Sign = Components[Largest] < 0.0f ? -1.0f : 1.0f;
+
+	uint32 Packed = Largest;
+	uint32 Shift = 2;
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		if (i != Largest)
+		{
+			const float Normalized = Components[i] * Sign / QuatComponentRange * 0.5f + 0.5f;
+			Packed |= QuantizeUnorm(Normalized, Unorm10Max) << Shift;
+			Shift += 10;
+		}
+	}
+	return Packed;
+}
+
+/**
+ * @brief Inverse of PackQuaternion.
+ * @param Packed Packed quaternion.
+ * @return Unit quaternion.
+ */
+FQuat4f KawaiiFluidRenderPacking::UnpackQuaternion(uint32 Packed)
+{
+	const uint32 Largest = Packed & 3u;
+
+	float Components[4];
+	float SumSquares = 0.0f;
+	uint32 Shift = 2;
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		if (i != Largest)
+		{
+			const float Code = static_cast<float>((Packed >> Shift) & 1023u);
+			Components[i] = (Code / Unorm10Max * 2.0f - 1.0f) * QuatComponentRange;
+			SumSquares += Components[i] * Components[i];
+			Shift += 10;
+		}
+	}
+	Components[Largest] = FMath::Sqrt(FMath::Max(1.0f - SumSquares, 0.0f));
+
+	FQuat4f Rotation(Components[0], Components[1], Components[2], Components[3]);
+	Rotation.Normalize();
+	return Rotation;
+}
+
+/**
+ * @brief Quaternion of the rotation matrix whose columns are the given axes (Shepperd's method).
+ * @param Axis1 Image of the X axis.
+ * @param Axis2 Image of the Y axis.
+ * @param Axis3 Image of the Z axis (negated if the basis is left-handed).
+ * @return Unit quaternion.
+ */
+FQuat4f KawaiiFluidRenderPacking::AxesToQuaternion(const FVector3f& Axis1, const FVector3f& Axis2, const FVector3f& Axis3)
+{
+	const FVector3f Z = FVector3f::DotProduct(FVector3f::CrossProduct(Axis1, Axis2), Axis3) < 0.0f ? -Axis3 : Axis3;
+
+	const float M00 = Axis1.X, M01 = Axis2.X, M02 = Z.X;
+	const float M10 = Axis1.Y, M11 = Axis2.Y, M12 = Z.Y;
+	const float M20 = Axis1.Z, M21 = Axis2.Z, M22 = Z.Z;
+
+	FQuat4f Rotation;
+	const float Trace = M00 + M11 + M22;
+	if (Trace > 0.0f)
+	{
+		const float S = FMath::Sqrt(Trace + 1.0f) * 2.0f;
+		Rotation = FQuat4f((M21 - M12) / S, (M02 - M20) / S, (M10 - M01) / S, 0.25f * S);
+	}
+	else if (M00 > M11 && M00 > M22)
+	{
+		const float S = FMath::Sqrt(1.0f + M00 - M11 - M22) * 2.0f;
+		Rotation = FQuat4f(0.25f * S, (M01 + M10) / S, (M02 + M20) / S, (M21 - M12) / S);
+	}
+	else if (M11 > M22)
+	{
+		const float S = FMath::Sqrt(1.0f + M11 - M00 - M22) * 2.0f;
+		Rotation = FQuat4f((M01 + M10) / S, 0.25f * S, (M12 + M21) / S, (M02 - M20) / S);
+	}
+	else
+	{
+		const float S = FMath::Sqrt(1.0f + M22 - M00 - M11) * 2.0f;
+		Rotation = FQuat4f((M02 + M20) / S, (M12 + M21) / S, 0.25f * S, (M10 - M01) / S);
+	}
+	Rotation.Normalize();
+	return Rotation;
+}
+
+/**
+ * @brief Pack anisotropy axes.
+ * @param Axis1 Major axis direction (xyz) and scale (w).
+ * @param Axis2 Intermediate axis.
+ * @param Axis3 Minor axis.
+ * @return Packed rotation and scales.
+ */
+FKawaiiFluidPackedAnisotropy KawaiiFluidRenderPacking::PackAnisotropy(const FVector4f& Axis1, const FVector4f& Axis2, const FVector4f& Axis3)
+{
+	FKawaiiFluidPackedAnisotropy Packed;
+	Packed.Rotation = PackQuaternion(AxesToQuaternion(FVector3f(Axis1), FVector3f(Axis2), FVector3f(Axis3)));
+	Packed.Scales = QuantizeUnorm(Axis1.W / MaxAnisotropyScale, Unorm10Max)
+		| (QuantizeUnorm(Axis2.W / MaxAnisotropyScale, Unorm10Max) << 10)
+		| (QuantizeUnorm(Axis3.W / MaxAnisotropyScale, Unorm10Max) << 20);
+	return Packed;
+}
+
+/**
+ * @brief Unpack anisotropy axes in the layout the depth shader consumes.
+ * @param Packed Packed rotation and scales.
+ * @param OutAxis1 Major axis direction (xyz) and scale (w).
+ * @param OutAxis2 Intermediate axis.
+ * @param OutAxis3 Minor axis.
+ */
+void KawaiiFluidRenderPacking::UnpackAnisotropy(const FKawaiiFluidPackedAnisotropy& Packed, FVector4f& OutAxis1, FVector4f& OutAxis2, FVector4f& OutAxis3)
+{
+	const FQuat4f Q = UnpackQuaternion(Packed.Rotation);
+	const float ScaleStep = MaxAnisotropyScale / Unorm10Max;
+
+	// Columns of the rotation matrix
+	OutAxis1 = FVector4f(
+		1.0f - 2.0f * (Q.Y * Q.Y + Q.Z * Q.Z), 2.0f * (Q.X * Q.Y + Q.W * Q.Z), 2.0f * (Q.X * Q.Z - Q.W * Q.Y),
+		static_cast<float>(Packed.Scales & 1023u) * ScaleStep);
+	OutAxis2 = FVector4f(
+		2.0f * (Q.X * Q.Y - Q.W * Q.Z), 1.0f - 2.0f * (Q.X * Q.X + Q.Z * Q.Z), 2.0f * (Q.Y * Q.Z + Q.W * Q.X),
+		static_cast<float>((Packed.Scales >> 10) & 1023u) * ScaleStep);
+	OutAxis3 = FVector4f(
+		2.0f * (Q.X * Q.Z + Q.W * Q.Y), 2.0f * (Q.Y * Q.Z - Q.W * Q.X), 1.0f - 2.0f * (Q.X * Q.X + Q.Y * Q.Y),
+		static_cast<float>((Packed.Scales >> 20) & 1023u) * ScaleStep);
+}
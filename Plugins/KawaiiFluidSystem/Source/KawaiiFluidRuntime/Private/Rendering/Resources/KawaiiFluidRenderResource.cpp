@@ -10,6 +10,15 @@
 #include "Simulation/Shaders/GPUFluidSimulatorShaders.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
 #include "Simulation/GPUFluidSimulator.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarFluidPackedRenderParticles(
+	TEXT("r.Fluid.PackedRenderParticles"),
+	0,
+	TEXT("Render metaball depth/thickness from the quantized particle format.\n")
+	TEXT("  0 = Full-precision SoA buffers (default)\n")
+	TEXT("  1 = 16-bit AABB-relative positions, octahedral + half velocity, packed anisotropy quaternion (20B vs 84B per particle)"),
+	ECVF_RenderThreadSafe);
 
 /**
  * @brief Default constructor for the render resource.
@@ -54,6 +63,11 @@ void FKawaiiFluidRenderResource::ReleaseRHI()
 	PooledPositionBuffer.SafeRelease();
 	PooledVelocityBuffer.SafeRelease();
 
+	PooledPackedParticleBuffer.SafeRelease();
+	PooledPackedAnisotropyBuffer.SafeRelease();
+	bPackedBuffersWritten.store(false);
+	bPackedAnisotropyWritten.store(false);
+
 	ParticleCount = 0;
 	BufferCapacity = 0;
 	bBufferReadyForRendering.store(false);
@@ -94,6 +108,11 @@ void FKawaiiFluidRenderResource::ResizeBuffer(FRHICommandListBase& RHICmdList, i
 	PooledBoundsBuffer.SafeRelease();
 	PooledRenderParticleBuffer.SafeRelease();
 
+	PooledPackedParticleBuffer.SafeRelease();
+	PooledPackedAnisotropyBuffer.SafeRelease();
+	bPackedBuffersWritten.store(false);
+	bPackedAnisotropyWritten.store(false);
+
 	BufferCapacity = NewCapacity;
 
 	if (NewCapacity == 0)
@@ -156,6 +175,23 @@ void FKawaiiFluidRenderResource::ResizeBuffer(FRHICommandListBase& RHICmdList, i
 	AddClearUAVPass(GraphBuilder, RenderParticleUAV, 0u);
 	GraphBuilder.QueueBufferExtraction(RenderParticleRDGBuffer, &PooledRenderParticleBuffer, ERHIAccess::SRVMask);
 
+	//========================================
+	// Packed (quantized) buffers
+	//========================================
+	FRDGBufferDesc PackedParticleBufferDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FKawaiiFluidPackedRenderParticle), NewCapacity);
+	PackedParticleBufferDesc.Usage |= EBufferUsageFlags::UnorderedAccess;
+	FRDGBufferRef PackedParticleRDGBuffer = GraphBuilder.CreateBuffer(PackedParticleBufferDesc, TEXT("RenderParticlesPacked"));
+
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(PackedParticleRDGBuffer), 0u);
+	GraphBuilder.QueueBufferExtraction(PackedParticleRDGBuffer, &PooledPackedParticleBuffer, ERHIAccess::SRVMask);
+
+	FRDGBufferDesc PackedAnisotropyBufferDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FKawaiiFluidPackedAnisotropy), NewCapacity);
+	PackedAnisotropyBufferDesc.Usage |= EBufferUsageFlags::UnorderedAccess;
+	FRDGBufferRef PackedAnisotropyRDGBuffer = GraphBuilder.CreateBuffer(PackedAnisotropyBufferDesc, TEXT("RenderAnisotropyPacked"));
+
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(PackedAnisotropyRDGBuffer), 0u);
+	GraphBuilder.QueueBufferExtraction(PackedAnisotropyRDGBuffer, &PooledPackedAnisotropyBuffer, ERHIAccess::SRVMask);
+
 	GraphBuilder.Execute();
 
 	if (PooledParticleBuffer.IsValid())
@@ -176,6 +212,15 @@ void FKawaiiFluidRenderResource::ResizeBuffer(FRHICommandListBase& RHICmdList, i
 	}
 }
 
+/**
+ * @brief Whether the quantized render format is requested (r.Fluid.PackedRenderParticles).
+ * @return True if extraction should write and the depth/thickness passes should read the packed buffers.
+ */
+bool FKawaiiFluidRenderResource::IsPackedFormatRequested()
+{
+	return CVarFluidPackedRenderParticles.GetValueOnAnyThread() != 0;
+}
+
 //========================================
 // GPU simulator interface implementation
 //========================================
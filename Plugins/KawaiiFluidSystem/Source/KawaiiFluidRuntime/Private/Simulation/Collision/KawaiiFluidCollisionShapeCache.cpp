@@ -0,0 +1,372 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Collision/KawaiiFluidCollisionShapeCache.h"
+#include "Async/Async.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	TUniquePtr<FKawaiiFluidCollisionShapeCache> GCollisionShapeCache;
+
+	/**
+	 * @brief Appends the outward planes of a convex element in body space.
+	 * Faces of the index buffer are deduplicated by quantized normal; hulls without usable index data fall back
+	 * to the planes of the Chaos convex.
+	 * @param ConvexElem Source convex element
+	 * @param Center Vertex centroid of the element
+	 * @param OutPlanes Plane array to append to
+	 * @return Number of planes appended
+	 */
+	int32 AppendConvexPlanes(const FKConvexElem& ConvexElem, const FVector& Center, TArray<FKawaiiFluidLocalPlane>& OutPlanes)
+	{
+		const int32 PlaneStart = OutPlanes.Num();
+		const TArray<FVector>& VertexData = ConvexElem.VertexData;
+		const TArray<int32>& IndexData = ConvexElem.IndexData;
+
+		TSet<uint32> PlaneHashes;
+		for (int32 i = 0; i + 2 < IndexData.Num(); i += 3)
+		{
+			const int32 I0 = IndexData[i], I1 = IndexData[i + 1], I2 = IndexData[i + 2];
+			if (!VertexData.IsValidIndex(I0) || !VertexData.IsValidIndex(I1) || !VertexData.IsValidIndex(I2))
+			{
+				continue;
+			}
+
+			const FVector& V0 = VertexData[I0];
+			FVector Normal = FVector::CrossProduct(VertexData[I1] - V0, VertexData[I2] - V0);
+			const float NormalLen = Normal.Size();
+			if (NormalLen <= KINDA_SMALL_NUMBER)
+			{
+				continue;
+			}
+
+			Normal /= NormalLen;
+			if (FVector::DotProduct(Normal, Center - V0) > 0)
+			{
+				Normal = -Normal;
+			}
+
+			const int32 Nx = FMath::RoundToInt(Normal.X * 1000.0f), Ny = FMath::RoundToInt(Normal.Y * 1000.0f), Nz = FMath::RoundToInt(Normal.Z * 1000.0f);
+			const uint32 Hash = HashCombine(HashCombine(GetTypeHash(Nx), GetTypeHash(Ny)), GetTypeHash(Nz));
+
+			bool bAlreadyInSet = false;
+			PlaneHashes.Add(Hash, &bAlreadyInSet);
+			if (!bAlreadyInSet)
+			{
+				OutPlanes.Add({ Normal, static_cast<float>(FVector::DotProduct(V0, Normal)) });
+			}
+		}
+
+		if (OutPlanes.Num() - PlaneStart < 4)
+		{
+			OutPlanes.SetNum(PlaneStart);
+
+			TArray<FPlane> ChaosPlanes;
+			ConvexElem.GetPlanes(ChaosPlanes);
+			if (ChaosPlanes.Num() >= 4)
+			{
+				for (const FPlane& ChaosPlane : ChaosPlanes)
+				{
+					OutPlanes.Add({ FVector(ChaosPlane.X, ChaosPlane.Y, ChaosPlane.Z), static_cast<float>(ChaosPlane.W) });
+				}
+			}
+		}
+
+		return OutPlanes.Num() - PlaneStart;
+	}
+}
+
+//=============================================================================
+// FKawaiiFluidCollisionShapeSet
+//=============================================================================
+
+/**
+ * @brief Converts per-body aggregate geometry into body-space shapes.
+ * @param BodyGeometry Aggregate geometry of each body
+ * @param BodyBoneNames Bone of each body (NAME_None for static meshes)
+ * @return Shape set; convexes with fewer than 4 planes are dropped
+ */
+FKawaiiFluidCollisionShapeSet FKawaiiFluidCollisionShapeSet::Build(const TArray<FKAggregateGeom>& BodyGeometry, const TArray<FName>& BodyBoneNames)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidCollisionShapeSet_Build);
+	check(BodyGeometry.Num() == BodyBoneNames.Num());
+
+	FKawaiiFluidCollisionShapeSet Set;
+	Set.BodyBoneNames = BodyBoneNames;
+
+	for (int32 BodyIndex = 0; BodyIndex < BodyGeometry.Num(); ++BodyIndex)
+	{
+		const FKAggregateGeom& AggGeom = BodyGeometry[BodyIndex];
+
+		for (const FKSphereElem& SphereElem : AggGeom.SphereElems)
+		{
+			Set.Spheres.Add({ SphereElem.GetTransform().GetLocation(), SphereElem.Radius, BodyIndex });
+		}
+
+		for (const FKSphylElem& SphylElem : AggGeom.SphylElems)
+		{
+			const FTransform ElemTransform = SphylElem.GetTransform();
+			Set.Capsules.Add({ ElemTransform.GetLocation(), ElemTransform.GetRotation().GetUpVector(), SphylElem.Length * 0.5f, SphylElem.Radius, BodyIndex });
+		}
+
+		for (const FKBoxElem& BoxElem : AggGeom.BoxElems)
+		{
+			const FTransform ElemTransform = BoxElem.GetTransform();
+			Set.Boxes.Add({ ElemTransform.GetLocation(), ElemTransform.GetRotation(), FVector(BoxElem.X, BoxElem.Y, BoxElem.Z) * 0.5f, BodyIndex });
+		}
+
+		for (const FKConvexElem& ConvexElem : AggGeom.ConvexElems)
+		{
+			const TArray<FVector>& VertexData = ConvexElem.VertexData;
+			if (VertexData.Num() < 4)
+			{
+				continue;
+			}
+
+			FVector CenterSum = FVector::ZeroVector;
+			for (const FVector& V : VertexData)
+			{
+				CenterSum += V;
+			}
+			const FVector Center = CenterSum / static_cast<float>(VertexData.Num());
+
+			float MaxDistSq = 0.0f;
+			for (const FVector& V : VertexData)
+			{
+				MaxDistSq = FMath::Max(MaxDistSq, static_cast<float>(FVector::DistSquared(V, Center)));
+			}
+
+			const int32 PlaneStart = Set.ConvexPlanes.Num();
+			const int32 PlaneCount = AppendConvexPlanes(ConvexElem, Center, Set.ConvexPlanes);
+			if (PlaneCount >= 4)
+			{
+				Set.Convexes.Add({ Center, FMath::Sqrt(MaxDistSq), PlaneStart, PlaneCount, BodyIndex });
+			}
+			else
+			{
+				Set.ConvexPlanes.SetNum(PlaneStart);
+			}
+		}
+	}
+
+	return Set;
+}
+
+//=============================================================================
+// FKawaiiFluidCollisionShapeCache
+//=============================================================================
+
+/**
+ * @brief Process-wide instance, valid while the runtime module is loaded.
+ * @return Shape cache
+ */
+FKawaiiFluidCollisionShapeCache& FKawaiiFluidCollisionShapeCache::Get()
+{
+	check(GCollisionShapeCache.IsValid());
+	return *GCollisionShapeCache;
+}
+
+/**
+ * @brief Creates the process-wide instance. Called from the runtime module's StartupModule.
+ */
+void FKawaiiFluidCollisionShapeCache::Startup()
+{
+	if (!GCollisionShapeCache.IsValid())
+	{
+		GCollisionShapeCache = TUniquePtr<FKawaiiFluidCollisionShapeCache>(new FKawaiiFluidCollisionShapeCache());
+	}
+}
+
+/**
+ * @brief Destroys the process-wide instance while the delegates it registered still exist. Called from the runtime
+ * module's ShutdownModule.
+ */
+void FKawaiiFluidCollisionShapeCache::Shutdown()
+{
+	GCollisionShapeCache.Reset();
+}
+
+FKawaiiFluidCollisionShapeCache::FKawaiiFluidCollisionShapeCache()
+{
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FKawaiiFluidCollisionShapeCache::PruneStaleEntries);
+
+#if WITH_EDITOR
+	ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FKawaiiFluidCollisionShapeCache::OnObjectModified);
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([this](UObject* Object, FPropertyChangedEvent&)
+	{
+		OnObjectModified(Object);
+	});
+#endif
+}
+
+FKawaiiFluidCollisionShapeCache::~FKawaiiFluidCollisionShapeCache()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+#endif
+}
+
+/**
+ * @brief Copies the aggregate geometry of every body of a mesh asset.
+ * @param Asset UStaticMesh (one body) or UPhysicsAsset (one body per skeletal body setup)
+ * @param OutBodyGeometry Aggregate geometry per body
+ * @param OutBodyBoneNames Bone per body
+ * @return True if the asset has at least one body
+ */
+bool FKawaiiFluidCollisionShapeCache::GatherBodyGeometry(const UObject* Asset, TArray<FKAggregateGeom>& OutBodyGeometry, TArray<FName>& OutBodyBoneNames)
+{
+	if (const UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset))
+	{
+		if (const UBodySetup* BodySetup = StaticMesh->GetBodySetup())
+		{
+			OutBodyGeometry.Add(BodySetup->AggGeom);
+			OutBodyBoneNames.Add(NAME_None);
+		}
+	}
+	else if (const UPhysicsAsset* PhysicsAsset = Cast<UPhysicsAsset>(Asset))
+	{
+		for (const USkeletalBodySetup* BodySetup : PhysicsAsset->SkeletalBodySetups)
+		{
+			if (BodySetup)
+			{
+				OutBodyGeometry.Add(BodySetup->AggGeom);
+				OutBodyBoneNames.Add(BodySetup->BoneName);
+			}
+		}
+	}
+
+	return OutBodyGeometry.Num() > 0;
+}
+
+/**
+ * @brief Finds the entry of Asset or starts its extraction.
+ * @param Asset Mesh asset
+ * @param bAsync Extract on a worker thread instead of now
+ * @return Entry, or nullptr if the asset has no collision bodies
+ */
+TSharedFuture<FKawaiiFluidCollisionShapeCache::FShapeSetPtr>* FKawaiiFluidCollisionShapeCache::FindOrLaunch(const UObject* Asset, bool bAsync)
+{
+	check(IsInGameThread());
+
+	if (!Asset)
+	{
+		return nullptr;
+	}
+
+	const FObjectKey Key(Asset);
+	if (TSharedFuture<FShapeSetPtr>* Existing = Entries.Find(Key))
+	{
+		return Existing;
+	}
+
+	TArray<FKAggregateGeom> BodyGeometry;
+	TArray<FName> BodyBoneNames;
+	if (!GatherBodyGeometry(Asset, BodyGeometry, BodyBoneNames))
+	{
+		return nullptr;
+	}
+
+	if (bAsync)
+	{
+		TFuture<FShapeSetPtr> Future = Async(EAsyncExecution::TaskGraph,
+			[BodyGeometry = MoveTemp(BodyGeometry), BodyBoneNames = MoveTemp(BodyBoneNames)]() -> FShapeSetPtr
+			{
+				return MakeShared<FKawaiiFluidCollisionShapeSet, ESPMode::ThreadSafe>(FKawaiiFluidCollisionShapeSet::Build(BodyGeometry, BodyBoneNames));
+			});
+		return &Entries.Add(Key, Future.Share());
+	}
+
+	const FShapeSetPtr ShapeSet = MakeShared<FKawaiiFluidCollisionShapeSet, ESPMode::ThreadSafe>(FKawaiiFluidCollisionShapeSet::Build(BodyGeometry, BodyBoneNames));
+	return &Entries.Add(Key, MakeFulfilledPromise<FShapeSetPtr>(ShapeSet).GetFuture().Share());
+}
+
+/**
+ * @brief Starts extracting the shapes of Asset on a worker thread if they are not cached.
+ * @param Asset UStaticMesh or UPhysicsAsset
+ */
+void FKawaiiFluidCollisionShapeCache::Prefetch(const UObject* Asset)
+{
+	FindOrLaunch(Asset, true);
+}
+
+/**
+ * @brief Returns the shapes of Asset, waiting for a pending extraction or extracting them now.
+ * @param Asset UStaticMesh or UPhysicsAsset
+ * @return Shared shape set, nullptr if the asset has no collision bodies
+ */
+FKawaiiFluidCollisionShapeCache::FShapeSetPtr FKawaiiFluidCollisionShapeCache::FindOrBuild(const UObject* Asset)
+{
+	const TSharedFuture<FShapeSetPtr>* Entry = FindOrLaunch(Asset, false);
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	if (!Entry->IsReady())
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidCollisionShapeCache_Wait);
+		Entry->Wait();
+	}
+	return Entry->Get();
+}
+
+/**
+ * @brief Drops the entry of Asset; the next request extracts the shapes again.
+ * @param Asset Mesh asset
+ */
+void FKawaiiFluidCollisionShapeCache::Invalidate(const UObject* Asset)
+{
+	check(IsInGameThread());
+	Entries.Remove(FObjectKey(Asset));
+}
+
+/**
+ * @brief Drops every entry. Pending extractions finish on their worker and are discarded.
+ */
+void FKawaiiFluidCollisionShapeCache::Reset()
+{
+	check(IsInGameThread());
+	Entries.Reset();
+}
+
+/**
+ * @brief Drops the entries of assets that were garbage collected, so streamed-out meshes do not keep their shapes.
+ * Pending extractions of dropped entries finish on their worker and are discarded.
+ */
+void FKawaiiFluidCollisionShapeCache::PruneStaleEntries()
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+#if WITH_EDITOR
+/**
+ * @brief Drops the entry of an edited asset, or of the asset owning an edited body setup.
+ * @param Object Modified object
+ */
+void FKawaiiFluidCollisionShapeCache::OnObjectModified(UObject* Object)
+{
+	if (!Object || Entries.Num() == 0)
+	{
+		return;
+	}
+
+	Entries.Remove(FObjectKey(Object));
+	if (const UObject* Outer = Object->GetOuter())
+	{
+		Entries.Remove(FObjectKey(Outer));
+	}
+}
+#endif
@@ -9,6 +9,35 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "Engine/StaticMesh.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Body transform change (cm, radians, scale) below which the world-space shapes are kept */
+	constexpr float BodyTransformTolerance = 1.e-3f;
+
+	/** Fewer active shapes than this are transformed on the calling thread */
+	constexpr int32 MinShapesForParallelTransform = 64;
+
+	/**
+	 * @brief Collects the shapes whose body passes IsActive.
+	 * @param Shapes Body-space shapes of one type
+	 * @param IsActive Predicate on the body index
+	 * @param OutIndices Indices of the active shapes
+	 */
+	template<typename ShapeType, typename PredicateType>
+	void CollectActiveShapes(const TArray<ShapeType>& Shapes, const PredicateType& IsActive, TArray<int32>& OutIndices)
+	{
+		OutIndices.Reset();
+		for (int32 ShapeIndex = 0; ShapeIndex < Shapes.Num(); ++ShapeIndex)
+		{
+			if (IsActive(Shapes[ShapeIndex].BodyIndex))
+			{
+				OutIndices.Add(ShapeIndex);
+			}
+		}
+	}
+}
 
 /**
  * @brief Default constructor for UKawaiiFluidMeshCollider.
@@ -34,6 +63,9 @@ void UKawaiiFluidMeshCollider::BeginPlay()
 	{
 		AutoFindMeshComponent();
 	}
+
+	// Shapes are extracted in the background before the first simulation frame needs them
+	PrefetchCollisionShapes();
 }
 
 /**
@@ -73,9 +105,24 @@ void UKawaiiFluidMeshCollider::AutoFindMeshComponent()
 }
 
 /**
- * @brief Extracts and caches collision shapes from the target mesh component.
+ * @brief Starts extracting the shapes of the target mesh asset on a worker thread.
  */
-void UKawaiiFluidMeshCollider::CacheCollisionShapes()
+void UKawaiiFluidMeshCollider::PrefetchCollisionShapes() const
+{
+	if (const USkeletalMeshComponent* SkelMesh = Cast<USkeletalMeshComponent>(TargetMeshComponent))
+	{
+		FKawaiiFluidCollisionShapeCache::Get().Prefetch(SkelMesh->GetPhysicsAsset());
+	}
+	else if (const UStaticMeshComponent* StaticMesh = Cast<UStaticMeshComponent>(TargetMeshComponent))
+	{
+		FKawaiiFluidCollisionShapeCache::Get().Prefetch(StaticMesh->GetStaticMesh());
+	}
+}
+
+/**
+ * @brief Clears the world-space shapes and releases the shared shape set.
+ */
+void UKawaiiFluidMeshCollider::ResetCachedShapes()
 {
 	CachedCapsules.Reset();
 	CachedSpheres.Reset();
@@ -84,8 +131,20 @@ void UKawaiiFluidMeshCollider::CacheCollisionShapes()
 	CachedBounds = FBox(ForceInit);
 	bCacheValid = false;
 
+	ShapeSet.Reset();
+	BodyBoneIndices.Reset();
+	ResolvedSkinnedAsset.Reset();
+	CachedBodyTransforms.Reset();
+}
+
+/**
+ * @brief Extracts and caches collision shapes from the target mesh component.
+ */
+void UKawaiiFluidMeshCollider::CacheCollisionShapes()
+{
 	if (!TargetMeshComponent)
 	{
+		ResetCachedShapes();
 		return;
 	}
 
@@ -93,6 +152,8 @@ void UKawaiiFluidMeshCollider::CacheCollisionShapes()
 	UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(TargetMeshComponent);
 	if (Capsule)
 	{
+		ResetCachedShapes();
+
 		FVector CapsuleCenter = Capsule->GetComponentLocation();
 		float CapsuleRadius = Capsule->GetScaledCapsuleRadius() + CollisionMargin;
 		float CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
@@ -109,460 +170,288 @@ void UKawaiiFluidMeshCollider::CacheCollisionShapes()
 		CachedBounds += CachedCap.End;
 		CachedBounds = CachedBounds.ExpandBy(CapsuleRadius);
 		bCacheValid = true;
+		++ShapeRevision;
 		return;
 	}
 
 	// Handle SkeletalMeshComponent - use PhysicsAsset
 	USkeletalMeshComponent* SkelMesh = Cast<USkeletalMeshComponent>(TargetMeshComponent);
-	if (SkelMesh)
+	if (SkelMesh && CacheSkeletalMeshCollision(SkelMesh))
 	{
-		CacheSkeletalMeshCollision(SkelMesh);
-		if (bCacheValid)
-		{
-			return;
-		}
+		return;
 	}
 
 	// Handle StaticMeshComponent - use Simple Collision
 	UStaticMeshComponent* StaticMesh = Cast<UStaticMeshComponent>(TargetMeshComponent);
-	if (StaticMesh)
+	if (StaticMesh && CacheStaticMeshCollision(StaticMesh))
 	{
-		CacheStaticMeshCollision(StaticMesh);
-		if (bCacheValid)
-		{
-			return;
-		}
+		return;
 	}
 
 	// Fallback: use bounding box
+	ResetCachedShapes();
 	FBoxSphereBounds Bounds = TargetMeshComponent->Bounds;
 	CachedBounds = Bounds.GetBox();
 	bCacheValid = true;
+	++ShapeRevision;
 }
 
 /**
- * @brief Extracts collision shapes from a skeletal mesh's physics asset.
- * @param SkelMesh Skeletal mesh component to extract from
+ * @brief Takes the shared body-space shapes of a mesh asset, resetting per-instance state when they change.
+ * @param Asset Static mesh or physics asset
+ * @return True if the asset has collision shapes
  */
-void UKawaiiFluidMeshCollider::CacheSkeletalMeshCollision(USkeletalMeshComponent* SkelMesh)
+bool UKawaiiFluidMeshCollider::AcquireShapeSet(const UObject* Asset)
 {
-	UPhysicsAsset* PhysAsset = SkelMesh->GetPhysicsAsset();
-	if (!PhysAsset)
+	FKawaiiFluidCollisionShapeCache::FShapeSetPtr Shapes = FKawaiiFluidCollisionShapeCache::Get().FindOrBuild(Asset);
+	if (!Shapes.IsValid() || Shapes->IsEmpty())
 	{
-		return;
+		return false;
 	}
 
-	for (USkeletalBodySetup* BodySetup : PhysAsset->SkeletalBodySetups)
+	if (Shapes != ShapeSet)
 	{
-		if (!BodySetup)
-		{
-			continue;
-		}
-
-		int32 BoneIndex = SkelMesh->GetBoneIndex(BodySetup->BoneName);
-		if (BoneIndex == INDEX_NONE)
-		{
-			continue;
-		}
-
-		FTransform BoneTransform = SkelMesh->GetBoneTransform(BoneIndex);
-
-		// Cache capsules
-		for (const FKSphylElem& SphylElem : BodySetup->AggGeom.SphylElems)
-		{
-			FTransform CapsuleLocalTransform = SphylElem.GetTransform();
-			FTransform CapsuleWorldTransform = CapsuleLocalTransform * BoneTransform;
-
-			FVector CapsuleCenter = CapsuleWorldTransform.GetLocation();
-			float CapsuleRadius = SphylElem.Radius + CollisionMargin;
-			float CapsuleLength = SphylElem.Length;
-			FVector CapsuleUp = CapsuleWorldTransform.GetRotation().GetUpVector();
+		ShapeSet = MoveTemp(Shapes);
+		BodyBoneIndices.Reset();
+		ResolvedSkinnedAsset.Reset();
+		CachedBodyTransforms.Reset();
 
-			float HalfLength = CapsuleLength * 0.5f;
-
-			FCachedCapsule CachedCap;
-			CachedCap.Start = CapsuleCenter - CapsuleUp * HalfLength;
-			CachedCap.End = CapsuleCenter + CapsuleUp * HalfLength;
-			CachedCap.Radius = CapsuleRadius;
-			CachedCap.BoneName = BodySetup->BoneName;
-			CachedCap.BoneTransform = BoneTransform;
-			CachedCap.BoneIndex = BoneIndex;
-
-			CachedCapsules.Add(CachedCap);
-
-			CachedBounds += CachedCap.Start;
-			CachedBounds += CachedCap.End;
-		}
+		// Every body is active until bones are resolved
+		const auto IsActive = [](int32) { return true; };
+		CollectActiveShapes(ShapeSet->Spheres, IsActive, ActiveSphereIndices);
+		CollectActiveShapes(ShapeSet->Capsules, IsActive, ActiveCapsuleIndices);
+		CollectActiveShapes(ShapeSet->Boxes, IsActive, ActiveBoxIndices);
+		CollectActiveShapes(ShapeSet->Convexes, IsActive, ActiveConvexIndices);
+	}
+	return true;
+}
 
-		// Cache spheres
-		for (const FKSphereElem& SphereElem : BodySetup->AggGeom.SphereElems)
-		{
-			FTransform SphereLocalTransform = SphereElem.GetTransform();
-			FTransform SphereWorldTransform = SphereLocalTransform * BoneTransform;
-
-			FCachedSphere CachedSph;
-			CachedSph.Center = SphereWorldTransform.GetLocation();
-			CachedSph.Radius = SphereElem.Radius + CollisionMargin;
-			CachedSph.BoneName = BodySetup->BoneName;
-			CachedSph.BoneTransform = BoneTransform;
-			CachedSph.BoneIndex = BoneIndex;
-			CachedSpheres.Add(CachedSph);
-
-			CachedBounds += CachedSph.Center;
-		}
+/**
+ * @brief Places the collision shapes of a skeletal mesh's physics asset at the current bone transforms.
+ * @param SkelMesh Skeletal mesh component to extract from
+ * @return True if any shape is cached
+ */
+bool UKawaiiFluidMeshCollider::CacheSkeletalMeshCollision(USkeletalMeshComponent* SkelMesh)
+{
+	UPhysicsAsset* PhysAsset = SkelMesh->GetPhysicsAsset();
+	if (!PhysAsset || !AcquireShapeSet(PhysAsset))
+	{
+		return false;
+	}
 
-		// Cache boxes
-		for (const FKBoxElem& BoxElem : BodySetup->AggGeom.BoxElems)
+	// Bone indices depend on the skeletal mesh, not the physics asset; bodies without a bone are skipped
+	const UObject* SkinnedAsset = SkelMesh->GetSkinnedAsset();
+	if (ResolvedSkinnedAsset.Get() != SkinnedAsset || BodyBoneIndices.Num() != ShapeSet->BodyBoneNames.Num())
+	{
+		BodyBoneIndices.SetNum(ShapeSet->BodyBoneNames.Num());
+		for (int32 BodyIndex = 0; BodyIndex < BodyBoneIndices.Num(); ++BodyIndex)
 		{
-			FTransform BoxLocalTransform = BoxElem.GetTransform();
-			FTransform BoxWorldTransform = BoxLocalTransform * BoneTransform;
-
-			FCachedBox CachedBx;
-			CachedBx.Center = BoxWorldTransform.GetLocation();
-			CachedBx.Extent = FVector(BoxElem.X * 0.5f + CollisionMargin,
-			                          BoxElem.Y * 0.5f + CollisionMargin,
-			                          BoxElem.Z * 0.5f + CollisionMargin);
-			CachedBx.Rotation = BoxWorldTransform.GetRotation();
-			CachedBx.BoneName = BodySetup->BoneName;
-			CachedBx.BoneTransform = BoneTransform;
-			CachedBx.BoneIndex = BoneIndex;
-			CachedBoxes.Add(CachedBx);
-
-			// Add 8 box corners to expand bounding box
-			for (int32 CornerIdx = 0; CornerIdx < 8; ++CornerIdx)
-			{
-				FVector LocalCorner(
-					(CornerIdx & 1) ? CachedBx.Extent.X : -CachedBx.Extent.X,
-					(CornerIdx & 2) ? CachedBx.Extent.Y : -CachedBx.Extent.Y,
-					(CornerIdx & 4) ? CachedBx.Extent.Z : -CachedBx.Extent.Z
-				);
-				FVector WorldCorner = CachedBx.Center + CachedBx.Rotation.RotateVector(LocalCorner);
-				CachedBounds += WorldCorner;
-			}
+			BodyBoneIndices[BodyIndex] = SkelMesh->GetBoneIndex(ShapeSet->BodyBoneNames[BodyIndex]);
 		}
+		ResolvedSkinnedAsset = SkinnedAsset;
+		CachedBodyTransforms.Reset();
 
-		// Cache convex hulls
-		for (const FKConvexElem& ConvexElem : BodySetup->AggGeom.ConvexElems)
-		{
-			FCachedConvex CachedCvx;
-			CachedCvx.BoneName = BodySetup->BoneName;
-			CachedCvx.BoneTransform = BoneTransform;
-			CachedCvx.BoneIndex = BoneIndex;
-
-			const TArray<FVector>& VertexData = ConvexElem.VertexData;
-			if (VertexData.Num() < 4)
-			{
-				continue;
-			}
-
-			TArray<FVector> WorldVerts;
-			WorldVerts.Reserve(VertexData.Num());
-			FVector CenterSum = FVector::ZeroVector;
-			for (const FVector& V : VertexData)
-			{
-				FVector WorldV = BoneTransform.TransformPosition(V);
-				WorldVerts.Add(WorldV);
-				CenterSum += WorldV;
-			}
-
-			CachedCvx.Center = CenterSum / static_cast<float>(WorldVerts.Num());
-
-			float MaxDistSq = 0.0f;
-			for (const FVector& V : WorldVerts)
-			{
-				float DistSq = FVector::DistSquared(V, CachedCvx.Center);
-				MaxDistSq = FMath::Max(MaxDistSq, DistSq);
-				CachedBounds += V;
-			}
-			CachedCvx.BoundingRadius = FMath::Sqrt(MaxDistSq) + CollisionMargin;
-
-			const TArray<int32>& IndexData = ConvexElem.IndexData;
-			if (IndexData.Num() >= 3)
-			{
-				TSet<uint32> PlaneHashes;
-				for (int32 i = 0; i + 2 < IndexData.Num(); i += 3)
-				{
-					int32 I0 = IndexData[i];
-					int32 I1 = IndexData[i + 1];
-					int32 I2 = IndexData[i + 2];
-
-					if (I0 < WorldVerts.Num() && I1 < WorldVerts.Num() && I2 < WorldVerts.Num())
-					{
-						FVector V0 = WorldVerts[I0];
-						FVector V1 = WorldVerts[I1];
-						FVector V2 = WorldVerts[I2];
-
-						FVector Edge1 = V1 - V0;
-						FVector Edge2 = V2 - V0;
-						FVector Normal = FVector::CrossProduct(Edge1, Edge2);
-						float NormalLen = Normal.Size();
-
-						if (NormalLen > KINDA_SMALL_NUMBER)
-						{
-							Normal /= NormalLen;
-
-							FVector ToCenter = CachedCvx.Center - V0;
-							if (FVector::DotProduct(Normal, ToCenter) > 0)
-							{
-								Normal = -Normal;
-							}
-
-							int32 Nx = FMath::RoundToInt(Normal.X * 1000.0f);
-							int32 Ny = FMath::RoundToInt(Normal.Y * 1000.0f);
-							int32 Nz = FMath::RoundToInt(Normal.Z * 1000.0f);
-							uint32 Hash = HashCombine(HashCombine(GetTypeHash(Nx), GetTypeHash(Ny)), GetTypeHash(Nz));
-
-							if (!PlaneHashes.Contains(Hash))
-							{
-								PlaneHashes.Add(Hash);
-
-								FCachedConvexPlane Plane;
-								Plane.Normal = Normal;
-								Plane.Distance = FVector::DotProduct(V0, Normal);
-								CachedCvx.Planes.Add(Plane);
-							}
-						}
-					}
-				}
-			}
-
-			if (CachedCvx.Planes.Num() < 4)
-			{
-				TArray<FPlane> ChaosPlanes;
-				ConvexElem.GetPlanes(ChaosPlanes);
-
-				if (ChaosPlanes.Num() >= 4)
-				{
-					CachedCvx.Planes.Reset();
-
-					for (const FPlane& ChaosPlane : ChaosPlanes)
-					{
-						const FVector LocalNormal = FVector(ChaosPlane.X, ChaosPlane.Y, ChaosPlane.Z);
-						const FVector WorldNormal = BoneTransform.TransformVectorNoScale(LocalNormal);
-						const FVector LocalPoint = LocalNormal * ChaosPlane.W;
-						const FVector WorldPoint = BoneTransform.TransformPosition(LocalPoint);
-						
-						FCachedConvexPlane Plane;
-						Plane.Normal = WorldNormal;
-						Plane.Distance = FVector::DotProduct(WorldPoint, WorldNormal);
-						CachedCvx.Planes.Add(Plane);
-					}
-				}
-			}
-
-			if (CachedCvx.Planes.Num() >= 4)
-			{
-				CachedConvexes.Add(MoveTemp(CachedCvx));
-			}
-		}
+		const auto IsActive = [this](int32 BodyIndex) { return BodyBoneIndices[BodyIndex] != INDEX_NONE; };
+		CollectActiveShapes(ShapeSet->Spheres, IsActive, ActiveSphereIndices);
+		CollectActiveShapes(ShapeSet->Capsules, IsActive, ActiveCapsuleIndices);
+		CollectActiveShapes(ShapeSet->Boxes, IsActive, ActiveBoxIndices);
+		CollectActiveShapes(ShapeSet->Convexes, IsActive, ActiveConvexIndices);
 	}
 
-	if (CachedCapsules.Num() > 0 || CachedSpheres.Num() > 0 || CachedBoxes.Num() > 0 || CachedConvexes.Num() > 0)
+	ScratchBodyTransforms.SetNum(BodyBoneIndices.Num(), EAllowShrinking::No);
+	for (int32 BodyIndex = 0; BodyIndex < BodyBoneIndices.Num(); ++BodyIndex)
 	{
-		float MaxRadius = CollisionMargin;
-		for (const FCachedCapsule& Cap : CachedCapsules) MaxRadius = FMath::Max(MaxRadius, Cap.Radius);
-		for (const FCachedSphere& Sph : CachedSpheres) MaxRadius = FMath::Max(MaxRadius, Sph.Radius);
-		for (const FCachedBox& Box : CachedBoxes) MaxRadius = FMath::Max(MaxRadius, Box.Extent.GetMax());
-		for (const FCachedConvex& Cvx : CachedConvexes) MaxRadius = FMath::Max(MaxRadius, Cvx.BoundingRadius);
-		CachedBounds = CachedBounds.ExpandBy(MaxRadius);
-		bCacheValid = true;
+		const int32 BoneIndex = BodyBoneIndices[BodyIndex];
+		ScratchBodyTransforms[BodyIndex] = BoneIndex != INDEX_NONE ? SkelMesh->GetBoneTransform(BoneIndex) : FTransform::Identity;
 	}
+
+	return UpdateWorldShapes(ScratchBodyTransforms, false);
 }
 
 /**
- * @brief Extracts collision shapes from a static mesh's simple collision.
+ * @brief Places the simple collision of a static mesh at the component transform.
  * @param StaticMesh Static mesh component to extract from
+ * @return True if any shape is cached
  */
-void UKawaiiFluidMeshCollider::CacheStaticMeshCollision(UStaticMeshComponent* StaticMesh)
+bool UKawaiiFluidMeshCollider::CacheStaticMeshCollision(UStaticMeshComponent* StaticMesh)
 {
 	UStaticMesh* Mesh = StaticMesh->GetStaticMesh();
-	if (!Mesh)
+	if (!Mesh || !AcquireShapeSet(Mesh))
 	{
-		return;
+		return false;
 	}
 
-	UBodySetup* BodySetup = Mesh->GetBodySetup();
-	if (!BodySetup)
-	{
-		return;
-	}
-
-	FTransform ComponentTransform = StaticMesh->GetComponentTransform();
-
-	// Cache spheres
-	for (const FKSphereElem& SphereElem : BodySetup->AggGeom.SphereElems)
-	{
-		FTransform SphereLocalTransform = SphereElem.GetTransform();
-		FTransform SphereWorldTransform = SphereLocalTransform * ComponentTransform;
+	ScratchBodyTransforms.Reset();
+	ScratchBodyTransforms.Add(StaticMesh->GetComponentTransform());
 
-		FCachedSphere CachedSph;
-		CachedSph.Center = SphereWorldTransform.GetLocation();
-		CachedSph.Radius = SphereElem.Radius * ComponentTransform.GetScale3D().GetMax() + CollisionMargin;
-		CachedSph.BoneName = NAME_None;
-		CachedSph.BoneTransform = ComponentTransform;
-		CachedSpheres.Add(CachedSph);
+	return UpdateWorldShapes(ScratchBodyTransforms, true);
+}
 
-		CachedBounds += CachedSph.Center;
-	}
+/**
+ * @brief Transforms the active body-space shapes into the persistent world-space arrays.
+ * 
+ * Skipped when every body transform and the margin match the last build, so resting colliders cost one
+ * comparison per body. Capsules, spheres and boxes scale with the body only for static meshes (bBodyScalesShapes);
+ * convexes always follow the full body transform.
+ * @param BodyTransforms World transform per body of ShapeSet
+ * @param bBodyScalesShapes Apply the body scale to radii, lengths and extents
+ * @return True if any shape is cached
+ */
+bool UKawaiiFluidMeshCollider::UpdateWorldShapes(const TArray<FTransform>& BodyTransforms, bool bBodyScalesShapes)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidMeshCollider_UpdateWorldShapes);
 
-	// Cache capsules
-	for (const FKSphylElem& SphylElem : BodySetup->AggGeom.SphylElems)
+	const int32 NumActiveShapes = ActiveSphereIndices.Num() + ActiveCapsuleIndices.Num() + ActiveBoxIndices.Num() + ActiveConvexIndices.Num();
+	if (NumActiveShapes == 0)
 	{
-		FTransform CapsuleLocalTransform = SphylElem.GetTransform();
-		FTransform CapsuleWorldTransform = CapsuleLocalTransform * ComponentTransform;
-
-		FVector CapsuleCenter = CapsuleWorldTransform.GetLocation();
-		FVector3d Scale = ComponentTransform.GetScale3D();
-		float ScaledRadius = SphylElem.Radius * FMath::Max(Scale.X, Scale.Y) + CollisionMargin;
-		float ScaledLength = SphylElem.Length * Scale.Z;
-		FVector CapsuleUp = CapsuleWorldTransform.GetRotation().GetUpVector();
-
-		float HalfLength = ScaledLength * 0.5f;
-
-		FCachedCapsule CachedCap;
-		CachedCap.Start = CapsuleCenter - CapsuleUp * HalfLength;
-		CachedCap.End = CapsuleCenter + CapsuleUp * HalfLength;
-		CachedCap.Radius = ScaledRadius;
-		CachedCap.BoneName = NAME_None;
-		CachedCap.BoneTransform = ComponentTransform;
-		CachedCapsules.Add(CachedCap);
-
-		CachedBounds += CachedCap.Start;
-		CachedBounds += CachedCap.End;
+		return false;
 	}
 
-	// Cache boxes
-	for (const FKBoxElem& BoxElem : BodySetup->AggGeom.BoxElems)
+	if (bCacheValid && CachedMargin == CollisionMargin && CachedBodyTransforms.Num() == BodyTransforms.Num())
 	{
-		FTransform BoxLocalTransform = BoxElem.GetTransform();
-		FTransform BoxWorldTransform = BoxLocalTransform * ComponentTransform;
-
-		FVector3d Scale = ComponentTransform.GetScale3D();
-
-		FCachedBox CachedBx;
-		CachedBx.Center = BoxWorldTransform.GetLocation();
-		CachedBx.Extent = FVector(BoxElem.X * 0.5f * Scale.X + CollisionMargin,
-		                          BoxElem.Y * 0.5f * Scale.Y + CollisionMargin,
-		                          BoxElem.Z * 0.5f * Scale.Z + CollisionMargin);
-		CachedBx.Rotation = BoxWorldTransform.GetRotation();
-		CachedBx.BoneName = NAME_None;
-		CachedBx.BoneTransform = ComponentTransform;
-
-		CachedBoxes.Add(CachedBx);
+		bool bMoved = false;
+		for (int32 BodyIndex = 0; BodyIndex < BodyTransforms.Num() && !bMoved; ++BodyIndex)
+		{
+			bMoved = !BodyTransforms[BodyIndex].Equals(CachedBodyTransforms[BodyIndex], BodyTransformTolerance);
+		}
 
-		for (int32 CornerIdx = 0; CornerIdx < 8; ++CornerIdx)
+		if (!bMoved)
 		{
-			FVector LocalCorner(
-				(CornerIdx & 1) ? CachedBx.Extent.X : -CachedBx.Extent.X,
-				(CornerIdx & 2) ? CachedBx.Extent.Y : -CachedBx.Extent.Y,
-				(CornerIdx & 4) ? CachedBx.Extent.Z : -CachedBx.Extent.Z
-			);
-			FVector WorldCorner = CachedBx.Center + CachedBx.Rotation.RotateVector(LocalCorner);
-			CachedBounds += WorldCorner;
+			return true;
 		}
 	}
 
-	// Cache convex hulls
-	for (const FKConvexElem& ConvexElem : BodySetup->AggGeom.ConvexElems)
-	{
-		FCachedConvex CachedCvx;
-		CachedCvx.BoneName = NAME_None;
-		CachedCvx.BoneTransform = ComponentTransform;
+	CachedBodyTransforms = BodyTransforms;
+	CachedMargin = CollisionMargin;
 
-		const TArray<FVector>& VertexData = ConvexElem.VertexData;
-		if (VertexData.Num() < 4) continue;
+	const FKawaiiFluidCollisionShapeSet& Shapes = *ShapeSet;
+	const float Margin = CollisionMargin;
+	const bool bSingleThreaded = NumActiveShapes < MinShapesForParallelTransform;
 
-		TArray<FVector> WorldVerts;
-		WorldVerts.Reserve(VertexData.Num());
-		FVector CenterSum = FVector::ZeroVector;
-		for (const FVector& V : VertexData)
-		{
-			FVector WorldV = ComponentTransform.TransformPosition(V);
-			WorldVerts.Add(WorldV);
-			CenterSum += WorldV;
-		}
-
-		CachedCvx.Center = CenterSum / static_cast<float>(WorldVerts.Num());
+	const auto GetBoneIndex = [this](int32 BodyIndex)
+	{
+		return BodyBoneIndices.IsValidIndex(BodyIndex) ? BodyBoneIndices[BodyIndex] : INDEX_NONE;
+	};
+	const auto GetShapeScale = [bBodyScalesShapes](const FTransform& Body)
+	{
+		return bBodyScalesShapes ? Body.GetScale3D().GetAbs() : FVector::OneVector;
+	};
 
-		float MaxDistSq = 0.0f;
-		for (const FVector& V : WorldVerts)
+	CachedSpheres.SetNum(ActiveSphereIndices.Num());
+	ParallelFor(ActiveSphereIndices.Num(), [&](int32 i)
+	{
+		const FKawaiiFluidLocalSphere& Local = Shapes.Spheres[ActiveSphereIndices[i]];
+		const FTransform& Body = BodyTransforms[Local.BodyIndex];
+
+		FCachedSphere& Sph = CachedSpheres[i];
+		Sph.Center = Body.TransformPosition(Local.Center);
+		Sph.Radius = Local.Radius * GetShapeScale(Body).GetMax() + Margin;
+		Sph.BoneName = Shapes.BodyBoneNames[Local.BodyIndex];
+		Sph.BoneTransform = Body;
+		Sph.BoneIndex = GetBoneIndex(Local.BodyIndex);
+	}, bSingleThreaded);
+
+	CachedCapsules.SetNum(ActiveCapsuleIndices.Num());
+	ParallelFor(ActiveCapsuleIndices.Num(), [&](int32 i)
+	{
+		const FKawaiiFluidLocalCapsule& Local = Shapes.Capsules[ActiveCapsuleIndices[i]];
+		const FTransform& Body = BodyTransforms[Local.BodyIndex];
+		const FVector Scale = GetShapeScale(Body);
+
+		const FVector CapsuleCenter = Body.TransformPosition(Local.Center);
+		const FVector CapsuleUp = Body.GetRotation().RotateVector(Local.Axis);
+		const float HalfLength = Local.HalfLength * Scale.Z;
+
+		FCachedCapsule& Cap = CachedCapsules[i];
+		Cap.Start = CapsuleCenter - CapsuleUp * HalfLength;
+		Cap.End = CapsuleCenter + CapsuleUp * HalfLength;
+		Cap.Radius = Local.Radius * FMath::Max(Scale.X, Scale.Y) + Margin;
+		Cap.BoneName = Shapes.BodyBoneNames[Local.BodyIndex];
+		Cap.BoneTransform = Body;
+		Cap.BoneIndex = GetBoneIndex(Local.BodyIndex);
+	}, bSingleThreaded);
+
+	CachedBoxes.SetNum(ActiveBoxIndices.Num());
+	ParallelFor(ActiveBoxIndices.Num(), [&](int32 i)
+	{
+		const FKawaiiFluidLocalBox& Local = Shapes.Boxes[ActiveBoxIndices[i]];
+		const FTransform& Body = BodyTransforms[Local.BodyIndex];
+
+		FCachedBox& Bx = CachedBoxes[i];
+		Bx.Center = Body.TransformPosition(Local.Center);
+		Bx.Extent = Local.HalfExtent * GetShapeScale(Body) + FVector(Margin);
+		Bx.Rotation = Body.GetRotation() * Local.Rotation;
+		Bx.BoneName = Shapes.BodyBoneNames[Local.BodyIndex];
+		Bx.BoneTransform = Body;
+		Bx.BoneIndex = GetBoneIndex(Local.BodyIndex);
+	}, bSingleThreaded);
+
+	CachedConvexes.SetNum(ActiveConvexIndices.Num());
+	ParallelFor(ActiveConvexIndices.Num(), [&](int32 i)
+	{
+		const FKawaiiFluidLocalConvex& Local = Shapes.Convexes[ActiveConvexIndices[i]];
+		const FTransform& Body = BodyTransforms[Local.BodyIndex];
+		const FQuat BodyRotation = Body.GetRotation();
+		const FVector InvScale = FTransform::GetSafeScaleReciprocal(Body.GetScale3D());
+
+		FCachedConvex& Cvx = CachedConvexes[i];
+		Cvx.Center = Body.TransformPosition(Local.Center);
+		Cvx.BoundingRadius = Local.BoundingRadius * Body.GetScale3D().GetAbsMax() + Margin;
+		Cvx.BoneName = Shapes.BodyBoneNames[Local.BodyIndex];
+		Cvx.BoneTransform = Body;
+		Cvx.BoneIndex = GetBoneIndex(Local.BodyIndex);
+
+		// Normals transform by the inverse transpose (inverse scale), points by the full transform
+		Cvx.Planes.SetNum(Local.PlaneCount, EAllowShrinking::No);
+		for (int32 PlaneIndex = 0; PlaneIndex < Local.PlaneCount; ++PlaneIndex)
 		{
-			float DistSq = FVector::DistSquared(V, CachedCvx.Center);
-			MaxDistSq = FMath::Max(MaxDistSq, DistSq);
-			CachedBounds += V;
-		}
-		CachedCvx.BoundingRadius = FMath::Sqrt(MaxDistSq) + CollisionMargin;
+			const FKawaiiFluidLocalPlane& LocalPlane = Shapes.ConvexPlanes[Local.PlaneStart + PlaneIndex];
+			const FVector WorldNormal = BodyRotation.RotateVector(LocalPlane.Normal * InvScale).GetSafeNormal();
+			const FVector WorldPoint = Body.TransformPosition(LocalPlane.Normal * LocalPlane.Distance);
 
-		const TArray<int32>& IndexData = ConvexElem.IndexData;
-		if (IndexData.Num() >= 3)
-		{
-			TSet<uint32> PlaneHashes;
-			for (int32 i = 0; i + 2 < IndexData.Num(); i += 3)
-			{
-				int32 I0 = IndexData[i], I1 = IndexData[i + 1], I2 = IndexData[i + 2];
-				if (I0 < WorldVerts.Num() && I1 < WorldVerts.Num() && I2 < WorldVerts.Num())
-				{
-					FVector V0 = WorldVerts[I0], V1 = WorldVerts[I1], V2 = WorldVerts[I2];
-					FVector Edge1 = V1 - V0, Edge2 = V2 - V0;
-					FVector Normal = FVector::CrossProduct(Edge1, Edge2);
-					float NormalLen = Normal.Size();
-
-					if (NormalLen > KINDA_SMALL_NUMBER)
-					{
-						Normal /= NormalLen;
-						FVector ToCenter = CachedCvx.Center - V0;
-						if (FVector::DotProduct(Normal, ToCenter) > 0) Normal = -Normal;
-
-						int32 Nx = FMath::RoundToInt(Normal.X * 1000.0f), Ny = FMath::RoundToInt(Normal.Y * 1000.0f), Nz = FMath::RoundToInt(Normal.Z * 1000.0f);
-						uint32 Hash = HashCombine(HashCombine(GetTypeHash(Nx), GetTypeHash(Ny)), GetTypeHash(Nz));
-
-						if (!PlaneHashes.Contains(Hash))
-						{
-							PlaneHashes.Add(Hash);
-							FCachedConvexPlane Plane;
-							Plane.Normal = Normal;
-							Plane.Distance = FVector::DotProduct(V0, Normal);
-							CachedCvx.Planes.Add(Plane);
-						}
-					}
-				}
-			}
+			FCachedConvexPlane& Plane = Cvx.Planes[PlaneIndex];
+			Plane.Normal = WorldNormal;
+			Plane.Distance = FVector::DotProduct(WorldPoint, WorldNormal);
 		}
+	}, bSingleThreaded);
 
-		if (CachedCvx.Planes.Num() < 4)
+	// Bounds of shape centers and segments, expanded by the largest shape
+	CachedBounds = FBox(ForceInit);
+	float MaxRadius = Margin;
+	for (const FCachedCapsule& Cap : CachedCapsules)
+	{
+		CachedBounds += Cap.Start;
+		CachedBounds += Cap.End;
+		MaxRadius = FMath::Max(MaxRadius, Cap.Radius);
+	}
+	for (const FCachedSphere& Sph : CachedSpheres)
+	{
+		CachedBounds += Sph.Center;
+		MaxRadius = FMath::Max(MaxRadius, Sph.Radius);
+	}
+	for (const FCachedBox& Box : CachedBoxes)
+	{
+		for (int32 CornerIdx = 0; CornerIdx < 8; ++CornerIdx)
 		{
-			TArray<FPlane> ChaosPlanes;
-			ConvexElem.GetPlanes(ChaosPlanes);
-			if (ChaosPlanes.Num() >= 4)
-			{
-				CachedCvx.Planes.Reset();
-				for (const FPlane& ChaosPlane : ChaosPlanes)
-				{
-					const FVector LocalNormal = FVector(ChaosPlane.X, ChaosPlane.Y, ChaosPlane.Z);
-					const FVector WorldNormal = ComponentTransform.TransformVectorNoScale(LocalNormal);
-					const FVector LocalPoint = LocalNormal * ChaosPlane.W;
-					const FVector WorldPoint = ComponentTransform.TransformPosition(LocalPoint);
-					FCachedConvexPlane Plane;
-					Plane.Normal = WorldNormal;
-					Plane.Distance = FVector::DotProduct(WorldPoint, WorldNormal);
-					CachedCvx.Planes.Add(Plane);
-				}
-			}
+			FVector LocalCorner(
+				(CornerIdx & 1) ? Box.Extent.X : -Box.Extent.X,
+				(CornerIdx & 2) ? Box.Extent.Y : -Box.Extent.Y,
+				(CornerIdx & 4) ? Box.Extent.Z : -Box.Extent.Z
+			);
+			CachedBounds += Box.Center + Box.Rotation.RotateVector(LocalCorner);
 		}
-
-		if (CachedCvx.Planes.Num() >= 4) CachedConvexes.Add(MoveTemp(CachedCvx));
+		MaxRadius = FMath::Max(MaxRadius, Box.Extent.GetMax());
 	}
-
-	if (CachedCapsules.Num() > 0 || CachedSpheres.Num() > 0 || CachedBoxes.Num() > 0 || CachedConvexes.Num() > 0)
+	for (const FCachedConvex& Cvx : CachedConvexes)
 	{
-		float MaxRadius = CollisionMargin;
-		for (const FCachedCapsule& Cap : CachedCapsules) MaxRadius = FMath::Max(MaxRadius, Cap.Radius);
-		for (const FCachedSphere& Sph : CachedSpheres) MaxRadius = FMath::Max(MaxRadius, Sph.Radius);
-		for (const FCachedBox& Box : CachedBoxes) MaxRadius = FMath::Max(MaxRadius, Box.Extent.GetMax());
-		for (const FCachedConvex& Cvx : CachedConvexes) MaxRadius = FMath::Max(MaxRadius, Cvx.BoundingRadius);
-		CachedBounds = CachedBounds.ExpandBy(MaxRadius);
-		bCacheValid = true;
+		CachedBounds += Cvx.Center;
+		MaxRadius = FMath::Max(MaxRadius, Cvx.BoundingRadius);
 	}
+	CachedBounds = CachedBounds.ExpandBy(MaxRadius);
+
+	bCacheValid = true;
+	++ShapeRevision;
+	return true;
 }
 
 /**
@@ -54,6 +54,76 @@ static FAutoConsoleVariableRef CVarFluidCaptureFrameNumber(
 // Internal flag - reset when CVar is changed back to 1
 static int32 GFluidCapturedFrame = 0;  // Tracks which frame was captured (0 = none)
 
+// =====================================================
+// Lazy Capacity CVars
+// =====================================================
+static int32 GFluidLazyCapacity = 1;
+static FAutoConsoleVariableRef CVarFluidLazyCapacity(
+	TEXT("r.Fluid.LazyCapacity"),
+	GFluidLazyCapacity,
+	TEXT("Grow GPU particle buffers on demand instead of allocating MaxParticleCount up front.\n")
+	TEXT("  0 = Allocate MaxParticleCount at initialization\n")
+	TEXT("  1 = Geometric growth on demand (default)"),
+	ECVF_Default
+);
+
+static int32 GFluidLazyCapacityInitial = 8192;
+static FAutoConsoleVariableRef CVarFluidLazyCapacityInitial(
+	TEXT("r.Fluid.LazyCapacity.Initial"),
+	GFluidLazyCapacityInitial,
+	TEXT("Initial particle capacity when lazy capacity growth is enabled (default 8192)."),
+	ECVF_Default
+);
+
+static float GFluidLazyCapacityGrowthFactor = 2.0f;
+static FAutoConsoleVariableRef CVarFluidLazyCapacityGrowthFactor(
+	TEXT("r.Fluid.LazyCapacity.GrowthFactor"),
+	GFluidLazyCapacityGrowthFactor,
+	TEXT("Capacity multiplier applied each time particle buffers grow (default 2.0, min 1.25)."),
+	ECVF_Default
+);
+
+static int32 GFluidLazyCapacityShrinkFrames = 600;
+static FAutoConsoleVariableRef CVarFluidLazyCapacityShrinkFrames(
+	TEXT("r.Fluid.LazyCapacity.ShrinkFrames"),
+	GFluidLazyCapacityShrinkFrames,
+	TEXT("Consecutive frames below 25% occupancy before buffers shrink to twice the live count.\n")
+	TEXT("  0 = Never shrink\n")
+	TEXT("  N = Shrink after N frames (default 600)"),
+	ECVF_Default
+);
+
+// Capacity is kept a multiple of the spawn/compaction thread group size
+static constexpr int32 GFluidCapacityAlignment = 256;
+
+// =====================================================
+// Packed Readback CVars
+// =====================================================
+static int32 GFluidReadbackQuantize = 1;
+static FAutoConsoleVariableRef CVarFluidReadbackQuantize(
+	TEXT("r.Fluid.Readback.Quantize"),
+	GFluidReadbackQuantize,
+	TEXT("Allow 16-bit positions (relative to simulation bounds) and half velocities in packed readbacks\n")
+	TEXT("when every consumer of the field accepts them.\n")
+	TEXT("  0 = Always full precision\n")
+	TEXT("  1 = Quantize when accepted (default)"),
+	ECVF_Default
+);
+
+// =====================================================
+// Streaming Upload CVars
+// =====================================================
+static int32 GFluidStreamingUpload = 1;
+static FAutoConsoleVariableRef CVarFluidStreamingUpload(
+	TEXT("r.Fluid.StreamingUpload"),
+	GFluidStreamingUpload,
+	TEXT("How initial particle sets (level load, PIE transition) reach the GPU.\n")
+	TEXT("  0 = Convert and upload everything at once, rebuilding the particle buffer\n")
+	TEXT("  1 = Convert in parallel into upload chunks appended over several frames (default)\n")
+	TEXT("      (per-frame budget: r.Fluid.StreamingUploadBudgetKB)"),
+	ECVF_Default
+);
+
 //=============================================================================
 // Constructor / Destructor
 //=============================================================================
@@ -92,10 +162,13 @@ void FGPUFluidSimulator::Initialize(int32 InMaxParticleCount)
 	}
 
 	MaxParticleCount = InMaxParticleCount;
+	AllocatedCapacity.store(GFluidLazyCapacity != 0 ? ComputeGrownCapacity(0, 1) : MaxParticleCount);
+	LowOccupancyFrames = 0;
 
 	// Initialize SpawnManager
 	SpawnManager = MakeUnique<FGPUSpawnManager>();
 	SpawnManager->Initialize(InMaxParticleCount);
+	SpawnManager->SetParticleCapacity(AllocatedCapacity.load());
 
 	// Initialize CollisionManager
 	CollisionManager = MakeUnique<FGPUCollisionManager>();
@@ -122,7 +195,8 @@ void FGPUFluidSimulator::Initialize(int32 InMaxParticleCount)
 
 	bIsInitialized = true;
 
-	UE_LOG(LogGPUFluidSimulator, Log, TEXT("GPU Fluid Simulator initialized with capacity: %d particles"), MaxParticleCount);
+	UE_LOG(LogGPUFluidSimulator, Log, TEXT("GPU Fluid Simulator initialized with capacity: %d particles (allocated: %d)"),
+		MaxParticleCount, AllocatedCapacity.load());
 }
 
 /**
@@ -184,11 +258,8 @@ void FGPUFluidSimulator::Release()
 	// Release Anisotropy Readback objects
 	ReleaseAnisotropyReadbackObjects();
 
-	// Clear Shadow data (extracted from StatsReadback)
-	ReadyShadowPositions.Empty();
-	ReadyShadowVelocities.Empty();
-	ReadyShadowNeighborCounts.Empty();
-	ReadyShadowPositionsFrame.store(0);
+	// Unpublish readback snapshots (views still held elsewhere keep their slot alive)
+	ReadbackSnapshots.Clear();
 
 	// Release Stats Readback objects
 	ReleaseStatsReadbackObjects();
@@ -214,6 +285,8 @@ void FGPUFluidSimulator::Release()
 
 	bIsInitialized = false;
 	MaxParticleCount = 0;
+	AllocatedCapacity.store(0);
+	LowOccupancyFrames = 0;
 	CurrentParticleCount = 0;
 	bHasValidGPUResults.store(false);
 	CachedGPUParticles.Empty();
@@ -233,7 +306,7 @@ void FGPUFluidSimulator::InitRHI(FRHICommandListBase& RHICmdList)
 		return;
 	}
 
-	ResizeBuffers(RHICmdList, MaxParticleCount);
+	ResizeBuffers(RHICmdList, AllocatedCapacity.load());
 }
 
 void FGPUFluidSimulator::ReleaseRHI()
@@ -418,9 +491,13 @@ void FGPUFluidSimulator::SimulateSubstep(const FGPUFluidSimulationParams& Params
 	FGPUFluidSimulator* Self = this;
 	FGPUFluidSimulationParams ParamsCopy = Params;
 
+	// First substep of a simulation tick snapshots positions for render interpolation
+	const bool bCaptureTickStart = bCaptureTickStartPending;
+	bCaptureTickStartPending = false;
+
 	// Execute simulation directly in render command
 	ENQUEUE_RENDER_COMMAND(GPUFluidSimulate)(
-		[Self, ParamsCopy](FRHICommandListImmediate& RHICmdList)
+		[Self, ParamsCopy, bCaptureTickStart](FRHICommandListImmediate& RHICmdList)
 		{
 			// Limit logging to first 10 frames
 			static int32 RenderFrameCounter = 0;
@@ -430,7 +507,7 @@ void FGPUFluidSimulator::SimulateSubstep(const FGPUFluidSimulationParams& Params
 
 			// Build and execute RDG
 			FRDGBuilder GraphBuilder(RHICmdList);
-			Self->SimulateSubstep_RDG(GraphBuilder, ParamsCopy);
+			Self->SimulateSubstep_RDG(GraphBuilder, ParamsCopy, bCaptureTickStart);
 
 			// if (bLogThisFrame) UE_LOG(LogGPUFluidSimulator, Log, TEXT(">>> RDG EXECUTE START"));
 			GraphBuilder.Execute();
@@ -500,7 +577,7 @@ void FGPUFluidSimulator::ExecutePendingSimulations_RenderThread(FRDGBuilder& Gra
 	bHasValidGPUResults.store(true);
 }
 
-void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FGPUFluidSimulationParams& Params)
+void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FGPUFluidSimulationParams& Params, bool bCaptureTickStart)
 {
 	// Spawn/despawn handled in BeginFrame - this is physics only
 
@@ -531,8 +608,8 @@ void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FG
 	// Register IndirectArgs buffer for DispatchIndirect
 	CurrentIndirectArgsBuffer = RegisterParticleCountBuffer(GraphBuilder);
 
-	// Pre-allocate transient buffers to MaxParticleCount to avoid D3D12 pool allocation hitches
-	const int32 AllocParticleCount = MaxParticleCount > 0 ? MaxParticleCount : CurrentParticleCount;
+	// Size transient buffers to the allocated capacity (stable between growth steps, avoids pool hitches)
+	const int32 AllocParticleCount = GetParticleAllocCount();
 
 	// =====================================================
 	// Phase 1: Prepare Particle Buffer (CPU Upload or Reuse)
@@ -552,6 +629,32 @@ void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FG
 	FRDGBufferUAVRef PositionsUAVLocal = GraphBuilder.CreateUAV(PositionBuffer);
 	FRDGBufferSRVRef PositionsSRVLocal = GraphBuilder.CreateSRV(PositionBuffer);
 
+	// =====================================================
+	// Phase 1.2: Render Interpolation Source
+	// Tick-start positions are captured on the first substep of a simulation tick
+	// and reordered with particles by every Z-Order sort until the next capture.
+	// =====================================================
+	CurrentPreviousPositionsBuffer = nullptr;
+	if (!bRenderInterpolationEnabled.load())
+	{
+		if (PreviousPositionsBuffer.IsValid())
+		{
+			InvalidatePreviousPositions();
+		}
+	}
+	else if (bCaptureTickStart)
+	{
+		FRDGBufferDesc PreviousPositionsDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), GetParticleAllocCount());
+		CurrentPreviousPositionsBuffer = GraphBuilder.CreateBuffer(PreviousPositionsDesc, TEXT("GPUFluidPreviousPositions"));
+		AddExtractPositionsPass(GraphBuilder, ParticlesSRVLocal, GraphBuilder.CreateUAV(CurrentPreviousPositionsBuffer), CurrentParticleCount, false);
+		PreviousPositionsCount = CurrentParticleCount;
+		bPreviousPositionsValid = true;
+	}
+	else if (bPreviousPositionsValid && PreviousPositionsBuffer.IsValid())
+	{
+		CurrentPreviousPositionsBuffer = GraphBuilder.RegisterExternalBuffer(PreviousPositionsBuffer, TEXT("GPUFluidPreviousPositions"));
+	}
+
 	// =====================================================
 	// Phase 1.5: Bone Delta Attachment - Apply Bone Transform (SIMULATION START)
 	// Moves attached particles to follow bone positions.
@@ -577,12 +680,17 @@ void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FG
 		}
 	}
 
+	// Bones of this substep: one snapshot pop and arena upload, shared by both skinning passes
+	FRDGBufferRef BoneArenaBuffer = nullptr;
+
 	if (BoundarySkinningManager.IsValid() && BoundarySkinningManager->IsGPUBoundarySkinningEnabled())
 	{
+		BoneArenaBuffer = BoundarySkinningManager->PrepareBoneArena(GraphBuilder);
+
 		// Step 1: Run BoundarySkinningCS first to create WorldBoundaryParticles
 		FGPUBoundarySkinningManager::FBoundarySkinningOutputs SkinningOutputs;
 		BoundarySkinningManager->AddBoundarySkinningPass(
-			GraphBuilder, WorldBoundaryParticlesBuffer, WorldBoundaryParticleCount, Params.DeltaTime,
+			GraphBuilder, BoneArenaBuffer, WorldBoundaryParticlesBuffer, WorldBoundaryParticleCount, Params.DeltaTime,
 			&SkinningOutputs);
 
 		// DEBUG: Log skinning output
@@ -620,6 +728,7 @@ void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FG
 					LocalBoundarySRV,
 					WorldBoundaryParticleCount,
 					BoneTransformsSRV,
+					SkinningOutputs.BoneOffset,
 					SkinningOutputs.BoneCount,
 					SkinningOutputs.ComponentTransform,
 					Params.DeltaTime);
@@ -647,6 +756,7 @@ void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FG
 		PositionsSRVLocal,
 		PositionsUAVLocal,
 		Params,
+		BoneArenaBuffer,
 		BoneDeltaAttachmentBufferRDG ? &BoneDeltaAttachmentBufferRDG : nullptr);
 
 	// If we pre-computed WorldBoundaryParticles in Phase 1.5, store it in SpatialData
@@ -885,6 +995,244 @@ void FGPUFluidSimulator::RunInitializationSimulation(const FGPUFluidSimulationPa
 	UE_LOG(LogGPUFluidSimulator, Log, TEXT("RunInitializationSimulation: Completed for %d particles"), CurrentParticleCount);
 }
 
+//=============================================================================
+// Lazy Capacity Functions
+//=============================================================================
+
+/**
+ * @brief Grow capacity geometrically until RequiredCount fits.
+ * @param CurrentCapacity Capacity currently allocated (0 = nothing allocated yet).
+ * @param RequiredCount Particle count that must fit.
+ * @return New capacity, aligned to the thread group size and clamped to MaxParticleCount.
+ */
+int32 FGPUFluidSimulator::ComputeGrownCapacity(int32 CurrentCapacity, int32 RequiredCount) const
+{
+	if (MaxParticleCount <= 0)
+	{
+		return 0;
+	}
+
+	if (GFluidLazyCapacity == 0)
+	{
+		return MaxParticleCount;
+	}
+
+	const float GrowthFactor = FMath::Max(GFluidLazyCapacityGrowthFactor, 1.25f);
+	int64 Capacity = FMath::Max<int64>(CurrentCapacity, FMath::Max(GFluidLazyCapacityInitial, 1));
+	while (Capacity < RequiredCount)
+	{
+		Capacity = FMath::Max<int64>(Capacity + 1, static_cast<int64>(Capacity * GrowthFactor));
+	}
+
+	Capacity = Align(Capacity, GFluidCapacityAlignment);
+	return static_cast<int32>(FMath::Min<int64>(Capacity, MaxParticleCount));
+}
+
+/**
+ * @brief Decide this frame's particle capacity (game thread).
+ * 
+ * Grows ahead of pending spawns so the render resource and spawn passes agree on buffer size.
+ * Shrinks to twice the live count after r.Fluid.LazyCapacity.ShrinkFrames frames below 25% occupancy.
+ * 
+ * @param RequiredCount Live count plus pending spawns.
+ * @param bAllowShrink False when spawn/despawn passes run this frame.
+ * @param bOutShrink Set when the render thread must move particles into a smaller buffer.
+ * @return Capacity for this frame.
+ */
+int32 FGPUFluidSimulator::UpdateCapacityForFrame(int32 RequiredCount, bool bAllowShrink, bool& bOutShrink)
+{
+	bOutShrink = false;
+	const int32 Capacity = AllocatedCapacity.load();
+
+	if (GFluidLazyCapacity == 0)
+	{
+		LowOccupancyFrames = 0;
+		RaiseAllocatedCapacity(MaxParticleCount);
+		return MaxParticleCount;
+	}
+
+	if (RequiredCount > Capacity)
+	{
+		const int32 NewCapacity = ComputeGrownCapacity(Capacity, RequiredCount);
+		RaiseAllocatedCapacity(NewCapacity);
+		LowOccupancyFrames = 0;
+
+		UE_LOG(LogGPUFluidSimulator, Verbose, TEXT("Particle capacity grown: %d -> %d (required %d, max %d)"),
+			Capacity, NewCapacity, RequiredCount, MaxParticleCount);
+		return AllocatedCapacity.load();
+	}
+
+	const int32 InitialCapacity = ComputeGrownCapacity(0, 1);
+	const bool bLowOccupancy = RequiredCount * 4 < Capacity && Capacity > InitialCapacity;
+	if (!bLowOccupancy || GFluidLazyCapacityShrinkFrames <= 0)
+	{
+		LowOccupancyFrames = 0;
+		return Capacity;
+	}
+
+	if (++LowOccupancyFrames < GFluidLazyCapacityShrinkFrames || !bAllowShrink || !bEverHadParticles)
+	{
+		return Capacity;
+	}
+
+	const int32 NewCapacity = FMath::Max(InitialCapacity, ComputeGrownCapacity(0, RequiredCount * 2));
+	LowOccupancyFrames = 0;
+	if (NewCapacity >= Capacity)
+	{
+		return Capacity;
+	}
+
+	// The render thread may have grown the buffer for a spawn since Capacity was read; keep the larger one
+	if (!TryShrinkAllocatedCapacity(Capacity, NewCapacity))
+	{
+		return AllocatedCapacity.load();
+	}
+	bOutShrink = true;
+
+	UE_LOG(LogGPUFluidSimulator, Verbose, TEXT("Particle capacity shrunk: %d -> %d (live %d)"),
+		Capacity, NewCapacity, RequiredCount);
+	return NewCapacity;
+}
+
+/**
+ * @brief Raise the allocated capacity without ever lowering it (any thread).
+ * @param NewCapacity Capacity the caller's buffer was created with.
+ * @return True if the stored capacity was raised.
+ */
+bool FGPUFluidSimulator::RaiseAllocatedCapacity(int32 NewCapacity)
+{
+	int32 Current = AllocatedCapacity.load();
+	while (Current < NewCapacity)
+	{
+		if (AllocatedCapacity.compare_exchange_weak(Current, NewCapacity))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Lower the allocated capacity unless it changed since ExpectedCapacity was read (game thread).
+ * @param ExpectedCapacity Capacity the shrink decision was based on.
+ * @param NewCapacity Smaller capacity.
+ * @return True if the capacity was lowered.
+ */
+bool FGPUFluidSimulator::TryShrinkAllocatedCapacity(int32 ExpectedCapacity, int32 NewCapacity)
+{
+	return AllocatedCapacity.compare_exchange_strong(ExpectedCapacity, NewCapacity);
+}
+
+/**
+ * @brief Move particles into a buffer of NewCapacity and drop capacity-sized caches.
+ * 
+ * Neighbor and sleep caches are released and re-created at the new size on the next simulation frame.
+ * 
+ * @param GraphBuilder RDG builder.
+ * @param InOutParticleBuffer Current particle buffer, replaced by the shrunk buffer.
+ * @param ParticleCountBuffer GPU particle count (indirect dispatch source).
+ * @param NewCapacity Target capacity.
+ */
+void FGPUFluidSimulator::AddShrinkParticleBufferPass(FRDGBuilder& GraphBuilder, FRDGBufferRef& InOutParticleBuffer,
+	FRDGBufferRef ParticleCountBuffer, int32 NewCapacity)
+{
+	RDG_EVENT_SCOPE(GraphBuilder, "GPUFluid::ShrinkCapacity");
+
+	FRDGBufferDesc NewBufferDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FGPUFluidParticle), NewCapacity);
+	FRDGBufferRef NewParticleBuffer = GraphBuilder.CreateBuffer(NewBufferDesc, TEXT("GPUFluidParticles"));
+
+	const int32 CopyCount = FMath::Min(CurrentParticleCount, NewCapacity);
+	if (CopyCount > 0)
+	{
+		FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+		TShaderMapRef<FCopyParticlesCS> CopyShader(ShaderMap);
+		FCopyParticlesCS::FParameters* CopyParams = GraphBuilder.AllocParameters<FCopyParticlesCS::FParameters>();
+		CopyParams->SourceParticles = GraphBuilder.CreateSRV(InOutParticleBuffer);
+		CopyParams->DestParticles = GraphBuilder.CreateUAV(NewParticleBuffer);
+		CopyParams->ParticleCountBuffer = GraphBuilder.CreateSRV(ParticleCountBuffer);
+		CopyParams->SourceOffset = 0;
+		CopyParams->DestOffset = 0;
+		CopyParams->CopyCount = CopyCount;
+		CopyParams->bReadCountFromGPU = 1;
+
+		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::CopyForShrink(Indirect)"),
+			CopyShader, CopyParams, ParticleCountBuffer,
+			GPUIndirectDispatch::IndirectArgsOffset_TG256);
+	}
+
+	InOutParticleBuffer = NewParticleBuffer;
+
+	for (int32 i = 0; i < 2; ++i)
+	{
+		NeighborListBuffers[i].SafeRelease();
+		NeighborCountsBuffers[i].SafeRelease();
+		NeighborBufferAllocCapacities[i] = 0;
+		NeighborBufferParticleCapacities[i] = 0;
+	}
+	bPrevNeighborCacheValid = false;
+
+	SleepCountersBuffer.SafeRelease();
+	SleepCountersCapacity = 0;
+}
+
+/**
+ * @brief Refresh the memory accounting snapshot from persistent pooled buffers (render thread).
+ */
+void FGPUFluidSimulator::UpdateMemoryAccounting()
+{
+	auto SizeOf = [](const TRefCountPtr<FRDGPooledBuffer>& Buffer) -> int64
+	{
+		return Buffer.IsValid() ? static_cast<int64>(Buffer->GetSize()) : 0;
+	};
+
+	// Buffers whose size scales with particle capacity
+	int64 PerParticleBytes = SizeOf(PersistentParticleBuffer) + SizeOf(PersistentParticleIndicesBuffer)
+		+ SizeOf(SleepCountersBuffer) + SizeOf(BoneDeltaAttachmentBuffer) + SizeOf(PreviousPositionsBuffer)
+		+ SizeOf(PersistentAnisotropyAxis1Buffer) + SizeOf(PersistentAnisotropyAxis2Buffer)
+		+ SizeOf(PersistentAnisotropyAxis3Buffer) + SizeOf(PersistentRenderOffsetBuffer);
+	for (int32 i = 0; i < 2; ++i)
+	{
+		PerParticleBytes += SizeOf(NeighborListBuffers[i]) + SizeOf(NeighborCountsBuffers[i]);
+	}
+	if (AdhesionManager.IsValid())
+	{
+		PerParticleBytes += SizeOf(AdhesionManager->GetPersistentAttachmentBuffer());
+	}
+	if (SpawnManager.IsValid())
+	{
+		PerParticleBytes += SpawnManager->GetStreamCompactionBytes();
+	}
+
+	// Grid-sized buffers are always fully used
+	const int64 FixedBytes = SizeOf(PersistentCellCountsBuffer) + SizeOf(PersistentCellStartBuffer)
+		+ SizeOf(PersistentCellEndBuffer) + SizeOf(PersistentParticleCountBuffer);
+
+	const int32 Capacity = GetParticleAllocCount();
+	const double Occupancy = Capacity > 0 ? FMath::Clamp(static_cast<double>(CurrentParticleCount) / Capacity, 0.0, 1.0) : 0.0;
+
+	FScopeLock Lock(&BufferLock);
+	CachedMemoryStats.ReservedBytes = PerParticleBytes + FixedBytes;
+	CachedMemoryStats.UsedBytes = static_cast<int64>(PerParticleBytes * Occupancy) + FixedBytes;
+}
+
+/**
+ * @brief Get the latest memory accounting snapshot.
+ * @return Reserved vs used bytes plus current capacity figures.
+ */
+FGPUFluidMemoryStats FGPUFluidSimulator::GetMemoryStats() const
+{
+	FGPUFluidMemoryStats Stats;
+	{
+		FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
+		Stats = CachedMemoryStats;
+	}
+	Stats.MaxParticleCount = MaxParticleCount;
+	Stats.AllocatedCapacity = AllocatedCapacity.load();
+	Stats.ParticleCount = CurrentParticleCount;
+	return Stats;
+}
+
 //=============================================================================
 // Frame Lifecycle Functions
 //=============================================================================
@@ -912,9 +1260,14 @@ void FGPUFluidSimulator::BeginFrame()
 	const bool bHasPendingSpawns = SpawnManager.IsValid() && SpawnManager->HasPendingSpawnRequests();
 	const bool bHasPendingDespawns = SpawnManager.IsValid() && (SpawnManager->HasPendingGPUDespawnRequests() || SpawnManager->HasPerSourceRecycle());
 
+	// Decide capacity on the game thread so renderers sized from GetAllocatedCapacity() match this frame
+	const int32 RequiredCount = CurrentParticleCount + (bHasPendingSpawns ? GetPendingSpawnCount() : 0);
+	bool bShrinkCapacity = false;
+	const int32 FrameCapacity = UpdateCapacityForFrame(RequiredCount, !bHasPendingSpawns && !bHasPendingDespawns, bShrinkCapacity);
+
 	// Single render command for all BeginFrame operations
 	ENQUEUE_RENDER_COMMAND(GPUFluidBeginFrame)(
-		[Self, bHasPendingSpawns, bHasPendingDespawns](FRHICommandListImmediate& RHICmdList)
+		[Self, bHasPendingSpawns, bHasPendingDespawns, FrameCapacity, bShrinkCapacity](FRHICommandListImmediate& RHICmdList)
 		{
 			SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame);
 
@@ -929,10 +1282,10 @@ void FGPUFluidSimulator::BeginFrame()
 			Self->ProcessParticleCountReadback();
 
 			// Process stats readback - also extracts shadow data if bShadowReadbackEnabled
+			// Every readback consumer (shadow, proxy, query, max velocity, debug draw, custom) registers a field mask
 			const bool bNeedStatsReadback = GetFluidStatsCollector().IsAnyReadbackNeeded();
-			const bool bNeedShadowReadback = Self->bShadowReadbackEnabled.load();
-			const bool bNeedFullReadback = Self->bFullReadbackEnabled.load();
-			if (bNeedStatsReadback || bNeedShadowReadback || bNeedFullReadback)
+			const bool bNeedConsumerReadback = Self->GetReadbackFieldMask() != EGPUReadbackField::None;
+			if (bNeedStatsReadback || bNeedConsumerReadback)
 			{
 				SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame_ProcessStatsReadback);
 				Self->ProcessStatsReadback(RHICmdList);
@@ -963,14 +1316,17 @@ void FGPUFluidSimulator::BeginFrame()
 			{
 				SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame_SOURCECOUNT);
 				Self->SpawnManager->ProcessSourceCounterReadback();
+				Self->SpawnManager->SetParticleCapacity(FrameCapacity);
 			}
 
+			Self->UpdateMemoryAccounting();
+
 			// =====================================================
 			// Step 2: Process Spawn/Despawn Operations
 			// =====================================================
-			if (!bHasPendingSpawns && !bHasPendingDespawns)
+			if (!bHasPendingSpawns && !bHasPendingDespawns && !bShrinkCapacity)
 			{
-				return;  // No spawn/despawn to process
+				return;  // No spawn/despawn/shrink to process
 			}
 
 			FRDGBuilder GraphBuilder(RHICmdList);
@@ -1010,6 +1366,9 @@ void FGPUFluidSimulator::BeginFrame()
 						Self->SpawnManager->AddGPUDespawnPass(GraphBuilder, ParticleBuffer, PreDespawnCount,
 							NextParticleIDHint, ParticleCountBuffer);
 					}
+
+					// Compaction shifts indices; tick-start positions no longer match until the next capture
+					Self->bPreviousPositionsValid = false;
 					// WriteAliveCountAfterCompactionCS is now inside AddGPUDespawnPass
 					// (runs only when compaction actually executes, preventing stale PrefixSums overwrite)
 
@@ -1026,8 +1385,12 @@ void FGPUFluidSimulator::BeginFrame()
 
 				if (bFirstSpawn)
 				{
-					// PATH 1: First spawn - create new buffer (pre-allocate to MaxParticleCount)
-					const int32 BufferCapacity = Self->MaxParticleCount > 0 ? Self->MaxParticleCount : SpawnCount;
+					// PATH 1: First spawn - create new buffer at the allocated capacity (grown if the request exceeds it)
+					const int32 BufferCapacity = FMath::Max(FrameCapacity, Self->ComputeGrownCapacity(FrameCapacity, SpawnCount));
+					if (Self->RaiseAllocatedCapacity(BufferCapacity))
+					{
+						Self->SpawnManager->SetParticleCapacity(BufferCapacity);
+					}
 					FRDGBufferDesc NewBufferDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FGPUFluidParticle), BufferCapacity);
 					ParticleBuffer = GraphBuilder.CreateBuffer(NewBufferDesc, TEXT("GPUFluidParticles"));
 
@@ -1037,7 +1400,7 @@ void FGPUFluidSimulator::BeginFrame()
 					FRDGBufferUAVRef CounterUAV = GraphBuilder.CreateUAV(CounterBuffer);
 					FRDGBufferUAVRef ParticleUAVForSpawn = GraphBuilder.CreateUAV(ParticleBuffer);
 
-					Self->SpawnManager->AddSpawnParticlesPass(GraphBuilder, ParticleUAVForSpawn, CounterUAV, Self->MaxParticleCount);
+					Self->SpawnManager->AddSpawnParticlesPass(GraphBuilder, ParticleUAVForSpawn, CounterUAV, BufferCapacity);
 
 					// GPU: Update count from atomic spawn counter
 					{
@@ -1059,15 +1422,19 @@ void FGPUFluidSimulator::BeginFrame()
 					}
 
 					// Estimate for CPU side (will be corrected by readback next frame)
-					Self->CurrentParticleCount = FMath::Min(SpawnCount, Self->MaxParticleCount);
+					Self->CurrentParticleCount = FMath::Min(SpawnCount, BufferCapacity);
 					Self->SpawnManager->OnSpawnComplete(Self->CurrentParticleCount);
 				}
 				else
 				{
-					// PATH 2: Append spawn - copy existing + spawn new (pre-allocate to MaxParticleCount)
+					// PATH 2: Append spawn - copy existing + spawn new into a buffer at the allocated capacity
 					const int32 EstimatedExisting = Self->CurrentParticleCount;
 					const int32 TotalCount = EstimatedExisting + SpawnCount;
-					const int32 BufferCapacity = Self->MaxParticleCount > 0 ? Self->MaxParticleCount : FMath::Min(TotalCount, Self->MaxParticleCount);
+					const int32 BufferCapacity = FMath::Max(FrameCapacity, Self->ComputeGrownCapacity(FrameCapacity, TotalCount));
+					if (Self->RaiseAllocatedCapacity(BufferCapacity))
+					{
+						Self->SpawnManager->SetParticleCapacity(BufferCapacity);
+					}
 					FRDGBufferDesc NewBufferDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FGPUFluidParticle), BufferCapacity);
 					FRDGBufferRef NewParticleBuffer = GraphBuilder.CreateBuffer(NewBufferDesc, TEXT("GPUFluidParticles"));
 
@@ -1119,7 +1486,7 @@ void FGPUFluidSimulator::BeginFrame()
 					FRDGBufferUAVRef CounterUAV = GraphBuilder.CreateUAV(CounterBuffer);
 					FRDGBufferUAVRef ParticleUAVForSpawn = GraphBuilder.CreateUAV(NewParticleBuffer);
 
-					Self->SpawnManager->AddSpawnParticlesPass(GraphBuilder, ParticleUAVForSpawn, CounterUAV, Self->MaxParticleCount);
+					Self->SpawnManager->AddSpawnParticlesPass(GraphBuilder, ParticleUAVForSpawn, CounterUAV, BufferCapacity);
 
 					// GPU: Update count from atomic spawn counter
 					{
@@ -1136,13 +1503,22 @@ void FGPUFluidSimulator::BeginFrame()
 					}
 
 					// Estimate for CPU side (will be corrected by readback next frame)
-					Self->CurrentParticleCount = FMath::Min(TotalCount, Self->MaxParticleCount);
+					Self->CurrentParticleCount = FMath::Min(TotalCount, BufferCapacity);
 					Self->SpawnManager->OnSpawnComplete(SpawnCount);
 					ParticleBuffer = NewParticleBuffer;
 				}
 
 			}
 
+			// Shrink after sustained low occupancy (only on frames without spawn/despawn)
+			if (bShrinkCapacity && !ParticleBuffer && Self->PersistentParticleBuffer.IsValid())
+			{
+				SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame_Shrink);
+				ParticleBuffer = GraphBuilder.RegisterExternalBuffer(Self->PersistentParticleBuffer, TEXT("GPUFluidParticlesForShrink"));
+				ParticleCountBuffer = Self->RegisterParticleCountBuffer(GraphBuilder);
+				Self->AddShrinkParticleBufferPass(GraphBuilder, ParticleBuffer, ParticleCountBuffer, FrameCapacity);
+			}
+
 			// Clear active requests
 			if (Self->SpawnManager.IsValid())
 			{
@@ -1234,55 +1610,75 @@ void FGPUFluidSimulator::EndFrame()
 
 					const int32 ParticleCount = Self->CurrentParticleCount;
 					const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled();
-					const bool bNeedVelocity = Self->bFullReadbackEnabled.load() || Self->bShadowReadbackEnabled.load();
+					uint32 FieldMask = Self->GetReadbackFieldMask();
+					if (FieldMask == EGPUReadbackField::None && GetFluidStatsCollector().IsAnyReadbackNeeded())
+					{
+						FieldMask = EGPUReadbackField::Position;
+					}
 
-					if (bNeedDetailedStats || bNeedVelocity)
+					if (bNeedDetailedStats)
 					{
-						// Full 64-byte readback (Z-Order state, no sort)
+						// Full 64-byte readback (Z-Order state, no sort) - detailed stats need density and mass
 						AddReadbackBufferPass(GraphBuilder,
 							RDG_EVENT_NAME("GPUFluid::ZOrderReadback(Full)"),
 							ParticleBuffer,
 							[Self, ParticleBuffer, ParticleCount](FRHICommandListImmediate& InRHICmdList)
 							{
-								Self->EnqueueStatsReadback(InRHICmdList, ParticleBuffer->GetRHI(), ParticleCount, /*bCompactMode=*/false);
+								Self->EnqueueStatsReadback(InRHICmdList, ParticleBuffer->GetRHI(), ParticleCount);
 							});
 					}
-					else
+					else if (FieldMask != EGPUReadbackField::None)
 					{
-						// Compact 32-byte readback (50% bandwidth reduction)
+						// Field-selective packed readback: only the streams registered consumers read
 						// ParticleCount (CPU) is used as safe upper bound for allocation only
-						// Shader uses ParticleCountBuffer[6] (GPU-accurate) for bounds
-						FRDGBufferDesc CompactBufferDesc = FRDGBufferDesc::CreateStructuredDesc(
-							sizeof(FCompactParticleStats), ParticleCount);
-						FRDGBufferRef CompactBuffer = GraphBuilder.CreateBuffer(CompactBufferDesc, TEXT("CompactStatsBuffer"));
+						// Shader uses min(ParticleCountBuffer[6], PackedCapacity) for bounds
+						const FGPUReadbackLayout Layout = FGPUReadbackLayout::Build(FieldMask, ParticleCount,
+							Self->SimulationBoundsMin, Self->SimulationBoundsMax);
+
+						FRDGBufferRef PackedBuffer = GraphBuilder.CreateBuffer(
+							FRDGBufferDesc::CreateByteAddressDesc(Layout.TotalBytes), TEXT("PackedReadbackBuffer"));
 
 						// Register ParticleCountBuffer for indirect dispatch + shader bounds
 						FRDGBufferRef CountBuffer = GraphBuilder.RegisterExternalBuffer(
-							Self->PersistentParticleCountBuffer, TEXT("ParticleCountBuffer_CompactStats"));
+							Self->PersistentParticleCountBuffer, TEXT("ParticleCountBuffer_PackedReadback"));
 
 						{
 							FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
-							TShaderMapRef<FCompactStatsCS> ComputeShader(GlobalShaderMap);
+							TShaderMapRef<FPackReadbackFieldsCS> ComputeShader(GlobalShaderMap);
+
+							FPackReadbackFieldsCS::FParameters* PassParameters =
+								GraphBuilder.AllocParameters<FPackReadbackFieldsCS::FParameters>();
 
-							FCompactStatsCS::FParameters* PassParameters =
-								GraphBuilder.AllocParameters<FCompactStatsCS::FParameters>();
+							auto ToShaderOffset = [](int32 Offset) { return Offset == INDEX_NONE ? 0xFFFFFFFFu : static_cast<uint32>(Offset); };
 
 							PassParameters->InParticles = GraphBuilder.CreateSRV(ParticleBuffer);
-							PassParameters->OutCompactStats = GraphBuilder.CreateUAV(CompactBuffer);
+							PassParameters->OutPackedFields = GraphBuilder.CreateUAV(PackedBuffer);
 							PassParameters->ParticleCountBuffer = GraphBuilder.CreateSRV(CountBuffer);
+							PassParameters->PackedCapacity = static_cast<uint32>(Layout.Capacity);
+							PassParameters->PackedPositionOffset = ToShaderOffset(Layout.PositionOffset);
+							PassParameters->PackedVelocityOffset = ToShaderOffset(Layout.VelocityOffset);
+							PassParameters->PackedSpeedOffset = ToShaderOffset(Layout.SpeedOffset);
+							PassParameters->PackedParticleIDOffset = ToShaderOffset(Layout.ParticleIDOffset);
+							PassParameters->PackedSourceIDOffset = ToShaderOffset(Layout.SourceIDOffset);
+							PassParameters->PackedFlagsOffset = ToShaderOffset(Layout.FlagsOffset);
+							PassParameters->PackedNeighborCountOffset = ToShaderOffset(Layout.NeighborCountOffset);
+							PassParameters->bPackQuantizedPositions = Layout.bQuantizedPositions ? 1 : 0;
+							PassParameters->bPackHalfVelocities = Layout.bHalfVelocities ? 1 : 0;
+							PassParameters->QuantizeMin = Layout.QuantizeMin;
+							PassParameters->QuantizeInvExtent = FVector3f(1.0f / Layout.QuantizeExtent.X, 1.0f / Layout.QuantizeExtent.Y, 1.0f / Layout.QuantizeExtent.Z);
 
 							GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
-								RDG_EVENT_NAME("GPUFluid::CompactStats(Indirect)"),
+								RDG_EVENT_NAME("GPUFluid::PackReadbackFields(Indirect)"),
 								ComputeShader, PassParameters, CountBuffer,
 								GPUIndirectDispatch::IndirectArgsOffset_TG256);
 						}
 
 						AddReadbackBufferPass(GraphBuilder,
-							RDG_EVENT_NAME("GPUFluid::ZOrderReadback(Compact)"),
-							CompactBuffer,
-							[Self, CompactBuffer, ParticleCount](FRHICommandListImmediate& InRHICmdList)
+							RDG_EVENT_NAME("GPUFluid::ZOrderReadback(Packed)"),
+							PackedBuffer,
+							[Self, PackedBuffer, ParticleCount, Layout](FRHICommandListImmediate& InRHICmdList)
 							{
-								Self->EnqueueStatsReadback(InRHICmdList, CompactBuffer->GetRHI(), ParticleCount, /*bCompactMode=*/true);
+								Self->EnqueueStatsReadback(InRHICmdList, PackedBuffer->GetRHI(), ParticleCount, &Layout);
 							});
 					}
 
@@ -1478,21 +1874,25 @@ FRDGBufferRef FGPUFluidSimulator::PrepareParticleBuffer(
 	// =====================================================
 	if (CachedGPUParticles.Num() > 0 && bNeedsFullUpload)
 	{
-		const int32 UploadCount = CachedGPUParticles.Num();
-		const int32 BufferCapacity = MaxParticleCount > 0 ? MaxParticleCount : FMath::Min(UploadCount, MaxParticleCount);
+		const int32 UploadCount = FMath::Min(CachedGPUParticles.Num(), MaxParticleCount);
+		const int32 BufferCapacity = FMath::Max(GetAllocatedCapacity(), ComputeGrownCapacity(GetAllocatedCapacity(), UploadCount));
+		RaiseAllocatedCapacity(BufferCapacity);
 		FRDGBufferDesc NewBufferDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FGPUFluidParticle), BufferCapacity);
 		ParticleBuffer = GraphBuilder.CreateBuffer(NewBufferDesc, TEXT("GPUFluidParticles"));
 
-		// Upload CPU particles to GPU buffer
+		// Upload CPU particles to GPU buffer (only the live range; the tail stays unused capacity)
 		GraphBuilder.QueueBufferUpload(
 			ParticleBuffer,
 			CachedGPUParticles.GetData(),
-			BufferCapacity * sizeof(FGPUFluidParticle));
+			UploadCount * sizeof(FGPUFluidParticle));
 
-		CurrentParticleCount = BufferCapacity;
+		CurrentParticleCount = UploadCount;
 		PreviousParticleCount = CurrentParticleCount;
 		bNeedsFullUpload = false;
 
+		// Uploaded order is unrelated to the captured tick-start positions
+		bPreviousPositionsValid = false;
+
 		// UE_LOG(LogGPUFluidSimulator, Log, TEXT("PATH 1 (CPU Upload): Uploaded %d particles from CPU to GPU"), BufferCapacity);
 	}
 	// =====================================================
@@ -1519,6 +1919,7 @@ FSimulationSpatialData FGPUFluidSimulator::BuildSpatialStructures(
 	FRDGBufferSRVRef& OutPositionsSRV,
 	FRDGBufferUAVRef& OutPositionsUAV,
 	const FGPUFluidSimulationParams& Params,
+	FRDGBufferRef BoneArenaBuffer,
 	FRDGBufferRef* InOutAttachmentBuffer)
 {
 	RDG_EVENT_SCOPE(GraphBuilder, "GPUFluid_BuildSpatialStructures");
@@ -1665,7 +2066,7 @@ FSimulationSpatialData FGPUFluidSimulator::BuildSpatialStructures(
 	if (IsGPUBoundarySkinningEnabled())
 	{
 
-		AddBoundarySkinningPass(GraphBuilder, SpatialData, Params);
+		AddBoundarySkinningPass(GraphBuilder, SpatialData, Params, BoneArenaBuffer);
 		
 	}
 
@@ -1755,8 +2156,8 @@ void FGPUFluidSimulator::ExecuteConstraintSolverLoop(
 	// Create/resize neighbor caching buffers for CURRENT frame (WriteIndex)
 	// Double Buffering: WriteIndex is used for UAV writes this frame
 	// ReadIndex (1 - WriteIndex) contains previous frame's data for PredictPositions SRV reads
-	// Pre-allocate to MaxParticleCount to avoid runtime reallocation hitches
-	const int32 AllocParticleCount = MaxParticleCount > 0 ? MaxParticleCount : CurrentParticleCount;
+	// Sized to the allocated capacity; reallocated only when capacity grows or shrinks
+	const int32 AllocParticleCount = GetParticleAllocCount();
 	const int32 NeighborListSize = AllocParticleCount * GPU_MAX_NEIGHBORS_PER_PARTICLE;
 	const int32 WriteIndex = CurrentNeighborBufferIndex;
 
@@ -1836,7 +2237,7 @@ void FGPUFluidSimulator::ExecuteAdhesion(
 	{
 		TRefCountPtr<FRDGPooledBuffer>& PersistentAttachmentBuffer = AdhesionManager->AccessPersistentAttachmentBuffer();
 		int32 AttachmentBufferSize = AdhesionManager->GetAttachmentBufferSize();
-		const int32 AttachmentAllocCount = MaxParticleCount > 0 ? MaxParticleCount : CurrentParticleCount;
+		const int32 AttachmentAllocCount = GetParticleAllocCount();
 		const bool bNeedNewBuffer = !PersistentAttachmentBuffer.IsValid() || AttachmentBufferSize < AttachmentAllocCount;
 
 		FRDGBufferRef AttachmentBuffer;
@@ -2229,6 +2630,13 @@ void FGPUFluidSimulator::ExtractPersistentBuffers(
 		CurrentIndirectArgsBuffer = nullptr;  // Clear transient ref
 	}
 
+	// Extract tick-start positions (render interpolation source)
+	if (CurrentPreviousPositionsBuffer)
+	{
+		GraphBuilder.QueueBufferExtraction(CurrentPreviousPositionsBuffer, &PreviousPositionsBuffer, ERHIAccess::SRVCompute);
+		CurrentPreviousPositionsBuffer = nullptr;  // Clear transient ref
+	}
+
 	// Only extract legacy hash table buffers when Z-Order sorting is NOT enabled
 	// When Z-Order is enabled, CellCountsBuffer/ParticleIndicesBuffer are dummy buffers that weren't produced
 	const bool bUseZOrderSorting = ZOrderSortManager.IsValid() && ZOrderSortManager->IsZOrderSortingEnabled();
@@ -2317,11 +2725,21 @@ void FGPUFluidSimulator::AddSpawnRequest(const FVector3f& Position, const FVecto
 	if (SpawnManager.IsValid()) { SpawnManager->AddSpawnRequest(Position, Velocity, Mass); }
 }
 
-void FGPUFluidSimulator::AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests)
+void FGPUFluidSimulator::AddSpawnRequest(const FGPUSpawnRequest& Request)
+{
+	if (SpawnManager.IsValid()) { SpawnManager->AddSpawnRequest(Request); }
+}
+
+void FGPUFluidSimulator::AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests)
 {
 	if (SpawnManager.IsValid()) { SpawnManager->AddSpawnRequests(Requests); }
 }
 
+void FGPUFluidSimulator::AddSpawnPlan(FKawaiiFluidSpawnPlan&& Plan)
+{
+	if (SpawnManager.IsValid()) { SpawnManager->AddSpawnPlan(MoveTemp(Plan)); }
+}
+
 void FGPUFluidSimulator::AddGPUDespawnBrushRequest(const FVector3f& Center, float Radius)
 {
 	if (SpawnManager.IsValid())
@@ -2353,16 +2771,15 @@ bool FGPUFluidSimulator::GetParticlePositionsAndIDs(TArray<FVector3f>& OutPositi
 		return false;
 	}
 
-	FScopeLock Lock(&BufferLock);
-
-	if (CachedParticlePositions.Num() == 0 || CachedAllParticleIDs.Num() == 0)
+	const FGPUFluidReadbackSnapshotView Snapshot = AcquireReadbackSnapshot();
+	if (Snapshot.Num() == 0 || Snapshot.GetParticleIDs().Num() == 0)
 	{
 		return false;
 	}
 
-	OutPositions = CachedParticlePositions;
-	OutParticleIDs = CachedAllParticleIDs;
-	OutSourceIDs = CachedParticleSourceIDs;
+	OutPositions = Snapshot.GetPositions();
+	OutParticleIDs = Snapshot.GetParticleIDs();
+	OutSourceIDs = Snapshot.GetSourceIDs();
 	return true;
 }
 
@@ -2373,63 +2790,51 @@ bool FGPUFluidSimulator::GetParticlePositionsAndVelocities(TArray<FVector3f>& Ou
 		return false;
 	}
 
-	FScopeLock Lock(&BufferLock);
-
-	if (CachedParticlePositions.Num() == 0)
+	const FGPUFluidReadbackSnapshotView Snapshot = AcquireReadbackSnapshot();
+	if (Snapshot.Num() == 0)
 	{
 		return false;
 	}
 
-	OutPositions = CachedParticlePositions;
-	OutVelocities = CachedParticleVelocities;  // May be empty if ISM not enabled
+	OutPositions = Snapshot.GetPositions();
+	OutVelocities = Snapshot.GetVelocities();  // Empty if velocity readback was off for this snapshot
 	return true;
 }
 
-const TArray<int32>* FGPUFluidSimulator::GetParticleIDsBySourceID(int32 SourceID) const
+bool FGPUFluidSimulator::ReadParticleQueryData(TFunctionRef<void(TConstArrayView<FVector3f>, TConstArrayView<FVector3f>, TConstArrayView<int32>)> Visitor) const
 {
 	if (!bHasValidGPUResults.load())
 	{
-		return nullptr;
+		return false;
 	}
 
-	if (SourceID < 0 || SourceID >= CachedSourceIDToParticleIDs.Num())
+	const FGPUFluidReadbackSnapshotView Snapshot = AcquireReadbackSnapshot();
+	if (Snapshot.Num() == 0)
 	{
-		return nullptr;
+		return false;
 	}
 
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-	const TArray<int32>& Result = CachedSourceIDToParticleIDs[SourceID];
-	return Result.Num() > 0 ? &Result : nullptr;
+	Visitor(Snapshot.GetPositions(), Snapshot.GetVelocities(), Snapshot.GetSourceIDs());
+	return true;
 }
 
-const TArray<int32>* FGPUFluidSimulator::GetAllParticleIDs() const
+bool FGPUFluidSimulator::GetParticleIDsBySourceID(int32 SourceID, TArray<int32>& OutParticleIDs) const
 {
+	OutParticleIDs.Reset();
 	if (!bHasValidGPUResults.load())
 	{
-		return nullptr;
+		return false;
 	}
 
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-	if (CachedAllParticleIDs.Num() == 0)
+	// The view pins the snapshot while its O(count-for-source) slice is copied out
+	const FGPUFluidReadbackSnapshotView Snapshot = AcquireReadbackSnapshot();
+	if (Snapshot.Num() == 0)
 	{
-		return nullptr;
-	}
-	return &CachedAllParticleIDs;
-}
-
-const TArray<uint32>* FGPUFluidSimulator::GetParticleFlags() const
-{
-	if (!bHasValidGPUResults.load())
-	{
-		return nullptr;
+		return false;
 	}
 
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-	if (CachedParticleFlags.Num() == 0)
-	{
-		return nullptr;
-	}
-	return &CachedParticleFlags;
+	OutParticleIDs.Append(Snapshot.GetParticleIDsBySourceID(SourceID));
+	return true;
 }
 
 void FGPUFluidSimulator::ClearSpawnRequests()
@@ -2602,13 +3007,14 @@ void FGPUFluidSimulator::AddBoundaryAdhesionPass(FRDGBuilder& GraphBuilder, cons
 	}
 }
 
-void FGPUFluidSimulator::AddBoundarySkinningPass(FRDGBuilder& GraphBuilder, FSimulationSpatialData& SpatialData, const FGPUFluidSimulationParams& Params)
+void FGPUFluidSimulator::AddBoundarySkinningPass(FRDGBuilder& GraphBuilder, FSimulationSpatialData& SpatialData, const FGPUFluidSimulationParams& Params,
+	FRDGBufferRef BoneArenaBuffer)
 {
 	if (BoundarySkinningManager.IsValid())
 	{
 		FRDGBufferRef OutBuffer = nullptr;
 		int32 OutCount = 0;
-		BoundarySkinningManager->AddBoundarySkinningPass(GraphBuilder, OutBuffer, OutCount, Params.DeltaTime);
+		BoundarySkinningManager->AddBoundarySkinningPass(GraphBuilder, BoneArenaBuffer, OutBuffer, OutCount, Params.DeltaTime);
 
 		if (OutBuffer && OutCount > 0)
 		{
@@ -2708,13 +3114,24 @@ FRDGBufferRef FGPUFluidSimulator::ExecuteZOrderSortingPipeline(
 	{
 		return InParticleBuffer;
 	}
-	const int32 SortAllocCount = MaxParticleCount > 0 ? MaxParticleCount : CurrentParticleCount;
-	return ZOrderSortManager->ExecuteZOrderSortingPipeline(GraphBuilder, InParticleBuffer,
+	const int32 SortAllocCount = GetParticleAllocCount();
+
+	// Tick-start positions (render interpolation) follow the particle reorder
+	FRDGBufferRef SortedPreviousPositions = nullptr;
+	FRDGBufferRef SortedParticleBuffer = ZOrderSortManager->ExecuteZOrderSortingPipeline(GraphBuilder, InParticleBuffer,
 		OutCellStartUAV, OutCellStartSRV, OutCellEndUAV, OutCellEndSRV,
 		OutCellStartBuffer, OutCellEndBuffer,
 		CurrentParticleCount, Params, SortAllocCount,
 		InAttachmentBuffer, OutSortedAttachmentBuffer,
-		CurrentIndirectArgsBuffer);
+		CurrentIndirectArgsBuffer,
+		CurrentPreviousPositionsBuffer,
+		CurrentPreviousPositionsBuffer ? &SortedPreviousPositions : nullptr);
+
+	if (SortedPreviousPositions)
+	{
+		CurrentPreviousPositionsBuffer = SortedPreviousPositions;
+	}
+	return SortedParticleBuffer;
 }
 
 //=============================================================================
@@ -2944,24 +3361,24 @@ void FGPUFluidSimulator::FinalizeUpload()
 		CurrentParticleCount = ParticleCount;
 		bNeedsFullUpload = false;
 
-		// Build readback cache at upload time (immediately usable in ClearAllParticles etc.)
-		// Build cache immediately from CPU data without waiting for GPU readback
-		constexpr int32 MaxSources = EGPUParticleSource::MaxSourceCount;
-		CachedSourceIDToParticleIDs.SetNum(MaxSources);
-		for (int32 i = 0; i < MaxSources; ++i)
+		// Publish a readback snapshot at upload time (immediately usable in ClearAllParticles etc.)
+		// Built from CPU data without waiting for GPU readback
+		if (FGPUFluidReadbackSnapshot* Snapshot = ReadbackSnapshots.BeginWrite())
 		{
-			CachedSourceIDToParticleIDs[i].Reset();
-		}
-		CachedAllParticleIDs.Empty();
-		CachedAllParticleIDs.Reserve(ParticleCount);
+			Snapshot->Positions.Reserve(ParticleCount);
+			Snapshot->SourceIDs.Reserve(ParticleCount);
+			Snapshot->ParticleIDs.Reserve(ParticleCount);
+			Snapshot->Flags.Reserve(ParticleCount);
 
-		for (const FGPUFluidParticle& P : CachedGPUParticles)
-		{
-			if (P.SourceID >= 0 && P.SourceID < MaxSources)
+			for (const FGPUFluidParticle& P : CachedGPUParticles)
 			{
-				CachedSourceIDToParticleIDs[P.SourceID].Add(P.ParticleID);
+				Snapshot->Positions.Add(P.Position);
+				Snapshot->SourceIDs.Add(P.SourceID);
+				Snapshot->ParticleIDs.Add(P.ParticleID);
+				Snapshot->Flags.Add(P.Flags);
 			}
-			CachedAllParticleIDs.Add(P.ParticleID);
+			Snapshot->SourceIndex.Build(Snapshot->SourceIDs, Snapshot->ParticleIDs);
+			ReadbackSnapshots.Publish();
 		}
 
 		bHasValidGPUResults.store(true);
@@ -3008,6 +3425,64 @@ void FGPUFluidSimulator::FinalizeUpload()
 	}
 }
 
+/**
+ * @brief Queue CPU particles for a streaming upload into the live particle buffer.
+ *
+ * Particles are converted in parallel straight into upload chunks; the spawn manager appends a
+ * budgeted number of chunks per frame, so resident particles keep simulating while the rest loads.
+ * Falls back to UploadParticles(bAppend) + FinalizeUpload when r.Fluid.StreamingUpload is 0.
+ *
+ * @param CPUParticles Particles with ParticleID/SourceID already assigned.
+ * @return Number of particles queued (or uploaded).
+ */
+int32 FGPUFluidSimulator::QueueParticleUpload(const TArray<FKawaiiFluidParticle>& CPUParticles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GPUFluidSimulator_QueueParticleUpload);
+
+	const int32 NewCount = CPUParticles.Num();
+	if (!bIsInitialized || !SpawnManager.IsValid() || NewCount == 0)
+	{
+		return 0;
+	}
+
+	if (GFluidStreamingUpload == 0)
+	{
+		UploadParticles(CPUParticles, /*bAppend=*/true);
+		FinalizeUpload();
+		return NewCount;
+	}
+
+	const int32 TotalAfterUpload = CurrentParticleCount + GetPendingSpawnCount() + NewCount;
+	if (TotalAfterUpload > MaxParticleCount)
+	{
+		UE_LOG(LogGPUFluidSimulator, Warning,
+			TEXT("QueueParticleUpload: Total count (%d) exceeds capacity (%d)"), TotalAfterUpload, MaxParticleCount);
+		return 0;
+	}
+
+	constexpr int32 ChunkSize = FGPUSpawnManager::UploadChunkSize;
+	const int32 NumChunks = FMath::DivideAndRoundUp(NewCount, ChunkSize);
+
+	TArray<TArray<FGPUFluidParticle>> Chunks;
+	Chunks.Reserve(NumChunks);
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		TArray<FGPUFluidParticle>& Chunk = Chunks.Add_GetRef(SpawnManager->AcquireUploadChunk());
+		Chunk.SetNumUninitialized(FMath::Min(ChunkSize, NewCount - ChunkIndex * ChunkSize), EAllowShrinking::No);
+	}
+
+	// ParallelFor optimization: parallelize for large particle counts (>= 2048)
+	ParallelFor(NewCount, [&](int32 i)
+	{
+		Chunks[i / ChunkSize][i % ChunkSize] = ConvertToGPU(CPUParticles[i]);
+	}, NewCount < 2048);
+
+	SpawnManager->AddUploadChunks(MoveTemp(Chunks));
+
+	UE_LOG(LogGPUFluidSimulator, Log, TEXT("QueueParticleUpload: Queued %d particles in %d chunks"), NewCount, NumChunks);
+	return NewCount;
+}
+
 void FGPUFluidSimulator::ClearCachedParticles()
 {
 	FScopeLock Lock(&BufferLock);
@@ -3470,6 +3945,10 @@ bool FGPUFluidSimulator::GetParticlesBySourceID(int32 SourceID, TArray<FKawaiiFl
 		return false;
 	}
 
+	// The sync readback is in the current Z-Order, so it is scanned once; the published
+	// source index gives the expected count so the output is sized up front
+	OutParticles.Reserve(AcquireReadbackSnapshot().GetParticleIDsBySourceID(SourceID).Num());
+
 	// Filter by SourceID
 	for (const FGPUFluidParticle& GPUParticle : ParticleBuffer)
 	{
@@ -3658,20 +4137,20 @@ void FGPUFluidSimulator::ReleaseAnisotropyReadbackObjects()
  */
 bool FGPUFluidSimulator::GetShadowPositions(TArray<FVector>& OutPositions) const
 {
-	if (ReadyShadowPositionsFrame.load() == 0 || ReadyShadowPositions.Num() == 0)
+	const FGPUFluidReadbackSnapshotView Snapshot = AcquireReadbackSnapshot();
+	if (!Snapshot.HasNeighborCounts())
 	{
 		OutPositions.Empty();
 		return false;
 	}
 
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-
-	const int32 Count = ReadyShadowPositions.Num();
+	const TConstArrayView<FVector3f> Positions = Snapshot.GetPositions();
+	const int32 Count = Positions.Num();
 	OutPositions.SetNumUninitialized(Count);
 
 	for (int32 i = 0; i < Count; ++i)
 	{
-		OutPositions[i] = FVector(ReadyShadowPositions[i]);
+		OutPositions[i] = FVector(Positions[i]);
 	}
 
 	return true;
@@ -3685,36 +4164,55 @@ bool FGPUFluidSimulator::GetShadowPositions(TArray<FVector>& OutPositions) const
  */
 bool FGPUFluidSimulator::GetShadowPositionsAndVelocities(TArray<FVector>& OutPositions, TArray<FVector>& OutVelocities) const
 {
-	if (ReadyShadowPositionsFrame.load() == 0 || ReadyShadowPositions.Num() == 0)
-	{
-		OutPositions.Empty();
-		OutVelocities.Empty();
-		return false;
-	}
-
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
+	const FGPUFluidReadbackSnapshotView Snapshot = AcquireReadbackSnapshot();
 
-	// Defensive check: ensure velocity array matches position array size
-	if (ReadyShadowVelocities.Num() != ReadyShadowPositions.Num())
+	// Defensive check: velocities must have been read back alongside the shadow positions
+	if (!Snapshot.HasNeighborCounts() || !Snapshot.HasVelocities())
 	{
 		OutPositions.Empty();
 		OutVelocities.Empty();
 		return false;
 	}
 
-	const int32 Count = ReadyShadowPositions.Num();
+	const TConstArrayView<FVector3f> Positions = Snapshot.GetPositions();
+	const TConstArrayView<FVector3f> Velocities = Snapshot.GetVelocities();
+	const int32 Count = Positions.Num();
 	OutPositions.SetNumUninitialized(Count);
 	OutVelocities.SetNumUninitialized(Count);
 
 	for (int32 i = 0; i < Count; ++i)
 	{
-		OutPositions[i] = FVector(ReadyShadowPositions[i]);
-		OutVelocities[i] = FVector(ReadyShadowVelocities[i]);
+		OutPositions[i] = FVector(Positions[i]);
+		OutVelocities[i] = FVector(Velocities[i]);
 	}
 
 	return true;
 }
 
+/**
+ * @brief Get persistent IDs and state flags of the shadow particles (non-blocking).
+ * @param OutParticleIDs Output array of particle IDs.
+ * @param OutFlags Output array of particle flags.
+ * @return true if valid data was retrieved.
+ */
+bool FGPUFluidSimulator::GetShadowParticleStates(TArray<int32>& OutParticleIDs, TArray<uint32>& OutFlags) const
+{
+	const FGPUFluidReadbackSnapshotView Snapshot = AcquireReadbackSnapshot();
+	const int32 Count = Snapshot.Num();
+	if (Count == 0 || Snapshot.GetParticleIDs().Num() != Count || Snapshot.GetFlags().Num() != Count)
+	{
+		OutParticleIDs.Empty();
+		OutFlags.Empty();
+		return false;
+	}
+
+	OutParticleIDs.Reset(Count);
+	OutParticleIDs.Append(Snapshot.GetParticleIDs());
+	OutFlags.Reset(Count);
+	OutFlags.Append(Snapshot.GetFlags());
+	return true;
+}
+
 /**
  * @brief Get neighbor counts for isolation detection (non-blocking).
  * @param OutNeighborCounts Output array of neighbor counts per particle.
@@ -3722,20 +4220,20 @@ bool FGPUFluidSimulator::GetShadowPositionsAndVelocities(TArray<FVector>& OutPos
  */
 bool FGPUFluidSimulator::GetShadowNeighborCounts(TArray<int32>& OutNeighborCounts) const
 {
-	if (ReadyShadowPositionsFrame.load() == 0 || ReadyShadowNeighborCounts.Num() == 0)
+	const FGPUFluidReadbackSnapshotView Snapshot = AcquireReadbackSnapshot();
+	if (!Snapshot.HasNeighborCounts())
 	{
 		OutNeighborCounts.Empty();
 		return false;
 	}
 
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-
-	const int32 Count = ReadyShadowNeighborCounts.Num();
+	const TConstArrayView<uint32> NeighborCounts = Snapshot.GetNeighborCounts();
+	const int32 Count = NeighborCounts.Num();
 	OutNeighborCounts.SetNumUninitialized(Count);
 
 	for (int32 i = 0; i < Count; ++i)
 	{
-		OutNeighborCounts[i] = static_cast<int32>(ReadyShadowNeighborCounts[i]);
+		OutNeighborCounts[i] = static_cast<int32>(NeighborCounts[i]);
 	}
 
 	return true;
@@ -3918,27 +4416,26 @@ void FGPUFluidSimulator::ReleaseStatsReadbackObjects()
 		}
 		StatsReadbackFrameNumbers[i] = 0;
 		StatsReadbackParticleCounts[i] = 0;
-		bStatsReadbackCompactMode[i] = false;
+		StatsReadbackLayouts[i] = FGPUReadbackLayout();
 	}
 	StatsReadbackWriteIndex = 0;
 }
 
-void FGPUFluidSimulator::EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, bool bCompactMode)
+void FGPUFluidSimulator::EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, const FGPUReadbackLayout* PackedLayout)
 {
 	if (ParticleCount <= 0 || SourceBuffer == nullptr)
 	{
 		return;
 	}
 
-	// Validate source buffer size based on mode
+	// Validate source buffer size based on mode (packed layout or full 64-byte particles)
 	const uint32 SourceBufferSize = SourceBuffer->GetSize();
-	const uint32 ElementSize = bCompactMode ? sizeof(FCompactParticleStats) : sizeof(FGPUFluidParticle);
-	const uint32 RequiredSize = ParticleCount * ElementSize;
+	const uint32 RequiredSize = PackedLayout ? static_cast<uint32>(PackedLayout->TotalBytes) : ParticleCount * sizeof(FGPUFluidParticle);
 	if (RequiredSize > SourceBufferSize)
 	{
 		UE_LOG(LogGPUFluidSimulator, Warning,
-			TEXT("EnqueueStatsReadback: CopySize (%u) exceeds SourceBuffer size (%u). ParticleCount=%d, Compact=%d, Skipping."),
-			RequiredSize, SourceBufferSize, ParticleCount, bCompactMode ? 1 : 0);
+			TEXT("EnqueueStatsReadback: CopySize (%u) exceeds SourceBuffer size (%u). ParticleCount=%d, Packed=%d, Skipping."),
+			RequiredSize, SourceBufferSize, ParticleCount, PackedLayout ? 1 : 0);
 		return;
 	}
 
@@ -3952,14 +4449,43 @@ void FGPUFluidSimulator::EnqueueStatsReadback(FRHICommandListImmediate& RHICmdLi
 	const int32 WriteIdx = StatsReadbackWriteIndex;
 	StatsReadbackWriteIndex = (StatsReadbackWriteIndex + 1) % NUM_STATS_READBACK_BUFFERS;
 
-	// Enqueue async copy (compact 32 bytes or full 64 bytes per particle)
-	const uint32 CopySize = ParticleCount * ElementSize;
+	// Enqueue async copy (packed streams or full 64 bytes per particle)
+	const uint32 CopySize = RequiredSize;
 	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
 	StatsReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
 	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
 	StatsReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
 	StatsReadbackParticleCounts[WriteIdx] = ParticleCount;
-	bStatsReadbackCompactMode[WriteIdx] = bCompactMode;
+	StatsReadbackLayouts[WriteIdx] = PackedLayout ? *PackedLayout : FGPUReadbackLayout();
+}
+
+/**
+ * @brief Resolve the registered consumer field masks into the mask for the next packed readback.
+ * @return EGPUReadbackField bits (positions always included when anything is requested), None if no consumer.
+ */
+uint32 FGPUFluidSimulator::GetReadbackFieldMask() const
+{
+	uint32 ConsumerMasks[EGPUReadbackConsumer::Count + 1];
+	bool bAnyConsumer = false;
+	for (int32 i = 0; i < EGPUReadbackConsumer::Count; ++i)
+	{
+		ConsumerMasks[i] = ReadbackConsumerFields[i].load();
+		bAnyConsumer |= ConsumerMasks[i] != EGPUReadbackField::None;
+	}
+	if (!bAnyConsumer)
+	{
+		return EGPUReadbackField::None;
+	}
+
+	// Positions index every snapshot; quantized unless a consumer needs them exact
+	ConsumerMasks[EGPUReadbackConsumer::Count] = EGPUReadbackField::Position | EGPUReadbackField::AcceptQuantizedPosition;
+
+	uint32 Mask = FGPUReadbackLayout::CombineConsumerMasks(ConsumerMasks);
+	if (GFluidReadbackQuantize == 0)
+	{
+		Mask &= EGPUReadbackField::AllFields;
+	}
+	return Mask;
 }
 
 void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdList)
@@ -3972,20 +4498,9 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 	// If particle count is zero, clear all caches and discard pending readbacks
 	if (CurrentParticleCount <= 0)
 	{
-		{
-			FScopeLock Lock(&BufferLock);
-			CachedParticlePositions.Empty();
-			CachedParticleVelocities.Empty();
-			CachedParticleSourceIDs.Empty();
-			CachedAllParticleIDs.Empty();
-			CachedSourceIDToParticleIDs.Empty();
-			CachedParticleFlags.Empty();
-			ReadyShadowPositions.Empty();
-			ReadyShadowVelocities.Empty();
-			ReadyShadowNeighborCounts.Empty();
-			ReadyShadowPositionsFrame.store(0);
-			ReadyShadowAnisotropyFrame.store(0);
-		}
+		ReadbackSnapshots.Clear();
+		ReadyShadowAnisotropyFrame.store(0);
+		PublishReadbackMaxVelocity(0.0f);
 		for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
 		{
 			if (StatsReadbackFrameNumbers[i] > 0 && StatsReadbacks[i] && StatsReadbacks[i]->IsReady())
@@ -4036,113 +4551,84 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 		return;
 	}
 
-	// Check if this readback is compact mode (32 bytes) or full mode (64 bytes)
-	const bool bIsCompactMode = bStatsReadbackCompactMode[ReadIdx];
+	// Packed layout (field-selective streams) or full 64-byte particles
+	const FGPUReadbackLayout& Layout = StatsReadbackLayouts[ReadIdx];
+	const bool bIsPackedMode = Layout.TotalBytes > 0;
 
 	// Lock buffer with appropriate size
-	const int32 ElementSize = bIsCompactMode ? sizeof(FCompactParticleStats) : sizeof(FGPUFluidParticle);
-	const int32 BufferSize = ParticleCount * ElementSize;
+	const int32 BufferSize = bIsPackedMode ? Layout.TotalBytes : ParticleCount * static_cast<int32>(sizeof(FGPUFluidParticle));
 	const void* RawData = StatsReadbacks[ReadIdx]->Lock(BufferSize);
 
 	if (RawData && ParticleCount > 0)
 	{
-		// Parallel cache build: local map per chunk → merge
-		// Also extract shadow data (Position, Velocity, NeighborCount) in the same pass
+		// Parallel extraction of shadow data (Position, Velocity, NeighborCount) in one pass
 		const int32 NumChunks = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1, ParticleCount);
 		const int32 ChunkSize = (ParticleCount + NumChunks - 1) / NumChunks;
 
-		// Use fixed-size arrays instead of TMap (SourceID is 0~63 range)
-		constexpr int32 MaxSources = EGPUParticleSource::MaxSourceCount;  // 64
-		TArray<TArray<TArray<int32>>> ChunkSourceArrays;  // [NumChunks][MaxSources][]
-		TArray<TArray<int32>> ChunkAllIDs;
-		ChunkSourceArrays.SetNum(NumChunks);
-		ChunkAllIDs.SetNum(NumChunks);
-		for (int32 c = 0; c < NumChunks; ++c)
+		// Claim a free snapshot slot and fill it in place (no lock shared with readers)
+		// If slow readers pin every spare slot, fill the scratch snapshot so stats still update, but drop the publish
+		FGPUFluidReadbackSnapshot* Snapshot = ReadbackSnapshots.BeginWrite();
+		const bool bPublishSnapshot = Snapshot != nullptr;
+		if (!bPublishSnapshot)
 		{
-			ChunkSourceArrays[c].SetNum(MaxSources);
+			UE_LOG(LogGPUFluidSimulator, Verbose, TEXT("ProcessStatsReadback: all snapshot slots pinned by readers, dropping frame %llu"), StatsReadbackFrameNumbers[ReadIdx]);
+			DroppedReadbackSnapshot.Reset();
+			Snapshot = &DroppedReadbackSnapshot;
 		}
 
-		// Pre-allocate data arrays (will be filled in parallel)
-		// Position/SourceID are ALWAYS copied (needed for lightweight despawn API)
-		// Velocity only when ISM rendering enabled AND not in compact mode
-		// NeighborCount only when shadow readback enabled
-		// Density/VelocityMagnitude/Mass/Flags only when detailed GPU stats enabled (requires full mode)
+		// Detailed stats require full mode (density and mass are never packed)
 		const bool bNeedShadowData = bShadowReadbackEnabled.load();
-		const bool bNeedVelocity = (bFullReadbackEnabled.load() || bNeedShadowData) && !bIsCompactMode;  // Velocity not available in compact mode
-		const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled() && !bIsCompactMode;  // Detailed stats require full mode
-		TArray<FVector3f> NewPositions;
-		TArray<int32> NewSourceIDs;
-		TArray<FVector3f> NewVelocities;
-		TArray<uint32> NewNeighborCounts;
+		const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled() && !bIsPackedMode;
+		TArray<FVector3f>& NewPositions = Snapshot->Positions;
+		TArray<int32>& NewSourceIDs = Snapshot->SourceIDs;
+		TArray<int32>& NewParticleIDs = Snapshot->ParticleIDs;
+		TArray<uint32>& NewNeighborCounts = Snapshot->NeighborCounts;
+		TArray<uint32>& NewFlags = Snapshot->Flags;
 		TArray<float> NewDensities;
 		TArray<float> NewVelocityMagnitudes;
 		TArray<float> NewMasses;
-		TArray<uint32> NewFlags;
-		NewPositions.SetNumUninitialized(ParticleCount);   // Always needed for despawn
-		NewSourceIDs.SetNumUninitialized(ParticleCount);   // Always needed for despawn
-		NewFlags.SetNumUninitialized(ParticleCount);       // Always needed for debug visualization
-		if (bNeedVelocity)
-		{
-			NewVelocities.SetNumUninitialized(ParticleCount);  // ISM rendering
-		}
-		if (bNeedShadowData)
-		{
-			NewNeighborCounts.SetNumUninitialized(ParticleCount);  // Available in both compact and full mode
-		}
-		if (bNeedDetailedStats)
-		{
-			NewDensities.SetNumUninitialized(ParticleCount);
-			NewVelocityMagnitudes.SetNumUninitialized(ParticleCount);
-			NewMasses.SetNumUninitialized(ParticleCount);
-			NewNeighborCounts.SetNumUninitialized(ParticleCount);
-		}
 
-		if (bIsCompactMode)
+		if (bIsPackedMode)
 		{
-			// Compact mode: 32-byte FCompactParticleStats (Position, ParticleID, SourceID, NeighborCount)
-			const FCompactParticleStats* CompactData = static_cast<const FCompactParticleStats*>(RawData);
-
-			ParallelFor(NumChunks, [&](int32 ChunkIndex)
+			// Packed mode: only the streams registered consumers read, unpacked in parallel (SIMD dequantization)
+			const float PackedMaxSpeed = GPUFluidReadbackUnpack::UnpackReadbackFields(Layout, RawData, ParticleCount, *Snapshot);
+			if (PackedMaxSpeed >= 0.0f)
 			{
-				const int32 StartIdx = ChunkIndex * ChunkSize;
-				const int32 EndIdx = FMath::Min(StartIdx + ChunkSize, ParticleCount);
-				if (StartIdx >= EndIdx)
-				{
-					return;
-				}
-
-				auto& LocalSourceArrays = ChunkSourceArrays[ChunkIndex];
-				auto& LocalAllIDs = ChunkAllIDs[ChunkIndex];
-				LocalAllIDs.Reserve(EndIdx - StartIdx);
-
-				for (int32 i = StartIdx; i < EndIdx; ++i)
-				{
-					const FCompactParticleStats& P = CompactData[i];
-					LocalAllIDs.Add(P.ParticleID);
-
-					if (P.SourceID >= 0 && P.SourceID < MaxSources)
-					{
-						LocalSourceArrays[P.SourceID].Add(P.ParticleID);
-					}
-
-					NewPositions[i] = P.Position;
-					NewSourceIDs[i] = P.SourceID;
-					NewFlags[i] = P.Flags;
-
-					// NeighborCount available in compact mode
-					if (bNeedShadowData)
-					{
-						NewNeighborCounts[i] = P.NeighborCount;
-					}
-
-					// Velocity and detailed stats NOT available in compact mode
-				}
-			}, EParallelForFlags::Unbalanced);
+				PublishReadbackMaxVelocity(PackedMaxSpeed);
+			}
 		}
 		else
 		{
+			// Pre-size snapshot arrays (will be filled in parallel)
+			// Position/SourceID/ParticleID/Flags are always copied in full mode
+			// Velocity only when a registered consumer reads it (proxy, shadow, queries)
+			// NeighborCount only when shadow readback enabled
+			// Density/VelocityMagnitude/Mass only when detailed GPU stats enabled
+			const bool bNeedVelocity = (GetReadbackFieldMask() & EGPUReadbackField::Velocity) != 0 || bNeedShadowData || bQueryReadbackEnabled.load();
+			TArray<FVector3f>& NewVelocities = Snapshot->Velocities;
+			NewPositions.SetNumUninitialized(ParticleCount);
+			NewSourceIDs.SetNumUninitialized(ParticleCount);
+			NewParticleIDs.SetNumUninitialized(ParticleCount);
+			NewFlags.SetNumUninitialized(ParticleCount);
+			if (bNeedVelocity)
+			{
+				NewVelocities.SetNumUninitialized(ParticleCount);  // ISM rendering
+			}
+			if (bNeedShadowData || bNeedDetailedStats)
+			{
+				NewNeighborCounts.SetNumUninitialized(ParticleCount);
+			}
+			if (bNeedDetailedStats)
+			{
+				NewDensities.SetNumUninitialized(ParticleCount);
+				NewVelocityMagnitudes.SetNumUninitialized(ParticleCount);
+				NewMasses.SetNumUninitialized(ParticleCount);
+			}
+
 			// Full mode: 64-byte FGPUFluidParticle (all fields)
 			const FGPUFluidParticle* ParticleData = static_cast<const FGPUFluidParticle*>(RawData);
+			TArray<float> ChunkMaxSpeeds;  // Per-chunk max speed for adaptive substeps
+			ChunkMaxSpeeds.SetNumZeroed(NumChunks);
 
 			ParallelFor(NumChunks, [&](int32 ChunkIndex)
 			{
@@ -4153,22 +4639,16 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 					return;
 				}
 
-				auto& LocalSourceArrays = ChunkSourceArrays[ChunkIndex];
-				auto& LocalAllIDs = ChunkAllIDs[ChunkIndex];
-				LocalAllIDs.Reserve(EndIdx - StartIdx);
+				float LocalMaxSpeedSq = 0.0f;
 
 				for (int32 i = StartIdx; i < EndIdx; ++i)
 				{
 					const FGPUFluidParticle& P = ParticleData[i];
-					LocalAllIDs.Add(P.ParticleID);
-
-					if (P.SourceID >= 0 && P.SourceID < MaxSources)
-					{
-						LocalSourceArrays[P.SourceID].Add(P.ParticleID);
-					}
+					LocalMaxSpeedSq = FMath::Max(LocalMaxSpeedSq, P.Velocity.SizeSquared());
 
 					NewPositions[i] = P.Position;
 					NewSourceIDs[i] = P.SourceID;
+					NewParticleIDs[i] = P.ParticleID;
 					NewFlags[i] = P.Flags;
 
 					if (bNeedVelocity)
@@ -4176,7 +4656,7 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 						NewVelocities[i] = P.Velocity;
 					}
 
-					if (bNeedShadowData)
+					if (bNeedShadowData || bNeedDetailedStats)
 					{
 						NewNeighborCounts[i] = P.NeighborCount;
 					}
@@ -4186,47 +4666,29 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 						NewDensities[i] = P.Density;
 						NewVelocityMagnitudes[i] = P.Velocity.Length();
 						NewMasses[i] = P.Mass;
-						NewNeighborCounts[i] = P.NeighborCount;
 					}
 				}
+				ChunkMaxSpeeds[ChunkIndex] = FMath::Sqrt(LocalMaxSpeedSq);
 			}, EParallelForFlags::Unbalanced);
-		}
-
-		// Merge (single thread) - array-based, no hash operations, MoveTemp for zero-copy
-		TArray<TArray<int32>> NewSourceIDArrays;
-		TArray<int32> NewAllParticleIDs;
-		{
-			SCOPED_DRAW_EVENT(RHICmdList, Merge);
-			NewSourceIDArrays.SetNum(MaxSources);
-			NewAllParticleIDs.Reserve(ParticleCount);
 
-			for (int32 c = 0; c < NumChunks; ++c)
+			// Max speed feedback for CFL-driven adaptive substeps
+			float MaxSpeed = 0.0f;
+			for (const float ChunkMaxSpeed : ChunkMaxSpeeds)
 			{
-				NewAllParticleIDs.Append(MoveTemp(ChunkAllIDs[c]));
+				MaxSpeed = FMath::Max(MaxSpeed, ChunkMaxSpeed);
 			}
+			PublishReadbackMaxVelocity(MaxSpeed);
+		}
 
-			// Merge SourceID arrays - chunk-first loop order for cache efficiency
-			for (int32 c = 0; c < NumChunks; ++c)
-			{
-				for (int32 SourceID = 0; SourceID < MaxSources; ++SourceID)
-				{
-					if (ChunkSourceArrays[c][SourceID].Num() > 0)
-					{
-						if (NewSourceIDArrays[SourceID].Num() == 0)
-						{
-							NewSourceIDArrays[SourceID] = MoveTemp(ChunkSourceArrays[c][SourceID]);
-						}
-						else
-						{
-							NewSourceIDArrays[SourceID].Append(MoveTemp(ChunkSourceArrays[c][SourceID]));
-						}
-					}
-				}
-			}
+		// Per-source index: parallel counting sort into the slot's retained flat arrays (only when both ID arrays were read back)
+		if (NewSourceIDs.Num() == ParticleCount && NewParticleIDs.Num() == ParticleCount)
+		{
+			SCOPED_DRAW_EVENT(RHICmdList, SourceIndex);
+			Snapshot->SourceIndex.Build(NewSourceIDs, NewParticleIDs);
 		}
 
 		// Calculate all stats from GPU readback data (only when detailed stats enabled)
-		// IMPORTANT: Must be done BEFORE MoveTemp to avoid accessing moved arrays
+		// IMPORTANT: Must be done BEFORE Publish, readers may pin the snapshot right after
 		if (bNeedDetailedStats && ParticleCount > 0)
 		{
 			// Count attached particles
@@ -4313,32 +4775,13 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 				RestDensity);
 		}
 
-		// Hold lock briefly and swap
+		// Publish with a single atomic swap; readers never wait on this
+		Snapshot->FrameNumber = StatsReadbackFrameNumbers[ReadIdx];
+		if (bPublishSnapshot)
 		{
-			SCOPED_DRAW_EVENT(RHICmdList, Lock);
-			FScopeLock Lock(&BufferLock);
-			CachedSourceIDToParticleIDs = MoveTemp(NewSourceIDArrays);
-			CachedAllParticleIDs = MoveTemp(NewAllParticleIDs);
-			CachedParticlePositions = MoveTemp(NewPositions);    // Always available for despawn API
-			CachedParticleSourceIDs = MoveTemp(NewSourceIDs);    // Always available for despawn API
-			CachedParticleFlags = MoveTemp(NewFlags);            // Always available for debug visualization
-
-			// Velocity for ISM rendering (lightweight API)
-			if (bNeedVelocity)
-			{
-				CachedParticleVelocities = MoveTemp(NewVelocities);
-			}
-
+			SCOPED_DRAW_EVENT(RHICmdList, Publish);
+			ReadbackSnapshots.Publish();
 			bHasValidGPUResults.store(true);
-
-			// NeighborCount only when shadow readback enabled
-			if (bNeedShadowData)
-			{
-				ReadyShadowPositions = CachedParticlePositions;  // Share with despawn data
-				ReadyShadowVelocities = CachedParticleVelocities;  // Share with ISM data
-				ReadyShadowNeighborCounts = MoveTemp(NewNeighborCounts);
-				ReadyShadowPositionsFrame.store(StatsReadbackFrameNumbers[ReadIdx]);
-			}
 		}
 
 		// GPU-driven despawn: no CPU-side cleanup needed
@@ -4376,9 +4819,10 @@ bool FGPUFluidSimulator::GetShadowDataWithAnisotropy(
 		return false;
 	}
 
+	// Anisotropy has its own readback and is still swapped under BufferLock
 	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
 
-	const int32 Count = ReadyShadowPositions.Num();
+	const int32 Count = OutPositions.Num();
 
 	// Check if anisotropy data is available and matches position count
 	if (ReadyShadowAnisotropyAxis1.Num() != Count ||
@@ -565,7 +565,8 @@ void FGPUFluidSimulator::AddFinalizePositionsPass(
  * @param BoneDeltaAttachmentSRV Read-only access to attachment data.
  * @param LocalBoundaryParticlesSRV Read-only access to local boundary data.
  * @param BoundaryParticleCount Number of boundary particles.
- * @param BoneTransformsSRV Read-only access to bone transforms.
+ * @param BoneTransformsSRV Read-only access to the bone arena.
+ * @param BoneOffset First bone of this owner in the arena.
  * @param BoneCount Number of bones in the skeleton.
  * @param ComponentTransform World transform of the component.
  * @param DeltaTime Simulation time step.
@@ -577,6 +578,7 @@ void FGPUFluidSimulator::AddApplyBoneTransformPass(
 	FRDGBufferSRVRef LocalBoundaryParticlesSRV,
 	int32 BoundaryParticleCount,
 	FRDGBufferSRVRef BoneTransformsSRV,
+	int32 BoneOffset,
 	int32 BoneCount,
 	const FMatrix44f& ComponentTransform,
 	float DeltaTime)
@@ -602,6 +604,7 @@ void FGPUFluidSimulator::AddApplyBoneTransformPass(
 	PassParameters->LocalBoundaryParticles = LocalBoundaryParticlesSRV;
 	PassParameters->BoundaryParticleCount = BoundaryParticleCount;
 	PassParameters->BoneTransforms = BoneTransformsSRV;
+	PassParameters->BoneOffset = BoneOffset;
 	PassParameters->BoneCount = BoneCount;
 	PassParameters->ComponentTransform = ComponentTransform;
 	PassParameters->DeltaTime = DeltaTime;
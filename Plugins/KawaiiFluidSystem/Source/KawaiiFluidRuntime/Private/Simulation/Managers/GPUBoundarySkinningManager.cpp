@@ -10,10 +10,21 @@
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "HAL/IConsoleManager.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGPUBoundarySkinning, Log, All);
 DEFINE_LOG_CATEGORY(LogGPUBoundarySkinning);
 
+static float GFluidBoundaryBoneTolerance = 0.01f;
+static FAutoConsoleVariableRef CVarFluidBoundaryBoneTolerance(
+	TEXT("r.Fluid.BoundaryBoneTolerance"),
+	GFluidBoundaryBoneTolerance,
+	TEXT("Bone movement (cm) below which boundary skinning bones are not re-uploaded (default 0.01).\n")
+	TEXT("  Rotation and scale use 1/100 of this value, about the same displacement 1 m from the joint.\n")
+	TEXT("  0 = Upload every change"),
+	ECVF_Default
+);
+
 // Boundary spatial hash constants for Flex-style adhesion
 static constexpr int32 BOUNDARY_HASH_SIZE = 65536;  // 2^16 cells
 static constexpr int32 BOUNDARY_MAX_PARTICLES_PER_CELL = 16;
@@ -70,6 +81,15 @@ void FGPUBoundarySkinningManager::Release()
 	bHasPreviousFrame = false;
 	bBoundarySkinningDataDirty = false;
 
+	// Release bone arena and its snapshots
+	BoneArena.Reset();
+	PersistentBoneArenaBuffer.SafeRelease();
+	BoneArenaBufferCapacity = 0;
+	UploadedBoneArenaLayoutRevision = INDEX_NONE;
+	PendingBoneUploadRanges.Empty();
+	PendingBoneTransformSnapshots.Empty();
+	ActiveSnapshot.Reset();
+
 	// Release Static boundary data
 	PersistentStaticBoundaryBuffer.SafeRelease();
 	PersistentStaticZOrderSorted.SafeRelease();
@@ -556,25 +576,29 @@ void FGPUBoundarySkinningManager::UploadLocalBoundaryParticles(int32 OwnerID, co
 
 /**
  * @brief Upload bone transforms for boundary skinning.
+ * Matrices are stored in the bone arena as rotation, translation and scale; bones within
+ * r.Fluid.BoundaryBoneTolerance of the stored ones are not re-uploaded.
  * @param OwnerID Unique ID for the mesh owner.
  * @param BoneTransforms Current bone transforms.
  * @param ComponentTransform Component world transform.
  */
 void FGPUBoundarySkinningManager::UploadBoneTransformsForBoundary(int32 OwnerID, const TArray<FMatrix44f>& BoneTransforms, const FMatrix44f& ComponentTransform)
 {
-	if (!bIsInitialized)
+	check(IsInGameThread());
+
+	if (!bIsInitialized || !BoundarySkinningDataMap.Contains(OwnerID))
 	{
 		return;
 	}
 
-	FScopeLock Lock(&BoundarySkinningLock);
-
-	FGPUBoundarySkinningData* SkinningData = BoundarySkinningDataMap.Find(OwnerID);
-	if (SkinningData)
+	ScratchBoneTransforms.SetNum(BoneTransforms.Num(), EAllowShrinking::No);
+	for (int32 BoneIdx = 0; BoneIdx < BoneTransforms.Num(); ++BoneIdx)
 	{
-		SkinningData->BoneTransforms = BoneTransforms;
-		SkinningData->ComponentTransform = ComponentTransform;
+		ScratchBoneTransforms[BoneIdx].SetFromTransform(FTransform(FMatrix(BoneTransforms[BoneIdx])));
 	}
+
+	BoneArena.WriteOwner(OwnerID, ScratchBoneTransforms, ComponentTransform,
+		GFluidBoundaryBoneTolerance, GFluidBoundaryBoneTolerance * 0.01f);
 }
 
 /**
@@ -608,20 +632,30 @@ void FGPUBoundarySkinningManager::RegisterSkeletalMeshReference(int32 OwnerID, U
 }
 
 /**
- * @brief Refresh bone transforms from all registered skeletal meshes.
+ * @brief Refresh bone transforms from all registered skeletal meshes and snapshot them for the pending simulation.
+ * Only owners whose bones moved beyond r.Fluid.BoundaryBoneTolerance dirty the bone arena, so the upload
+ * scales with animated characters rather than all characters.
  */
 void FGPUBoundarySkinningManager::RefreshAllBoneTransforms()
 {
 	// MUST be called on Game Thread, right before render thread starts
 	check(IsInGameThread());
 
-	// NOTE: We do NOT lock here for reading SkeletalMeshRef because:
+	// NOTE: We do NOT lock here because:
 	// 1. Registration happens on Game Thread before this is called
 	// 2. The map structure doesn't change during this function
-	// 3. We use atomic operations for the buffer swap which is lock-free
+	// 3. The bone arena is only written on the Game Thread; the Render Thread reads snapshots
+
+	if (BoundarySkinningDataMap.Num() == 0)
+	{
+		return;
+	}
 
-	static uint64 FrameCounter = 0;
-	FrameCounter++;
+	TRACE_CPUPROFILER_EVENT_SCOPE(GPUBoundarySkinning_RefreshAllBoneTransforms);
+
+	const float PositionTolerance = FMath::Max(GFluidBoundaryBoneTolerance, 0.0f);
+	const float RotationTolerance = PositionTolerance * 0.01f;
+	int32 ChangedOwnerCount = 0;
 
 	for (auto& Pair : BoundarySkinningDataMap)
 	{
@@ -635,83 +669,70 @@ void FGPUBoundarySkinningManager::RefreshAllBoneTransforms()
 			// matching exactly what the skeletal mesh will render with.
 			SkelMesh->FinalizeBoneTransform();
 
-			// =====================================================================
-			// DOUBLE BUFFER: Write to current write buffer
-			// Game Thread writes to Buffer[WriteIndex]
-			// After writing, swap WriteIndex so Render Thread sees completed data
-			// =====================================================================
-			const int32 WriteIdx = SkinningData.WriteBufferIndex;
-
 			// Read bone transforms after finalization
 			const int32 NumBones = SkelMesh->GetNumBones();
-			SkinningData.BoneTransformsBuffer[WriteIdx].SetNum(NumBones);
+			ScratchBoneTransforms.SetNum(NumBones, EAllowShrinking::No);
 
 			for (int32 BoneIdx = 0; BoneIdx < NumBones; ++BoneIdx)
 			{
-				FTransform BoneWorldTransform = SkelMesh->GetBoneTransform(BoneIdx);
-				SkinningData.BoneTransformsBuffer[WriteIdx][BoneIdx] = FMatrix44f(BoneWorldTransform.ToMatrixWithScale());
+				ScratchBoneTransforms[BoneIdx].SetFromTransform(SkelMesh->GetBoneTransform(BoneIdx));
 			}
 
-			SkinningData.ComponentTransformBuffer[WriteIdx] = FMatrix44f(SkelMesh->GetComponentTransform().ToMatrixWithScale());
-
-			// SWAP: Now render thread will read from the buffer we just wrote
-			SkinningData.WriteBufferIndex = 1 - WriteIdx;
-
-			// DEBUG: Log bone 0 position every 60 frames
-			if (FrameCounter % 60 == 0 && NumBones > 0)
+			const FMatrix44f ComponentTransform(SkelMesh->GetComponentTransform().ToMatrixWithScale());
+			if (BoneArena.WriteOwner(Pair.Key, ScratchBoneTransforms, ComponentTransform, PositionTolerance, RotationTolerance))
 			{
-				FVector Bone0Pos = SkelMesh->GetBoneTransform(0).GetLocation();
-				UE_LOG(LogGPUBoundarySkinning, Warning,
-					TEXT("[GameThread Frame %llu] RefreshAllBoneTransforms: WriteIdx=%d, Bone0 = (%.2f, %.2f, %.2f)"),
-					FrameCounter, WriteIdx, Bone0Pos.X, Bone0Pos.Y, Bone0Pos.Z);
+				++ChangedOwnerCount;
 			}
 		}
 	}
 
-	UE_LOG(LogGPUBoundarySkinning, VeryVerbose, TEXT("RefreshAllBoneTransforms: Updated %d owners"),
-		BoundarySkinningDataMap.Num());
+	SnapshotBoneTransformsForPendingSimulation();
+
+	UE_LOG(LogGPUBoundarySkinning, VeryVerbose, TEXT("RefreshAllBoneTransforms: %d of %d owners changed"),
+		ChangedOwnerCount, BoundarySkinningDataMap.Num());
 }
 
-const TArray<FMatrix44f>* FGPUBoundarySkinningManager::GetBoneTransforms(int32 OwnerID) const
+/**
+ * @brief Decoded bone matrices of one owner from the bone arena.
+ * @param OwnerID Unique ID.
+ * @param OutBoneTransforms Bone matrices.
+ * @return False if the owner has no bones.
+ */
+bool FGPUBoundarySkinningManager::GetBoneTransforms(int32 OwnerID, TArray<FMatrix44f>& OutBoneTransforms) const
 {
-	FScopeLock Lock(&BoundarySkinningLock);
+	check(IsInGameThread());
 
-	const FGPUBoundarySkinningData* SkinningData = BoundarySkinningDataMap.Find(OwnerID);
-	if (SkinningData && SkinningData->BoneTransforms.Num() > 0)
+	const TConstArrayView<FGPUBoundaryBoneTransform> Bones = BoneArena.GetOwnerBones(OwnerID);
+	OutBoneTransforms.Reset(Bones.Num());
+	for (const FGPUBoundaryBoneTransform& Bone : Bones)
 	{
-		return &SkinningData->BoneTransforms;
+		OutBoneTransforms.Add(Bone.ToMatrix());
 	}
-	return nullptr;
+	return OutBoneTransforms.Num() > 0;
 }
 
-const TArray<FMatrix44f>* FGPUBoundarySkinningManager::GetFirstAvailableBoneTransforms(int32* OutOwnerID) const
+bool FGPUBoundarySkinningManager::GetFirstAvailableBoneTransforms(TArray<FMatrix44f>& OutBoneTransforms, int32* OutOwnerID) const
 {
-	FScopeLock Lock(&BoundarySkinningLock);
+	check(IsInGameThread());
 
-	for (const auto& Pair : BoundarySkinningDataMap)
+	for (const auto& Pair : BoneArena.GetOwners())
 	{
-		if (Pair.Value.BoneTransforms.Num() > 0)
+		if (Pair.Value.Count > 0 && GetBoneTransforms(Pair.Key, OutBoneTransforms))
 		{
 			if (OutOwnerID)
 			{
 				*OutOwnerID = Pair.Key;
 			}
-			return &Pair.Value.BoneTransforms;
+			return true;
 		}
 	}
-	return nullptr;
+	return false;
 }
 
 int32 FGPUBoundarySkinningManager::GetBoneCount(int32 OwnerID) const
 {
-	FScopeLock Lock(&BoundarySkinningLock);
-
-	const FGPUBoundarySkinningData* SkinningData = BoundarySkinningDataMap.Find(OwnerID);
-	if (SkinningData)
-	{
-		return SkinningData->BoneTransforms.Num();
-	}
-	return 0;
+	const FGPUBoundaryBoneOwner* Owner = BoneArena.FindOwner(OwnerID);
+	return Owner ? Owner->Count : 0;
 }
 
 /**
@@ -725,6 +746,7 @@ void FGPUBoundarySkinningManager::RemoveBoundarySkinningData(int32 OwnerID)
 	if (BoundarySkinningDataMap.Remove(OwnerID) > 0)
 	{
 		PersistentLocalBoundaryBuffers.Remove(OwnerID);
+		BoneArena.RemoveOwner(OwnerID);
 
 		TotalLocalBoundaryParticleCount = 0;
 		for (const auto& Pair : BoundarySkinningDataMap)
@@ -760,6 +782,12 @@ void FGPUBoundarySkinningManager::ClearAllBoundarySkinningData()
 	bHasPreviousFrame = false;
 	bBoundarySkinningDataDirty = true;
 
+	// Pending snapshots keep the old arena alive until dropped; the layout revision forces a full upload
+	BoneArena.Reset();
+	PendingBoneTransformSnapshots.Empty();
+	ActiveSnapshot.Reset();
+	PendingBoneUploadRanges.Empty();
+
 	// Clear AABB data
 	BoundaryOwnerAABBs.Empty();
 	CombinedBoundaryAABB = FGPUBoundaryOwnerAABB();
@@ -894,6 +922,7 @@ bool FGPUBoundarySkinningManager::ShouldSkipBoundaryAdhesionPass(const FGPUFluid
 /**
  * @brief Add boundary skinning pass.
  * @param GraphBuilder RDG builder.
+ * @param BoneArenaBuffer Bone arena of this substep, from PrepareBoneArena.
  * @param OutWorldBoundaryBuffer Output world-space boundary buffer.
  * @param OutBoundaryParticleCount Output particle count.
  * @param DeltaTime Frame delta time.
@@ -901,6 +930,7 @@ bool FGPUBoundarySkinningManager::ShouldSkipBoundaryAdhesionPass(const FGPUFluid
  */
 void FGPUBoundarySkinningManager::AddBoundarySkinningPass(
 	FRDGBuilder& GraphBuilder,
+	FRDGBufferRef BoneArenaBuffer,
 	FRDGBufferRef& OutWorldBoundaryBuffer,
 	int32& OutBoundaryParticleCount,
 	float DeltaTime,
@@ -926,15 +956,19 @@ void FGPUBoundarySkinningManager::AddBoundarySkinningPass(
 	{
 		OutSkinningOutputs->LocalBoundaryParticlesBuffer = nullptr;
 		OutSkinningOutputs->BoneTransformsBuffer = nullptr;
+		OutSkinningOutputs->BoneOffset = 0;
 		OutSkinningOutputs->BoneCount = 0;
 		OutSkinningOutputs->ComponentTransform = FMatrix44f::Identity;
 	}
 
-	if (TotalLocalBoundaryParticleCount <= 0 || BoundarySkinningDataMap.Num() == 0)
+	if (!BoneArenaBuffer || TotalLocalBoundaryParticleCount <= 0 || BoundarySkinningDataMap.Num() == 0 || !ActiveSnapshot.IsSet())
 	{
 		return;
 	}
 
+	FRDGBufferSRVRef BoneArenaSRV = GraphBuilder.CreateSRV(BoneArenaBuffer);
+	const FGPUBoundaryBoneArenaSnapshot& Snapshot = ActiveSnapshot.GetValue();
+
 	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
 	TShaderMapRef<FBoundarySkinningCS> SkinningShader(ShaderMap);
 
@@ -1026,39 +1060,8 @@ void FGPUBoundarySkinningManager::AddBoundarySkinningPass(
 		}
 		FRDGBufferSRVRef LocalBoundarySRV = GraphBuilder.CreateSRV(LocalBoundaryBuffer);
 
-		// =====================================================================
-		// NO DOUBLE BUFFER - DIRECT ACCESS
-		// The double buffer swap timing is complex and error-prone.
-		// Instead, just read the bone transforms directly from the skeletal mesh
-		// component reference at render thread time.
-		// =====================================================================
-
-		// Get fresh bone transforms directly from the skeletal mesh
-		// This bypasses the double buffer entirely
-		const TArray<FMatrix44f>* BoneTransformsPtr = nullptr;
-		FMatrix44f ComponentTransformToUse = FMatrix44f::Identity;
-
-		// First try the double buffer (for compatibility)
-		const int32 WriteIdx = SkinningData.WriteBufferIndex;
-		const int32 ReadIdx = 1 - WriteIdx;
-
-		if (SkinningData.BoneTransformsBuffer[ReadIdx].Num() > 0)
-		{
-			BoneTransformsPtr = &SkinningData.BoneTransformsBuffer[ReadIdx];
-			ComponentTransformToUse = SkinningData.ComponentTransformBuffer[ReadIdx];
-		}
-		else if (SkinningData.BoneTransformsBuffer[WriteIdx].Num() > 0)
-		{
-			BoneTransformsPtr = &SkinningData.BoneTransformsBuffer[WriteIdx];
-			ComponentTransformToUse = SkinningData.ComponentTransformBuffer[WriteIdx];
-		}
-		else if (SkinningData.BoneTransforms.Num() > 0)
-		{
-			BoneTransformsPtr = &SkinningData.BoneTransforms;
-			ComponentTransformToUse = SkinningData.ComponentTransform;
-		}
-
-		if (!BoneTransformsPtr || BoneTransformsPtr->Num() == 0)
+		const FGPUBoundaryBoneOwner* BoneOwner = Snapshot.Owners.Find(OwnerID);
+		if (!BoneOwner || BoneOwner->Count == 0)
 		{
 			UE_LOG(LogGPUBoundarySkinning, Warning,
 				TEXT("[AddBoundarySkinningPass] No bone transforms available for Owner=%d, skipping"),
@@ -1066,60 +1069,19 @@ void FGPUBoundarySkinningManager::AddBoundarySkinningPass(
 			continue;
 		}
 
-		// DEBUG: Log bone 0 position on render thread
-		static uint64 RenderFrameCounter = 0;
-		RenderFrameCounter++;
-		if (RenderFrameCounter % 60 == 0 && BoneTransformsPtr->Num() > 0)
-		{
-			const FMatrix44f& Bone0Matrix = (*BoneTransformsPtr)[0];
-			FVector3f Bone0Pos = FVector3f(Bone0Matrix.M[3][0], Bone0Matrix.M[3][1], Bone0Matrix.M[3][2]);
-			UE_LOG(LogGPUBoundarySkinning, Warning,
-				TEXT("[RenderThread Frame %llu] AddBoundarySkinningPass: ReadIdx=%d, Bone0 = (%.2f, %.2f, %.2f)"),
-				RenderFrameCounter, ReadIdx, Bone0Pos.X, Bone0Pos.Y, Bone0Pos.Z);
-		}
-
-		// Upload bone transforms
-		FRDGBufferRef BoneTransformsBuffer;
-		const int32 BoneCount = BoneTransformsPtr->Num();
-		if (BoneCount > 0)
-		{
-			// CRITICAL: Do NOT use NoCopy flag!
-			// With NoCopy, RDG keeps a pointer to source data which may be overwritten
-			// by the next frame before GPU actually uses it, causing 1-frame delay.
-			// Force immediate copy to ensure GPU uses THIS frame's bone transforms.
-			BoneTransformsBuffer = CreateStructuredBuffer(
-				GraphBuilder,
-				TEXT("GPUFluidBoneTransforms"),
-				sizeof(FMatrix44f),
-				BoneCount,
-				BoneTransformsPtr->GetData(),
-				BoneCount * sizeof(FMatrix44f)
-				// No flags = immediate copy
-			);
-		}
-		else
-		{
-			FMatrix44f Identity = FMatrix44f::Identity;
-			BoneTransformsBuffer = CreateStructuredBuffer(
-				GraphBuilder,
-				TEXT("GPUFluidBoneTransforms"),
-				sizeof(FMatrix44f),
-				1,
-				&Identity,
-				sizeof(FMatrix44f)
-				// No flags = immediate copy
-			);
-		}
-		FRDGBufferSRVRef SkinningBoneTransformsSRV = GraphBuilder.CreateSRV(BoneTransformsBuffer);
+		const int32 BoneOffset = BoneOwner->Offset;
+		const int32 BoneCount = BoneOwner->Count;
+		const FMatrix44f& ComponentTransformToUse = BoneOwner->ComponentTransform;
 
 		// Setup skinning shader parameters
 		FBoundarySkinningCS::FParameters* PassParams = GraphBuilder.AllocParameters<FBoundarySkinningCS::FParameters>();
 		PassParams->LocalBoundaryParticles = LocalBoundarySRV;
 		PassParams->WorldBoundaryParticles = WorldBoundaryUAV;
 		PassParams->PreviousWorldBoundaryParticles = PreviousBoundarySRV;
-		PassParams->BoneTransforms = SkinningBoneTransformsSRV;
+		PassParams->BoneTransforms = BoneArenaSRV;
 		PassParams->BoundaryParticleCount = LocalParticleCount;
-		PassParams->BoneCount = FMath::Max(1, BoneCount);
+		PassParams->BoneOffset = BoneOffset;
+		PassParams->BoneCount = BoneCount;
 		PassParams->OwnerID = OwnerID;
 		PassParams->bHasPreviousFrame = bHasPreviousFrame ? 1 : 0;
 		PassParams->ComponentTransform = ComponentTransformToUse;
@@ -1144,7 +1106,8 @@ void FGPUBoundarySkinningManager::AddBoundarySkinningPass(
 		if (OutSkinningOutputs)
 		{
 			OutSkinningOutputs->LocalBoundaryParticlesBuffer = LocalBoundaryBuffer;
-			OutSkinningOutputs->BoneTransformsBuffer = BoneTransformsBuffer;
+			OutSkinningOutputs->BoneTransformsBuffer = BoneArenaBuffer;
+			OutSkinningOutputs->BoneOffset = BoneOffset;
 			OutSkinningOutputs->BoneCount = BoneCount;
 			OutSkinningOutputs->ComponentTransform = ComponentTransformToUse;
 		}
@@ -1875,48 +1838,21 @@ bool FGPUBoundarySkinningManager::ExecuteBoundaryZOrderSort(
 
 /**
  * @brief Snapshot current bone transforms for deferred simulation execution.
+ * The snapshot shares the arena's bone array; the arena copies it only if written again while shared.
  */
 void FGPUBoundarySkinningManager::SnapshotBoneTransformsForPendingSimulation()
 {
-	FScopeLock Lock(&BoundarySkinningLock);
-
-	FBoneTransformSnapshot Snapshot;
-
-	// Deep copy the current skinning data map
-	// Note: With atomic swap double buffer, we read from the completed buffer
-	for (const auto& Pair : BoundarySkinningDataMap)
-	{
-		FBoneTransformSnapshotData DataCopy;
-		DataCopy.OwnerID = Pair.Value.OwnerID;
-		// Don't copy LocalParticles - they're persistent and don't change per frame
-		// Only copy the bone transforms which change every frame
-
-		// Read from the completed buffer (opposite of WriteBufferIndex)
-		const int32 WriteIdx = Pair.Value.WriteBufferIndex;
-		const int32 ReadIdx = 1 - WriteIdx;
+	check(IsInGameThread());
 
-		// Copy from double buffer to snapshot
-		if (Pair.Value.BoneTransformsBuffer[ReadIdx].Num() > 0)
-		{
-			DataCopy.BoneTransforms = Pair.Value.BoneTransformsBuffer[ReadIdx];
-			DataCopy.ComponentTransform = Pair.Value.ComponentTransformBuffer[ReadIdx];
-		}
-		else if (Pair.Value.BoneTransformsBuffer[WriteIdx].Num() > 0)
-		{
-			// Fallback to write buffer if read buffer is empty (first frame)
-			DataCopy.BoneTransforms = Pair.Value.BoneTransformsBuffer[WriteIdx];
-			DataCopy.ComponentTransform = Pair.Value.ComponentTransformBuffer[WriteIdx];
-		}
-		else
-		{
-			// Last resort: legacy fields
-			DataCopy.BoneTransforms = Pair.Value.BoneTransforms;
-			DataCopy.ComponentTransform = Pair.Value.ComponentTransform;
-		}
+	FGPUBoundaryBoneArenaSnapshot Snapshot = BoneArena.TakeSnapshot();
 
-		DataCopy.bLocalParticlesUploaded = Pair.Value.bLocalParticlesUploaded;
+	FScopeLock Lock(&BoundarySkinningLock);
 
-		Snapshot.SkinningDataSnapshot.Add(Pair.Key, MoveTemp(DataCopy));
+	// Render thread is not consuming (skinning disabled): fold the oldest snapshot's dirty ranges into the upload queue
+	while (PendingBoneTransformSnapshots.Num() >= MaxPendingBoneSnapshots)
+	{
+		PendingBoneUploadRanges.Append(PendingBoneTransformSnapshots[0].DirtyRanges);
+		PendingBoneTransformSnapshots.RemoveAt(0);
 	}
 
 	PendingBoneTransformSnapshots.Add(MoveTemp(Snapshot));
@@ -1927,7 +1863,9 @@ void FGPUBoundarySkinningManager::SnapshotBoneTransformsForPendingSimulation()
 }
 
 /**
- * @brief Pop and activate a snapshotted bone transform for execution.
+ * @brief Activate the newest snapshotted bone transforms for execution.
+ * Snapshots queued while the render side was not consuming (no particles yet, volume drained) are skipped, and
+ * their dirty ranges are merged into the activated one so the arena upload still covers them.
  * @return true if a snapshot was available and is now active.
  */
 bool FGPUBoundarySkinningManager::PopAndActivateSnapshot()
@@ -1940,13 +1878,26 @@ bool FGPUBoundarySkinningManager::PopAndActivateSnapshot()
 		return false;
 	}
 
-	// Pop the first snapshot and activate it
-	ActiveSnapshot = MoveTemp(PendingBoneTransformSnapshots[0]);
-	PendingBoneTransformSnapshots.RemoveAt(0);
+	// Activate the newest snapshot so skinning never lags behind the game thread; its changes, and those of
+	// the snapshots it replaces, go out with the next arena upload
+	const int32 NumSkipped = PendingBoneTransformSnapshots.Num() - 1;
+	FGPUBoundaryBoneArenaSnapshot Newest = MoveTemp(PendingBoneTransformSnapshots.Last());
+	for (int32 SnapshotIdx = 0; SnapshotIdx < NumSkipped; ++SnapshotIdx)
+	{
+		Newest.DirtyRanges.Append(PendingBoneTransformSnapshots[SnapshotIdx].DirtyRanges);
+	}
+	if (NumSkipped > 0)
+	{
+		FGPUBoundaryBoneRange::Coalesce(Newest.DirtyRanges);
+	}
+	PendingBoneTransformSnapshots.Reset();
+
+	ActiveSnapshot = MoveTemp(Newest);
+	PendingBoneUploadRanges.Append(ActiveSnapshot.GetValue().DirtyRanges);
 
 	UE_LOG(LogGPUBoundarySkinning, Verbose,
-		TEXT("PopAndActivateSnapshot: Activated snapshot, remaining=%d"),
-		PendingBoneTransformSnapshots.Num());
+		TEXT("PopAndActivateSnapshot: Activated newest snapshot, skipped=%d"),
+		NumSkipped);
 
 	return true;
 }
@@ -1960,7 +1911,7 @@ void FGPUBoundarySkinningManager::ClearActiveSnapshot()
 	ActiveSnapshot.Reset();
 }
 
-const FGPUBoundarySkinningManager::FBoneTransformSnapshotData* FGPUBoundarySkinningManager::GetActiveSnapshotData(int32 OwnerID) const
+const FGPUBoundaryBoneOwner* FGPUBoundarySkinningManager::GetActiveSnapshotData(int32 OwnerID) const
 {
 	// Note: Lock should already be held by caller or this should be called from within a locked context
 	if (!ActiveSnapshot.IsSet())
@@ -1968,7 +1919,123 @@ const FGPUBoundarySkinningManager::FBoneTransformSnapshotData* FGPUBoundarySkinn
 		return nullptr;
 	}
 
-	const FBoneTransformSnapshotData* Data = ActiveSnapshot.GetValue().SkinningDataSnapshot.Find(OwnerID);
-	return Data;
+	return ActiveSnapshot.GetValue().Owners.Find(OwnerID);
+}
+
+/**
+ * @brief Activate the bones captured when this simulation was enqueued and bring the GPU bone arena up to date.
+ * The previous snapshot stays active if none is pending (later substeps of the same frame).
+ * @param GraphBuilder RDG builder.
+ * @return Bone arena buffer, or nullptr if there is nothing to skin.
+ */
+FRDGBufferRef FGPUBoundarySkinningManager::PrepareBoneArena(FRDGBuilder& GraphBuilder)
+{
+	FScopeLock Lock(&BoundarySkinningLock);
+
+	PopAndActivateSnapshot();
+
+	if (TotalLocalBoundaryParticleCount <= 0 || BoundarySkinningDataMap.Num() == 0 || !ActiveSnapshot.IsSet())
+	{
+		return nullptr;
+	}
+
+	// One persistent buffer for every owner's bones, patched with the ranges that moved
+	return UploadBoneArena(GraphBuilder);
+}
+
+/**
+ * @brief Bring the GPU bone arena up to date with the active snapshot.
+ *
+ * The whole arena is uploaded when the buffer is missing, too small or laid out differently (compaction);
+ * otherwise only the dirty ranges of the snapshots consumed since the last upload are packed into one
+ * upload buffer and copied into place. Caller holds BoundarySkinningLock and has an active snapshot.
+ * @param GraphBuilder RDG builder.
+ * @return Bone arena buffer.
+ */
+FRDGBufferRef FGPUBoundarySkinningManager::UploadBoneArena(FRDGBuilder& GraphBuilder)
+{
+	const FGPUBoundaryBoneArenaSnapshot& Snapshot = ActiveSnapshot.GetValue();
+	const TArray<FGPUBoundaryBoneTransform>& Bones = *Snapshot.Bones;
+	constexpr uint32 BoneStride = sizeof(FGPUBoundaryBoneTransform);
+
+	const bool bFullUpload = !PersistentBoneArenaBuffer.IsValid()
+		|| Bones.Num() > BoneArenaBufferCapacity
+		|| static_cast<int64>(Snapshot.LayoutRevision) != UploadedBoneArenaLayoutRevision;
+
+	FRDGBufferRef BoneArenaBuffer;
+	int32 UploadedBoneCount = 0;
+
+	if (bFullUpload)
+	{
+		// Geometric growth so characters joining one by one do not reallocate every time
+		if (Bones.Num() > BoneArenaBufferCapacity)
+		{
+			BoneArenaBufferCapacity = FMath::RoundUpToPowerOfTwo(FMath::Max(Bones.Num(), 64));
+		}
+		BoneArenaBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(BoneStride, BoneArenaBufferCapacity),
+			TEXT("GPUFluidBoneArena"));
+		// Converted now rather than extracted, so later substeps in this graph register the new buffer
+		PersistentBoneArenaBuffer = GraphBuilder.ConvertToExternalBuffer(BoneArenaBuffer);
+
+		// Must upload at least one element so RDG marks a new buffer as produced
+		static const FGPUBoundaryBoneTransform IdentityBone;
+		const bool bHasBones = Bones.Num() > 0;
+		GraphBuilder.QueueBufferUpload(BoneArenaBuffer,
+			bHasBones ? static_cast<const void*>(Bones.GetData()) : &IdentityBone,
+			(bHasBones ? Bones.Num() : 1) * BoneStride);
+		UploadedBoneCount = Bones.Num();
+	}
+	else
+	{
+		BoneArenaBuffer = GraphBuilder.RegisterExternalBuffer(PersistentBoneArenaBuffer, TEXT("GPUFluidBoneArena"));
+
+		FGPUBoundaryBoneRange::Coalesce(PendingBoneUploadRanges);
+		int32 UploadCount = 0;
+		for (FGPUBoundaryBoneRange& Range : PendingBoneUploadRanges)
+		{
+			Range.Num = FMath::Clamp(Bones.Num() - Range.Start, 0, Range.Num);
+			UploadCount += Range.Num;
+		}
+
+		if (UploadCount > 0)
+		{
+			TArray<FGPUBoundaryBoneTransform> Staging;
+			Staging.Reserve(UploadCount);
+			for (const FGPUBoundaryBoneRange& Range : PendingBoneUploadRanges)
+			{
+				Staging.Append(Bones.GetData() + Range.Start, Range.Num);
+			}
+
+			FRDGBufferRef StagingBuffer = CreateStructuredBuffer(
+				GraphBuilder,
+				TEXT("GPUFluidBoneArenaUpload"),
+				BoneStride,
+				UploadCount,
+				Staging.GetData(),
+				UploadCount * BoneStride
+				// No flags = immediate copy
+			);
+
+			int32 StagingOffset = 0;
+			for (const FGPUBoundaryBoneRange& Range : PendingBoneUploadRanges)
+			{
+				if (Range.Num > 0)
+				{
+					AddCopyBufferPass(GraphBuilder, BoneArenaBuffer, Range.Start * BoneStride, StagingBuffer, StagingOffset * BoneStride, Range.Num * BoneStride);
+					StagingOffset += Range.Num;
+				}
+			}
+		}
+		UploadedBoneCount = UploadCount;
+	}
+
+	PendingBoneUploadRanges.Reset();
+	UploadedBoneArenaLayoutRevision = Snapshot.LayoutRevision;
+
+	UE_LOG(LogGPUBoundarySkinning, VeryVerbose, TEXT("UploadBoneArena: %s, %d of %d bones (%d bytes)"),
+		bFullUpload ? TEXT("full") : TEXT("delta"), UploadedBoneCount, Bones.Num(), UploadedBoneCount * BoneStride);
+
+	return BoneArenaBuffer;
 }
 
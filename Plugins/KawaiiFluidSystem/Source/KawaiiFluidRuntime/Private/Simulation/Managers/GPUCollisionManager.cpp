@@ -13,6 +13,52 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogGPUCollisionManager, Log, All);
 DEFINE_LOG_CATEGORY(LogGPUCollisionManager);
 
+namespace
+{
+	/**
+	 * @brief Replaces the cached copy of a primitive array only if its bytes differ.
+	 * @param Cached Cached array
+	 * @param Incoming New data
+	 * @return True if the cached array changed
+	 */
+	template<typename ElementType>
+	bool AssignIfChanged(TArray<ElementType>& Cached, const TArray<ElementType>& Incoming)
+	{
+		if (Cached.Num() == Incoming.Num() &&
+			FMemory::Memcmp(Cached.GetData(), Incoming.GetData(), Incoming.Num() * sizeof(ElementType)) == 0)
+		{
+			return false;
+		}
+		Cached = Incoming;
+		return true;
+	}
+
+	/**
+	 * @brief Uploads a primitive array into a new persistent structured buffer (one dummy element when empty).
+	 * @param GraphBuilder RDG builder.
+	 * @param Name Buffer name.
+	 * @param Data Primitive data, copied at call time.
+	 * @return Pooled buffer.
+	 */
+	template<typename ElementType>
+	TRefCountPtr<FRDGPooledBuffer> UploadPersistentBuffer(FRDGBuilder& GraphBuilder, const TCHAR* Name, const TArray<ElementType>& Data)
+	{
+		// Shader requires all SRVs to be valid
+		static ElementType DummyElement;
+
+		const bool bHasData = Data.Num() > 0;
+		FRDGBufferRef Buffer = CreateStructuredBuffer(
+			GraphBuilder,
+			Name,
+			sizeof(ElementType),
+			bHasData ? Data.Num() : 1,
+			bHasData ? Data.GetData() : &DummyElement,
+			bHasData ? Data.Num() * sizeof(ElementType) : sizeof(ElementType)
+		);
+		return GraphBuilder.ConvertToExternalBuffer(Buffer);
+	}
+}
+
 //=============================================================================
 // Constructor / Destructor
 //=============================================================================
@@ -73,6 +119,14 @@ void FGPUCollisionManager::Release()
 	CachedConvexPlanes.Empty();
 	CachedBoneTransforms.Empty();
 
+	// Release persistent primitive buffers
+	SpheresPooledBuffer.SafeRelease();
+	CapsulesPooledBuffer.SafeRelease();
+	BoxesPooledBuffer.SafeRelease();
+	ConvexesPooledBuffer.SafeRelease();
+	ConvexPlanesPooledBuffer.SafeRelease();
+	BoneTransformsPooledBuffer.SafeRelease();
+
 	// Release heightmap texture
 	HeightmapTextureRHI.SafeRelease();
 	bHeightmapDataValid = false;
@@ -91,6 +145,8 @@ void FGPUCollisionManager::Release()
 /**
  * @brief Upload collision primitives to GPU.
  * @param Primitives Collection of collision primitives.
+ * 
+ * Data identical to the previous upload (colliders at rest) keeps the persistent GPU buffers as they are.
  */
 void FGPUCollisionManager::UploadCollisionPrimitives(const FGPUCollisionPrimitives& Primitives)
 {
@@ -101,13 +157,17 @@ void FGPUCollisionManager::UploadCollisionPrimitives(const FGPUCollisionPrimitiv
 
 	FScopeLock Lock(&CollisionLock);
 
-	// Cache the primitive data (will be uploaded to GPU during simulation)
-	CachedSpheres = Primitives.Spheres;
-	CachedCapsules = Primitives.Capsules;
-	CachedBoxes = Primitives.Boxes;
-	CachedConvexHeaders = Primitives.Convexes;
-	CachedConvexPlanes = Primitives.ConvexPlanes;
-	CachedBoneTransforms = Primitives.BoneTransforms;
+	// Cache the primitive data (will be uploaded to GPU during simulation if it changed)
+	bool bChanged = AssignIfChanged(CachedSpheres, Primitives.Spheres);
+	bChanged |= AssignIfChanged(CachedCapsules, Primitives.Capsules);
+	bChanged |= AssignIfChanged(CachedBoxes, Primitives.Boxes);
+	bChanged |= AssignIfChanged(CachedConvexHeaders, Primitives.Convexes);
+	bChanged |= AssignIfChanged(CachedConvexPlanes, Primitives.ConvexPlanes);
+	bChanged |= AssignIfChanged(CachedBoneTransforms, Primitives.BoneTransforms);
+	if (bChanged)
+	{
+		++PrimitivesRevision;
+	}
 
 	// Check if we have any primitives
 	if (Primitives.IsEmpty())
@@ -214,105 +274,35 @@ void FGPUCollisionManager::AddPrimitiveCollisionPass(
 		return;
 	}
 
-	FRDGBufferSRVRef SpheresSRV = nullptr;
-	FRDGBufferSRVRef CapsulesSRV = nullptr;
-	FRDGBufferSRVRef BoxesSRV = nullptr;
-	FRDGBufferSRVRef ConvexesSRV = nullptr;
-	FRDGBufferSRVRef ConvexPlanesSRV = nullptr;
-	FRDGBufferSRVRef BoneTransformsSRV = nullptr;
-
-	// Dummy data for empty buffers (shader requires all SRVs to be valid)
-	static FGPUCollisionSphere DummySphere;
-	static FGPUCollisionCapsule DummyCapsule;
-	static FGPUCollisionBox DummyBox;
-	static FGPUCollisionConvex DummyConvex;
-	static FGPUConvexPlane DummyPlane;
-	static FGPUBoneTransform DummyBone;
-
-	// Create RDG buffers from cached data (or dummy for empty arrays)
+	// Re-upload the persistent primitive buffers only when the game thread submitted different data
+	const uint32 Revision = PrimitivesRevision.load();
+	if (Revision != UploadedPrimitivesRevision || !SpheresPooledBuffer.IsValid())
 	{
-		const bool bHasData = CachedSpheres.Num() > 0;
-		FRDGBufferRef SpheresBuffer = CreateStructuredBuffer(
-			GraphBuilder,
-			TEXT("GPUCollisionSpheres"),
-			sizeof(FGPUCollisionSphere),
-			bHasData ? CachedSpheres.Num() : 1,
-			bHasData ? CachedSpheres.GetData() : &DummySphere,
-			bHasData ? CachedSpheres.Num() * sizeof(FGPUCollisionSphere) : sizeof(FGPUCollisionSphere),
-			ERDGInitialDataFlags::NoCopy
-		);
-		SpheresSRV = GraphBuilder.CreateSRV(SpheresBuffer);
-	}
-
-	{
-		const bool bHasData = CachedCapsules.Num() > 0;
-		FRDGBufferRef CapsulesBuffer = CreateStructuredBuffer(
-			GraphBuilder,
-			TEXT("GPUCollisionCapsules"),
-			sizeof(FGPUCollisionCapsule),
-			bHasData ? CachedCapsules.Num() : 1,
-			bHasData ? CachedCapsules.GetData() : &DummyCapsule,
-			bHasData ? CachedCapsules.Num() * sizeof(FGPUCollisionCapsule) : sizeof(FGPUCollisionCapsule),
-			ERDGInitialDataFlags::NoCopy
-		);
-		CapsulesSRV = GraphBuilder.CreateSRV(CapsulesBuffer);
-	}
-
-	{
-		const bool bHasData = CachedBoxes.Num() > 0;
-		FRDGBufferRef BoxesBuffer = CreateStructuredBuffer(
-			GraphBuilder,
-			TEXT("GPUCollisionBoxes"),
-			sizeof(FGPUCollisionBox),
-			bHasData ? CachedBoxes.Num() : 1,
-			bHasData ? CachedBoxes.GetData() : &DummyBox,
-			bHasData ? CachedBoxes.Num() * sizeof(FGPUCollisionBox) : sizeof(FGPUCollisionBox),
-			ERDGInitialDataFlags::NoCopy
-		);
-		BoxesSRV = GraphBuilder.CreateSRV(BoxesBuffer);
-	}
-
-	{
-		const bool bHasData = CachedConvexHeaders.Num() > 0;
-		FRDGBufferRef ConvexesBuffer = CreateStructuredBuffer(
-			GraphBuilder,
-			TEXT("GPUCollisionConvexes"),
-			sizeof(FGPUCollisionConvex),
-			bHasData ? CachedConvexHeaders.Num() : 1,
-			bHasData ? CachedConvexHeaders.GetData() : &DummyConvex,
-			bHasData ? CachedConvexHeaders.Num() * sizeof(FGPUCollisionConvex) : sizeof(FGPUCollisionConvex),
-			ERDGInitialDataFlags::NoCopy
-		);
-		ConvexesSRV = GraphBuilder.CreateSRV(ConvexesBuffer);
-	}
-
-	{
-		const bool bHasData = CachedConvexPlanes.Num() > 0;
-		FRDGBufferRef ConvexPlanesBuffer = CreateStructuredBuffer(
-			GraphBuilder,
-			TEXT("GPUCollisionConvexPlanes"),
-			sizeof(FGPUConvexPlane),
-			bHasData ? CachedConvexPlanes.Num() : 1,
-			bHasData ? CachedConvexPlanes.GetData() : &DummyPlane,
-			bHasData ? CachedConvexPlanes.Num() * sizeof(FGPUConvexPlane) : sizeof(FGPUConvexPlane),
-			ERDGInitialDataFlags::NoCopy
-		);
-		ConvexPlanesSRV = GraphBuilder.CreateSRV(ConvexPlanesBuffer);
-	}
+		FScopeLock Lock(&CollisionLock);
 
-	{
-		const bool bHasData = CachedBoneTransforms.Num() > 0;
-		FRDGBufferRef BoneTransformsBuffer = CreateStructuredBuffer(
-			GraphBuilder,
-			TEXT("GPUCollisionBoneTransforms"),
-			sizeof(FGPUBoneTransform),
-			bHasData ? CachedBoneTransforms.Num() : 1,
-			bHasData ? CachedBoneTransforms.GetData() : &DummyBone,
-			bHasData ? CachedBoneTransforms.Num() * sizeof(FGPUBoneTransform) : sizeof(FGPUBoneTransform),
-			ERDGInitialDataFlags::NoCopy
-		);
-		BoneTransformsSRV = GraphBuilder.CreateSRV(BoneTransformsBuffer);
-	}
+		SpheresPooledBuffer = UploadPersistentBuffer(GraphBuilder, TEXT("GPUCollisionSpheres"), CachedSpheres);
+		CapsulesPooledBuffer = UploadPersistentBuffer(GraphBuilder, TEXT("GPUCollisionCapsules"), CachedCapsules);
+		BoxesPooledBuffer = UploadPersistentBuffer(GraphBuilder, TEXT("GPUCollisionBoxes"), CachedBoxes);
+		ConvexesPooledBuffer = UploadPersistentBuffer(GraphBuilder, TEXT("GPUCollisionConvexes"), CachedConvexHeaders);
+		ConvexPlanesPooledBuffer = UploadPersistentBuffer(GraphBuilder, TEXT("GPUCollisionConvexPlanes"), CachedConvexPlanes);
+		BoneTransformsPooledBuffer = UploadPersistentBuffer(GraphBuilder, TEXT("GPUCollisionBoneTransforms"), CachedBoneTransforms);
+
+		// Counts must match the uploaded buffers even if the game thread uploads again mid-frame
+		UploadedSphereCount = CachedSpheres.Num();
+		UploadedCapsuleCount = CachedCapsules.Num();
+		UploadedBoxCount = CachedBoxes.Num();
+		UploadedConvexCount = CachedConvexHeaders.Num();
+		UploadedBoneCount = CachedBoneTransforms.Num();
+		UploadedPrimitivesRevision = Revision;
+	}
+
+	FRDGBufferSRVRef SpheresSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(SpheresPooledBuffer, TEXT("GPUCollisionSpheres")));
+	FRDGBufferSRVRef CapsulesSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(CapsulesPooledBuffer, TEXT("GPUCollisionCapsules")));
+	FRDGBufferSRVRef BoxesSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(BoxesPooledBuffer, TEXT("GPUCollisionBoxes")));
+	FRDGBufferSRVRef ConvexesSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(ConvexesPooledBuffer, TEXT("GPUCollisionConvexes")));
+	FRDGBufferSRVRef ConvexPlanesSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(ConvexPlanesPooledBuffer, TEXT("GPUCollisionConvexPlanes")));
+	FRDGBufferSRVRef BoneTransformsSRV = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(BoneTransformsPooledBuffer, TEXT("GPUCollisionBoneTransforms")));
+	const int32 TotalPrimitiveCount = UploadedSphereCount + UploadedCapsuleCount + UploadedBoxCount + UploadedConvexCount;
 
 	// Create Unified Collision Feedback Buffer
 	// Single ByteAddressBuffer containing all feedback types with embedded counters
@@ -393,20 +383,20 @@ void FGPUCollisionManager::AddPrimitiveCollisionPass(
 	PassParameters->CollisionThreshold = PrimitiveCollisionThreshold;
 
 	PassParameters->CollisionSpheres = SpheresSRV;
-	PassParameters->SphereCount = CachedSpheres.Num();
+	PassParameters->SphereCount = UploadedSphereCount;
 
 	PassParameters->CollisionCapsules = CapsulesSRV;
-	PassParameters->CapsuleCount = CachedCapsules.Num();
+	PassParameters->CapsuleCount = UploadedCapsuleCount;
 
 	PassParameters->CollisionBoxes = BoxesSRV;
-	PassParameters->BoxCount = CachedBoxes.Num();
+	PassParameters->BoxCount = UploadedBoxCount;
 
 	PassParameters->CollisionConvexes = ConvexesSRV;
-	PassParameters->ConvexCount = CachedConvexHeaders.Num();
+	PassParameters->ConvexCount = UploadedConvexCount;
 
 	PassParameters->ConvexPlanes = ConvexPlanesSRV;
 	PassParameters->BoneTransforms = BoneTransformsSRV;
-	PassParameters->BoneCount = CachedBoneTransforms.Num();
+	PassParameters->BoneCount = UploadedBoneCount;
 
 	// Unified feedback buffer (ByteAddressBuffer with embedded counters)
 	PassParameters->UnifiedFeedbackBuffer = GraphBuilder.CreateUAV(UnifiedFeedbackBuffer);
@@ -420,7 +410,7 @@ void FGPUCollisionManager::AddPrimitiveCollisionPass(
 	{
 		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
 			RDG_EVENT_NAME("GPUFluid::PrimitiveCollision(%d primitives, feedback=%s)",
-				CachedSpheres.Num() + CachedCapsules.Num() + CachedBoxes.Num() + CachedConvexHeaders.Num(),
+				TotalPrimitiveCount,
 				bFeedbackEnabled ? TEXT("ON") : TEXT("OFF")),
 			ComputeShader, PassParameters, IndirectArgsBuffer,
 			GPUIndirectDispatch::IndirectArgsOffset_TG256);
@@ -431,7 +421,7 @@ void FGPUCollisionManager::AddPrimitiveCollisionPass(
 		const int32 NumGroups = FMath::DivideAndRoundUp(ParticleCount, ThreadGroupSize);
 		FComputeShaderUtils::AddPass(GraphBuilder,
 			RDG_EVENT_NAME("GPUFluid::PrimitiveCollision(%d particles, %d primitives, feedback=%s)",
-				ParticleCount, CachedSpheres.Num() + CachedCapsules.Num() + CachedBoxes.Num() + CachedConvexHeaders.Num(),
+				ParticleCount, TotalPrimitiveCount,
 				bFeedbackEnabled ? TEXT("ON") : TEXT("OFF")),
 			ComputeShader, PassParameters, FIntVector(NumGroups, 1, 1));
 	}
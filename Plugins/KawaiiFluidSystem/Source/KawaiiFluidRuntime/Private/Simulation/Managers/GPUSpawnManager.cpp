@@ -7,10 +7,26 @@
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "RHIGPUReadback.h"
+#include "HAL/IConsoleManager.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGPUSpawnManager, Log, All);
 DEFINE_LOG_CATEGORY(LogGPUSpawnManager);
 
+static TAutoConsoleVariable<int32> CVarFluidGPUSpawnDescriptors(
+	TEXT("r.Fluid.GPUSpawnDescriptors"),
+	1,
+	TEXT("How procedural spawn plans (emitter fills, stream layers) are expanded into particles.\n")
+	TEXT("  0 = Expand on the render thread into individual spawn requests\n")
+	TEXT("  1 = Expand on the GPU, one dispatch per plan (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarFluidStreamingUploadBudgetKB(
+	TEXT("r.Fluid.StreamingUploadBudgetKB"),
+	4096,
+	TEXT("Particle data (KB) a streaming initial upload may append per frame.\n")
+	TEXT("  At least one chunk is uploaded per frame; 0 = upload everything in one frame"),
+	ECVF_RenderThreadSafe);
+
 //=============================================================================
 // Constructor / Destructor
 //=============================================================================
@@ -43,6 +59,7 @@ void FGPUSpawnManager::Initialize(int32 InMaxParticleCount)
 	}
 
 	MaxParticleCapacity = InMaxParticleCount;
+	ParticleCapacity = InMaxParticleCount;
 	bIsInitialized = true;
 
 	// Initialize source counter cache
@@ -74,11 +91,19 @@ void FGPUSpawnManager::Release()
 {
 	{
 		FScopeLock Lock(&SpawnLock);
+		SpawnQueue.Discard();
 		PendingSpawnRequests.Empty();
 		ActiveSpawnRequests.Empty();
+		ClearSpawnPlans();
 		bHasPendingSpawnRequests.store(false);
 	}
 
+	{
+		ClearUploadChunks();
+		FScopeLock Lock(&UploadLock);
+		FreeUploadChunks.Empty();
+	}
+
 	{
 		FScopeLock Lock(&GPUDespawnLock);
 		PendingGPUBrushDespawns.Empty();
@@ -130,6 +155,7 @@ void FGPUSpawnManager::Release()
 	NextParticleID.store(0);
 	bIsInitialized = false;
 	MaxParticleCapacity = 0;
+	ParticleCapacity = 0;
 
 	UE_LOG(LogGPUSpawnManager, Log, TEXT("GPUSpawnManager released (all despawn state cleared)"));
 }
@@ -139,46 +165,93 @@ void FGPUSpawnManager::Release()
 //=============================================================================
 
 /**
- * @brief Add a spawn request (thread-safe).
+ * @brief Add a spawn request (thread-safe, lock-free).
  * @param Position World position to spawn at.
  * @param Velocity Initial velocity.
  * @param Mass Particle mass (0 = use default).
  */
 void FGPUSpawnManager::AddSpawnRequest(const FVector3f& Position, const FVector3f& Velocity, float Mass)
 {
-	FScopeLock Lock(&SpawnLock);
-
 	FGPUSpawnRequest Request;
 	Request.Position = Position;
 	Request.Velocity = Velocity;
 	Request.Mass = Mass;
 	Request.Radius = DefaultSpawnRadius;
 
-	PendingSpawnRequests.Add(Request);
-	bHasPendingSpawnRequests.store(true);
+	SpawnQueue.Enqueue(Request);
 
 	UE_LOG(LogGPUSpawnManager, Verbose, TEXT("AddSpawnRequest: Pos=(%.2f, %.2f, %.2f), Vel=(%.2f, %.2f, %.2f)"),
 		Position.X, Position.Y, Position.Z, Velocity.X, Velocity.Y, Velocity.Z);
 }
 
 /**
- * @brief Add multiple spawn requests at once (thread-safe, more efficient).
- * @param Requests Array of spawn requests.
+ * @brief Add a fully specified spawn request (thread-safe, lock-free).
+ * @param Request Spawn request.
+ */
+void FGPUSpawnManager::AddSpawnRequest(const FGPUSpawnRequest& Request)
+{
+	SpawnQueue.Enqueue(Request);
+}
+
+/**
+ * @brief Add multiple spawn requests at once (thread-safe, lock-free, kept in order).
+ * @param Requests Spawn requests.
  */
-void FGPUSpawnManager::AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests)
+void FGPUSpawnManager::AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests)
 {
 	if (Requests.Num() == 0)
 	{
 		return;
 	}
 
-	FScopeLock Lock(&SpawnLock);
+	SpawnQueue.Enqueue(Requests);
+
+	UE_LOG(LogGPUSpawnManager, Verbose, TEXT("AddSpawnRequests: Added %d requests"), Requests.Num());
+}
 
-	PendingSpawnRequests.Append(Requests);
-	bHasPendingSpawnRequests.store(true);
+/**
+ * @brief Queue a built spawn plan (thread-safe).
+ * @param Plan Spawn plan; empty plans are dropped.
+ */
+void FGPUSpawnManager::AddSpawnPlan(FKawaiiFluidSpawnPlan&& Plan)
+{
+	const int32 Count = Plan.Num();
+	if (Count == 0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&SpawnPlanLock);
+	PendingSpawnPlans.Add(MoveTemp(Plan));
+	PendingSpawnPlanParticleCount.fetch_add(Count);
 
-	UE_LOG(LogGPUSpawnManager, Verbose, TEXT("AddSpawnRequests: Added %d requests (total pending: %d)"),
-		Requests.Num(), PendingSpawnRequests.Num());
+	UE_LOG(LogGPUSpawnManager, Verbose, TEXT("AddSpawnPlan: Added plan with %d particles"), Count);
+}
+
+/**
+ * @brief Build and queue a spawn plan (thread-safe).
+ * @param Descriptor Spawn descriptor.
+ * @return Number of particles queued.
+ */
+int32 FGPUSpawnManager::AddSpawnDescriptor(const FKawaiiFluidSpawnDescriptor& Descriptor)
+{
+	FKawaiiFluidSpawnPlan Plan;
+	Plan.Build(Descriptor);
+	const int32 Count = Plan.Num();
+	AddSpawnPlan(MoveTemp(Plan));
+	return Count;
+}
+
+/**
+ * @brief Drop all pending and active spawn plans.
+ */
+void FGPUSpawnManager::ClearSpawnPlans()
+{
+	FScopeLock Lock(&SpawnPlanLock);
+	PendingSpawnPlans.Empty();
+	ActiveSpawnPlans.Empty();
+	ActiveSpawnPlanParticleCount = 0;
+	PendingSpawnPlanParticleCount.store(0);
 }
 
 /**
@@ -187,8 +260,134 @@ void FGPUSpawnManager::AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests
 void FGPUSpawnManager::ClearSpawnRequests()
 {
 	FScopeLock Lock(&SpawnLock);
+	SpawnQueue.Discard();
 	PendingSpawnRequests.Empty();
 	bHasPendingSpawnRequests.store(false);
+
+	{
+		FScopeLock PlanLock(&SpawnPlanLock);
+		PendingSpawnPlans.Empty();
+		PendingSpawnPlanParticleCount.store(0);
+	}
+
+	FScopeLock ChunkLock(&UploadLock);
+	PendingUploadChunks.Empty();
+	PendingUploadParticleCount.store(0);
+}
+
+//=============================================================================
+// Streaming Particle Upload
+//=============================================================================
+
+/**
+ * @brief Get an empty upload chunk (thread-safe).
+ * @return Chunk with capacity for UploadChunkSize particles.
+ */
+TArray<FGPUFluidParticle> FGPUSpawnManager::AcquireUploadChunk()
+{
+	TArray<FGPUFluidParticle> Chunk;
+	{
+		FScopeLock Lock(&UploadLock);
+		if (FreeUploadChunks.Num() > 0)
+		{
+			Chunk = FreeUploadChunks.Pop(EAllowShrinking::No);
+		}
+	}
+	Chunk.Reset(UploadChunkSize);
+	return Chunk;
+}
+
+/**
+ * @brief Queue converted particle chunks for streaming upload (thread-safe).
+ * @param Chunks Particle chunks with IDs already allocated; empty chunks are dropped.
+ */
+void FGPUSpawnManager::AddUploadChunks(TArray<TArray<FGPUFluidParticle>>&& Chunks)
+{
+	int32 AddedCount = 0;
+
+	FScopeLock Lock(&UploadLock);
+	for (TArray<FGPUFluidParticle>& Chunk : Chunks)
+	{
+		if (Chunk.Num() > 0)
+		{
+			AddedCount += Chunk.Num();
+			PendingUploadChunks.Add(MoveTemp(Chunk));
+		}
+	}
+	PendingUploadParticleCount.fetch_add(AddedCount);
+
+	UE_LOG(LogGPUSpawnManager, Verbose, TEXT("AddUploadChunks: Queued %d particles for streaming upload"), AddedCount);
+}
+
+/**
+ * @brief Move pending upload chunks to the active set within a byte budget.
+ * @param BudgetBytes Upload budget for this frame; <= 0 takes every pending chunk.
+ * @return Number of particles moved.
+ */
+int32 FGPUSpawnManager::TakeUploadChunks(int64 BudgetBytes)
+{
+	FScopeLock Lock(&UploadLock);
+
+	int32 NumTaken = 0;
+	int64 TakenBytes = 0;
+	while (NumTaken < PendingUploadChunks.Num())
+	{
+		const int64 ChunkBytes = static_cast<int64>(PendingUploadChunks[NumTaken].Num()) * sizeof(FGPUFluidParticle);
+		// Always make progress, even if a single chunk exceeds the budget
+		if (BudgetBytes > 0 && NumTaken > 0 && TakenBytes + ChunkBytes > BudgetBytes)
+		{
+			break;
+		}
+		TakenBytes += ChunkBytes;
+		++NumTaken;
+	}
+
+	int32 TakenCount = 0;
+	for (int32 i = 0; i < NumTaken; ++i)
+	{
+		TakenCount += PendingUploadChunks[i].Num();
+		ActiveUploadChunks.Add(MoveTemp(PendingUploadChunks[i]));
+	}
+	PendingUploadChunks.RemoveAt(0, NumTaken, EAllowShrinking::No);
+
+	ActiveUploadParticleCount += TakenCount;
+	PendingUploadParticleCount.fetch_sub(TakenCount);
+	return TakenCount;
+}
+
+/**
+ * @brief Return this frame's uploaded chunks to the free pool.
+ */
+void FGPUSpawnManager::RecycleActiveUploadChunks()
+{
+	if (ActiveUploadChunks.Num() == 0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&UploadLock);
+	for (TArray<FGPUFluidParticle>& Chunk : ActiveUploadChunks)
+	{
+		if (FreeUploadChunks.Num() < MaxFreeUploadChunks)
+		{
+			Chunk.Reset();
+			FreeUploadChunks.Add(MoveTemp(Chunk));
+		}
+	}
+	ActiveUploadChunks.Reset();
+	ActiveUploadParticleCount = 0;
+}
+
+/**
+ * @brief Drop all pending and active upload chunks.
+ */
+void FGPUSpawnManager::ClearUploadChunks()
+{
+	FScopeLock Lock(&UploadLock);
+	PendingUploadChunks.Empty();
+	ActiveUploadChunks.Empty();
+	ActiveUploadParticleCount = 0;
+	PendingUploadParticleCount.store(0);
 }
 
 /**
@@ -198,7 +397,7 @@ void FGPUSpawnManager::ClearSpawnRequests()
 int32 FGPUSpawnManager::GetPendingSpawnCount() const
 {
 	FScopeLock Lock(&SpawnLock);
-	return PendingSpawnRequests.Num();
+	return PendingSpawnRequests.Num() + SpawnQueue.Num() + PendingSpawnPlanParticleCount.load() + PendingUploadParticleCount.load();
 }
 
 /**
@@ -210,6 +409,9 @@ int32 FGPUSpawnManager::CancelPendingSpawnsForSource(int32 SourceID)
 {
 	FScopeLock Lock(&SpawnLock);
 
+	// Pull everything queued so far so the cancel also covers requests still in producer chunks
+	SpawnQueue.DrainTo(PendingSpawnRequests);
+
 	const int32 OriginalCount = PendingSpawnRequests.Num();
 
 	// Remove all pending spawn requests with matching SourceID
@@ -218,11 +420,39 @@ int32 FGPUSpawnManager::CancelPendingSpawnsForSource(int32 SourceID)
 		return Request.SourceID == SourceID;
 	});
 
-	const int32 RemovedCount = OriginalCount - PendingSpawnRequests.Num();
+	int32 RemovedCount = OriginalCount - PendingSpawnRequests.Num();
+
+	bHasPendingSpawnRequests.store(PendingSpawnRequests.Num() > 0);
 
-	if (PendingSpawnRequests.Num() == 0)
 	{
-		bHasPendingSpawnRequests.store(false);
+		FScopeLock PlanLock(&SpawnPlanLock);
+		int32 RemovedPlanParticles = 0;
+		PendingSpawnPlans.RemoveAll([SourceID, &RemovedPlanParticles](const FKawaiiFluidSpawnPlan& Plan)
+		{
+			if (Plan.GetDescriptor().SourceID != SourceID)
+			{
+				return false;
+			}
+			RemovedPlanParticles += Plan.Num();
+			return true;
+		});
+		PendingSpawnPlanParticleCount.fetch_sub(RemovedPlanParticles);
+		RemovedCount += RemovedPlanParticles;
+	}
+
+	{
+		FScopeLock ChunkLock(&UploadLock);
+		int32 RemovedUploadParticles = 0;
+		for (TArray<FGPUFluidParticle>& Chunk : PendingUploadChunks)
+		{
+			RemovedUploadParticles += Chunk.RemoveAll([SourceID](const FGPUFluidParticle& Particle)
+			{
+				return Particle.SourceID == SourceID;
+			});
+		}
+		PendingUploadChunks.RemoveAll([](const TArray<FGPUFluidParticle>& Chunk) { return Chunk.Num() == 0; });
+		PendingUploadParticleCount.fetch_sub(RemovedUploadParticles);
+		RemovedCount += RemovedUploadParticles;
 	}
 
 	if (RemovedCount > 0)
@@ -376,8 +606,8 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 	}
 
 	// Mark passes use indirect dispatch (GPU-accurate particle count from ParticleCountBuffer).
-	// PrefixSum/Compact still use MaxParticleCapacity (single-pass, correct with ClearUAV(0)).
-	const int32 CompactionElementCount = MaxParticleCapacity;
+	// PrefixSum/Compact use the allocated particle capacity (single-pass, correct with ClearUAV(0)).
+	const int32 CompactionElementCount = FMath::Max(ParticleCapacity, InOutParticleCount);
 
 	FRDGBufferRef AliveMaskBuffer;
 	FRDGBufferRef PrefixSumsBuffer;
@@ -574,6 +804,24 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 				IncomingCounts[Req.SourceID]++;
 			}
 		}
+		for (const FKawaiiFluidSpawnPlan& Plan : ActiveSpawnPlans)
+		{
+			const int32 PlanSourceID = Plan.GetDescriptor().SourceID;
+			if (PlanSourceID >= 0 && PlanSourceID < EGPUParticleSource::MaxSourceCount)
+			{
+				IncomingCounts[PlanSourceID] += Plan.Num();
+			}
+		}
+		for (const TArray<FGPUFluidParticle>& Chunk : ActiveUploadChunks)
+		{
+			for (const FGPUFluidParticle& Particle : Chunk)
+			{
+				if (Particle.SourceID >= 0 && Particle.SourceID < EGPUParticleSource::MaxSourceCount)
+				{
+					IncomingCounts[Particle.SourceID]++;
+				}
+			}
+		}
 
 		FRDGBufferRef IncomingSpawnCountsBuffer = CreateStructuredBuffer(
 			GraphBuilder,
@@ -782,16 +1030,46 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 //=============================================================================
 
 /**
- * @brief Swap pending requests to active buffer.
+ * @brief Drain the spawn queue once and swap everything pending to the active buffer.
  */
 void FGPUSpawnManager::SwapBuffers()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(GPUSpawnManager_SwapBuffers);
+
 	FScopeLock Lock(&SpawnLock);
 
-	// Move pending requests to active buffer
-	ActiveSpawnRequests = MoveTemp(PendingSpawnRequests);
-	PendingSpawnRequests.Empty();
+	// Active was consumed last frame; swapping reuses both allocations instead of reallocating per frame
+	Swap(ActiveSpawnRequests, PendingSpawnRequests);
+	PendingSpawnRequests.Reset();
+	SpawnQueue.DrainTo(ActiveSpawnRequests);
 	bHasPendingSpawnRequests.store(false);
+
+	{
+		FScopeLock PlanLock(&SpawnPlanLock);
+		Swap(ActiveSpawnPlans, PendingSpawnPlans);
+		PendingSpawnPlans.Reset();
+		ActiveSpawnPlanParticleCount = PendingSpawnPlanParticleCount.exchange(0);
+	}
+
+	// Fallback: expand plans into plain requests (still in parallel, but uploads 48 bytes per particle)
+	if (ActiveSpawnPlans.Num() > 0 && CVarFluidGPUSpawnDescriptors.GetValueOnRenderThread() == 0)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(GPUSpawnManager_ExpandSpawnPlans);
+
+		int32 WriteIndex = ActiveSpawnRequests.Num();
+		ActiveSpawnRequests.AddUninitialized(ActiveSpawnPlanParticleCount);
+		for (const FKawaiiFluidSpawnPlan& Plan : ActiveSpawnPlans)
+		{
+			Plan.Expand(TArrayView<FGPUSpawnRequest>(ActiveSpawnRequests.GetData() + WriteIndex, Plan.Num()));
+			WriteIndex += Plan.Num();
+		}
+		ActiveSpawnPlans.Reset();
+		ActiveSpawnPlanParticleCount = 0;
+	}
+
+	// Streaming upload: only this frame's share of the initial particle set becomes resident
+	const int64 UploadBudgetBytes = static_cast<int64>(CVarFluidStreamingUploadBudgetKB.GetValueOnRenderThread()) * 1024;
+	TakeUploadChunks(UploadBudgetBytes);
 }
 
 /**
@@ -807,11 +1085,41 @@ void FGPUSpawnManager::AddSpawnParticlesPass(
 	FRDGBufferUAVRef ParticleCounterUAV,
 	int32 MaxParticleCount)
 {
-	if (ActiveSpawnRequests.Num() == 0)
+	// Get or create source counter buffer UAV
+	FRDGBufferUAVRef SourceCounterUAV = RegisterSourceCounterUAV(GraphBuilder);
+
+	if (ActiveSpawnRequests.Num() > 0)
 	{
-		return;
+		AddSpawnRequestPass(GraphBuilder, ParticlesUAV, ParticleCounterUAV, SourceCounterUAV, MaxParticleCount);
 	}
 
+	if (ActiveSpawnPlans.Num() > 0)
+	{
+		AddSpawnPlanPasses(GraphBuilder, ParticlesUAV, ParticleCounterUAV, SourceCounterUAV, MaxParticleCount);
+	}
+
+	// Uploaded particles carry pre-allocated IDs, so they go last and leave request/plan IDs untouched
+	if (ActiveUploadChunks.Num() > 0)
+	{
+		AddUploadChunkPasses(GraphBuilder, ParticlesUAV, ParticleCounterUAV, SourceCounterUAV, MaxParticleCount);
+	}
+}
+
+/**
+ * @brief Add one FSpawnParticlesCS dispatch for the active individual spawn requests.
+ * @param GraphBuilder RDG builder.
+ * @param ParticlesUAV Particle buffer UAV.
+ * @param ParticleCounterUAV Atomic counter UAV.
+ * @param SourceCounterUAV Per-source counter UAV.
+ * @param MaxParticleCount Maximum particle capacity.
+ */
+void FGPUSpawnManager::AddSpawnRequestPass(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferUAVRef ParticlesUAV,
+	FRDGBufferUAVRef ParticleCounterUAV,
+	FRDGBufferUAVRef SourceCounterUAV,
+	int32 MaxParticleCount)
+{
 	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
 	TShaderMapRef<FSpawnParticlesCS> ComputeShader(ShaderMap);
 
@@ -828,9 +1136,6 @@ void FGPUSpawnManager::AddSpawnParticlesPass(
 		ERDGInitialDataFlags::None
 	);
 
-	// Get or create source counter buffer UAV
-	FRDGBufferUAVRef SourceCounterUAV = RegisterSourceCounterUAV(GraphBuilder);
-
 	FSpawnParticlesCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FSpawnParticlesCS::FParameters>();
 	PassParameters->SpawnRequests = GraphBuilder.CreateSRV(SpawnRequestBuffer);
 	PassParameters->Particles = ParticlesUAV;
@@ -857,16 +1162,201 @@ void FGPUSpawnManager::AddSpawnParticlesPass(
 	// 	ActiveSpawnRequests.Num(), NextParticleID.load());
 }
 
+/**
+ * @brief Add one FSpawnFromDescriptorCS dispatch per active spawn plan.
+ *
+ * Plans with MinSeparation (brush strokes) first clear a small occupancy grid around the shape and
+ * mark the cells of the particles already in the buffer, so points landing on fluid are dropped.
+ * @param GraphBuilder RDG builder.
+ * @param ParticlesUAV Particle buffer UAV.
+ * @param ParticleCounterUAV Atomic counter UAV.
+ * @param SourceCounterUAV Per-source counter UAV.
+ * @param MaxParticleCount Maximum particle capacity.
+ */
+void FGPUSpawnManager::AddSpawnPlanPasses(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferUAVRef ParticlesUAV,
+	FRDGBufferUAVRef ParticleCounterUAV,
+	FRDGBufferUAVRef SourceCounterUAV,
+	int32 MaxParticleCount)
+{
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	TShaderMapRef<FSpawnFromDescriptorCS> ComputeShader(ShaderMap);
+
+	// Plan particles take the IDs after this frame's individual requests
+	int32 FirstParticleID = NextParticleID.load() + ActiveSpawnRequests.Num();
+
+	// Bound in place of the occupancy grid by plans that do not reject overlaps
+	FRDGBufferUAVRef DummyOccupancyUAV = nullptr;
+
+	for (const FKawaiiFluidSpawnPlan& Plan : ActiveSpawnPlans)
+	{
+		const FKawaiiFluidSpawnDescriptor& Descriptor = Plan.GetDescriptor();
+		TConstArrayView<FKawaiiFluidSpawnRow> Rows = Plan.GetRows();
+
+		FVector3f OccupancyMin = FVector3f::ZeroVector;
+		float OccupancyCellSize = 1.0f;
+		int32 OccupancyDim = 0;
+		FRDGBufferUAVRef OccupancyUAV = nullptr;
+
+		if (Plan.GetOccupancyGrid(OccupancyMin, OccupancyCellSize, OccupancyDim))
+		{
+			const int32 NumCells = OccupancyDim * OccupancyDim * OccupancyDim;
+			FRDGBufferRef OccupancyBuffer = GraphBuilder.CreateBuffer(
+				FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumCells), TEXT("GPUFluidSpawnOccupancy"));
+			OccupancyUAV = GraphBuilder.CreateUAV(OccupancyBuffer);
+			AddClearUAVPass(GraphBuilder, OccupancyUAV, 0u);
+
+			TShaderMapRef<FMarkSpawnOccupancyCS> MarkShader(ShaderMap);
+			FMarkSpawnOccupancyCS::FParameters* MarkParameters = GraphBuilder.AllocParameters<FMarkSpawnOccupancyCS::FParameters>();
+			MarkParameters->Particles = ParticlesUAV;
+			MarkParameters->ParticleCounter = ParticleCounterUAV;
+			MarkParameters->SpawnOccupancy = OccupancyUAV;
+			MarkParameters->OccupancyMin = OccupancyMin;
+			MarkParameters->OccupancyCellSize = OccupancyCellSize;
+			MarkParameters->OccupancyDim = OccupancyDim;
+			MarkParameters->MaxParticleCount = MaxParticleCount;
+
+			FComputeShaderUtils::AddPass(
+				GraphBuilder,
+				RDG_EVENT_NAME("GPUFluid::MarkSpawnOccupancy(%d^3)", OccupancyDim),
+				MarkShader,
+				MarkParameters,
+				FIntVector(FMath::DivideAndRoundUp(MaxParticleCount, FMarkSpawnOccupancyCS::ThreadGroupSize), 1, 1)
+			);
+		}
+		else
+		{
+			if (!DummyOccupancyUAV)
+			{
+				FRDGBufferRef DummyBuffer = GraphBuilder.CreateBuffer(
+					FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 1), TEXT("GPUFluidSpawnOccupancy.Dummy"));
+				DummyOccupancyUAV = GraphBuilder.CreateUAV(DummyBuffer);
+				AddClearUAVPass(GraphBuilder, DummyOccupancyUAV, 0u);
+			}
+			OccupancyUAV = DummyOccupancyUAV;
+		}
+
+		// Row table only: a few hundred bytes per shape instead of 48 bytes per particle
+		FRDGBufferRef RowBuffer = CreateStructuredBuffer(
+			GraphBuilder,
+			TEXT("GPUFluidSpawnRows"),
+			sizeof(FKawaiiFluidSpawnRow),
+			Rows.Num(),
+			Rows.GetData(),
+			Rows.Num() * sizeof(FKawaiiFluidSpawnRow),
+			ERDGInitialDataFlags::None
+		);
+
+		FSpawnFromDescriptorCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FSpawnFromDescriptorCS::FParameters>();
+		PassParameters->SpawnRows = GraphBuilder.CreateSRV(RowBuffer);
+		PassParameters->Particles = ParticlesUAV;
+		PassParameters->ParticleCounter = ParticleCounterUAV;
+		PassParameters->SourceCounters = SourceCounterUAV;
+		PassParameters->NumRows = Rows.Num() - 1;
+		PassParameters->SpawnCount = Plan.Num();
+		PassParameters->Shape = static_cast<int32>(Descriptor.Shape);
+		PassParameters->Center = FVector3f(Descriptor.Center);
+		PassParameters->AxisX = Plan.GetAxisX();
+		PassParameters->AxisY = Plan.GetAxisY();
+		PassParameters->AxisZ = Plan.GetAxisZ();
+		PassParameters->LatticeStart = Plan.GetStart();
+		PassParameters->LatticeStep = Plan.GetStep();
+		PassParameters->Extent = FVector3f(Descriptor.Extent);
+		PassParameters->YBase = Plan.GetYBase();
+		PassParameters->ZBase = Plan.GetZBase();
+		PassParameters->JitterRange = Descriptor.JitterRange;
+		PassParameters->JitterSeed = Descriptor.JitterSeed;
+		PassParameters->SpawnVelocity = Descriptor.Velocity;
+		PassParameters->SpawnMass = Descriptor.Mass;
+		PassParameters->SpawnOccupancy = OccupancyUAV;
+		PassParameters->OccupancyMin = OccupancyMin;
+		PassParameters->OccupancyCellSize = OccupancyCellSize;
+		PassParameters->OccupancyDim = OccupancyDim;
+		PassParameters->SpawnSourceID = Descriptor.SourceID;
+		PassParameters->MaxParticleCount = MaxParticleCount;
+		PassParameters->FirstParticleID = FirstParticleID;
+		PassParameters->MaxSourceCount = EGPUParticleSource::MaxSourceCount;
+		PassParameters->DefaultMass = DefaultSpawnMass;
+
+		const uint32 NumGroups = FMath::DivideAndRoundUp(Plan.Num(), FSpawnFromDescriptorCS::ThreadGroupSize);
+
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::SpawnFromDescriptor(%d)", Plan.Num()),
+			ComputeShader,
+			PassParameters,
+			FIntVector(NumGroups, 1, 1)
+		);
+
+		FirstParticleID += Plan.Num();
+	}
+}
+
+/**
+ * @brief Add one FAppendParticlesCS dispatch per active upload chunk.
+ * @param GraphBuilder RDG builder.
+ * @param ParticlesUAV Particle buffer UAV.
+ * @param ParticleCounterUAV Atomic counter UAV.
+ * @param SourceCounterUAV Per-source counter UAV.
+ * @param MaxParticleCount Maximum particle capacity.
+ */
+void FGPUSpawnManager::AddUploadChunkPasses(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferUAVRef ParticlesUAV,
+	FRDGBufferUAVRef ParticleCounterUAV,
+	FRDGBufferUAVRef SourceCounterUAV,
+	int32 MaxParticleCount)
+{
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	TShaderMapRef<FAppendParticlesCS> ComputeShader(ShaderMap);
+
+	for (const TArray<FGPUFluidParticle>& Chunk : ActiveUploadChunks)
+	{
+		// RDG copies the chunk, so it can go back to the free pool before the pass executes
+		FRDGBufferRef UploadBuffer = CreateStructuredBuffer(
+			GraphBuilder,
+			TEXT("GPUFluidUploadParticles"),
+			sizeof(FGPUFluidParticle),
+			Chunk.Num(),
+			Chunk.GetData(),
+			Chunk.Num() * sizeof(FGPUFluidParticle),
+			ERDGInitialDataFlags::None
+		);
+
+		FAppendParticlesCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAppendParticlesCS::FParameters>();
+		PassParameters->UploadParticles = GraphBuilder.CreateSRV(UploadBuffer);
+		PassParameters->Particles = ParticlesUAV;
+		PassParameters->ParticleCounter = ParticleCounterUAV;
+		PassParameters->SourceCounters = SourceCounterUAV;
+		PassParameters->UploadCount = Chunk.Num();
+		PassParameters->MaxParticleCount = MaxParticleCount;
+		PassParameters->MaxSourceCount = EGPUParticleSource::MaxSourceCount;
+
+		const uint32 NumGroups = FMath::DivideAndRoundUp(Chunk.Num(), FAppendParticlesCS::ThreadGroupSize);
+
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::AppendParticles(%d)", Chunk.Num()),
+			ComputeShader,
+			PassParameters,
+			FIntVector(NumGroups, 1, 1)
+		);
+	}
+}
+
 
 /**
  * @brief Update next particle ID after spawning.
- * @param SpawnedCount Number of particles successfully spawned.
+ * @param SpawnedCount Number of particles added this frame, including uploaded ones.
  */
 void FGPUSpawnManager::OnSpawnComplete(int32 SpawnedCount)
 {
-	if (SpawnedCount > 0)
+	// Uploaded particles got their IDs from AllocateParticleIDs when they were queued
+	const int32 NewIDCount = SpawnedCount - ActiveUploadParticleCount;
+	if (NewIDCount > 0)
 	{
-		NextParticleID.fetch_add(SpawnedCount);
+		NextParticleID.fetch_add(NewIDCount);
 	}
 }
 
@@ -1144,14 +1634,15 @@ void FGPUSpawnManager::InitializeSourceCountersFromParticles(const TArray<FGPUFl
  */
 void FGPUSpawnManager::EnsureStreamCompactionBuffers(FRDGBuilder& GraphBuilder, int32 RequiredCapacity)
 {
-	// Already allocated with sufficient capacity
-	if (PersistentAliveMaskBuffer.IsValid() && StreamCompactionCapacity >= RequiredCapacity)
+	// Already allocated with sufficient capacity (reallocate smaller once capacity has shrunk to half)
+	if (PersistentAliveMaskBuffer.IsValid() && StreamCompactionCapacity >= RequiredCapacity
+		&& StreamCompactionCapacity <= RequiredCapacity * 2)
 	{
 		return;
 	}
 
-	// Use MaxParticleCapacity for fixed-size allocation (no dynamic resize)
-	const int32 Capacity = FMath::Max(RequiredCapacity, MaxParticleCapacity);
+	// Sized to the allocated particle capacity (grows/shrinks with the simulator)
+	const int32 Capacity = RequiredCapacity;
 	const int32 BlockCount = FMath::DivideAndRoundUp(Capacity, static_cast<int32>(FPrefixSumBlockCS_RDG::ThreadGroupSize));
 
 	// Create AliveMask buffer (uint32 × Capacity)
@@ -1187,6 +1678,22 @@ void FGPUSpawnManager::EnsureStreamCompactionBuffers(FRDGBuilder& GraphBuilder,
 // Stream Compaction Buffer Accessors
 //=============================================================================
 
+int64 FGPUSpawnManager::GetStreamCompactionBytes() const
+{
+	int64 Bytes = 0;
+	const TRefCountPtr<FRDGPooledBuffer>* Buffers[] = {
+		&PersistentAliveMaskBuffer, &PersistentPrefixSumsBuffer, &PersistentBlockSumsBuffer,
+		&PersistentCompactedBuffer[0], &PersistentCompactedBuffer[1] };
+	for (const TRefCountPtr<FRDGPooledBuffer>* Buffer : Buffers)
+	{
+		if (Buffer->IsValid())
+		{
+			Bytes += (*Buffer)->GetSize();
+		}
+	}
+	return Bytes;
+}
+
 FRDGBufferSRVRef FGPUSpawnManager::GetLastPrefixSumsSRV(FRDGBuilder& GraphBuilder) const
 {
 	check(PersistentPrefixSumsBuffer.IsValid());
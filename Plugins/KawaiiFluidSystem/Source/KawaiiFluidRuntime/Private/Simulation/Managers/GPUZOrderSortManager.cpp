@@ -69,6 +69,8 @@ void FGPUZOrderSortManager::Release()
  * @param InAttachmentBuffer Optional attachment buffer to reorder.
  * @param OutSortedAttachmentBuffer Optional output for sorted attachments.
  * @param IndirectArgsBuffer Optional indirect dispatch arguments.
+ * @param InPreviousPositionsBuffer Optional tick-start position buffer to reorder (render interpolation).
+ * @param OutSortedPreviousPositionsBuffer Optional output for sorted tick-start positions.
  * @return Sorted particle buffer.
  */
 FRDGBufferRef FGPUZOrderSortManager::ExecuteZOrderSortingPipeline(
@@ -85,7 +87,9 @@ FRDGBufferRef FGPUZOrderSortManager::ExecuteZOrderSortingPipeline(
 	int32 AllocParticleCount,
 	FRDGBufferRef InAttachmentBuffer,
 	FRDGBufferRef* OutSortedAttachmentBuffer,
-	FRDGBufferRef IndirectArgsBuffer)
+	FRDGBufferRef IndirectArgsBuffer,
+	FRDGBufferRef InPreviousPositionsBuffer,
+	FRDGBufferRef* OutSortedPreviousPositionsBuffer)
 {
 	RDG_EVENT_SCOPE(GraphBuilder, "GPUFluid::ZOrderSorting");
 
@@ -198,14 +202,33 @@ FRDGBufferRef FGPUZOrderSortManager::ExecuteZOrderSortingPipeline(
 			SortedAttachmentsUAV = GraphBuilder.CreateUAV(SortedAttachmentBuffer);
 		}
 
+		// Optional: Create sorted previous positions buffer if input is provided
+		FRDGBufferRef SortedPreviousPositionsBuffer = nullptr;
+		FRDGBufferSRVRef OldPreviousPositionsSRV = nullptr;
+		FRDGBufferUAVRef SortedPreviousPositionsUAV = nullptr;
+		if (InPreviousPositionsBuffer)
+		{
+			FRDGBufferDesc PreviousPositionsDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), AllocParticleCount);
+			SortedPreviousPositionsBuffer = GraphBuilder.CreateBuffer(PreviousPositionsDesc, TEXT("GPUFluid.SortedPreviousPositions"));
+			OldPreviousPositionsSRV = GraphBuilder.CreateSRV(InPreviousPositionsBuffer);
+			SortedPreviousPositionsUAV = GraphBuilder.CreateUAV(SortedPreviousPositionsBuffer);
+		}
+
 		AddReorderParticlesPass(GraphBuilder, OldParticlesSRV, SortedIndicesSRV, SortedParticlesUAV, CurrentParticleCount,
-			OldAttachmentsSRV, SortedAttachmentsUAV, IndirectArgsBuffer);
+			OldAttachmentsSRV, SortedAttachmentsUAV, IndirectArgsBuffer,
+			OldPreviousPositionsSRV, SortedPreviousPositionsUAV);
 
 		// Output sorted attachment buffer if requested
 		if (OutSortedAttachmentBuffer && SortedAttachmentBuffer)
 		{
 			*OutSortedAttachmentBuffer = SortedAttachmentBuffer;
 		}
+
+		// Output sorted previous positions buffer if requested
+		if (OutSortedPreviousPositionsBuffer && SortedPreviousPositionsBuffer)
+		{
+			*OutSortedPreviousPositionsBuffer = SortedPreviousPositionsBuffer;
+		}
 	}
 
 	//=========================================================================
@@ -460,6 +483,8 @@ void FGPUZOrderSortManager::AddRadixSortPasses(
  * @param OldAttachmentsSRV Optional input attachments.
  * @param SortedAttachmentsUAV Optional output sorted attachments.
  * @param IndirectArgsBuffer Optional indirect dispatch arguments.
+ * @param OldPreviousPositionsSRV Optional input tick-start positions.
+ * @param SortedPreviousPositionsUAV Optional output sorted tick-start positions.
  */
 void FGPUZOrderSortManager::AddReorderParticlesPass(
 	FRDGBuilder& GraphBuilder,
@@ -469,7 +494,9 @@ void FGPUZOrderSortManager::AddReorderParticlesPass(
 	int32 CurrentParticleCount,
 	FRDGBufferSRVRef OldAttachmentsSRV,
 	FRDGBufferUAVRef SortedAttachmentsUAV,
-	FRDGBufferRef IndirectArgsBuffer)
+	FRDGBufferRef IndirectArgsBuffer,
+	FRDGBufferSRVRef OldPreviousPositionsSRV,
+	FRDGBufferUAVRef SortedPreviousPositionsUAV)
 {
 	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
 	TShaderMapRef<FReorderParticlesCS> ComputeShader(ShaderMap);
@@ -491,6 +518,19 @@ void FGPUZOrderSortManager::AddReorderParticlesPass(
 		AttachmentsUAV = GraphBuilder.CreateUAV(DummyBuffer);
 	}
 
+	// Same for previous positions (render interpolation)
+	const bool bReorderPreviousPositions = (OldPreviousPositionsSRV != nullptr && SortedPreviousPositionsUAV != nullptr);
+	FRDGBufferSRVRef PreviousPositionsSRV = OldPreviousPositionsSRV;
+	FRDGBufferUAVRef PreviousPositionsUAV = SortedPreviousPositionsUAV;
+	if (!bReorderPreviousPositions)
+	{
+		FRDGBufferDesc DummyDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), 1);
+		FRDGBufferRef DummyBuffer = GraphBuilder.CreateBuffer(DummyDesc, TEXT("GPUFluid.DummyPreviousPositions"));
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(DummyBuffer), 0);
+		PreviousPositionsSRV = GraphBuilder.CreateSRV(DummyBuffer);
+		PreviousPositionsUAV = GraphBuilder.CreateUAV(DummyBuffer);
+	}
+
 	FReorderParticlesCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FReorderParticlesCS::FParameters>();
 	PassParameters->OldParticles = OldParticlesSRV;
 	PassParameters->SortedIndices = SortedIndicesSRV;
@@ -499,6 +539,9 @@ void FGPUZOrderSortManager::AddReorderParticlesPass(
 	PassParameters->OldBoneDeltaAttachments = AttachmentsSRV;
 	PassParameters->SortedBoneDeltaAttachments = AttachmentsUAV;
 	PassParameters->bReorderAttachments = bReorderAttachments ? 1 : 0;
+	PassParameters->OldPreviousPositions = PreviousPositionsSRV;
+	PassParameters->SortedPreviousPositions = PreviousPositionsUAV;
+	PassParameters->bReorderPreviousPositions = bReorderPreviousPositions ? 1 : 0;
 	PassParameters->ParticleCount = CurrentParticleCount;
 	if (IndirectArgsBuffer)
 	{
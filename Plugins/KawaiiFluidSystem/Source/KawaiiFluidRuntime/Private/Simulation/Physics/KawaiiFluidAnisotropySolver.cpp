@@ -0,0 +1,593 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Physics/KawaiiFluidAnisotropySolver.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Particles per parallel task (one neighbor list reused per batch) */
+	constexpr int32 ParticlesPerBatch = 256;
+
+	/** Kernel weights below this are ignored, as in the shader */
+	constexpr float MinKernelWeight = 0.0001f;
+
+	/**
+	 * @brief Helper: Null-space direction of (A - Lambda * I) via the largest cross product of its rows.
+	 * @param M Symmetric matrix.
+	 * @param EigenValue Eigenvalue whose eigenvector is wanted.
+	 * @return Unit eigenvector, or X for a degenerate system.
+	 */
+	FVector3f ComputeEigenvector(const FKawaiiFluidSymmetric3x3& M, float EigenValue)
+	{
+		const FVector3f Row0(M.XX - EigenValue, M.XY, M.XZ);
+		const FVector3f Row1(M.XY, M.YY - EigenValue, M.YZ);
+		const FVector3f Row2(M.XZ, M.YZ, M.ZZ - EigenValue);
+
+		const FVector3f Cross01 = FVector3f::CrossProduct(Row0, Row1);
+		const FVector3f Cross12 = FVector3f::CrossProduct(Row1, Row2);
+		const FVector3f Cross02 = FVector3f::CrossProduct(Row0, Row2);
+
+		const float Len01 = Cross01.SizeSquared();
+		const float Len12 = Cross12.SizeSquared();
+		const float Len02 = Cross02.SizeSquared();
+
+		FVector3f EigenVec;
+		if (Len01 >= Len12 && Len01 >= Len02)
+		{
+			EigenVec = Cross01;
+		}
+		else if (Len12 >= Len01 && Len12 >= Len02)
+		{
+			EigenVec = Cross12;
+		}
+		else
+		{
+			EigenVec = Cross02;
+		}
+
+		const float Len = EigenVec.Size();
+		return Len > 1e-10f ? EigenVec / Len : FVector3f(1.0f, 0.0f, 0.0f);
+	}
+
+	/** @brief Helper: Log of a scale, floored like the shader. */
+	float SafeLog(float Value)
+	{
+		return FMath::Loge(FMath::Max(Value, 0.001f));
+	}
+
+	/**
+	 * @brief Helper: Clamp scales in log space and convert back (shared tail of the volume-preserving paths).
+	 * @param LogScales Log-space scales.
+	 * @param Params Anisotropy parameters (MinStretch / MaxStretch).
+	 * @return Linear scales.
+	 */
+	FVector3f ClampLogScales(const FVector3f& LogScales, const FKawaiiFluidAnisotropyParams& Params)
+	{
+		const float LogMin = SafeLog(Params.MinStretch);
+		const float LogMax = SafeLog(Params.MaxStretch);
+		return FVector3f(
+			FMath::Exp(FMath::Clamp(LogScales.X, LogMin, LogMax)),
+			FMath::Exp(FMath::Clamp(LogScales.Y, LogMin, LogMax)),
+			FMath::Exp(FMath::Clamp(LogScales.Z, LogMin, LogMax)));
+	}
+
+	/** @brief Helper: Component-wise clamp to [MinStretch, MaxStretch]. */
+	FVector3f ClampScales(const FVector3f& Scales, const FKawaiiFluidAnisotropyParams& Params)
+	{
+		return FVector3f(
+			FMath::Clamp(Scales.X, Params.MinStretch, Params.MaxStretch),
+			FMath::Clamp(Scales.Y, Params.MinStretch, Params.MaxStretch),
+			FMath::Clamp(Scales.Z, Params.MinStretch, Params.MaxStretch));
+	}
+
+	/**
+	 * @brief Helper: Density-based ellipsoid of one particle from its neighbors (two passes like the shader).
+	 * @param Index Neighbor index to read positions from.
+	 * @param Center Particle position.
+	 * @param SmoothingRadius Kernel radius.
+	 * @param Params Anisotropy parameters.
+	 * @param Neighbors Scratch neighbor list.
+	 * @return Ellipsoid (identity when too few neighbors).
+	 */
+	FKawaiiFluidEllipsoid ComputeDensityEllipsoid(const FKawaiiFluidParticleQueryIndex& Index, const FVector3f& Center,
+		float SmoothingRadius, const FKawaiiFluidAnisotropyParams& Params, TArray<int32>& Neighbors)
+	{
+		Neighbors.Reset();
+		Index.QuerySphere(FVector(Center), SmoothingRadius, Neighbors);
+
+		// Pass 1: smoothed center; the neighbor list is compacted in place to the weighted neighbors
+		FVector3f SumWP = FVector3f::ZeroVector;
+		float SumW = 0.0f;
+		int32 NeighborCount = 0;
+		for (int32& Neighbor : Neighbors)
+		{
+			const FVector3f NeighborPos(Index.GetPosition(Neighbor));
+			const float W = KawaiiFluidAnisotropyMath::KernelWeight(FVector3f::Distance(NeighborPos, Center), SmoothingRadius);
+			if (W > MinKernelWeight)
+			{
+				SumWP += W * NeighborPos;
+				SumW += W;
+				Neighbors[NeighborCount++] = Neighbor;
+			}
+		}
+		Neighbors.SetNum(NeighborCount, EAllowShrinking::No);
+
+		if (NeighborCount < KawaiiFluidAnisotropyMath::MinNeighbors || SumW < MinKernelWeight)
+		{
+			return FKawaiiFluidEllipsoid();
+		}
+
+		// Pass 2: covariance around the smoothed center
+		const FVector3f SmoothedCenter = SumWP / SumW;
+		FKawaiiFluidSymmetric3x3 Sum;
+		float TotalWeight = 0.0f;
+		for (const int32 Neighbor : Neighbors)
+		{
+			const FVector3f NeighborPos(Index.GetPosition(Neighbor));
+			const float W = KawaiiFluidAnisotropyMath::KernelWeight(FVector3f::Distance(NeighborPos, Center), SmoothingRadius);
+			const FVector3f Offset = NeighborPos - SmoothedCenter;
+
+			TotalWeight += W;
+			Sum.XX += W * Offset.X * Offset.X;
+			Sum.XY += W * Offset.X * Offset.Y;
+			Sum.XZ += W * Offset.X * Offset.Z;
+			Sum.YY += W * Offset.Y * Offset.Y;
+			Sum.YZ += W * Offset.Y * Offset.Z;
+			Sum.ZZ += W * Offset.Z * Offset.Z;
+		}
+
+		if (TotalWeight < MinKernelWeight)
+		{
+			return FKawaiiFluidEllipsoid();
+		}
+
+		const float InvW = 1.0f / TotalWeight;
+		FKawaiiFluidSymmetric3x3 Covariance;
+		Covariance.XX = Sum.XX * InvW;
+		Covariance.XY = Sum.XY * InvW;
+		Covariance.XZ = Sum.XZ * InvW;
+		Covariance.YY = Sum.YY * InvW;
+		Covariance.YZ = Sum.YZ * InvW;
+		Covariance.ZZ = Sum.ZZ * InvW;
+
+		return KawaiiFluidAnisotropyMath::CalculateDensityBased(Covariance, NeighborCount, SmoothingRadius, Params);
+	}
+}
+
+//========================================
+// Shared Math (mirrors FluidAnisotropyCompute.usf)
+//========================================
+
+/**
+ * @brief Unnormalized cubic spline weight.
+ * @param Distance Distance from the particle.
+ * @param H Kernel radius.
+ * @return Weight in [0, 1].
+ */
+float KawaiiFluidAnisotropyMath::KernelWeight(float Distance, float H)
+{
+	if (Distance >= H)
+	{
+		return 0.0f;
+	}
+
+	const float Q = Distance / H;
+	if (Q < 0.5f)
+	{
+		return 1.0f - 6.0f * Q * Q + 6.0f * Q * Q * Q;
+	}
+
+	const float OneMinusQ = 1.0f - Q;
+	return 2.0f * OneMinusQ * OneMinusQ * OneMinusQ;
+}
+
+/**
+ * @brief Frisvad orthonormal basis.
+ * @param N Unit direction.
+ * @param OutT First tangent.
+ * @param OutB Second tangent.
+ */
+void KawaiiFluidAnisotropyMath::BuildOrthonormalBasis(const FVector3f& N, FVector3f& OutT, FVector3f& OutB)
+{
+	if (N.Z < -0.9999999f)
+	{
+		OutT = FVector3f(0.0f, -1.0f, 0.0f);
+		OutB = FVector3f(-1.0f, 0.0f, 0.0f);
+		return;
+	}
+
+	const float A = 1.0f / (1.0f + N.Z);
+	const float D = -N.X * N.Y * A;
+	OutT = FVector3f(1.0f - N.X * N.X * A, D, -N.X);
+	OutB = FVector3f(D, 1.0f - N.Y * N.Y * A, -N.Y);
+}
+
+/**
+ * @brief Analytical symmetric eigen-decomposition (Cardano), eigenvectors from row cross products.
+ * @param M Symmetric matrix.
+ * @param OutEigenValues Eigenvalues, descending.
+ * @param OutEigenVec0 Eigenvector of the largest eigenvalue.
+ * @param OutEigenVec1 Eigenvector of the middle eigenvalue.
+ * @param OutEigenVec2 Eigenvector of the smallest eigenvalue.
+ */
+void KawaiiFluidAnisotropyMath::SymmetricEigen3x3(const FKawaiiFluidSymmetric3x3& M, FVector3f& OutEigenValues,
+	FVector3f& OutEigenVec0, FVector3f& OutEigenVec1, FVector3f& OutEigenVec2)
+{
+	const float OffDiagSq = M.XY * M.XY + M.XZ * M.XZ + M.YZ * M.YZ;
+	if (OffDiagSq < 1e-12f)
+	{
+		// Already diagonal: sort the diagonal descending
+		const float Diagonal[3] = { M.XX, M.YY, M.ZZ };
+		int32 Order[3] = { 0, 1, 2 };
+		if (Diagonal[Order[1]] > Diagonal[Order[0]]) { Swap(Order[0], Order[1]); }
+		if (Diagonal[Order[2]] > Diagonal[Order[0]]) { Swap(Order[0], Order[2]); }
+		if (Diagonal[Order[2]] > Diagonal[Order[1]]) { Swap(Order[1], Order[2]); }
+
+		FVector3f* const OutVecs[3] = { &OutEigenVec0, &OutEigenVec1, &OutEigenVec2 };
+		for (int32 k = 0; k < 3; ++k)
+		{
+			OutEigenValues[k] = Diagonal[Order[k]];
+			*OutVecs[k] = FVector3f::ZeroVector;
+			(*OutVecs[k])[Order[k]] = 1.0f;
+		}
+		return;
+	}
+
+	// Shift to a traceless matrix B = A - q * I
+	const float Q = (M.XX + M.YY + M.ZZ) / 3.0f;
+	const float B00 = M.XX - Q;
+	const float B11 = M.YY - Q;
+	const float B22 = M.ZZ - Q;
+
+	const float P2 = (B00 * B00 + B11 * B11 + B22 * B22 + 2.0f * OffDiagSq) / 6.0f;
+	if (P2 < 1e-12f)
+	{
+		OutEigenValues = FVector3f(Q);
+		OutEigenVec0 = FVector3f(1.0f, 0.0f, 0.0f);
+		OutEigenVec1 = FVector3f(0.0f, 1.0f, 0.0f);
+		OutEigenVec2 = FVector3f(0.0f, 0.0f, 1.0f);
+		return;
+	}
+
+	const float P = FMath::Sqrt(P2);
+	const float DetB = B00 * (B11 * B22 - M.YZ * M.YZ)
+		- M.XY * (M.XY * B22 - M.YZ * M.XZ)
+		+ M.XZ * (M.XY * M.YZ - B11 * M.XZ);
+	const float R = FMath::Clamp(DetB / (2.0f * P * P * P), -1.0f, 1.0f);
+	const float Phi = FMath::Acos(R) / 3.0f;
+
+	constexpr float TwoPiOverThree = 2.0943951f;
+	const float Lambda0 = Q + 2.0f * P * FMath::Cos(Phi);
+	const float Lambda2 = Q + 2.0f * P * FMath::Cos(Phi + TwoPiOverThree);
+	const float Lambda1 = 3.0f * Q - Lambda0 - Lambda2;
+	OutEigenValues = FVector3f(Lambda0, Lambda1, Lambda2);
+
+	OutEigenVec0 = ComputeEigenvector(M, Lambda0);
+
+	// Gram-Schmidt against the first eigenvector
+	OutEigenVec1 = ComputeEigenvector(M, Lambda1);
+	OutEigenVec1 -= FVector3f::DotProduct(OutEigenVec1, OutEigenVec0) * OutEigenVec0;
+	const float Len1 = OutEigenVec1.Size();
+	if (Len1 <= 1e-10f)
+	{
+		BuildOrthonormalBasis(OutEigenVec0, OutEigenVec1, OutEigenVec2);
+		return;
+	}
+	OutEigenVec1 /= Len1;
+
+	OutEigenVec2 = FVector3f::CrossProduct(OutEigenVec0, OutEigenVec1);
+}
+
+/**
+ * @brief Velocity-based ellipsoid (CalculateVelocityBasedWithVelocity).
+ * @param Velocity Particle velocity.
+ * @param Params Anisotropy parameters.
+ * @return Ellipsoid; a sphere below 0.001 cm/s.
+ */
+FKawaiiFluidEllipsoid KawaiiFluidAnisotropyMath::CalculateVelocityBased(const FVector3f& Velocity, const FKawaiiFluidAnisotropyParams& Params)
+{
+	FKawaiiFluidEllipsoid Result;
+
+	const float Speed = Velocity.Size();
+	if (Speed <= 0.001f)
+	{
+		return Result;
+	}
+
+	Result.Axis1 = Velocity / Speed;
+	BuildOrthonormalBasis(Result.Axis1, Result.Axis2, Result.Axis3);
+
+	const float RawScale1 = 1.0f + Speed * Params.VelocityStretchFactor * Params.Strength;
+
+	if (Params.bPreserveVolume)
+	{
+		// Stretch along velocity, compress perpendicular so the log scales sum to zero
+		FVector3f LogScales;
+		LogScales.X = SafeLog(RawScale1);
+		LogScales.Y = -LogScales.X * 0.5f;
+		LogScales.Z = LogScales.Y;
+		LogScales -= FVector3f((LogScales.X + LogScales.Y + LogScales.Z) / 3.0f);
+		Result.Scales = ClampLogScales(LogScales, Params);
+	}
+	else
+	{
+		Result.Scales.X = FMath::Clamp(RawScale1 * Params.NonPreservedRenderScale, Params.MinStretch, Params.MaxStretch);
+		Result.Scales.Y = Params.NonPreservedRenderScale;
+		Result.Scales.Z = Params.NonPreservedRenderScale;
+	}
+
+	return Result;
+}
+
+/**
+ * @brief Density-based ellipsoid from a covariance matrix (tail of CalculateDensityBased).
+ * @param Covariance Weighted neighbor covariance.
+ * @param NeighborCount Neighbors with non-negligible weight.
+ * @param SmoothingRadius Kernel radius.
+ * @param Params Anisotropy parameters.
+ * @return Ellipsoid.
+ */
+FKawaiiFluidEllipsoid KawaiiFluidAnisotropyMath::CalculateDensityBased(const FKawaiiFluidSymmetric3x3& Covariance, int32 NeighborCount,
+	float SmoothingRadius, const FKawaiiFluidAnisotropyParams& Params)
+{
+	FKawaiiFluidEllipsoid Result;
+	if (NeighborCount < MinNeighbors)
+	{
+		return Result;
+	}
+
+	FVector3f EigenValues, EV0, EV1, EV2;
+	SymmetricEigen3x3(Covariance, EigenValues, EV0, EV1, EV2);
+
+	const float Sigma0 = FMath::Sqrt(FMath::Max(EigenValues.X, 0.0001f));
+	const float MinSigma = Sigma0 / KR;
+	const float Sigma1 = FMath::Max(FMath::Sqrt(FMath::Max(EigenValues.Y, 0.0001f)), MinSigma);
+	const float Sigma2 = FMath::Max(FMath::Sqrt(FMath::Max(EigenValues.Z, 0.0001f)), MinSigma);
+
+	// Surface particles (few neighbors) get partial anisotropy
+	const float BlendFactor = FMath::Clamp(
+		static_cast<float>(NeighborCount - MinNeighbors) / static_cast<float>(FullNeighbors - MinNeighbors), 0.0f, 1.0f);
+
+	if (Params.bPreserveVolume)
+	{
+		// Yu & Turk: normalize by the geometric mean, then work in log space (sum of logs = 0 <=> unit volume)
+		float GeoMean = FMath::Pow(Sigma0 * Sigma1 * Sigma2, 1.0f / 3.0f);
+		if (GeoMean < 0.0001f)
+		{
+			GeoMean = 1.0f;
+		}
+
+		FVector3f LogScales(SafeLog(Sigma0 / GeoMean), SafeLog(Sigma1 / GeoMean), SafeLog(Sigma2 / GeoMean));
+		LogScales *= Params.Strength;
+		LogScales -= FVector3f((LogScales.X + LogScales.Y + LogScales.Z) / 3.0f);
+		LogScales *= BlendFactor;
+		Result.Scales = ClampLogScales(LogScales, Params);
+	}
+	else
+	{
+		// FleX: smoothingRadius / sigma with the minimum sigma relative to the maximum
+		const float MaxSigma = FMath::Max3(Sigma0, Sigma1, Sigma2);
+		const float MinSigmaThreshold = MaxSigma * Params.MinStretch;
+		constexpr float Epsilon = 0.0001f;
+
+		FVector3f Scales(
+			SmoothingRadius / FMath::Max(FMath::Max(Sigma0, MinSigmaThreshold), Epsilon),
+			SmoothingRadius / FMath::Max(FMath::Max(Sigma1, MinSigmaThreshold), Epsilon),
+			SmoothingRadius / FMath::Max(FMath::Max(Sigma2, MinSigmaThreshold), Epsilon));
+		Scales *= Params.NonPreservedRenderScale;
+		Scales = FMath::Lerp(FVector3f::OneVector, Scales, Params.Strength);
+		Scales = FMath::Lerp(FVector3f::OneVector, Scales, BlendFactor);
+		Result.Scales = ClampScales(Scales, Params);
+	}
+
+	Result.Axis1 = EV0.GetSafeNormal();
+	Result.Axis2 = EV1.GetSafeNormal();
+	Result.Axis3 = EV2.GetSafeNormal();
+	return Result;
+}
+
+/**
+ * @brief Hybrid blend of density and velocity ellipsoids.
+ * @param Density Density-based ellipsoid.
+ * @param Velocity Velocity-based ellipsoid.
+ * @param Params Anisotropy parameters (DensityWeight).
+ * @return Blended ellipsoid.
+ */
+FKawaiiFluidEllipsoid KawaiiFluidAnisotropyMath::BlendHybrid(const FKawaiiFluidEllipsoid& Density, const FKawaiiFluidEllipsoid& Velocity,
+	const FKawaiiFluidAnisotropyParams& Params)
+{
+	// Hard axis switch avoids interpolating between unrelated frames
+	FKawaiiFluidEllipsoid Result = Params.DensityWeight > 0.5f ? Density : Velocity;
+
+	if (Params.bPreserveVolume)
+	{
+		const FVector3f LogVelocity(SafeLog(Velocity.Scales.X), SafeLog(Velocity.Scales.Y), SafeLog(Velocity.Scales.Z));
+		const FVector3f LogDensity(SafeLog(Density.Scales.X), SafeLog(Density.Scales.Y), SafeLog(Density.Scales.Z));
+		Result.Scales = ClampLogScales(FMath::Lerp(LogVelocity, LogDensity, Params.DensityWeight), Params);
+	}
+	else
+	{
+		Result.Scales = ClampScales(FMath::Lerp(Velocity.Scales, Density.Scales, Params.DensityWeight), Params);
+	}
+
+	return Result;
+}
+
+/**
+ * @brief Temporal smoothing against the previous result.
+ * @param Current Ellipsoid of this update.
+ * @param PrevAxis1 Previous first axis (xyz = direction, w = scale), likewise PrevAxis2/PrevAxis3.
+ * @param SmoothFactor Weight of the previous result.
+ * @return Smoothed ellipsoid.
+ */
+FKawaiiFluidEllipsoid KawaiiFluidAnisotropyMath::ApplyTemporalSmoothing(const FKawaiiFluidEllipsoid& Current, const FVector4f& PrevAxis1,
+	const FVector4f& PrevAxis2, const FVector4f& PrevAxis3, float SmoothFactor)
+{
+	const FVector4f* const Prev[3] = { &PrevAxis1, &PrevAxis2, &PrevAxis3 };
+	const FVector3f* const Axes[3] = { &Current.Axis1, &Current.Axis2, &Current.Axis3 };
+
+	FKawaiiFluidEllipsoid Result;
+	FVector3f* const OutAxes[3] = { &Result.Axis1, &Result.Axis2, &Result.Axis3 };
+
+	for (int32 k = 0; k < 3; ++k)
+	{
+		// v and -v describe the same ellipsoid
+		const FVector3f PrevAxis(*Prev[k]);
+		const FVector3f Axis = FVector3f::DotProduct(*Axes[k], PrevAxis) < 0.0f ? -*Axes[k] : *Axes[k];
+		*OutAxes[k] = FMath::Lerp(Axis, PrevAxis, SmoothFactor).GetSafeNormal();
+		Result.Scales[k] = FMath::Exp(FMath::Lerp(SafeLog(Current.Scales[k]), SafeLog(Prev[k]->W), SmoothFactor));
+	}
+
+	return Result;
+}
+
+//========================================
+// Solver
+//========================================
+
+/**
+ * @brief Recompute the anisotropy when the update interval has elapsed.
+ * @param Positions Particle positions.
+ * @param Velocities Particle velocities (empty = at rest).
+ * @param Params Anisotropy parameters.
+ * @param SmoothingRadius Neighbor search / kernel radius.
+ * @return True if the axes were recomputed by this call.
+ */
+bool FKawaiiFluidAnisotropySolver::Update(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> Velocities,
+	const FKawaiiFluidAnisotropyParams& Params, float SmoothingRadius)
+{
+	if (!Params.bEnabled)
+	{
+		Reset();
+		return false;
+	}
+
+	// Same cadence as the GPU pass: recompute every UpdateInterval frames, immediately when stale
+	++FrameCounter;
+	if (FrameCounter < FMath::Max(1, Params.UpdateInterval) && bHasResult && Axis1.Num() == Positions.Num())
+	{
+		return false;
+	}
+
+	FrameCounter = 0;
+	Compute(Positions, Velocities, Params, SmoothingRadius);
+	return true;
+}
+
+/**
+ * @brief Update from CPU simulation particles.
+ * @param Particles Simulation particles.
+ * @param Params Anisotropy parameters.
+ * @param SmoothingRadius Neighbor search / kernel radius.
+ * @return True if the axes were recomputed by this call.
+ */
+bool FKawaiiFluidAnisotropySolver::Update(const TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidAnisotropyParams& Params, float SmoothingRadius)
+{
+	ScratchPositions.SetNumUninitialized(Particles.Num(), EAllowShrinking::No);
+	ScratchVelocities.SetNumUninitialized(Particles.Num(), EAllowShrinking::No);
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		ScratchPositions[i] = FVector3f(Particles[i].Position);
+		ScratchVelocities[i] = FVector3f(Particles[i].Velocity);
+	}
+
+	return Update(ScratchPositions, ScratchVelocities, Params, SmoothingRadius);
+}
+
+/**
+ * @brief Compute the anisotropy of every particle.
+ * @param Positions Particle positions.
+ * @param Velocities Particle velocities (empty = at rest).
+ * @param Params Anisotropy parameters.
+ * @param SmoothingRadius Neighbor search / kernel radius.
+ */
+void FKawaiiFluidAnisotropySolver::Compute(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> Velocities,
+	const FKawaiiFluidAnisotropyParams& Params, float SmoothingRadius)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidAnisotropySolver_Compute);
+
+	const int32 NumParticles = Positions.Num();
+	const bool bSmooth = Params.bEnableTemporalSmoothing && bHasResult && Axis1.Num() == NumParticles;
+	const bool bHasVelocities = Velocities.Num() == NumParticles;
+	const bool bNeedsNeighbors = Params.Mode != EKawaiiFluidAnisotropyMode::VelocityBased && SmoothingRadius > 0.0f;
+
+	Axis1.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	Axis2.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	Axis3.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+
+	if (bNeedsNeighbors)
+	{
+		if (InputIndices.Num() != NumParticles)
+		{
+			InputIndices.SetNumUninitialized(NumParticles);
+			for (int32 i = 0; i < NumParticles; ++i)
+			{
+				InputIndices[i] = i;
+			}
+		}
+
+		NeighborIndex.Reset();
+		NeighborIndex.AddParticles(Positions, TConstArrayView<FVector3f>(), InputIndices);
+		NeighborIndex.Build(SmoothingRadius);
+	}
+
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumParticles, ParticlesPerBatch);
+	ParallelFor(NumBatches, [&](int32 Batch)
+	{
+		TArray<int32> Neighbors;
+		const int32 Begin = Batch * ParticlesPerBatch;
+		const int32 End = FMath::Min(Begin + ParticlesPerBatch, NumParticles);
+
+		for (int32 Slot = Begin; Slot < End; ++Slot)
+		{
+			// With neighbors, walk in cell order so consecutive particles share neighbor cells
+			const int32 i = bNeedsNeighbors ? NeighborIndex.GetSourceID(Slot) : Slot;
+			const FVector3f Velocity = bHasVelocities ? Velocities[i] : FVector3f::ZeroVector;
+
+			FKawaiiFluidEllipsoid Ellipsoid;
+			switch (Params.Mode)
+			{
+			case EKawaiiFluidAnisotropyMode::VelocityBased:
+				Ellipsoid = KawaiiFluidAnisotropyMath::CalculateVelocityBased(Velocity, Params);
+				break;
+			case EKawaiiFluidAnisotropyMode::DensityBased:
+				Ellipsoid = bNeedsNeighbors
+					? ComputeDensityEllipsoid(NeighborIndex, FVector3f(NeighborIndex.GetPosition(Slot)), SmoothingRadius, Params, Neighbors)
+					: FKawaiiFluidEllipsoid();
+				break;
+			default:
+				Ellipsoid = KawaiiFluidAnisotropyMath::BlendHybrid(
+					bNeedsNeighbors
+						? ComputeDensityEllipsoid(NeighborIndex, FVector3f(NeighborIndex.GetPosition(Slot)), SmoothingRadius, Params, Neighbors)
+						: FKawaiiFluidEllipsoid(),
+					KawaiiFluidAnisotropyMath::CalculateVelocityBased(Velocity, Params),
+					Params);
+				break;
+			}
+
+			if (bSmooth)
+			{
+				Ellipsoid = KawaiiFluidAnisotropyMath::ApplyTemporalSmoothing(Ellipsoid, Axis1[i], Axis2[i], Axis3[i], Params.TemporalSmoothFactor);
+			}
+
+			Axis1[i] = FVector4f(Ellipsoid.Axis1, Ellipsoid.Scales.X);
+			Axis2[i] = FVector4f(Ellipsoid.Axis2, Ellipsoid.Scales.Y);
+			Axis3[i] = FVector4f(Ellipsoid.Axis3, Ellipsoid.Scales.Z);
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	bHasResult = true;
+}
+
+/**
+ * @brief Drop the result and the update cadence.
+ */
+void FKawaiiFluidAnisotropySolver::Reset()
+{
+	NeighborIndex.Reset();
+	Axis1.Reset();
+	Axis2.Reset();
+	Axis3.Reset();
+	FrameCounter = 0;
+	bHasResult = false;
+}
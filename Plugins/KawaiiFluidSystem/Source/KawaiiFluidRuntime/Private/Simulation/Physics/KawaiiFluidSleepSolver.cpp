@@ -0,0 +1,475 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Physics/KawaiiFluidSleepSolver.h"
+#include "Async/ParallelFor.h"
+
+namespace KawaiiFluidSleepLevel
+{
+	constexpr uint8 Inactive = 0;
+	constexpr uint8 Halo = 1;
+	constexpr uint8 Active = 2;
+	constexpr uint8 Awake = 3;
+}
+
+/**
+ * @brief Default constructor for FKawaiiFluidSleepSolver.
+ */
+FKawaiiFluidSleepSolver::FKawaiiFluidSleepSolver()
+{
+}
+
+/**
+ * @brief Drop all cached cell data (e.g. after particles were edited externally).
+ */
+void FKawaiiFluidSleepSolver::Reset()
+{
+	CellKeys.Reset();
+	CellIndexMap.Reset();
+	CellStarts.Reset();
+	SortedIndices.Reset();
+	CellLevels.Reset();
+	WorkingToFull.Reset();
+	WorkingParticles.Reset();
+	CachedParticlesData = nullptr;
+	CachedParticleCount = -1;
+	bAllAsleep = false;
+	Stats = FKawaiiFluidSleepStats();
+}
+
+/**
+ * @brief Wake sleeping particles inside a box (collider overlap).
+ * Uses the cell index of the last build when it still matches the array, otherwise scans all particles.
+ * @param Particles In/Out particle array.
+ * @param Bounds World-space box, already expanded by the particle radius.
+ * @return Number of particles woken.
+ */
+int32 FKawaiiFluidSleepSolver::WakeInBounds(TArray<FKawaiiFluidParticle>& Particles, const FBox& Bounds)
+{
+	if (!Bounds.IsValid || Particles.Num() == 0)
+	{
+		return 0;
+	}
+
+	auto TryWake = [&Bounds](FKawaiiFluidParticle& Particle)
+	{
+		if (Particle.bIsSleeping && Bounds.IsInsideOrOn(Particle.Position))
+		{
+			Particle.bIsSleeping = false;
+			Particle.SleepCounter = 0;
+			return true;
+		}
+		return false;
+	};
+
+	int32 WokenCount = 0;
+	const bool bCacheValid = Particles.GetData() == CachedParticlesData && Particles.Num() == CachedParticleCount && CachedCellSize > 0.0f;
+
+	if (bCacheValid)
+	{
+		// Sleeping particles are frozen, so their cell keys from the last build are still exact
+		const float InvCellSize = 1.0f / CachedCellSize;
+		const FIntVector MinCell(
+			FMath::FloorToInt(Bounds.Min.X * InvCellSize),
+			FMath::FloorToInt(Bounds.Min.Y * InvCellSize),
+			FMath::FloorToInt(Bounds.Min.Z * InvCellSize));
+		const FIntVector MaxCell(
+			FMath::FloorToInt(Bounds.Max.X * InvCellSize),
+			FMath::FloorToInt(Bounds.Max.Y * InvCellSize),
+			FMath::FloorToInt(Bounds.Max.Z * InvCellSize));
+
+		const int64 RangeCells =
+			static_cast<int64>(MaxCell.X - MinCell.X + 1) *
+			static_cast<int64>(MaxCell.Y - MinCell.Y + 1) *
+			static_cast<int64>(MaxCell.Z - MinCell.Z + 1);
+
+		auto WakeCell = [&](int32 CellIndex)
+		{
+			for (int32 s = CellStarts[CellIndex]; s < CellStarts[CellIndex + 1]; ++s)
+			{
+				WokenCount += TryWake(Particles[SortedIndices[s]]) ? 1 : 0;
+			}
+		};
+
+		if (RangeCells <= CellIndexMap.Num())
+		{
+			for (int32 z = MinCell.Z; z <= MaxCell.Z; ++z)
+			for (int32 y = MinCell.Y; y <= MaxCell.Y; ++y)
+			for (int32 x = MinCell.X; x <= MaxCell.X; ++x)
+			{
+				if (const int32* CellIndex = CellIndexMap.Find(FIntVector(x, y, z)))
+				{
+					WakeCell(*CellIndex);
+				}
+			}
+		}
+		else
+		{
+			for (const TPair<FIntVector, int32>& Pair : CellIndexMap)
+			{
+				const FIntVector& Key = Pair.Key;
+				if (Key.X >= MinCell.X && Key.X <= MaxCell.X &&
+					Key.Y >= MinCell.Y && Key.Y <= MaxCell.Y &&
+					Key.Z >= MinCell.Z && Key.Z <= MaxCell.Z)
+				{
+					WakeCell(Pair.Value);
+				}
+			}
+		}
+	}
+	else
+	{
+		for (FKawaiiFluidParticle& Particle : Particles)
+		{
+			WokenCount += TryWake(Particle) ? 1 : 0;
+		}
+	}
+
+	if (WokenCount > 0)
+	{
+		bAllAsleep = false;
+	}
+	return WokenCount;
+}
+
+/**
+ * @brief Wake sleepers in and around the cells of particles spawned since the last build.
+ * Spawns are appended, so particles past the previous build's count are new. Without this a spawn at rest
+ * on a settled pool would overlap frozen sleepers that never feel its pressure.
+ * @param Particles In/Out particle array.
+ * @param CellSize Deactivation cell size (cm).
+ * @return Number of particles woken.
+ */
+int32 FKawaiiFluidSleepSolver::WakeNearSpawned(TArray<FKawaiiFluidParticle>& Particles, float CellSize)
+{
+	const int32 NumParticles = Particles.Num();
+	if (CachedParticleCount < 0 || NumParticles <= CachedParticleCount)
+	{
+		return 0;
+	}
+
+	const float InvCellSize = 1.0f / FMath::Max(CellSize, 0.01f);
+	auto GetCellKey = [InvCellSize](const FVector& P)
+	{
+		return FIntVector(
+			FMath::FloorToInt(P.X * InvCellSize),
+			FMath::FloorToInt(P.Y * InvCellSize),
+			FMath::FloorToInt(P.Z * InvCellSize));
+	};
+
+	// Cells of the new particles and their 26 neighbors
+	TSet<FIntVector> WakeCells;
+	for (int32 i = CachedParticleCount; i < NumParticles; ++i)
+	{
+		const FIntVector Key = GetCellKey(Particles[i].Position);
+		for (int32 dz = -1; dz <= 1; ++dz)
+		for (int32 dy = -1; dy <= 1; ++dy)
+		for (int32 dx = -1; dx <= 1; ++dx)
+		{
+			WakeCells.Add(Key + FIntVector(dx, dy, dz));
+		}
+	}
+
+	int32 WokenCount = 0;
+	for (int32 i = 0; i < CachedParticleCount; ++i)
+	{
+		FKawaiiFluidParticle& Particle = Particles[i];
+		if (Particle.bIsSleeping && WakeCells.Contains(GetCellKey(Particle.Position)))
+		{
+			Particle.bIsSleeping = false;
+			Particle.SleepCounter = 0;
+			++WokenCount;
+		}
+	}
+
+	if (WokenCount > 0)
+	{
+		bAllAsleep = false;
+	}
+	return WokenCount;
+}
+
+/**
+ * @brief Mark every existing neighbor of SourceLevel cells with at least TargetLevel.
+ * @param SourceLevel Level of cells to dilate from.
+ * @param TargetLevel Level assigned to their neighbors (never lowers a level).
+ */
+void FKawaiiFluidSleepSolver::DilateCells(uint8 SourceLevel, uint8 TargetLevel)
+{
+	TArray<FIntVector> CellCoords;
+	CellCoords.SetNumUninitialized(CellIndexMap.Num());
+	for (const TPair<FIntVector, int32>& Pair : CellIndexMap)
+	{
+		CellCoords[Pair.Value] = Pair.Key;
+	}
+
+	TArray<int32> Targets;
+	for (int32 CellIndex = 0; CellIndex < CellLevels.Num(); ++CellIndex)
+	{
+		if (CellLevels[CellIndex] != SourceLevel)
+		{
+			continue;
+		}
+
+		const FIntVector& Coord = CellCoords[CellIndex];
+		for (int32 dz = -1; dz <= 1; ++dz)
+		for (int32 dy = -1; dy <= 1; ++dy)
+		for (int32 dx = -1; dx <= 1; ++dx)
+		{
+			if (const int32* NeighborIndex = CellIndexMap.Find(Coord + FIntVector(dx, dy, dz)))
+			{
+				if (CellLevels[*NeighborIndex] < TargetLevel)
+				{
+					Targets.Add(*NeighborIndex);
+				}
+			}
+		}
+	}
+
+	// Applied after the scan so newly raised cells do not cascade within one pass
+	for (const int32 CellIndex : Targets)
+	{
+		CellLevels[CellIndex] = FMath::Max(CellLevels[CellIndex], TargetLevel);
+	}
+}
+
+/**
+ * @brief Classify cells and build the working set for this substep.
+ * @param Particles Particle array (positions at the start of the substep).
+ * @param CellSize Deactivation cell size (cm).
+ * @return False when every particle is asleep and the substep can be skipped entirely.
+ */
+bool FKawaiiFluidSleepSolver::BuildActiveSet(const TArray<FKawaiiFluidParticle>& Particles, float CellSize)
+{
+	const int32 NumParticles = Particles.Num();
+	CellSize = FMath::Max(CellSize, 0.01f);
+
+	// Settled pool: nothing moved, spawned or despawned since the last build
+	if (bAllAsleep && Particles.GetData() == CachedParticlesData && NumParticles == CachedParticleCount && CellSize == CachedCellSize)
+	{
+		return false;
+	}
+
+	CachedParticlesData = Particles.GetData();
+	CachedParticleCount = NumParticles;
+	CachedCellSize = CellSize;
+	WorkingToFull.Reset();
+	Stats = FKawaiiFluidSleepStats();
+
+	if (NumParticles == 0)
+	{
+		bAllAsleep = true;
+		return false;
+	}
+
+	// 1. Cell key per particle
+	const float InvCellSize = 1.0f / CellSize;
+	CellKeys.SetNumUninitialized(NumParticles);
+	ParallelFor(NumParticles, [&](int32 i)
+	{
+		const FVector& P = Particles[i].Position;
+		CellKeys[i] = FIntVector(
+			FMath::FloorToInt(P.X * InvCellSize),
+			FMath::FloorToInt(P.Y * InvCellSize),
+			FMath::FloorToInt(P.Z * InvCellSize));
+	});
+
+	// 2. Dense cell indices + counting sort of particles by cell
+	CellIndexMap.Reset();
+	TArray<int32> ParticleCell;
+	ParticleCell.SetNumUninitialized(NumParticles);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const int32 NewIndex = CellIndexMap.Num();
+		ParticleCell[i] = CellIndexMap.FindOrAdd(CellKeys[i], NewIndex);
+	}
+
+	const int32 NumCells = CellIndexMap.Num();
+	CellStarts.Reset();
+	CellStarts.SetNumZeroed(NumCells + 1);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		++CellStarts[ParticleCell[i] + 1];
+	}
+	for (int32 c = 0; c < NumCells; ++c)
+	{
+		CellStarts[c + 1] += CellStarts[c];
+	}
+
+	SortedIndices.SetNumUninitialized(NumParticles);
+	TArray<int32> WriteOffsets(CellStarts.GetData(), NumCells);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		SortedIndices[WriteOffsets[ParticleCell[i]]++] = i;
+	}
+
+	// 3. Awake cells, then one ring of active cells and one ring of frozen halo
+	CellLevels.Reset();
+	CellLevels.SetNumZeroed(NumCells);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		if (!Particles[i].bIsSleeping)
+		{
+			CellLevels[ParticleCell[i]] = KawaiiFluidSleepLevel::Awake;
+			++Stats.AwakeParticles;
+		}
+	}
+
+	Stats.TotalCells = NumCells;
+	bAllAsleep = Stats.AwakeParticles == 0;
+	if (bAllAsleep)
+	{
+		return false;
+	}
+
+	DilateCells(KawaiiFluidSleepLevel::Awake, KawaiiFluidSleepLevel::Active);
+	DilateCells(KawaiiFluidSleepLevel::Active, KawaiiFluidSleepLevel::Halo);
+
+	// 4. Working set
+	int32 SimulatedCount = 0;
+	for (int32 c = 0; c < NumCells; ++c)
+	{
+		if (CellLevels[c] >= KawaiiFluidSleepLevel::Active)
+		{
+			++Stats.ActiveCells;
+		}
+		if (CellLevels[c] != KawaiiFluidSleepLevel::Inactive)
+		{
+			SimulatedCount += CellStarts[c + 1] - CellStarts[c];
+		}
+	}
+	Stats.SimulatedParticles = SimulatedCount;
+
+	// Everything is in play: run in place, no compaction
+	if (SimulatedCount == NumParticles)
+	{
+		return true;
+	}
+
+	WorkingToFull.Reserve(SimulatedCount);
+	for (int32 c = 0; c < NumCells; ++c)
+	{
+		if (CellLevels[c] != KawaiiFluidSleepLevel::Inactive)
+		{
+			for (int32 s = CellStarts[c]; s < CellStarts[c + 1]; ++s)
+			{
+				WorkingToFull.Add(SortedIndices[s]);
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Move the working set particles out of the full array into a compact array.
+ * @param Particles Full particle array (entries in the working set are left moved-from until scatter).
+ * @return Compact working array to run the substep on.
+ */
+TArray<FKawaiiFluidParticle>& FKawaiiFluidSleepSolver::GatherWorkingSet(TArray<FKawaiiFluidParticle>& Particles)
+{
+	const int32 NumWorking = WorkingToFull.Num();
+	WorkingParticles.SetNum(NumWorking);
+
+	ParallelFor(NumWorking, [&](int32 j)
+	{
+		WorkingParticles[j] = MoveTemp(Particles[WorkingToFull[j]]);
+	});
+
+	return WorkingParticles;
+}
+
+/**
+ * @brief Move the working set back into the full array, remapping neighbor indices to full-array indices.
+ * @param Particles Full particle array.
+ */
+void FKawaiiFluidSleepSolver::ScatterWorkingSet(TArray<FKawaiiFluidParticle>& Particles)
+{
+	const int32 NumWorking = WorkingToFull.Num();
+
+	ParallelFor(NumWorking, [&](int32 j)
+	{
+		FKawaiiFluidParticle& Particle = WorkingParticles[j];
+		for (int32& NeighborIndex : Particle.NeighborIndices)
+		{
+			NeighborIndex = WorkingToFull[NeighborIndex];
+		}
+		Particles[WorkingToFull[j]] = MoveTemp(Particle);
+	});
+
+	WorkingParticles.Reset();
+}
+
+/**
+ * @brief Update sleep counters and wake sleepers (mirrors UpdateParticleSleepingCS).
+ * Wake sources: own speed, or an awake neighbor faster than WakeVelocityThreshold (one hop per substep).
+ * @param Particles Particle array whose NeighborIndices are valid for this array.
+ * @param Params Sleep thresholds.
+ */
+void FKawaiiFluidSleepSolver::UpdateSleepStates(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidSleepParams& Params)
+{
+	const int32 NumParticles = Particles.Num();
+	if (NumParticles == 0)
+	{
+		return;
+	}
+
+	const float SleepSpeedSq = FMath::Square(Params.SleepVelocityThreshold);
+	const float WakeSpeedSq = FMath::Square(Params.WakeVelocityThreshold);
+
+	// Phase 1: wake decisions read neighbor state, so they are resolved before any flag changes
+	TArray<bool> WakeMask;
+	WakeMask.SetNumZeroed(NumParticles);
+	ParallelFor(NumParticles, [&](int32 i)
+	{
+		const FKawaiiFluidParticle& Particle = Particles[i];
+		if (!Particle.bIsSleeping)
+		{
+			return;
+		}
+
+		if (Particle.bIsAttached || Particle.Velocity.SizeSquared() > WakeSpeedSq)
+		{
+			WakeMask[i] = true;
+			return;
+		}
+
+		for (const int32 NeighborIndex : Particle.NeighborIndices)
+		{
+			const FKawaiiFluidParticle& Neighbor = Particles[NeighborIndex];
+			if (NeighborIndex != i && !Neighbor.bIsSleeping && Neighbor.Velocity.SizeSquared() > WakeSpeedSq)
+			{
+				WakeMask[i] = true;
+				return;
+			}
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	// Phase 2: apply
+	ParallelFor(NumParticles, [&](int32 i)
+	{
+		FKawaiiFluidParticle& Particle = Particles[i];
+
+		if (Particle.bIsSleeping)
+		{
+			if (WakeMask[i])
+			{
+				Particle.bIsSleeping = false;
+				Particle.SleepCounter = 0;
+			}
+			return;
+		}
+
+		// Attached particles follow their surface and never sleep
+		if (!Particle.bIsAttached && Particle.Velocity.SizeSquared() < SleepSpeedSq)
+		{
+			if (++Particle.SleepCounter >= Params.SleepFrameThreshold)
+			{
+				Particle.bIsSleeping = true;
+				Particle.Velocity = FVector::ZeroVector;
+			}
+		}
+		else
+		{
+			Particle.SleepCounter = 0;
+		}
+	});
+}
@@ -0,0 +1,233 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Resources/GPUBoundaryBoneArena.h"
+
+//=============================================================================
+// FGPUBoundaryBoneRange / FGPUBoundaryBoneArenaSnapshot
+//=============================================================================
+
+/**
+ * @brief Sort ranges by start and merge overlapping or adjacent ones.
+ * @param Ranges Ranges to coalesce in place.
+ */
+void FGPUBoundaryBoneRange::Coalesce(TArray<FGPUBoundaryBoneRange>& Ranges)
+{
+	if (Ranges.Num() < 2)
+	{
+		return;
+	}
+
+	Ranges.Sort([](const FGPUBoundaryBoneRange& A, const FGPUBoundaryBoneRange& B) { return A.Start < B.Start; });
+
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 1; ReadIndex < Ranges.Num(); ++ReadIndex)
+	{
+		FGPUBoundaryBoneRange& Current = Ranges[WriteIndex];
+		const FGPUBoundaryBoneRange& Next = Ranges[ReadIndex];
+		if (Next.Start <= Current.End())
+		{
+			Current.Num = FMath::Max(Current.End(), Next.End()) - Current.Start;
+		}
+		else
+		{
+			Ranges[++WriteIndex] = Next;
+		}
+	}
+	Ranges.SetNum(WriteIndex + 1, EAllowShrinking::No);
+}
+
+TConstArrayView<FGPUBoundaryBoneTransform> FGPUBoundaryBoneArenaSnapshot::GetOwnerBones(int32 OwnerID) const
+{
+	const FGPUBoundaryBoneOwner* Owner = Owners.Find(OwnerID);
+	if (!Owner || !Bones.IsValid() || Owner->Count == 0)
+	{
+		return TConstArrayView<FGPUBoundaryBoneTransform>();
+	}
+	return TConstArrayView<FGPUBoundaryBoneTransform>(Bones->GetData() + Owner->Offset, Owner->Count);
+}
+
+//=============================================================================
+// FGPUBoundaryBoneArena
+//=============================================================================
+
+/**
+ * @brief Store one owner's bones; only the span between the first and last bone moved beyond tolerance is written.
+ * @param OwnerID Boundary owner.
+ * @param InBones Bone transforms.
+ * @param ComponentTransform Component world matrix.
+ * @param PositionTolerance Max translation difference per axis ignored (cm).
+ * @param RotationTolerance Max quaternion and scale component difference ignored.
+ * @return True if any bone or the component transform changed.
+ */
+bool FGPUBoundaryBoneArena::WriteOwner(int32 OwnerID, TConstArrayView<FGPUBoundaryBoneTransform> InBones, const FMatrix44f& ComponentTransform,
+	float PositionTolerance, float RotationTolerance)
+{
+	const int32 Count = InBones.Num();
+	FGPUBoundaryBoneOwner* Owner = Owners.Find(OwnerID);
+
+	// New owner or changed skeleton: append a fresh range, the old one becomes a hole
+	if (!Owner || Owner->Count != Count)
+	{
+		if (Owner)
+		{
+			FreeBoneCount += Owner->Count;
+		}
+
+		MakeBonesWritable();
+		FGPUBoundaryBoneOwner& NewOwner = Owners.FindOrAdd(OwnerID);
+		NewOwner.Offset = Bones->Num();
+		NewOwner.Count = Count;
+		NewOwner.ComponentTransform = ComponentTransform;
+		Bones->Append(InBones.GetData(), Count);
+		if (Count > 0)
+		{
+			DirtyRanges.Add({ NewOwner.Offset, Count });
+		}
+
+		if (FreeBoneCount >= MinFreeBonesForCompaction && FreeBoneCount > Bones->Num() - FreeBoneCount)
+		{
+			Compact();
+		}
+		return true;
+	}
+
+	const bool bComponentChanged = Owner->ComponentTransform != ComponentTransform;
+	Owner->ComponentTransform = ComponentTransform;
+
+	const FGPUBoundaryBoneTransform* Stored = Bones->GetData() + Owner->Offset;
+	int32 FirstChanged = INDEX_NONE;
+	int32 LastChanged = INDEX_NONE;
+	for (int32 BoneIndex = 0; BoneIndex < Count; ++BoneIndex)
+	{
+		if (!Stored[BoneIndex].Equals(InBones[BoneIndex], PositionTolerance, RotationTolerance))
+		{
+			FirstChanged = FirstChanged == INDEX_NONE ? BoneIndex : FirstChanged;
+			LastChanged = BoneIndex;
+		}
+	}
+
+	if (FirstChanged == INDEX_NONE)
+	{
+		return bComponentChanged;
+	}
+
+	MakeBonesWritable();
+	const int32 ChangedCount = LastChanged - FirstChanged + 1;
+	FMemory::Memcpy(Bones->GetData() + Owner->Offset + FirstChanged, InBones.GetData() + FirstChanged, ChangedCount * sizeof(FGPUBoundaryBoneTransform));
+	DirtyRanges.Add({ Owner->Offset + FirstChanged, ChangedCount });
+	return true;
+}
+
+/**
+ * @brief Free an owner's range.
+ * @param OwnerID Boundary owner.
+ * @return False if the owner is unknown.
+ */
+bool FGPUBoundaryBoneArena::RemoveOwner(int32 OwnerID)
+{
+	FGPUBoundaryBoneOwner RemovedOwner;
+	if (!Owners.RemoveAndCopyValue(OwnerID, RemovedOwner))
+	{
+		return false;
+	}
+
+	if (Owners.Num() == 0)
+	{
+		Reset();
+		return true;
+	}
+
+	FreeBoneCount += RemovedOwner.Count;
+	if (FreeBoneCount >= MinFreeBonesForCompaction && FreeBoneCount > NumBones() - FreeBoneCount)
+	{
+		Compact();
+	}
+	return true;
+}
+
+/**
+ * @brief Drop every owner and bump the layout revision.
+ */
+void FGPUBoundaryBoneArena::Reset()
+{
+	// Snapshots keep their own reference, so the shared array is released, not cleared
+	Bones.Reset();
+	Owners.Reset();
+	DirtyRanges.Reset();
+	FreeBoneCount = 0;
+	++LayoutRevision;
+}
+
+/**
+ * @brief Share the current bones with a new snapshot.
+ * @return Snapshot holding the dirty ranges gathered since the previous one.
+ */
+FGPUBoundaryBoneArenaSnapshot FGPUBoundaryBoneArena::TakeSnapshot()
+{
+	if (!Bones.IsValid())
+	{
+		Bones = MakeShared<TArray<FGPUBoundaryBoneTransform>, ESPMode::ThreadSafe>();
+	}
+
+	FGPUBoundaryBoneRange::Coalesce(DirtyRanges);
+
+	FGPUBoundaryBoneArenaSnapshot Snapshot;
+	Snapshot.Bones = Bones;
+	Snapshot.Owners = Owners;
+	Snapshot.DirtyRanges = MoveTemp(DirtyRanges);
+	Snapshot.LayoutRevision = LayoutRevision;
+
+	DirtyRanges.Reset();
+	return Snapshot;
+}
+
+TConstArrayView<FGPUBoundaryBoneTransform> FGPUBoundaryBoneArena::GetOwnerBones(int32 OwnerID) const
+{
+	const FGPUBoundaryBoneOwner* Owner = Owners.Find(OwnerID);
+	if (!Owner || !Bones.IsValid() || Owner->Count == 0)
+	{
+		return TConstArrayView<FGPUBoundaryBoneTransform>();
+	}
+	return TConstArrayView<FGPUBoundaryBoneTransform>(Bones->GetData() + Owner->Offset, Owner->Count);
+}
+
+/**
+ * @brief Clone the bone array if a snapshot still shares it (copy-on-write).
+ */
+void FGPUBoundaryBoneArena::MakeBonesWritable()
+{
+	if (!Bones.IsValid())
+	{
+		Bones = MakeShared<TArray<FGPUBoundaryBoneTransform>, ESPMode::ThreadSafe>();
+	}
+	else if (!Bones.IsUnique())
+	{
+		Bones = MakeShared<TArray<FGPUBoundaryBoneTransform>, ESPMode::ThreadSafe>(*Bones);
+	}
+}
+
+/**
+ * @brief Move every owner to a contiguous range in ID order; the next upload covers the whole arena.
+ */
+void FGPUBoundaryBoneArena::Compact()
+{
+	TArray<int32> OwnerIDs;
+	Owners.GetKeys(OwnerIDs);
+	OwnerIDs.Sort();
+
+	TSharedPtr<TArray<FGPUBoundaryBoneTransform>, ESPMode::ThreadSafe> CompactBones = MakeShared<TArray<FGPUBoundaryBoneTransform>, ESPMode::ThreadSafe>();
+	CompactBones->Reserve(NumBones() - FreeBoneCount);
+
+	for (const int32 OwnerID : OwnerIDs)
+	{
+		FGPUBoundaryBoneOwner& Owner = Owners[OwnerID];
+		const int32 NewOffset = CompactBones->Num();
+		CompactBones->Append(Bones->GetData() + Owner.Offset, Owner.Count);
+		Owner.Offset = NewOffset;
+	}
+
+	Bones = MoveTemp(CompactBones);
+	DirtyRanges.Reset();
+	FreeBoneCount = 0;
+	++LayoutRevision;
+}
@@ -0,0 +1,397 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Resources/GPUFluidReadbackFormat.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Resources/GPUFluidReadbackSnapshot.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	constexpr int32 StreamAlignment = 16;
+
+	/** Particles per parallel unpack block (multiple of the 8-particle SIMD width and of the 16-bit pair size) */
+	constexpr int32 UnpackBlockSize = 8192;
+
+	/** Bytes of a 16-bit x3 stream: written per particle pair, so the count rounds up to even */
+	int32 GetPacked16x3Bytes(int32 Count)
+	{
+		return ((Count + 1) / 2) * 12;
+	}
+
+	int32 AppendStream(int32& InOutTotalBytes, int32 StreamBytes)
+	{
+		const int32 Offset = Align(InOutTotalBytes, StreamAlignment);
+		InOutTotalBytes = Offset + StreamBytes;
+		return Offset;
+	}
+
+	/**
+	 * @brief Quantize one coordinate exactly like PackReadbackFieldsCS.
+	 * @param Value World coordinate.
+	 * @param Min Quantization box minimum on this axis.
+	 * @param InvExtent Reciprocal of the box extent on this axis.
+	 * @return unorm16 code (clamped to the box).
+	 */
+	uint16 QuantizeUnorm16(float Value, float Min, float InvExtent)
+	{
+		const float Normalized = FMath::Clamp((Value - Min) * InvExtent, 0.0f, 1.0f);
+		return static_cast<uint16>(Normalized * 65535.0f + 0.5f);
+	}
+}
+
+//=============================================================================
+// FGPUReadbackLayout
+//=============================================================================
+
+/**
+ * @brief Lay out one stream per requested field, 16-byte aligned.
+ * @param FieldMask EGPUReadbackField bits (Accept* bits select 16-bit encodings).
+ * @param ParticleCount Number of particles.
+ * @param BoundsMin Quantization box minimum.
+ * @param BoundsMax Quantization box maximum.
+ * @return Layout with stream offsets and total size.
+ */
+FGPUReadbackLayout FGPUReadbackLayout::Build(uint32 FieldMask, int32 ParticleCount, const FVector3f& BoundsMin, const FVector3f& BoundsMax)
+{
+	FGPUReadbackLayout Layout;
+	Layout.Fields = FieldMask & EGPUReadbackField::AllFields;
+	Layout.bQuantizedPositions = Layout.HasField(EGPUReadbackField::Position) && (FieldMask & EGPUReadbackField::AcceptQuantizedPosition) != 0;
+	Layout.bHalfVelocities = Layout.HasField(EGPUReadbackField::Velocity) && (FieldMask & EGPUReadbackField::AcceptHalfVelocity) != 0;
+	Layout.QuantizeMin = BoundsMin;
+	Layout.QuantizeExtent = (BoundsMax - BoundsMin).ComponentMax(FVector3f(1.0f));
+	Layout.Capacity = FMath::Max(ParticleCount, 0);
+
+	const int32 Count = Layout.Capacity;
+	int32 Total = 0;
+	if (Layout.HasField(EGPUReadbackField::Position))
+	{
+		Layout.PositionOffset = AppendStream(Total, Layout.bQuantizedPositions ? GetPacked16x3Bytes(Count) : Count * static_cast<int32>(sizeof(FVector3f)));
+	}
+	if (Layout.HasField(EGPUReadbackField::Velocity))
+	{
+		Layout.VelocityOffset = AppendStream(Total, Layout.bHalfVelocities ? GetPacked16x3Bytes(Count) : Count * static_cast<int32>(sizeof(FVector3f)));
+	}
+	if (Layout.HasField(EGPUReadbackField::Speed))
+	{
+		Layout.SpeedOffset = AppendStream(Total, Count * static_cast<int32>(sizeof(float)));
+	}
+	if (Layout.HasField(EGPUReadbackField::ParticleID))
+	{
+		Layout.ParticleIDOffset = AppendStream(Total, Count * static_cast<int32>(sizeof(int32)));
+	}
+	if (Layout.HasField(EGPUReadbackField::SourceID))
+	{
+		Layout.SourceIDOffset = AppendStream(Total, Count * static_cast<int32>(sizeof(int32)));
+	}
+	if (Layout.HasField(EGPUReadbackField::Flags))
+	{
+		Layout.FlagsOffset = AppendStream(Total, Count * static_cast<int32>(sizeof(uint32)));
+	}
+	if (Layout.HasField(EGPUReadbackField::NeighborCount))
+	{
+		Layout.NeighborCountOffset = AppendStream(Total, Count * static_cast<int32>(sizeof(uint32)));
+	}
+	Layout.TotalBytes = Align(Total, StreamAlignment);
+	return Layout;
+}
+
+uint32 FGPUReadbackLayout::CombineConsumerMasks(TConstArrayView<uint32> ConsumerMasks)
+{
+	uint32 Fields = EGPUReadbackField::None;
+	bool bAllAcceptQuantizedPosition = true;
+	bool bAllAcceptHalfVelocity = true;
+
+	for (const uint32 Mask : ConsumerMasks)
+	{
+		Fields |= Mask & EGPUReadbackField::AllFields;
+		if ((Mask & EGPUReadbackField::Position) && !(Mask & EGPUReadbackField::AcceptQuantizedPosition))
+		{
+			bAllAcceptQuantizedPosition = false;
+		}
+		if ((Mask & EGPUReadbackField::Velocity) && !(Mask & EGPUReadbackField::AcceptHalfVelocity))
+		{
+			bAllAcceptHalfVelocity = false;
+		}
+	}
+
+	if ((Fields & EGPUReadbackField::Position) && bAllAcceptQuantizedPosition)
+	{
+		Fields |= EGPUReadbackField::AcceptQuantizedPosition;
+	}
+	if ((Fields & EGPUReadbackField::Velocity) && bAllAcceptHalfVelocity)
+	{
+		Fields |= EGPUReadbackField::AcceptHalfVelocity;
+	}
+	return Fields;
+}
+
+//=============================================================================
+// SIMD Unpackers
+//=============================================================================
+
+/**
+ * @brief Dequantize unorm16x3 positions.
+ *
+ * 8 particles = 24 codes = 6 groups of 4. The AoS component pattern repeats every 3 groups
+ * (xyzx, yzxy, zxyz), so each group is one normalized load and one multiply-add with a rotated
+ * extent/min register, stored straight into the float3 array.
+ *
+ * @param Src Packed codes (3 per particle).
+ * @param Count Number of particles.
+ * @param Min Quantization box minimum.
+ * @param Extent Quantization box extent.
+ * @param Dst Output positions.
+ */
+void GPUFluidReadbackUnpack::UnpackUnorm16x3(const uint16* Src, int32 Count, const FVector3f& Min, const FVector3f& Extent, FVector3f* Dst)
+{
+	const VectorRegister4Float ScaleRot[3] = {
+		MakeVectorRegisterFloat(Extent.X, Extent.Y, Extent.Z, Extent.X),
+		MakeVectorRegisterFloat(Extent.Y, Extent.Z, Extent.X, Extent.Y),
+		MakeVectorRegisterFloat(Extent.Z, Extent.X, Extent.Y, Extent.Z) };
+	const VectorRegister4Float MinRot[3] = {
+		MakeVectorRegisterFloat(Min.X, Min.Y, Min.Z, Min.X),
+		MakeVectorRegisterFloat(Min.Y, Min.Z, Min.X, Min.Y),
+		MakeVectorRegisterFloat(Min.Z, Min.X, Min.Y, Min.Z) };
+
+	float* DstFloats = reinterpret_cast<float*>(Dst);
+	const int32 SimdCount = Count & ~7;
+	for (int32 i = 0; i < SimdCount; i += 8)
+	{
+		const uint16* Block = Src + i * 3;
+		float* Out = DstFloats + i * 3;
+		for (int32 Group = 0; Group < 6; ++Group)
+		{
+			const VectorRegister4Float Normalized = VectorLoadURGBA16N(const_cast<uint16*>(Block + Group * 4));
+			VectorStore(VectorMultiplyAdd(Normalized, ScaleRot[Group % 3], MinRot[Group % 3]), Out + Group * 4);
+		}
+	}
+
+	constexpr float InvMaxCode = 1.0f / 65535.0f;
+	for (int32 i = SimdCount; i < Count; ++i)
+	{
+		const uint16* Code = Src + i * 3;
+		Dst[i] = FVector3f(
+			Min.X + Code[0] * InvMaxCode * Extent.X,
+			Min.Y + Code[1] * InvMaxCode * Extent.Y,
+			Min.Z + Code[2] * InvMaxCode * Extent.Z);
+	}
+}
+
+/**
+ * @brief Convert half3 velocities; AoS half3 maps 1:1 onto AoS float3, 8 halfs per wide load.
+ * @param Src Packed halfs (3 per particle).
+ * @param Count Number of particles.
+ * @param Dst Output velocities.
+ */
+void GPUFluidReadbackUnpack::UnpackHalf3(const uint16* Src, int32 Count, FVector3f* Dst)
+{
+	float* DstFloats = reinterpret_cast<float*>(Dst);
+	const int32 NumHalfs = Count * 3;
+	const int32 WideCount = NumHalfs & ~7;
+	for (int32 i = 0; i < WideCount; i += 8)
+	{
+		FPlatformMath::WideLoadHalf(DstFloats + i, Src + i);
+	}
+	for (int32 i = WideCount; i < NumHalfs; ++i)
+	{
+		FPlatformMath::LoadHalf(DstFloats + i, Src + i);
+	}
+}
+
+float GPUFluidReadbackUnpack::MaxFloat(const float* Src, int32 Count)
+{
+	VectorRegister4Float MaxVec = VectorZeroFloat();
+	const int32 SimdCount = Count & ~3;
+	for (int32 i = 0; i < SimdCount; i += 4)
+	{
+		MaxVec = VectorMax(MaxVec, VectorLoad(Src + i));
+	}
+
+	alignas(16) float Lanes[4];
+	VectorStoreAligned(MaxVec, Lanes);
+	float Result = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+	for (int32 i = SimdCount; i < Count; ++i)
+	{
+		Result = FMath::Max(Result, Src[i]);
+	}
+	return Result;
+}
+
+float GPUFluidReadbackUnpack::MaxLength(const FVector3f* Src, int32 Count)
+{
+	float MaxSq = 0.0f;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		MaxSq = FMath::Max(MaxSq, Src[i].SizeSquared());
+	}
+	return FMath::Sqrt(MaxSq);
+}
+
+/**
+ * @brief Unpack all streams of a packed readback into the snapshot, block-parallel.
+ * @param Layout Layout the buffer was packed with.
+ * @param Data Mapped readback memory (Layout.TotalBytes).
+ * @param Count Valid particle count (<= Layout.Capacity).
+ * @param OutSnapshot Snapshot whose per-particle arrays are resized and filled.
+ * @return Max particle speed, or -1 if neither speed nor velocity was packed.
+ */
+float GPUFluidReadbackUnpack::UnpackReadbackFields(const FGPUReadbackLayout& Layout, const void* Data, int32 Count, FGPUFluidReadbackSnapshot& OutSnapshot)
+{
+	Count = FMath::Clamp(Count, 0, Layout.Capacity);
+	const uint8* Bytes = static_cast<const uint8*>(Data);
+
+	const bool bPositions = Layout.HasField(EGPUReadbackField::Position);
+	const bool bVelocities = Layout.HasField(EGPUReadbackField::Velocity);
+	const bool bSpeeds = Layout.HasField(EGPUReadbackField::Speed);
+	if (bPositions) { OutSnapshot.Positions.SetNumUninitialized(Count); }
+	if (bVelocities) { OutSnapshot.Velocities.SetNumUninitialized(Count); }
+	if (Layout.HasField(EGPUReadbackField::ParticleID)) { OutSnapshot.ParticleIDs.SetNumUninitialized(Count); }
+	if (Layout.HasField(EGPUReadbackField::SourceID)) { OutSnapshot.SourceIDs.SetNumUninitialized(Count); }
+	if (Layout.HasField(EGPUReadbackField::Flags)) { OutSnapshot.Flags.SetNumUninitialized(Count); }
+	if (Layout.HasField(EGPUReadbackField::NeighborCount)) { OutSnapshot.NeighborCounts.SetNumUninitialized(Count); }
+
+	const int32 NumBlocks = FMath::DivideAndRoundUp(Count, UnpackBlockSize);
+	TArray<float> BlockMaxSpeeds;
+	BlockMaxSpeeds.SetNumZeroed(NumBlocks);
+
+	// 32-bit streams are plain copies; the block offsets keep 16-bit pairs intact (UnpackBlockSize is even)
+	auto CopyStream = [Bytes](int32 Offset, int32 Start, int32 Num, auto* Dst)
+	{
+		if (Offset != INDEX_NONE)
+		{
+			FMemory::Memcpy(Dst + Start, Bytes + Offset + Start * sizeof(*Dst), Num * sizeof(*Dst));
+		}
+	};
+
+	ParallelFor(NumBlocks, [&](int32 BlockIndex)
+	{
+		const int32 Start = BlockIndex * UnpackBlockSize;
+		const int32 Num = FMath::Min(UnpackBlockSize, Count - Start);
+
+		if (bPositions)
+		{
+			if (Layout.bQuantizedPositions)
+			{
+				const uint16* Src = reinterpret_cast<const uint16*>(Bytes + Layout.PositionOffset) + Start * 3;
+				UnpackUnorm16x3(Src, Num, Layout.QuantizeMin, Layout.QuantizeExtent, OutSnapshot.Positions.GetData() + Start);
+			}
+			else
+			{
+				CopyStream(Layout.PositionOffset, Start, Num, OutSnapshot.Positions.GetData());
+			}
+		}
+
+		if (bVelocities)
+		{
+			if (Layout.bHalfVelocities)
+			{
+				const uint16* Src = reinterpret_cast<const uint16*>(Bytes + Layout.VelocityOffset) + Start * 3;
+				UnpackHalf3(Src, Num, OutSnapshot.Velocities.GetData() + Start);
+			}
+			else
+			{
+				CopyStream(Layout.VelocityOffset, Start, Num, OutSnapshot.Velocities.GetData());
+			}
+		}
+
+		CopyStream(Layout.ParticleIDOffset, Start, Num, OutSnapshot.ParticleIDs.GetData());
+		CopyStream(Layout.SourceIDOffset, Start, Num, OutSnapshot.SourceIDs.GetData());
+		CopyStream(Layout.FlagsOffset, Start, Num, OutSnapshot.Flags.GetData());
+		CopyStream(Layout.NeighborCountOffset, Start, Num, OutSnapshot.NeighborCounts.GetData());
+
+		if (bSpeeds)
+		{
+			BlockMaxSpeeds[BlockIndex] = MaxFloat(reinterpret_cast<const float*>(Bytes + Layout.SpeedOffset) + Start, Num);
+		}
+		else if (bVelocities)
+		{
+			BlockMaxSpeeds[BlockIndex] = MaxLength(OutSnapshot.Velocities.GetData() + Start, Num);
+		}
+	});
+
+	if (!bSpeeds && !bVelocities)
+	{
+		return -1.0f;
+	}
+
+	float MaxSpeed = 0.0f;
+	for (const float BlockMax : BlockMaxSpeeds)
+	{
+		MaxSpeed = FMath::Max(MaxSpeed, BlockMax);
+	}
+	return MaxSpeed;
+}
+
+//=============================================================================
+// Reference Packer
+//=============================================================================
+
+/**
+ * @brief Scalar CPU equivalent of PackReadbackFieldsCS.
+ * @param Layout Target layout.
+ * @param Particles Source particles (at most Layout.Capacity are packed).
+ * @param OutData Packed bytes (Layout.TotalBytes, zero-filled padding).
+ */
+void GPUFluidReadbackUnpack::PackReadbackFields(const FGPUReadbackLayout& Layout, TConstArrayView<FGPUFluidParticle> Particles, TArray<uint8>& OutData)
+{
+	OutData.SetNumZeroed(Layout.TotalBytes);
+	uint8* Bytes = OutData.GetData();
+	const int32 Count = FMath::Min(Particles.Num(), Layout.Capacity);
+	const FVector3f InvExtent(1.0f / Layout.QuantizeExtent.X, 1.0f / Layout.QuantizeExtent.Y, 1.0f / Layout.QuantizeExtent.Z);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FGPUFluidParticle& P = Particles[i];
+
+		if (Layout.PositionOffset != INDEX_NONE)
+		{
+			if (Layout.bQuantizedPositions)
+			{
+				uint16* Dst = reinterpret_cast<uint16*>(Bytes + Layout.PositionOffset) + i * 3;
+				Dst[0] = QuantizeUnorm16(P.Position.X, Layout.QuantizeMin.X, InvExtent.X);
+				Dst[1] = QuantizeUnorm16(P.Position.Y, Layout.QuantizeMin.Y, InvExtent.Y);
+				Dst[2] = QuantizeUnorm16(P.Position.Z, Layout.QuantizeMin.Z, InvExtent.Z);
+			}
+			else
+			{
+				reinterpret_cast<FVector3f*>(Bytes + Layout.PositionOffset)[i] = P.Position;
+			}
+		}
+
+		if (Layout.VelocityOffset != INDEX_NONE)
+		{
+			if (Layout.bHalfVelocities)
+			{
+				uint16* Dst = reinterpret_cast<uint16*>(Bytes + Layout.VelocityOffset) + i * 3;
+				FPlatformMath::StoreHalf(Dst + 0, P.Velocity.X);
+				FPlatformMath::StoreHalf(Dst + 1, P.Velocity.Y);
+				FPlatformMath::StoreHalf(Dst + 2, P.Velocity.Z);
+			}
+			else
+			{
+				reinterpret_cast<FVector3f*>(Bytes + Layout.VelocityOffset)[i] = P.Velocity;
+			}
+		}
+
+		if (Layout.SpeedOffset != INDEX_NONE)
+		{
+			reinterpret_cast<float*>(Bytes + Layout.SpeedOffset)[i] = P.Velocity.Length();
+		}
+		if (Layout.ParticleIDOffset != INDEX_NONE)
+		{
+			reinterpret_cast<int32*>(Bytes + Layout.ParticleIDOffset)[i] = P.ParticleID;
+		}
+		if (Layout.SourceIDOffset != INDEX_NONE)
+		{
+			reinterpret_cast<int32*>(Bytes + Layout.SourceIDOffset)[i] = P.SourceID;
+		}
+		if (Layout.FlagsOffset != INDEX_NONE)
+		{
+			reinterpret_cast<uint32*>(Bytes + Layout.FlagsOffset)[i] = P.Flags;
+		}
+		if (Layout.NeighborCountOffset != INDEX_NONE)
+		{
+			reinterpret_cast<uint32*>(Bytes + Layout.NeighborCountOffset)[i] = P.NeighborCount;
+		}
+	}
+}
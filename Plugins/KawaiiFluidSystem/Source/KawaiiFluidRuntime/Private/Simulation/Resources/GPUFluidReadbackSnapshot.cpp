@@ -0,0 +1,225 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Resources/GPUFluidReadbackSnapshot.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Minimum particles per counting sort chunk (smaller inputs sort on one thread) */
+	constexpr int32 SourceIndexMinChunkSize = 4096;
+}
+
+//=============================================================================
+// FGPUFluidSourceIndex
+//=============================================================================
+
+/**
+ * @brief Stable parallel counting sort by source ID.
+ *
+ * Pass 1 builds a histogram per chunk, the prefix sum turns it into a write cursor per
+ * (chunk, source), and pass 2 scatters each chunk into its own disjoint slots, so the
+ * order within a source is the particle order and no atomics are needed.
+ *
+ * @param SourceIDs Source ID per particle.
+ * @param ParticleIDs Particle ID per particle, or empty.
+ */
+void FGPUFluidSourceIndex::Build(TConstArrayView<int32> SourceIDs, TConstArrayView<int32> ParticleIDs)
+{
+	const int32 Count = SourceIDs.Num();
+	const bool bWithParticleIDs = ParticleIDs.Num() == Count && Count > 0;
+	const int32 NumChunks = FMath::Clamp(
+		FMath::Min(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), FMath::DivideAndRoundUp(Count, SourceIndexMinChunkSize)), 1, 256);
+	const int32 ChunkSize = FMath::DivideAndRoundUp(FMath::Max(Count, 1), NumChunks);
+
+	ChunkCounts.SetNumUninitialized(NumChunks * NumSources, EAllowShrinking::No);
+	FMemory::Memzero(ChunkCounts.GetData(), ChunkCounts.Num() * sizeof(int32));
+
+	// Pass 1: per-chunk histograms
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		int32* Counts = ChunkCounts.GetData() + ChunkIndex * NumSources;
+		const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, Count);
+		for (int32 i = ChunkIndex * ChunkSize; i < End; ++i)
+		{
+			const uint32 SourceID = static_cast<uint32>(SourceIDs[i]);
+			if (SourceID < static_cast<uint32>(NumSources))
+			{
+				++Counts[SourceID];
+			}
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Prefix sum, source-major so each source's range is contiguous across chunks
+	Offsets.SetNumUninitialized(NumSources + 1, EAllowShrinking::No);
+	int32 Running = 0;
+	for (int32 SourceID = 0; SourceID < NumSources; ++SourceID)
+	{
+		Offsets[SourceID] = Running;
+		for (int32 c = 0; c < NumChunks; ++c)
+		{
+			int32& Cursor = ChunkCounts[c * NumSources + SourceID];
+			const int32 ChunkCount = Cursor;
+			Cursor = Running;
+			Running += ChunkCount;
+		}
+	}
+	Offsets[NumSources] = Running;
+
+	SortedIndices.SetNumUninitialized(Running, EAllowShrinking::No);
+	SortedParticleIDs.SetNumUninitialized(bWithParticleIDs ? Running : 0, EAllowShrinking::No);
+
+	// Pass 2: stable scatter into disjoint per-chunk ranges
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		int32* Cursors = ChunkCounts.GetData() + ChunkIndex * NumSources;
+		const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, Count);
+		for (int32 i = ChunkIndex * ChunkSize; i < End; ++i)
+		{
+			const uint32 SourceID = static_cast<uint32>(SourceIDs[i]);
+			if (SourceID < static_cast<uint32>(NumSources))
+			{
+				const int32 Slot = Cursors[SourceID]++;
+				SortedIndices[Slot] = i;
+				if (bWithParticleIDs)
+				{
+					SortedParticleIDs[Slot] = ParticleIDs[i];
+				}
+			}
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void FGPUFluidSourceIndex::Reset()
+{
+	Offsets.Reset();
+	SortedIndices.Reset();
+	SortedParticleIDs.Reset();
+}
+
+//=============================================================================
+// FGPUFluidReadbackSnapshot
+//=============================================================================
+
+void FGPUFluidReadbackSnapshot::Reset()
+{
+	Positions.Reset();
+	Velocities.Reset();
+	SourceIDs.Reset();
+	ParticleIDs.Reset();
+	Flags.Reset();
+	NeighborCounts.Reset();
+	SourceIndex.Reset();
+	FrameNumber = 0;
+}
+
+//=============================================================================
+// FGPUFluidReadbackSnapshotView
+//=============================================================================
+
+FGPUFluidReadbackSnapshotView::FGPUFluidReadbackSnapshotView(FGPUFluidReadbackSnapshotView&& Other)
+	: Snapshot(Other.Snapshot), RefCount(Other.RefCount)
+{
+	Other.Snapshot = nullptr;
+	Other.RefCount = nullptr;
+}
+
+FGPUFluidReadbackSnapshotView& FGPUFluidReadbackSnapshotView::operator=(FGPUFluidReadbackSnapshotView&& Other)
+{
+	if (this != &Other)
+	{
+		Release();
+		Snapshot = Other.Snapshot;
+		RefCount = Other.RefCount;
+		Other.Snapshot = nullptr;
+		Other.RefCount = nullptr;
+	}
+	return *this;
+}
+
+void FGPUFluidReadbackSnapshotView::Release()
+{
+	if (RefCount)
+	{
+		RefCount->fetch_sub(1);
+	}
+	Snapshot = nullptr;
+	RefCount = nullptr;
+}
+
+//=============================================================================
+// FGPUFluidReadbackSnapshotBuffer
+//=============================================================================
+
+/**
+ * @brief Pin the published slot without locking.
+ *
+ * The ref count is bumped before re-reading PublishedIndex: if the slot is still published
+ * afterwards, the writer (which checks ref counts only on unpublished slots) can no longer claim it.
+ *
+ * @return View of the latest snapshot, or an empty view if nothing is published.
+ */
+FGPUFluidReadbackSnapshotView FGPUFluidReadbackSnapshotBuffer::Acquire() const
+{
+	for (;;)
+	{
+		const int32 Index = PublishedIndex.load();
+		if (Index == INDEX_NONE)
+		{
+			return FGPUFluidReadbackSnapshotView();
+		}
+
+		RefCounts[Index].fetch_add(1);
+		if (PublishedIndex.load() == Index)
+		{
+			return FGPUFluidReadbackSnapshotView(&Slots[Index], &RefCounts[Index]);
+		}
+
+		// Publisher swapped slots in between; the slot may be mid-write, retry on the new one
+		RefCounts[Index].fetch_sub(1);
+	}
+}
+
+/**
+ * @brief Claim a slot that is neither published nor pinned by any view.
+ * @return Reset snapshot to fill, or nullptr if no slot is free (WriteLock released).
+ */
+FGPUFluidReadbackSnapshot* FGPUFluidReadbackSnapshotBuffer::BeginWrite()
+{
+	WriteLock.Lock();
+	check(WritingIndex == INDEX_NONE);
+
+	const int32 Published = PublishedIndex.load();
+	for (int32 i = 0; i < NumSlots; ++i)
+	{
+		if (i != Published && RefCounts[i].load() == 0)
+		{
+			WritingIndex = i;
+			Slots[i].Reset();
+			return &Slots[i];
+		}
+	}
+
+	WriteLock.Unlock();
+	return nullptr;
+}
+
+void FGPUFluidReadbackSnapshotBuffer::Publish()
+{
+	check(WritingIndex != INDEX_NONE);
+	PublishedIndex.store(WritingIndex);
+	WritingIndex = INDEX_NONE;
+	WriteLock.Unlock();
+}
+
+void FGPUFluidReadbackSnapshotBuffer::CancelWrite()
+{
+	check(WritingIndex != INDEX_NONE);
+	WritingIndex = INDEX_NONE;
+	WriteLock.Unlock();
+}
+
+void FGPUFluidReadbackSnapshotBuffer::Clear()
+{
+	FScopeLock Lock(&WriteLock);
+	PublishedIndex.store(INDEX_NONE);
+}
@@ -55,3 +55,26 @@ void FCompactStatsExCS::ModifyCompilationEnvironment(
 	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
 	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
 }
+
+IMPLEMENT_GLOBAL_SHADER(FPackReadbackFieldsCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidStatsCompact.usf",
+	"PackReadbackFieldsCS", SF_Compute);
+
+/**
+ * @brief Check if field-selective readback packer permutation should be compiled.
+ */
+bool FPackReadbackFieldsCS::ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+{
+	return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+}
+
+/**
+ * @brief Modify field-selective readback packer compilation environment.
+ */
+void FPackReadbackFieldsCS::ModifyCompilationEnvironment(
+	const FGlobalShaderPermutationParameters& Parameters,
+	FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+}
@@ -1,4 +1,4 @@
-// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+﻿// Copyright 2026 Team_Bruteforce. All Rights Reserved.
 
 #include "Simulation/Shaders/GPUFluidSimulatorShaders.h"
 #include "RenderGraphBuilder.h"
@@ -413,6 +413,33 @@ void FExtractRenderDataSoACS::ModifyCompilationEnvironment(
 	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
 }
 
+IMPLEMENT_GLOBAL_SHADER(FExtractRenderDataPackedCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidExtractRenderData.usf",
+	"ExtractRenderDataPackedCS", SF_Compute);
+
+/**
+ * @brief Check if extract render data packed shader permutation should be compiled.
+ * @param Parameters Shader permutation parameters.
+ * @return True if permutation is supported.
+ */
+bool FExtractRenderDataPackedCS::ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+{
+	return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+}
+
+/**
+ * @brief Modify extract render data packed shader compilation environment.
+ * @param Parameters Shader permutation parameters.
+ * @param OutEnvironment Shader compiler environment to modify.
+ */
+void FExtractRenderDataPackedCS::ModifyCompilationEnvironment(
+	const FGlobalShaderPermutationParameters& Parameters,
+	FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+}
+
 IMPLEMENT_GLOBAL_SHADER(FCopyParticlesCS,
 	"/Plugin/KawaiiFluidSystem/Private/FluidCopyParticles.usf",
 	"CopyParticlesCS", SF_Compute);
@@ -467,6 +494,87 @@ void FSpawnParticlesCS::ModifyCompilationEnvironment(
 	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
 }
 
+IMPLEMENT_GLOBAL_SHADER(FSpawnFromDescriptorCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidSpawnDescriptor.usf",
+	"SpawnFromDescriptorCS", SF_Compute);
+
+/**
+ * @brief Check if spawn-from-descriptor shader permutation should be compiled.
+ * @param Parameters Shader permutation parameters.
+ * @return True if permutation is supported.
+ */
+bool FSpawnFromDescriptorCS::ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+{
+	return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+}
+
+/**
+ * @brief Modify spawn-from-descriptor shader compilation environment.
+ * @param Parameters Shader permutation parameters.
+ * @param OutEnvironment Shader compiler environment to modify.
+ */
+void FSpawnFromDescriptorCS::ModifyCompilationEnvironment(
+	const FGlobalShaderPermutationParameters& Parameters,
+	FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+}
+
+IMPLEMENT_GLOBAL_SHADER(FMarkSpawnOccupancyCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidSpawnDescriptor.usf",
+	"MarkSpawnOccupancyCS", SF_Compute);
+
+/**
+ * @brief Check if mark-spawn-occupancy shader permutation should be compiled.
+ * @param Parameters Shader permutation parameters.
+ * @return True if permutation is supported.
+ */
+bool FMarkSpawnOccupancyCS::ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+{
+	return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+}
+
+/**
+ * @brief Modify mark-spawn-occupancy shader compilation environment.
+ * @param Parameters Shader permutation parameters.
+ * @param OutEnvironment Shader compiler environment to modify.
+ */
+void FMarkSpawnOccupancyCS::ModifyCompilationEnvironment(
+	const FGlobalShaderPermutationParameters& Parameters,
+	FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+}
+
+IMPLEMENT_GLOBAL_SHADER(FAppendParticlesCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidAppendParticles.usf",
+	"AppendParticlesCS", SF_Compute);
+
+/**
+ * @brief Check if append particles shader permutation should be compiled.
+ * @param Parameters Shader permutation parameters.
+ * @return True if permutation is supported.
+ */
+bool FAppendParticlesCS::ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+{
+	return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+}
+
+/**
+ * @brief Modify append particles shader compilation environment.
+ * @param Parameters Shader permutation parameters.
+ * @param OutEnvironment Shader compiler environment to modify.
+ */
+void FAppendParticlesCS::ModifyCompilationEnvironment(
+	const FGlobalShaderPermutationParameters& Parameters,
+	FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+}
+
 IMPLEMENT_GLOBAL_SHADER(FInitAliveMaskCS,
 	"/Plugin/KawaiiFluidSystem/Private/FluidInitAliveMask.usf",
 	"InitAliveMaskCS", SF_Compute);
@@ -1406,6 +1514,19 @@ void FGPUFluidSimulatorPassBuilder::AddPrimitiveCollisionPass(
 }
 #endif // DEPRECATED
 
+/**
+ * @brief Create a 1-element cleared position buffer for passes running without render interpolation.
+ * @param GraphBuilder RDG builder.
+ * @return SRV of the dummy buffer (shader requires a bound resource).
+ */
+static FRDGBufferSRVRef CreateDummyPreviousPositionsSRV(FRDGBuilder& GraphBuilder)
+{
+	FRDGBufferRef DummyBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), 1), TEXT("GPUFluid.DummyPreviousPositions"));
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(DummyBuffer), 0u);
+	return GraphBuilder.CreateSRV(DummyBuffer);
+}
+
 /**
  * @brief Add RDG pass to extract particle data for rendering.
  * @param GraphBuilder RDG builder.
@@ -1463,6 +1584,9 @@ void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataPass(
  * @param ParticleCountBufferSRV Read-only access to GPU particle count.
  * @param ParticleRadius Radius for rendering.
  * @param BoundsMargin Extra margin to expand computed bounds.
+ * @param PreviousPositionsSRV Optional tick-start positions for render interpolation.
+ * @param PreviousPositionCount Particles covered by PreviousPositionsSRV (0 = no interpolation).
+ * @param InterpolationAlpha Blend from previous (0) to latest (1) simulation tick.
  */
 void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataWithBoundsPass(
 	FRDGBuilder& GraphBuilder,
@@ -1471,7 +1595,10 @@ void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataWithBoundsPass(
 	FRDGBufferUAVRef BoundsBufferUAV,
 	FRDGBufferSRVRef ParticleCountBufferSRV,
 	float ParticleRadius,
-	float BoundsMargin)
+	float BoundsMargin,
+	FRDGBufferSRVRef PreviousPositionsSRV,
+	int32 PreviousPositionCount,
+	float InterpolationAlpha)
 {
 	if (!PhysicsParticlesSRV || !RenderParticlesUAV || !BoundsBufferUAV || !ParticleCountBufferSRV)
 	{
@@ -1490,6 +1617,9 @@ void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataWithBoundsPass(
 	PassParameters->ParticleCountBuffer = ParticleCountBufferSRV;
 	PassParameters->ParticleRadius = ParticleRadius;
 	PassParameters->BoundsMargin = BoundsMargin;
+	PassParameters->PreviousPositions = PreviousPositionsSRV ? PreviousPositionsSRV : CreateDummyPreviousPositionsSRV(GraphBuilder);
+	PassParameters->PreviousPositionCount = PreviousPositionsSRV ? static_cast<uint32>(FMath::Max(PreviousPositionCount, 0)) : 0u;
+	PassParameters->InterpolationAlpha = FMath::Clamp(InterpolationAlpha, 0.0f, 1.0f);
 
 	// Single group of 256 threads with grid-stride loop (reads GPU count internally)
 	FComputeShaderUtils::AddPass(
@@ -1509,6 +1639,9 @@ void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataWithBoundsPass(
  * @param ParticleCountBufferSRV Read-only access to GPU particle count.
  * @param MaxParticleCount Maximum particle capacity.
  * @param ParticleRadius Radius for rendering.
+ * @param PreviousPositionsSRV Optional tick-start positions for render interpolation.
+ * @param PreviousPositionCount Particles covered by PreviousPositionsSRV (0 = no interpolation).
+ * @param InterpolationAlpha Blend from previous (0) to latest (1) simulation tick.
  */
 void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataSoAPass(
 	FRDGBuilder& GraphBuilder,
@@ -1517,7 +1650,10 @@ void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataSoAPass(
 	FRDGBufferUAVRef RenderVelocitiesUAV,
 	FRDGBufferSRVRef ParticleCountBufferSRV,
 	int32 MaxParticleCount,
-	float ParticleRadius)
+	float ParticleRadius,
+	FRDGBufferSRVRef PreviousPositionsSRV,
+	int32 PreviousPositionCount,
+	float InterpolationAlpha)
 {
 	if (MaxParticleCount <= 0 || !PhysicsParticlesSRV || !RenderPositionsUAV || !RenderVelocitiesUAV || !ParticleCountBufferSRV)
 	{
@@ -1535,6 +1671,9 @@ void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataSoAPass(
 	PassParameters->RenderVelocities = RenderVelocitiesUAV;
 	PassParameters->ParticleCountBuffer = ParticleCountBufferSRV;
 	PassParameters->ParticleRadius = ParticleRadius;
+	PassParameters->PreviousPositions = PreviousPositionsSRV ? PreviousPositionsSRV : CreateDummyPreviousPositionsSRV(GraphBuilder);
+	PassParameters->PreviousPositionCount = PreviousPositionsSRV ? static_cast<uint32>(FMath::Max(PreviousPositionCount, 0)) : 0u;
+	PassParameters->InterpolationAlpha = FMath::Clamp(InterpolationAlpha, 0.0f, 1.0f);
 
 	// Dispatch enough groups to cover max capacity; shader reads GPU count for bounds check
 	const int32 ThreadGroupSize = FExtractRenderDataSoACS::ThreadGroupSize;
@@ -1551,6 +1690,83 @@ void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataSoAPass(
 	}
 }
 
+/**
+ * @brief Add RDG pass to extract render data in the quantized render format.
+ * @param GraphBuilder RDG builder.
+ * @param PhysicsParticlesSRV Read-only access to physics particle buffer.
+ * @param PackedParticlesUAV Read-write access to output packed particle buffer.
+ * @param PackedAnisotropyUAV Read-write access to output packed anisotropy buffer (null without anisotropy).
+ * @param BoundsBufferSRV Particle AABB written by the bounds pass (quantization box).
+ * @param RenderOffsetSRV Surface particle render offset (optional).
+ * @param AnisotropyAxis1SRV Major axis buffer (null without anisotropy).
+ * @param AnisotropyAxis2SRV Intermediate axis buffer.
+ * @param AnisotropyAxis3SRV Minor axis buffer.
+ * @param ParticleCountBufferSRV Read-only access to GPU particle count.
+ * @param MaxParticleCount Maximum particle capacity.
+ * @param PreviousPositionsSRV Optional tick-start positions for render interpolation.
+ * @param PreviousPositionCount Particles covered by PreviousPositionsSRV (0 = no interpolation).
+ * @param InterpolationAlpha Blend from previous (0) to latest (1) simulation tick.
+ */
+void FGPUFluidSimulatorPassBuilder::AddExtractRenderDataPackedPass(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferSRVRef PhysicsParticlesSRV,
+	FRDGBufferUAVRef PackedParticlesUAV,
+	FRDGBufferUAVRef PackedAnisotropyUAV,
+	FRDGBufferSRVRef BoundsBufferSRV,
+	FRDGBufferSRVRef RenderOffsetSRV,
+	FRDGBufferSRVRef AnisotropyAxis1SRV,
+	FRDGBufferSRVRef AnisotropyAxis2SRV,
+	FRDGBufferSRVRef AnisotropyAxis3SRV,
+	FRDGBufferSRVRef ParticleCountBufferSRV,
+	int32 MaxParticleCount,
+	FRDGBufferSRVRef PreviousPositionsSRV,
+	int32 PreviousPositionCount,
+	float InterpolationAlpha)
+{
+	if (MaxParticleCount <= 0 || !PhysicsParticlesSRV || !PackedParticlesUAV || !BoundsBufferSRV || !ParticleCountBufferSRV)
+	{
+		return;
+	}
+
+	const bool bWriteAnisotropy = PackedAnisotropyUAV && AnisotropyAxis1SRV && AnisotropyAxis2SRV && AnisotropyAxis3SRV;
+
+	FExtractRenderDataPackedCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FExtractRenderDataPackedCS::FWriteAnisotropyDim>(bWriteAnisotropy);
+
+	FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	TShaderMapRef<FExtractRenderDataPackedCS> ComputeShader(GlobalShaderMap, PermutationVector);
+
+	FExtractRenderDataPackedCS::FParameters* PassParameters =
+		GraphBuilder.AllocParameters<FExtractRenderDataPackedCS::FParameters>();
+
+	PassParameters->PhysicsParticles = PhysicsParticlesSRV;
+	PassParameters->PackedParticles = PackedParticlesUAV;
+	PassParameters->PackedBounds = BoundsBufferSRV;
+	PassParameters->ParticleCountBuffer = ParticleCountBufferSRV;
+	PassParameters->PreviousPositions = PreviousPositionsSRV ? PreviousPositionsSRV : CreateDummyPreviousPositionsSRV(GraphBuilder);
+	PassParameters->PreviousPositionCount = PreviousPositionsSRV ? static_cast<uint32>(FMath::Max(PreviousPositionCount, 0)) : 0u;
+	PassParameters->InterpolationAlpha = FMath::Clamp(InterpolationAlpha, 0.0f, 1.0f);
+	if (bWriteAnisotropy)
+	{
+		PassParameters->PackedAnisotropy = PackedAnisotropyUAV;
+		// Without offsets a cleared 1-element buffer stands in (out-of-range structured reads return zero, as in the depth pass)
+		PassParameters->RenderOffset = RenderOffsetSRV ? RenderOffsetSRV : CreateDummyPreviousPositionsSRV(GraphBuilder);
+		PassParameters->AnisotropyAxis1 = AnisotropyAxis1SRV;
+		PassParameters->AnisotropyAxis2 = AnisotropyAxis2SRV;
+		PassParameters->AnisotropyAxis3 = AnisotropyAxis3SRV;
+	}
+
+	// Dispatch enough groups to cover max capacity; shader reads GPU count for bounds check
+	const int32 NumGroups = FMath::DivideAndRoundUp(MaxParticleCount, FExtractRenderDataPackedCS::ThreadGroupSize);
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("GPUFluid::ExtractRenderDataPacked(max=%d%s)", MaxParticleCount, bWriteAnisotropy ? TEXT(", Anisotropy") : TEXT("")),
+		ComputeShader,
+		PassParameters,
+		FIntVector(NumGroups, 1, 1));
+}
+
 //=============================================================================
 // SoA Conversion Shaders
 //=============================================================================
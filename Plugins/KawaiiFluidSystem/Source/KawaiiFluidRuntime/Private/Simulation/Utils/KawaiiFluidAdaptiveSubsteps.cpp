@@ -0,0 +1,106 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidAdaptiveSubsteps.h"
+
+namespace
+{
+	/** @return Smallest substep count whose step fits in MaxStep, clamped to [1, MaxSubsteps]. */
+	int32 SubstepsForMaxStep(float FrameTime, float MaxStep, int32 MaxSubsteps)
+	{
+		if (MaxStep <= 0.0f)
+		{
+			return 1;
+		}
+		return FMath::Clamp(FMath::CeilToInt(FrameTime / MaxStep - KINDA_SMALL_NUMBER), 1, MaxSubsteps);
+	}
+}
+
+/**
+ * @brief Compute the CFL-limited time step: dt = CFL * r / (v_max + |g| * FrameTime).
+ * The gravity term covers velocity gained during the frame, so resting fluid is not given an unbounded step.
+ * @param Settings CFL number, length scale and gravity.
+ * @param MaxVelocity Maximum particle speed (cm/s) from the last readback.
+ * @param FrameTime Simulated time this frame (s).
+ * @return CFL time step in seconds, or 0 if no velocity bound applies.
+ */
+float FKawaiiFluidAdaptiveSubsteps::ComputeCFLTimeStep(const FKawaiiFluidAdaptiveSubstepSettings& Settings, float MaxVelocity, float FrameTime)
+{
+	const float EffectiveVelocity = FMath::Max(MaxVelocity, 0.0f) + FMath::Max(Settings.GravityMagnitude, 0.0f) * FMath::Max(FrameTime, 0.0f);
+	if (EffectiveVelocity <= KINDA_SMALL_NUMBER)
+	{
+		return 0.0f;
+	}
+	return FMath::Max(Settings.CFLNumber, 0.01f) * FMath::Max(Settings.ParticleRadius, 0.1f) / EffectiveVelocity;
+}
+
+/**
+ * @brief Select the substep count for this frame and update hysteresis state.
+ * Without a velocity sample (MaxVelocity < 0) the fixed FallbackSubstepDeltaTime scheme is used.
+ * @param State In/Out hysteresis state.
+ * @param Settings Selection settings.
+ * @param FrameTime Simulated time this frame (s), already clamped by the caller.
+ * @param MaxVelocity Maximum particle speed (cm/s), negative when unknown.
+ * @return Substep decision; SubstepCount is 0 when FrameTime is 0.
+ */
+FKawaiiFluidSubstepDecision FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(
+	FKawaiiFluidAdaptiveSubstepState& State,
+	const FKawaiiFluidAdaptiveSubstepSettings& Settings,
+	float FrameTime,
+	float MaxVelocity)
+{
+	FKawaiiFluidSubstepDecision Decision;
+	Decision.MaxVelocity = MaxVelocity;
+
+	if (FrameTime <= 0.0f)
+	{
+		return Decision;
+	}
+
+	const int32 MaxSubsteps = FMath::Max(Settings.MaxSubsteps, 1);
+
+	if (MaxVelocity < 0.0f)
+	{
+		State.CurrentSubsteps = SubstepsForMaxStep(FrameTime, Settings.FallbackSubstepDeltaTime, MaxSubsteps);
+		State.DownshiftCounter = 0;
+		Decision.SubstepCount = State.CurrentSubsteps;
+		Decision.SubstepDeltaTime = FrameTime / Decision.SubstepCount;
+		return Decision;
+	}
+
+	const float CFLTimeStep = ComputeCFLTimeStep(Settings, MaxVelocity, FrameTime);
+	const int32 Desired = SubstepsForMaxStep(FrameTime, CFLTimeStep, MaxSubsteps);
+	int32 Current = State.CurrentSubsteps > 0 ? FMath::Min(State.CurrentSubsteps, MaxSubsteps) : Desired;
+
+	if (Desired >= Current)
+	{
+		// Raising the count is never delayed
+		Current = Desired;
+		State.DownshiftCounter = 0;
+	}
+	else
+	{
+		// Only step down once the lower count has CFL headroom for several frames
+		const float HeadroomStep = CFLTimeStep * (1.0f - FMath::Clamp(Settings.HysteresisRatio, 0.0f, 0.9f));
+		const int32 HeadroomDesired = SubstepsForMaxStep(FrameTime, HeadroomStep, MaxSubsteps);
+		if (HeadroomDesired < Current)
+		{
+			if (++State.DownshiftCounter >= FMath::Max(Settings.DownshiftFrames, 1))
+			{
+				Current = HeadroomDesired;
+				State.DownshiftCounter = 0;
+			}
+		}
+		else
+		{
+			State.DownshiftCounter = 0;
+		}
+	}
+
+	State.CurrentSubsteps = Current;
+
+	Decision.SubstepCount = Current;
+	Decision.SubstepDeltaTime = FrameTime / Current;
+	Decision.CFLTimeStep = CFLTimeStep;
+	Decision.bAdaptive = true;
+	return Decision;
+}
@@ -0,0 +1,462 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Cached shape-local spawn lattices (LRU, byte-bounded)
+
+#include "Simulation/Utils/KawaiiFluidLatticeTemplateCache.h"
+#include "Math/UnrealMathSSE.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarFluidLatticeTemplateCacheKB(
+	TEXT("r.Fluid.LatticeTemplateCacheKB"),
+	8192,
+	TEXT("Memory budget (KB) of the shared spawn lattice template cache.\n")
+	TEXT("  0 = Disable caching, regenerate the lattice on every spawn\n")
+	TEXT("  >0 = Least recently used templates are evicted beyond this budget (default 8192)"),
+	ECVF_Default);
+
+//=============================================================================
+// Lattice Generation
+//=============================================================================
+
+namespace
+{
+	/**
+	 * @brief Helper: SoA point writer that pads the arrays to a multiple of 4.
+	 */
+	struct FLatticeTemplateWriter
+	{
+		FKawaiiFluidLatticeTemplate& Template;
+
+		void Reserve(int32 EstimatedCount)
+		{
+			Template.X.Reserve(EstimatedCount + 3);
+			Template.Y.Reserve(EstimatedCount + 3);
+			Template.Z.Reserve(EstimatedCount + 3);
+		}
+
+		void Add(float InX, float InY, float InZ)
+		{
+			Template.X.Add(InX);
+			Template.Y.Add(InY);
+			Template.Z.Add(InZ);
+		}
+
+		void Finish()
+		{
+			Template.NumPoints = Template.X.Num();
+			const int32 Padded = Align(Template.NumPoints, 4);
+			Template.X.SetNumZeroed(Padded);
+			Template.Y.SetNumZeroed(Padded);
+			Template.Z.SetNumZeroed(Padded);
+			Template.X.Shrink();
+			Template.Y.Shrink();
+			Template.Z.Shrink();
+		}
+	};
+
+	/**
+	 * @brief Helper: HCP layer offsets of the ABC stacking pattern.
+	 * @param LayerIndex Layer index relative to the first layer.
+	 * @param Spacing Compensated spacing.
+	 * @param RowSpacingY Row spacing.
+	 * @param OutOffsetX Layer offset along X.
+	 * @param OutOffsetY Layer offset along Y.
+	 */
+	void GetHCPLayerOffset(int32 LayerIndex, float Spacing, float RowSpacingY, float& OutOffsetX, float& OutOffsetY)
+	{
+		const int32 ZMod = LayerIndex % 3;
+		OutOffsetX = (ZMod == 1) ? Spacing * 0.5f : ((ZMod == 2) ? Spacing * 0.25f : 0.0f);
+		OutOffsetY = (ZMod == 1) ? RowSpacingY / 3.0f : ((ZMod == 2) ? RowSpacingY * 2.0f / 3.0f : 0.0f);
+	}
+
+	/**
+	 * @brief Helper: HCP box lattice (cell-centered from the -Extent corner).
+	 */
+	void BuildBoxLattice(const FVector3f& Extent, float Spacing, FLatticeTemplateWriter& Writer)
+	{
+		const float AdjustedSpacing = Spacing * KawaiiFluidSpawnLattice::HCPCompensation;
+		const float RowSpacingY = AdjustedSpacing * 0.866025f;  // sqrt(3)/2
+		const float LayerSpacingZ = AdjustedSpacing * 0.816497f;  // sqrt(2/3)
+
+		const int32 CountX = FMath::Max(1, FMath::CeilToInt(Extent.X * 2.0f / AdjustedSpacing));
+		const int32 CountY = FMath::Max(1, FMath::CeilToInt(Extent.Y * 2.0f / RowSpacingY));
+		const int32 CountZ = FMath::Max(1, FMath::CeilToInt(Extent.Z * 2.0f / LayerSpacingZ));
+		Writer.Reserve(CountX * CountY * CountZ);
+
+		const FVector3f LocalStart(-Extent.X + AdjustedSpacing * 0.5f, -Extent.Y + RowSpacingY * 0.5f, -Extent.Z + LayerSpacingZ * 0.5f);
+
+		for (int32 z = 0; z < CountZ; ++z)
+		{
+			float ZLayerOffsetX, ZLayerOffsetY;
+			GetHCPLayerOffset(z, AdjustedSpacing, RowSpacingY, ZLayerOffsetX, ZLayerOffsetY);
+
+			for (int32 y = 0; y < CountY; ++y)
+			{
+				const float RowOffsetX = (y % 2 == 1) ? AdjustedSpacing * 0.5f : 0.0f;
+
+				for (int32 x = 0; x < CountX; ++x)
+				{
+					const FVector3f LocalPos(
+						LocalStart.X + x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX,
+						LocalStart.Y + y * RowSpacingY + ZLayerOffsetY,
+						LocalStart.Z + z * LayerSpacingZ);
+
+					if (FMath::Abs(LocalPos.X) <= Extent.X &&
+					    FMath::Abs(LocalPos.Y) <= Extent.Y &&
+					    FMath::Abs(LocalPos.Z) <= Extent.Z)
+					{
+						Writer.Add(LocalPos.X, LocalPos.Y, LocalPos.Z);
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Helper: centered HCP lattice clipped to a sphere (bCylinder = false) or a Z-aligned cylinder.
+	 */
+	void BuildCenteredLattice(const FVector3f& Extent, float Spacing, bool bCylinder, FLatticeTemplateWriter& Writer)
+	{
+		const float AdjustedSpacing = Spacing * KawaiiFluidSpawnLattice::HCPCompensation;
+		const float RowSpacingY = AdjustedSpacing * 0.866025f;
+		const float LayerSpacingZ = AdjustedSpacing * 0.816497f;
+		const float Radius = Extent.X;
+		const float RadiusSq = Radius * Radius;
+		const float HalfHeight = Extent.Z;
+
+		const int32 GridSizeX = FMath::CeilToInt(Radius / AdjustedSpacing) + 1;
+		const int32 GridSizeY = FMath::CeilToInt(Radius / RowSpacingY) + 1;
+		const int32 GridSizeZ = bCylinder ? FMath::CeilToInt(HalfHeight / LayerSpacingZ) : FMath::CeilToInt(Radius / LayerSpacingZ) + 1;
+
+		const float Volume = bCylinder ? PI * RadiusSq * HalfHeight * 2.0f : (4.0f / 3.0f) * PI * RadiusSq * Radius;
+		Writer.Reserve(FMath::CeilToInt(Volume / (AdjustedSpacing * AdjustedSpacing * AdjustedSpacing)));
+
+		for (int32 z = -GridSizeZ; z <= GridSizeZ; ++z)
+		{
+			float ZLayerOffsetX, ZLayerOffsetY;
+			GetHCPLayerOffset(z + GridSizeZ, AdjustedSpacing, RowSpacingY, ZLayerOffsetX, ZLayerOffsetY);
+
+			for (int32 y = -GridSizeY; y <= GridSizeY; ++y)
+			{
+				const float RowOffsetX = (((y + GridSizeY) % 2) == 1) ? AdjustedSpacing * 0.5f : 0.0f;
+
+				for (int32 x = -GridSizeX; x <= GridSizeX; ++x)
+				{
+					const FVector3f LocalPos(
+						x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX,
+						y * RowSpacingY + ZLayerOffsetY,
+						z * LayerSpacingZ);
+
+					const bool bInside = bCylinder
+						? (LocalPos.X * LocalPos.X + LocalPos.Y * LocalPos.Y <= RadiusSq && FMath::Abs(LocalPos.Z) <= HalfHeight)
+						: LocalPos.SizeSquared() <= RadiusSq;
+
+					if (bInside)
+					{
+						Writer.Add(LocalPos.X, LocalPos.Y, LocalPos.Z);
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Helper: hexagonal disc layer candidates in the local XY plane.
+	 *
+	 * Odd rows are offset by half a spacing, so their outermost candidates can lie just outside the
+	 * radius; they are kept because jitter may move them back in. Callers clip with ClipRadiusXY.
+	 */
+	void BuildDiscLattice(float Radius, float Spacing, FLatticeTemplateWriter& Writer)
+	{
+		const float RowSpacing = Spacing * FMath::Sqrt(3.0f) * 0.5f;
+		const float RadiusSq = Radius * Radius;
+		const int32 HalfRows = FMath::CeilToInt(Radius / RowSpacing);
+
+		Writer.Reserve(FMath::CeilToInt(PI * RadiusSq / (Spacing * RowSpacing)) + 2 * HalfRows + 1);
+
+		for (int32 RowIdx = -HalfRows; RowIdx <= HalfRows; ++RowIdx)
+		{
+			const float LocalY = RowIdx * RowSpacing;
+			const float LocalYSq = LocalY * LocalY;
+			if (LocalYSq > RadiusSq)
+			{
+				continue;
+			}
+
+			const float MaxX = FMath::Sqrt(RadiusSq - LocalYSq);
+			const float XOffset = (FMath::Abs(RowIdx) % 2 != 0) ? Spacing * 0.5f : 0.0f;
+			const int32 NumCols = FMath::FloorToInt(MaxX / Spacing);
+
+			for (int32 ColIdx = -NumCols; ColIdx <= NumCols; ++ColIdx)
+			{
+				Writer.Add(ColIdx * Spacing + XOffset, LocalY, 0.0f);
+			}
+		}
+	}
+}
+
+//=============================================================================
+// FKawaiiFluidLatticeTemplate
+//=============================================================================
+
+/**
+ * @brief Generate the lattice of a key.
+ * @param InKey Shape, size and spacing.
+ * @return Immutable template (empty for a non-positive spacing or a degenerate shape).
+ */
+FKawaiiFluidLatticeTemplateRef FKawaiiFluidLatticeTemplate::Build(const FKawaiiFluidLatticeTemplateKey& InKey)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidLatticeTemplate_Build);
+
+	TSharedRef<FKawaiiFluidLatticeTemplate, ESPMode::ThreadSafe> Template = MakeShared<FKawaiiFluidLatticeTemplate, ESPMode::ThreadSafe>();
+	Template->Key = InKey;
+
+	FLatticeTemplateWriter Writer{*Template};
+	const FVector3f& Extent = InKey.Extent;
+
+	if (InKey.Spacing > 0.0f)
+	{
+		switch (InKey.Shape)
+		{
+		case EKawaiiFluidSpawnShape::Box:
+			BuildBoxLattice(Extent, InKey.Spacing, Writer);
+			break;
+		case EKawaiiFluidSpawnShape::Sphere:
+			if (Extent.X > 0.0f)
+			{
+				BuildCenteredLattice(Extent, InKey.Spacing, false, Writer);
+			}
+			break;
+		case EKawaiiFluidSpawnShape::Cylinder:
+			if (Extent.X > 0.0f && Extent.Z > 0.0f)
+			{
+				BuildCenteredLattice(Extent, InKey.Spacing, true, Writer);
+			}
+			break;
+		case EKawaiiFluidSpawnShape::Disc:
+			// Radius 0 is a single-file stream (one point at the center)
+			if (Extent.X >= 0.0f)
+			{
+				BuildDiscLattice(Extent.X, InKey.Spacing, Writer);
+			}
+			break;
+		default:
+			// Sampled shapes have no lattice
+			break;
+		}
+	}
+
+	Writer.Finish();
+	return Template;
+}
+
+/**
+ * @brief Transform the template to world space, four points per SIMD step, and append spawn requests.
+ * @param Origin World position of the local origin.
+ * @param AxisX World direction of local X, likewise AxisY/AxisZ.
+ * @param JitterRange Per-axis uniform jitter range in local space (0 = no jitter on that axis).
+ * @param Random Spawn stream; point i is jittered by Random.Jitter(i, JitterRange).
+ * @param ClipRadiusXY Drop points whose jittered local XY leaves this radius (negative = keep all).
+ * @param Prototype Request copied for every point (velocity, mass, radius, source).
+ * @param OutRequests Requests are appended here.
+ * @return Number of appended requests.
+ */
+int32 FKawaiiFluidLatticeTemplate::AppendSpawnRequests(const FVector3f& Origin, const FVector3f& AxisX, const FVector3f& AxisY, const FVector3f& AxisZ,
+                                                       const FVector3f& JitterRange, const FKawaiiFluidSpawnRandom& Random, float ClipRadiusXY,
+                                                       const FGPUSpawnRequest& Prototype, TArray<FGPUSpawnRequest>& OutRequests) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidLatticeTemplate_AppendSpawnRequests);
+
+	if (NumPoints == 0)
+	{
+		return 0;
+	}
+
+	const int32 StartNum = OutRequests.Num();
+	OutRequests.Reserve(StartNum + NumPoints);
+
+	const VectorRegister4Float VecOriginX = VectorSetFloat1(Origin.X);
+	const VectorRegister4Float VecOriginY = VectorSetFloat1(Origin.Y);
+	const VectorRegister4Float VecOriginZ = VectorSetFloat1(Origin.Z);
+	const VectorRegister4Float VecAxisXX = VectorSetFloat1(AxisX.X);
+	const VectorRegister4Float VecAxisXY = VectorSetFloat1(AxisX.Y);
+	const VectorRegister4Float VecAxisXZ = VectorSetFloat1(AxisX.Z);
+	const VectorRegister4Float VecAxisYX = VectorSetFloat1(AxisY.X);
+	const VectorRegister4Float VecAxisYY = VectorSetFloat1(AxisY.Y);
+	const VectorRegister4Float VecAxisYZ = VectorSetFloat1(AxisY.Z);
+	const VectorRegister4Float VecAxisZX = VectorSetFloat1(AxisZ.X);
+	const VectorRegister4Float VecAxisZY = VectorSetFloat1(AxisZ.Y);
+	const VectorRegister4Float VecAxisZZ = VectorSetFloat1(AxisZ.Z);
+	const VectorRegister4Float VecClipSq = VectorSetFloat1(ClipRadiusXY * ClipRadiusXY);
+
+	const bool bJitter = JitterRange.X > 0.0f || JitterRange.Y > 0.0f || JitterRange.Z > 0.0f;
+	const bool bClip = ClipRadiusXY >= 0.0f;
+
+	alignas(16) float JitterX[4] = {};
+	alignas(16) float JitterY[4] = {};
+	alignas(16) float JitterZ[4] = {};
+	alignas(16) float WorldX[4];
+	alignas(16) float WorldY[4];
+	alignas(16) float WorldZ[4];
+
+	const float* XPtr = X.GetData();
+	const float* YPtr = Y.GetData();
+	const float* ZPtr = Z.GetData();
+
+	for (int32 Base = 0; Base < NumPoints; Base += 4)
+	{
+		VectorRegister4Float VecX = VectorLoad(XPtr + Base);
+		VectorRegister4Float VecY = VectorLoad(YPtr + Base);
+		VectorRegister4Float VecZ = VectorLoad(ZPtr + Base);
+
+		if (bJitter)
+		{
+			// Keyed by point index, so the jitter does not depend on how the points are batched
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const FVector3f Jitter = Random.Jitter(static_cast<uint32>(Base + Lane), JitterRange);
+				JitterX[Lane] = Jitter.X;
+				JitterY[Lane] = Jitter.Y;
+				JitterZ[Lane] = Jitter.Z;
+			}
+			VecX = VectorAdd(VecX, VectorLoadAligned(JitterX));
+			VecY = VectorAdd(VecY, VectorLoadAligned(JitterY));
+			VecZ = VectorAdd(VecZ, VectorLoadAligned(JitterZ));
+		}
+
+		// Lanes past NumPoints are padding
+		int32 LaneMask = (1 << FMath::Min(4, NumPoints - Base)) - 1;
+		if (bClip)
+		{
+			const VectorRegister4Float VecRadiusSq = VectorMultiplyAdd(VecY, VecY, VectorMultiply(VecX, VecX));
+			LaneMask &= VectorMaskBits(VectorCompareLE(VecRadiusSq, VecClipSq));
+		}
+
+		if (LaneMask == 0)
+		{
+			continue;
+		}
+
+		// World = Origin + X * AxisX + Y * AxisY + Z * AxisZ
+		VectorStoreAligned(VectorMultiplyAdd(VecZ, VecAxisZX, VectorMultiplyAdd(VecY, VecAxisYX, VectorMultiplyAdd(VecX, VecAxisXX, VecOriginX))), WorldX);
+		VectorStoreAligned(VectorMultiplyAdd(VecZ, VecAxisZY, VectorMultiplyAdd(VecY, VecAxisYY, VectorMultiplyAdd(VecX, VecAxisXY, VecOriginY))), WorldY);
+		VectorStoreAligned(VectorMultiplyAdd(VecZ, VecAxisZZ, VectorMultiplyAdd(VecY, VecAxisYZ, VectorMultiplyAdd(VecX, VecAxisXZ, VecOriginZ))), WorldZ);
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if (LaneMask & (1 << Lane))
+			{
+				FGPUSpawnRequest& Request = OutRequests.Add_GetRef(Prototype);
+				Request.Position = FVector3f(WorldX[Lane], WorldY[Lane], WorldZ[Lane]);
+			}
+		}
+	}
+
+	return OutRequests.Num() - StartNum;
+}
+
+//=============================================================================
+// FKawaiiFluidLatticeTemplateCache
+//=============================================================================
+
+FKawaiiFluidLatticeTemplateCache::FKawaiiFluidLatticeTemplateCache(int64 InMaxBytes)
+	: Templates(MaxTemplates)
+	, MaxBytes(InMaxBytes)
+{
+}
+
+/**
+ * @brief Shared cache used by the module spawn functions.
+ * @return Process-wide cache instance.
+ */
+FKawaiiFluidLatticeTemplateCache& FKawaiiFluidLatticeTemplateCache::Get()
+{
+	static FKawaiiFluidLatticeTemplateCache Instance;
+	return Instance;
+}
+
+/**
+ * @brief Look up a template, building and inserting it on a miss.
+ *
+ * The lattice is generated outside the lock; if two threads miss on the same key concurrently,
+ * the first insert wins and the second thread's template is returned uncached.
+ * @param Key Shape, size and spacing.
+ * @return Shared immutable template.
+ */
+FKawaiiFluidLatticeTemplateRef FKawaiiFluidLatticeTemplateCache::FindOrBuild(const FKawaiiFluidLatticeTemplateKey& Key)
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (TSharedPtr<const FKawaiiFluidLatticeTemplate, ESPMode::ThreadSafe>* Found = Templates.FindAndTouch(Key))
+		{
+			++Hits;
+			return Found->ToSharedRef();
+		}
+		++Misses;
+	}
+
+	FKawaiiFluidLatticeTemplateRef Template = FKawaiiFluidLatticeTemplate::Build(Key);
+	const int64 TemplateBytes = static_cast<int64>(Template->GetAllocatedSize());
+
+	FScopeLock ScopeLock(&Lock);
+	if (TemplateBytes > GetMaxBytes() || Templates.Contains(Key))
+	{
+		return Template;
+	}
+
+	EvictFor(TemplateBytes);
+	Templates.Add(Key, Template);
+	CachedBytes += TemplateBytes;
+	return Template;
+}
+
+/**
+ * @brief Change the byte budget and evict down to it.
+ * @param InMaxBytes New budget, 0 = follow r.Fluid.LatticeTemplateCacheKB.
+ */
+void FKawaiiFluidLatticeTemplateCache::SetMaxBytes(int64 InMaxBytes)
+{
+	FScopeLock ScopeLock(&Lock);
+	MaxBytes = InMaxBytes;
+	EvictFor(0);
+}
+
+void FKawaiiFluidLatticeTemplateCache::Empty()
+{
+	FScopeLock ScopeLock(&Lock);
+	Templates.Empty(MaxTemplates);
+	CachedBytes = 0;
+}
+
+int32 FKawaiiFluidLatticeTemplateCache::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Templates.Num();
+}
+
+int64 FKawaiiFluidLatticeTemplateCache::GetCachedBytes() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return CachedBytes;
+}
+
+int64 FKawaiiFluidLatticeTemplateCache::GetMaxBytes() const
+{
+	return MaxBytes > 0 ? MaxBytes : static_cast<int64>(FMath::Max(0, CVarFluidLatticeTemplateCacheKB.GetValueOnAnyThread())) * 1024;
+}
+
+/**
+ * @brief Evict least recently used templates (lock held).
+ * @param IncomingBytes Size of the template about to be inserted; 0 only trims to the budget.
+ */
+void FKawaiiFluidLatticeTemplateCache::EvictFor(int64 IncomingBytes)
+{
+	const int64 Budget = GetMaxBytes();
+	const int32 MaxEntries = IncomingBytes > 0 ? Templates.Max() - 1 : Templates.Max();
+
+	while (Templates.Num() > 0 && (CachedBytes + IncomingBytes > Budget || Templates.Num() > MaxEntries))
+	{
+		const TSharedPtr<const FKawaiiFluidLatticeTemplate, ESPMode::ThreadSafe> Evicted = Templates.RemoveLeastRecent();
+		CachedBytes -= Evicted.IsValid() ? static_cast<int64>(Evicted->GetAllocatedSize()) : 0;
+		++Evictions;
+	}
+}
@@ -0,0 +1,782 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidParticleQueryIndex.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Cell coordinates are packed into 21 bits per axis */
+	constexpr int32 QueryCellCoordOffset = 1 << 20;
+
+	/**
+	 * @brief Helper: Pack a cell coordinate into a 63-bit hash key.
+	 * @param Cell Cell coordinate, already clamped to +-QueryCellCoordOffset.
+	 * @return Packed key.
+	 */
+	FORCEINLINE uint64 PackCellKey(const FIntVector& Cell)
+	{
+		return static_cast<uint64>(Cell.X + QueryCellCoordOffset)
+			| (static_cast<uint64>(Cell.Y + QueryCellCoordOffset) << 21)
+			| (static_cast<uint64>(Cell.Z + QueryCellCoordOffset) << 42);
+	}
+
+	/**
+	 * @brief Helper: Hash slot of a packed key (Fibonacci hashing).
+	 * @param Key Packed cell key.
+	 * @param Mask Table size - 1 (power of two table).
+	 * @return Initial probe slot.
+	 */
+	FORCEINLINE int32 HashCellKey(uint64 Key, int32 Mask)
+	{
+		return static_cast<int32>((Key * 0x9E3779B97F4A7C15ull) >> 40) & Mask;
+	}
+
+	/**
+	 * @brief Helper: Run a batch of index-returning queries in parallel and flatten the results.
+	 * @param Queries Query descriptors.
+	 * @param OutIndices Concatenated result indices.
+	 * @param OutOffsets Per-query start offsets into OutIndices (Queries.Num() + 1 entries).
+	 * @param RunQuery Callable (const QueryType&, TArray<int32>&) appending one query's results.
+	 */
+	template <typename QueryType, typename FunctorType>
+	void RunIndexQueryBatch(TConstArrayView<QueryType> Queries, TArray<int32>& OutIndices, TArray<int32>& OutOffsets, FunctorType&& RunQuery)
+	{
+		const int32 NumQueries = Queries.Num();
+
+		TArray<TArray<int32>> PerQueryResults;
+		PerQueryResults.SetNum(NumQueries);
+		ParallelFor(NumQueries, [&](int32 QueryIndex)
+		{
+			RunQuery(Queries[QueryIndex], PerQueryResults[QueryIndex]);
+		}, EParallelForFlags::Unbalanced);
+
+		OutOffsets.SetNumUninitialized(NumQueries + 1);
+		OutOffsets[0] = 0;
+		for (int32 q = 0; q < NumQueries; ++q)
+		{
+			OutOffsets[q + 1] = OutOffsets[q] + PerQueryResults[q].Num();
+		}
+
+		OutIndices.SetNumUninitialized(OutOffsets[NumQueries]);
+		for (int32 q = 0; q < NumQueries; ++q)
+		{
+			if (PerQueryResults[q].Num() > 0)
+			{
+				FMemory::Memcpy(OutIndices.GetData() + OutOffsets[q], PerQueryResults[q].GetData(), PerQueryResults[q].Num() * sizeof(int32));
+			}
+		}
+	}
+
+	/**
+	 * @brief Helper: Entry distance of a segment into a sphere.
+	 * @param Start Segment start.
+	 * @param Dir Normalized segment direction.
+	 * @param Length Segment length.
+	 * @param Center Sphere center.
+	 * @param RadiusSq Squared sphere radius.
+	 * @param OutT Entry distance (0 when the start is inside the sphere).
+	 * @return True if the segment touches the sphere.
+	 */
+	bool IntersectSegmentSphere(const FVector3f& Start, const FVector3f& Dir, float Length, const FVector3f& Center, float RadiusSq, float& OutT)
+	{
+		const FVector3f M = Start - Center;
+		const float B = FVector3f::DotProduct(M, Dir);
+		const float C = M.SizeSquared() - RadiusSq;
+		if (C <= 0.0f)
+		{
+			OutT = 0.0f;
+			return true;
+		}
+		if (B > 0.0f)
+		{
+			return false;
+		}
+		const float Discriminant = B * B - C;
+		if (Discriminant < 0.0f)
+		{
+			return false;
+		}
+		OutT = -B - FMath::Sqrt(Discriminant);
+		return OutT <= Length;
+	}
+}
+
+/**
+ * @brief Clear the snapshot; previously returned indices become invalid.
+ */
+void FKawaiiFluidParticleQueryIndex::Reset()
+{
+	StagingPositions.Reset();
+	StagingVelocities.Reset();
+	StagingSourceIDs.Reset();
+	Positions.Reset();
+	Velocities.Reset();
+	SourceIDs.Reset();
+	CellStarts.Reset();
+	CellCoords.Reset();
+	HashKeys.Reset();
+	HashCells.Reset();
+	bBuilt = false;
+}
+
+/**
+ * @brief Append a block of particles (e.g. one GPU simulator's readback cache).
+ * @param InPositions World-space positions.
+ * @param InVelocities Velocities; may be empty (treated as zero) when the source did not read them back.
+ * @param InSourceIDs Source IDs; may be empty (treated as -1).
+ */
+void FKawaiiFluidParticleQueryIndex::AddParticles(TConstArrayView<FVector3f> InPositions, TConstArrayView<FVector3f> InVelocities, TConstArrayView<int32> InSourceIDs)
+{
+	const int32 Count = InPositions.Num();
+	StagingPositions.Append(InPositions.GetData(), Count);
+
+	if (InVelocities.Num() == Count)
+	{
+		StagingVelocities.Append(InVelocities.GetData(), Count);
+	}
+	else
+	{
+		StagingVelocities.AddZeroed(Count);
+	}
+
+	if (InSourceIDs.Num() == Count)
+	{
+		StagingSourceIDs.Append(InSourceIDs.GetData(), Count);
+	}
+	else
+	{
+		const int32 First = StagingSourceIDs.AddUninitialized(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			StagingSourceIDs[First + i] = -1;
+		}
+	}
+
+	bBuilt = false;
+}
+
+/**
+ * @brief Append a single particle (CPU backend).
+ * @param Position World-space position.
+ * @param Velocity Particle velocity.
+ * @param SourceID Source ID of the particle.
+ */
+void FKawaiiFluidParticleQueryIndex::AddParticle(const FVector& Position, const FVector& Velocity, int32 SourceID)
+{
+	StagingPositions.Add(FVector3f(Position));
+	StagingVelocities.Add(FVector3f(Velocity));
+	StagingSourceIDs.Add(SourceID);
+	bBuilt = false;
+}
+
+/**
+ * @brief Sort the appended particles into the sparse grid.
+ * @param InCellSize Cell size (cm), typically the smoothing radius.
+ */
+void FKawaiiFluidParticleQueryIndex::Build(float InCellSize)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidQueryIndex_Build);
+
+	const int32 NumParticles = StagingPositions.Num();
+	bBuilt = true;
+	CellSize = FMath::Max(InCellSize, 1.0f);
+	InvCellSize = 1.0f / CellSize;
+
+	Positions.SetNumUninitialized(NumParticles);
+	Velocities.SetNumUninitialized(NumParticles);
+	SourceIDs.SetNumUninitialized(NumParticles);
+	CellCoords.Reset();
+	CellStarts.Reset();
+
+	if (NumParticles == 0)
+	{
+		CellStarts.Add(0);
+		HashKeys.Reset();
+		HashCells.Reset();
+		return;
+	}
+
+	// 1. Cell coordinate per particle
+	TArray<FIntVector> ParticleCoords;
+	ParticleCoords.SetNumUninitialized(NumParticles);
+	ParallelFor(NumParticles, [&](int32 i)
+	{
+		ParticleCoords[i] = ToCell(StagingPositions[i]);
+	});
+
+	// 2. Dense cell index per particle via open addressing (at most NumParticles cells, load <= 0.5)
+	const int32 TableSize = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(NumParticles))) * 2;
+	const int32 Mask = TableSize - 1;
+	HashKeys.SetNumUninitialized(TableSize);
+	HashCells.Init(INDEX_NONE, TableSize);
+
+	TArray<int32> ParticleCells;
+	ParticleCells.SetNumUninitialized(NumParticles);
+	CellBoundsMin = ParticleCoords[0];
+	CellBoundsMax = ParticleCoords[0];
+
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const FIntVector& Coord = ParticleCoords[i];
+		const uint64 Key = PackCellKey(Coord);
+		int32 Slot = HashCellKey(Key, Mask);
+		while (HashCells[Slot] != INDEX_NONE && HashKeys[Slot] != Key)
+		{
+			Slot = (Slot + 1) & Mask;
+		}
+		if (HashCells[Slot] == INDEX_NONE)
+		{
+			HashKeys[Slot] = Key;
+			HashCells[Slot] = CellCoords.Add(Coord);
+			CellBoundsMin = FIntVector(FMath::Min(CellBoundsMin.X, Coord.X), FMath::Min(CellBoundsMin.Y, Coord.Y), FMath::Min(CellBoundsMin.Z, Coord.Z));
+			CellBoundsMax = FIntVector(FMath::Max(CellBoundsMax.X, Coord.X), FMath::Max(CellBoundsMax.Y, Coord.Y), FMath::Max(CellBoundsMax.Z, Coord.Z));
+		}
+		ParticleCells[i] = HashCells[Slot];
+	}
+
+	// 3. Counting sort so each cell is one contiguous span
+	const int32 NumCells = CellCoords.Num();
+	CellStarts.SetNumZeroed(NumCells + 1);
+	for (const int32 Cell : ParticleCells)
+	{
+		++CellStarts[Cell + 1];
+	}
+	for (int32 c = 0; c < NumCells; ++c)
+	{
+		CellStarts[c + 1] += CellStarts[c];
+	}
+
+	TArray<int32> WriteOffsets(CellStarts.GetData(), NumCells);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const int32 Dest = WriteOffsets[ParticleCells[i]]++;
+		Positions[Dest] = StagingPositions[i];
+		Velocities[Dest] = StagingVelocities[i];
+		SourceIDs[Dest] = StagingSourceIDs[i];
+	}
+
+	StagingPositions.Reset();
+	StagingVelocities.Reset();
+	StagingSourceIDs.Reset();
+}
+
+/**
+ * @brief Cell coordinate of a world location, clamped to the packable range.
+ * @param Location World-space location.
+ * @return Cell coordinate.
+ */
+FIntVector FKawaiiFluidParticleQueryIndex::ToCell(const FVector3f& Location) const
+{
+	const FVector3f Scaled = Location * InvCellSize;
+	return FIntVector(
+		FMath::Clamp(FMath::FloorToInt(Scaled.X), -QueryCellCoordOffset, QueryCellCoordOffset - 1),
+		FMath::Clamp(FMath::FloorToInt(Scaled.Y), -QueryCellCoordOffset, QueryCellCoordOffset - 1),
+		FMath::Clamp(FMath::FloorToInt(Scaled.Z), -QueryCellCoordOffset, QueryCellCoordOffset - 1));
+}
+
+/**
+ * @brief Look up an occupied cell.
+ * @param Cell Cell coordinate.
+ * @return Dense cell index, or INDEX_NONE if no particle lies in the cell.
+ */
+int32 FKawaiiFluidParticleQueryIndex::FindCell(const FIntVector& Cell) const
+{
+	const uint64 Key = PackCellKey(Cell);
+	const int32 Mask = HashCells.Num() - 1;
+	int32 Slot = HashCellKey(Key, Mask);
+	while (HashCells[Slot] != INDEX_NONE)
+	{
+		if (HashKeys[Slot] == Key)
+		{
+			return HashCells[Slot];
+		}
+		Slot = (Slot + 1) & Mask;
+	}
+	return INDEX_NONE;
+}
+
+/**
+ * @brief Cell range overlapped by a world-space box, clamped to the occupied cell bounds.
+ * @param Min Box minimum.
+ * @param Max Box maximum.
+ * @param OutMin First overlapped cell.
+ * @param OutMax Last overlapped cell.
+ * @return False if the box misses every occupied cell.
+ */
+bool FKawaiiFluidParticleQueryIndex::ClampCellRange(const FVector& Min, const FVector& Max, FIntVector& OutMin, FIntVector& OutMax) const
+{
+	if (!bBuilt || Positions.Num() == 0)
+	{
+		return false;
+	}
+
+	OutMin = ToCell(FVector3f(Min));
+	OutMax = ToCell(FVector3f(Max));
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		OutMin[Axis] = FMath::Max(OutMin[Axis], CellBoundsMin[Axis]);
+		OutMax[Axis] = FMath::Min(OutMax[Axis], CellBoundsMax[Axis]);
+		if (OutMin[Axis] > OutMax[Axis])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Visit the particle span of every occupied cell inside a cell range.
+ * Large ranges walk the occupied cell list instead of probing every coordinate.
+ * @param MinCell First cell (inclusive).
+ * @param MaxCell Last cell (inclusive).
+ * @param Functor Callable (int32 Begin, int32 End) over sorted particle indices.
+ */
+template <typename FunctorType>
+void FKawaiiFluidParticleQueryIndex::ForEachCellInRange(const FIntVector& MinCell, const FIntVector& MaxCell, FunctorType&& Functor) const
+{
+	const int64 RangeCells =
+		static_cast<int64>(MaxCell.X - MinCell.X + 1) *
+		static_cast<int64>(MaxCell.Y - MinCell.Y + 1) *
+		static_cast<int64>(MaxCell.Z - MinCell.Z + 1);
+
+	if (RangeCells > CellCoords.Num())
+	{
+		for (int32 c = 0; c < CellCoords.Num(); ++c)
+		{
+			const FIntVector& Coord = CellCoords[c];
+			if (Coord.X >= MinCell.X && Coord.X <= MaxCell.X &&
+				Coord.Y >= MinCell.Y && Coord.Y <= MaxCell.Y &&
+				Coord.Z >= MinCell.Z && Coord.Z <= MaxCell.Z)
+			{
+				Functor(CellStarts[c], CellStarts[c + 1]);
+			}
+		}
+		return;
+	}
+
+	for (int32 z = MinCell.Z; z <= MaxCell.Z; ++z)
+	{
+		for (int32 y = MinCell.Y; y <= MaxCell.Y; ++y)
+		{
+			for (int32 x = MinCell.X; x <= MaxCell.X; ++x)
+			{
+				const int32 Cell = FindCell(FIntVector(x, y, z));
+				if (Cell != INDEX_NONE)
+				{
+					Functor(CellStarts[Cell], CellStarts[Cell + 1]);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Find all particles within a sphere.
+ * @param Center Sphere center.
+ * @param Radius Sphere radius (cm).
+ * @param OutIndices Receives matching particle indices (appended).
+ * @return Number of particles found.
+ */
+int32 FKawaiiFluidParticleQueryIndex::QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutIndices) const
+{
+	FIntVector MinCell, MaxCell;
+	if (Radius < 0.0f || !ClampCellRange(Center - FVector(Radius), Center + FVector(Radius), MinCell, MaxCell))
+	{
+		return 0;
+	}
+
+	const int32 NumBefore = OutIndices.Num();
+	const FVector3f C(Center);
+	const float RadiusSq = Radius * Radius;
+
+	ForEachCellInRange(MinCell, MaxCell, [&](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			if (FVector3f::DistSquared(Positions[i], C) <= RadiusSq)
+			{
+				OutIndices.Add(i);
+			}
+		}
+	});
+
+	return OutIndices.Num() - NumBefore;
+}
+
+/**
+ * @brief Find all particles inside an axis-aligned box.
+ * @param Box World-space box.
+ * @param OutIndices Receives matching particle indices (appended).
+ * @return Number of particles found.
+ */
+int32 FKawaiiFluidParticleQueryIndex::QueryBox(const FBox& Box, TArray<int32>& OutIndices) const
+{
+	FIntVector MinCell, MaxCell;
+	if (!Box.IsValid || !ClampCellRange(Box.Min, Box.Max, MinCell, MaxCell))
+	{
+		return 0;
+	}
+
+	const int32 NumBefore = OutIndices.Num();
+	const FVector3f BoxMin(Box.Min);
+	const FVector3f BoxMax(Box.Max);
+
+	ForEachCellInRange(MinCell, MaxCell, [&](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const FVector3f& P = Positions[i];
+			if (P.X >= BoxMin.X && P.X <= BoxMax.X &&
+				P.Y >= BoxMin.Y && P.Y <= BoxMax.Y &&
+				P.Z >= BoxMin.Z && P.Z <= BoxMax.Z)
+			{
+				OutIndices.Add(i);
+			}
+		}
+	});
+
+	return OutIndices.Num() - NumBefore;
+}
+
+/**
+ * @brief Find the first particle sphere hit along a segment.
+ * The segment is walked in cell-length chunks; a chunk only needs the cells its swept AABB overlaps,
+ * and the walk stops at the first chunk whose best hit lies before the chunk end.
+ * @param Start Segment start.
+ * @param End Segment end.
+ * @param HitRadius Particle sphere radius (cm).
+ * @return Closest hit, or an invalid hit on miss.
+ */
+FKawaiiFluidRayQueryHit FKawaiiFluidParticleQueryIndex::Raycast(const FVector& Start, const FVector& End, float HitRadius) const
+{
+	FKawaiiFluidRayQueryHit Hit;
+	if (!bBuilt || Positions.Num() == 0)
+	{
+		return Hit;
+	}
+
+	const FVector3f S(Start);
+	FVector3f Dir = FVector3f(End) - S;
+	const float Length = Dir.Size();
+	Dir = Length > KINDA_SMALL_NUMBER ? Dir / Length : FVector3f::UpVector;
+	HitRadius = FMath::Max(HitRadius, 0.0f);
+	const float RadiusSq = HitRadius * HitRadius;
+
+	// Clip the segment against the occupied bounds expanded by the hit radius
+	const FVector3f BoxMin = FVector3f(CellBoundsMin) * CellSize - FVector3f(HitRadius);
+	const FVector3f BoxMax = FVector3f(CellBoundsMax + FIntVector(1)) * CellSize + FVector3f(HitRadius);
+	float TMin = 0.0f;
+	float TMax = Length;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (FMath::Abs(Dir[Axis]) < KINDA_SMALL_NUMBER)
+		{
+			if (S[Axis] < BoxMin[Axis] || S[Axis] > BoxMax[Axis])
+			{
+				return Hit;
+			}
+			continue;
+		}
+		const float InvD = 1.0f / Dir[Axis];
+		float T0 = (BoxMin[Axis] - S[Axis]) * InvD;
+		float T1 = (BoxMax[Axis] - S[Axis]) * InvD;
+		if (T0 > T1)
+		{
+			Swap(T0, T1);
+		}
+		TMin = FMath::Max(TMin, T0);
+		TMax = FMath::Min(TMax, T1);
+		if (TMin > TMax)
+		{
+			return Hit;
+		}
+	}
+
+	float BestT = TNumericLimits<float>::Max();
+	for (float ChunkStart = TMin; ChunkStart <= TMax; ChunkStart += CellSize)
+	{
+		const float ChunkEnd = FMath::Min(ChunkStart + CellSize, TMax);
+		const FVector A(S + Dir * ChunkStart);
+		const FVector B(S + Dir * ChunkEnd);
+
+		FIntVector MinCell, MaxCell;
+		if (ClampCellRange(FVector::Min(A, B) - FVector(HitRadius), FVector::Max(A, B) + FVector(HitRadius), MinCell, MaxCell))
+		{
+			ForEachCellInRange(MinCell, MaxCell, [&](int32 Begin, int32 EndIndex)
+			{
+				for (int32 i = Begin; i < EndIndex; ++i)
+				{
+					float T;
+					if (IntersectSegmentSphere(S, Dir, Length, Positions[i], RadiusSq, T) && T < BestT)
+					{
+						BestT = T;
+						Hit.Index = i;
+					}
+				}
+			});
+		}
+
+		// Later chunks can only contain entries beyond this chunk
+		if ((Hit.IsValidHit() && BestT <= ChunkEnd) || ChunkEnd >= TMax)
+		{
+			break;
+		}
+	}
+
+	if (Hit.IsValidHit())
+	{
+		Hit.Distance = BestT;
+	}
+	return Hit;
+}
+
+/**
+ * @brief Find the K particles nearest to a location, closest first.
+ * Searches Chebyshev rings of cells outward and stops once the next ring cannot beat the current K-th distance.
+ * When a ring would hold more cells than are occupied, the remaining cells are scanned directly with box-distance pruning.
+ * @param Location Query point.
+ * @param Count Maximum number of particles to return.
+ * @param MaxDistance Search radius limit (cm), <= 0 for unlimited.
+ * @param OutIndices Receives particle indices sorted by distance (appended).
+ * @return Number of particles found.
+ */
+int32 FKawaiiFluidParticleQueryIndex::QueryNearest(const FVector& Location, int32 Count, float MaxDistance, TArray<int32>& OutIndices) const
+{
+	if (!bBuilt || Positions.Num() == 0 || Count <= 0)
+	{
+		return 0;
+	}
+
+	typedef TPair<float, int32> FCandidate;
+	auto FartherFirst = [](const FCandidate& A, const FCandidate& B) { return A.Key > B.Key; };
+
+	TArray<FCandidate, TInlineAllocator<32>> Heap;
+	const FVector3f P(Location);
+	const float MaxDistSq = MaxDistance > 0.0f ? MaxDistance * MaxDistance : TNumericLimits<float>::Max();
+	const FIntVector Center = ToCell(P);
+
+	auto VisitCell = [&](int32 Cell)
+	{
+		for (int32 i = CellStarts[Cell]; i < CellStarts[Cell + 1]; ++i)
+		{
+			const float DistSq = FVector3f::DistSquared(Positions[i], P);
+			if (DistSq > MaxDistSq)
+			{
+				continue;
+			}
+			if (Heap.Num() < Count)
+			{
+				Heap.HeapPush(FCandidate(DistSq, i), FartherFirst);
+			}
+			else if (DistSq < Heap.HeapTop().Key)
+			{
+				Heap.HeapPopDiscard(FartherFirst, EAllowShrinking::No);
+				Heap.HeapPush(FCandidate(DistSq, i), FartherFirst);
+			}
+		}
+	};
+
+	auto ProbeCell = [&](int32 x, int32 y, int32 z)
+	{
+		const int32 Cell = FindCell(FIntVector(x, y, z));
+		if (Cell != INDEX_NONE)
+		{
+			VisitCell(Cell);
+		}
+	};
+
+	// First ring that touches the occupied bounds, and the ring that covers all of them
+	int32 FirstRing = 0;
+	int32 LastRing = 0;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		FirstRing = FMath::Max(FirstRing, FMath::Max(CellBoundsMin[Axis] - Center[Axis], Center[Axis] - CellBoundsMax[Axis]));
+		LastRing = FMath::Max(LastRing, FMath::Max(Center[Axis] - CellBoundsMin[Axis], CellBoundsMax[Axis] - Center[Axis]));
+	}
+
+	const int32 NumCells = CellCoords.Num();
+	for (int32 Ring = FirstRing; Ring <= LastRing; ++Ring)
+	{
+		const int64 RingCells = Ring == 0 ? 1 : FMath::Cube(2 * static_cast<int64>(Ring) + 1) - FMath::Cube(2 * static_cast<int64>(Ring) - 1);
+		if (RingCells > NumCells)
+		{
+			// Sparse tail: scan every cell not yet visited, skipping cells that cannot improve the result
+			for (int32 c = 0; c < NumCells; ++c)
+			{
+				const FIntVector& Coord = CellCoords[c];
+				const int32 Chebyshev = FMath::Max3(FMath::Abs(Coord.X - Center.X), FMath::Abs(Coord.Y - Center.Y), FMath::Abs(Coord.Z - Center.Z));
+				if (Chebyshev < Ring)
+				{
+					continue;
+				}
+
+				float BoxDistSq = 0.0f;
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					const float Lo = Coord[Axis] * CellSize;
+					const float Hi = Lo + CellSize;
+					BoxDistSq += FMath::Square(FMath::Max3(Lo - P[Axis], P[Axis] - Hi, 0.0f));
+				}
+				if (BoxDistSq > MaxDistSq || (Heap.Num() == Count && BoxDistSq >= Heap.HeapTop().Key))
+				{
+					continue;
+				}
+				VisitCell(c);
+			}
+			break;
+		}
+
+		const int32 ZMin = FMath::Max(Center.Z - Ring, CellBoundsMin.Z);
+		const int32 ZMax = FMath::Min(Center.Z + Ring, CellBoundsMax.Z);
+		const int32 YMin = FMath::Max(Center.Y - Ring, CellBoundsMin.Y);
+		const int32 YMax = FMath::Min(Center.Y + Ring, CellBoundsMax.Y);
+
+		for (int32 z = ZMin; z <= ZMax; ++z)
+		{
+			for (int32 y = YMin; y <= YMax; ++y)
+			{
+				if (FMath::Abs(z - Center.Z) == Ring || FMath::Abs(y - Center.Y) == Ring)
+				{
+					const int32 XMin = FMath::Max(Center.X - Ring, CellBoundsMin.X);
+					const int32 XMax = FMath::Min(Center.X + Ring, CellBoundsMax.X);
+					for (int32 x = XMin; x <= XMax; ++x)
+					{
+						ProbeCell(x, y, z);
+					}
+				}
+				else
+				{
+					if (Center.X - Ring >= CellBoundsMin.X)
+					{
+						ProbeCell(Center.X - Ring, y, z);
+					}
+					if (Center.X + Ring <= CellBoundsMax.X)
+					{
+						ProbeCell(Center.X + Ring, y, z);
+					}
+				}
+			}
+		}
+
+		// Closest possible distance to any cell of the next ring
+		float NextRingDist = TNumericLimits<float>::Max();
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float BlockMin = (Center[Axis] - Ring) * CellSize;
+			const float BlockMax = (Center[Axis] + Ring + 1) * CellSize;
+			NextRingDist = FMath::Min(NextRingDist, FMath::Min(P[Axis] - BlockMin, BlockMax - P[Axis]));
+		}
+		const float NextRingDistSq = FMath::Square(FMath::Max(NextRingDist, 0.0f));
+
+		if (NextRingDistSq > MaxDistSq)
+		{
+			break;
+		}
+		if (Heap.Num() == Count && NextRingDistSq >= Heap.HeapTop().Key)
+		{
+			break;
+		}
+	}
+
+	Heap.Sort([](const FCandidate& A, const FCandidate& B) { return A.Key < B.Key; });
+	OutIndices.Reserve(OutIndices.Num() + Heap.Num());
+	for (const FCandidate& Candidate : Heap)
+	{
+		OutIndices.Add(Candidate.Value);
+	}
+	return Heap.Num();
+}
+
+/**
+ * @brief Run sphere queries in parallel.
+ * @param Queries Sphere queries.
+ * @param OutIndices Concatenated result indices.
+ * @param OutOffsets Results of query q are OutIndices[OutOffsets[q] .. OutOffsets[q + 1]).
+ */
+void FKawaiiFluidParticleQueryIndex::QuerySpheres(TConstArrayView<FKawaiiFluidSphereQuery> Queries, TArray<int32>& OutIndices, TArray<int32>& OutOffsets) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidQueryIndex_QuerySpheres);
+
+	RunIndexQueryBatch(Queries, OutIndices, OutOffsets, [this](const FKawaiiFluidSphereQuery& Query, TArray<int32>& OutResult)
+	{
+		QuerySphere(Query.Center, Query.Radius, OutResult);
+	});
+}
+
+/**
+ * @brief Run box queries in parallel.
+ * @param Queries World-space boxes.
+ * @param OutIndices Concatenated result indices.
+ * @param OutOffsets Results of query q are OutIndices[OutOffsets[q] .. OutOffsets[q + 1]).
+ */
+void FKawaiiFluidParticleQueryIndex::QueryBoxes(TConstArrayView<FBox> Queries, TArray<int32>& OutIndices, TArray<int32>& OutOffsets) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidQueryIndex_QueryBoxes);
+
+	RunIndexQueryBatch(Queries, OutIndices, OutOffsets, [this](const FBox& Query, TArray<int32>& OutResult)
+	{
+		QueryBox(Query, OutResult);
+	});
+}
+
+/**
+ * @brief Run segment queries in parallel.
+ * @param Queries Segment queries.
+ * @param OutHits One hit per query (invalid on miss).
+ */
+void FKawaiiFluidParticleQueryIndex::Raycasts(TConstArrayView<FKawaiiFluidRayQuery> Queries, TArray<FKawaiiFluidRayQueryHit>& OutHits) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidQueryIndex_Raycasts);
+
+	OutHits.SetNum(Queries.Num());
+	ParallelFor(Queries.Num(), [&](int32 QueryIndex)
+	{
+		const FKawaiiFluidRayQuery& Query = Queries[QueryIndex];
+		OutHits[QueryIndex] = Raycast(Query.Start, Query.End, Query.HitRadius);
+	}, EParallelForFlags::Unbalanced);
+}
+
+/**
+ * @brief Run nearest-K queries in parallel.
+ * @param Queries Nearest-K queries.
+ * @param OutIndices Concatenated result indices, each query's block sorted by distance.
+ * @param OutOffsets Results of query q are OutIndices[OutOffsets[q] .. OutOffsets[q + 1]).
+ */
+void FKawaiiFluidParticleQueryIndex::QueryNearestBatch(TConstArrayView<FKawaiiFluidNearestQuery> Queries, TArray<int32>& OutIndices, TArray<int32>& OutOffsets) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidQueryIndex_QueryNearest);
+
+	RunIndexQueryBatch(Queries, OutIndices, OutOffsets, [this](const FKawaiiFluidNearestQuery& Query, TArray<int32>& OutResult)
+	{
+		QueryNearest(Query.Location, Query.Count, Query.MaxDistance, OutResult);
+	});
+}
+
+/**
+ * @brief Resolve a query index to a record.
+ * @param Index Particle index returned by a query.
+ * @return Position, velocity and source ID of the particle.
+ */
+FKawaiiFluidParticleRecord FKawaiiFluidParticleQueryIndex::GetRecord(int32 Index) const
+{
+	FKawaiiFluidParticleRecord Record;
+	Record.Position = FVector(Positions[Index]);
+	Record.Velocity = FVector(Velocities[Index]);
+	Record.SourceID = SourceIDs[Index];
+	return Record;
+}
+
+/**
+ * @brief Resolve query indices to records.
+ * @param Indices Particle indices returned by a query.
+ * @param OutRecords Receives one record per index (replaced).
+ */
+void FKawaiiFluidParticleQueryIndex::GetRecords(TConstArrayView<int32> Indices, TArray<FKawaiiFluidParticleRecord>& OutRecords) const
+{
+	OutRecords.SetNumUninitialized(Indices.Num());
+	for (int32 i = 0; i < Indices.Num(); ++i)
+	{
+		OutRecords[i] = GetRecord(Indices[i]);
+	}
+}
@@ -0,0 +1,452 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Procedural spawn descriptors (CPU mirror of FluidSpawnDescriptor.usf)
+
+#include "Simulation/Utils/KawaiiFluidSpawnDescriptor.h"
+#include "Simulation/Utils/KawaiiFluidSpawnRandom.h"
+#include "Async/ParallelFor.h"
+#include "Algo/BinarySearch.h"
+
+//=============================================================================
+// Lattice Helpers
+//=============================================================================
+
+/**
+ * @brief PCG3D hash of a lattice point; mirrors SpawnLatticeHash in FluidSpawnRandom.ush.
+ * @param X Lattice X index.
+ * @param Y Lattice Y index.
+ * @param Z Lattice Z index.
+ * @param Seed Descriptor jitter seed.
+ * @return Three hashed words.
+ */
+FUintVector3 KawaiiFluidSpawnLattice::Hash(int32 X, int32 Y, int32 Z, uint32 Seed)
+{
+	uint32 VX = static_cast<uint32>(X) ^ Seed;
+	uint32 VY = static_cast<uint32>(Y) ^ (Seed * 0x9E3779B9u);
+	uint32 VZ = static_cast<uint32>(Z) ^ (Seed * 0x85EBCA6Bu);
+
+	VX = VX * 1664525u + 1013904223u;
+	VY = VY * 1664525u + 1013904223u;
+	VZ = VZ * 1664525u + 1013904223u;
+
+	VX += VY * VZ;
+	VY += VZ * VX;
+	VZ += VX * VY;
+
+	VX ^= VX >> 16u;
+	VY ^= VY >> 16u;
+	VZ ^= VZ >> 16u;
+
+	VX += VY * VZ;
+	VY += VZ * VX;
+	VZ += VX * VY;
+
+	return FUintVector3(VX, VY, VZ);
+}
+
+/**
+ * @brief Map a hash word to [-1, 1).
+ * @param Value Hash output.
+ * @return Signed unit value.
+ */
+float KawaiiFluidSpawnLattice::ToSignedUnit(uint32 Value)
+{
+	return static_cast<float>(Value >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+/**
+ * @brief Rotation whose local X/Y are the in-plane axes FindBestAxisVectors picks for Normal.
+ * @param Normal Disc normal (zero falls back to straight down).
+ * @return Rotation for a Disc descriptor.
+ */
+FQuat KawaiiFluidSpawnLattice::MakeDiscRotation(const FVector& Normal)
+{
+	FVector Dir = Normal.GetSafeNormal();
+	if (Dir.IsNearlyZero())
+	{
+		Dir = FVector(0.0, 0.0, -1.0);
+	}
+
+	FVector Right, Up;
+	Dir.FindBestAxisVectors(Right, Up);
+
+	// (Right, Up, Dir) is left-handed; the disc is flat, so local Z may point along -Dir
+	return FQuat(FMatrix(Right, Up, Right ^ Up, FVector::ZeroVector));
+}
+
+/**
+ * @brief Rotation whose local Z points along Normal.
+ * @param Normal Surface normal (zero falls back to up).
+ * @return Rotation for a Hemisphere descriptor.
+ */
+FQuat KawaiiFluidSpawnLattice::MakeHemisphereRotation(const FVector& Normal)
+{
+	const FVector Dir = Normal.GetSafeNormal();
+	return FRotationMatrix::MakeFromZ(Dir.IsNearlyZero() ? FVector::UpVector : Dir).ToQuat();
+}
+
+//=============================================================================
+// FKawaiiFluidSpawnPlan
+//=============================================================================
+
+/**
+ * @brief Build the row table: per lattice row, the contiguous X range inside the shape.
+ * @param InDescriptor Spawn descriptor.
+ */
+void FKawaiiFluidSpawnPlan::Build(const FKawaiiFluidSpawnDescriptor& InDescriptor)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidSpawnPlan_Build);
+
+	Descriptor = InDescriptor;
+	Rows.Reset();
+
+	const FQuat4f Rotation(Descriptor.Rotation);
+	AxisX = Rotation.GetAxisX();
+	AxisY = Rotation.GetAxisY();
+	AxisZ = Rotation.GetAxisZ();
+	Start = FVector3f::ZeroVector;
+	YBase = 0;
+	ZBase = 0;
+
+	const FVector3f Extent(Descriptor.Extent);
+	const float Radius = Extent.X;
+
+	// Sampled shape: one row of MaxCount samples (sample index = X), no lattice
+	if (Descriptor.Shape == EKawaiiFluidSpawnShape::Hemisphere)
+	{
+		const int32 Count = Radius > 0.0f ? FMath::Max(Descriptor.MaxCount, 0) : 0;
+		if (Count > 0)
+		{
+			Rows.Add(FKawaiiFluidSpawnRow());
+		}
+		FKawaiiFluidSpawnRow& Sentinel = Rows.AddDefaulted_GetRef();
+		Sentinel.Offset = Count;
+		return;
+	}
+
+	if (Descriptor.Spacing <= 0.0f)
+	{
+		Rows.Add(FKawaiiFluidSpawnRow());
+		return;
+	}
+
+	// Lattice index ranges (inclusive); XLo/XHi may be narrowed per row for the disc
+	int32 XLo = 0, XHi = -1, YLo = 0, YHi = -1, ZLo = 0, ZHi = -1;
+
+	if (Descriptor.Shape == EKawaiiFluidSpawnShape::Disc)
+	{
+		// Single 2D layer: no HCP compensation, no layer stagger
+		Step = FVector3f(Descriptor.Spacing, Descriptor.Spacing * FMath::Sqrt(3.0f) * 0.5f, 0.0f);
+		if (Radius > 0.0f)
+		{
+			YHi = FMath::CeilToInt(Radius / Step.Y);
+			YLo = -YHi;
+			ZLo = ZHi = 0;
+		}
+	}
+	else
+	{
+		const float S = Descriptor.Spacing * KawaiiFluidSpawnLattice::HCPCompensation;
+		Step = FVector3f(S, S * 0.866025f, S * 0.816497f);
+
+		switch (Descriptor.Shape)
+		{
+		case EKawaiiFluidSpawnShape::Sphere:
+			if (Radius > 0.0f)
+			{
+				XHi = FMath::CeilToInt(Radius / Step.X) + 1;
+				YHi = FMath::CeilToInt(Radius / Step.Y) + 1;
+				ZHi = FMath::CeilToInt(Radius / Step.Z) + 1;
+				XLo = -XHi; YLo = -YHi; ZLo = -ZHi;
+			}
+			break;
+
+		case EKawaiiFluidSpawnShape::Box:
+			XHi = FMath::Max(1, FMath::CeilToInt(Extent.X * 2.0f / Step.X)) - 1;
+			YHi = FMath::Max(1, FMath::CeilToInt(Extent.Y * 2.0f / Step.Y)) - 1;
+			ZHi = FMath::Max(1, FMath::CeilToInt(Extent.Z * 2.0f / Step.Z)) - 1;
+			Start = FVector3f(-Extent.X + Step.X * 0.5f, -Extent.Y + Step.Y * 0.5f, -Extent.Z + Step.Z * 0.5f);
+			break;
+
+		case EKawaiiFluidSpawnShape::Cylinder:
+			if (Radius > 0.0f && Extent.Z > 0.0f)
+			{
+				XHi = FMath::CeilToInt(Radius / Step.X) + 1;
+				YHi = FMath::CeilToInt(Radius / Step.Y) + 1;
+				ZHi = FMath::CeilToInt(Extent.Z / Step.Z);
+				XLo = -XHi; YLo = -YHi; ZLo = -ZHi;
+			}
+			break;
+
+		default:
+			break;
+		}
+
+		YBase = YLo;
+		ZBase = ZLo;
+	}
+
+	const int32 Limit = Descriptor.MaxCount > 0 ? Descriptor.MaxCount : MAX_int32;
+	const float RadiusSq = Radius * Radius;
+	int32 Offset = 0;
+
+	for (int32 Z = ZLo; Z <= ZHi && Offset < Limit; ++Z)
+	{
+		for (int32 Y = YLo; Y <= YHi && Offset < Limit; ++Y)
+		{
+			// Row center offset and half-width along local X
+			const FVector3f RowOrigin = GetLocalPosition(0, Y, Z);
+			float HalfWidthSq = -1.0f;
+			int32 RowXLo = XLo, RowXHi = XHi;
+
+			switch (Descriptor.Shape)
+			{
+			case EKawaiiFluidSpawnShape::Sphere:
+				HalfWidthSq = RadiusSq - RowOrigin.Y * RowOrigin.Y - RowOrigin.Z * RowOrigin.Z;
+				break;
+			case EKawaiiFluidSpawnShape::Box:
+				HalfWidthSq = (FMath::Abs(RowOrigin.Y) <= Extent.Y && FMath::Abs(RowOrigin.Z) <= Extent.Z) ? Extent.X * Extent.X : -1.0f;
+				break;
+			case EKawaiiFluidSpawnShape::Cylinder:
+				HalfWidthSq = FMath::Abs(RowOrigin.Z) <= Extent.Z ? RadiusSq - RowOrigin.Y * RowOrigin.Y : -1.0f;
+				break;
+			case EKawaiiFluidSpawnShape::Disc:
+				HalfWidthSq = RadiusSq - RowOrigin.Y * RowOrigin.Y;
+				if (HalfWidthSq >= 0.0f)
+				{
+					RowXHi = FMath::FloorToInt(FMath::Sqrt(HalfWidthSq) / Step.X);
+					RowXLo = -RowXHi;
+				}
+				break;
+			default:
+				break;
+			}
+
+			if (HalfWidthSq < 0.0f)
+			{
+				continue;
+			}
+
+			// Analytic range, then nudged with the exact point test so rounding never adds or drops a point
+			const float HalfWidth = FMath::Sqrt(HalfWidthSq);
+			int32 First = FMath::Clamp(FMath::CeilToInt((-HalfWidth - RowOrigin.X) / Step.X), RowXLo, RowXHi + 1);
+			int32 Last = FMath::Clamp(FMath::FloorToInt((HalfWidth - RowOrigin.X) / Step.X), RowXLo - 1, RowXHi);
+
+			while (First <= Last && !IsInside(GetLocalPosition(First, Y, Z))) { ++First; }
+			while (Last >= First && !IsInside(GetLocalPosition(Last, Y, Z))) { --Last; }
+			if (First > Last)
+			{
+				const int32 Candidate = FMath::Clamp(FMath::RoundToInt(-RowOrigin.X / Step.X), RowXLo, RowXHi);
+				if (RowXLo > RowXHi || !IsInside(GetLocalPosition(Candidate, Y, Z)))
+				{
+					continue;
+				}
+				First = Last = Candidate;
+			}
+			while (First > RowXLo && IsInside(GetLocalPosition(First - 1, Y, Z))) { --First; }
+			while (Last < RowXHi && IsInside(GetLocalPosition(Last + 1, Y, Z))) { ++Last; }
+
+			FKawaiiFluidSpawnRow& Row = Rows.AddDefaulted_GetRef();
+			Row.FirstX = First;
+			Row.Y = Y;
+			Row.Z = Z;
+			Row.Offset = Offset;
+			Offset += FMath::Min(Last - First + 1, Limit - Offset);
+		}
+	}
+
+	// Sentinel: closes the last row and carries the total
+	FKawaiiFluidSpawnRow& Sentinel = Rows.AddDefaulted_GetRef();
+	Sentinel.Offset = Offset;
+}
+
+/**
+ * @brief Local position of a lattice point (or Hemisphere sample X) before jitter; mirrors SpawnLatticeLocal.
+ * @param X Lattice X index.
+ * @param Y Lattice Y index.
+ * @param Z Lattice Z index.
+ * @return Position in shape-local space.
+ */
+FVector3f FKawaiiFluidSpawnPlan::GetLocalPosition(int32 X, int32 Y, int32 Z) const
+{
+	if (Descriptor.Shape == EKawaiiFluidSpawnShape::Hemisphere)
+	{
+		// Uniform direction on the upper hemisphere, radius uniform between the inner and outer shell
+		const FVector3f U = FKawaiiFluidSpawnRandom(Descriptor.JitterSeed, 0).Unit(X);
+		const float Radius = FMath::Lerp(static_cast<float>(Descriptor.Extent.Y), static_cast<float>(Descriptor.Extent.X), U.Z);
+		return FKawaiiFluidSpawnRandom::ToUnitVector(0.5f * U.X, U.Y) * Radius;
+	}
+
+	// ABC layer stacking (mod 3) and staggered rows (mod 2)
+	const int32 ZMod = (Z - ZBase) % 3;
+	const float LayerOffsetX = (ZMod == 1) ? Step.X * 0.5f : ((ZMod == 2) ? Step.X * 0.25f : 0.0f);
+	const float LayerOffsetY = (ZMod == 1) ? Step.Y / 3.0f : ((ZMod == 2) ? Step.Y * 2.0f / 3.0f : 0.0f);
+	const float RowOffsetX = (FMath::Abs(Y - YBase) % 2 == 1) ? Step.X * 0.5f : 0.0f;
+
+	return FVector3f(
+		Start.X + X * Step.X + RowOffsetX + LayerOffsetX,
+		Start.Y + Y * Step.Y + LayerOffsetY,
+		Start.Z + Z * Step.Z);
+}
+
+/**
+ * @brief Shape containment test of an unjittered local point.
+ * @param Local Position in shape-local space.
+ * @return True if the point belongs to the shape.
+ */
+bool FKawaiiFluidSpawnPlan::IsInside(const FVector3f& Local) const
+{
+	const FVector3f Extent(Descriptor.Extent);
+	const float RadiusSq = Extent.X * Extent.X;
+
+	switch (Descriptor.Shape)
+	{
+	case EKawaiiFluidSpawnShape::Sphere:
+		return Local.SizeSquared() <= RadiusSq;
+	case EKawaiiFluidSpawnShape::Box:
+		return FMath::Abs(Local.X) <= Extent.X && FMath::Abs(Local.Y) <= Extent.Y && FMath::Abs(Local.Z) <= Extent.Z;
+	case EKawaiiFluidSpawnShape::Cylinder:
+		return Local.X * Local.X + Local.Y * Local.Y <= RadiusSq && FMath::Abs(Local.Z) <= Extent.Z;
+	case EKawaiiFluidSpawnShape::Disc:
+		return Local.X * Local.X + Local.Y * Local.Y <= RadiusSq;
+	case EKawaiiFluidSpawnShape::Hemisphere:
+		return Local.Z >= 0.0f && Local.SizeSquared() <= RadiusSq && Local.SizeSquared() >= Extent.Y * Extent.Y;
+	}
+	return false;
+}
+
+/**
+ * @brief World position with jitter faded out toward the surface; mirrors SpawnLatticeWorld.
+ * @param Local Unjittered local position.
+ * @param X Lattice X index (jitter hash input).
+ * @param Y Lattice Y index.
+ * @param Z Lattice Z index.
+ * @return World position.
+ */
+FVector3f FKawaiiFluidSpawnPlan::GetWorldPosition(const FVector3f& Local, int32 X, int32 Y, int32 Z) const
+{
+	FVector3f Position = Local;
+	FVector3f WorldJitter = FVector3f::ZeroVector;
+
+	if (Descriptor.JitterRange > 0.0f)
+	{
+		const FVector3f Extent(Descriptor.Extent);
+		float Jitter = 0.0f;
+
+		switch (Descriptor.Shape)
+		{
+		case EKawaiiFluidSpawnShape::Sphere:
+			Jitter = Descriptor.JitterRange * FMath::Clamp(1.0f - Local.Size() / Extent.X, 0.0f, 1.0f);
+			break;
+		case EKawaiiFluidSpawnShape::Box:
+		{
+			const float MinDistToSurface = FMath::Min3(Extent.X - FMath::Abs(Local.X), Extent.Y - FMath::Abs(Local.Y), Extent.Z - FMath::Abs(Local.Z));
+			Jitter = Descriptor.JitterRange * FMath::Clamp(MinDistToSurface / FMath::Min3(Extent.X, Extent.Y, Extent.Z), 0.0f, 1.0f);
+			break;
+		}
+		case EKawaiiFluidSpawnShape::Cylinder:
+		{
+			const float MinDistToSurface = FMath::Min(Extent.X - FMath::Sqrt(Local.X * Local.X + Local.Y * Local.Y), Extent.Z - FMath::Abs(Local.Z));
+			Jitter = Descriptor.JitterRange * FMath::Clamp(MinDistToSurface / FMath::Min(Extent.X, Extent.Z), 0.0f, 1.0f);
+			break;
+		}
+		case EKawaiiFluidSpawnShape::Disc:
+			// In-plane jitter bounded by the distance to the rim, so no point leaves the disc
+			Jitter = FMath::Min(Descriptor.JitterRange, FMath::Max(Extent.X - FMath::Sqrt(Local.X * Local.X + Local.Y * Local.Y), 0.0f) * 0.70710678f);
+			break;
+		case EKawaiiFluidSpawnShape::Hemisphere:
+			// Samples are random already
+			break;
+		}
+
+		if (Jitter > 0.0f)
+		{
+			const FUintVector3 Hashed = KawaiiFluidSpawnLattice::Hash(X, Y, Z, Descriptor.JitterSeed);
+			const FVector3f Offset(
+				KawaiiFluidSpawnLattice::ToSignedUnit(Hashed.X) * Jitter,
+				KawaiiFluidSpawnLattice::ToSignedUnit(Hashed.Y) * Jitter,
+				KawaiiFluidSpawnLattice::ToSignedUnit(Hashed.Z) * Jitter);
+
+			if (Descriptor.Shape == EKawaiiFluidSpawnShape::Disc)
+			{
+				Position.X += Offset.X;
+				Position.Y += Offset.Y;
+			}
+			else
+			{
+				WorldJitter = Offset;
+			}
+		}
+	}
+
+	return FVector3f(Descriptor.Center) + AxisX * Position.X + AxisY * Position.Y + AxisZ * Position.Z + WorldJitter;
+}
+
+/**
+ * @brief World position of one particle of the plan.
+ * @param Index Particle index in [0, Num()).
+ * @return World position.
+ */
+FVector3f FKawaiiFluidSpawnPlan::GetPosition(int32 Index) const
+{
+	check(Index >= 0 && Index < Num());
+
+	// Last row whose Offset <= Index (the sentinel is excluded by Index < Num())
+	const int32 RowIndex = Algo::UpperBoundBy(Rows, Index, &FKawaiiFluidSpawnRow::Offset) - 1;
+	const FKawaiiFluidSpawnRow& Row = Rows[RowIndex];
+	const int32 X = Row.FirstX + (Index - Row.Offset);
+	return GetWorldPosition(GetLocalPosition(X, Row.Y, Row.Z), X, Row.Y, Row.Z);
+}
+
+/**
+ * @brief Expand every particle into spawn requests, one row per task.
+ * @param OutRequests Destination, exactly Num() entries.
+ */
+void FKawaiiFluidSpawnPlan::Expand(TArrayView<FGPUSpawnRequest> OutRequests) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidSpawnPlan_Expand);
+
+	check(OutRequests.Num() == Num());
+
+	const int32 NumRows = Rows.Num() - 1;
+	ParallelFor(NumRows, [this, OutRequests](int32 RowIndex)
+	{
+		const FKawaiiFluidSpawnRow& Row = Rows[RowIndex];
+		const int32 End = Rows[RowIndex + 1].Offset;
+		for (int32 Index = Row.Offset; Index < End; ++Index)
+		{
+			const int32 X = Row.FirstX + (Index - Row.Offset);
+
+			FGPUSpawnRequest& Request = OutRequests[Index];
+			Request = FGPUSpawnRequest();
+			Request.Position = GetWorldPosition(GetLocalPosition(X, Row.Y, Row.Z), X, Row.Y, Row.Z);
+			Request.Velocity = Descriptor.Velocity;
+			Request.Mass = Descriptor.Mass;
+			Request.SourceID = Descriptor.SourceID;
+		}
+	}, NumRows < 16 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+/**
+ * @brief Occupancy grid bounding the shape, at most MaxOccupancyDim cells per axis; mirrors SpawnOccupancyCell.
+ * @param OutMin World-space minimum corner.
+ * @param OutCellSize Cell edge length (>= MinSeparation).
+ * @param OutDim Cells per axis.
+ * @return True if the plan rejects overlaps.
+ */
+bool FKawaiiFluidSpawnPlan::GetOccupancyGrid(FVector3f& OutMin, float& OutCellSize, int32& OutDim) const
+{
+	if (Descriptor.MinSeparation <= 0.0f || IsEmpty())
+	{
+		return false;
+	}
+
+	// Bounding sphere of the (jittered) shape plus one cell, so border particles still count
+	const FVector3f Extent(Descriptor.Extent);
+	const bool bBoxLike = Descriptor.Shape == EKawaiiFluidSpawnShape::Box || Descriptor.Shape == EKawaiiFluidSpawnShape::Cylinder;
+	const float BoundRadius = (bBoxLike ? Extent.Size() : Extent.X) + Descriptor.JitterRange + Descriptor.MinSeparation;
+
+	OutDim = FMath::Clamp(FMath::CeilToInt(2.0f * BoundRadius / Descriptor.MinSeparation), 1, MaxOccupancyDim);
+	OutCellSize = FMath::Max(Descriptor.MinSeparation, 2.0f * BoundRadius / OutDim);
+	OutMin = FVector3f(Descriptor.Center) - FVector3f(BoundRadius);
+	return true;
+}
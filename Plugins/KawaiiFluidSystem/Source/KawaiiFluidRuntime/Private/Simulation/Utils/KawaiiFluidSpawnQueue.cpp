@@ -0,0 +1,379 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidSpawnQueue.h"
+#include "HAL/PlatformTLS.h"
+
+namespace
+{
+	/**
+	 * @struct FSpawnQueueSlotCache
+	 * @brief Last slot this thread used, so repeated enqueues skip the slot probe.
+	 *
+	 * The cached index is only trusted after checking that the slot's owner is still this thread,
+	 * which keeps it valid when a queue is destroyed and another one reuses its address.
+	 */
+	struct FSpawnQueueSlotCache
+	{
+		const void* Queue = nullptr;
+		int32 SlotIndex = INDEX_NONE;
+	};
+
+	thread_local FSpawnQueueSlotCache GSpawnQueueSlotCache;
+
+	uint64 GetCurrentProducerKey()
+	{
+		return static_cast<uint64>(FPlatformTLS::GetCurrentThreadId()) + 1;
+	}
+}
+
+FKawaiiFluidSpawnQueue::FKawaiiFluidSpawnQueue() = default;
+
+FKawaiiFluidSpawnQueue::~FKawaiiFluidSpawnQueue()
+{
+	for (FProducerSlot& Slot : Slots)
+	{
+		DeleteChain(Slot.Head ? Slot.Head : Slot.FirstChunk.load(std::memory_order_acquire));
+		DeleteChain(Slot.FreeChunks);
+		DeleteChain(Slot.ReturnedChunks.load(std::memory_order_acquire));
+		DeleteChain(Slot.RetiredChunks);
+	}
+	DeleteChain(OverflowChunks.load(std::memory_order_acquire));
+}
+
+//=============================================================================
+// Producer API
+//=============================================================================
+
+/**
+ * @brief Append one request from the calling thread.
+ * @param Request Spawn request.
+ */
+void FKawaiiFluidSpawnQueue::Enqueue(const FGPUSpawnRequest& Request)
+{
+	if (FProducerSlot* Slot = FindOrClaimSlot())
+	{
+		AppendToSlot(*Slot, &Request, 1);
+	}
+	else
+	{
+		AppendToOverflow(&Request, 1);
+	}
+}
+
+/**
+ * @brief Append a batch of requests from the calling thread; consumers see them in order.
+ * @param Requests Spawn requests.
+ */
+void FKawaiiFluidSpawnQueue::Enqueue(TConstArrayView<FGPUSpawnRequest> Requests)
+{
+	if (Requests.Num() == 0)
+	{
+		return;
+	}
+
+	if (FProducerSlot* Slot = FindOrClaimSlot())
+	{
+		AppendToSlot(*Slot, Requests.GetData(), Requests.Num());
+	}
+	else
+	{
+		AppendToOverflow(Requests.GetData(), Requests.Num());
+	}
+}
+
+/**
+ * @brief Find the calling thread's slot, claiming a free one on first use.
+ * @return Slot owned by this thread, or nullptr when every slot belongs to another thread.
+ */
+FKawaiiFluidSpawnQueue::FProducerSlot* FKawaiiFluidSpawnQueue::FindOrClaimSlot()
+{
+	const uint64 Key = GetCurrentProducerKey();
+
+	FSpawnQueueSlotCache& Cache = GSpawnQueueSlotCache;
+	if (Cache.Queue == this && Slots[Cache.SlotIndex].OwnerKey.load(std::memory_order_relaxed) == Key)
+	{
+		return &Slots[Cache.SlotIndex];
+	}
+
+	// Slots only ever go from unclaimed to owned, so probing in a fixed order always reaches
+	// this thread's slot before any free one
+	const int32 Start = static_cast<int32>((Key * 2654435761ull) % MaxProducers);
+	for (int32 Probe = 0; Probe < MaxProducers; ++Probe)
+	{
+		const int32 SlotIndex = (Start + Probe) % MaxProducers;
+		FProducerSlot& Slot = Slots[SlotIndex];
+
+		uint64 Owner = Slot.OwnerKey.load(std::memory_order_acquire);
+		if (Owner == 0 && Slot.OwnerKey.compare_exchange_strong(Owner, Key, std::memory_order_acq_rel))
+		{
+			Slot.Tail = new FChunk();
+			Slot.FirstChunk.store(Slot.Tail, std::memory_order_release);
+			Owner = Key;
+		}
+
+		if (Owner == Key)
+		{
+			Cache.Queue = this;
+			Cache.SlotIndex = SlotIndex;
+			return &Slot;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * @brief Copy requests into the slot's tail chunk, opening new chunks as they fill.
+ * @param Slot Slot owned by the calling thread.
+ * @param Requests First request.
+ * @param Count Number of requests.
+ */
+void FKawaiiFluidSpawnQueue::AppendToSlot(FProducerSlot& Slot, const FGPUSpawnRequest* Requests, int32 Count)
+{
+	FChunk* Chunk = Slot.Tail;
+	int32 Committed = Chunk->Committed.load(std::memory_order_relaxed);
+	int32 Written = 0;
+
+	while (Written < Count)
+	{
+		if (Committed == ChunkCapacity)
+		{
+			// The consumer only frees a full chunk once Next is set, so the old tail is never touched again
+			FChunk* NewChunk = AcquireChunk(Slot);
+			Chunk->Next.store(NewChunk, std::memory_order_release);
+			Slot.Tail = Chunk = NewChunk;
+			Committed = 0;
+		}
+
+		const int32 CopyCount = FMath::Min(Count - Written, ChunkCapacity - Committed);
+		FMemory::Memcpy(&Chunk->Requests[Committed], Requests + Written, CopyCount * sizeof(FGPUSpawnRequest));
+		Committed += CopyCount;
+		Written += CopyCount;
+		Chunk->Committed.store(Committed, std::memory_order_release);
+	}
+
+	Slot.Enqueued.store(Slot.Enqueued.load(std::memory_order_relaxed) + Count, std::memory_order_release);
+}
+
+/**
+ * @brief Publish requests as standalone chunks on the shared overflow list.
+ * @param Requests First request.
+ * @param Count Number of requests.
+ */
+void FKawaiiFluidSpawnQueue::AppendToOverflow(const FGPUSpawnRequest* Requests, int32 Count)
+{
+	// Chunks are linked newest-first, like the list itself, so reversing the drained list restores push order
+	FChunk* First = nullptr;
+	FChunk* Last = nullptr;
+	for (int32 Offset = 0; Offset < Count; Offset += ChunkCapacity)
+	{
+		const int32 CopyCount = FMath::Min(Count - Offset, ChunkCapacity);
+		FChunk* Chunk = new FChunk();
+		FMemory::Memcpy(Chunk->Requests, Requests + Offset, CopyCount * sizeof(FGPUSpawnRequest));
+		Chunk->Committed.store(CopyCount, std::memory_order_relaxed);
+		Chunk->Next.store(First, std::memory_order_relaxed);
+		Last = Last ? Last : Chunk;
+		First = Chunk;
+	}
+
+	OverflowEnqueued.fetch_add(Count, std::memory_order_relaxed);
+
+	FChunk* Head = OverflowChunks.load(std::memory_order_relaxed);
+	do
+	{
+		Last->Next.store(Head, std::memory_order_relaxed);
+	}
+	while (!OverflowChunks.compare_exchange_weak(Head, First, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * @brief Take a recycled chunk from the slot, or allocate one.
+ * @param Slot Slot owned by the calling thread.
+ * @return Empty, unlinked chunk.
+ */
+FKawaiiFluidSpawnQueue::FChunk* FKawaiiFluidSpawnQueue::AcquireChunk(FProducerSlot& Slot)
+{
+	if (!Slot.FreeChunks)
+	{
+		Slot.FreeChunks = Slot.ReturnedChunks.exchange(nullptr, std::memory_order_acquire);
+	}
+
+	FChunk* Chunk = Slot.FreeChunks;
+	if (!Chunk)
+	{
+		return new FChunk();
+	}
+
+	Slot.FreeChunks = Chunk->Next.load(std::memory_order_relaxed);
+	Chunk->Committed.store(0, std::memory_order_relaxed);
+	Chunk->Next.store(nullptr, std::memory_order_relaxed);
+	return Chunk;
+}
+
+//=============================================================================
+// Consumer API
+//=============================================================================
+
+/**
+ * @brief Hand every committed range to Consume, slot by slot, then the overflow list.
+ * @param Consume Called with (const FGPUSpawnRequest* Requests, int32 Count).
+ * @return Number of requests consumed.
+ */
+template <typename ConsumeFn>
+int32 FKawaiiFluidSpawnQueue::ConsumeAll(ConsumeFn&& Consume)
+{
+	int32 Total = 0;
+
+	for (FProducerSlot& Slot : Slots)
+	{
+		if (!Slot.Head)
+		{
+			Slot.Head = Slot.FirstChunk.load(std::memory_order_acquire);
+			if (!Slot.Head)
+			{
+				continue;
+			}
+		}
+
+		int32 SlotCount = 0;
+		FChunk* Chunk = Slot.Head;
+		while (true)
+		{
+			const int32 Committed = Chunk->Committed.load(std::memory_order_acquire);
+			if (Committed > Slot.ReadIndex)
+			{
+				Consume(&Chunk->Requests[Slot.ReadIndex], Committed - Slot.ReadIndex);
+				SlotCount += Committed - Slot.ReadIndex;
+				Slot.ReadIndex = Committed;
+			}
+
+			if (Committed < ChunkCapacity)
+			{
+				break;
+			}
+
+			// A full chunk without a successor is still the producer's tail
+			FChunk* Next = Chunk->Next.load(std::memory_order_acquire);
+			if (!Next)
+			{
+				break;
+			}
+
+			Chunk->Next.store(Slot.RetiredChunks, std::memory_order_relaxed);
+			Slot.RetiredChunks = Chunk;
+			Chunk = Next;
+			Slot.ReadIndex = 0;
+		}
+		Slot.Head = Chunk;
+
+		// Only the consumer stores a non-null list, and only while the producer has taken the previous one
+		if (Slot.RetiredChunks && Slot.ReturnedChunks.load(std::memory_order_acquire) == nullptr)
+		{
+			Slot.ReturnedChunks.store(Slot.RetiredChunks, std::memory_order_release);
+			Slot.RetiredChunks = nullptr;
+		}
+
+		if (SlotCount > 0)
+		{
+			Slot.Dequeued.store(Slot.Dequeued.load(std::memory_order_relaxed) + SlotCount, std::memory_order_release);
+			Total += SlotCount;
+		}
+	}
+
+	if (FChunk* Overflow = OverflowChunks.exchange(nullptr, std::memory_order_acquire))
+	{
+		TArray<FChunk*, TInlineAllocator<16>> Chunks;
+		for (FChunk* Chunk = Overflow; Chunk; Chunk = Chunk->Next.load(std::memory_order_relaxed))
+		{
+			Chunks.Add(Chunk);
+		}
+
+		int32 OverflowCount = 0;
+		for (int32 i = Chunks.Num() - 1; i >= 0; --i)
+		{
+			const int32 Committed = Chunks[i]->Committed.load(std::memory_order_relaxed);
+			Consume(Chunks[i]->Requests, Committed);
+			OverflowCount += Committed;
+			delete Chunks[i];
+		}
+
+		OverflowDequeued.fetch_add(OverflowCount, std::memory_order_release);
+		Total += OverflowCount;
+	}
+
+	return Total;
+}
+
+/**
+ * @brief Move every committed request to the end of OutRequests.
+ * @param OutRequests Receives the requests, grouped by producer.
+ * @return Number of requests appended.
+ */
+int32 FKawaiiFluidSpawnQueue::DrainTo(TArray<FGPUSpawnRequest>& OutRequests)
+{
+	OutRequests.Reserve(OutRequests.Num() + Num());
+	return ConsumeAll([&OutRequests](const FGPUSpawnRequest* Requests, int32 Count)
+	{
+		OutRequests.Append(Requests, Count);
+	});
+}
+
+/**
+ * @brief Drop every committed request.
+ * @return Number of requests dropped.
+ */
+int32 FKawaiiFluidSpawnQueue::Discard()
+{
+	return ConsumeAll([](const FGPUSpawnRequest*, int32) {});
+}
+
+//=============================================================================
+// Queries
+//=============================================================================
+
+/**
+ * @brief Requests enqueued and not yet consumed.
+ * @return Pending request count.
+ */
+int32 FKawaiiFluidSpawnQueue::Num() const
+{
+	int64 Pending = OverflowEnqueued.load(std::memory_order_acquire) - OverflowDequeued.load(std::memory_order_acquire);
+	for (const FProducerSlot& Slot : Slots)
+	{
+		if (Slot.OwnerKey.load(std::memory_order_relaxed) != 0)
+		{
+			Pending += Slot.Enqueued.load(std::memory_order_acquire) - Slot.Dequeued.load(std::memory_order_acquire);
+		}
+	}
+
+	// A consumer can count requests whose producer has not yet bumped Enqueued
+	return static_cast<int32>(FMath::Clamp<int64>(Pending, 0, MAX_int32));
+}
+
+/**
+ * @brief Number of threads that have claimed a producer slot.
+ * @return Claimed slot count.
+ */
+int32 FKawaiiFluidSpawnQueue::GetNumProducers() const
+{
+	int32 Count = 0;
+	for (const FProducerSlot& Slot : Slots)
+	{
+		Count += Slot.OwnerKey.load(std::memory_order_relaxed) != 0 ? 1 : 0;
+	}
+	return Count;
+}
+
+/**
+ * @brief Delete a chunk list linked through Next.
+ * @param Chunk First chunk, may be nullptr.
+ */
+void FKawaiiFluidSpawnQueue::DeleteChain(FChunk* Chunk)
+{
+	while (Chunk)
+	{
+		FChunk* Next = Chunk->Next.load(std::memory_order_relaxed);
+		delete Chunk;
+		Chunk = Next;
+	}
+}
@@ -0,0 +1,347 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/Physics/KawaiiFluidAnisotropySolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_EigenDecomposition,
+	"KawaiiFluid.Physics.Anisotropy.AN01_EigenDecomposition",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_DensityShapes,
+	"KawaiiFluid.Physics.Anisotropy.AN02_DensityShapes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_VelocityStretch,
+	"KawaiiFluid.Physics.Anisotropy.AN03_VelocityStretch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_UpdateCadence,
+	"KawaiiFluid.Physics.Anisotropy.AN04_UpdateCadence",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_Anisotropy,
+	"KawaiiFluid.Benchmark.Anisotropy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/** @brief Helper: Symmetric matrix R * diag(Values) * R^T. */
+	FKawaiiFluidSymmetric3x3 MakeSymmetric(const FQuat4f& Rotation, const FVector3f& Values)
+	{
+		const FVector3f Axes[3] = { Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ() };
+		FKawaiiFluidSymmetric3x3 M;
+		for (int32 k = 0; k < 3; ++k)
+		{
+			const FVector3f& A = Axes[k];
+			M.XX += Values[k] * A.X * A.X;
+			M.XY += Values[k] * A.X * A.Y;
+			M.XZ += Values[k] * A.X * A.Z;
+			M.YY += Values[k] * A.Y * A.Y;
+			M.YZ += Values[k] * A.Y * A.Z;
+			M.ZZ += Values[k] * A.Z * A.Z;
+		}
+		return M;
+	}
+
+	/**
+	 * @brief Helper: Largest residual |M v - lambda v| relative to the spectral radius.
+	 * @param M Matrix.
+	 * @param Values Eigenvalues.
+	 * @param V0 Eigenvectors, likewise V1/V2.
+	 * @return Relative residual.
+	 */
+	float GetEigenResidual(const FKawaiiFluidSymmetric3x3& M, const FVector3f& Values, const FVector3f& V0, const FVector3f& V1, const FVector3f& V2)
+	{
+		const FVector3f Vecs[3] = { V0, V1, V2 };
+		const float Scale = FMath::Max(FMath::Max3(FMath::Abs(Values.X), FMath::Abs(Values.Y), FMath::Abs(Values.Z)), UE_SMALL_NUMBER);
+		float Residual = 0.0f;
+		for (int32 k = 0; k < 3; ++k)
+		{
+			Residual = FMath::Max(Residual, (M.Multiply(Vecs[k]) - Values[k] * Vecs[k]).Size() / Scale);
+		}
+		return Residual;
+	}
+
+	/**
+	 * @brief Helper: Jittered lattice of particles.
+	 * @param Count Particles per axis.
+	 * @param Spacing Lattice spacing (cm).
+	 * @param Jitter Random offset per particle (cm).
+	 * @param Seed Random seed.
+	 * @return Particle positions.
+	 */
+	TArray<FVector3f> MakeLattice(const FIntVector& Count, float Spacing, float Jitter, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector3f> Positions;
+		Positions.Reserve(Count.X * Count.Y * Count.Z);
+		for (int32 Z = 0; Z < Count.Z; ++Z)
+		{
+			for (int32 Y = 0; Y < Count.Y; ++Y)
+			{
+				for (int32 X = 0; X < Count.X; ++X)
+				{
+					Positions.Add(FVector3f(X, Y, Z) * Spacing + FVector3f(Random.VRand()) * Jitter);
+				}
+			}
+		}
+		return Positions;
+	}
+
+	/** @brief Helper: Enabled parameters of a mode, without temporal smoothing. */
+	FKawaiiFluidAnisotropyParams MakeParams(EKawaiiFluidAnisotropyMode Mode)
+	{
+		FKawaiiFluidAnisotropyParams Params;
+		Params.bEnabled = true;
+		Params.Mode = Mode;
+		Params.bEnableTemporalSmoothing = false;
+		return Params;
+	}
+}
+
+/** @brief AN-01: Eigen-decomposition: random SPD matrices, repeated eigenvalues and diagonal input. */
+bool FKawaiiFluidAnisotropyTest_EigenDecomposition::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(39);
+	float MaxResidual = 0.0f;
+	bool bOrderedAndOrthonormal = true;
+
+	for (int32 i = 0; i < 20000; ++i)
+	{
+		FQuat4f Rotation(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f));
+		Rotation.Normalize();
+
+		// Covariance-like spectra: well separated, two equal, or nearly flat
+		FVector3f Values(Random.FRandRange(0.5f, 10.0f), Random.FRandRange(0.5f, 10.0f), Random.FRandRange(0.0f, 0.5f));
+		if (i % 3 == 1)
+		{
+			Values.Y = Values.X;
+		}
+		else if (i % 3 == 2)
+		{
+			Values.Z = 0.0f;
+		}
+
+		const FKawaiiFluidSymmetric3x3 M = MakeSymmetric(Rotation, Values);
+		FVector3f OutValues, V0, V1, V2;
+		KawaiiFluidAnisotropyMath::SymmetricEigen3x3(M, OutValues, V0, V1, V2);
+
+		MaxResidual = FMath::Max(MaxResidual, GetEigenResidual(M, OutValues, V0, V1, V2));
+		bOrderedAndOrthonormal &= OutValues.X >= OutValues.Y - 1e-4f && OutValues.Y >= OutValues.Z - 1e-4f;
+		bOrderedAndOrthonormal &= FMath::IsNearlyEqual(V0.Size(), 1.0f, 1e-4f) && FMath::IsNearlyEqual(V1.Size(), 1.0f, 1e-4f);
+		bOrderedAndOrthonormal &= FMath::Abs(FVector3f::DotProduct(V0, V1)) < 1e-3f;
+		bOrderedAndOrthonormal &= FVector3f::DotProduct(FVector3f::CrossProduct(V0, V1), V2) > 0.999f;
+	}
+	AddInfo(FString::Printf(TEXT("Max relative residual %.2e"), MaxResidual));
+	TestTrue(TEXT("M v = lambda v within 1e-3"), MaxResidual < 1e-3f);
+	TestTrue(TEXT("Eigenvalues descending, eigenvectors right-handed orthonormal"), bOrderedAndOrthonormal);
+
+	FKawaiiFluidSymmetric3x3 Diagonal;
+	Diagonal.XX = 1.0f;
+	Diagonal.YY = 5.0f;
+	Diagonal.ZZ = 3.0f;
+	FVector3f OutValues, V0, V1, V2;
+	KawaiiFluidAnisotropyMath::SymmetricEigen3x3(Diagonal, OutValues, V0, V1, V2);
+	TestTrue(TEXT("Diagonal input sorts its entries"), OutValues.Equals(FVector3f(5.0f, 3.0f, 1.0f))
+		&& V0.Equals(FVector3f(0.0f, 1.0f, 0.0f)) && V1.Equals(FVector3f(0.0f, 0.0f, 1.0f)) && V2.Equals(FVector3f(1.0f, 0.0f, 0.0f)));
+
+	return true;
+}
+
+/** @brief AN-02: Density mode flattens a sheet along its normal, keeps blobs unit-volume and isolated particles spherical. */
+bool FKawaiiFluidAnisotropyTest_DensityShapes::RunTest(const FString& Parameters)
+{
+	constexpr float Spacing = 1.0f;
+	constexpr float SmoothingRadius = 2.5f;
+
+	// 21x21 sheet tilted so the normal is not a grid axis
+	const FQuat4f Tilt(FVector3f(1.0f, 1.0f, 0.0f).GetSafeNormal(), FMath::DegreesToRadians(30.0f));
+	TArray<FVector3f> Sheet = MakeLattice(FIntVector(21, 21, 1), Spacing, 0.02f, 1);
+	for (FVector3f& Position : Sheet)
+	{
+		Position = Tilt.RotateVector(Position);
+	}
+	const FVector3f SheetNormal = Tilt.RotateVector(FVector3f(0.0f, 0.0f, 1.0f));
+
+	FKawaiiFluidAnisotropyParams Params = MakeParams(EKawaiiFluidAnisotropyMode::DensityBased);
+	FKawaiiFluidAnisotropySolver Solver;
+	Solver.Compute(Sheet, TConstArrayView<FVector3f>(), Params, SmoothingRadius);
+
+	const int32 Center = 10 * 21 + 10;
+	const FVector4f Thin = Solver.GetAxis3()[Center];
+	TestTrue(TEXT("Shortest axis follows the sheet normal"), FMath::Abs(FVector3f::DotProduct(FVector3f(Thin), SheetNormal)) > 0.99f);
+	TestTrue(TEXT("Sheet is flattened"), Thin.W < Solver.GetAxis1()[Center].W * 0.5f);
+	TestTrue(TEXT("Volume preserved"), FMath::IsNearlyEqual(Solver.GetAxis1()[Center].W * Solver.GetAxis2()[Center].W * Thin.W, 1.0f, 0.02f));
+
+	// Isolated particles stay spheres
+	const TArray<FVector3f> Sparse = MakeLattice(FIntVector(4, 4, 4), SmoothingRadius * 2.0f, 0.0f, 2);
+	Solver.Compute(Sparse, TConstArrayView<FVector3f>(), Params, SmoothingRadius);
+	bool bSpheres = true;
+	for (int32 i = 0; i < Sparse.Num(); ++i)
+	{
+		bSpheres &= Solver.GetAxis1()[i].W == 1.0f && Solver.GetAxis2()[i].W == 1.0f && Solver.GetAxis3()[i].W == 1.0f;
+	}
+	TestTrue(TEXT("Isolated particles are spheres"), bSpheres);
+
+	// Non-preserved (FleX) scales stay inside the stretch limits
+	Params.bPreserveVolume = false;
+	Solver.Compute(Sheet, TConstArrayView<FVector3f>(), Params, SmoothingRadius);
+	bool bClamped = true;
+	for (int32 i = 0; i < Sheet.Num(); ++i)
+	{
+		for (const FVector4f& Axis : { Solver.GetAxis1()[i], Solver.GetAxis2()[i], Solver.GetAxis3()[i] })
+		{
+			bClamped &= Axis.W >= Params.MinStretch - 1e-5f && Axis.W <= Params.MaxStretch + 1e-5f;
+		}
+	}
+	TestTrue(TEXT("Non-preserved scales within [MinStretch, MaxStretch]"), bClamped);
+
+	return true;
+}
+
+/** @brief AN-03: Velocity mode stretches along the velocity; hybrid picks axes by DensityWeight. */
+bool FKawaiiFluidAnisotropyTest_VelocityStretch::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropyParams Params = MakeParams(EKawaiiFluidAnisotropyMode::VelocityBased);
+	Params.VelocityStretchFactor = 0.01f;
+
+	const FVector3f Velocity(0.0f, 30.0f, -40.0f);
+	FKawaiiFluidEllipsoid Ellipsoid = KawaiiFluidAnisotropyMath::CalculateVelocityBased(Velocity, Params);
+	TestTrue(TEXT("First axis along the velocity"), Ellipsoid.Axis1.Equals(Velocity.GetSafeNormal(), 1e-5f));
+	TestTrue(TEXT("Stretched along the velocity"), Ellipsoid.Scales.X > 1.0f && Ellipsoid.Scales.Y < 1.0f);
+	TestTrue(TEXT("Volume preserved"), FMath::IsNearlyEqual(Ellipsoid.Scales.X * Ellipsoid.Scales.Y * Ellipsoid.Scales.Z, 1.0f, 1e-4f));
+	TestTrue(TEXT("Basis orthonormal"), FMath::Abs(FVector3f::DotProduct(Ellipsoid.Axis1, Ellipsoid.Axis2)) < 1e-5f
+		&& FMath::Abs(FVector3f::DotProduct(Ellipsoid.Axis2, Ellipsoid.Axis3)) < 1e-5f);
+
+	Ellipsoid = KawaiiFluidAnisotropyMath::CalculateVelocityBased(FVector3f::ZeroVector, Params);
+	TestTrue(TEXT("At rest: sphere"), Ellipsoid.Scales.Equals(FVector3f::OneVector));
+
+	Params.bPreserveVolume = false;
+	Params.NonPreservedRenderScale = 1.5f;
+	Ellipsoid = KawaiiFluidAnisotropyMath::CalculateVelocityBased(FVector3f(1.0e5f, 0.0f, 0.0f), Params);
+	TestTrue(TEXT("Non-preserved stretch clamps to MaxStretch"), FMath::IsNearlyEqual(Ellipsoid.Scales.X, Params.MaxStretch)
+		&& FMath::IsNearlyEqual(Ellipsoid.Scales.Y, 1.5f));
+
+	// Hybrid axis selection
+	FKawaiiFluidEllipsoid Density;
+	Density.Axis1 = FVector3f(0.0f, 0.0f, 1.0f);
+	Density.Scales = FVector3f(2.0f, 1.0f, 0.5f);
+	FKawaiiFluidEllipsoid Moving = KawaiiFluidAnisotropyMath::CalculateVelocityBased(Velocity, MakeParams(EKawaiiFluidAnisotropyMode::VelocityBased));
+
+	Params = MakeParams(EKawaiiFluidAnisotropyMode::Hybrid);
+	Params.DensityWeight = 0.8f;
+	TestTrue(TEXT("Density-weighted hybrid keeps density axes"), KawaiiFluidAnisotropyMath::BlendHybrid(Density, Moving, Params).Axis1.Equals(Density.Axis1));
+	Params.DensityWeight = 0.2f;
+	TestTrue(TEXT("Velocity-weighted hybrid keeps velocity axes"), KawaiiFluidAnisotropyMath::BlendHybrid(Density, Moving, Params).Axis1.Equals(Moving.Axis1));
+
+	return true;
+}
+
+/** @brief AN-04: UpdateInterval cadence, forced recompute on count change, temporal smoothing and disable. */
+bool FKawaiiFluidAnisotropyTest_UpdateCadence::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropyParams Params = MakeParams(EKawaiiFluidAnisotropyMode::VelocityBased);
+	Params.UpdateInterval = 3;
+	Params.VelocityStretchFactor = 0.002f;
+
+	TArray<FVector3f> Positions = MakeLattice(FIntVector(4, 4, 4), 1.0f, 0.0f, 3);
+	TArray<FVector3f> Velocities;
+	Velocities.Init(FVector3f(100.0f, 0.0f, 0.0f), Positions.Num());
+
+	FKawaiiFluidAnisotropySolver Solver;
+	TArray<bool> Updated;
+	for (int32 Frame = 0; Frame < 7; ++Frame)
+	{
+		Updated.Add(Solver.Update(Positions, Velocities, Params, 2.5f));
+	}
+	TestTrue(TEXT("Recompute on frames 0, 3, 6"), Updated == TArray<bool>({ true, false, false, true, false, false, true }));
+
+	Positions.Pop();
+	Velocities.Pop();
+	TestTrue(TEXT("Particle count change forces a recompute"), Solver.Update(Positions, Velocities, Params, 2.5f));
+	TestEqual(TEXT("Result resized"), Solver.Num(), Positions.Num());
+
+	// Smoothing moves the previous result toward the new one without reaching it
+	Params.UpdateInterval = 1;
+	Params.bEnableTemporalSmoothing = true;
+	Params.TemporalSmoothFactor = 0.5f;
+	const float PreviousScale = Solver.GetAxis1()[0].W;
+	Velocities.Init(FVector3f(0.0f, 0.0f, 200.0f), Positions.Num());
+	Solver.Update(Positions, Velocities, Params, 2.5f);
+	const float TargetScale = KawaiiFluidAnisotropyMath::CalculateVelocityBased(Velocities[0], Params).Scales.X;
+	const float SmoothedScale = Solver.GetAxis1()[0].W;
+	TestTrue(TEXT("Smoothed scale lies between previous and target"), SmoothedScale > PreviousScale && SmoothedScale < TargetScale);
+
+	Params.bEnabled = false;
+	Solver.Update(Positions, Velocities, Params, 2.5f);
+	TestFalse(TEXT("Disabling drops the result"), Solver.HasResult());
+
+	return true;
+}
+
+/**
+ * @brief Anisotropy Benchmark.
+ * Throughput of the eigen-decomposition alone and of the full density / hybrid stages over a 64k particle block.
+ */
+bool FKawaiiFluidBenchmark_Anisotropy::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumIterations = 5;
+
+	// Eigen-decomposition alone
+	FRandomStream Random(7);
+	TArray<FKawaiiFluidSymmetric3x3> Matrices;
+	for (int32 i = 0; i < 1000000; ++i)
+	{
+		FQuat4f Rotation(Random.FRand(), Random.FRand(), Random.FRand(), Random.FRand());
+		Rotation.Normalize();
+		Matrices.Add(MakeSymmetric(Rotation, FVector3f(Random.FRandRange(1.0f, 4.0f), Random.FRandRange(0.5f, 1.0f), Random.FRandRange(0.0f, 0.5f))));
+	}
+
+	double StartTime = FPlatformTime::Seconds();
+	float Checksum = 0.0f;
+	for (const FKawaiiFluidSymmetric3x3& M : Matrices)
+	{
+		FVector3f Values, V0, V1, V2;
+		KawaiiFluidAnisotropyMath::SymmetricEigen3x3(M, Values, V0, V1, V2);
+		Checksum += Values.X + V2.Z;
+	}
+	const double EigenMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	AddInfo(FString::Printf(TEXT("Eigen3x3: %d matrices in %.2f ms (%.1f M/s, single thread, checksum %.1f)"),
+		Matrices.Num(), EigenMs, Matrices.Num() / (EigenMs * 1000.0), Checksum));
+
+	// Full stage: 40^3 block at rest spacing, smoothing radius = 2 spacings (~30 neighbors)
+	const TArray<FVector3f> Positions = MakeLattice(FIntVector(40, 40, 40), 1.0f, 0.1f, 8);
+	TArray<FVector3f> Velocities;
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		Velocities.Add(FVector3f(Random.VRand()) * 100.0f);
+	}
+
+	FKawaiiFluidAnisotropySolver Solver;
+	for (const EKawaiiFluidAnisotropyMode Mode : { EKawaiiFluidAnisotropyMode::VelocityBased, EKawaiiFluidAnisotropyMode::DensityBased, EKawaiiFluidAnisotropyMode::Hybrid })
+	{
+		const FKawaiiFluidAnisotropyParams Params = MakeParams(Mode);
+		Solver.Compute(Positions, Velocities, Params, 2.0f);
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Solver.Compute(Positions, Velocities, Params, 2.0f);
+		}
+		const double StageMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumIterations;
+
+		AddInfo(FString::Printf(TEXT("%s: %d particles in %.2f ms (%.2f M particles/s)"),
+			*UEnum::GetValueAsString(Mode), Positions.Num(), StageMs, Positions.Num() / (StageMs * 1000.0)));
+	}
+
+	TestEqual(TEXT("Every particle has a result"), Solver.Num(), Positions.Num());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
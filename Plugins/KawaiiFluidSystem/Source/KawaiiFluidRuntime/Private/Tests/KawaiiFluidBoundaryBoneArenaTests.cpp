@@ -0,0 +1,253 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Simulation/Resources/GPUBoundaryBoneArena.h"
+#include "Simulation/Managers/GPUBoundarySkinningManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBoundaryBoneArenaTest_DeltaWrite,
+	"KawaiiFluid.Simulation.BoundaryBoneArena.BA01_DeltaWrite",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBoundaryBoneArenaTest_CopyOnWrite,
+	"KawaiiFluid.Simulation.BoundaryBoneArena.BA02_CopyOnWrite",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBoundaryBoneArenaTest_Crowd,
+	"KawaiiFluid.Simulation.BoundaryBoneArena.BA03_Crowd",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBoundaryBoneArenaTest_SnapshotCatchUp,
+	"KawaiiFluid.Simulation.BoundaryBoneArena.BA04_SnapshotCatchUp",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	const float TestPositionTolerance = 0.01f;
+	const float TestRotationTolerance = 0.0001f;
+
+	/**
+	 * @brief Helper: Bones of one owner, each at a distinct position.
+	 * @param OwnerID Owner the bones belong to (encoded in X).
+	 * @param Count Number of bones.
+	 * @param Height Z of every bone (animate by changing it).
+	 * @return Bone transforms.
+	 */
+	TArray<FGPUBoundaryBoneTransform> MakeBones(int32 OwnerID, int32 Count, float Height = 0.0f)
+	{
+		TArray<FGPUBoundaryBoneTransform> Bones;
+		for (int32 BoneIndex = 0; BoneIndex < Count; ++BoneIndex)
+		{
+			Bones.Add(FGPUBoundaryBoneTransform(FTransform(
+				FRotator(0.0, 10.0 * BoneIndex, 0.0),
+				FVector(100.0 * OwnerID, 10.0 * BoneIndex, Height))));
+		}
+		return Bones;
+	}
+
+	/**
+	 * @brief Helper: Total number of bones covered by dirty ranges.
+	 * @param Ranges Dirty ranges.
+	 * @return Bone count.
+	 */
+	int32 CountDirtyBones(const TArray<FGPUBoundaryBoneRange>& Ranges)
+	{
+		int32 Count = 0;
+		for (const FGPUBoundaryBoneRange& Range : Ranges)
+		{
+			Count += Range.Num;
+		}
+		return Count;
+	}
+}
+
+/**
+ * @brief BA-01: Writes within tolerance dirty nothing, moving one bone dirties only that bone, and the compact
+ * format rebuilds the same matrix as FTransform.
+ */
+bool FKawaiiFluidBoundaryBoneArenaTest_DeltaWrite::RunTest(const FString& Parameters)
+{
+	FGPUBoundaryBoneArena Arena;
+	TArray<FGPUBoundaryBoneTransform> Bones = MakeBones(1, 4);
+
+	TestTrue(TEXT("New owner written"), Arena.WriteOwner(1, Bones, FMatrix44f::Identity, TestPositionTolerance, TestRotationTolerance));
+	const FGPUBoundaryBoneArenaSnapshot First = Arena.TakeSnapshot();
+	TestEqual(TEXT("New owner dirties all its bones"), CountDirtyBones(First.DirtyRanges), 4);
+
+	// Sub-tolerance jitter is ignored
+	for (FGPUBoundaryBoneTransform& Bone : Bones)
+	{
+		Bone.Translation.X += 0.001f;
+	}
+	TestFalse(TEXT("Jitter ignored"), Arena.WriteOwner(1, Bones, FMatrix44f::Identity, TestPositionTolerance, TestRotationTolerance));
+	TestEqual(TEXT("Resting owner has no dirty range"), Arena.TakeSnapshot().DirtyRanges.Num(), 0);
+
+	Bones[2].Translation.Z += 5.0f;
+	TestTrue(TEXT("Moved bone written"), Arena.WriteOwner(1, Bones, FMatrix44f::Identity, TestPositionTolerance, TestRotationTolerance));
+	const FGPUBoundaryBoneArenaSnapshot Moved = Arena.TakeSnapshot();
+	TestEqual(TEXT("One dirty range"), Moved.DirtyRanges.Num(), 1);
+	if (Moved.DirtyRanges.Num() == 1)
+	{
+		TestEqual(TEXT("Dirty range starts at the moved bone"), Moved.DirtyRanges[0].Start, 2);
+		TestEqual(TEXT("Dirty range covers one bone"), Moved.DirtyRanges[0].Num, 1);
+	}
+	TestEqual(TEXT("Moved bone stored"), Moved.GetOwnerBones(1)[2].Translation.Z, 5.0f, 1e-4f);
+	TestEqual(TEXT("Jittered bones keep the stored value"), Moved.GetOwnerBones(1)[0].Translation.X, 100.0f, 1e-4f);
+
+	const FTransform Transform(FQuat(FVector(1.0, 2.0, 3.0).GetSafeNormal(), 0.7), FVector(10.0, -20.0, 30.0), FVector(1.0, 2.0, 0.5));
+	const FMatrix44f Expected(Transform.ToMatrixWithScale());
+	TestTrue(TEXT("Compact bone rebuilds the FTransform matrix"), FGPUBoundaryBoneTransform(Transform).ToMatrix().Equals(Expected, 1e-4f));
+
+	return true;
+}
+
+/**
+ * @brief BA-02: Snapshots of an unchanged arena share one array, and a snapshot keeps its values after the arena is
+ * written again.
+ */
+bool FKawaiiFluidBoundaryBoneArenaTest_CopyOnWrite::RunTest(const FString& Parameters)
+{
+	FGPUBoundaryBoneArena Arena;
+	TArray<FGPUBoundaryBoneTransform> Bones = MakeBones(1, 8);
+	Arena.WriteOwner(1, Bones, FMatrix44f::Identity, TestPositionTolerance, TestRotationTolerance);
+
+	const FGPUBoundaryBoneArenaSnapshot First = Arena.TakeSnapshot();
+	const FGPUBoundaryBoneArenaSnapshot Second = Arena.TakeSnapshot();
+	TestTrue(TEXT("Unchanged arena shares its bones"), First.Bones == Second.Bones);
+
+	Bones[0].Translation.Z = 50.0f;
+	Arena.WriteOwner(1, Bones, FMatrix44f::Identity, TestPositionTolerance, TestRotationTolerance);
+	const FGPUBoundaryBoneArenaSnapshot Third = Arena.TakeSnapshot();
+
+	TestTrue(TEXT("Write clones shared bones"), Third.Bones != First.Bones);
+	TestEqual(TEXT("Earlier snapshot keeps its value"), First.GetOwnerBones(1)[0].Translation.Z, 0.0f);
+	TestEqual(TEXT("New snapshot sees the write"), Third.GetOwnerBones(1)[0].Translation.Z, 50.0f);
+	TestEqual(TEXT("Same layout"), Third.LayoutRevision, First.LayoutRevision);
+
+	TestTrue(TEXT("Unknown owner has no bones"), Third.GetOwnerBones(2).IsEmpty());
+	return true;
+}
+
+/**
+ * @brief BA-03: In a crowd of resting characters only the animated ones are dirty; skeleton changes and removals
+ * compact the arena and bump its layout revision.
+ */
+bool FKawaiiFluidBoundaryBoneArenaTest_Crowd::RunTest(const FString& Parameters)
+{
+	const int32 NumOwners = 100;
+	const int32 BonesPerOwner = 20;
+
+	FGPUBoundaryBoneArena Arena;
+	for (int32 OwnerID = 0; OwnerID < NumOwners; ++OwnerID)
+	{
+		Arena.WriteOwner(OwnerID, MakeBones(OwnerID, BonesPerOwner), FMatrix44f::Identity, TestPositionTolerance, TestRotationTolerance);
+	}
+	const FGPUBoundaryBoneArenaSnapshot Initial = Arena.TakeSnapshot();
+	TestEqual(TEXT("Initial upload covers the crowd"), CountDirtyBones(Initial.DirtyRanges), NumOwners * BonesPerOwner);
+	TestEqual(TEXT("Initial ranges coalesced"), Initial.DirtyRanges.Num(), 1);
+
+	// Two animated characters, everyone else resting
+	for (int32 OwnerID = 0; OwnerID < NumOwners; ++OwnerID)
+	{
+		const float Height = (OwnerID == 10 || OwnerID == 11) ? 5.0f : 0.0f;
+		Arena.WriteOwner(OwnerID, MakeBones(OwnerID, BonesPerOwner, Height), FMatrix44f::Identity, TestPositionTolerance, TestRotationTolerance);
+	}
+	const FGPUBoundaryBoneArenaSnapshot Animated = Arena.TakeSnapshot();
+	TestEqual(TEXT("Only animated bones dirty"), CountDirtyBones(Animated.DirtyRanges), 2 * BonesPerOwner);
+	TestEqual(TEXT("Adjacent owners merged into one range"), Animated.DirtyRanges.Num(), 1);
+
+	TArray<FGPUBoundaryBoneRange> Ranges = { { 30, 5 }, { 0, 10 }, { 10, 5 }, { 32, 10 }, { 50, 1 } };
+	FGPUBoundaryBoneRange::Coalesce(Ranges);
+	TestEqual(TEXT("Overlapping and adjacent ranges merged"), Ranges.Num(), 3);
+	if (Ranges.Num() == 3)
+	{
+		TestTrue(TEXT("Adjacent merge"), Ranges[0].Start == 0 && Ranges[0].Num == 15);
+		TestTrue(TEXT("Overlapping merge"), Ranges[1].Start == 30 && Ranges[1].Num == 12);
+		TestTrue(TEXT("Disjoint range kept"), Ranges[2].Start == 50 && Ranges[2].Num == 1);
+	}
+
+	// Skeleton change moves the owner to the end without compacting a small hole
+	const uint32 InitialLayout = Arena.GetLayoutRevision();
+	Arena.WriteOwner(0, MakeBones(0, BonesPerOwner + 1), FMatrix44f::Identity, TestPositionTolerance, TestRotationTolerance);
+	TestEqual(TEXT("Resized owner appended"), Arena.FindOwner(0) ? Arena.FindOwner(0)->Offset : INDEX_NONE, NumOwners * BonesPerOwner);
+	TestEqual(TEXT("Old range freed"), Arena.GetFreeBoneCount(), BonesPerOwner);
+	TestEqual(TEXT("Small hole keeps the layout"), Arena.GetLayoutRevision(), InitialLayout);
+
+	// Removing most of the crowd compacts the survivors
+	for (int32 OwnerID = 1; OwnerID < 70; ++OwnerID)
+	{
+		Arena.RemoveOwner(OwnerID);
+	}
+	TestNotEqual(TEXT("Compaction bumps the layout"), Arena.GetLayoutRevision(), InitialLayout);
+
+	const int32 LiveBones = (BonesPerOwner + 1) + (NumOwners - 70) * BonesPerOwner;
+	TestEqual(TEXT("Freed bones reclaimed"), Arena.NumBones() - Arena.GetFreeBoneCount(), LiveBones);
+	TestTrue(TEXT("Arena shrank"), Arena.NumBones() < NumOwners * BonesPerOwner);
+
+	const FGPUBoundaryBoneArenaSnapshot Compacted = Arena.TakeSnapshot();
+	TestNotEqual(TEXT("Snapshot carries the new layout"), Compacted.LayoutRevision, Initial.LayoutRevision);
+	TestEqual(TEXT("Survivor keeps its bones"), FVector(Compacted.GetOwnerBones(80)[3].Translation),
+		FVector(MakeBones(80, BonesPerOwner)[3].Translation));
+	TestEqual(TEXT("Resized owner keeps its bones"), Compacted.GetOwnerBones(0).Num(), BonesPerOwner + 1);
+
+	return true;
+}
+
+/**
+ * @brief BA-04: Snapshots pushed while the render side does not consume (no particles yet) are skipped by the next
+ * pop, which activates the latest bones and still carries every bone moved in the skipped snapshots.
+ */
+bool FKawaiiFluidBoundaryBoneArenaTest_SnapshotCatchUp::RunTest(const FString& Parameters)
+{
+	const int32 OwnerID = 1;
+	const int32 NumBones = 4;
+	const int32 NumSnapshots = 5;
+
+	FGPUBoundarySkinningManager Manager;
+	Manager.Initialize();
+
+	TArray<FGPUBoundaryParticleLocal> LocalParticles;
+	LocalParticles.AddZeroed(1);
+	Manager.UploadLocalBoundaryParticles(OwnerID, LocalParticles);
+
+	// Snapshot i moves bone i only (the last two snapshots move the last bone), and the component rises with each
+	TArray<FMatrix44f> BoneMatrices;
+	for (const FGPUBoundaryBoneTransform& Bone : MakeBones(OwnerID, NumBones))
+	{
+		BoneMatrices.Add(Bone.ToMatrix());
+	}
+	Manager.UploadBoneTransformsForBoundary(OwnerID, BoneMatrices, FMatrix44f::Identity);
+	Manager.SnapshotBoneTransformsForPendingSimulation();
+	TestTrue(TEXT("First snapshot activated"), Manager.PopAndActivateSnapshot());
+
+	for (int32 SnapshotIdx = 0; SnapshotIdx < NumSnapshots; ++SnapshotIdx)
+	{
+		const int32 MovedBone = FMath::Min(SnapshotIdx, NumBones - 1);
+		BoneMatrices[MovedBone].M[3][2] += 10.0f;
+		Manager.UploadBoneTransformsForBoundary(OwnerID, BoneMatrices,
+			FMatrix44f(FTranslationMatrix(FVector(0.0, 0.0, 100.0 * (SnapshotIdx + 1)))));
+		Manager.SnapshotBoneTransformsForPendingSimulation();
+	}
+
+	TestTrue(TEXT("Queued snapshot activated"), Manager.PopAndActivateSnapshot());
+	TestFalse(TEXT("Queue drained by one pop"), Manager.PopAndActivateSnapshot());
+
+	const FGPUBoundaryBoneArenaSnapshot* Active = Manager.GetActiveSnapshot();
+	const FGPUBoundaryBoneOwner* Owner = Manager.GetActiveSnapshotData(OwnerID);
+	TestTrue(TEXT("Active snapshot set"), Active != nullptr && Owner != nullptr);
+	if (!Active || !Owner)
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Latest component transform"), Owner->ComponentTransform.M[3][2], 100.0f * NumSnapshots, 1e-3f);
+	TestEqual(TEXT("Latest bones"), Active->GetOwnerBones(OwnerID)[NumBones - 1].Translation.Z, 20.0f, 1e-3f);
+	TestEqual(TEXT("Bones moved in skipped snapshots kept"), Active->GetOwnerBones(OwnerID)[0].Translation.Z, 10.0f, 1e-3f);
+	TestEqual(TEXT("Dirty ranges of skipped snapshots merged"), CountDirtyBones(Active->DirtyRanges), NumBones);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
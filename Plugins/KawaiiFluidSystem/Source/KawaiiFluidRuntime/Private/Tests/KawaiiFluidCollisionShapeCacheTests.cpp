@@ -0,0 +1,195 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Simulation/Collision/KawaiiFluidCollisionShapeCache.h"
+#include "Simulation/Collision/KawaiiFluidMeshCollider.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCollisionShapeCacheTest_Build,
+	"KawaiiFluid.Simulation.CollisionShapeCache.CS01_Build",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCollisionShapeCacheTest_SharedPerAsset,
+	"KawaiiFluid.Simulation.CollisionShapeCache.CS02_SharedPerAsset",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCollisionShapeCacheTest_ColliderRevision,
+	"KawaiiFluid.Simulation.CollisionShapeCache.CS03_ColliderRevision",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Axis-aligned cube convex with a triangulated index buffer (two triangles per face).
+	 * @param Center Cube center in body space.
+	 * @param HalfSize Half edge length.
+	 * @return Convex element.
+	 */
+	FKConvexElem MakeCubeConvex(const FVector& Center, float HalfSize)
+	{
+		FKConvexElem Convex;
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			Convex.VertexData.Add(Center + HalfSize * FVector(
+				(Corner & 1) ? 1.0 : -1.0,
+				(Corner & 2) ? 1.0 : -1.0,
+				(Corner & 4) ? 1.0 : -1.0));
+		}
+
+		Convex.IndexData = {
+			0, 2, 6,  0, 6, 4,	// -X
+			1, 3, 7,  1, 7, 5,	// +X
+			0, 1, 5,  0, 5, 4,	// -Y
+			2, 3, 7,  2, 7, 6,	// +Y
+			0, 1, 3,  0, 3, 2,	// -Z
+			4, 5, 7,  4, 7, 6	// +Z
+		};
+		return Convex;
+	}
+
+	/**
+	 * @brief Helper: Transient static mesh whose simple collision is one sphere.
+	 * @param Radius Sphere radius.
+	 * @return Static mesh.
+	 */
+	UStaticMesh* MakeSphereMesh(float Radius)
+	{
+		UStaticMesh* Mesh = NewObject<UStaticMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+		Mesh->CreateBodySetup();
+		Mesh->GetBodySetup()->AggGeom.SphereElems.Add(FKSphereElem(Radius));
+		return Mesh;
+	}
+}
+
+/**
+ * @brief CS-01: Build extracts every element type in body space and turns a triangulated cube into 6 outward planes.
+ */
+bool FKawaiiFluidCollisionShapeCacheTest_Build::RunTest(const FString& Parameters)
+{
+	const FVector ConvexCenter(100.0, 0.0, 0.0);
+	const float ConvexHalfSize = 10.0f;
+
+	FKAggregateGeom Body;
+	FKSphereElem Sphere(5.0f);
+	Sphere.Center = FVector(0.0, 20.0, 0.0);
+	Body.SphereElems.Add(Sphere);
+	Body.BoxElems.Add(FKBoxElem(10.0f, 20.0f, 30.0f));
+	Body.ConvexElems.Add(MakeCubeConvex(ConvexCenter, ConvexHalfSize));
+
+	// Degenerate convex (too few vertices) is dropped
+	FKConvexElem Degenerate;
+	Degenerate.VertexData = { FVector::ZeroVector, FVector::XAxisVector, FVector::YAxisVector };
+	Body.ConvexElems.Add(Degenerate);
+
+	const FKawaiiFluidCollisionShapeSet Set = FKawaiiFluidCollisionShapeSet::Build({ Body }, { NAME_None });
+
+	TestEqual(TEXT("One body"), Set.BodyBoneNames.Num(), 1);
+	TestEqual(TEXT("Sphere count"), Set.Spheres.Num(), 1);
+	TestEqual(TEXT("Box count"), Set.Boxes.Num(), 1);
+	TestEqual(TEXT("Degenerate convex dropped"), Set.Convexes.Num(), 1);
+	if (Set.Spheres.Num() != 1 || Set.Boxes.Num() != 1 || Set.Convexes.Num() != 1)
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Sphere center"), Set.Spheres[0].Center, Sphere.Center);
+	TestEqual(TEXT("Sphere radius"), Set.Spheres[0].Radius, 5.0f);
+	TestEqual(TEXT("Box half extent"), Set.Boxes[0].HalfExtent, FVector(5.0, 10.0, 15.0));
+
+	const FKawaiiFluidLocalConvex& Convex = Set.Convexes[0];
+	TestEqual(TEXT("Convex center"), Convex.Center, ConvexCenter);
+	TestEqual(TEXT("Convex bounding radius"), Convex.BoundingRadius, ConvexHalfSize * FMath::Sqrt(3.0f), 1e-3f);
+	TestEqual(TEXT("Duplicate face normals merged"), Convex.PlaneCount, 6);
+
+	for (int32 PlaneIndex = Convex.PlaneStart; PlaneIndex < Convex.PlaneStart + Convex.PlaneCount; ++PlaneIndex)
+	{
+		const FKawaiiFluidLocalPlane& Plane = Set.ConvexPlanes[PlaneIndex];
+		TestEqual(TEXT("Unit normal"), static_cast<float>(Plane.Normal.Size()), 1.0f, 1e-4f);
+		TestEqual(TEXT("Outward plane at the face"),
+			Plane.Distance, static_cast<float>(FVector::DotProduct(ConvexCenter, Plane.Normal)) + ConvexHalfSize, 1e-3f);
+	}
+
+	return true;
+}
+
+/**
+ * @brief CS-02: Every lookup of an asset shares one shape set until the asset is invalidated, and entries of
+ * collected assets are pruned after garbage collection.
+ */
+bool FKawaiiFluidCollisionShapeCacheTest_SharedPerAsset::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidCollisionShapeCache& Cache = FKawaiiFluidCollisionShapeCache::Get();
+	TestFalse(TEXT("No asset"), Cache.FindOrBuild(nullptr).IsValid());
+
+	UStaticMesh* Mesh = MakeSphereMesh(10.0f);
+
+	Cache.Prefetch(Mesh);
+	const FKawaiiFluidCollisionShapeCache::FShapeSetPtr First = Cache.FindOrBuild(Mesh);
+	const FKawaiiFluidCollisionShapeCache::FShapeSetPtr Second = Cache.FindOrBuild(Mesh);
+
+	TestTrue(TEXT("Prefetched shapes available"), First.IsValid() && First->Spheres.Num() == 1);
+	TestTrue(TEXT("Shared between lookups"), First == Second);
+
+	const FKawaiiFluidCollisionShapeCache::FShapeSetPtr Other = Cache.FindOrBuild(MakeSphereMesh(10.0f));
+	TestTrue(TEXT("Separate entry per asset"), Other.IsValid() && Other != First);
+
+	Mesh->GetBodySetup()->AggGeom.SphereElems[0].Radius = 20.0f;
+	Cache.Invalidate(Mesh);
+	const FKawaiiFluidCollisionShapeCache::FShapeSetPtr Rebuilt = Cache.FindOrBuild(Mesh);
+	TestTrue(TEXT("Rebuilt after invalidation"), Rebuilt.IsValid() && Rebuilt != First);
+	TestEqual(TEXT("Rebuilt from the modified asset"), Rebuilt.IsValid() ? Rebuilt->Spheres[0].Radius : 0.0f, 20.0f);
+	TestEqual(TEXT("Old set still usable by its holders"), First->Spheres[0].Radius, 10.0f);
+
+	// The other mesh is only referenced by the cache key, which does not keep it alive
+	Cache.Invalidate(Mesh);
+	const int32 NumBeforeCollect = Cache.Num();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	TestTrue(TEXT("Collected asset pruned"), Cache.Num() < NumBeforeCollect);
+	TestTrue(TEXT("Pruned set still usable by its holders"), Other.IsValid() && Other->Spheres.Num() == 1);
+	return true;
+}
+
+/**
+ * @brief CS-03: A resting collider keeps its world shapes (same revision); moving the target rebuilds them at the
+ * new transform.
+ */
+bool FKawaiiFluidCollisionShapeCacheTest_ColliderRevision::RunTest(const FString& Parameters)
+{
+	UStaticMesh* Mesh = MakeSphereMesh(10.0f);
+	UStaticMeshComponent* MeshComponent = NewObject<UStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+	MeshComponent->SetStaticMesh(Mesh);
+
+	UKawaiiFluidMeshCollider* Collider = NewObject<UKawaiiFluidMeshCollider>(GetTransientPackage(), NAME_None, RF_Transient);
+	Collider->bAutoFindMesh = false;
+	Collider->CollisionMargin = 0.0f;
+	Collider->TargetMeshComponent = MeshComponent;
+
+	Collider->CacheCollisionShapes();
+	const uint32 InitialRevision = Collider->GetShapeRevision();
+
+	FVector ClosestPoint, Normal;
+	float Distance = 0.0f;
+	TestTrue(TEXT("Shapes cached"), Collider->GetClosestPoint(FVector(50.0, 0.0, 0.0), ClosestPoint, Normal, Distance));
+	TestEqual(TEXT("Closest point on the sphere"), ClosestPoint, FVector(10.0, 0.0, 0.0), 1e-3);
+
+	Collider->CacheCollisionShapes();
+	TestEqual(TEXT("Unmoved collider keeps its shapes"), Collider->GetShapeRevision(), InitialRevision);
+
+	MeshComponent->SetWorldLocation(FVector(200.0, 0.0, 0.0));
+	Collider->CacheCollisionShapes();
+	TestNotEqual(TEXT("Moved collider rebuilds its shapes"), Collider->GetShapeRevision(), InitialRevision);
+
+	TestTrue(TEXT("Shapes cached after move"), Collider->GetClosestPoint(FVector(250.0, 0.0, 0.0), ClosestPoint, Normal, Distance));
+	TestEqual(TEXT("Closest point follows the component"), ClosestPoint, FVector(210.0, 0.0, 0.0), 1e-3);
+	TestEqual(TEXT("Distance to the moved sphere"), Distance, 40.0f, 1e-3f);
+
+	FKawaiiFluidCollisionShapeCache::Get().Invalidate(Mesh);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
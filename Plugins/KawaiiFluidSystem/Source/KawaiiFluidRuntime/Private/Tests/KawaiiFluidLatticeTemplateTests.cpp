@@ -0,0 +1,357 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/Utils/KawaiiFluidLatticeTemplateCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidLatticeTemplateTest_MatchesPerPointLattice,
+	"KawaiiFluid.Simulation.LatticeTemplate.LT01_MatchesPerPointLattice",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidLatticeTemplateTest_CacheHitAndLruEviction,
+	"KawaiiFluid.Simulation.LatticeTemplate.LT02_CacheHitAndLruEviction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidLatticeTemplateTest_SimdTransformMatchesScalar,
+	"KawaiiFluid.Simulation.LatticeTemplate.LT03_SimdTransformMatchesScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_LatticeTemplate,
+	"KawaiiFluid.Benchmark.LatticeTemplate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Lattice template key.
+	 * @param Shape Lattice shape.
+	 * @param Extent Shape extent.
+	 * @param Spacing Particle spacing.
+	 * @return Template key.
+	 */
+	FKawaiiFluidLatticeTemplateKey MakeKey(EKawaiiFluidSpawnShape Shape, const FVector3f& Extent, float Spacing)
+	{
+		FKawaiiFluidLatticeTemplateKey Key;
+		Key.Shape = Shape;
+		Key.Extent = Extent;
+		Key.Spacing = Spacing;
+		return Key;
+	}
+
+	/**
+	 * @brief Helper: The stream hex layer's former per-point loop, unjittered, local XY.
+	 * @param Radius Layer radius.
+	 * @param Spacing Particle spacing.
+	 * @return Points inside the circle in row order.
+	 */
+	TArray<FVector3f> GenerateReferenceDisc(float Radius, float Spacing)
+	{
+		TArray<FVector3f> Points;
+		const float RowSpacing = Spacing * FMath::Sqrt(3.0f) * 0.5f;
+		const float RadiusSq = Radius * Radius;
+		const int32 HalfRows = (FMath::CeilToInt(Radius / RowSpacing) * 2 + 1) / 2;
+
+		for (int32 Row = -HalfRows; Row <= HalfRows; ++Row)
+		{
+			const float LocalY = Row * RowSpacing;
+			if (LocalY * LocalY > RadiusSq)
+			{
+				continue;
+			}
+			const float XOffset = (FMath::Abs(Row) % 2 != 0) ? Spacing * 0.5f : 0.0f;
+			const int32 NumCols = FMath::FloorToInt(FMath::Sqrt(RadiusSq - LocalY * LocalY) / Spacing);
+			for (int32 Col = -NumCols; Col <= NumCols; ++Col)
+			{
+				const float LocalX = Col * Spacing + XOffset;
+				if (LocalX * LocalX + LocalY * LocalY <= RadiusSq)
+				{
+					Points.Add(FVector3f(LocalX, LocalY, 0.0f));
+				}
+			}
+		}
+		return Points;
+	}
+
+	/**
+	 * @brief Helper: SpawnParticlesSphereHexagonal's former per-point loop, unjittered, local space.
+	 * @param Radius Sphere radius.
+	 * @param Spacing Particle spacing before HCP compensation.
+	 * @return Points inside the sphere in lattice order.
+	 */
+	TArray<FVector3f> GenerateReferenceSphere(float Radius, float Spacing)
+	{
+		TArray<FVector3f> Points;
+		const float AdjustedSpacing = Spacing * 1.122f;
+		const float RowSpacingY = AdjustedSpacing * 0.866025f;
+		const float LayerSpacingZ = AdjustedSpacing * 0.816497f;
+		const int32 GridSize = FMath::CeilToInt(Radius / AdjustedSpacing) + 1;
+		const int32 GridSizeY = FMath::CeilToInt(Radius / RowSpacingY) + 1;
+		const int32 GridSizeZ = FMath::CeilToInt(Radius / LayerSpacingZ) + 1;
+
+		for (int32 z = -GridSizeZ; z <= GridSizeZ; ++z)
+		{
+			const int32 ZMod = (z + GridSizeZ) % 3;
+			const float ZLayerOffsetX = (ZMod == 1) ? AdjustedSpacing * 0.5f : ((ZMod == 2) ? AdjustedSpacing * 0.25f : 0.0f);
+			const float ZLayerOffsetY = (ZMod == 1) ? RowSpacingY / 3.0f : ((ZMod == 2) ? RowSpacingY * 2.0f / 3.0f : 0.0f);
+			for (int32 y = -GridSizeY; y <= GridSizeY; ++y)
+			{
+				const float RowOffsetX = (((y + GridSizeY) % 2) == 1) ? AdjustedSpacing * 0.5f : 0.0f;
+				for (int32 x = -GridSize; x <= GridSize; ++x)
+				{
+					const FVector3f LocalPos(x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX, y * RowSpacingY + ZLayerOffsetY, z * LayerSpacingZ);
+					if (LocalPos.SizeSquared() <= Radius * Radius)
+					{
+						Points.Add(LocalPos);
+					}
+				}
+			}
+		}
+		return Points;
+	}
+
+	/**
+	 * @brief Helper: Expand a template with the identity transform.
+	 * @param Template Lattice template.
+	 * @param ClipRadiusXY Disc clip radius (negative = none).
+	 * @return Local positions of the spawned points.
+	 */
+	TArray<FVector3f> ExpandLocal(const FKawaiiFluidLatticeTemplate& Template, float ClipRadiusXY)
+	{
+		TArray<FGPUSpawnRequest> Requests;
+		Template.AppendSpawnRequests(FVector3f::ZeroVector, FVector3f(1.0f, 0.0f, 0.0f), FVector3f(0.0f, 1.0f, 0.0f), FVector3f(0.0f, 0.0f, 1.0f),
+			FVector3f::ZeroVector, FKawaiiFluidSpawnRandom(), ClipRadiusXY, FGPUSpawnRequest(), Requests);
+
+		TArray<FVector3f> Points;
+		Points.Reserve(Requests.Num());
+		for (const FGPUSpawnRequest& Request : Requests)
+		{
+			Points.Add(Request.Position);
+		}
+		return Points;
+	}
+
+	/**
+	 * @brief Helper: Compare two point lists in order.
+	 * @return Number of mismatching points (count mismatch counts as all points).
+	 */
+	int32 CountMismatches(const TArray<FVector3f>& A, const TArray<FVector3f>& B, float Tolerance)
+	{
+		if (A.Num() != B.Num())
+		{
+			return FMath::Max(A.Num(), B.Num());
+		}
+		int32 Mismatches = 0;
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			Mismatches += A[i].Equals(B[i], Tolerance) ? 0 : 1;
+		}
+		return Mismatches;
+	}
+}
+
+//=============================================================================
+// LT-01: Template Matches Per-Point Lattice
+//=============================================================================
+
+/**
+ * @brief LT-01: Template points equal the per-point loops they replace (disc clipped to its radius).
+ */
+bool FKawaiiFluidLatticeTemplateTest_MatchesPerPointLattice::RunTest(const FString& Parameters)
+{
+	const float DiscCases[][2] = { { 30.0f, 2.0f }, { 12.5f, 3.0f }, { 0.0f, 5.0f }, { 7.0f, 10.0f } };
+	for (const auto& Case : DiscCases)
+	{
+		const FKawaiiFluidLatticeTemplateRef Template = FKawaiiFluidLatticeTemplate::Build(MakeKey(EKawaiiFluidSpawnShape::Disc, FVector3f(Case[0], Case[0], 0.0f), Case[1]));
+		const int32 Mismatches = CountMismatches(ExpandLocal(*Template, Case[0]), GenerateReferenceDisc(Case[0], Case[1]), 1e-4f);
+		TestEqual(*FString::Printf(TEXT("Disc R=%.1f S=%.1f matches"), Case[0], Case[1]), Mismatches, 0);
+	}
+
+	const float SphereCases[][2] = { { 40.0f, 5.0f }, { 9.0f, 4.0f } };
+	for (const auto& Case : SphereCases)
+	{
+		const FKawaiiFluidLatticeTemplateRef Template = FKawaiiFluidLatticeTemplate::Build(MakeKey(EKawaiiFluidSpawnShape::Sphere, FVector3f(Case[0]), Case[1]));
+		const int32 Mismatches = CountMismatches(ExpandLocal(*Template, -1.0f), GenerateReferenceSphere(Case[0], Case[1]), 1e-4f);
+		TestEqual(*FString::Printf(TEXT("Sphere R=%.1f S=%.1f matches"), Case[0], Case[1]), Mismatches, 0);
+	}
+
+	// Box and cylinder stay inside their bounds
+	const FVector3f BoxExtent(20.0f, 12.0f, 8.0f);
+	const TArray<FVector3f> Box = ExpandLocal(*FKawaiiFluidLatticeTemplate::Build(MakeKey(EKawaiiFluidSpawnShape::Box, BoxExtent, 3.0f)), -1.0f);
+	TestTrue(TEXT("Box is not empty"), Box.Num() > 0);
+	TestFalse(TEXT("Box points inside"), Box.ContainsByPredicate([&BoxExtent](const FVector3f& P) { return FMath::Abs(P.X) > BoxExtent.X || FMath::Abs(P.Y) > BoxExtent.Y || FMath::Abs(P.Z) > BoxExtent.Z; }));
+
+	const TArray<FVector3f> Cylinder = ExpandLocal(*FKawaiiFluidLatticeTemplate::Build(MakeKey(EKawaiiFluidSpawnShape::Cylinder, FVector3f(10.0f, 10.0f, 15.0f), 3.0f)), -1.0f);
+	TestTrue(TEXT("Cylinder is not empty"), Cylinder.Num() > 0);
+	TestFalse(TEXT("Cylinder points inside"), Cylinder.ContainsByPredicate([](const FVector3f& P) { return P.X * P.X + P.Y * P.Y > 100.0f || FMath::Abs(P.Z) > 15.0f; }));
+
+	TestEqual(TEXT("Non-positive spacing is empty"), FKawaiiFluidLatticeTemplate::Build(MakeKey(EKawaiiFluidSpawnShape::Sphere, FVector3f(10.0f), 0.0f))->Num(), 0);
+
+	return true;
+}
+
+//=============================================================================
+// LT-02: Cache Hit and LRU Eviction
+//=============================================================================
+
+/**
+ * @brief LT-02: Repeated keys hit, the byte budget holds, and the least recently used template is evicted first.
+ */
+bool FKawaiiFluidLatticeTemplateTest_CacheHitAndLruEviction::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidLatticeTemplateKey KeyA = MakeKey(EKawaiiFluidSpawnShape::Disc, FVector3f(30.0f, 30.0f, 0.0f), 2.0f);
+	const FKawaiiFluidLatticeTemplateKey KeyB = MakeKey(EKawaiiFluidSpawnShape::Disc, FVector3f(31.0f, 31.0f, 0.0f), 2.0f);
+	const FKawaiiFluidLatticeTemplateKey KeyC = MakeKey(EKawaiiFluidSpawnShape::Disc, FVector3f(32.0f, 32.0f, 0.0f), 2.0f);
+
+	const int64 TemplateBytes = static_cast<int64>(FKawaiiFluidLatticeTemplate::Build(KeyC)->GetAllocatedSize());
+
+	// Room for two templates
+	FKawaiiFluidLatticeTemplateCache Cache(TemplateBytes * 2 + TemplateBytes / 2);
+
+	const FKawaiiFluidLatticeTemplateRef FirstA = Cache.FindOrBuild(KeyA);
+	const FKawaiiFluidLatticeTemplateRef SecondA = Cache.FindOrBuild(KeyA);
+	TestTrue(TEXT("Repeated key returns the cached template"), &FirstA.Get() == &SecondA.Get());
+	TestEqual(TEXT("One hit"), Cache.GetHits(), static_cast<uint64>(1));
+	TestEqual(TEXT("One miss"), Cache.GetMisses(), static_cast<uint64>(1));
+
+	Cache.FindOrBuild(KeyB);
+	Cache.FindOrBuild(KeyA);  // Touch A, B becomes least recent
+	Cache.FindOrBuild(KeyC);
+
+	TestEqual(TEXT("Two templates fit the budget"), Cache.Num(), 2);
+	TestEqual(TEXT("One eviction"), Cache.GetEvictions(), static_cast<uint64>(1));
+	TestTrue(TEXT("Cached bytes within budget"), Cache.GetCachedBytes() <= TemplateBytes * 2 + TemplateBytes / 2);
+
+	const uint64 HitsBefore = Cache.GetHits();
+	const FKawaiiFluidLatticeTemplateRef ThirdA = Cache.FindOrBuild(KeyA);
+	TestEqual(TEXT("Recently used A survived"), Cache.GetHits(), HitsBefore + 1);
+	TestTrue(TEXT("A is still the original template"), &FirstA.Get() == &ThirdA.Get());
+
+	const uint64 MissesBefore = Cache.GetMisses();
+	Cache.FindOrBuild(KeyB);
+	TestEqual(TEXT("Least recent B was evicted"), Cache.GetMisses(), MissesBefore + 1);
+
+	// Evicted templates stay valid for holders
+	TestTrue(TEXT("Held template stays valid"), FirstA->Num() > 0);
+
+	// A template larger than the budget is returned but never cached
+	Cache.SetMaxBytes(TemplateBytes / 2);
+	TestEqual(TEXT("Shrinking the budget evicts everything"), Cache.Num(), 0);
+	TestEqual(TEXT("No bytes cached"), Cache.GetCachedBytes(), static_cast<int64>(0));
+	TestTrue(TEXT("Oversized template is still built"), Cache.FindOrBuild(KeyA)->Num() > 0);
+	TestEqual(TEXT("Oversized template is not cached"), Cache.Num(), 0);
+
+	return true;
+}
+
+//=============================================================================
+// LT-03: SIMD Transform Matches Scalar
+//=============================================================================
+
+/**
+ * @brief LT-03: The 4-wide transform equals a scalar quaternion rotation, and jitter stays in range.
+ */
+bool FKawaiiFluidLatticeTemplateTest_SimdTransformMatchesScalar::RunTest(const FString& Parameters)
+{
+	// Sizes chosen so the point count is not a multiple of 4 (padding lanes must be skipped)
+	const FKawaiiFluidLatticeTemplateRef Template = FKawaiiFluidLatticeTemplate::Build(MakeKey(EKawaiiFluidSpawnShape::Box, FVector3f(11.0f, 7.0f, 5.0f), 2.0f));
+	TestTrue(TEXT("Template is not empty"), Template->Num() > 0);
+	TestEqual(TEXT("SoA arrays padded to 4"), Template->X.Num() % 4, 0);
+
+	const FQuat Rotation(FRotator(25.0, -40.0, 70.0));
+	const FVector Center(100.0, -50.0, 300.0);
+
+	FGPUSpawnRequest Prototype;
+	Prototype.Velocity = FVector3f(1.0f, 2.0f, 3.0f);
+	Prototype.SourceID = 7;
+
+	TArray<FGPUSpawnRequest> Requests;
+	const int32 Count = Template->AppendSpawnRequests(FVector3f(Center), FVector3f(Rotation.GetAxisX()), FVector3f(Rotation.GetAxisY()), FVector3f(Rotation.GetAxisZ()),
+		FVector3f::ZeroVector, FKawaiiFluidSpawnRandom(), -1.0f, Prototype, Requests);
+
+	TestEqual(TEXT("One request per point"), Count, Template->Num());
+	TestEqual(TEXT("Requests appended"), Requests.Num(), Template->Num());
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < FMath::Min(Requests.Num(), Template->Num()); ++i)
+	{
+		const FVector Expected = Center + Rotation.RotateVector(FVector(Template->X[i], Template->Y[i], Template->Z[i]));
+		Mismatches += Requests[i].Position.Equals(FVector3f(Expected), 1e-3f) ? 0 : 1;
+		Mismatches += (Requests[i].Velocity == Prototype.Velocity && Requests[i].SourceID == 7) ? 0 : 1;
+	}
+	TestEqual(TEXT("SIMD transform matches scalar rotation"), Mismatches, 0);
+
+	// Jitter is bounded per axis and appends after existing requests
+	const FVector3f JitterRange(0.5f, 0.25f, 0.0f);
+	const int32 Existing = Requests.Num();
+	Template->AppendSpawnRequests(FVector3f::ZeroVector, FVector3f(1.0f, 0.0f, 0.0f), FVector3f(0.0f, 1.0f, 0.0f), FVector3f(0.0f, 0.0f, 1.0f),
+		JitterRange, FKawaiiFluidSpawnRandom(11, 0), -1.0f, Prototype, Requests);
+
+	int32 OutOfRange = 0;
+	for (int32 i = 0; i < Template->Num(); ++i)
+	{
+		const FVector3f Offset = (Requests[Existing + i].Position - FVector3f(Template->X[i], Template->Y[i], Template->Z[i])).GetAbs();
+		OutOfRange += (Offset.X <= JitterRange.X + 1e-4f && Offset.Y <= JitterRange.Y + 1e-4f && Offset.Z <= 1e-4f) ? 0 : 1;
+	}
+	TestEqual(TEXT("Jitter within range"), OutOfRange, 0);
+
+	return true;
+}
+
+//=============================================================================
+// Benchmark
+//=============================================================================
+
+/**
+ * @brief Lattice Template Benchmark.
+ * A high-rate stream: many hex layers per frame with unchanged radius and spacing. Regenerating the layer
+ * every step (the previous path) versus the cached template plus the SIMD transform.
+ */
+bool FKawaiiFluidBenchmark_LatticeTemplate::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumFrames = 60;
+	constexpr int32 LayersPerFrame = 64;
+	const FKawaiiFluidLatticeTemplateKey Key = MakeKey(EKawaiiFluidSpawnShape::Disc, FVector3f(40.0f, 40.0f, 0.0f), 2.0f);
+	const FVector3f JitterRange(0.3f, 0.3f, 0.0f);
+
+	FKawaiiFluidLatticeTemplateCache Cache(16 * 1024 * 1024);
+	FGPUSpawnRequest Prototype;
+	Prototype.Velocity = FVector3f(0.0f, 0.0f, -500.0f);
+
+	TArray<FGPUSpawnRequest> Requests;
+	const auto RunFrames = [&](bool bCached)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Requests.Reset();
+			for (int32 Layer = 0; Layer < LayersPerFrame; ++Layer)
+			{
+				const FKawaiiFluidLatticeTemplateRef Template = bCached ? Cache.FindOrBuild(Key) : FKawaiiFluidLatticeTemplate::Build(Key);
+				const FVector3f Origin(0.0f, 0.0f, 500.0f - Layer * 1.7f);
+				Template->AppendSpawnRequests(Origin, FVector3f(1.0f, 0.0f, 0.0f), FVector3f(0.0f, 1.0f, 0.0f), FVector3f(0.0f, 0.0f, -1.0f),
+					JitterRange, FKawaiiFluidSpawnRandom(11, Frame * LayersPerFrame + Layer), Key.Extent.X, Prototype, Requests);
+			}
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0 / NumFrames;
+	};
+
+	const double UncachedMs = RunFrames(false);
+	const int32 UncachedCount = Requests.Num();
+	const double CachedMs = RunFrames(true);
+
+	TestTrue(TEXT("Both paths spawn the full stream"), UncachedCount > 0 && Requests.Num() > 0);
+
+	AddInfo(FString::Printf(TEXT("Stream: %d layers/frame, ~%d particles/frame, template %d points (%d KB)"),
+		LayersPerFrame, Requests.Num(), Cache.FindOrBuild(Key)->Num(), static_cast<int32>(Cache.GetCachedBytes() / 1024)));
+	AddInfo(FString::Printf(TEXT("Regenerate per layer: %.3f ms/frame"), UncachedMs));
+	AddInfo(FString::Printf(TEXT("Cached template:      %.3f ms/frame (hits %llu, misses %llu)"), CachedMs, Cache.GetHits(), Cache.GetMisses()));
+
+	TestTrue(TEXT("Cached template faster than regeneration"), CachedMs < UncachedMs);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
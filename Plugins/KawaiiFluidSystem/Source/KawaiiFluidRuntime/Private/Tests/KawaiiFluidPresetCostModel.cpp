@@ -0,0 +1,307 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Tests/KawaiiFluidPresetCostModel.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+#include "Algo/AnyOf.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	/** Particle count the per-preset cost is normalized to */
+	constexpr int32 CostReferenceParticles = 10000;
+
+	/** Preset clamp range of SubstepDeltaTime */
+	constexpr float MinSubstepDeltaTime = 0.001f;
+	constexpr float MaxSubstepDeltaTime = 0.05f;
+
+	/**
+	 * @brief Cost of an evaluation normalized to the reference particle count.
+	 * @param Evaluation Canonical scene result.
+	 * @return Measured ms per frame for 10k particles.
+	 */
+	double GetMeasuredMsPer10kParticles(const FKawaiiFluidPresetEvaluation& Evaluation)
+	{
+		return Evaluation.ParticleCount > 0 ? Evaluation.GetMsPerFrame() * CostReferenceParticles / Evaluation.ParticleCount : 0.0;
+	}
+
+	/**
+	 * @brief Storage of the per-session model.
+	 * @return Session model, uncalibrated until GetSessionModel first runs.
+	 */
+	FKawaiiFluidPresetCostModel& GetSessionModelStorage()
+	{
+		static FKawaiiFluidPresetCostModel SessionModel;
+		return SessionModel;
+	}
+}
+
+//=============================================================================
+// FKawaiiFluidPresetCostModel
+//=============================================================================
+
+/**
+ * @brief Average substeps per frame: the accumulator adds min(FrameDeltaTime, SubstepDeltaTime * MaxSubsteps) per frame.
+ * @param SubstepDeltaTime Substep length.
+ * @param MaxSubsteps Substep cap per frame.
+ * @param FrameDeltaTime Frame length.
+ * @return Substeps per frame (fractional when the frame is not a multiple of the substep).
+ */
+float FKawaiiFluidPresetCostModel::GetSubstepsPerFrame(float SubstepDeltaTime, int32 MaxSubsteps, float FrameDeltaTime)
+{
+	if (SubstepDeltaTime <= 0.0f || MaxSubsteps <= 0 || FrameDeltaTime <= 0.0f)
+	{
+		return 0.0f;
+	}
+	return FMath::Min(FrameDeltaTime, SubstepDeltaTime * MaxSubsteps) / SubstepDeltaTime;
+}
+
+/**
+ * @brief Predicted CPU solver time of one frame.
+ * @param NumParticles Particle count.
+ * @param Neighbors Neighbors per particle.
+ * @param SolverIterations Density iterations per substep.
+ * @param SubstepsPerFrame Substeps per frame.
+ * @return Predicted ms per frame.
+ */
+double FKawaiiFluidPresetCostModel::PredictMsPerFrame(int32 NumParticles, float Neighbors, int32 SolverIterations, float SubstepsPerFrame) const
+{
+	const double PerParticleSubstep = BaseMs + (PerNeighborMs + PerNeighborIterationMs * SolverIterations) * Neighbors;
+	return static_cast<double>(NumParticles) * SubstepsPerFrame * PerParticleSubstep;
+}
+
+/**
+ * @brief Predicted CPU solver time per frame of 10k particles with a preset's resolution and solver settings.
+ * @param Preset Preset to price.
+ * @param FrameDeltaTime Frame length the substeps are counted for.
+ * @return Predicted ms per frame for 10k particles.
+ */
+double FKawaiiFluidPresetCostModel::PredictMsPer10kParticles(const UKawaiiFluidPresetDataAsset& Preset, float FrameDeltaTime) const
+{
+	return PredictMsPerFrame(CostReferenceParticles, static_cast<float>(Preset.EstimatedNeighborCount), Preset.SolverIterations,
+		GetSubstepsPerFrame(Preset.SubstepDeltaTime, Preset.MaxSubsteps, FrameDeltaTime));
+}
+
+/**
+ * @brief Fit the coefficients from stage timings of the canonical scene.
+ * Reference runs at its own spacing with 1 iteration and at a finer spacing (about twice the neighbors) with
+ * 6 iterations. Per particle-substep, the neighbor stages are fitted as a line over the estimated neighbor
+ * count (its intercept, e.g. the hash rebuild, joins BaseMs) and the density stage per iteration as a
+ * proportion of it; a single neighbor count could not separate the per-neighbor slope from the fixed cost.
+ * @param Reference Preset whose resolution the scene uses.
+ * @param Settings Canonical scene settings.
+ * @return Calibrated model, or an uncalibrated zero model unless both runs were stable.
+ */
+FKawaiiFluidPresetCostModel FKawaiiFluidPresetCostModel::Calibrate(
+	const UKawaiiFluidPresetDataAsset* Reference,
+	const FKawaiiFluidPresetEvaluationSettings& Settings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidPresetCostModel_Calibrate);
+
+	FKawaiiFluidPresetCostModel Model;
+	if (!Reference)
+	{
+		return Model;
+	}
+
+	const TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Probe(DuplicateObject<UKawaiiFluidPresetDataAsset>(Reference, GetTransientPackage()));
+
+	// Neighbors scale with 1/SpacingRatio^3, so 0.8x spacing roughly doubles them
+	const float ReferenceSpacing = Reference->SpacingRatio;
+	const float FineSpacing = ReferenceSpacing * 0.8f;
+	const float SpacingRatios[2] = { ReferenceSpacing, FineSpacing };
+	const int32 IterationCounts[2] = { 1, 6 };
+
+	double Neighbors[2];
+	double BaseCost[2];
+	double NeighborCost[2];
+	double DensityCost[2];
+	for (int32 Run = 0; Run < 2; ++Run)
+	{
+		Probe->SpacingRatio = SpacingRatios[Run];
+		Probe->RecalculateDerivedParameters();
+		Probe->SolverIterations = IterationCounts[Run];
+
+		const FKawaiiFluidPresetEvaluation Evaluation = FKawaiiFluidPresetEvaluator::Evaluate(Probe.Get(), Settings);
+		if (!Evaluation.IsStable() || Evaluation.Substeps == 0)
+		{
+			return Model;
+		}
+
+		const double ParticleSubsteps = static_cast<double>(Evaluation.ParticleCount) * Evaluation.Substeps;
+		const FKawaiiFluidStageTimings& Timings = Evaluation.Timings;
+		Neighbors[Run] = FMath::Max(Probe->EstimatedNeighborCount, 1);
+		BaseCost[Run] = (Timings.PredictMs + Timings.CollisionMs + Timings.FinalizeMs + Timings.GetOtherMs()) / ParticleSubsteps;
+		NeighborCost[Run] = (Timings.NeighborMs + Timings.ViscosityMs + Timings.CohesionMs) / ParticleSubsteps;
+		DensityCost[Run] = Timings.DensityMs / (ParticleSubsteps * IterationCounts[Run]);
+	}
+
+	// The spacing clamp can collapse both runs onto one neighbor count; then only a proportional fit is possible
+	const double NeighborSpan = Neighbors[1] - Neighbors[0];
+	double NeighborSlope = NeighborSpan > 0.0 ? (NeighborCost[1] - NeighborCost[0]) / NeighborSpan : 0.0;
+	double NeighborIntercept = NeighborCost[0] - NeighborSlope * Neighbors[0];
+	if (NeighborSlope <= 0.0 || NeighborIntercept < 0.0)
+	{
+		// Timing noise outweighed the neighbor term: fall back to a line through the origin
+		NeighborSlope = (NeighborCost[0] * Neighbors[0] + NeighborCost[1] * Neighbors[1]) / (FMath::Square(Neighbors[0]) + FMath::Square(Neighbors[1]));
+		NeighborIntercept = 0.0;
+	}
+
+	Model.BaseMs = 0.5 * (BaseCost[0] + BaseCost[1]) + NeighborIntercept;
+	Model.PerNeighborMs = NeighborSlope;
+	Model.PerNeighborIterationMs = (DensityCost[0] * Neighbors[0] + DensityCost[1] * Neighbors[1]) / (FMath::Square(Neighbors[0]) + FMath::Square(Neighbors[1]));
+	Model.bCalibrated = true;
+	return Model;
+}
+
+/**
+ * @brief Model calibrated on first use from a default preset in a short scene, then reused for the session.
+ * @return Session cost model.
+ */
+const FKawaiiFluidPresetCostModel& FKawaiiFluidPresetCostModel::GetSessionModel()
+{
+	check(IsInGameThread());
+
+	FKawaiiFluidPresetCostModel& SessionModel = GetSessionModelStorage();
+	if (!SessionModel.bCalibrated)
+	{
+		FKawaiiFluidPresetEvaluationSettings Settings;
+		Settings.SimulatedSeconds = 1.0f;
+		Settings.MaxParticles = 4096;
+
+		const TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Reference(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage(), NAME_None, RF_Transient));
+		SessionModel = Calibrate(Reference.Get(), Settings);
+	}
+	return SessionModel;
+}
+
+/**
+ * @brief Session model without triggering the calibration.
+ * @return Calibrated session model, or nullptr if GetSessionModel has not calibrated it yet.
+ */
+const FKawaiiFluidPresetCostModel* FKawaiiFluidPresetCostModel::FindSessionModel()
+{
+	check(IsInGameThread());
+
+	const FKawaiiFluidPresetCostModel& SessionModel = GetSessionModelStorage();
+	return SessionModel.bCalibrated ? &SessionModel : nullptr;
+}
+
+//=============================================================================
+// FKawaiiFluidPresetAutoTuner
+//=============================================================================
+
+/**
+ * @brief Find the cheapest iteration and substep counts reaching TargetDensityError within the budget.
+ * @param Preset Preset to tune (not modified).
+ * @param TargetDensityError Mean density error to reach (FKawaiiFluidMetricsCollector constraint error).
+ * @param BudgetMsPer10kParticles Predicted cost limit per frame for 10k particles; ignored with an uncalibrated model.
+ * @param Model Cost model ranking the candidates.
+ * @param Settings Canonical scene settings; FrameDeltaTime sets the frame the substeps divide.
+ * @param MaxEvaluations Canonical scene runs allowed.
+ * @return Chosen counts; the most accurate stable candidate if none reached the target.
+ */
+FKawaiiFluidPresetTuningResult FKawaiiFluidPresetAutoTuner::Tune(
+	const UKawaiiFluidPresetDataAsset* Preset,
+	float TargetDensityError,
+	float BudgetMsPer10kParticles,
+	const FKawaiiFluidPresetCostModel& Model,
+	const FKawaiiFluidPresetEvaluationSettings& Settings,
+	int32 MaxEvaluations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidPresetAutoTuner_Tune);
+
+	FKawaiiFluidPresetTuningResult Result;
+	if (!Preset || Settings.FrameDeltaTime <= 0.0f)
+	{
+		return Result;
+	}
+
+	struct FCandidate
+	{
+		int32 Iterations;
+		int32 Substeps;
+		double PredictedMs;
+	};
+
+	const float Neighbors = static_cast<float>(Preset->EstimatedNeighborCount);
+	TArray<FCandidate> Candidates;
+	for (int32 Iterations = 1; Iterations <= MaxTunedIterations; ++Iterations)
+	{
+		for (int32 Substeps = 1; Substeps <= MaxTunedSubsteps; ++Substeps)
+		{
+			const float SubstepDeltaTime = Settings.FrameDeltaTime / Substeps;
+			if (SubstepDeltaTime < MinSubstepDeltaTime || SubstepDeltaTime > MaxSubstepDeltaTime)
+			{
+				continue;
+			}
+
+			const double PredictedMs = Model.PredictMsPerFrame(CostReferenceParticles, Neighbors, Iterations, static_cast<float>(Substeps));
+			if (Model.bCalibrated && PredictedMs > BudgetMsPer10kParticles)
+			{
+				continue;
+			}
+			Candidates.Add({ Iterations, Substeps, PredictedMs });
+		}
+	}
+
+	// Cheapest first; an uncalibrated model ties everything, so fall back to the fewest total passes
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B)
+	{
+		if (A.PredictedMs != B.PredictedMs)
+		{
+			return A.PredictedMs < B.PredictedMs;
+		}
+		return A.Iterations * A.Substeps < B.Iterations * B.Substeps;
+	});
+
+	const TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Probe(DuplicateObject<UKawaiiFluidPresetDataAsset>(Preset, GetTransientPackage()));
+	TArray<FIntPoint> Missed;
+	float BestError = TNumericLimits<float>::Max();
+
+	for (const FCandidate& Candidate : Candidates)
+	{
+		if (Result.Evaluations >= MaxEvaluations)
+		{
+			break;
+		}
+
+		// Fewer iterations and fewer substeps than a miss cannot be more accurate
+		if (Algo::AnyOf(Missed, [&Candidate](const FIntPoint& Miss) { return Candidate.Iterations <= Miss.X && Candidate.Substeps <= Miss.Y; }))
+		{
+			continue;
+		}
+
+		Probe->SolverIterations = Candidate.Iterations;
+		Probe->SubstepDeltaTime = Settings.FrameDeltaTime / Candidate.Substeps;
+		Probe->MaxSubsteps = FMath::Max(Preset->MaxSubsteps, Candidate.Substeps);
+
+		const FKawaiiFluidPresetEvaluation Evaluation = FKawaiiFluidPresetEvaluator::Evaluate(Probe.Get(), Settings);
+		++Result.Evaluations;
+
+		const bool bStable = Evaluation.IsStable();
+		const float Error = Evaluation.Final.AverageConstraintError;
+		const bool bMeetsTarget = bStable && Error <= TargetDensityError;
+
+		if (bStable && (bMeetsTarget || Error < BestError))
+		{
+			BestError = Error;
+			Result.bFound = true;
+			Result.bMeetsTarget = bMeetsTarget;
+			Result.SolverIterations = Candidate.Iterations;
+			Result.SubstepsPerFrame = Candidate.Substeps;
+			Result.SubstepDeltaTime = Probe->SubstepDeltaTime;
+			Result.MaxSubsteps = Probe->MaxSubsteps;
+			Result.PredictedMsPer10kParticles = Candidate.PredictedMs;
+			Result.MeasuredMsPer10kParticles = GetMeasuredMsPer10kParticles(Evaluation);
+			Result.DensityError = Error;
+		}
+
+		if (bMeetsTarget)
+		{
+			break;
+		}
+		Missed.Add(FIntPoint(Candidate.Iterations, Candidate.Substeps));
+	}
+
+	return Result;
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/KawaiiFluidPresetCostModel.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPresetCostModelTest_Scaling,
+	"KawaiiFluid.Simulation.PresetCostModel.CM01_Scaling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPresetCostModelTest_Calibration,
+	"KawaiiFluid.Simulation.PresetCostModel.CM02_Calibration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPresetCostModelTest_AutoTune,
+	"KawaiiFluid.Simulation.PresetCostModel.CM03_AutoTune",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Short, small evaluation so the test stays fast.
+	 * @return Scene settings.
+	 */
+	FKawaiiFluidPresetEvaluationSettings MakeSmallScene()
+	{
+		return FKawaiiFluidPresetEvaluationSettings::MakeSmallScene(0.5f);
+	}
+}
+
+/**
+ * @brief CM-01: Substeps per frame follow the runtime accumulator, and the predicted cost grows linearly with
+ * particles and substeps and affinely with iterations.
+ */
+bool FKawaiiFluidPresetCostModelTest_Scaling::RunTest(const FString& Parameters)
+{
+	const float FrameDeltaTime = 1.0f / 60.0f;
+	TestEqual(TEXT("Two 120 Hz substeps per 60 Hz frame"), FKawaiiFluidPresetCostModel::GetSubstepsPerFrame(1.0f / 120.0f, 8, FrameDeltaTime), 2.0f, 1e-4f);
+	TestEqual(TEXT("Capped by MaxSubsteps"), FKawaiiFluidPresetCostModel::GetSubstepsPerFrame(1.0f / 480.0f, 2, FrameDeltaTime), 2.0f, 1e-4f);
+	TestEqual(TEXT("Invalid step"), FKawaiiFluidPresetCostModel::GetSubstepsPerFrame(0.0f, 8, FrameDeltaTime), 0.0f);
+
+	FKawaiiFluidPresetCostModel Model;
+	Model.BaseMs = 1e-4;
+	Model.PerNeighborMs = 1e-5;
+	Model.PerNeighborIterationMs = 2e-5;
+
+	const double Reference = Model.PredictMsPerFrame(10000, 30.0f, 3, 2.0f);
+	TestEqual(TEXT("Formula"), Reference, 10000.0 * 2.0 * (1e-4 + (1e-5 + 2e-5 * 3) * 30.0), 1e-9);
+	TestEqual(TEXT("Linear in particles"), Model.PredictMsPerFrame(20000, 30.0f, 3, 2.0f), 2.0 * Reference, 1e-9);
+	TestEqual(TEXT("Linear in substeps"), Model.PredictMsPerFrame(10000, 30.0f, 3, 4.0f), 2.0 * Reference, 1e-9);
+
+	const double OneIteration = Model.PredictMsPerFrame(10000, 30.0f, 1, 2.0f);
+	const double TwoIterations = Model.PredictMsPerFrame(10000, 30.0f, 2, 2.0f);
+	TestEqual(TEXT("Each iteration adds the same cost"), Reference - TwoIterations, TwoIterations - OneIteration, 1e-9);
+
+	const UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	const float Substeps = FKawaiiFluidPresetCostModel::GetSubstepsPerFrame(Preset->SubstepDeltaTime, Preset->MaxSubsteps, FrameDeltaTime);
+	TestEqual(TEXT("Preset prediction uses its resolution and solver settings"), Model.PredictMsPer10kParticles(*Preset, FrameDeltaTime),
+		Model.PredictMsPerFrame(10000, static_cast<float>(Preset->EstimatedNeighborCount), Preset->SolverIterations, Substeps), 1e-9);
+
+	return true;
+}
+
+/**
+ * @brief CM-02: Calibration on the canonical scene yields positive coefficients whose prediction is within a
+ * loose factor of the measured cost of another iteration count and neighbor count.
+ */
+bool FKawaiiFluidPresetCostModelTest_Calibration::RunTest(const FString& Parameters)
+{
+	TestFalse(TEXT("No reference"), FKawaiiFluidPresetCostModel::Calibrate(nullptr, MakeSmallScene()).bCalibrated);
+
+	UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FKawaiiFluidPresetEvaluationSettings Settings = MakeSmallScene();
+	const FKawaiiFluidPresetCostModel Model = FKawaiiFluidPresetCostModel::Calibrate(Preset, Settings);
+
+	TestTrue(TEXT("Calibrated"), Model.bCalibrated);
+	TestTrue(TEXT("Coefficients positive"), Model.BaseMs > 0.0 && Model.PerNeighborMs > 0.0 && Model.PerNeighborIterationMs > 0.0);
+	TestEqual(TEXT("Reference preset not modified"), Preset->SolverIterations, GetDefault<UKawaiiFluidPresetDataAsset>()->SolverIterations);
+	TestEqual(TEXT("Reference spacing not modified"), Preset->SpacingRatio, GetDefault<UKawaiiFluidPresetDataAsset>()->SpacingRatio);
+
+	Preset->SolverIterations = 3;
+	const FKawaiiFluidPresetEvaluation Evaluation = FKawaiiFluidPresetEvaluator::Evaluate(Preset, Settings);
+	const double MeasuredMs = Evaluation.Timings.TotalMs / Evaluation.Frames;
+	const double PredictedMs = Model.PredictMsPerFrame(Evaluation.ParticleCount, static_cast<float>(Preset->EstimatedNeighborCount),
+		Preset->SolverIterations, static_cast<float>(Evaluation.Substeps) / Evaluation.Frames);
+
+	// Timing noise on shared machines is large; only the order of magnitude is checked
+	TestTrue(TEXT("Prediction within 3x of the measured cost"), PredictedMs > MeasuredMs / 3.0 && PredictedMs < MeasuredMs * 3.0);
+	AddInfo(FString::Printf(TEXT("Predicted %.3f ms/frame, measured %.3f ms/frame"), PredictedMs, MeasuredMs));
+
+	// A spacing between the two calibration spacings (about 1.4x the reference neighbors)
+	Preset->SpacingRatio = GetDefault<UKawaiiFluidPresetDataAsset>()->SpacingRatio * 0.9f;
+	Preset->RecalculateDerivedParameters();
+	const FKawaiiFluidPresetEvaluation Denser = FKawaiiFluidPresetEvaluator::Evaluate(Preset, Settings);
+	const double DenserMeasuredMs = Denser.Timings.TotalMs / Denser.Frames;
+	const double DenserPredictedMs = Model.PredictMsPerFrame(Denser.ParticleCount, static_cast<float>(Preset->EstimatedNeighborCount),
+		Preset->SolverIterations, static_cast<float>(Denser.Substeps) / Denser.Frames);
+	TestTrue(TEXT("Denser prediction within 3x of the measured cost"), DenserPredictedMs > DenserMeasuredMs / 3.0 && DenserPredictedMs < DenserMeasuredMs * 3.0);
+
+	return true;
+}
+
+/**
+ * @brief CM-03: The auto-tuner recommends stable counts within the budget, prunes dominated candidates, and leaves
+ * the preset untouched.
+ */
+bool FKawaiiFluidPresetCostModelTest_AutoTune::RunTest(const FString& Parameters)
+{
+	const UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FKawaiiFluidPresetEvaluationSettings Settings = MakeSmallScene();
+
+	FKawaiiFluidPresetCostModel Model;
+	Model.BaseMs = 1e-5;
+	Model.PerNeighborMs = 1e-6;
+	Model.PerNeighborIterationMs = 1e-6;
+	Model.bCalibrated = true;
+
+	const float Budget = static_cast<float>(Model.PredictMsPerFrame(10000, static_cast<float>(Preset->EstimatedNeighborCount), 4, 2.0f));
+	const FKawaiiFluidPresetTuningResult Result = FKawaiiFluidPresetAutoTuner::Tune(Preset, 1.0f, Budget, Model, Settings, 4);
+
+	TestTrue(TEXT("Found stable settings"), Result.bFound);
+	TestTrue(TEXT("Generous target reached"), Result.bMeetsTarget);
+	TestTrue(TEXT("Within budget"), Result.PredictedMsPer10kParticles <= Budget);
+	TestTrue(TEXT("Evaluation budget respected"), Result.Evaluations >= 1 && Result.Evaluations <= 4);
+	TestEqual(TEXT("Substep length matches the substep count"), Result.SubstepDeltaTime * Result.SubstepsPerFrame, Settings.FrameDeltaTime, 1e-5f);
+	TestTrue(TEXT("Substep cap allows the count"), Result.MaxSubsteps >= Result.SubstepsPerFrame);
+	TestTrue(TEXT("Measured cost reported"), Result.MeasuredMsPer10kParticles > 0.0);
+
+	const UKawaiiFluidPresetDataAsset* Defaults = GetDefault<UKawaiiFluidPresetDataAsset>();
+	TestEqual(TEXT("Preset iterations untouched"), Preset->SolverIterations, Defaults->SolverIterations);
+	TestEqual(TEXT("Preset substep untouched"), Preset->SubstepDeltaTime, Defaults->SubstepDeltaTime);
+
+	// An unreachable target spends the whole evaluation budget and keeps the most accurate stable candidate
+	const FKawaiiFluidPresetTuningResult Unreachable = FKawaiiFluidPresetAutoTuner::Tune(Preset, 0.0f, Budget, Model, Settings, 3);
+	TestFalse(TEXT("Unreachable target not met"), Unreachable.bMeetsTarget);
+	TestTrue(TEXT("Unreachable evaluation budget respected"), Unreachable.Evaluations <= 3);
+	TestTrue(TEXT("Best effort still reported"), Unreachable.bFound);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,327 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Tests/KawaiiFluidPresetEvaluator.h"
+#include "Tests/KawaiiFluidMetricsCollector.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+#include "Core/KawaiiFluidSpatialHash.h"
+#include "Simulation/Utils/KawaiiFluidAdaptiveSubsteps.h"
+#include "Simulation/Utils/KawaiiFluidSpawnDescriptor.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	/**
+	 * @struct FScopedStageTimer
+	 * @brief Adds the wall time of its scope to a stage total.
+	 * @param TotalMs Stage total (ms) to add to.
+	 * @param StartSeconds Scope entry time.
+	 */
+	struct FScopedStageTimer
+	{
+		double& TotalMs;
+		const double StartSeconds;
+
+		explicit FScopedStageTimer(double& InTotalMs)
+			: TotalMs(InTotalMs)
+			, StartSeconds(FPlatformTime::Seconds())
+		{
+		}
+
+		~FScopedStageTimer()
+		{
+			TotalMs += (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+		}
+	};
+
+	/**
+	 * @brief XY area of a box.
+	 * @param Box Bounds.
+	 * @return Footprint area (cm²).
+	 */
+	float GetFootprintArea(const FBox& Box)
+	{
+		const FVector Size = Box.GetSize();
+		return static_cast<float>(Size.X * Size.Y);
+	}
+}
+
+//=============================================================================
+// UKawaiiFluidPresetEvaluationContext
+//=============================================================================
+
+/**
+ * @brief Set the arena particles are kept in.
+ * @param Bounds Arena box (walls and floor).
+ * @param ParticleRadius Particle radius; centers stay this far from the walls.
+ * @param Friction Fraction of tangential motion removed on wall contact.
+ */
+void UKawaiiFluidPresetEvaluationContext::SetArena(const FBox& Bounds, float ParticleRadius, float Friction)
+{
+	ArenaParticleRadius = FMath::Max(ParticleRadius, 0.0f);
+	ArenaBounds = Bounds.ExpandBy(-ArenaParticleRadius);
+	ArenaFriction = FMath::Clamp(Friction, 0.0f, 1.0f);
+	ArenaEscapes = 0;
+}
+
+/**
+ * @brief Run one CPU substep, timing the whole step.
+ * @param Particles In/Out particle array.
+ * @param Preset Read-only preset data asset.
+ * @param Params Simulation parameters.
+ * @param SpatialHash Spatial hash for neighbor search.
+ * @param SubstepDT Time step for this substep.
+ */
+void UKawaiiFluidPresetEvaluationContext::SimulateSubstep(
+	TArray<FKawaiiFluidParticle>& Particles,
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	FKawaiiFluidSpatialHash& SpatialHash,
+	float SubstepDT)
+{
+	FScopedStageTimer Timer(Timings.TotalMs);
+	Super::SimulateSubstep(Particles, Preset, Params, SpatialHash, SubstepDT);
+}
+
+void UKawaiiFluidPresetEvaluationContext::PredictPositions(TArray<FKawaiiFluidParticle>& Particles, const UKawaiiFluidPresetDataAsset* Preset,
+	const FVector& ExternalForce, float DeltaTime)
+{
+	FScopedStageTimer Timer(Timings.PredictMs);
+	Super::PredictPositions(Particles, Preset, ExternalForce, DeltaTime);
+}
+
+void UKawaiiFluidPresetEvaluationContext::UpdateNeighbors(TArray<FKawaiiFluidParticle>& Particles, FKawaiiFluidSpatialHash& SpatialHash,
+	float SmoothingRadius)
+{
+	FScopedStageTimer Timer(Timings.NeighborMs);
+	Super::UpdateNeighbors(Particles, SpatialHash, SmoothingRadius);
+}
+
+void UKawaiiFluidPresetEvaluationContext::SolveDensityConstraints(TArray<FKawaiiFluidParticle>& Particles, const UKawaiiFluidPresetDataAsset* Preset,
+	float DeltaTime)
+{
+	FScopedStageTimer Timer(Timings.DensityMs);
+	Super::SolveDensityConstraints(Particles, Preset, DeltaTime);
+}
+
+/**
+ * @brief Resolve colliders, then clamp predicted positions into the arena.
+ * Penetration along a wall normal is removed; friction scales down the motion along the wall. A particle whose
+ * center had already crossed a wall (deeper than its radius) counts as an escape.
+ * @param Particles In/Out particle array.
+ * @param Colliders Collider components (none in the canonical scene).
+ * @param SubstepDT Time step for this substep.
+ */
+void UKawaiiFluidPresetEvaluationContext::HandleCollisions(TArray<FKawaiiFluidParticle>& Particles,
+	const TArray<TObjectPtr<UKawaiiFluidCollider>>& Colliders, float SubstepDT)
+{
+	FScopedStageTimer Timer(Timings.CollisionMs);
+	Super::HandleCollisions(Particles, Colliders, SubstepDT);
+
+	if (!ArenaBounds.IsValid)
+	{
+		return;
+	}
+
+	const float Slide = 1.0f - ArenaFriction;
+	const FBox Walls = ArenaBounds.ExpandBy(ArenaParticleRadius);
+	std::atomic<int32> Escapes{0};
+	ParallelFor(Particles.Num(), [&](int32 i)
+	{
+		FKawaiiFluidParticle& Particle = Particles[i];
+		FVector Clamped = ClampVector(Particle.PredictedPosition, ArenaBounds.Min, ArenaBounds.Max);
+		if (Clamped == Particle.PredictedPosition)
+		{
+			return;
+		}
+
+		if (!Walls.IsInsideOrOn(Particle.PredictedPosition))
+		{
+			Escapes.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (Clamped[Axis] == Particle.PredictedPosition[Axis])
+			{
+				Clamped[Axis] = Particle.Position[Axis] + (Clamped[Axis] - Particle.Position[Axis]) * Slide;
+			}
+		}
+		Particle.PredictedPosition = Clamped;
+	});
+	ArenaEscapes += Escapes.load();
+}
+
+void UKawaiiFluidPresetEvaluationContext::FinalizePositions(TArray<FKawaiiFluidParticle>& Particles, float DeltaTime)
+{
+	FScopedStageTimer Timer(Timings.FinalizeMs);
+	Super::FinalizePositions(Particles, DeltaTime);
+}
+
+void UKawaiiFluidPresetEvaluationContext::ApplyViscosity(TArray<FKawaiiFluidParticle>& Particles, const UKawaiiFluidPresetDataAsset* Preset)
+{
+	FScopedStageTimer Timer(Timings.ViscosityMs);
+	Super::ApplyViscosity(Particles, Preset);
+}
+
+void UKawaiiFluidPresetEvaluationContext::ApplyCohesion(TArray<FKawaiiFluidParticle>& Particles, const UKawaiiFluidPresetDataAsset* Preset)
+{
+	FScopedStageTimer Timer(Timings.CohesionMs);
+	Super::ApplyCohesion(Particles, Preset);
+}
+
+//=============================================================================
+// FKawaiiFluidPresetEvaluator
+//=============================================================================
+
+/**
+ * @brief Simulate the canonical scene with a preset and collect its settled state and cost.
+ * The block is filled with the preset's own spacing and mass, and frames are stepped back to back without
+ * waiting for wall time. Stops early once the simulation is numerically unstable.
+ * @param Preset Preset to evaluate.
+ * @param Settings Scene and duration.
+ * @return Evaluation result; ParticleCount is 0 if the preset cannot be simulated.
+ */
+FKawaiiFluidPresetEvaluation FKawaiiFluidPresetEvaluator::Evaluate(
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidPresetEvaluationSettings& Settings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidPresetEvaluator_Evaluate);
+	check(IsInGameThread());
+
+	FKawaiiFluidPresetEvaluation Result;
+	if (!Preset || Preset->SmoothingRadius <= 0.0f || Preset->SubstepDeltaTime <= 0.0f || Preset->MaxSubsteps <= 0 ||
+		Settings.FrameDeltaTime <= 0.0f || Settings.SimulatedSeconds <= 0.0f)
+	{
+		return Result;
+	}
+
+	// Canonical scene: a block DropHeight above the floor of an open-top arena
+	FKawaiiFluidSpawnDescriptor Descriptor;
+	Descriptor.Shape = EKawaiiFluidSpawnShape::Box;
+	Descriptor.Center = FVector(0.0, 0.0, Settings.DropHeight + Settings.FillHalfExtent.Z);
+	Descriptor.Extent = Settings.FillHalfExtent;
+	Descriptor.Spacing = Preset->ParticleSpacing > 0.0f ? Preset->ParticleSpacing : Preset->ParticleRadius * 2.0f;
+	Descriptor.MaxCount = Settings.MaxParticles;
+
+	FKawaiiFluidSpawnPlan Plan;
+	Plan.Build(Descriptor);
+	if (Plan.IsEmpty())
+	{
+		return Result;
+	}
+
+	TArray<FKawaiiFluidParticle> Particles;
+	Particles.Reserve(Plan.Num());
+	for (int32 i = 0; i < Plan.Num(); ++i)
+	{
+		FKawaiiFluidParticle& Particle = Particles.Emplace_GetRef(FVector(Plan.GetPosition(i)), i);
+		Particle.Mass = Preset->ParticleMass;
+	}
+	Result.ParticleCount = Particles.Num();
+
+	const float ArenaHalfWidth = FMath::Max(Settings.ArenaHalfWidth, static_cast<float>(Settings.FillHalfExtent.GetMax()));
+	const FBox Arena(FVector(-ArenaHalfWidth, -ArenaHalfWidth, 0.0), FVector(ArenaHalfWidth, ArenaHalfWidth, Descriptor.Center.Z + 2.0 * ArenaHalfWidth));
+
+	TStrongObjectPtr<UKawaiiFluidPresetEvaluationContext> Context(
+		NewObject<UKawaiiFluidPresetEvaluationContext>(GetTransientPackage(), NAME_None, RF_Transient));
+	Context->InitializeSolvers(Preset);
+	Context->SetArena(Arena, Preset->ParticleRadius, Preset->Friction);
+
+	FKawaiiFluidSpatialHash SpatialHash(Preset->SmoothingRadius);
+	FKawaiiFluidSimulationParams Params;
+	Params.bUseWorldCollision = false;
+	Params.ParticleRadius = Preset->ParticleRadius;
+
+	FFluidTestMetricsHistory History;
+	History.MaxSamples = FMath::Max(Settings.SettleWindowFrames, 1);
+	const float InitialFootprint = FMath::Max(GetFootprintArea(FKawaiiFluidMetricsCollector::CollectFromParticles(Particles, Preset->Density).ParticleBounds), 1.0f);
+
+	// Same substep schemes as the runtime (decoupled presets, which ignore adaptive substeps, use the fixed accumulator)
+	const bool bAdaptive = Preset->bAdaptiveSubsteps && !Preset->bDecoupledSimulationRate;
+	FKawaiiFluidAdaptiveSubstepSettings AdaptiveSettings;
+	AdaptiveSettings.CFLNumber = Preset->CFLNumber;
+	AdaptiveSettings.ParticleRadius = Preset->ParticleRadius;
+	AdaptiveSettings.GravityMagnitude = static_cast<float>(Preset->Gravity.Size());
+	AdaptiveSettings.MaxSubsteps = Preset->MaxSubsteps;
+	AdaptiveSettings.FallbackSubstepDeltaTime = Preset->SubstepDeltaTime;
+	AdaptiveSettings.HysteresisRatio = Preset->SubstepHysteresis;
+	AdaptiveSettings.DownshiftFrames = Preset->SubstepDownshiftFrames;
+	FKawaiiFluidAdaptiveSubstepState AdaptiveState;
+
+	const int32 NumFrames = FMath::CeilToInt(Settings.SimulatedSeconds / Settings.FrameDeltaTime);
+	const float MaxFrameTime = Preset->SubstepDeltaTime * Preset->MaxSubsteps;
+	float AccumulatedTime = 0.0f;
+	float DensityErrorSum = 0.0f;
+	FKawaiiFluidTestMetrics FrameMetrics;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const double FrameStart = FPlatformTime::Seconds();
+		const float FrameTime = FMath::Min(Settings.FrameDeltaTime, MaxFrameTime);
+		int32 FrameSubsteps = 0;
+		if (bAdaptive)
+		{
+			// Adaptive: the speed sample is one frame old, like the async readback, and nothing carries over
+			const float SampledVelocity = Frame > 0 ? FrameMetrics.MaxVelocity : -1.0f;
+			const FKawaiiFluidSubstepDecision Decision = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(AdaptiveState, AdaptiveSettings, FrameTime, SampledVelocity);
+			FrameSubsteps = Decision.SubstepCount;
+			for (int32 Substep = 0; Substep < FrameSubsteps; ++Substep)
+			{
+				Context->SimulateSubstep(Particles, Preset, Params, SpatialHash, Decision.SubstepDeltaTime);
+			}
+		}
+		else
+		{
+			// Fixed-step accumulator: at most MaxSubsteps per frame, remainder carried over
+			AccumulatedTime += FrameTime;
+			FrameSubsteps = FMath::Min(FMath::FloorToInt(AccumulatedTime / Preset->SubstepDeltaTime), Preset->MaxSubsteps);
+			for (int32 Substep = 0; Substep < FrameSubsteps; ++Substep)
+			{
+				Context->SimulateSubstep(Particles, Preset, Params, SpatialHash, Preset->SubstepDeltaTime);
+				AccumulatedTime -= Preset->SubstepDeltaTime;
+			}
+		}
+		Result.WallSeconds += FPlatformTime::Seconds() - FrameStart;
+		Result.Substeps += FrameSubsteps;
+		Result.Frames = Frame + 1;
+		Result.SimulatedSeconds = Result.Frames * Settings.FrameDeltaTime;
+
+		// Clamped particles never leave the arena, so escapes are counted at the clamp instead of against the bounds
+		FrameMetrics = FKawaiiFluidMetricsCollector::CollectFromParticles(Particles, Preset->Density);
+		FrameMetrics.ParticlesOutOfBounds = Context->GetArenaEscapes();
+		FrameMetrics.FrameNumber = Frame;
+		FrameMetrics.SimulationElapsedTime = Result.SimulatedSeconds;
+		History.AddSample(FrameMetrics);
+		Result.PeakMaxVelocity = FMath::Max(Result.PeakMaxVelocity, FrameMetrics.MaxVelocity);
+
+		const float DensityError = Preset->Density > 0.0f ? FMath::Abs(FrameMetrics.AverageDensity / Preset->Density - 1.0f) : 0.0f;
+		DensityErrorSum += DensityError;
+		Result.PeakDensityError = FMath::Max(Result.PeakDensityError, DensityError);
+
+		Result.bSettled = FKawaiiFluidMetricsCollector::IsInEquilibrium(History, Settings.SettleVelocity, Settings.SettleDensityVariance, History.MaxSamples);
+		if (Result.bSettled && Result.SettleSeconds < 0.0f)
+		{
+			Result.SettleSeconds = Result.SimulatedSeconds;
+		}
+
+		if (!FrameMetrics.IsNumericallyStable())
+		{
+			break;
+		}
+	}
+
+	Result.MeanDensityError = DensityErrorSum / FMath::Max(Result.Frames, 1);
+	Result.Timings = Context->GetTimings();
+	Result.Final = FrameMetrics;
+	Result.Final.AverageConstraintError = FKawaiiFluidMetricsCollector::CalculateAverageConstraintError(Particles, Preset->Density);
+	Result.Final.MaxConstraintError = FKawaiiFluidMetricsCollector::CalculateMaxConstraintError(Particles, Preset->Density);
+	Result.Final.SolverIterations = Preset->SolverIterations;
+	Result.Final.SimulationTimeMs = static_cast<float>(Result.GetMsPerFrame());
+	Result.Final.NeighborSearchTimeMs = static_cast<float>(Result.Timings.NeighborMs / Result.Frames);
+	Result.Final.DensitySolveTimeMs = static_cast<float>(Result.Timings.DensityMs / Result.Frames);
+	Result.Spread = GetFootprintArea(Result.Final.ParticleBounds) / InitialFootprint;
+
+	return Result;
+}
@@ -0,0 +1,79 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/KawaiiFluidPresetEvaluator.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPresetEvaluatorTest_CanonicalScene,
+	"KawaiiFluid.Simulation.PresetEvaluator.PE01_CanonicalScene",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPresetEvaluatorTest_InvalidInput,
+	"KawaiiFluid.Simulation.PresetEvaluator.PE02_InvalidInput",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Short, small evaluation so the test stays fast.
+	 * @return Scene settings.
+	 */
+	FKawaiiFluidPresetEvaluationSettings MakeSmallScene()
+	{
+		return FKawaiiFluidPresetEvaluationSettings::MakeSmallScene(1.0f);
+	}
+}
+
+/**
+ * @brief PE-01: The default preset runs the canonical scene on the CPU: particles fall, stay in the arena, and
+ * every stage reports time within the substep total.
+ */
+bool FKawaiiFluidPresetEvaluatorTest_CanonicalScene::RunTest(const FString& Parameters)
+{
+	const UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FKawaiiFluidPresetEvaluationSettings Settings = MakeSmallScene();
+
+	const FKawaiiFluidPresetEvaluation Result = FKawaiiFluidPresetEvaluator::Evaluate(Preset, Settings);
+
+	TestTrue(TEXT("Scene has particles"), Result.ParticleCount > 0 && Result.ParticleCount <= Settings.MaxParticles);
+	TestEqual(TEXT("All frames simulated"), Result.Frames, FMath::CeilToInt(Settings.SimulatedSeconds / Settings.FrameDeltaTime));
+	TestTrue(TEXT("Substeps follow the preset step"), Result.Substeps >= Result.Frames);
+	TestTrue(TEXT("Stable and inside the arena"), Result.IsStable());
+	TestTrue(TEXT("Fluid fell toward the floor"), Result.Final.CenterOfMass.Z < Settings.DropHeight + Settings.FillHalfExtent.Z);
+	TestTrue(TEXT("Density was solved"), Result.Final.AverageDensity > 0.0f);
+	TestTrue(TEXT("Spread measured"), Result.Spread > 0.0f);
+
+	const FKawaiiFluidStageTimings& Timings = Result.Timings;
+	TestTrue(TEXT("Neighbor and density stages timed"), Timings.NeighborMs > 0.0 && Timings.DensityMs > 0.0);
+	const double StageSumMs = Timings.PredictMs + Timings.NeighborMs + Timings.DensityMs + Timings.CollisionMs +
+		Timings.FinalizeMs + Timings.ViscosityMs + Timings.CohesionMs;
+	TestTrue(TEXT("Stages fit in the substep total"), StageSumMs <= Timings.TotalMs + 1e-3);
+	TestTrue(TEXT("Wall time measured"), Result.WallSeconds > 0.0 && Result.GetMsPerFrame() > 0.0);
+
+	AddInfo(FString::Printf(TEXT("%d particles: %.2f ms/frame (%.1fx real time), density error %.3f, spread %.2f"),
+		Result.ParticleCount, Result.GetMsPerFrame(), Result.GetRealTimeFactor(), Result.Final.AverageConstraintError, Result.Spread));
+
+	return true;
+}
+
+/**
+ * @brief PE-02: Missing presets and empty durations are rejected without simulating.
+ */
+bool FKawaiiFluidPresetEvaluatorTest_InvalidInput::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("No preset"), FKawaiiFluidPresetEvaluator::Evaluate(nullptr, MakeSmallScene()).ParticleCount, 0);
+
+	const UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	FKawaiiFluidPresetEvaluationSettings Settings = MakeSmallScene();
+	Settings.SimulatedSeconds = 0.0f;
+	const FKawaiiFluidPresetEvaluation Result = FKawaiiFluidPresetEvaluator::Evaluate(Preset, Settings);
+	TestEqual(TEXT("No duration"), Result.ParticleCount, 0);
+	TestFalse(TEXT("Empty result is not stable"), Result.IsStable());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,433 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/Utils/KawaiiFluidParticleQueryIndex.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidQueryTest_SphereMatchesBruteForce,
+	"KawaiiFluid.Query.Q01_SphereMatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidQueryTest_BoxMatchesBruteForce,
+	"KawaiiFluid.Query.Q02_BoxMatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidQueryTest_NearestMatchesBruteForce,
+	"KawaiiFluid.Query.Q03_NearestMatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidQueryTest_RaycastMatchesBruteForce,
+	"KawaiiFluid.Query.Q04_RaycastMatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_ParticleQueries,
+	"KawaiiFluid.Benchmark.ParticleQueries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Pool-shaped particle cloud (wide and shallow, denser at the bottom) with a few outliers.
+	 * @param Count Number of particles.
+	 * @param Seed Random seed.
+	 * @param OutPositions Receives positions.
+	 * @param OutVelocities Receives velocities.
+	 * @param OutSourceIDs Receives source IDs (0-3).
+	 */
+	void MakePoolParticles(int32 Count, int32 Seed, TArray<FVector3f>& OutPositions, TArray<FVector3f>& OutVelocities, TArray<int32>& OutSourceIDs)
+	{
+		FRandomStream Random(Seed);
+		OutPositions.SetNumUninitialized(Count);
+		OutVelocities.SetNumUninitialized(Count);
+		OutSourceIDs.SetNumUninitialized(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const float Depth = FMath::Square(Random.GetFraction()) * 200.0f;
+			OutPositions[i] = FVector3f(Random.FRandRange(-2000.0f, 2000.0f), Random.FRandRange(-2000.0f, 2000.0f), Depth);
+			OutVelocities[i] = FVector3f(Random.VRand()) * Random.FRandRange(0.0f, 300.0f);
+			OutSourceIDs[i] = i % 4;
+		}
+
+		// Stray splash particles far from the pool stretch the grid bounds
+		for (int32 i = 0; i < FMath::Min(Count, 8); ++i)
+		{
+			OutPositions[i] = FVector3f(Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(0.0f, 5000.0f));
+		}
+	}
+
+	/**
+	 * @brief Helper: Build an index over the given particles.
+	 * @param Index Index to build.
+	 * @param Positions Particle positions.
+	 * @param Velocities Particle velocities.
+	 * @param SourceIDs Particle source IDs.
+	 * @param CellSize Requested cell size.
+	 */
+	void BuildIndex(FKawaiiFluidParticleQueryIndex& Index, const TArray<FVector3f>& Positions, const TArray<FVector3f>& Velocities, const TArray<int32>& SourceIDs, float CellSize)
+	{
+		Index.Reset();
+		Index.AddParticles(Positions, Velocities, SourceIDs);
+		Index.Build(CellSize);
+	}
+
+	/**
+	 * @brief Helper: Resolve index results to sorted position keys for set comparison.
+	 * @param Index Query index.
+	 * @param Indices Query result indices.
+	 * @return Sorted positions of the results.
+	 */
+	TArray<FVector3f> ResolveSortedPositions(const FKawaiiFluidParticleQueryIndex& Index, TConstArrayView<int32> Indices)
+	{
+		TArray<FVector3f> Result;
+		for (const int32 i : Indices)
+		{
+			Result.Add(FVector3f(Index.GetPosition(i)));
+		}
+		Result.Sort([](const FVector3f& A, const FVector3f& B)
+		{
+			return A.X != B.X ? A.X < B.X : (A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z);
+		});
+		return Result;
+	}
+
+	/**
+	 * @brief Helper: Brute-force sphere query.
+	 * @return Sorted positions within Radius of Center.
+	 */
+	TArray<FVector3f> BruteForceSphere(const TArray<FVector3f>& Positions, const FVector& Center, float Radius)
+	{
+		TArray<FVector3f> Result;
+		const FVector3f C(Center);
+		for (const FVector3f& P : Positions)
+		{
+			if (FVector3f::DistSquared(P, C) <= Radius * Radius)
+			{
+				Result.Add(P);
+			}
+		}
+		Result.Sort([](const FVector3f& A, const FVector3f& B)
+		{
+			return A.X != B.X ? A.X < B.X : (A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z);
+		});
+		return Result;
+	}
+
+	/**
+	 * @brief Helper: Brute-force first hit of a segment against particle spheres.
+	 * @return Entry distance of the closest hit, or a negative value on miss.
+	 */
+	float BruteForceRaycast(const TArray<FVector3f>& Positions, const FVector& Start, const FVector& End, float HitRadius)
+	{
+		const FVector3f S(Start);
+		const FVector3f Delta = FVector3f(End) - S;
+		const float Length = Delta.Size();
+		const FVector3f Dir = Delta / Length;
+
+		float Best = -1.0f;
+		for (const FVector3f& P : Positions)
+		{
+			const FVector3f M = S - P;
+			const float B = FVector3f::DotProduct(M, Dir);
+			const float C = M.SizeSquared() - HitRadius * HitRadius;
+			float T;
+			if (C <= 0.0f)
+			{
+				T = 0.0f;
+			}
+			else
+			{
+				const float Disc = B * B - C;
+				if (B > 0.0f || Disc < 0.0f)
+				{
+					continue;
+				}
+				T = -B - FMath::Sqrt(Disc);
+			}
+			if (T <= Length && (Best < 0.0f || T < Best))
+			{
+				Best = T;
+			}
+		}
+		return Best;
+	}
+}
+
+/** @brief Q-01: Sphere queries (batched and single) return exactly the brute-force set, including outside-grid queries. */
+bool FKawaiiFluidQueryTest_SphereMatchesBruteForce::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions, Velocities;
+	TArray<int32> SourceIDs;
+	MakePoolParticles(20000, 11, Positions, Velocities, SourceIDs);
+
+	FKawaiiFluidParticleQueryIndex Index;
+	BuildIndex(Index, Positions, Velocities, SourceIDs, 20.0f);
+	TestEqual(TEXT("All particles indexed"), Index.Num(), Positions.Num());
+
+	FRandomStream Random(5);
+	TArray<FKawaiiFluidSphereQuery> Queries;
+	for (int32 q = 0; q < 64; ++q)
+	{
+		FKawaiiFluidSphereQuery& Query = Queries.AddDefaulted_GetRef();
+		Query.Center = FVector(Random.FRandRange(-2200.0f, 2200.0f), Random.FRandRange(-2200.0f, 2200.0f), Random.FRandRange(-50.0f, 250.0f));
+		Query.Radius = Random.FRandRange(5.0f, 150.0f);
+	}
+	Queries.Add({ FVector(0.0f, 0.0f, -100000.0f), 50.0f });
+
+	TArray<int32> Indices, Offsets;
+	Index.QuerySpheres(Queries, Indices, Offsets);
+	TestEqual(TEXT("One offset per query + 1"), Offsets.Num(), Queries.Num() + 1);
+
+	bool bAllMatch = true;
+	for (int32 q = 0; q < Queries.Num(); ++q)
+	{
+		const TConstArrayView<int32> Result(Indices.GetData() + Offsets[q], Offsets[q + 1] - Offsets[q]);
+		bAllMatch &= ResolveSortedPositions(Index, Result) == BruteForceSphere(Positions, Queries[q].Center, Queries[q].Radius);
+
+		TArray<int32> Single;
+		Index.QuerySphere(Queries[q].Center, Queries[q].Radius, Single);
+		bAllMatch &= Single.Num() == Result.Num();
+	}
+	TestTrue(TEXT("Sphere results match brute force"), bAllMatch);
+
+	// Records carry velocity and source ID of the same particle
+	TArray<int32> Found;
+	Index.QuerySphere(FVector(Positions[100]), 0.0f, Found);
+	if (TestTrue(TEXT("Exact-position query finds the particle"), Found.Num() >= 1))
+	{
+		const FKawaiiFluidParticleRecord Record = Index.GetRecord(Found[0]);
+		TestEqual(TEXT("Record velocity"), FVector3f(Record.Velocity), Velocities[100]);
+		TestEqual(TEXT("Record source ID"), Record.SourceID, SourceIDs[100]);
+	}
+
+	return true;
+}
+
+/** @brief Q-02: Box queries return exactly the brute-force set. */
+bool FKawaiiFluidQueryTest_BoxMatchesBruteForce::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions, Velocities;
+	TArray<int32> SourceIDs;
+	MakePoolParticles(20000, 12, Positions, Velocities, SourceIDs);
+
+	FKawaiiFluidParticleQueryIndex Index;
+	BuildIndex(Index, Positions, Velocities, SourceIDs, 20.0f);
+
+	FRandomStream Random(6);
+	TArray<FBox> Queries;
+	for (int32 q = 0; q < 64; ++q)
+	{
+		const FVector Center(Random.FRandRange(-2200.0f, 2200.0f), Random.FRandRange(-2200.0f, 2200.0f), Random.FRandRange(-50.0f, 250.0f));
+		const FVector Extent(Random.FRandRange(1.0f, 200.0f), Random.FRandRange(1.0f, 200.0f), Random.FRandRange(1.0f, 100.0f));
+		Queries.Add(FBox(Center - Extent, Center + Extent));
+	}
+
+	TArray<int32> Indices, Offsets;
+	Index.QueryBoxes(Queries, Indices, Offsets);
+
+	bool bAllMatch = true;
+	for (int32 q = 0; q < Queries.Num(); ++q)
+	{
+		int32 Expected = 0;
+		for (const FVector3f& P : Positions)
+		{
+			Expected += Queries[q].IsInsideOrOn(FVector(P)) ? 1 : 0;
+		}
+		bAllMatch &= (Offsets[q + 1] - Offsets[q]) == Expected;
+	}
+	TestTrue(TEXT("Box result counts match brute force"), bAllMatch);
+
+	return true;
+}
+
+/** @brief Q-03: Nearest-K returns the K closest particles in ascending order and honors MaxDistance. */
+bool FKawaiiFluidQueryTest_NearestMatchesBruteForce::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions, Velocities;
+	TArray<int32> SourceIDs;
+	MakePoolParticles(20000, 13, Positions, Velocities, SourceIDs);
+
+	FKawaiiFluidParticleQueryIndex Index;
+	BuildIndex(Index, Positions, Velocities, SourceIDs, 20.0f);
+
+	FRandomStream Random(7);
+	bool bAllMatch = true;
+	for (int32 q = 0; q < 32; ++q)
+	{
+		// Includes points above the pool and far outside the grid
+		const FVector Location = q == 0
+			? FVector(50000.0f, 0.0f, 0.0f)
+			: FVector(Random.FRandRange(-2200.0f, 2200.0f), Random.FRandRange(-2200.0f, 2200.0f), Random.FRandRange(-50.0f, 600.0f));
+		const int32 K = 1 + q % 16;
+
+		TArray<int32> Result;
+		Index.QueryNearest(Location, K, 0.0f, Result);
+
+		TArray<float> BruteDistances;
+		for (const FVector3f& P : Positions)
+		{
+			BruteDistances.Add(FVector::Dist(FVector(P), Location));
+		}
+		BruteDistances.Sort();
+
+		bAllMatch &= Result.Num() == K;
+		for (int32 k = 0; k < Result.Num(); ++k)
+		{
+			const float Dist = FVector::Dist(Index.GetPosition(Result[k]), Location);
+			bAllMatch &= FMath::IsNearlyEqual(Dist, BruteDistances[k], 0.01f);
+		}
+	}
+	TestTrue(TEXT("Nearest-K matches brute force order"), bAllMatch);
+
+	TArray<int32> Limited;
+	Index.QueryNearest(FVector(0.0f, 0.0f, 10000.0f), 8, 100.0f, Limited);
+	TestEqual(TEXT("MaxDistance excludes far particles"), Limited.Num(), 0);
+
+	return true;
+}
+
+/** @brief Q-04: Raycast returns the same first-hit distance as brute force, and misses when it should. */
+bool FKawaiiFluidQueryTest_RaycastMatchesBruteForce::RunTest(const FString& Parameters)
+{
+	TArray<FVector3f> Positions, Velocities;
+	TArray<int32> SourceIDs;
+	MakePoolParticles(20000, 14, Positions, Velocities, SourceIDs);
+
+	FKawaiiFluidParticleQueryIndex Index;
+	BuildIndex(Index, Positions, Velocities, SourceIDs, 20.0f);
+
+	FRandomStream Random(8);
+	TArray<FKawaiiFluidRayQuery> Queries;
+	for (int32 q = 0; q < 64; ++q)
+	{
+		FKawaiiFluidRayQuery& Query = Queries.AddDefaulted_GetRef();
+		Query.Start = FVector(Random.FRandRange(-2500.0f, 2500.0f), Random.FRandRange(-2500.0f, 2500.0f), Random.FRandRange(250.0f, 500.0f));
+		Query.End = Query.Start + FVector(Random.VRand()) * Random.FRandRange(50.0f, 3000.0f);
+		Query.HitRadius = Random.FRandRange(2.0f, 30.0f);
+	}
+
+	TArray<FKawaiiFluidRayQueryHit> Hits;
+	Index.Raycasts(Queries, Hits);
+
+	bool bAllMatch = true;
+	int32 NumHits = 0;
+	for (int32 q = 0; q < Queries.Num(); ++q)
+	{
+		const float Expected = BruteForceRaycast(Positions, Queries[q].Start, Queries[q].End, Queries[q].HitRadius);
+		if (Expected < 0.0f)
+		{
+			bAllMatch &= !Hits[q].IsValidHit();
+		}
+		else
+		{
+			bAllMatch &= Hits[q].IsValidHit() && FMath::IsNearlyEqual(Hits[q].Distance, Expected, 0.05f);
+			++NumHits;
+		}
+	}
+	TestTrue(TEXT("Raycast hits match brute force"), bAllMatch);
+	TestTrue(TEXT("Test rays produce both hits and misses"), NumHits > 0 && NumHits < Queries.Num());
+
+	return true;
+}
+
+/**
+ * @brief Particle Query Benchmark.
+ * 200k particles, 1000 queries of each kind per frame against the grid index,
+ * compared with a brute-force scan of every particle (what GetAllParticlesInRadius does).
+ */
+bool FKawaiiFluidBenchmark_ParticleQueries::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumParticles = 200000;
+	constexpr int32 NumQueries = 1000;
+	constexpr int32 NumBruteForceQueries = 20;
+	constexpr int32 NumFrames = 10;
+
+	TArray<FVector3f> Positions, Velocities;
+	TArray<int32> SourceIDs;
+	MakePoolParticles(NumParticles, 42, Positions, Velocities, SourceIDs);
+
+	FRandomStream Random(43);
+	TArray<FKawaiiFluidSphereQuery> SphereQueries;
+	TArray<FBox> BoxQueries;
+	TArray<FKawaiiFluidRayQuery> RayQueries;
+	TArray<FKawaiiFluidNearestQuery> NearestQueries;
+	for (int32 q = 0; q < NumQueries; ++q)
+	{
+		const FVector Location(Random.FRandRange(-2000.0f, 2000.0f), Random.FRandRange(-2000.0f, 2000.0f), Random.FRandRange(0.0f, 250.0f));
+
+		// Footstep / wetness probe sized
+		SphereQueries.Add({ Location, 50.0f });
+		BoxQueries.Add(FBox(Location - FVector(40.0f, 40.0f, 80.0f), Location + FVector(40.0f, 40.0f, 80.0f)));
+
+		FKawaiiFluidRayQuery& Ray = RayQueries.AddDefaulted_GetRef();
+		Ray.Start = Location + FVector(0.0f, 0.0f, 500.0f);
+		Ray.End = Location - FVector(0.0f, 0.0f, 500.0f);
+		Ray.HitRadius = 5.0f;
+
+		FKawaiiFluidNearestQuery& Nearest = NearestQueries.AddDefaulted_GetRef();
+		Nearest.Location = Location;
+		Nearest.Count = 16;
+	}
+
+	FKawaiiFluidParticleQueryIndex Index;
+	TArray<int32> Indices, Offsets;
+	TArray<FKawaiiFluidRayQueryHit> Hits;
+	TArray<FKawaiiFluidParticleRecord> Records;
+
+	double BuildSeconds = 0.0, SphereSeconds = 0.0, BoxSeconds = 0.0, RaySeconds = 0.0, NearestSeconds = 0.0;
+	int64 SphereResults = 0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		double T0 = FPlatformTime::Seconds();
+		BuildIndex(Index, Positions, Velocities, SourceIDs, 20.0f);
+		double T1 = FPlatformTime::Seconds();
+		BuildSeconds += T1 - T0;
+
+		Index.QuerySpheres(SphereQueries, Indices, Offsets);
+		Index.GetRecords(Indices, Records);
+		T0 = FPlatformTime::Seconds();
+		SphereSeconds += T0 - T1;
+		SphereResults += Indices.Num();
+
+		Index.QueryBoxes(BoxQueries, Indices, Offsets);
+		T1 = FPlatformTime::Seconds();
+		BoxSeconds += T1 - T0;
+
+		Index.Raycasts(RayQueries, Hits);
+		T0 = FPlatformTime::Seconds();
+		RaySeconds += T0 - T1;
+
+		Index.QueryNearestBatch(NearestQueries, Indices, Offsets);
+		NearestSeconds += FPlatformTime::Seconds() - T0;
+	}
+
+	// Brute force baseline (sampled, extrapolated to NumQueries)
+	const double BruteStart = FPlatformTime::Seconds();
+	int64 BruteResults = 0;
+	for (int32 q = 0; q < NumBruteForceQueries; ++q)
+	{
+		BruteResults += BruteForceSphere(Positions, SphereQueries[q].Center, SphereQueries[q].Radius).Num();
+	}
+	const double BruteMs = (FPlatformTime::Seconds() - BruteStart) * 1000.0 * NumQueries / NumBruteForceQueries;
+
+	Index.QuerySpheres(TConstArrayView<FKawaiiFluidSphereQuery>(SphereQueries.GetData(), NumBruteForceQueries), Indices, Offsets);
+	TestEqual(TEXT("Index and brute force agree on sampled sphere queries"), static_cast<int64>(Indices.Num()), BruteResults);
+
+	const double SphereMs = SphereSeconds * 1000.0 / NumFrames;
+	AddInfo(FString::Printf(TEXT("%d particles, %d queries/frame, cell size %.1f"), NumParticles, NumQueries, Index.GetCellSize()));
+	AddInfo(FString::Printf(TEXT("Build:          %.3f ms/frame"), BuildSeconds * 1000.0 / NumFrames));
+	AddInfo(FString::Printf(TEXT("Sphere r=50:    %.3f ms/frame (avg %.1f results, records included)"), SphereMs, static_cast<double>(SphereResults) / (NumFrames * NumQueries)));
+	AddInfo(FString::Printf(TEXT("Box 80x80x160:  %.3f ms/frame"), BoxSeconds * 1000.0 / NumFrames));
+	AddInfo(FString::Printf(TEXT("Ray 1000cm:     %.3f ms/frame"), RaySeconds * 1000.0 / NumFrames));
+	AddInfo(FString::Printf(TEXT("Nearest K=16:   %.3f ms/frame"), NearestSeconds * 1000.0 / NumFrames));
+	AddInfo(FString::Printf(TEXT("Brute force sphere (extrapolated): %.1f ms/frame"), BruteMs));
+
+	TestTrue(TEXT("Indexed sphere queries faster than brute force"), SphereMs < BruteMs);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
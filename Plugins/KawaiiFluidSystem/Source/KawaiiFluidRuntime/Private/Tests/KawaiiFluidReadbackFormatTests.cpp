@@ -0,0 +1,192 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Resources/GPUFluidReadbackFormat.h"
+#include "Simulation/Resources/GPUFluidReadbackSnapshot.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackFormatTest_LayoutStreams,
+	"KawaiiFluid.Simulation.ReadbackFormat.RF01_LayoutStreams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackFormatTest_CombineConsumerMasks,
+	"KawaiiFluid.Simulation.ReadbackFormat.RF02_CombineConsumerMasks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackFormatTest_FullPrecisionRoundTrip,
+	"KawaiiFluid.Simulation.ReadbackFormat.RF03_FullPrecisionRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackFormatTest_QuantizedRoundTrip,
+	"KawaiiFluid.Simulation.ReadbackFormat.RF04_QuantizedRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	const FVector3f TestBoundsMin(-500.0f, -300.0f, 0.0f);
+	const FVector3f TestBoundsMax(500.0f, 300.0f, 400.0f);
+
+	/**
+	 * @brief Helper: Deterministic particles spread over the test bounds.
+	 * @param Count Particle count.
+	 * @return Particles with distinct positions, velocities and IDs.
+	 */
+	TArray<FGPUFluidParticle> MakeParticles(int32 Count)
+	{
+		FRandomStream Random(1234);
+		TArray<FGPUFluidParticle> Particles;
+		Particles.SetNum(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FGPUFluidParticle& P = Particles[i];
+			P.Position = FVector3f(
+				Random.FRandRange(TestBoundsMin.X, TestBoundsMax.X),
+				Random.FRandRange(TestBoundsMin.Y, TestBoundsMax.Y),
+				Random.FRandRange(TestBoundsMin.Z, TestBoundsMax.Z));
+			P.Velocity = FVector3f(Random.FRandRange(-800.0f, 800.0f), Random.FRandRange(-800.0f, 800.0f), Random.FRandRange(-800.0f, 800.0f));
+			P.ParticleID = 1000 + i;
+			P.SourceID = i % 3;
+			P.Flags = (i % 2) ? EGPUParticleFlags::NearBoundary : 0;
+			P.NeighborCount = static_cast<uint32>(i * 7 % 40);
+		}
+		return Particles;
+	}
+}
+
+/** @brief RF-01: Streams are 16-byte aligned, absent fields have no stream, 16-bit streams round odd counts up to a pair. */
+bool FKawaiiFluidReadbackFormatTest_LayoutStreams::RunTest(const FString& Parameters)
+{
+	constexpr int32 Count = 37;
+
+	const FGPUReadbackLayout Speed = FGPUReadbackLayout::Build(EGPUReadbackField::Speed, Count, TestBoundsMin, TestBoundsMax);
+	TestEqual(TEXT("Speed-only stream at 0"), Speed.SpeedOffset, 0);
+	TestEqual(TEXT("No position stream"), Speed.PositionOffset, static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Speed-only size (aligned)"), Speed.TotalBytes, Align(Count * 4, 16));
+
+	const uint32 Mask = EGPUReadbackField::Position | EGPUReadbackField::Velocity | EGPUReadbackField::ParticleID
+		| EGPUReadbackField::AcceptQuantizedPosition | EGPUReadbackField::AcceptHalfVelocity;
+	const FGPUReadbackLayout Quantized = FGPUReadbackLayout::Build(Mask, Count, TestBoundsMin, TestBoundsMax);
+	TestTrue(TEXT("Quantized positions"), Quantized.bQuantizedPositions);
+	TestTrue(TEXT("Half velocities"), Quantized.bHalfVelocities);
+	TestEqual(TEXT("Position stream at 0"), Quantized.PositionOffset, 0);
+	TestEqual(TEXT("Velocity stream after 19 pairs, aligned"), Quantized.VelocityOffset, Align(19 * 12, 16));
+	TestEqual(TEXT("ParticleID stream aligned"), Quantized.ParticleIDOffset % 16, 0);
+	TestEqual(TEXT("No flags stream"), Quantized.FlagsOffset, static_cast<int32>(INDEX_NONE));
+	TestTrue(TEXT("Quantized layout is smaller than 64-byte particles"), Quantized.GetBytesPerParticle() < 16.0f);
+
+	const FGPUReadbackLayout Full = FGPUReadbackLayout::Build(Mask & EGPUReadbackField::AllFields, Count, TestBoundsMin, TestBoundsMax);
+	TestFalse(TEXT("Full precision without Accept bits"), Full.bQuantizedPositions || Full.bHalfVelocities);
+	TestEqual(TEXT("Full velocity stream after float3 positions"), Full.VelocityOffset, Align(Count * 12, 16));
+
+	return true;
+}
+
+/** @brief RF-02: Fields are unioned; a precision reduction survives only if every reader of that field accepts it. */
+bool FKawaiiFluidReadbackFormatTest_CombineConsumerMasks::RunTest(const FString& Parameters)
+{
+	const uint32 Shadow = EGPUReadbackField::Position | EGPUReadbackField::Velocity | EGPUReadbackField::NeighborCount
+		| EGPUReadbackField::AcceptQuantizedPosition | EGPUReadbackField::AcceptHalfVelocity;
+	const uint32 Query = EGPUReadbackField::Position | EGPUReadbackField::Velocity | EGPUReadbackField::SourceID;
+	const uint32 MaxVelocity = EGPUReadbackField::Speed;
+
+	const uint32 ShadowOnly[] = { Shadow, MaxVelocity };
+	const uint32 Combined = FGPUReadbackLayout::CombineConsumerMasks(ShadowOnly);
+	TestTrue(TEXT("Speed kept"), (Combined & EGPUReadbackField::Speed) != 0);
+	TestTrue(TEXT("Quantized positions accepted"), (Combined & EGPUReadbackField::AcceptQuantizedPosition) != 0);
+	TestTrue(TEXT("Half velocities accepted"), (Combined & EGPUReadbackField::AcceptHalfVelocity) != 0);
+
+	const uint32 WithQuery[] = { Shadow, Query, MaxVelocity };
+	const uint32 Strict = FGPUReadbackLayout::CombineConsumerMasks(WithQuery);
+	TestTrue(TEXT("Source IDs added"), (Strict & EGPUReadbackField::SourceID) != 0);
+	TestTrue(TEXT("Neighbor counts kept"), (Strict & EGPUReadbackField::NeighborCount) != 0);
+	TestFalse(TEXT("Query needs exact positions"), (Strict & EGPUReadbackField::AcceptQuantizedPosition) != 0);
+	TestFalse(TEXT("Query needs exact velocities"), (Strict & EGPUReadbackField::AcceptHalfVelocity) != 0);
+
+	const uint32 None[] = { EGPUReadbackField::None, EGPUReadbackField::None };
+	TestEqual(TEXT("No consumers, no fields"), FGPUReadbackLayout::CombineConsumerMasks(None), EGPUReadbackField::None);
+
+	return true;
+}
+
+/** @brief RF-03: Full-precision streams unpack bit-exact into the snapshot; unrequested fields stay empty. */
+bool FKawaiiFluidReadbackFormatTest_FullPrecisionRoundTrip::RunTest(const FString& Parameters)
+{
+	constexpr int32 Count = 37;
+	const TArray<FGPUFluidParticle> Particles = MakeParticles(Count);
+	const FGPUReadbackLayout Layout = FGPUReadbackLayout::Build(
+		EGPUReadbackField::Position | EGPUReadbackField::Velocity | EGPUReadbackField::ParticleID
+		| EGPUReadbackField::SourceID | EGPUReadbackField::Flags,
+		Count, TestBoundsMin, TestBoundsMax);
+
+	TArray<uint8> Packed;
+	GPUFluidReadbackUnpack::PackReadbackFields(Layout, Particles, Packed);
+	TestEqual(TEXT("Packed size"), Packed.Num(), Layout.TotalBytes);
+
+	FGPUFluidReadbackSnapshot Snapshot;
+	const float MaxSpeed = GPUFluidReadbackUnpack::UnpackReadbackFields(Layout, Packed.GetData(), Count, Snapshot);
+
+	float ExpectedMaxSpeed = 0.0f;
+	bool bExact = Snapshot.Positions.Num() == Count && Snapshot.Velocities.Num() == Count;
+	for (int32 i = 0; bExact && i < Count; ++i)
+	{
+		const FGPUFluidParticle& P = Particles[i];
+		bExact = Snapshot.Positions[i] == P.Position && Snapshot.Velocities[i] == P.Velocity
+			&& Snapshot.ParticleIDs[i] == P.ParticleID && Snapshot.SourceIDs[i] == P.SourceID && Snapshot.Flags[i] == P.Flags;
+		ExpectedMaxSpeed = FMath::Max(ExpectedMaxSpeed, P.Velocity.Length());
+	}
+	TestTrue(TEXT("Every field round-trips exactly"), bExact);
+	TestEqual(TEXT("Neighbor counts not requested"), Snapshot.NeighborCounts.Num(), 0);
+	TestEqual(TEXT("Max speed from velocity stream"), MaxSpeed, ExpectedMaxSpeed, 1.0e-3f);
+
+	const FGPUReadbackLayout IDsOnly = FGPUReadbackLayout::Build(EGPUReadbackField::ParticleID, Count, TestBoundsMin, TestBoundsMax);
+	GPUFluidReadbackUnpack::PackReadbackFields(IDsOnly, Particles, Packed);
+	FGPUFluidReadbackSnapshot IDSnapshot;
+	TestEqual(TEXT("No speed source reports -1"), GPUFluidReadbackUnpack::UnpackReadbackFields(IDsOnly, Packed.GetData(), Count, IDSnapshot), -1.0f);
+
+	return true;
+}
+
+/** @brief RF-04: 16-bit positions stay within one quantization step, half velocities within half precision (SIMD body and tail). */
+bool FKawaiiFluidReadbackFormatTest_QuantizedRoundTrip::RunTest(const FString& Parameters)
+{
+	constexpr int32 Count = 37;  // 4 SIMD iterations of 8 + odd tail
+	const TArray<FGPUFluidParticle> Particles = MakeParticles(Count);
+	const FGPUReadbackLayout Layout = FGPUReadbackLayout::Build(
+		EGPUReadbackField::Position | EGPUReadbackField::Velocity | EGPUReadbackField::Speed
+		| EGPUReadbackField::AcceptQuantizedPosition | EGPUReadbackField::AcceptHalfVelocity,
+		Count, TestBoundsMin, TestBoundsMax);
+
+	TArray<uint8> Packed;
+	GPUFluidReadbackUnpack::PackReadbackFields(Layout, Particles, Packed);
+
+	FGPUFluidReadbackSnapshot Snapshot;
+	const float MaxSpeed = GPUFluidReadbackUnpack::UnpackReadbackFields(Layout, Packed.GetData(), Count, Snapshot);
+	TestEqual(TEXT("Positions unpacked"), Snapshot.Positions.Num(), Count);
+	TestEqual(TEXT("Velocities unpacked"), Snapshot.Velocities.Num(), Count);
+
+	const FVector3f Step = Layout.QuantizeExtent / 65535.0f;
+	float MaxPositionError = 0.0f;
+	float MaxVelocityRelError = 0.0f;
+	float ExpectedMaxSpeed = 0.0f;
+	for (int32 i = 0; i < FMath::Min(Count, Snapshot.Positions.Num()); ++i)
+	{
+		const FVector3f PositionError = (Snapshot.Positions[i] - Particles[i].Position).GetAbs();
+		MaxPositionError = FMath::Max(MaxPositionError, (PositionError / Step).GetMax());
+
+		const FVector3f VelocityError = (Snapshot.Velocities[i] - Particles[i].Velocity).GetAbs();
+		MaxVelocityRelError = FMath::Max(MaxVelocityRelError, VelocityError.GetMax() / FMath::Max(Particles[i].Velocity.GetAbsMax(), 1.0f));
+
+		ExpectedMaxSpeed = FMath::Max(ExpectedMaxSpeed, Particles[i].Velocity.Length());
+	}
+
+	TestTrue(FString::Printf(TEXT("Position error within one step (%.3f steps)"), MaxPositionError), MaxPositionError <= 1.0f);
+	TestTrue(FString::Printf(TEXT("Half velocity relative error (%.5f)"), MaxVelocityRelError), MaxVelocityRelError <= 1.0e-3f);
+	TestEqual(TEXT("Max speed from speed stream (full precision)"), MaxSpeed, ExpectedMaxSpeed, 1.0e-3f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,200 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Simulation/Resources/GPUFluidReadbackSnapshot.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSnapshotTest_PublishAcquire,
+	"KawaiiFluid.Simulation.ReadbackSnapshot.RS01_PublishAcquire",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSnapshotTest_PinnedSlotsNotReused,
+	"KawaiiFluid.Simulation.ReadbackSnapshot.RS02_PinnedSlotsNotReused",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSnapshotTest_ClearKeepsViews,
+	"KawaiiFluid.Simulation.ReadbackSnapshot.RS03_ClearKeepsViews",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSnapshotTest_SourceIndexCountingSort,
+	"KawaiiFluid.Simulation.ReadbackSnapshot.RS04_SourceIndexCountingSort",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Publish a snapshot of Count particles whose X positions encode Frame.
+	 * @param Buffer Snapshot buffer to write.
+	 * @param Frame Frame number stamped on the snapshot.
+	 * @param Count Particle count.
+	 * @return true if a free slot was found and published.
+	 */
+	bool PublishFrame(FGPUFluidReadbackSnapshotBuffer& Buffer, uint64 Frame, int32 Count)
+	{
+		FGPUFluidReadbackSnapshot* Snapshot = Buffer.BeginWrite();
+		if (!Snapshot)
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Snapshot->Positions.Add(FVector3f(static_cast<float>(Frame), static_cast<float>(i), 0.0f));
+			Snapshot->ParticleIDs.Add(i);
+			Snapshot->SourceIDs.Add(i % 2);
+		}
+		Snapshot->SourceIndex.Build(Snapshot->SourceIDs, Snapshot->ParticleIDs);
+		Snapshot->FrameNumber = Frame;
+		Buffer.Publish();
+		return true;
+	}
+}
+
+/** @brief RS-01: Acquire returns the latest published snapshot; optional arrays stay empty unless filled. */
+bool FKawaiiFluidReadbackSnapshotTest_PublishAcquire::RunTest(const FString& Parameters)
+{
+	FGPUFluidReadbackSnapshotBuffer Buffer;
+	TestFalse(TEXT("Empty view before first publish"), Buffer.Acquire().IsValid());
+
+	TestTrue(TEXT("First publish"), PublishFrame(Buffer, 1, 4));
+	TestTrue(TEXT("Second publish"), PublishFrame(Buffer, 2, 8));
+
+	const FGPUFluidReadbackSnapshotView View = Buffer.Acquire();
+	TestTrue(TEXT("View valid"), View.IsValid());
+	TestEqual(TEXT("Latest frame"), View.GetFrameNumber(), static_cast<uint64>(2));
+	TestEqual(TEXT("Latest count"), View.Num(), 8);
+	TestEqual(TEXT("Positions from latest frame"), View.GetPositions()[7].X, 2.0f);
+	TestFalse(TEXT("No velocities unless read back"), View.HasVelocities());
+	TestEqual(TEXT("Velocity view empty"), View.GetVelocities().Num(), 0);
+	TestFalse(TEXT("No neighbor counts unless read back"), View.HasNeighborCounts());
+
+	return true;
+}
+
+/** @brief RS-02: Pinned slots are never refilled; the writer drops updates once every spare slot is pinned. */
+bool FKawaiiFluidReadbackSnapshotTest_PinnedSlotsNotReused::RunTest(const FString& Parameters)
+{
+	FGPUFluidReadbackSnapshotBuffer Buffer;
+	PublishFrame(Buffer, 1, 4);
+	FGPUFluidReadbackSnapshotView Frame1 = Buffer.Acquire();
+
+	PublishFrame(Buffer, 2, 4);
+	FGPUFluidReadbackSnapshotView Frame2 = Buffer.Acquire();
+
+	// Published slot (frame 2) pinned, frame 1 pinned: only one free slot remains
+	TestTrue(TEXT("Third slot still free"), PublishFrame(Buffer, 3, 4));
+	FGPUFluidReadbackSnapshotView Frame3 = Buffer.Acquire();
+
+	// Frame 3 published and pinned, frames 1 and 2 pinned: nothing to write into
+	TestFalse(TEXT("Publish dropped while all slots pinned"), PublishFrame(Buffer, 4, 4));
+	TestEqual(TEXT("Pinned frame 1 unchanged"), Frame1.GetPositions()[0].X, 1.0f);
+	TestEqual(TEXT("Pinned frame 2 unchanged"), Frame2.GetPositions()[0].X, 2.0f);
+	TestEqual(TEXT("Latest still frame 3"), Buffer.Acquire().GetFrameNumber(), static_cast<uint64>(3));
+
+	// Releasing an old view frees its slot for the next publish
+	Frame1.Release();
+	TestFalse(TEXT("Released view is empty"), Frame1.IsValid());
+	TestTrue(TEXT("Publish succeeds after release"), PublishFrame(Buffer, 4, 4));
+	TestEqual(TEXT("Frame 2 still intact"), Frame2.GetPositions()[3].Y, 3.0f);
+	TestEqual(TEXT("Frame 3 still intact"), Frame3.GetFrameNumber(), static_cast<uint64>(3));
+	TestEqual(TEXT("Latest frame 4"), Buffer.Acquire().GetFrameNumber(), static_cast<uint64>(4));
+
+	// Moved-from views hold no pin
+	FGPUFluidReadbackSnapshotView Moved = MoveTemp(Frame2);
+	TestFalse(TEXT("Moved-from view empty"), Frame2.IsValid());
+	TestEqual(TEXT("Moved view keeps data"), Moved.GetFrameNumber(), static_cast<uint64>(2));
+
+	return true;
+}
+
+/** @brief RS-03: Clear unpublishes for new readers while existing views keep their data. */
+bool FKawaiiFluidReadbackSnapshotTest_ClearKeepsViews::RunTest(const FString& Parameters)
+{
+	FGPUFluidReadbackSnapshotBuffer Buffer;
+	PublishFrame(Buffer, 5, 6);
+	const FGPUFluidReadbackSnapshotView Held = Buffer.Acquire();
+
+	Buffer.Clear();
+	TestFalse(TEXT("Nothing published after clear"), Buffer.HasPublished());
+	TestFalse(TEXT("New view empty after clear"), Buffer.Acquire().IsValid());
+	TestEqual(TEXT("Held view keeps its particles"), Held.Num(), 6);
+	TestEqual(TEXT("Held view source IDs intact"), Held.GetSourceIDs()[5], 1);
+	TestEqual(TEXT("Held view source index intact"), Held.GetParticleIDsBySourceID(1).Num(), 3);
+
+	TestTrue(TEXT("Publish after clear"), PublishFrame(Buffer, 6, 2));
+	TestEqual(TEXT("Held view untouched by next publish"), Held.GetFrameNumber(), static_cast<uint64>(5));
+
+	return true;
+}
+
+/** @brief RS-04: Counting sort groups particles by source stably, skips invalid sources and matches a naive filter across chunks. */
+bool FKawaiiFluidReadbackSnapshotTest_SourceIndexCountingSort::RunTest(const FString& Parameters)
+{
+	// Large enough for several counting sort chunks
+	constexpr int32 Count = 50000;
+	TArray<int32> SourceIDs;
+	TArray<int32> ParticleIDs;
+	SourceIDs.SetNumUninitialized(Count);
+	ParticleIDs.SetNumUninitialized(Count);
+	FRandomStream Random(42);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		// Mostly valid sources, some invalid (-1) and out-of-range (MaxSourceCount)
+		const int32 Roll = Random.RandRange(0, 99);
+		SourceIDs[i] = Roll < 3 ? EGPUParticleSource::InvalidSourceID
+			: Roll < 5 ? EGPUParticleSource::MaxSourceCount
+			: Random.RandRange(0, 7);
+		ParticleIDs[i] = 100000 + i;
+	}
+
+	FGPUFluidSourceIndex Index;
+	Index.Build(SourceIDs, ParticleIDs);
+	TestTrue(TEXT("Index built"), Index.IsBuilt());
+
+	int32 IndexedTotal = 0;
+	bool bMatchesFilter = true;
+	for (int32 SourceID = 0; SourceID < FGPUFluidSourceIndex::NumSources; ++SourceID)
+	{
+		TArray<int32> Expected;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (SourceIDs[i] == SourceID)
+			{
+				Expected.Add(i);
+			}
+		}
+
+		const TConstArrayView<int32> Indices = Index.GetIndices(SourceID);
+		const TConstArrayView<int32> IDs = Index.GetParticleIDs(SourceID);
+		bMatchesFilter &= Indices.Num() == Expected.Num() && IDs.Num() == Expected.Num();
+		for (int32 k = 0; bMatchesFilter && k < Expected.Num(); ++k)
+		{
+			// Stable: same order as the particle array
+			bMatchesFilter = Indices[k] == Expected[k] && IDs[k] == ParticleIDs[Expected[k]];
+		}
+		IndexedTotal += Indices.Num();
+	}
+	TestTrue(TEXT("Every source range matches a stable filter"), bMatchesFilter);
+
+	int32 ValidTotal = 0;
+	for (const int32 SourceID : SourceIDs)
+	{
+		ValidTotal += (SourceID >= 0 && SourceID < EGPUParticleSource::MaxSourceCount) ? 1 : 0;
+	}
+	TestEqual(TEXT("Invalid sources left out"), IndexedTotal, ValidTotal);
+	TestEqual(TEXT("Out-of-range query empty"), Index.GetIndices(EGPUParticleSource::MaxSourceCount).Num(), 0);
+
+	// Rebuild with a smaller input reuses storage and drops stale ranges
+	const int32 SmallSources[] = { 3, 1, 3 };
+	Index.Build(SmallSources, TConstArrayView<int32>());
+	TestEqual(TEXT("Rebuilt source 3"), Index.Num(3), 2);
+	TestEqual(TEXT("Rebuilt source 3 second index"), Index.GetIndices(3)[1], 2);
+	TestEqual(TEXT("Stale source cleared"), Index.Num(7), 0);
+	TestEqual(TEXT("No IDs when built without them"), Index.GetParticleIDs(1).Num(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
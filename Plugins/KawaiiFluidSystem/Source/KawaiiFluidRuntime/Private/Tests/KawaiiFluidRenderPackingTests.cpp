@@ -0,0 +1,257 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Math/Float16.h"
+#include "Core/KawaiiFluidRenderParticle.h"
+#include "Rendering/Resources/KawaiiFluidPackedRenderParticle.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidRenderPackingTest_PositionCodes,
+	"KawaiiFluid.Rendering.RenderPacking.RP01_PositionCodes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidRenderPackingTest_VelocityRoundTrip,
+	"KawaiiFluid.Rendering.RenderPacking.RP02_VelocityRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidRenderPackingTest_AnisotropyRoundTrip,
+	"KawaiiFluid.Rendering.RenderPacking.RP03_AnisotropyRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidRenderPackingTest_CulledAndSize,
+	"KawaiiFluid.Rendering.RenderPacking.RP04_CulledAndSize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	const FVector3f TestBoundsMin(-812.5f, -40.0f, 3.0f);
+	const FVector3f TestBoundsMax(1187.5f, 260.0f, 403.0f);
+
+	/** @brief Helper: Angle between two unit vectors in degrees. */
+	float GetAngleDegrees(const FVector3f& A, const FVector3f& B)
+	{
+		return FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(FVector3f::DotProduct(A, B), -1.0f, 1.0f)));
+	}
+
+	/**
+	 * @brief Helper: Evenly spread unit directions (Fibonacci sphere) plus the octahedron fold seams.
+	 * @param Count Number of sphere samples.
+	 * @return Unit directions.
+	 */
+	TArray<FVector3f> MakeDirections(int32 Count)
+	{
+		TArray<FVector3f> Directions;
+		Directions.Reserve(Count + 14);
+		const float GoldenAngle = UE_PI * (3.0f - FMath::Sqrt(5.0f));
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const float Z = 1.0f - 2.0f * (i + 0.5f) / Count;
+			const float Ring = FMath::Sqrt(FMath::Max(1.0f - Z * Z, 0.0f));
+			Directions.Add(FVector3f(FMath::Cos(GoldenAngle * i) * Ring, FMath::Sin(GoldenAngle * i) * Ring, Z));
+		}
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			FVector3f Unit = FVector3f::ZeroVector;
+			Unit[Axis] = 1.0f;
+			Directions.Add(Unit);
+			Directions.Add(-Unit);
+		}
+		for (const float SX : { -1.0f, 1.0f })
+		{
+			for (const float SY : { -1.0f, 1.0f })
+			{
+				Directions.Add(FVector3f(SX, SY, 0.0f).GetSafeNormal());
+				Directions.Add(FVector3f(SX, SY, -0.001f).GetSafeNormal());
+			}
+		}
+		return Directions;
+	}
+}
+
+/** @brief RP-01: Every 16-bit position code decodes and re-encodes to itself; random positions stay within half a step. */
+bool FKawaiiFluidRenderPackingTest_PositionCodes::RunTest(const FString& Parameters)
+{
+	using namespace KawaiiFluidRenderPacking;
+	const FVector3f Extent = GetBoundsExtent(TestBoundsMin, TestBoundsMax);
+
+	// Exhaustive: all 65536 codes on every axis
+	int32 NumMismatched = 0;
+	for (uint32 Code = 0; Code <= 0xFFFFu; ++Code)
+	{
+		FKawaiiFluidPackedRenderParticle Packed;
+		Packed.PositionXY = Code | ((0xFFFFu - Code) << 16);
+		Packed.PositionZSpeed = Code;
+
+		FVector3f Position, Velocity;
+		UnpackParticle(Packed, TestBoundsMin, Extent, Position, Velocity);
+		const FKawaiiFluidPackedRenderParticle Repacked = PackParticle(Position, FVector3f::ZeroVector, TestBoundsMin, Extent);
+		NumMismatched += (Repacked.PositionXY != Packed.PositionXY || (Repacked.PositionZSpeed & 0xFFFFu) != Code) ? 1 : 0;
+	}
+	TestEqual(TEXT("All position codes round-trip"), NumMismatched, 0);
+
+	FRandomStream Random(38);
+	const FVector3f MaxError = Extent / (2.0f * 65535.0f) + FVector3f(1e-3f);
+	bool bWithinHalfStep = true;
+	for (int32 i = 0; i < 100000; ++i)
+	{
+		const FVector3f Original(
+			Random.FRandRange(TestBoundsMin.X, TestBoundsMax.X),
+			Random.FRandRange(TestBoundsMin.Y, TestBoundsMax.Y),
+			Random.FRandRange(TestBoundsMin.Z, TestBoundsMax.Z));
+
+		FVector3f Position, Velocity;
+		UnpackParticle(PackParticle(Original, FVector3f::ZeroVector, TestBoundsMin, Extent), TestBoundsMin, Extent, Position, Velocity);
+		const FVector3f Error = (Position - Original).GetAbs();
+		bWithinHalfStep &= Error.X <= MaxError.X && Error.Y <= MaxError.Y && Error.Z <= MaxError.Z;
+	}
+	TestTrue(FString::Printf(TEXT("Positions within half a step (%.4f cm on X)"), MaxError.X), bWithinHalfStep);
+
+	// Outside the box clamps to the faces
+	FVector3f Clamped, Velocity;
+	UnpackParticle(PackParticle(TestBoundsMax + FVector3f(50.0f), FVector3f::ZeroVector, TestBoundsMin, Extent), TestBoundsMin, Extent, Clamped, Velocity);
+	TestTrue(TEXT("Out-of-box position clamps to the max corner"), Clamped.Equals(TestBoundsMax, 1e-2f));
+
+	// Degenerate bounds stay invertible
+	TestTrue(TEXT("Flat bounds get a 1 cm extent"), GetBoundsExtent(FVector3f(5.0f), FVector3f(5.0f)).Equals(FVector3f(1.0f)));
+
+	return true;
+}
+
+/** @brief RP-02: Octahedral direction and half speed: exhaustive speed codes, dense directions, zero velocity. */
+bool FKawaiiFluidRenderPackingTest_VelocityRoundTrip::RunTest(const FString& Parameters)
+{
+	using namespace KawaiiFluidRenderPacking;
+	const FVector3f Extent = GetBoundsExtent(TestBoundsMin, TestBoundsMax);
+
+	// Directions: dense sphere sampling plus fold seams
+	float MaxAngle = 0.0f;
+	int32 NumCulledCodes = 0;
+	for (const FVector3f& Direction : MakeDirections(200000))
+	{
+		const FKawaiiFluidPackedRenderParticle Packed = PackParticle(TestBoundsMin, Direction * 250.0f, TestBoundsMin, Extent);
+		NumCulledCodes += (Packed.Direction & 0xFFFFu) == CulledDirection ? 1 : 0;
+
+		FVector3f Position, Velocity;
+		UnpackParticle(Packed, TestBoundsMin, Extent, Position, Velocity);
+		MaxAngle = FMath::Max(MaxAngle, GetAngleDegrees(Velocity.GetSafeNormal(), Direction));
+	}
+	AddInfo(FString::Printf(TEXT("Max direction error %.5f deg"), MaxAngle));
+	TestTrue(TEXT("Direction error below 0.01 deg"), MaxAngle < 0.01f);
+	TestEqual(TEXT("Encoder never emits the culled code"), NumCulledCodes, 0);
+
+	// Speeds: every finite non-negative half round-trips bit-exactly
+	int32 NumSpeedMismatched = 0;
+	for (uint32 Code = 0; Code < 0x7C00u; ++Code)
+	{
+		FFloat16 Half;
+		Half.Encoded = static_cast<uint16>(Code);
+		const float Speed = Half.GetFloat();
+		if (Speed <= 0.0f)
+		{
+			continue;
+		}
+
+		const FKawaiiFluidPackedRenderParticle Packed = PackParticle(TestBoundsMin, FVector3f(0.0f, 0.0f, Speed), TestBoundsMin, Extent);
+		NumSpeedMismatched += (Packed.PositionZSpeed >> 16) != Code ? 1 : 0;
+	}
+	TestEqual(TEXT("All half speed codes round-trip"), NumSpeedMismatched, 0);
+
+	FVector3f Position, Velocity;
+	UnpackParticle(PackParticle(TestBoundsMin, FVector3f(3.0e5f, 0.0f, 0.0f), TestBoundsMin, Extent), TestBoundsMin, Extent, Position, Velocity);
+	TestTrue(TEXT("Speeds beyond half range saturate"), FMath::IsFinite(Velocity.X) && FMath::IsNearlyEqual(Velocity.X, 65504.0f, 1.0f));
+
+	UnpackParticle(PackParticle(TestBoundsMin, FVector3f::ZeroVector, TestBoundsMin, Extent), TestBoundsMin, Extent, Position, Velocity);
+	TestTrue(TEXT("Zero velocity stays zero"), Velocity.IsZero());
+
+	return true;
+}
+
+/** @brief RP-03: Anisotropy: exhaustive scale codes, random (and left-handed) bases, q/-q equivalence. */
+bool FKawaiiFluidRenderPackingTest_AnisotropyRoundTrip::RunTest(const FString& Parameters)
+{
+	using namespace KawaiiFluidRenderPacking;
+
+	// Scales: all 1024 codes per axis
+	const float ScaleStep = MaxAnisotropyScale / 1023.0f;
+	int32 NumScaleMismatched = 0;
+	for (uint32 Code = 0; Code < 1024; ++Code)
+	{
+		const float Scale = Code * ScaleStep;
+		const FKawaiiFluidPackedAnisotropy Packed = PackAnisotropy(
+			FVector4f(1.0f, 0.0f, 0.0f, Scale), FVector4f(0.0f, 1.0f, 0.0f, Scale), FVector4f(0.0f, 0.0f, 1.0f, Scale));
+		NumScaleMismatched += Packed.Scales != (Code | (Code << 10) | (Code << 20)) ? 1 : 0;
+	}
+	TestEqual(TEXT("All scale codes round-trip"), NumScaleMismatched, 0);
+
+	// Rotations: every code of each component with each dropped index decodes to a unit quaternion that repacks to itself
+	int32 NumRotationMismatched = 0;
+	for (uint32 Largest = 0; Largest < 4; ++Largest)
+	{
+		for (uint32 Code = 0; Code < 1024; ++Code)
+		{
+			const uint32 Packed = Largest | (Code << 2) | (511u << 12) | (511u << 22);
+			const FQuat4f Rotation = UnpackQuaternion(Packed);
+			const uint32 Repacked = PackQuaternion(Rotation);
+			NumRotationMismatched += (FMath::Abs(Rotation.Size() - 1.0f) > 1e-5f || UnpackQuaternion(Repacked).AngularDistance(Rotation) > 5e-3f) ? 1 : 0;
+		}
+	}
+	TestEqual(TEXT("Quaternion codes decode to stable unit rotations"), NumRotationMismatched, 0);
+
+	FRandomStream Random(39);
+	float MaxAngle = 0.0f;
+	float MaxScaleError = 0.0f;
+	bool bSignInvariant = true;
+	for (int32 i = 0; i < 50000; ++i)
+	{
+		FQuat4f Rotation(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f));
+		Rotation.Normalize();
+		bSignInvariant &= PackQuaternion(Rotation) == PackQuaternion(FQuat4f(-Rotation.X, -Rotation.Y, -Rotation.Z, -Rotation.W));
+
+		const FVector3f Axis1 = Rotation.GetAxisX();
+		const FVector3f Axis2 = Rotation.GetAxisY();
+		// Every other basis is left-handed, as the eigensolver may emit
+		const FVector3f Axis3 = (i % 2) ? -Rotation.GetAxisZ() : Rotation.GetAxisZ();
+		const FVector3f Scales(Random.FRandRange(0.2f, 5.0f), Random.FRandRange(0.2f, 5.0f), Random.FRandRange(0.2f, 5.0f));
+
+		FVector4f Out1, Out2, Out3;
+		UnpackAnisotropy(PackAnisotropy(FVector4f(Axis1, Scales.X), FVector4f(Axis2, Scales.Y), FVector4f(Axis3, Scales.Z)), Out1, Out2, Out3);
+
+		// Ellipsoids are symmetric: an axis and its negation describe the same shape
+		MaxAngle = FMath::Max(MaxAngle, GetAngleDegrees(FVector3f(Out1), Axis1));
+		MaxAngle = FMath::Max(MaxAngle, GetAngleDegrees(FVector3f(Out2), Axis2));
+		MaxAngle = FMath::Max(MaxAngle, FMath::Min(GetAngleDegrees(FVector3f(Out3), Axis3), GetAngleDegrees(FVector3f(Out3), -Axis3)));
+		MaxScaleError = FMath::Max(MaxScaleError, FMath::Max3(FMath::Abs(Out1.W - Scales.X), FMath::Abs(Out2.W - Scales.Y), FMath::Abs(Out3.W - Scales.Z)));
+	}
+	AddInfo(FString::Printf(TEXT("Max axis error %.4f deg, max scale error %.5f"), MaxAngle, MaxScaleError));
+	TestTrue(TEXT("Axis error below 0.25 deg"), MaxAngle < 0.25f);
+	TestTrue(TEXT("Scale error within half a step"), MaxScaleError <= ScaleStep * 0.5f + 1e-5f);
+	TestTrue(TEXT("q and -q pack identically"), bSignInvariant);
+
+	return true;
+}
+
+/** @brief RP-04: Culled particles are flagged, and the packed format is well under half the full-precision footprint. */
+bool FKawaiiFluidRenderPackingTest_CulledAndSize::RunTest(const FString& Parameters)
+{
+	using namespace KawaiiFluidRenderPacking;
+	const FVector3f Extent = GetBoundsExtent(TestBoundsMin, TestBoundsMax);
+
+	FVector3f Position(123.0f), Velocity(456.0f);
+	TestFalse(TEXT("Culled particle does not unpack"), UnpackParticle(MakeCulledParticle(), TestBoundsMin, Extent, Position, Velocity));
+	TestTrue(TEXT("Culled particle leaves outputs untouched"), Position.Equals(FVector3f(123.0f)) && Velocity.Equals(FVector3f(456.0f)));
+
+	// Depth pass reads per particle: position + velocity + render offset + 3 anisotropy axes
+	const int32 FullBytes = 3 * sizeof(FVector3f) + 3 * sizeof(FVector4f);
+	const int32 PackedBytes = sizeof(FKawaiiFluidPackedRenderParticle) + sizeof(FKawaiiFluidPackedAnisotropy);
+	AddInfo(FString::Printf(TEXT("Depth pass: %d -> %d bytes per particle; thickness pass: %d -> %d"),
+		FullBytes, PackedBytes, static_cast<int32>(sizeof(FVector3f)), static_cast<int32>(sizeof(FKawaiiFluidPackedRenderParticle))));
+	TestTrue(TEXT("Packed depth inputs at most half of full precision"), PackedBytes * 2 <= FullBytes);
+	TestTrue(TEXT("Packed particle smaller than the AoS render particle"), sizeof(FKawaiiFluidPackedRenderParticle) * 2 <= sizeof(FKawaiiFluidRenderParticle));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,216 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Algo/Reverse.h"
+#include "Rendering/KawaiiFluidShadowClusterer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_LatticeCellBlob,
+	"KawaiiFluid.Rendering.ShadowCluster.SC01_LatticeCellBlob",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_SparseDropletsKept,
+	"KawaiiFluid.Rendering.ShadowCluster.SC02_SparseDropletsKept",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_PoolCoverage,
+	"KawaiiFluid.Rendering.ShadowCluster.SC03_PoolCoverage",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_ShadowCluster,
+	"KawaiiFluid.Benchmark.ShadowCluster",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Jittered box of particles at rest spacing (2 * Radius), in Z-major order.
+	 * @param Min Box corner.
+	 * @param Count Particles per axis.
+	 * @param Radius Particle radius.
+	 * @param Jitter Random offset per particle (cm).
+	 * @param Seed Random seed.
+	 * @return Particle positions.
+	 */
+	TArray<FVector> MakeBox(const FVector& Min, const FIntVector& Count, float Radius, float Jitter, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector> Positions;
+		Positions.Reserve(Count.X * Count.Y * Count.Z);
+		for (int32 Z = 0; Z < Count.Z; ++Z)
+		{
+			for (int32 Y = 0; Y < Count.Y; ++Y)
+			{
+				for (int32 X = 0; X < Count.X; ++X)
+				{
+					const FVector Lattice = (FVector(X, Y, Z) + FVector(0.5)) * (2.0 * Radius);
+					Positions.Add(Min + Lattice + Random.VRand() * Jitter);
+				}
+			}
+		}
+		return Positions;
+	}
+
+	/** @brief Helper: Normalized distance of a point from a blob grown by Padding (<= 1 inside). */
+	double GetBlobDistance(const FKawaiiFluidShadowBlob& Blob, const FVector& Point, double Padding)
+	{
+		return ((Point - Blob.Center) / (Blob.HalfExtent + FVector(Padding))).Size();
+	}
+}
+
+/** @brief SC-01: A filled 2x2x2 cell becomes one blob spanning exactly the particles' rest volume. */
+bool FKawaiiFluidShadowClusterTest_LatticeCellBlob::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidShadowClusterParams Params;
+	Params.ParticleRadius = 5.0f;
+	Params.CellSizeScale = 2.0f;
+
+	// Cell [0, 20)^3 holds a 2x2x2 lattice at 5 and 15
+	const TArray<FVector> Positions = MakeBox(FVector::ZeroVector, FIntVector(2, 2, 2), Params.ParticleRadius, 0.0f, 1);
+
+	FKawaiiFluidShadowClusterer Clusterer;
+	TArray<FKawaiiFluidShadowBlob> Blobs;
+	Clusterer.Cluster(Positions, Params, Blobs);
+
+	TestEqual(TEXT("One blob"), Blobs.Num(), 1);
+	if (Blobs.Num() == 1)
+	{
+		TestTrue(TEXT("Centered on the centroid"), Blobs[0].Center.Equals(FVector(10.0), 1e-3));
+		TestTrue(FString::Printf(TEXT("Half extent %s covers the cell"), *Blobs[0].HalfExtent.ToString()),
+			Blobs[0].HalfExtent.Equals(FVector(10.0), 1e-2));
+	}
+
+	return true;
+}
+
+/** @brief SC-02: Cells below MinClusterParticles keep one sphere per particle. */
+bool FKawaiiFluidShadowClusterTest_SparseDropletsKept::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidShadowClusterParams Params;
+	Params.ParticleRadius = 5.0f;
+	Params.MinClusterParticles = 4;
+
+	// Dense cell (8 particles) plus three isolated droplets far apart
+	TArray<FVector> Positions = MakeBox(FVector::ZeroVector, FIntVector(2, 2, 2), Params.ParticleRadius, 0.5f, 2);
+	Positions.Add(FVector(200.0, 0.0, 0.0));
+	Positions.Add(FVector(-300.0, 50.0, 10.0));
+	Positions.Add(FVector(0.0, 0.0, 500.0));
+
+	FKawaiiFluidShadowClusterer Clusterer;
+	TArray<FKawaiiFluidShadowBlob> Blobs;
+	Clusterer.Cluster(Positions, Params, Blobs);
+
+	TestEqual(TEXT("1 blob + 3 droplets"), Blobs.Num(), 4);
+	for (int32 i = 1; i < Blobs.Num(); ++i)
+	{
+		TestTrue(TEXT("Droplet keeps its position"), Blobs[i].Center.Equals(Positions[8 + i - 1]));
+		TestTrue(TEXT("Droplet keeps its radius"), Blobs[i].HalfExtent.Equals(FVector(Params.ParticleRadius)));
+	}
+
+	// Ordering is by first occurrence: droplets first when listed first
+	Algo::Reverse(Positions);
+	Clusterer.Cluster(Positions, Params, Blobs);
+	TestTrue(TEXT("First occurrence order"), Blobs.Num() == 4 && Blobs[0].Center.Equals(FVector(0.0, 0.0, 500.0)));
+
+	return true;
+}
+
+/** @brief SC-03: A jittered pool collapses several-fold and every particle sphere still overlaps a blob. */
+bool FKawaiiFluidShadowClusterTest_PoolCoverage::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidShadowClusterParams Params;
+	Params.ParticleRadius = 5.0f;
+
+	const TArray<FVector> Positions = MakeBox(FVector(13.0, -7.0, 2.0), FIntVector(12, 12, 6), Params.ParticleRadius, 1.0f, 3);
+
+	FKawaiiFluidShadowClusterer Clusterer;
+	TArray<FKawaiiFluidShadowBlob> Blobs;
+	Clusterer.Cluster(Positions, Params, Blobs);
+
+	const double Reduction = static_cast<double>(Positions.Num()) / FMath::Max(1, Blobs.Num());
+	TestTrue(FString::Printf(TEXT("Instance reduction %.1fx"), Reduction), Reduction > 4.0);
+
+	int32 NumUncovered = 0;
+	for (const FVector& Position : Positions)
+	{
+		double Nearest = TNumericLimits<double>::Max();
+		for (const FKawaiiFluidShadowBlob& Blob : Blobs)
+		{
+			Nearest = FMath::Min(Nearest, GetBlobDistance(Blob, Position, Params.ParticleRadius));
+		}
+		NumUncovered += Nearest > 1.0 ? 1 : 0;
+	}
+	TestEqual(TEXT("Every particle within a radius of a blob"), NumUncovered, 0);
+
+	const double MaxHalfExtent = Params.GetCellSize() * 0.5 + Params.ParticleRadius;
+	bool bBounded = true;
+	for (const FKawaiiFluidShadowBlob& Blob : Blobs)
+	{
+		bBounded &= Blob.HalfExtent.GetMax() <= MaxHalfExtent + UE_KINDA_SMALL_NUMBER;
+		bBounded &= Blob.HalfExtent.GetMin() >= Params.ParticleRadius - UE_KINDA_SMALL_NUMBER;
+	}
+	TestTrue(TEXT("Blob extents within [radius, half cell + radius]"), bBounded);
+
+	return true;
+}
+
+/**
+ * @brief Shadow Cluster Benchmark.
+ * Game-thread cost of producing shadow instances for 200k particles: one sphere per particle
+ * (previous path) versus grid clustering, plus the resulting instance counts.
+ */
+bool FKawaiiFluidBenchmark_ShadowCluster::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumIterations = 10;
+
+	FKawaiiFluidShadowClusterParams Params;
+	Params.ParticleRadius = 5.0f;
+	const TArray<FVector> Positions = MakeBox(FVector::ZeroVector, FIntVector(100, 100, 20), Params.ParticleRadius, 1.0f, 4);
+
+	// Baseline: one transform per particle
+	TArray<FTransform> Transforms;
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Transforms.SetNumUninitialized(Positions.Num(), EAllowShrinking::No);
+		for (int32 i = 0; i < Positions.Num(); ++i)
+		{
+			Transforms[i] = FTransform(FQuat::Identity, Positions[i], FVector(Params.ParticleRadius / 50.0));
+		}
+	}
+	const double PerParticleMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumIterations;
+
+	FKawaiiFluidShadowClusterer Clusterer;
+	TArray<FKawaiiFluidShadowBlob> Blobs;
+	for (const float CellScale : { 1.0f, 2.0f, 4.0f })
+	{
+		Params.CellSizeScale = CellScale;
+		Clusterer.Cluster(Positions, Params, Blobs);
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Clusterer.Cluster(Positions, Params, Blobs);
+			Transforms.SetNumUninitialized(Blobs.Num(), EAllowShrinking::No);
+			for (int32 i = 0; i < Blobs.Num(); ++i)
+			{
+				Transforms[i] = FTransform(FQuat::Identity, Blobs[i].Center, Blobs[i].HalfExtent / 50.0);
+			}
+		}
+		const double ClusterMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumIterations;
+
+		AddInfo(FString::Printf(TEXT("Cell %.0fx diameter: %d -> %d instances (%.1fx fewer), %.2f ms"),
+			CellScale, Positions.Num(), Blobs.Num(), static_cast<double>(Positions.Num()) / FMath::Max(1, Blobs.Num()), ClusterMs));
+	}
+
+	AddInfo(FString::Printf(TEXT("Per-particle transforms: %d instances, %.2f ms"), Positions.Num(), PerParticleMs));
+	TestTrue(TEXT("Clustering reduces instances"), Blobs.Num() < Positions.Num() / 8);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
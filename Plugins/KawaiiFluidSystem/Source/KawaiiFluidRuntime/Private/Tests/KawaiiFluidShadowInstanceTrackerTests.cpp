@@ -0,0 +1,231 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Algo/Reverse.h"
+#include "Rendering/KawaiiFluidShadowInstanceTracker.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowTrackerTest_StaticNoUploads,
+	"KawaiiFluid.Rendering.ShadowTracker.ST01_StaticNoUploads",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowTrackerTest_SwapRemove,
+	"KawaiiFluid.Rendering.ShadowTracker.ST02_SwapRemove",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowTrackerTest_ReuseFreedSlot,
+	"KawaiiFluid.Rendering.ShadowTracker.ST03_ReuseFreedSlot",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowTrackerTest_RandomChurn,
+	"KawaiiFluid.Rendering.ShadowTracker.ST04_RandomChurn",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TrackerTolerance = 0.5f;
+	constexpr float TrackerMeshRadius = 50.0f;
+
+	/** @brief Helper: Unit-scale instance transform at a location. */
+	FTransform MakeInstance(const FVector& Location)
+	{
+		return FTransform(FQuat::Identity, Location, FVector(0.1));
+	}
+
+	/**
+	 * @brief Helper: Apply the tracker's reported changes to a mirror of the ISM, the way the renderer subsystem does.
+	 * @param Tracker Tracker after Update.
+	 * @param Uploaded Mirror of the uploaded transforms (resized to the slot count).
+	 */
+	void ApplyDirtySlots(const FKawaiiFluidShadowInstanceTracker& Tracker, TArray<FTransform>& Uploaded)
+	{
+		Uploaded.SetNum(Tracker.GetNumSlots());
+		for (const int32 Slot : Tracker.GetDirtySlots())
+		{
+			Uploaded[Slot] = Tracker.GetSlotTransforms()[Slot];
+		}
+	}
+}
+
+/** @brief ST-01: Unchanged or sub-tolerance instances produce no uploads; a real move dirties only its slot. */
+bool FKawaiiFluidShadowTrackerTest_StaticNoUploads::RunTest(const FString& Parameters)
+{
+	TArray<uint64> Keys;
+	TArray<FTransform> Transforms;
+	for (int32 i = 0; i < 100; ++i)
+	{
+		Keys.Add(1000 + i);
+		Transforms.Add(MakeInstance(FVector(i * 10.0, 0.0, 0.0)));
+	}
+
+	FKawaiiFluidShadowInstanceTracker Tracker;
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+	TestEqual(TEXT("First update uploads everything"), Tracker.GetDirtySlots().Num(), 100);
+
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+	TestEqual(TEXT("Unchanged frame uploads nothing"), Tracker.GetDirtySlots().Num(), 0);
+
+	// Same keys in another order still map to their slots
+	TArray<uint64> ReversedKeys(Keys);
+	TArray<FTransform> ReversedTransforms(Transforms);
+	Algo::Reverse(ReversedKeys);
+	Algo::Reverse(ReversedTransforms);
+	Tracker.Update(ReversedKeys, ReversedTransforms, TrackerTolerance, TrackerMeshRadius);
+	TestEqual(TEXT("Reordered input uploads nothing"), Tracker.GetDirtySlots().Num(), 0);
+
+	for (FTransform& Transform : Transforms)
+	{
+		Transform.AddToTranslation(FVector(0.0, 0.0, TrackerTolerance * 0.5));
+	}
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+	TestEqual(TEXT("Sub-tolerance jitter uploads nothing"), Tracker.GetDirtySlots().Num(), 0);
+
+	Transforms[42].AddToTranslation(FVector(5.0, 0.0, 0.0));
+	Transforms[7].SetScale3D(FVector(0.2));
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+	TestTrue(TEXT("Moved and resized instances dirty"), Tracker.GetDirtySlots().Num() == 2
+		&& Tracker.GetDirtySlots()[0] == 7 && Tracker.GetDirtySlots()[1] == 42);
+
+	return true;
+}
+
+/** @brief ST-02: A vanished key is filled by the last slot; nothing else is rewritten. */
+bool FKawaiiFluidShadowTrackerTest_SwapRemove::RunTest(const FString& Parameters)
+{
+	TArray<uint64> Keys;
+	TArray<FTransform> Transforms;
+	for (int32 i = 0; i < 10; ++i)
+	{
+		Keys.Add(i);
+		Transforms.Add(MakeInstance(FVector(i * 10.0, 0.0, 0.0)));
+	}
+
+	FKawaiiFluidShadowInstanceTracker Tracker;
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+
+	Keys.RemoveAt(3);
+	Transforms.RemoveAt(3);
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+
+	TestEqual(TEXT("One slot fewer"), Tracker.GetNumSlots(), 9);
+	TestEqual(TEXT("Previous slot count kept for parking"), Tracker.GetPrevNumSlots(), 10);
+	TestEqual(TEXT("Last key moved into the hole"), Tracker.GetSlotKeys()[3], static_cast<uint64>(9));
+	TestTrue(TEXT("Only the hole is rewritten"), Tracker.GetDirtySlots().Num() == 1 && Tracker.GetDirtySlots()[0] == 3);
+	TestTrue(TEXT("Moved slot carries its transform"), Tracker.GetSlotTransforms()[3].GetTranslation().Equals(FVector(90.0, 0.0, 0.0)));
+
+	// Removing the last key needs no rewrite at all
+	Keys.Pop();
+	Transforms.Pop();
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+	TestEqual(TEXT("Tail removal shrinks"), Tracker.GetNumSlots(), 8);
+	TestEqual(TEXT("Tail removal uploads nothing"), Tracker.GetDirtySlots().Num(), 0);
+
+	return true;
+}
+
+/** @brief ST-03: A new key reuses a freed slot in place; duplicates are ignored. */
+bool FKawaiiFluidShadowTrackerTest_ReuseFreedSlot::RunTest(const FString& Parameters)
+{
+	TArray<uint64> Keys = { 10, 11, 12, 13 };
+	TArray<FTransform> Transforms;
+	for (int32 i = 0; i < Keys.Num(); ++i)
+	{
+		Transforms.Add(MakeInstance(FVector(i * 10.0, 0.0, 0.0)));
+	}
+
+	FKawaiiFluidShadowInstanceTracker Tracker;
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+
+	// 11 leaves, 99 arrives (listed twice)
+	Keys = { 10, 99, 12, 13, 99 };
+	Transforms.Insert(MakeInstance(FVector(500.0)), 4);
+	Transforms[1] = MakeInstance(FVector(-50.0));
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+
+	TestEqual(TEXT("Slot count unchanged"), Tracker.GetNumSlots(), 4);
+	TestEqual(TEXT("New key took the freed slot"), Tracker.GetSlotKeys()[1], static_cast<uint64>(99));
+	TestTrue(TEXT("First occurrence wins"), Tracker.GetSlotTransforms()[1].GetTranslation().Equals(FVector(-50.0)));
+	TestTrue(TEXT("Only the reused slot is rewritten"), Tracker.GetDirtySlots().Num() == 1 && Tracker.GetDirtySlots()[0] == 1);
+
+	Tracker.Reset();
+	Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+	TestEqual(TEXT("Reset re-uploads every unique key"), Tracker.GetDirtySlots().Num(), 4);
+
+	return true;
+}
+
+/** @brief ST-04: Random spawn/despawn/move churn: applying only dirty slots reproduces the desired instance set. */
+bool FKawaiiFluidShadowTrackerTest_RandomChurn::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(37);
+	TMap<uint64, FVector> Live;
+	uint64 NextKey = 0;
+	for (int32 i = 0; i < 500; ++i)
+	{
+		Live.Add(NextKey++, Random.VRand() * 100.0);
+	}
+
+	FKawaiiFluidShadowInstanceTracker Tracker;
+	TArray<FTransform> Uploaded;
+	int32 TotalDirty = 0;
+	bool bConsistent = true;
+
+	for (int32 Frame = 0; Frame < 60; ++Frame)
+	{
+		// Despawn ~5%, spawn ~5%, move ~10% (the rest sleeps)
+		TArray<uint64> LiveKeys;
+		Live.GetKeys(LiveKeys);
+		for (const uint64 Key : LiveKeys)
+		{
+			const float Roll = Random.FRand();
+			if (Roll < 0.05f)
+			{
+				Live.Remove(Key);
+			}
+			else if (Roll < 0.15f)
+			{
+				Live[Key] += Random.VRand() * 3.0;
+			}
+		}
+		const int32 NumSpawn = Random.RandRange(0, 50);
+		for (int32 i = 0; i < NumSpawn; ++i)
+		{
+			Live.Add(NextKey++, Random.VRand() * 100.0);
+		}
+
+		TArray<uint64> Keys;
+		TArray<FTransform> Transforms;
+		for (const TPair<uint64, FVector>& Pair : Live)
+		{
+			Keys.Add(Pair.Key);
+			Transforms.Add(MakeInstance(Pair.Value));
+		}
+
+		Tracker.Update(Keys, Transforms, TrackerTolerance, TrackerMeshRadius);
+		ApplyDirtySlots(Tracker, Uploaded);
+		TotalDirty += Tracker.GetDirtySlots().Num();
+
+		// Every live key owns exactly one slot whose uploaded transform is within tolerance
+		bConsistent &= Tracker.GetNumSlots() == Live.Num();
+		TSet<uint64> SeenKeys;
+		for (int32 Slot = 0; Slot < Tracker.GetNumSlots(); ++Slot)
+		{
+			const uint64 Key = Tracker.GetSlotKeys()[Slot];
+			const FVector* Desired = Live.Find(Key);
+			bConsistent &= Desired != nullptr && !SeenKeys.Contains(Key);
+			bConsistent &= Desired && FVector::Dist(Uploaded[Slot].GetTranslation(), *Desired) <= TrackerTolerance + UE_KINDA_SMALL_NUMBER;
+			SeenKeys.Add(Key);
+		}
+	}
+
+	TestTrue(TEXT("Uploaded mirror matches the live set every frame"), bConsistent);
+	AddInfo(FString::Printf(TEXT("%d slot uploads over 60 frames (~%d live instances)"), TotalDirty, Live.Num()));
+	TestTrue(TEXT("Far fewer uploads than full rewrites"), TotalDirty < 60 * Live.Num() / 3);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
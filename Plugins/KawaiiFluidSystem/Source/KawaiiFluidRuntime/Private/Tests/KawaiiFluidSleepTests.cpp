@@ -0,0 +1,197 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Simulation/Physics/KawaiiFluidSleepSolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSleepTest_SleepAfterThreshold,
+	"KawaiiFluid.Simulation.Sleep.SL01_SleepAfterThreshold",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSleepTest_NeighborWake,
+	"KawaiiFluid.Simulation.Sleep.SL02_NeighborWake",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSleepTest_AllAsleepEarlyOut,
+	"KawaiiFluid.Simulation.Sleep.SL03_AllAsleepEarlyOut",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSleepTest_WorkingSetRoundTrip,
+	"KawaiiFluid.Simulation.Sleep.SL04_WorkingSetRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSleepTest_SpawnWake,
+	"KawaiiFluid.Simulation.Sleep.SL05_SpawnWake",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Row of particles along X, one per deactivation cell.
+	 * @param Count Number of particles.
+	 * @param Spacing Distance between particles (cm).
+	 * @param bSleeping Initial sleep state.
+	 * @return Particle array with IDs 0..Count-1.
+	 */
+	TArray<FKawaiiFluidParticle> MakeParticleRow(int32 Count, float Spacing, bool bSleeping)
+	{
+		TArray<FKawaiiFluidParticle> Particles;
+		Particles.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FKawaiiFluidParticle& Particle = Particles.Add_GetRef(FKawaiiFluidParticle(FVector(i * Spacing + 0.5f * Spacing, 0.5f * Spacing, 0.5f * Spacing), i));
+			Particle.bIsSleeping = bSleeping;
+		}
+		return Particles;
+	}
+}
+
+/** @brief SL-01: A slow particle sleeps exactly after SleepFrameThreshold substeps; a fast one never does. */
+bool FKawaiiFluidSleepTest_SleepAfterThreshold::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSleepSolver Solver;
+	FKawaiiFluidSleepParams Params;
+	Params.SleepFrameThreshold = 10;
+
+	TArray<FKawaiiFluidParticle> Particles = MakeParticleRow(2, 100.0f, false);
+	Particles[0].Velocity = FVector(1.0f, 0.0f, 0.0f);
+	Particles[1].Velocity = FVector(50.0f, 0.0f, 0.0f);
+
+	for (int32 Step = 0; Step < Params.SleepFrameThreshold - 1; ++Step)
+	{
+		Solver.UpdateSleepStates(Particles, Params);
+	}
+	TestFalse(TEXT("Slow particle still awake one substep before threshold"), Particles[0].bIsSleeping);
+
+	Solver.UpdateSleepStates(Particles, Params);
+	TestTrue(TEXT("Slow particle asleep at threshold"), Particles[0].bIsSleeping);
+	TestEqual(TEXT("Sleeping particle velocity zeroed"), Particles[0].Velocity, FVector::ZeroVector);
+	TestFalse(TEXT("Fast particle never sleeps"), Particles[1].bIsSleeping);
+	TestEqual(TEXT("Fast particle counter stays reset"), Particles[1].SleepCounter, 0);
+
+	return true;
+}
+
+/** @brief SL-02: A sleeper wakes from a fast awake neighbor (one hop per update) and from a collider box. */
+bool FKawaiiFluidSleepTest_NeighborWake::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSleepSolver Solver;
+	FKawaiiFluidSleepParams Params;
+
+	// Chain 0 - 1 - 2: particle 0 awake and fast, 1 and 2 asleep
+	TArray<FKawaiiFluidParticle> Particles = MakeParticleRow(3, 10.0f, true);
+	Particles[0].bIsSleeping = false;
+	Particles[0].Velocity = FVector(100.0f, 0.0f, 0.0f);
+	Particles[0].NeighborIndices = { 1 };
+	Particles[1].NeighborIndices = { 0, 2 };
+	Particles[2].NeighborIndices = { 1 };
+
+	Solver.UpdateSleepStates(Particles, Params);
+	TestFalse(TEXT("Direct neighbor woken"), Particles[1].bIsSleeping);
+	TestTrue(TEXT("Wake does not skip a hop within one update"), Particles[2].bIsSleeping);
+
+	// Woken particle at rest does not propagate further
+	Solver.UpdateSleepStates(Particles, Params);
+	TestTrue(TEXT("Resting woken neighbor does not wake the next one"), Particles[2].bIsSleeping);
+
+	const int32 Woken = Solver.WakeInBounds(Particles, FBox(FVector(15.0f, 0.0f, 0.0f), FVector(30.0f, 10.0f, 10.0f)));
+	TestEqual(TEXT("Collider box wakes one particle"), Woken, 1);
+	TestFalse(TEXT("Particle inside collider box awake"), Particles[2].bIsSleeping);
+
+	return true;
+}
+
+/** @brief SL-03: A fully asleep array skips the substep and stays skipped until something wakes. */
+bool FKawaiiFluidSleepTest_AllAsleepEarlyOut::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSleepSolver Solver;
+	const float CellSize = 10.0f;
+
+	TArray<FKawaiiFluidParticle> Particles = MakeParticleRow(64, CellSize, true);
+
+	TestFalse(TEXT("All asleep: substep skipped"), Solver.BuildActiveSet(Particles, CellSize));
+	TestFalse(TEXT("Cached early out on the next substep"), Solver.BuildActiveSet(Particles, CellSize));
+	TestEqual(TEXT("No awake particles"), Solver.GetStats().AwakeParticles, 0);
+
+	Solver.WakeInBounds(Particles, FBox(FVector(0.0f), FVector(CellSize)));
+	TestTrue(TEXT("Woken particle re-enables the substep"), Solver.BuildActiveSet(Particles, CellSize));
+	TestEqual(TEXT("One awake particle"), Solver.GetStats().AwakeParticles, 1);
+
+	return true;
+}
+
+/** @brief SL-04: Far sleeping cells are excluded from the working set and survive gather/scatter unchanged. */
+bool FKawaiiFluidSleepTest_WorkingSetRoundTrip::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSleepSolver Solver;
+	const float CellSize = 10.0f;
+	const int32 Count = 32;
+
+	// Particle 0 awake: its cell and the next are active, the one after is halo, the rest inactive
+	TArray<FKawaiiFluidParticle> Particles = MakeParticleRow(Count, CellSize, true);
+	Particles[0].bIsSleeping = false;
+
+	TestTrue(TEXT("Substep runs"), Solver.BuildActiveSet(Particles, CellSize));
+	TestTrue(TEXT("Inactive particles present"), Solver.HasInactiveParticles());
+	TestEqual(TEXT("Working set = awake + active ring + halo ring"), Solver.GetStats().SimulatedParticles, 3);
+	TestEqual(TEXT("Active cells"), Solver.GetStats().ActiveCells, 2);
+
+	TArray<FKawaiiFluidParticle>& Working = Solver.GatherWorkingSet(Particles);
+	TestEqual(TEXT("Gathered working set size"), Working.Num(), 3);
+
+	// Working-set-local neighbor indices are remapped back to full-array indices on scatter
+	for (int32 j = 0; j < Working.Num(); ++j)
+	{
+		Working[j].NeighborIndices.Reset();
+		for (int32 k = 0; k < Working.Num(); ++k)
+		{
+			Working[j].NeighborIndices.Add(k);
+		}
+		Working[j].Position.Z += 1.0f;
+	}
+	Solver.ScatterWorkingSet(Particles);
+
+	TestEqual(TEXT("Array size unchanged"), Particles.Num(), Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		TestEqual(TEXT("Particle order preserved"), Particles[i].ParticleID, i);
+	}
+	TestEqual(TEXT("Working particle written back"), Particles[2].Position.Z, 0.5f * CellSize + 1.0f);
+	TestEqual(TEXT("Inactive particle untouched"), Particles[Count - 1].Position.Z, 0.5f * CellSize);
+
+	bool bNeighborsRemapped = true;
+	for (const int32 NeighborIndex : Particles[1].NeighborIndices)
+	{
+		bNeighborsRemapped &= NeighborIndex >= 0 && NeighborIndex <= 2;
+	}
+	TestTrue(TEXT("Neighbor indices remapped to full array"), bNeighborsRemapped && Particles[1].NeighborIndices.Num() == 3);
+
+	return true;
+}
+
+/** @brief SL-05: A particle spawned at rest onto a settled pool wakes the sleepers around it, and only those. */
+bool FKawaiiFluidSleepTest_SpawnWake::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSleepSolver Solver;
+	const float CellSize = 10.0f;
+	const int32 Count = 16;
+
+	TArray<FKawaiiFluidParticle> Particles = MakeParticleRow(Count, CellSize, true);
+	TestEqual(TEXT("Nothing to wake before the first build"), Solver.WakeNearSpawned(Particles, CellSize), 0);
+	TestFalse(TEXT("Settled pool skipped"), Solver.BuildActiveSet(Particles, CellSize));
+
+	// Spawned at rest above particle 8: no speed for the neighbor wake to pick up
+	Particles.Add(FKawaiiFluidParticle(Particles[8].Position + FVector(0.0f, 0.0f, CellSize), Count));
+
+	TestEqual(TEXT("Sleepers in the three cells around the spawn woken"), Solver.WakeNearSpawned(Particles, CellSize), 3);
+	TestFalse(TEXT("Sleeper under the spawn awake"), Particles[8].bIsSleeping);
+	TestTrue(TEXT("Far sleeper untouched"), Particles[0].bIsSleeping);
+	TestTrue(TEXT("Substep runs again"), Solver.BuildActiveSet(Particles, CellSize));
+	TestEqual(TEXT("No second wake for the same spawn"), Solver.WakeNearSpawned(Particles, CellSize), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
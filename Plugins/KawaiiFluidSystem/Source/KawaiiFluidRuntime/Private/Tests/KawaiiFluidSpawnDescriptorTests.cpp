@@ -0,0 +1,480 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/Utils/KawaiiFluidSpawnDescriptor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnDescriptorTest_RowTableMatchesPerPoint,
+	"KawaiiFluid.Simulation.SpawnDescriptor.SD01_RowTableMatchesPerPoint",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnDescriptorTest_MaxCountTruncation,
+	"KawaiiFluid.Simulation.SpawnDescriptor.SD02_MaxCountTruncation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnDescriptorTest_DeterministicExpand,
+	"KawaiiFluid.Simulation.SpawnDescriptor.SD03_DeterministicExpand",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnDescriptorTest_JitterStaysInside,
+	"KawaiiFluid.Simulation.SpawnDescriptor.SD04_JitterStaysInside",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnDescriptorTest_HemisphereStroke,
+	"KawaiiFluid.Simulation.SpawnDescriptor.SD05_HemisphereStroke",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_SpawnDescriptor,
+	"KawaiiFluid.Benchmark.SpawnDescriptor",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Descriptor at the origin with identity rotation and no jitter.
+	 * @param Shape Lattice shape.
+	 * @param Extent Shape extent.
+	 * @param Spacing Particle spacing.
+	 * @return Spawn descriptor.
+	 */
+	FKawaiiFluidSpawnDescriptor MakeDescriptor(EKawaiiFluidSpawnShape Shape, const FVector& Extent, float Spacing)
+	{
+		FKawaiiFluidSpawnDescriptor Descriptor;
+		Descriptor.Shape = Shape;
+		Descriptor.Extent = Extent;
+		Descriptor.Spacing = Spacing;
+		Descriptor.SourceID = 3;
+		return Descriptor;
+	}
+
+	/**
+	 * @brief Helper: Per-point reference generation (the emitter's former nested x/y/z loops), unjittered, local space.
+	 * @param Descriptor Spawn descriptor (Center and Rotation ignored).
+	 * @param MaxCount Point limit in lattice order (0 = unlimited).
+	 * @return Points in lattice order.
+	 */
+	TArray<FVector3f> GenerateReferencePoints(const FKawaiiFluidSpawnDescriptor& Descriptor, int32 MaxCount = 0)
+	{
+		TArray<FVector3f> Points;
+		const FVector3f Extent(Descriptor.Extent);
+		const float RadiusSq = Extent.X * Extent.X;
+		const auto IsFull = [&Points, MaxCount]() { return MaxCount > 0 && Points.Num() >= MaxCount; };
+
+		if (Descriptor.Shape == EKawaiiFluidSpawnShape::Disc)
+		{
+			const float Spacing = Descriptor.Spacing;
+			const float RowSpacing = Spacing * FMath::Sqrt(3.0f) * 0.5f;
+			const int32 HalfRows = (FMath::CeilToInt(Extent.X / RowSpacing) * 2 + 1) / 2;
+			for (int32 Row = -HalfRows; Row <= HalfRows && !IsFull(); ++Row)
+			{
+				const float LocalY = Row * RowSpacing;
+				if (LocalY * LocalY > RadiusSq)
+				{
+					continue;
+				}
+				const float XOffset = (FMath::Abs(Row) % 2 != 0) ? Spacing * 0.5f : 0.0f;
+				const int32 NumCols = FMath::FloorToInt(FMath::Sqrt(RadiusSq - LocalY * LocalY) / Spacing);
+				for (int32 Col = -NumCols; Col <= NumCols && !IsFull(); ++Col)
+				{
+					const float LocalX = Col * Spacing + XOffset;
+					if (LocalX * LocalX + LocalY * LocalY <= RadiusSq)
+					{
+						Points.Add(FVector3f(LocalX, LocalY, 0.0f));
+					}
+				}
+			}
+			return Points;
+		}
+
+		const float S = Descriptor.Spacing * KawaiiFluidSpawnLattice::HCPCompensation;
+		const float Ry = S * 0.866025f;
+		const float Lz = S * 0.816497f;
+
+		int32 XLo, XHi, YLo, YHi, ZLo, ZHi;
+		FVector3f Start = FVector3f::ZeroVector;
+		if (Descriptor.Shape == EKawaiiFluidSpawnShape::Box)
+		{
+			XLo = YLo = ZLo = 0;
+			XHi = FMath::Max(1, FMath::CeilToInt(Extent.X * 2.0f / S)) - 1;
+			YHi = FMath::Max(1, FMath::CeilToInt(Extent.Y * 2.0f / Ry)) - 1;
+			ZHi = FMath::Max(1, FMath::CeilToInt(Extent.Z * 2.0f / Lz)) - 1;
+			Start = FVector3f(-Extent.X + S * 0.5f, -Extent.Y + Ry * 0.5f, -Extent.Z + Lz * 0.5f);
+		}
+		else
+		{
+			XHi = FMath::CeilToInt(Extent.X / S) + 1;
+			YHi = FMath::CeilToInt(Extent.X / Ry) + 1;
+			ZHi = Descriptor.Shape == EKawaiiFluidSpawnShape::Sphere ? FMath::CeilToInt(Extent.X / Lz) + 1 : FMath::CeilToInt(Extent.Z / Lz);
+			XLo = -XHi; YLo = -YHi; ZLo = -ZHi;
+		}
+
+		for (int32 z = ZLo; z <= ZHi && !IsFull(); ++z)
+		{
+			const int32 ZMod = (z - ZLo) % 3;
+			const float ZOffsetX = (ZMod == 1) ? S * 0.5f : ((ZMod == 2) ? S * 0.25f : 0.0f);
+			const float ZOffsetY = (ZMod == 1) ? Ry / 3.0f : ((ZMod == 2) ? Ry * 2.0f / 3.0f : 0.0f);
+			for (int32 y = YLo; y <= YHi && !IsFull(); ++y)
+			{
+				const float RowOffsetX = ((y - YLo) % 2 == 1) ? S * 0.5f : 0.0f;
+				for (int32 x = XLo; x <= XHi && !IsFull(); ++x)
+				{
+					const FVector3f P(Start.X + x * S + RowOffsetX + ZOffsetX, Start.Y + y * Ry + ZOffsetY, Start.Z + z * Lz);
+					bool bInside = false;
+					switch (Descriptor.Shape)
+					{
+					case EKawaiiFluidSpawnShape::Sphere:
+						bInside = P.SizeSquared() <= RadiusSq;
+						break;
+					case EKawaiiFluidSpawnShape::Box:
+						bInside = FMath::Abs(P.X) <= Extent.X && FMath::Abs(P.Y) <= Extent.Y && FMath::Abs(P.Z) <= Extent.Z;
+						break;
+					default:
+						bInside = P.X * P.X + P.Y * P.Y <= RadiusSq && FMath::Abs(P.Z) <= Extent.Z;
+						break;
+					}
+					if (bInside)
+					{
+						Points.Add(P);
+					}
+				}
+			}
+		}
+		return Points;
+	}
+
+	/**
+	 * @brief Helper: Compare a plan against reference points, index by index.
+	 * @param Test Owning test (for error reporting).
+	 * @param Label Case name.
+	 * @param Plan Built plan (origin, identity rotation, no jitter).
+	 * @param Reference Reference points.
+	 * @return True if counts and every position match.
+	 */
+	bool MatchesReference(FAutomationTestBase& Test, const TCHAR* Label, const FKawaiiFluidSpawnPlan& Plan, const TArray<FVector3f>& Reference)
+	{
+		if (Plan.Num() != Reference.Num())
+		{
+			Test.AddError(FString::Printf(TEXT("%s: plan has %d points, reference %d"), Label, Plan.Num(), Reference.Num()));
+			return false;
+		}
+		for (int32 i = 0; i < Reference.Num(); ++i)
+		{
+			if (!Plan.GetPosition(i).Equals(Reference[i], 1e-3f))
+			{
+				Test.AddError(FString::Printf(TEXT("%s: point %d differs (%s vs %s)"), Label, i,
+					*Plan.GetPosition(i).ToString(), *Reference[i].ToString()));
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+/**
+ * @brief SD-01: The analytic row table yields exactly the points of the per-point lattice loop, in the same order.
+ */
+bool FKawaiiFluidSpawnDescriptorTest_RowTableMatchesPerPoint::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidSpawnDescriptor Cases[] =
+	{
+		MakeDescriptor(EKawaiiFluidSpawnShape::Sphere, FVector(50.0), 5.0f),
+		MakeDescriptor(EKawaiiFluidSpawnShape::Sphere, FVector(7.3), 4.0f),
+		MakeDescriptor(EKawaiiFluidSpawnShape::Box, FVector(40.0, 30.0, 20.0), 5.0f),
+		MakeDescriptor(EKawaiiFluidSpawnShape::Box, FVector(1.0, 1.0, 1.0), 5.0f),
+		MakeDescriptor(EKawaiiFluidSpawnShape::Cylinder, FVector(30.0, 30.0, 25.0), 5.0f),
+		MakeDescriptor(EKawaiiFluidSpawnShape::Disc, FVector(25.0, 25.0, 0.0), 5.0f),
+		MakeDescriptor(EKawaiiFluidSpawnShape::Disc, FVector(3.0, 3.0, 0.0), 5.0f),
+	};
+	const TCHAR* Labels[] = { TEXT("Sphere"), TEXT("SmallSphere"), TEXT("Box"), TEXT("TinyBox"), TEXT("Cylinder"), TEXT("Disc"), TEXT("TinyDisc") };
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Cases); ++i)
+	{
+		FKawaiiFluidSpawnPlan Plan;
+		Plan.Build(Cases[i]);
+		MatchesReference(*this, Labels[i], Plan, GenerateReferencePoints(Cases[i]));
+	}
+
+	// Degenerate descriptors spawn nothing
+	FKawaiiFluidSpawnPlan EmptyPlan;
+	EmptyPlan.Build(MakeDescriptor(EKawaiiFluidSpawnShape::Sphere, FVector(50.0), 0.0f));
+	TestTrue(TEXT("Zero spacing spawns nothing"), EmptyPlan.IsEmpty());
+	EmptyPlan.Build(MakeDescriptor(EKawaiiFluidSpawnShape::Cylinder, FVector(30.0, 30.0, 0.0), 5.0f));
+	TestTrue(TEXT("Zero height cylinder spawns nothing"), EmptyPlan.IsEmpty());
+
+	return true;
+}
+
+/**
+ * @brief SD-02: MaxCount keeps exactly the first points in lattice order, as the per-point loop's early break did.
+ */
+bool FKawaiiFluidSpawnDescriptorTest_MaxCountTruncation::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSpawnDescriptor Descriptor = MakeDescriptor(EKawaiiFluidSpawnShape::Sphere, FVector(40.0), 5.0f);
+	const int32 FullCount = GenerateReferencePoints(Descriptor).Num();
+
+	for (const int32 MaxCount : { 1, 137, FullCount - 1, FullCount, FullCount + 50 })
+	{
+		Descriptor.MaxCount = MaxCount;
+		FKawaiiFluidSpawnPlan Plan;
+		Plan.Build(Descriptor);
+		MatchesReference(*this, *FString::Printf(TEXT("MaxCount=%d"), MaxCount), Plan, GenerateReferencePoints(Descriptor, MaxCount));
+	}
+
+	return true;
+}
+
+/**
+ * @brief SD-03: Positions depend only on the plan and the index: parallel Expand equals GetPosition, same seed reproduces.
+ */
+bool FKawaiiFluidSpawnDescriptorTest_DeterministicExpand::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSpawnDescriptor Descriptor = MakeDescriptor(EKawaiiFluidSpawnShape::Cylinder, FVector(40.0, 40.0, 30.0), 4.0f);
+	Descriptor.Center = FVector(120.0, -35.0, 400.0);
+	Descriptor.Rotation = FQuat(FRotator(20.0, 45.0, -10.0));
+	Descriptor.JitterRange = 1.0f;
+	Descriptor.JitterSeed = 1234u;
+	Descriptor.Velocity = FVector3f(0.0f, 0.0f, -250.0f);
+	Descriptor.Mass = 0.5f;
+
+	FKawaiiFluidSpawnPlan Plan;
+	Plan.Build(Descriptor);
+
+	TArray<FGPUSpawnRequest> Requests;
+	Requests.SetNum(Plan.Num());
+	Plan.Expand(Requests);
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < Requests.Num(); ++i)
+	{
+		const FGPUSpawnRequest& Request = Requests[i];
+		if (!Request.Position.Equals(Plan.GetPosition(i), 0.0f) || Request.Velocity != Descriptor.Velocity ||
+			Request.Mass != Descriptor.Mass || Request.SourceID != Descriptor.SourceID)
+		{
+			++Mismatches;
+		}
+	}
+	TestEqual(TEXT("Expand matches GetPosition for every particle"), Mismatches, 0);
+
+	// Same seed reproduces, a different seed moves particles
+	FKawaiiFluidSpawnPlan SameSeed;
+	SameSeed.Build(Descriptor);
+	Descriptor.JitterSeed = 4321u;
+	FKawaiiFluidSpawnPlan OtherSeed;
+	OtherSeed.Build(Descriptor);
+
+	int32 SameDiffers = 0, OtherDiffers = 0;
+	for (int32 i = 0; i < Plan.Num(); ++i)
+	{
+		SameDiffers += Plan.GetPosition(i) != SameSeed.GetPosition(i) ? 1 : 0;
+		OtherDiffers += Plan.GetPosition(i) != OtherSeed.GetPosition(i) ? 1 : 0;
+	}
+	TestEqual(TEXT("Same seed reproduces every position"), SameDiffers, 0);
+	TestTrue(TEXT("Different seed changes interior positions"), OtherDiffers > Plan.Num() / 2);
+
+	// Hash maps to [-1, 1)
+	float MinUnit = 1.0f, MaxUnit = -1.0f;
+	for (int32 i = 0; i < 4096; ++i)
+	{
+		const FUintVector3 Hash = KawaiiFluidSpawnLattice::Hash(i, -i, i * 7, 99u);
+		MinUnit = FMath::Min3(MinUnit, KawaiiFluidSpawnLattice::ToSignedUnit(Hash.X), KawaiiFluidSpawnLattice::ToSignedUnit(Hash.Y));
+		MaxUnit = FMath::Max3(MaxUnit, KawaiiFluidSpawnLattice::ToSignedUnit(Hash.X), KawaiiFluidSpawnLattice::ToSignedUnit(Hash.Y));
+	}
+	TestTrue(TEXT("Signed unit in [-1, 1)"), MinUnit >= -1.0f && MaxUnit < 1.0f);
+	TestTrue(TEXT("Signed unit covers the range"), MinUnit < -0.99f && MaxUnit > 0.99f);
+
+	return true;
+}
+
+/**
+ * @brief SD-04: Jitter falls off toward the surface, so jittered particles stay inside the shape.
+ */
+bool FKawaiiFluidSpawnDescriptorTest_JitterStaysInside::RunTest(const FString& Parameters)
+{
+	// Sphere: world-axis jitter scaled by (1 - r/R)
+	{
+		FKawaiiFluidSpawnDescriptor Descriptor = MakeDescriptor(EKawaiiFluidSpawnShape::Sphere, FVector(30.0), 5.0f);
+		Descriptor.Center = FVector(10.0, 20.0, 30.0);
+		Descriptor.JitterRange = 5.0f * KawaiiFluidSpawnLattice::HCPCompensation * 0.2f;
+		Descriptor.JitterSeed = 7u;
+
+		FKawaiiFluidSpawnPlan Plan;
+		Plan.Build(Descriptor);
+
+		int32 Outside = 0;
+		for (int32 i = 0; i < Plan.Num(); ++i)
+		{
+			Outside += FVector::Distance(FVector(Plan.GetPosition(i)), Descriptor.Center) > 30.0 + 1e-3 ? 1 : 0;
+		}
+		TestEqual(TEXT("Jittered sphere particles inside"), Outside, 0);
+	}
+
+	// Disc: in-plane jitter bounded by the rim distance, membership decided before jitter
+	{
+		FKawaiiFluidSpawnDescriptor Descriptor = MakeDescriptor(EKawaiiFluidSpawnShape::Disc, FVector(20.0, 20.0, 0.0), 4.0f);
+		Descriptor.Center = FVector(0.0, 0.0, 100.0);
+		Descriptor.Rotation = KawaiiFluidSpawnLattice::MakeDiscRotation(FVector(0.3, -0.2, -1.0));
+		Descriptor.JitterRange = 4.0f * 0.5f;
+		Descriptor.JitterSeed = 11u;
+
+		FKawaiiFluidSpawnPlan Plan;
+		Plan.Build(Descriptor);
+
+		const FVector Normal = FVector(0.3, -0.2, -1.0).GetSafeNormal();
+		int32 Outside = 0, OffPlane = 0;
+		for (int32 i = 0; i < Plan.Num(); ++i)
+		{
+			const FVector Offset = FVector(Plan.GetPosition(i)) - Descriptor.Center;
+			Outside += Offset.Size() > 20.0 + 1e-3 ? 1 : 0;
+			OffPlane += FMath::Abs(Offset | Normal) > 1e-3 ? 1 : 0;
+		}
+		TestTrue(TEXT("Disc has particles"), Plan.Num() > 0);
+		TestEqual(TEXT("Jittered disc particles inside the rim"), Outside, 0);
+		TestEqual(TEXT("Disc particles stay in the layer plane"), OffPlane, 0);
+	}
+
+	return true;
+}
+
+/**
+ * @brief SD-05: A brush stroke is one Hemisphere row of MaxCount samples in the shell above the surface,
+ * replayed by seed, with a bounded occupancy grid for overlap rejection.
+ */
+bool FKawaiiFluidSpawnDescriptorTest_HemisphereStroke::RunTest(const FString& Parameters)
+{
+	const FVector Normal = FVector(0.2, -0.4, 1.0).GetSafeNormal();
+
+	FKawaiiFluidSpawnDescriptor Descriptor;
+	Descriptor.Shape = EKawaiiFluidSpawnShape::Hemisphere;
+	Descriptor.Center = FVector(50.0, -20.0, 10.0);
+	Descriptor.Rotation = KawaiiFluidSpawnLattice::MakeHemisphereRotation(Normal);
+	Descriptor.Extent = FVector(30.0, 12.0, 0.0);
+	Descriptor.MaxCount = 500;
+	Descriptor.JitterSeed = 77u;
+
+	FKawaiiFluidSpawnPlan Plan;
+	Plan.Build(Descriptor);
+	TestEqual(TEXT("One sample per requested particle"), Plan.Num(), 500);
+
+	int32 OutsideShell = 0, BelowSurface = 0;
+	for (int32 i = 0; i < Plan.Num(); ++i)
+	{
+		const FVector Offset = FVector(Plan.GetPosition(i)) - Descriptor.Center;
+		const double Distance = Offset.Size();
+		OutsideShell += (Distance < 12.0 - 1e-3 || Distance > 30.0 + 1e-3) ? 1 : 0;
+		BelowSurface += (Offset | Normal) < -1e-3 ? 1 : 0;
+	}
+	TestEqual(TEXT("Samples lie between the inner and outer radius"), OutsideShell, 0);
+	TestEqual(TEXT("Samples lie above the surface"), BelowSurface, 0);
+
+	// Same seed replays the stroke, the next stroke's seed does not
+	FKawaiiFluidSpawnPlan SameSeed;
+	SameSeed.Build(Descriptor);
+	Descriptor.JitterSeed = 78u;
+	FKawaiiFluidSpawnPlan OtherSeed;
+	OtherSeed.Build(Descriptor);
+
+	int32 SameDiffers = 0, OtherDiffers = 0;
+	for (int32 i = 0; i < Plan.Num(); ++i)
+	{
+		SameDiffers += Plan.GetPosition(i) != SameSeed.GetPosition(i) ? 1 : 0;
+		OtherDiffers += Plan.GetPosition(i) != OtherSeed.GetPosition(i) ? 1 : 0;
+	}
+	TestEqual(TEXT("Same seed reproduces every sample"), SameDiffers, 0);
+	TestEqual(TEXT("Other seed moves every sample"), OtherDiffers, Plan.Num());
+
+	// Occupancy grid: off without MinSeparation, covers the stroke and stays bounded with it
+	FVector3f GridMin;
+	float CellSize = 0.0f;
+	int32 Dim = 0;
+	TestFalse(TEXT("No grid without MinSeparation"), Plan.GetOccupancyGrid(GridMin, CellSize, Dim));
+
+	Descriptor.MinSeparation = 10.0f;
+	Plan.Build(Descriptor);
+	TestTrue(TEXT("Grid with MinSeparation"), Plan.GetOccupancyGrid(GridMin, CellSize, Dim));
+	TestEqual(TEXT("Grid cells match the separation"), CellSize, 10.0f);
+	TestTrue(TEXT("Grid covers the stroke"), CellSize * Dim >= 2.0f * 30.0f && GridMin.Equals(FVector3f(Descriptor.Center) - FVector3f(40.0f), 1e-3f));
+
+	Descriptor.MinSeparation = 0.1f;
+	Plan.Build(Descriptor);
+	Plan.GetOccupancyGrid(GridMin, CellSize, Dim);
+	TestEqual(TEXT("Grid dimension is clamped"), Dim, FKawaiiFluidSpawnPlan::MaxOccupancyDim);
+	TestTrue(TEXT("Clamped grid still covers the stroke"), CellSize * Dim >= 2.0f * 30.0f);
+
+	return true;
+}
+
+/**
+ * @brief Spawn Descriptor Benchmark.
+ * A ~100k particle sphere fill: per-point generation of jittered requests on the game thread (the previous
+ * emitter path) versus building the plan that is queued instead, plus the CPU fallback expansion.
+ */
+bool FKawaiiFluidBenchmark_SpawnDescriptor::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumIterations = 10;
+
+	FKawaiiFluidSpawnDescriptor Descriptor = MakeDescriptor(EKawaiiFluidSpawnShape::Sphere, FVector(160.0), 5.0f);
+	Descriptor.Center = FVector(0.0, 0.0, 500.0);
+	Descriptor.Rotation = FQuat(FRotator(0.0, 30.0, 0.0));
+	Descriptor.JitterRange = 5.0f * KawaiiFluidSpawnLattice::HCPCompensation * 0.2f;
+
+	// Previous path: nested loops, per-point test, FRandRange jitter, one request per particle
+	double PerPointSeconds = 0.0;
+	int32 PerPointCount = 0;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		const double Start = FPlatformTime::Seconds();
+		const TArray<FVector3f> Local = GenerateReferencePoints(Descriptor);
+		TArray<FGPUSpawnRequest> Requests;
+		Requests.Reserve(Local.Num());
+		for (const FVector3f& P : Local)
+		{
+			const float Jitter = Descriptor.JitterRange * FMath::Clamp(1.0f - P.Size() / 160.0f, 0.0f, 1.0f);
+			const FVector World = Descriptor.Center + Descriptor.Rotation.RotateVector(FVector(P)) +
+				FVector(FMath::FRandRange(-Jitter, Jitter), FMath::FRandRange(-Jitter, Jitter), FMath::FRandRange(-Jitter, Jitter));
+			Requests.Emplace(FVector3f(World), Descriptor.Velocity, Descriptor.SourceID);
+		}
+		PerPointSeconds += FPlatformTime::Seconds() - Start;
+		PerPointCount = Requests.Num();
+	}
+
+	// New path: row table only (what the game thread does now)
+	double BuildSeconds = 0.0;
+	FKawaiiFluidSpawnPlan Plan;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		const double Start = FPlatformTime::Seconds();
+		Plan.Build(Descriptor);
+		BuildSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	// CPU fallback (r.Fluid.GPUSpawnDescriptors 0): parallel expansion on the render thread
+	double ExpandSeconds = 0.0;
+	TArray<FGPUSpawnRequest> Expanded;
+	Expanded.SetNum(Plan.Num());
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		const double Start = FPlatformTime::Seconds();
+		Plan.Expand(Expanded);
+		ExpandSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	TestEqual(TEXT("Plan spawns the same particle count"), Plan.Num(), PerPointCount);
+
+	const double PerPointMs = PerPointSeconds * 1000.0 / NumIterations;
+	const double BuildMs = BuildSeconds * 1000.0 / NumIterations;
+	AddInfo(FString::Printf(TEXT("Sphere fill: %d particles, %d rows (%d bytes uploaded vs %d)"),
+		Plan.Num(), Plan.GetRows().Num(), Plan.GetRows().Num() * static_cast<int32>(sizeof(FKawaiiFluidSpawnRow)),
+		Plan.Num() * static_cast<int32>(sizeof(FGPUSpawnRequest))));
+	AddInfo(FString::Printf(TEXT("Per-point requests: %.3f ms"), PerPointMs));
+	AddInfo(FString::Printf(TEXT("Plan build:         %.3f ms"), BuildMs));
+	AddInfo(FString::Printf(TEXT("Parallel expand:    %.3f ms"), ExpandSeconds * 1000.0 / NumIterations));
+
+	TestTrue(TEXT("Plan build faster than per-point generation"), BuildMs < PerPointMs);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,393 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/Utils/KawaiiFluidSpawnQueue.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnQueueTest_OrderAcrossChunks,
+	"KawaiiFluid.Simulation.SpawnQueue.SQ01_OrderAcrossChunks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnQueueTest_DrainAtChunkBoundary,
+	"KawaiiFluid.Simulation.SpawnQueue.SQ02_DrainAtChunkBoundary",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnQueueTest_ConcurrentProducers,
+	"KawaiiFluid.Simulation.SpawnQueue.SQ03_ConcurrentProducers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnQueueTest_OverflowProducers,
+	"KawaiiFluid.Simulation.SpawnQueue.SQ04_OverflowProducers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_SpawnQueue,
+	"KawaiiFluid.Benchmark.SpawnQueue",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Request tagged with its producer (SourceID) and per-producer sequence number (ActorID).
+	 * @param Producer Producer index.
+	 * @param Sequence Sequence number within the producer.
+	 * @return Spawn request.
+	 */
+	FGPUSpawnRequest MakeTaggedRequest(int32 Producer, int32 Sequence)
+	{
+		FGPUSpawnRequest Request(FVector3f(static_cast<float>(Sequence), 0.0f, 0.0f), FVector3f::ZeroVector, Producer);
+		Request.ActorID = Sequence;
+		return Request;
+	}
+
+	/**
+	 * @brief Helper: Check that every producer's requests arrived complete and in order.
+	 * @param Requests Drained requests.
+	 * @param NumProducers Number of producers.
+	 * @param PerProducer Requests each producer pushed.
+	 * @return True if each producer's sequence is exactly 0..PerProducer-1.
+	 */
+	bool HasCompleteOrderedSequences(const TArray<FGPUSpawnRequest>& Requests, int32 NumProducers, int32 PerProducer)
+	{
+		if (Requests.Num() != NumProducers * PerProducer)
+		{
+			return false;
+		}
+
+		TArray<int32> NextSequence;
+		NextSequence.SetNumZeroed(NumProducers);
+		for (const FGPUSpawnRequest& Request : Requests)
+		{
+			if (!NextSequence.IsValidIndex(Request.SourceID) || Request.ActorID != NextSequence[Request.SourceID])
+			{
+				return false;
+			}
+			++NextSequence[Request.SourceID];
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Helper: Wait until the counter reaches a target, yielding the core meanwhile.
+	 * @param Counter Counter to watch.
+	 * @param Target Value to wait for.
+	 */
+	void SpinUntil(const std::atomic<int32>& Counter, int32 Target)
+	{
+		while (Counter.load(std::memory_order_acquire) < Target)
+		{
+			FPlatformProcess::Yield();
+		}
+	}
+
+	/**
+	 * @brief Helper: Run producer threads in lockstep frames; the calling thread drains after each frame.
+	 * @param NumProducers Number of producer threads.
+	 * @param PerProducerPerFrame Requests each producer pushes per frame.
+	 * @param NumFrames Number of frames.
+	 * @param Push Called on a producer thread with (Producer, Sequence) for each request.
+	 * @param Drain Called on the calling thread after all producers finished a frame.
+	 * @param OutPushSeconds Accumulated time from frame start until every producer finished.
+	 * @param OutDrainSeconds Accumulated drain time.
+	 */
+	void RunProducerFrames(int32 NumProducers, int32 PerProducerPerFrame, int32 NumFrames,
+		TFunction<void(int32, int32)> Push, TFunction<void()> Drain, double& OutPushSeconds, double& OutDrainSeconds)
+	{
+		std::atomic<int32> FrameStarted{0};
+		std::atomic<int32> ProducersDone{0};
+
+		TArray<TFuture<void>> Producers;
+		for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+		{
+			Producers.Add(Async(EAsyncExecution::Thread, [&, Producer]()
+			{
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					SpinUntil(FrameStarted, Frame + 1);
+					for (int32 i = 0; i < PerProducerPerFrame; ++i)
+					{
+						Push(Producer, Frame * PerProducerPerFrame + i);
+					}
+					ProducersDone.fetch_add(1, std::memory_order_acq_rel);
+				}
+			}));
+		}
+
+		OutPushSeconds = 0.0;
+		OutDrainSeconds = 0.0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const double FrameStart = FPlatformTime::Seconds();
+			FrameStarted.store(Frame + 1, std::memory_order_release);
+			SpinUntil(ProducersDone, (Frame + 1) * NumProducers);
+			const double PushEnd = FPlatformTime::Seconds();
+			OutPushSeconds += PushEnd - FrameStart;
+
+			Drain();
+			OutDrainSeconds += FPlatformTime::Seconds() - PushEnd;
+		}
+
+		for (TFuture<void>& Producer : Producers)
+		{
+			Producer.Wait();
+		}
+	}
+}
+
+/**
+ * @brief SQ-01: Single and batched pushes spanning several chunks drain in push order, and chunks recycle.
+ */
+bool FKawaiiFluidSpawnQueueTest_OrderAcrossChunks::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSpawnQueue Queue;
+	TestTrue(TEXT("New queue is empty"), Queue.IsEmpty());
+
+	constexpr int32 NumSingles = FKawaiiFluidSpawnQueue::ChunkCapacity + 500;
+	constexpr int32 NumBatched = FKawaiiFluidSpawnQueue::ChunkCapacity * 3 + 7;
+
+	int32 Sequence = 0;
+	for (int32 i = 0; i < NumSingles; ++i)
+	{
+		Queue.Enqueue(MakeTaggedRequest(0, Sequence++));
+	}
+
+	TArray<FGPUSpawnRequest> Batch;
+	for (int32 i = 0; i < NumBatched; ++i)
+	{
+		Batch.Add(MakeTaggedRequest(0, Sequence++));
+	}
+	Queue.Enqueue(Batch);
+	Queue.Enqueue(TConstArrayView<FGPUSpawnRequest>());
+
+	TestEqual(TEXT("Num counts every request"), Queue.Num(), Sequence);
+	TestEqual(TEXT("One producer slot claimed"), Queue.GetNumProducers(), 1);
+
+	TArray<FGPUSpawnRequest> Drained;
+	TestEqual(TEXT("DrainTo reports every request"), Queue.DrainTo(Drained), Sequence);
+	TestTrue(TEXT("Requests arrive in push order"), HasCompleteOrderedSequences(Drained, 1, Sequence));
+	TestTrue(TEXT("Queue empty after drain"), Queue.IsEmpty());
+
+	// Second round reuses the chunks handed back by the first drain
+	Drained.Reset();
+	for (int32 i = 0; i < Sequence; ++i)
+	{
+		Queue.Enqueue(MakeTaggedRequest(0, i));
+	}
+	Queue.DrainTo(Drained);
+	TestTrue(TEXT("Recycled chunks keep order"), HasCompleteOrderedSequences(Drained, 1, Sequence));
+
+	Queue.Enqueue(Batch);
+	TestEqual(TEXT("Discard reports dropped requests"), Queue.Discard(), NumBatched);
+	TestEqual(TEXT("Nothing left after discard"), Queue.DrainTo(Drained), 0);
+
+	return true;
+}
+
+/**
+ * @brief SQ-02: Draining exactly at a full chunk (before the producer opens the next) loses nothing.
+ */
+bool FKawaiiFluidSpawnQueueTest_DrainAtChunkBoundary::RunTest(const FString& Parameters)
+{
+	constexpr int32 Capacity = FKawaiiFluidSpawnQueue::ChunkCapacity;
+
+	FKawaiiFluidSpawnQueue Queue;
+	TArray<FGPUSpawnRequest> Drained;
+
+	int32 Sequence = 0;
+	for (int32 i = 0; i < Capacity; ++i)
+	{
+		Queue.Enqueue(MakeTaggedRequest(0, Sequence++));
+	}
+	TestEqual(TEXT("Full chunk drains completely"), Queue.DrainTo(Drained), Capacity);
+	TestEqual(TEXT("Drain of a read full chunk returns nothing"), Queue.DrainTo(Drained), 0);
+
+	// Partial drains inside and across chunks
+	const int32 Steps[] = { 1, Capacity - 1, 17, Capacity * 2, 3 };
+	for (const int32 Step : Steps)
+	{
+		for (int32 i = 0; i < Step; ++i)
+		{
+			Queue.Enqueue(MakeTaggedRequest(0, Sequence++));
+		}
+		TestEqual(FString::Printf(TEXT("Drain after %d pushes"), Step), Queue.DrainTo(Drained), Step);
+	}
+
+	TestTrue(TEXT("Order preserved across partial drains"), HasCompleteOrderedSequences(Drained, 1, Sequence));
+
+	return true;
+}
+
+/**
+ * @brief SQ-03: 8 producers push while the consumer drains concurrently; every producer's stream arrives complete and in order.
+ */
+bool FKawaiiFluidSpawnQueueTest_ConcurrentProducers::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumProducers = 8;
+	constexpr int32 PerProducer = 50000;
+
+	FKawaiiFluidSpawnQueue Queue;
+	std::atomic<int32> Finished{0};
+
+	TArray<TFuture<void>> Producers;
+	for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+	{
+		Producers.Add(Async(EAsyncExecution::Thread, [&Queue, &Finished, Producer]()
+		{
+			// Odd producers push singles, even ones push in small batches
+			TArray<FGPUSpawnRequest> Batch;
+			for (int32 Sequence = 0; Sequence < PerProducer; ++Sequence)
+			{
+				if (Producer % 2)
+				{
+					Queue.Enqueue(MakeTaggedRequest(Producer, Sequence));
+					continue;
+				}
+
+				Batch.Add(MakeTaggedRequest(Producer, Sequence));
+				if (Batch.Num() == 37 || Sequence == PerProducer - 1)
+				{
+					Queue.Enqueue(Batch);
+					Batch.Reset();
+				}
+			}
+			Finished.fetch_add(1, std::memory_order_release);
+		}));
+	}
+
+	TArray<FGPUSpawnRequest> Drained;
+	int32 NumDrains = 0;
+	while (Finished.load(std::memory_order_acquire) < NumProducers)
+	{
+		Queue.DrainTo(Drained);
+		++NumDrains;
+	}
+	for (TFuture<void>& Producer : Producers)
+	{
+		Producer.Wait();
+	}
+	Queue.DrainTo(Drained);
+
+	AddInfo(FString::Printf(TEXT("%d drains while producing"), NumDrains));
+	TestEqual(TEXT("Every producer claimed a slot"), Queue.GetNumProducers(), NumProducers);
+	TestTrue(TEXT("All requests arrive, in order per producer"), HasCompleteOrderedSequences(Drained, NumProducers, PerProducer));
+	TestTrue(TEXT("Queue empty at the end"), Queue.IsEmpty());
+
+	return true;
+}
+
+/**
+ * @brief SQ-04: Producers beyond MaxProducers fall back to the overflow list without losing or reordering requests.
+ */
+bool FKawaiiFluidSpawnQueueTest_OverflowProducers::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumProducers = FKawaiiFluidSpawnQueue::MaxProducers + 8;
+	constexpr int32 PerProducer = FKawaiiFluidSpawnQueue::ChunkCapacity + 100;
+
+	FKawaiiFluidSpawnQueue Queue;
+	std::atomic<int32> Arrived{0};
+
+	// Threads stay alive until all have pushed, so no thread ID is reused for another producer
+	TArray<TFuture<void>> Producers;
+	for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+	{
+		Producers.Add(Async(EAsyncExecution::Thread, [&Queue, &Arrived, Producer]()
+		{
+			TArray<FGPUSpawnRequest> Batch;
+			for (int32 Sequence = 0; Sequence < PerProducer; ++Sequence)
+			{
+				Batch.Add(MakeTaggedRequest(Producer, Sequence));
+			}
+			Queue.Enqueue(TConstArrayView<FGPUSpawnRequest>(Batch.GetData(), 100));
+			Queue.Enqueue(TConstArrayView<FGPUSpawnRequest>(Batch.GetData() + 100, PerProducer - 100));
+
+			Arrived.fetch_add(1, std::memory_order_acq_rel);
+			SpinUntil(Arrived, NumProducers);
+		}));
+	}
+	for (TFuture<void>& Producer : Producers)
+	{
+		Producer.Wait();
+	}
+
+	TestEqual(TEXT("All slots claimed"), Queue.GetNumProducers(), static_cast<int32>(FKawaiiFluidSpawnQueue::MaxProducers));
+	TestEqual(TEXT("Num includes overflow requests"), Queue.Num(), NumProducers * PerProducer);
+
+	TArray<FGPUSpawnRequest> Drained;
+	Queue.DrainTo(Drained);
+	TestTrue(TEXT("Slot and overflow producers arrive complete and in order"), HasCompleteOrderedSequences(Drained, NumProducers, PerProducer));
+	TestTrue(TEXT("Queue empty at the end"), Queue.IsEmpty());
+
+	return true;
+}
+
+/**
+ * @brief Spawn Queue Benchmark.
+ * 8 producer threads push 100k single requests per frame (the SpawnParticle pattern), then the
+ * simulation drains once; compared with the previous critical-section + TArray append path.
+ */
+bool FKawaiiFluidBenchmark_SpawnQueue::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumProducers = 8;
+	constexpr int32 RequestsPerFrame = 100000;
+	constexpr int32 PerProducerPerFrame = RequestsPerFrame / NumProducers;
+	constexpr int32 NumFrames = 20;
+
+	// Lock-free queue
+	FKawaiiFluidSpawnQueue Queue;
+	TArray<FGPUSpawnRequest> QueueDrained;
+	int64 QueueTotal = 0;
+	double QueuePushSeconds = 0.0, QueueDrainSeconds = 0.0;
+	RunProducerFrames(NumProducers, PerProducerPerFrame, NumFrames,
+		[&Queue](int32 Producer, int32 Sequence)
+		{
+			Queue.Enqueue(MakeTaggedRequest(Producer, Sequence));
+		},
+		[&Queue, &QueueDrained, &QueueTotal]()
+		{
+			QueueDrained.Reset();
+			QueueTotal += Queue.DrainTo(QueueDrained);
+		},
+		QueuePushSeconds, QueueDrainSeconds);
+
+	// Baseline: shared critical section guarding one pending array
+	FCriticalSection Lock;
+	TArray<FGPUSpawnRequest> LockedPending;
+	TArray<FGPUSpawnRequest> LockedActive;
+	int64 LockedTotal = 0;
+	double LockedPushSeconds = 0.0, LockedDrainSeconds = 0.0;
+	RunProducerFrames(NumProducers, PerProducerPerFrame, NumFrames,
+		[&Lock, &LockedPending](int32 Producer, int32 Sequence)
+		{
+			FScopeLock Guard(&Lock);
+			LockedPending.Add(MakeTaggedRequest(Producer, Sequence));
+		},
+		[&Lock, &LockedPending, &LockedActive, &LockedTotal]()
+		{
+			FScopeLock Guard(&Lock);
+			LockedActive = MoveTemp(LockedPending);
+			LockedPending.Empty();
+			LockedTotal += LockedActive.Num();
+		},
+		LockedPushSeconds, LockedDrainSeconds);
+
+	const int64 Expected = static_cast<int64>(NumProducers) * PerProducerPerFrame * NumFrames;
+	TestEqual(TEXT("Queue delivered every request"), QueueTotal, Expected);
+	TestEqual(TEXT("Locked baseline delivered every request"), LockedTotal, Expected);
+
+	const double QueuePushMs = QueuePushSeconds * 1000.0 / NumFrames;
+	const double LockedPushMs = LockedPushSeconds * 1000.0 / NumFrames;
+	AddInfo(FString::Printf(TEXT("%d producers, %d requests/frame, %d frames"), NumProducers, NumProducers * PerProducerPerFrame, NumFrames));
+	AddInfo(FString::Printf(TEXT("Lock-free queue:  push %.3f ms/frame, drain %.3f ms/frame"), QueuePushMs, QueueDrainSeconds * 1000.0 / NumFrames));
+	AddInfo(FString::Printf(TEXT("Critical section: push %.3f ms/frame, drain %.3f ms/frame"), LockedPushMs, LockedDrainSeconds * 1000.0 / NumFrames));
+
+	TestTrue(TEXT("Lock-free producers faster than the shared lock"), QueuePushMs < LockedPushMs);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,196 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "Simulation/Utils/KawaiiFluidSpawnRandom.h"
+#include "Simulation/Utils/KawaiiFluidLatticeTemplateCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnRandomTest_Reproducible,
+	"KawaiiFluid.Simulation.SpawnRandom.SR01_Reproducible",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnRandomTest_Distribution,
+	"KawaiiFluid.Simulation.SpawnRandom.SR02_Distribution",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnRandomTest_OrderIndependent,
+	"KawaiiFluid.Simulation.SpawnRandom.SR03_OrderIndependent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnRandomTest_LatticeJitterReplay,
+	"KawaiiFluid.Simulation.SpawnRandom.SR04_LatticeJitterReplay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Count indices whose three words are identical in both streams.
+	 * @param A First stream.
+	 * @param B Second stream.
+	 * @param Count Number of indices compared.
+	 * @return Number of identical indices.
+	 */
+	int32 CountEqualHashes(const FKawaiiFluidSpawnRandom& A, const FKawaiiFluidSpawnRandom& B, int32 Count)
+	{
+		int32 Equal = 0;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Equal += A.Hash(i) == B.Hash(i) ? 1 : 0;
+		}
+		return Equal;
+	}
+
+	/**
+	 * @brief Helper: Jittered positions of a disc layer (the stream emitter's hex layer).
+	 * @param Random Spawn stream.
+	 * @return Spawned positions.
+	 */
+	TArray<FVector3f> SpawnJitteredDisc(const FKawaiiFluidSpawnRandom& Random)
+	{
+		FKawaiiFluidLatticeTemplateKey Key;
+		Key.Shape = EKawaiiFluidSpawnShape::Disc;
+		Key.Extent = FVector3f(40.0f, 40.0f, 0.0f);
+		Key.Spacing = 5.0f;
+		const FKawaiiFluidLatticeTemplateRef Template = FKawaiiFluidLatticeTemplate::Build(Key);
+
+		TArray<FGPUSpawnRequest> Requests;
+		Template->AppendSpawnRequests(FVector3f::ZeroVector, FVector3f(1.0f, 0.0f, 0.0f), FVector3f(0.0f, 1.0f, 0.0f), FVector3f(0.0f, 0.0f, 1.0f),
+			FVector3f(0.75f, 0.75f, 0.0f), Random, Key.Extent.X, FGPUSpawnRequest(), Requests);
+
+		TArray<FVector3f> Positions;
+		for (const FGPUSpawnRequest& Request : Requests)
+		{
+			Positions.Add(Request.Position);
+		}
+		return Positions;
+	}
+}
+
+/**
+ * @brief SR-01: Values depend only on (Seed, Stream, Index); the hash matches the shader's reference values.
+ */
+bool FKawaiiFluidSpawnRandomTest_Reproducible::RunTest(const FString& Parameters)
+{
+	// Reference words of the PCG3D hash shared with FluidSpawnRandom.ush
+	TestTrue(TEXT("Hash(0, 0, 0, 0) reference"), KawaiiFluidSpawnLattice::Hash(0, 0, 0, 0u) == FUintVector3(0x9bafd7c6u, 0xa8e88a6bu, 0x3f15482cu));
+	TestTrue(TEXT("Hash(7, 3, 0, 0xC0FFEE) reference"), KawaiiFluidSpawnLattice::Hash(7, 3, 0, 0xC0FFEEu) == FUintVector3(0x4b355fb1u, 0x0421add3u, 0xd8594c01u));
+	TestTrue(TEXT("Spawn random is the lattice hash at (Index, Stream, 0)"),
+		FKawaiiFluidSpawnRandom(0xC0FFEEu, 3).Hash(7) == KawaiiFluidSpawnLattice::Hash(7, 3, 0, 0xC0FFEEu));
+
+	const uint32 Seed = FKawaiiFluidSpawnRandom::MakeSeed(42, 5);
+	TestEqual(TEXT("MakeSeed is deterministic"), Seed, FKawaiiFluidSpawnRandom::MakeSeed(42, 5));
+	TestNotEqual(TEXT("Sources get different seeds"), Seed, FKawaiiFluidSpawnRandom::MakeSeed(42, 6));
+	TestNotEqual(TEXT("User seeds get different seeds"), Seed, FKawaiiFluidSpawnRandom::MakeSeed(43, 5));
+
+	constexpr int32 Count = 4096;
+	const FKawaiiFluidSpawnRandom Random(Seed, 10);
+	TestEqual(TEXT("Same stream repeats"), CountEqualHashes(Random, FKawaiiFluidSpawnRandom(Seed, 10), Count), Count);
+	TestEqual(TEXT("Next stream differs"), CountEqualHashes(Random, FKawaiiFluidSpawnRandom(Seed, 11), Count), 0);
+	TestEqual(TEXT("Other seed differs"), CountEqualHashes(Random, FKawaiiFluidSpawnRandom(Seed + 1, 10), Count), 0);
+
+	TestNotEqual(TEXT("Stream seeds differ per stream"), Random.GetStreamSeed(), FKawaiiFluidSpawnRandom(Seed, 11).GetStreamSeed());
+	TestEqual(TEXT("Stream seed repeats"), Random.GetStreamSeed(), FKawaiiFluidSpawnRandom(Seed, 10).GetStreamSeed());
+
+	return true;
+}
+
+/**
+ * @brief SR-02: Unit values cover [0, 1), signed values [-1, 1), and unit vectors are uniform on the sphere.
+ */
+bool FKawaiiFluidSpawnRandomTest_Distribution::RunTest(const FString& Parameters)
+{
+	constexpr int32 Count = 200000;
+	const FKawaiiFluidSpawnRandom Random(FKawaiiFluidSpawnRandom::MakeSeed(0, 1), 0);
+
+	FVector3d UnitSum = FVector3d::ZeroVector;
+	FVector3d DirectionSum = FVector3d::ZeroVector;
+	int32 OutOfRange = 0;
+	int32 NotNormalized = 0;
+	int32 Histogram[10] = {};
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVector3f U = Random.Unit(i);
+		const FVector3f S = Random.SignedUnit(i);
+		OutOfRange += (U.GetMin() < 0.0f || U.GetMax() >= 1.0f) ? 1 : 0;
+		OutOfRange += (S.GetMin() < -1.0f || S.GetMax() >= 1.0f) ? 1 : 0;
+		UnitSum += FVector3d(U);
+		++Histogram[FMath::Min(static_cast<int32>(U.X * 10.0f), 9)];
+
+		const FVector3f Direction = FKawaiiFluidSpawnRandom::ToUnitVector(U.X, U.Y);
+		NotNormalized += FMath::IsNearlyEqual(Direction.Size(), 1.0f, 1e-4f) ? 0 : 1;
+		DirectionSum += FVector3d(Direction);
+	}
+
+	TestEqual(TEXT("Values stay in range"), OutOfRange, 0);
+	TestEqual(TEXT("Directions are unit length"), NotNormalized, 0);
+
+	const FVector3d UnitMean = UnitSum / Count;
+	TestTrue(FString::Printf(TEXT("Unit mean near 0.5 (%.4f, %.4f, %.4f)"), UnitMean.X, UnitMean.Y, UnitMean.Z),
+		UnitMean.Equals(FVector3d(0.5), 0.005));
+
+	const FVector3d DirectionMean = DirectionSum / Count;
+	TestTrue(FString::Printf(TEXT("Direction mean near zero (%.4f, %.4f, %.4f)"), DirectionMean.X, DirectionMean.Y, DirectionMean.Z),
+		DirectionMean.Equals(FVector3d::ZeroVector, 0.01));
+
+	int32 UnevenBins = 0;
+	for (const int32 Bin : Histogram)
+	{
+		UnevenBins += FMath::Abs(Bin - Count / 10) > Count / 100 ? 1 : 0;
+	}
+	TestEqual(TEXT("Histogram within 10% per bin"), UnevenBins, 0);
+
+	return true;
+}
+
+/**
+ * @brief SR-03: Parallel generation over any thread count matches a reversed serial pass exactly.
+ */
+bool FKawaiiFluidSpawnRandomTest_OrderIndependent::RunTest(const FString& Parameters)
+{
+	constexpr int32 Count = 100000;
+	const FKawaiiFluidSpawnRandom Random(FKawaiiFluidSpawnRandom::MakeSeed(7, 3), 2);
+	const FVector3f Range(1.5f, 0.5f, 2.0f);
+
+	TArray<FVector3f> Parallel;
+	Parallel.SetNumUninitialized(Count);
+	ParallelFor(Count, [&](int32 i)
+	{
+		Parallel[i] = Random.Jitter(i, Range);
+	});
+
+	TArray<FVector3f> Serial;
+	Serial.SetNumUninitialized(Count);
+	for (int32 i = Count - 1; i >= 0; --i)
+	{
+		Serial[i] = Random.Jitter(i, Range);
+	}
+
+	TestTrue(TEXT("Parallel and reversed serial results are bit-identical"),
+		FMemory::Memcmp(Parallel.GetData(), Serial.GetData(), Count * sizeof(FVector3f)) == 0);
+
+	return true;
+}
+
+/**
+ * @brief SR-04: A jittered lattice layer replays exactly for the same stream and changes with the next one.
+ */
+bool FKawaiiFluidSpawnRandomTest_LatticeJitterReplay::RunTest(const FString& Parameters)
+{
+	const uint32 Seed = FKawaiiFluidSpawnRandom::MakeSeed(0, 2);
+
+	const TArray<FVector3f> First = SpawnJitteredDisc(FKawaiiFluidSpawnRandom(Seed, 0));
+	const TArray<FVector3f> Replay = SpawnJitteredDisc(FKawaiiFluidSpawnRandom(Seed, 0));
+	const TArray<FVector3f> Next = SpawnJitteredDisc(FKawaiiFluidSpawnRandom(Seed, 1));
+
+	TestTrue(TEXT("Layer has particles"), First.Num() > 0);
+	TestTrue(TEXT("Same stream replays the layer exactly"), First == Replay);
+	TestFalse(TEXT("Next stream jitters differently"), First == Next);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
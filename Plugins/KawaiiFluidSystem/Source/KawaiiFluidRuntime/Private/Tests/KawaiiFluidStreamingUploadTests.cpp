@@ -0,0 +1,246 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Async/ParallelFor.h"
+#include "Simulation/Managers/GPUSpawnManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidStreamingUploadTest_BudgetedTake,
+	"KawaiiFluid.Simulation.StreamingUpload.SU01_BudgetedTake",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidStreamingUploadTest_CancelAndClear,
+	"KawaiiFluid.Simulation.StreamingUpload.SU02_CancelAndClear",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidStreamingUploadTest_ChunkRecyclingAndIDs,
+	"KawaiiFluid.Simulation.StreamingUpload.SU03_ChunkRecyclingAndIDs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_StreamingUpload,
+	"KawaiiFluid.Benchmark.StreamingUpload",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr int32 ChunkSize = FGPUSpawnManager::UploadChunkSize;
+	constexpr int64 ChunkBytes = static_cast<int64>(ChunkSize) * sizeof(FGPUFluidParticle);
+
+	/**
+	 * @brief Helper: Build upload chunks for consecutive particle IDs, the way QueueParticleUpload splits them.
+	 * @param Manager Spawn manager providing (recycled) chunks.
+	 * @param Count Number of particles.
+	 * @param FirstID ID of the first particle.
+	 * @param SourceOf Source ID per particle index.
+	 * @return Chunks of at most UploadChunkSize particles.
+	 */
+	TArray<TArray<FGPUFluidParticle>> MakeUploadChunks(FGPUSpawnManager& Manager, int32 Count, int32 FirstID, TFunctionRef<int32(int32)> SourceOf)
+	{
+		TArray<TArray<FGPUFluidParticle>> Chunks;
+		for (int32 Start = 0; Start < Count; Start += ChunkSize)
+		{
+			TArray<FGPUFluidParticle>& Chunk = Chunks.Add_GetRef(Manager.AcquireUploadChunk());
+			const int32 ChunkCount = FMath::Min(ChunkSize, Count - Start);
+			for (int32 i = 0; i < ChunkCount; ++i)
+			{
+				FGPUFluidParticle& Particle = Chunk.AddZeroed_GetRef();
+				Particle.Position = FVector3f(static_cast<float>(Start + i), 0.0f, 0.0f);
+				Particle.PredictedPosition = Particle.Position;
+				Particle.Mass = 1.0f;
+				Particle.ParticleID = FirstID + Start + i;
+				Particle.SourceID = SourceOf(Start + i);
+			}
+		}
+		return Chunks;
+	}
+}
+
+/**
+ * @brief SU-01: Each frame takes whole chunks within the byte budget, at least one, until the upload is resident.
+ */
+bool FKawaiiFluidStreamingUploadTest_BudgetedTake::RunTest(const FString& Parameters)
+{
+	FGPUSpawnManager Manager;
+
+	// 5.5 chunks
+	const int32 Count = ChunkSize * 5 + ChunkSize / 2;
+	Manager.AddUploadChunks(MakeUploadChunks(Manager, Count, 0, [](int32) { return 0; }));
+
+	TestEqual(TEXT("Pending upload counts every particle"), Manager.GetPendingUploadCount(), Count);
+	TestEqual(TEXT("Pending spawn count includes the upload"), Manager.GetPendingSpawnCount(), Count);
+	TestTrue(TEXT("Upload marks spawns pending"), Manager.HasPendingSpawnRequests());
+
+	// Budget of two chunks: 2 + 2 + 1.5
+	const int32 Expected[] = { ChunkSize * 2, ChunkSize * 2, ChunkSize + ChunkSize / 2 };
+	int32 Resident = 0;
+	for (int32 Frame = 0; Frame < UE_ARRAY_COUNT(Expected); ++Frame)
+	{
+		const int32 Taken = Manager.TakeUploadChunks(ChunkBytes * 2);
+		TestEqual(FString::Printf(TEXT("Frame %d takes two chunks or the rest"), Frame), Taken, Expected[Frame]);
+		TestEqual(TEXT("Active count includes taken particles"), Manager.GetActiveRequestCount(), Taken);
+		Resident += Taken;
+		Manager.ClearActiveRequests();
+	}
+	TestEqual(TEXT("Everything uploaded"), Resident, Count);
+	TestFalse(TEXT("Nothing pending afterwards"), Manager.HasPendingSpawnRequests());
+
+	// A budget below one chunk still makes progress
+	Manager.AddUploadChunks(MakeUploadChunks(Manager, ChunkSize * 2, Count, [](int32) { return 0; }));
+	TestEqual(TEXT("Tiny budget takes one chunk"), Manager.TakeUploadChunks(1024), ChunkSize);
+	Manager.ClearActiveRequests();
+
+	// Zero budget takes everything
+	TestEqual(TEXT("Zero budget takes the rest"), Manager.TakeUploadChunks(0), ChunkSize);
+	Manager.ClearActiveRequests();
+	TestEqual(TEXT("Take on an empty queue"), Manager.TakeUploadChunks(ChunkBytes), 0);
+
+	return true;
+}
+
+/**
+ * @brief SU-02: Cancelling a source removes its staged particles only; ClearSpawnRequests drops the rest.
+ */
+bool FKawaiiFluidStreamingUploadTest_CancelAndClear::RunTest(const FString& Parameters)
+{
+	FGPUSpawnManager Manager;
+
+	// Alternate two sources across three chunks
+	const int32 Count = ChunkSize * 2 + 100;
+	Manager.AddUploadChunks(MakeUploadChunks(Manager, Count, 0, [](int32 Index) { return Index % 2 ? 7 : 3; }));
+
+	// One chunk already in flight is not affected by the cancel
+	TestEqual(TEXT("First chunk taken"), Manager.TakeUploadChunks(ChunkBytes), ChunkSize);
+
+	const int32 Remaining = Count - ChunkSize;
+	const int32 Cancelled = Manager.CancelPendingSpawnsForSource(7);
+	TestEqual(TEXT("Cancel removes every pending particle of the source"), Cancelled, Remaining / 2);
+	TestEqual(TEXT("Other source stays pending"), Manager.GetPendingUploadCount(), Remaining - Remaining / 2);
+	TestEqual(TEXT("Active chunk untouched"), Manager.GetActiveUploadCount(), ChunkSize);
+	TestEqual(TEXT("Cancel of an absent source"), Manager.CancelPendingSpawnsForSource(42), 0);
+
+	Manager.ClearActiveRequests();
+	const int32 Taken = Manager.TakeUploadChunks(0);
+	TestEqual(TEXT("Survivors upload"), Taken, Remaining - Remaining / 2);
+	Manager.ClearActiveRequests();
+
+	Manager.AddUploadChunks(MakeUploadChunks(Manager, 1000, Count, [](int32) { return 3; }));
+	Manager.ClearSpawnRequests();
+	TestEqual(TEXT("ClearSpawnRequests drops pending uploads"), Manager.GetPendingUploadCount(), 0);
+	TestFalse(TEXT("Nothing pending after clear"), Manager.HasPendingSpawnRequests());
+
+	return true;
+}
+
+/**
+ * @brief SU-03: Uploaded chunks return to the pool, and uploads do not advance NextParticleID a second time.
+ */
+bool FKawaiiFluidStreamingUploadTest_ChunkRecyclingAndIDs::RunTest(const FString& Parameters)
+{
+	FGPUSpawnManager Manager;
+
+	const int32 Count = ChunkSize + 10;
+	const int32 FirstID = Manager.AllocateParticleIDs(Count);
+	TestEqual(TEXT("IDs allocated up front"), Manager.GetNextParticleID(), FirstID + Count);
+
+	TArray<TArray<FGPUFluidParticle>> Chunks = MakeUploadChunks(Manager, Count, FirstID, [](int32) { return 0; });
+	TArray<const FGPUFluidParticle*> ChunkData;
+	for (const TArray<FGPUFluidParticle>& Chunk : Chunks)
+	{
+		ChunkData.Add(Chunk.GetData());
+	}
+	Manager.AddUploadChunks(MoveTemp(Chunks));
+
+	TestEqual(TEXT("Both chunks taken"), Manager.TakeUploadChunks(0), Count);
+	Manager.OnSpawnComplete(Manager.GetActiveRequestCount());
+	TestEqual(TEXT("Uploads do not take new IDs"), Manager.GetNextParticleID(), FirstID + Count);
+	Manager.OnSpawnComplete(Manager.GetActiveRequestCount() + 3);
+	TestEqual(TEXT("Spawns beyond the upload still take IDs"), Manager.GetNextParticleID(), FirstID + Count + 3);
+	Manager.ClearActiveRequests();
+	TestEqual(TEXT("Active upload cleared"), Manager.GetActiveUploadCount(), 0);
+
+	const TArray<FGPUFluidParticle> Reused = Manager.AcquireUploadChunk();
+	TestEqual(TEXT("Recycled chunk is empty"), Reused.Num(), 0);
+	TestTrue(TEXT("Recycled chunk keeps a full allocation"), Reused.Max() >= ChunkSize);
+	TestTrue(TEXT("Allocation comes from the pool"), ChunkData.Contains(Reused.GetData()));
+
+	return true;
+}
+
+/**
+ * @brief Streaming Upload Benchmark.
+ * 1M particles: one-shot staging (convert into one array, then a full deep copy for the buffer
+ * rebuild) vs streaming (parallel conversion into chunks, then budgeted per-frame chunk copies).
+ * Reports the worst single-frame cost, which is what a level load hitches on.
+ */
+bool FKawaiiFluidBenchmark_StreamingUpload::RunTest(const FString& Parameters)
+{
+	constexpr int32 Count = 1000000;
+	constexpr int64 BudgetBytes = 4096 * 1024;
+
+	TArray<FGPUFluidParticle> Source;
+	Source.SetNumZeroed(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Source[i].Position = FVector3f(static_cast<float>(i % 100), static_cast<float>((i / 100) % 100), static_cast<float>(i / 10000));
+		Source[i].ParticleID = i;
+	}
+
+	// One-shot: everything in the loading frame
+	double OneShotMs = 0.0;
+	{
+		const double Start = FPlatformTime::Seconds();
+		TArray<FGPUFluidParticle> Cached;
+		Cached.SetNumUninitialized(Count);
+		ParallelFor(Count, [&](int32 i) { Cached[i] = Source[i]; }, Count < 2048);
+		TArray<FGPUFluidParticle> Copy = Cached;
+		OneShotMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+		TestEqual(TEXT("One-shot copy complete"), Copy.Num(), Count);
+	}
+
+	// Streaming: conversion in the loading frame, uploads spread across frames
+	FGPUSpawnManager Manager;
+	double ConvertMs = 0.0;
+	{
+		const double Start = FPlatformTime::Seconds();
+		const int32 NumChunks = FMath::DivideAndRoundUp(Count, ChunkSize);
+		TArray<TArray<FGPUFluidParticle>> Chunks;
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+		{
+			Chunks.Add_GetRef(Manager.AcquireUploadChunk()).SetNumUninitialized(FMath::Min(ChunkSize, Count - ChunkIndex * ChunkSize));
+		}
+		ParallelFor(Count, [&](int32 i) { Chunks[i / ChunkSize][i % ChunkSize] = Source[i]; }, Count < 2048);
+		Manager.AddUploadChunks(MoveTemp(Chunks));
+		ConvertMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+	}
+
+	double WorstFrameMs = 0.0;
+	int32 NumFrames = 0;
+	int32 Uploaded = 0;
+	TArray<FGPUFluidParticle> Staging;
+	while (Manager.GetPendingUploadCount() > 0)
+	{
+		const double Start = FPlatformTime::Seconds();
+		const int32 Taken = Manager.TakeUploadChunks(BudgetBytes);
+		Staging.Reset(Taken);
+		Staging.SetNumUninitialized(Taken);
+		FMemory::Memcpy(Staging.GetData(), Source.GetData() + Uploaded, Taken * sizeof(FGPUFluidParticle));
+		Manager.ClearActiveRequests();
+		WorstFrameMs = FMath::Max(WorstFrameMs, (FPlatformTime::Seconds() - Start) * 1000.0);
+		Uploaded += Taken;
+		++NumFrames;
+	}
+	TestEqual(TEXT("Streaming uploads every particle"), Uploaded, Count);
+
+	AddInfo(FString::Printf(TEXT("%d particles, budget %lld KB/frame"), Count, BudgetBytes / 1024));
+	AddInfo(FString::Printf(TEXT("One-shot:  %.3f ms in the loading frame"), OneShotMs));
+	AddInfo(FString::Printf(TEXT("Streaming: %.3f ms conversion + worst upload frame %.3f ms over %d frames"), ConvertMs, WorstFrameMs, NumFrames));
+
+	TestTrue(TEXT("Worst streaming frame cheaper than the one-shot upload"), WorstFrameMs < OneShotMs);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
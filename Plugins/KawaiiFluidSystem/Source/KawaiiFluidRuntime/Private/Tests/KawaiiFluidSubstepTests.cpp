@@ -0,0 +1,339 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Simulation/Utils/KawaiiFluidAdaptiveSubsteps.h"
+#include "Tests/KawaiiFluidPresetEvaluator.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSubstepTest_CFLTimeStep,
+	"KawaiiFluid.Simulation.Substeps.S01_CFLTimeStep",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSubstepTest_ImmediateUpshift,
+	"KawaiiFluid.Simulation.Substeps.S02_ImmediateUpshift",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSubstepTest_HysteresisDownshift,
+	"KawaiiFluid.Simulation.Substeps.S03_HysteresisDownshift",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSubstepTest_FallbackWithoutVelocity,
+	"KawaiiFluid.Simulation.Substeps.S04_FallbackWithoutVelocity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSubstepTest_TraceOscillation,
+	"KawaiiFluid.Simulation.Substeps.S05_TraceOscillation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_AdaptiveSubsteps,
+	"KawaiiFluid.Benchmark.AdaptiveSubsteps",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float FrameTime60 = 1.0f / 60.0f;
+
+	/**
+	 * @brief Helper: Settings matching the default preset (r = 5cm, 1/120s fallback, 8 max substeps).
+	 * @return Adaptive substep settings.
+	 */
+	FKawaiiFluidAdaptiveSubstepSettings MakeDefaultSettings()
+	{
+		FKawaiiFluidAdaptiveSubstepSettings Settings;
+		Settings.CFLNumber = 0.8f;
+		Settings.ParticleRadius = 5.0f;
+		Settings.GravityMagnitude = 980.0f;
+		Settings.MaxSubsteps = 8;
+		Settings.FallbackSubstepDeltaTime = 1.0f / 120.0f;
+		Settings.HysteresisRatio = 0.2f;
+		Settings.DownshiftFrames = 15;
+		return Settings;
+	}
+
+	/**
+	 * @brief Helper: Synthetic max-speed trace (calm pool, splash, decay, then jitter near a count boundary).
+	 * @param NumFrames Number of frames to generate.
+	 * @return Max particle speed per frame (cm/s).
+	 */
+	TArray<float> MakeVelocityTrace(int32 NumFrames)
+	{
+		FRandomStream Random(1234);
+		TArray<float> Trace;
+		Trace.SetNumUninitialized(NumFrames);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			float Speed;
+			if (Frame < 200)
+			{
+				Speed = 30.0f;
+			}
+			else if (Frame < 260)
+			{
+				Speed = FMath::Lerp(30.0f, 1200.0f, (Frame - 200) / 60.0f);
+			}
+			else if (Frame < 400)
+			{
+				Speed = 30.0f + 1170.0f * FMath::Exp(-(Frame - 260) / 30.0f);
+			}
+			else
+			{
+				// Hovers around the 2 -> 3 substep boundary (~450 cm/s at 60 Hz)
+				Speed = 450.0f + 60.0f * FMath::Sin(Frame * 0.9f);
+			}
+			Trace[Frame] = Speed + Random.FRandRange(-10.0f, 10.0f);
+		}
+		return Trace;
+	}
+
+	/**
+	 * @struct FSubstepRunResult
+	 * @brief Aggregated outcome of running a substep scheme over a velocity trace.
+	 * @param AverageSubsteps Mean substeps per frame.
+	 * @param CFLViolationFrames Frames whose substep dt exceeded the true CFL dt.
+	 * @param MaxCFLRatio Worst substep dt / CFL dt ratio.
+	 * @param CountSwitches Number of frames where the substep count changed.
+	 */
+	struct FSubstepRunResult
+	{
+		double AverageSubsteps = 0.0;
+		int32 CFLViolationFrames = 0;
+		float MaxCFLRatio = 0.0f;
+		int32 CountSwitches = 0;
+	};
+
+	/**
+	 * @brief Helper: Evaluate a substep scheme against a trace.
+	 * @param Trace True max speed per frame.
+	 * @param Settings Settings used for the CFL reference.
+	 * @param SelectCount Callback returning the substep count for a frame index.
+	 * @return Aggregated result.
+	 */
+	FSubstepRunResult EvaluateScheme(
+		const TArray<float>& Trace,
+		const FKawaiiFluidAdaptiveSubstepSettings& Settings,
+		TFunctionRef<int32(int32)> SelectCount)
+	{
+		FSubstepRunResult Result;
+		int64 TotalSubsteps = 0;
+		int32 PrevCount = -1;
+
+		for (int32 Frame = 0; Frame < Trace.Num(); ++Frame)
+		{
+			const int32 Count = SelectCount(Frame);
+			TotalSubsteps += Count;
+
+			const float CFLTimeStep = FKawaiiFluidAdaptiveSubsteps::ComputeCFLTimeStep(Settings, Trace[Frame], FrameTime60);
+			const float Ratio = (FrameTime60 / Count) / CFLTimeStep;
+			Result.MaxCFLRatio = FMath::Max(Result.MaxCFLRatio, Ratio);
+			if (Ratio > 1.0f + KINDA_SMALL_NUMBER)
+			{
+				++Result.CFLViolationFrames;
+			}
+
+			if (PrevCount >= 0 && Count != PrevCount)
+			{
+				++Result.CountSwitches;
+			}
+			PrevCount = Count;
+		}
+
+		Result.AverageSubsteps = static_cast<double>(TotalSubsteps) / FMath::Max(Trace.Num(), 1);
+		return Result;
+	}
+}
+
+/**
+ * @brief S-01: CFL Time Step Test.
+ * Formula: dt = CFL * r / (v_max + |g| * FrameTime).
+ * Expected: r=5cm, CFL=0.8, v=500cm/s, no gravity -> 8ms; zero speed and gravity -> unconstrained (0).
+ */
+bool FKawaiiFluidSubstepTest_CFLTimeStep::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAdaptiveSubstepSettings Settings = MakeDefaultSettings();
+	Settings.GravityMagnitude = 0.0f;
+
+	TestNearlyEqual(TEXT("CFL dt at 500 cm/s"), FKawaiiFluidAdaptiveSubsteps::ComputeCFLTimeStep(Settings, 500.0f, FrameTime60), 0.008f, 1e-6f);
+	TestEqual(TEXT("Unconstrained at rest without gravity"), FKawaiiFluidAdaptiveSubsteps::ComputeCFLTimeStep(Settings, 0.0f, FrameTime60), 0.0f);
+
+	Settings.GravityMagnitude = 980.0f;
+	const float WithGravity = FKawaiiFluidAdaptiveSubsteps::ComputeCFLTimeStep(Settings, 0.0f, FrameTime60);
+	TestTrue(TEXT("Gravity bounds the step of resting fluid"), WithGravity > 0.0f && WithGravity < 1.0f);
+
+	AddInfo(FString::Printf(TEXT("Resting fluid CFL dt with gravity: %.2f ms"), WithGravity * 1000.0f));
+	return true;
+}
+
+/**
+ * @brief S-02: Immediate Upshift Test.
+ * A velocity spike must raise the substep count in the same frame, clamped to MaxSubsteps.
+ */
+bool FKawaiiFluidSubstepTest_ImmediateUpshift::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidAdaptiveSubstepSettings Settings = MakeDefaultSettings();
+	FKawaiiFluidAdaptiveSubstepState State;
+
+	const FKawaiiFluidSubstepDecision Calm = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(State, Settings, FrameTime60, 20.0f);
+	TestEqual(TEXT("Calm fluid runs one substep"), Calm.SubstepCount, 1);
+	TestTrue(TEXT("Decision is adaptive"), Calm.bAdaptive);
+
+	const FKawaiiFluidSubstepDecision Splash = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(State, Settings, FrameTime60, 1200.0f);
+	TestTrue(TEXT("Splash raises substeps immediately"), Splash.SubstepCount > Calm.SubstepCount);
+	TestTrue(TEXT("Splash substep satisfies CFL"), Splash.SubstepDeltaTime <= Splash.CFLTimeStep + KINDA_SMALL_NUMBER);
+
+	const FKawaiiFluidSubstepDecision Extreme = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(State, Settings, FrameTime60, 50000.0f);
+	TestEqual(TEXT("Extreme speed clamps to MaxSubsteps"), Extreme.SubstepCount, Settings.MaxSubsteps);
+
+	AddInfo(FString::Printf(TEXT("Calm=%d, Splash=%d, Extreme=%d"), Calm.SubstepCount, Splash.SubstepCount, Extreme.SubstepCount));
+	return true;
+}
+
+/**
+ * @brief S-03: Hysteresis Downshift Test.
+ * After a spike the count holds for DownshiftFrames-1 calm frames and drops on the DownshiftFrames-th.
+ */
+bool FKawaiiFluidSubstepTest_HysteresisDownshift::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidAdaptiveSubstepSettings Settings = MakeDefaultSettings();
+	FKawaiiFluidAdaptiveSubstepState State;
+
+	const int32 HighCount = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(State, Settings, FrameTime60, 1200.0f).SubstepCount;
+
+	for (int32 Frame = 1; Frame < Settings.DownshiftFrames; ++Frame)
+	{
+		const int32 Count = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(State, Settings, FrameTime60, 20.0f).SubstepCount;
+		TestEqual(FString::Printf(TEXT("Count held on calm frame %d"), Frame), Count, HighCount);
+	}
+
+	const int32 LowCount = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(State, Settings, FrameTime60, 20.0f).SubstepCount;
+	TestEqual(TEXT("Count drops after DownshiftFrames"), LowCount, 1);
+
+	// A speed that satisfies CFL but not the hysteresis headroom must not drop the count
+	FKawaiiFluidAdaptiveSubstepState BoundaryState;
+	FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(BoundaryState, Settings, FrameTime60, 500.0f);
+	const int32 BoundaryCount = BoundaryState.CurrentSubsteps;
+	for (int32 Frame = 0; Frame < Settings.DownshiftFrames * 2; ++Frame)
+	{
+		FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(BoundaryState, Settings, FrameTime60, 440.0f);
+	}
+	TestEqual(TEXT("No downshift without CFL headroom"), BoundaryState.CurrentSubsteps, BoundaryCount);
+
+	AddInfo(FString::Printf(TEXT("High=%d, Low=%d, Boundary=%d"), HighCount, LowCount, BoundaryCount));
+	return true;
+}
+
+/**
+ * @brief S-04: Fallback Without Velocity Test.
+ * Before the first readback (MaxVelocity < 0) the fixed SubstepDeltaTime scheme is used.
+ */
+bool FKawaiiFluidSubstepTest_FallbackWithoutVelocity::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidAdaptiveSubstepSettings Settings = MakeDefaultSettings();
+	FKawaiiFluidAdaptiveSubstepState State;
+
+	const FKawaiiFluidSubstepDecision Decision = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(State, Settings, FrameTime60, -1.0f);
+	TestEqual(TEXT("Fixed scheme count at 60 Hz"), Decision.SubstepCount, 2);
+	TestFalse(TEXT("Fallback decision is not adaptive"), Decision.bAdaptive);
+
+	const FKawaiiFluidSubstepDecision Paused = FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(State, Settings, 0.0f, 100.0f);
+	TestEqual(TEXT("Zero frame time runs no substeps"), Paused.SubstepCount, 0);
+	return true;
+}
+
+/**
+ * @brief S-05: Trace Oscillation Test.
+ * Replays a 600 frame synthetic speed trace at 60 Hz through the selector only (no solver) for the fixed scheme,
+ * adaptive without hysteresis and adaptive with hysteresis. Speed samples lag by two frames to model the async
+ * readback. Checks CFL violations and count switches; the solver comparison is KawaiiFluid.Benchmark.AdaptiveSubsteps.
+ */
+bool FKawaiiFluidSubstepTest_TraceOscillation::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumFrames = 600;
+	constexpr int32 ReadbackLatency = 2;
+
+	const FKawaiiFluidAdaptiveSubstepSettings Settings = MakeDefaultSettings();
+	const TArray<float> Trace = MakeVelocityTrace(NumFrames);
+
+	auto LaggedSpeed = [&Trace](int32 Frame)
+	{
+		return Frame >= ReadbackLatency ? Trace[Frame - ReadbackLatency] : -1.0f;
+	};
+
+	const int32 FixedCount = FMath::Clamp(FMath::CeilToInt(FrameTime60 / Settings.FallbackSubstepDeltaTime - KINDA_SMALL_NUMBER), 1, Settings.MaxSubsteps);
+	const FSubstepRunResult Fixed = EvaluateScheme(Trace, Settings, [FixedCount](int32) { return FixedCount; });
+
+	FKawaiiFluidAdaptiveSubstepSettings NoHysteresisSettings = Settings;
+	NoHysteresisSettings.HysteresisRatio = 0.0f;
+	NoHysteresisSettings.DownshiftFrames = 1;
+	FKawaiiFluidAdaptiveSubstepState NoHysteresisState;
+	const FSubstepRunResult NoHysteresis = EvaluateScheme(Trace, Settings, [&](int32 Frame)
+	{
+		return FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(NoHysteresisState, NoHysteresisSettings, FrameTime60, LaggedSpeed(Frame)).SubstepCount;
+	});
+
+	FKawaiiFluidAdaptiveSubstepState AdaptiveState;
+	const FSubstepRunResult Adaptive = EvaluateScheme(Trace, Settings, [&](int32 Frame)
+	{
+		return FKawaiiFluidAdaptiveSubsteps::SelectSubsteps(AdaptiveState, Settings, FrameTime60, LaggedSpeed(Frame)).SubstepCount;
+	});
+
+	AddInfo(FString::Printf(TEXT("Fixed:         avg substeps %.2f, CFL violations %d, max dt/CFL %.2f, switches %d"),
+		Fixed.AverageSubsteps, Fixed.CFLViolationFrames, Fixed.MaxCFLRatio, Fixed.CountSwitches));
+	AddInfo(FString::Printf(TEXT("Adaptive (raw): avg substeps %.2f, CFL violations %d, max dt/CFL %.2f, switches %d"),
+		NoHysteresis.AverageSubsteps, NoHysteresis.CFLViolationFrames, NoHysteresis.MaxCFLRatio, NoHysteresis.CountSwitches));
+	AddInfo(FString::Printf(TEXT("Adaptive (hyst): avg substeps %.2f, CFL violations %d, max dt/CFL %.2f, switches %d"),
+		Adaptive.AverageSubsteps, Adaptive.CFLViolationFrames, Adaptive.MaxCFLRatio, Adaptive.CountSwitches));
+
+	TestTrue(TEXT("Adaptive is more stable than fixed"), Adaptive.CFLViolationFrames < Fixed.CFLViolationFrames);
+	TestTrue(TEXT("Hysteresis reduces count oscillation"), Adaptive.CountSwitches < NoHysteresis.CountSwitches);
+	TestTrue(TEXT("Hysteresis does not add CFL violations"), Adaptive.CFLViolationFrames <= NoHysteresis.CFLViolationFrames);
+
+	return true;
+}
+
+/**
+ * @brief Adaptive vs Fixed Substep Benchmark.
+ * Runs the CPU solver on the preset evaluator's canonical drop scene with the default preset, once with the fixed
+ * SubstepDeltaTime scheme and once with adaptive substeps. Reports substeps, density error against rest density
+ * (mean and peak over all frames) and solver time per frame for both.
+ */
+bool FKawaiiFluidBenchmark_AdaptiveSubsteps::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidPresetEvaluationSettings Settings;
+	Settings.SimulatedSeconds = 2.0f;
+	Settings.FillHalfExtent = FVector(25.0);
+	Settings.DropHeight = 60.0f;
+	Settings.ArenaHalfWidth = 80.0f;
+	Settings.MaxParticles = 4000;
+
+	UKawaiiFluidPresetDataAsset* FixedPreset = NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	FixedPreset->bAdaptiveSubsteps = false;
+
+	UKawaiiFluidPresetDataAsset* AdaptivePreset = DuplicateObject(FixedPreset, GetTransientPackage());
+	AdaptivePreset->bAdaptiveSubsteps = true;
+
+	const FKawaiiFluidPresetEvaluation Fixed = FKawaiiFluidPresetEvaluator::Evaluate(FixedPreset, Settings);
+	const FKawaiiFluidPresetEvaluation Adaptive = FKawaiiFluidPresetEvaluator::Evaluate(AdaptivePreset, Settings);
+
+	auto Report = [this](const TCHAR* Label, const FKawaiiFluidPresetEvaluation& Result)
+	{
+		AddInfo(FString::Printf(TEXT("%s %d particles, %d frames: avg substeps %.2f, density error mean %.3f peak %.3f, peak speed %.0f cm/s, %.2f ms/frame"),
+			Label, Result.ParticleCount, Result.Frames, static_cast<double>(Result.Substeps) / FMath::Max(Result.Frames, 1),
+			Result.MeanDensityError, Result.PeakDensityError, Result.PeakMaxVelocity, Result.GetMsPerFrame()));
+	};
+	Report(TEXT("Fixed:   "), Fixed);
+	Report(TEXT("Adaptive:"), Adaptive);
+
+	TestTrue(TEXT("Fixed scheme stable"), Fixed.IsStable());
+	TestTrue(TEXT("Adaptive scheme stable"), Adaptive.IsStable());
+	TestEqual(TEXT("Both schemes simulate every frame"), Adaptive.Frames, Fixed.Frames);
+	TestTrue(TEXT("Adaptive substeps stay within MaxSubsteps"), Adaptive.Substeps <= Adaptive.Frames * AdaptivePreset->MaxSubsteps);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
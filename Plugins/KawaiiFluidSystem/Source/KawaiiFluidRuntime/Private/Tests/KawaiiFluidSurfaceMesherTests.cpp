@@ -0,0 +1,317 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Algo/Reverse.h"
+#include "Rendering/KawaiiFluidSurfaceMesher.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_SingleParticleSphere,
+	"KawaiiFluid.Rendering.SurfaceMesher.SM01_SingleParticleSphere",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_ClosedAcrossBlocks,
+	"KawaiiFluid.Rendering.SurfaceMesher.SM02_ClosedAcrossBlocks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_BlockCacheReuse,
+	"KawaiiFluid.Rendering.SurfaceMesher.SM03_BlockCacheReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_AnisotropicKernel,
+	"KawaiiFluid.Rendering.SurfaceMesher.SM04_AnisotropicKernel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmark_SurfaceMesher,
+	"KawaiiFluid.Benchmark.SurfaceMesher",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Check that every triangle edge is shared by exactly one opposite-wound triangle.
+	 * @param Mesh Mesh to check.
+	 * @return True if the mesh is closed and consistently oriented.
+	 */
+	bool IsClosedAndConsistent(const FKawaiiFluidSurfaceMesh& Mesh)
+	{
+		TMap<uint64, int32> DirectedEdges;
+		for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+		{
+			for (int32 k = 0; k < 3; ++k)
+			{
+				const uint64 A = Mesh.Indices[i + k];
+				const uint64 B = Mesh.Indices[i + (k + 1) % 3];
+				++DirectedEdges.FindOrAdd((A << 32) | B, 0);
+			}
+		}
+		for (const TPair<uint64, int32>& Edge : DirectedEdges)
+		{
+			const uint64 Reverse = (Edge.Key << 32) | (Edge.Key >> 32);
+			if (Edge.Value != 1 || DirectedEdges.FindRef(Reverse) != 1)
+			{
+				return false;
+			}
+		}
+		return Mesh.Indices.Num() > 0;
+	}
+
+	/** @brief Helper: Enclosed volume (divergence theorem; positive when triangles face outward). */
+	double GetSignedVolume(const FKawaiiFluidSurfaceMesh& Mesh)
+	{
+		double Volume = 0.0;
+		for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+		{
+			const FVector A(Mesh.Positions[Mesh.Indices[i]]);
+			const FVector B(Mesh.Positions[Mesh.Indices[i + 1]]);
+			const FVector C(Mesh.Positions[Mesh.Indices[i + 2]]);
+			Volume += FVector::DotProduct(A, FVector::CrossProduct(B, C));
+		}
+		return Volume / 6.0;
+	}
+
+	/**
+	 * @brief Helper: Jittered lattice filling a ball.
+	 * @param Center Ball center.
+	 * @param Radius Ball radius.
+	 * @param Spacing Lattice spacing.
+	 * @param Seed Jitter seed.
+	 * @return Particle positions.
+	 */
+	TArray<FVector3f> MakeBall(const FVector3f& Center, float Radius, float Spacing, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector3f> Positions;
+		const int32 Steps = FMath::CeilToInt(Radius / Spacing);
+		for (int32 Z = -Steps; Z <= Steps; ++Z)
+		{
+			for (int32 Y = -Steps; Y <= Steps; ++Y)
+			{
+				for (int32 X = -Steps; X <= Steps; ++X)
+				{
+					const FVector3f Offset = FVector3f(X, Y, Z) * Spacing + FVector3f(Random.VRand()) * (Spacing * 0.1f);
+					if (Offset.Size() <= Radius)
+					{
+						Positions.Add(Center + Offset);
+					}
+				}
+			}
+		}
+		return Positions;
+	}
+}
+
+/** @brief SM-01: One particle meshes as a closed sphere at the kernel's iso radius. */
+bool FKawaiiFluidSurfaceMesherTest_SingleParticleSphere::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSurfaceMeshParams Params;
+	Params.ParticleRadius = 5.0f;
+
+	// Off-grid center, so the sphere straddles block boundaries
+	const FVector3f Center(20.3f, -0.7f, 39.1f);
+	const TArray<FVector3f> Positions = { Center };
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMesh Mesh;
+	Mesher.Build(Positions, Params, Mesh);
+
+	// (1 - q^2)^3 = Iso  ->  q = sqrt(1 - Iso^(1/3))
+	const float ExpectedRadius = Params.GetSmoothingRadius() * FMath::Sqrt(1.0f - FMath::Pow(Params.IsoThreshold, 1.0f / 3.0f));
+	float MaxError = 0.0f;
+	for (const FVector3f& Position : Mesh.Positions)
+	{
+		MaxError = FMath::Max(MaxError, FMath::Abs(FVector3f::Distance(Position, Center) - ExpectedRadius));
+	}
+
+	TestTrue(TEXT("Mesh produced"), Mesh.NumTriangles() > 0);
+	TestTrue(TEXT("Closed and consistently wound"), IsClosedAndConsistent(Mesh));
+	TestTrue(FString::Printf(TEXT("Vertices on iso sphere (max error %.3f cm)"), MaxError), MaxError < Params.GetCellSize() * 0.5f);
+	TestTrue(TEXT("Outward winding"), GetSignedVolume(Mesh) > 0.0);
+
+	bool bNormalsOutward = true;
+	for (int32 i = 0; i < Mesh.NumVertices(); ++i)
+	{
+		bNormalsOutward &= FVector3f::DotProduct(Mesh.Normals[i], (Mesh.Positions[i] - Center).GetSafeNormal()) > 0.8f;
+	}
+	TestTrue(TEXT("Normals point outward"), bNormalsOutward);
+
+	return true;
+}
+
+/** @brief SM-02: A ball spanning many blocks is welded into one closed surface of the expected volume. */
+bool FKawaiiFluidSurfaceMesherTest_ClosedAcrossBlocks::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSurfaceMeshParams Params;
+	Params.ParticleRadius = 5.0f;
+
+	constexpr float BallRadius = 60.0f;
+	const TArray<FVector3f> Positions = MakeBall(FVector3f(-13.0f, 7.0f, 100.0f), BallRadius, 8.0f, 7);
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMesh Mesh;
+	Mesher.Build(Positions, Params, Mesh);
+	const FKawaiiFluidSurfaceMeshStats& Stats = Mesher.GetLastStats();
+
+	TestTrue(TEXT("Surface spans several blocks"), Stats.NumSurfaceBlocks > 8);
+	TestTrue(TEXT("Interior blocks produce no triangles"), Stats.NumSurfaceBlocks < Stats.NumBlocks);
+	TestTrue(TEXT("Closed after welding"), IsClosedAndConsistent(Mesh));
+
+	// The surface sits roughly one particle radius outside the outermost particles
+	const double Volume = GetSignedVolume(Mesh);
+	const double MinVolume = 4.0 / 3.0 * UE_DOUBLE_PI * FMath::Cube(BallRadius - Params.ParticleRadius);
+	const double MaxVolume = 4.0 / 3.0 * UE_DOUBLE_PI * FMath::Cube(BallRadius + 2.0 * Params.ParticleRadius);
+	TestTrue(FString::Printf(TEXT("Volume %.0f within [%.0f, %.0f]"), Volume, MinVolume, MaxVolume), Volume > MinVolume && Volume < MaxVolume);
+
+	return true;
+}
+
+/** @brief SM-03: Unchanged blocks are reused, a moved particle re-meshes only the blocks it touches. */
+bool FKawaiiFluidSurfaceMesherTest_BlockCacheReuse::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSurfaceMeshParams Params;
+	Params.ParticleRadius = 5.0f;
+
+	TArray<FVector3f> Positions = MakeBall(FVector3f(0.0f, 0.0f, 80.0f), 50.0f, 8.0f, 11);
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMesh First, Second;
+	Mesher.Build(Positions, Params, First);
+	TestEqual(TEXT("Cold build reuses nothing"), Mesher.GetLastStats().NumReusedBlocks, 0);
+
+	// Same particles in a different order: block hashes are order-independent
+	Algo::Reverse(Positions);
+	Mesher.Build(Positions, Params, Second);
+	TestEqual(TEXT("Every block reused"), Mesher.GetLastStats().NumReusedBlocks, Mesher.GetLastStats().NumBlocks);
+	TestEqual(TEXT("Same triangle count"), Second.NumTriangles(), First.NumTriangles());
+	TestTrue(TEXT("Reused mesh closed"), IsClosedAndConsistent(Second));
+
+	// Nudge one surface particle
+	int32 Outermost = 0;
+	for (int32 i = 1; i < Positions.Num(); ++i)
+	{
+		if (Positions[i].Z > Positions[Outermost].Z)
+		{
+			Outermost = i;
+		}
+	}
+	Positions[Outermost].Z += 3.0f;
+	Mesher.Build(Positions, Params, Second);
+	const FKawaiiFluidSurfaceMeshStats& Stats = Mesher.GetLastStats();
+	TestTrue(TEXT("Most blocks reused"), Stats.NumReusedBlocks > 0 && Stats.NumReusedBlocks < Stats.NumBlocks);
+	// Old and new kernel footprints together span at most 3 blocks per axis
+	TestTrue(TEXT("Only blocks around the particle re-meshed"), Stats.NumBlocks - Stats.NumReusedBlocks <= 27);
+	TestTrue(TEXT("Partially rebuilt mesh closed"), IsClosedAndConsistent(Second));
+
+	// Disabling the cache always re-meshes
+	Params.bEnableBlockCache = false;
+	Mesher.Build(Positions, Params, Second);
+	TestEqual(TEXT("No reuse without cache"), Mesher.GetLastStats().NumReusedBlocks, 0);
+
+	return true;
+}
+
+/** @brief SM-04: Anisotropy axes stretch the kernel: the surface extent follows each axis scale. */
+bool FKawaiiFluidSurfaceMesherTest_AnisotropicKernel::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSurfaceMeshParams Params;
+	Params.ParticleRadius = 5.0f;
+	Params.CellSize = 1.0f;
+
+	const TArray<FVector3f> Positions = { FVector3f(0.5f, 0.5f, 0.5f) };
+	const TArray<FVector4f> Axis1 = { FVector4f(1.0f, 0.0f, 0.0f, 2.0f) };
+	const TArray<FVector4f> Axis2 = { FVector4f(0.0f, 1.0f, 0.0f, 0.5f) };
+	const TArray<FVector4f> Axis3 = { FVector4f(0.0f, 0.0f, 1.0f, 1.0f) };
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMesh Mesh;
+	Mesher.Build(Positions, Axis1, Axis2, Axis3, Params, Mesh);
+	TestTrue(TEXT("Ellipsoid closed"), IsClosedAndConsistent(Mesh));
+
+	FBox3f Bounds(ForceInit);
+	for (const FVector3f& Position : Mesh.Positions)
+	{
+		Bounds += Position;
+	}
+	const FVector3f Extent = Bounds.GetExtent();
+	const float IsoRadius = Params.GetSmoothingRadius() * FMath::Sqrt(1.0f - FMath::Pow(Params.IsoThreshold, 1.0f / 3.0f));
+	TestEqual(TEXT("X stretched by 2"), Extent.X, IsoRadius * 2.0f, Params.CellSize);
+	TestEqual(TEXT("Y squashed by 0.5"), Extent.Y, IsoRadius * 0.5f, Params.CellSize);
+	TestEqual(TEXT("Z unchanged"), Extent.Z, IsoRadius, Params.CellSize);
+
+	// Anisotropy ignored when disabled
+	Params.bUseAnisotropy = false;
+	Mesher.Build(Positions, Axis1, Axis2, Axis3, Params, Mesh);
+	Bounds = FBox3f(ForceInit);
+	for (const FVector3f& Position : Mesh.Positions)
+	{
+		Bounds += Position;
+	}
+	TestEqual(TEXT("Sphere when anisotropy disabled"), Bounds.GetExtent().X, IsoRadius, Params.CellSize);
+
+	return true;
+}
+
+/**
+ * @brief Surface Mesher Benchmark.
+ * 100k particles in a shallow pool: cold build, unchanged rebuild (all blocks cached),
+ * and a rebuild where one corner of the pool moved (partial re-mesh).
+ */
+bool FKawaiiFluidBenchmark_SurfaceMesher::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumParticles = 100000;
+	constexpr float Spacing = 8.0f;
+
+	FKawaiiFluidSurfaceMeshParams Params;
+	Params.ParticleRadius = 5.0f;
+
+	// 100 x 100 x 10 jittered pool
+	FRandomStream Random(5);
+	TArray<FVector3f> Positions;
+	Positions.Reserve(NumParticles);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const int32 X = i % 100;
+		const int32 Y = (i / 100) % 100;
+		const int32 Z = i / 10000;
+		Positions.Add(FVector3f(X, Y, Z) * Spacing + FVector3f(Random.VRand()) * 1.0f);
+	}
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMesh Mesh;
+
+	Mesher.Build(Positions, Params, Mesh);
+	const FKawaiiFluidSurfaceMeshStats Cold = Mesher.GetLastStats();
+	const int32 ColdTriangles = Mesh.NumTriangles();
+
+	Mesher.Build(Positions, Params, Mesh);
+	const FKawaiiFluidSurfaceMeshStats Cached = Mesher.GetLastStats();
+
+	// Disturb a 20 x 20 corner of the surface layer
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		if (i / 10000 == 9 && i % 100 < 20 && (i / 100) % 100 < 20)
+		{
+			Positions[i].Z += Random.FRandRange(-2.0f, 2.0f);
+		}
+	}
+	Mesher.Build(Positions, Params, Mesh);
+	const FKawaiiFluidSurfaceMeshStats Partial = Mesher.GetLastStats();
+
+	AddInfo(FString::Printf(TEXT("%d particles, cell %.2f cm, %d blocks (%d with surface), %d triangles"),
+		NumParticles, Params.GetCellSize(), Cold.NumBlocks, Cold.NumSurfaceBlocks, ColdTriangles));
+	AddInfo(FString::Printf(TEXT("Cold build: %.2f ms"), Cold.BuildMs));
+	AddInfo(FString::Printf(TEXT("Unchanged rebuild: %.2f ms (%d/%d blocks reused)"), Cached.BuildMs, Cached.NumReusedBlocks, Cached.NumBlocks));
+	AddInfo(FString::Printf(TEXT("Partial rebuild: %.2f ms (%d/%d blocks reused)"), Partial.BuildMs, Partial.NumReusedBlocks, Partial.NumBlocks));
+
+	TestTrue(TEXT("Pool meshed"), ColdTriangles > 0);
+	TestEqual(TEXT("Unchanged rebuild reuses every block"), Cached.NumReusedBlocks, Cached.NumBlocks);
+	TestTrue(TEXT("Partial rebuild reuses most blocks"), Partial.NumReusedBlocks > Partial.NumBlocks / 2);
+	TestTrue(TEXT("Partially rebuilt pool closed"), IsClosedAndConsistent(Mesh));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidSpawnDescriptor.h"
 #include "Core/KawaiiFluidSimulationTypes.h"
 #include "Core/KawaiiFluidRenderingTypes.h"
 #include "KawaiiFluidVolume.generated.h"
@@ -114,7 +115,10 @@ public:
 	// Brush API (Editor/Runtime shared)
 	//========================================
 
-	/** Add particles within radius (hemisphere distribution - spawns above surface only) */
+	/**
+	 * Add particles within radius (hemisphere distribution - spawns above surface only)
+	 * The stroke is queued as one Hemisphere spawn descriptor sampled on the GPU; samples landing on existing fluid are dropped
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Brush")
 	void AddParticlesInRadius(const FVector& WorldCenter, float Radius, int32 Count,
 	                          const FVector& Velocity, float Randomness = 0.8f,
@@ -178,13 +182,24 @@ public:
 	/** Queue multiple spawn requests at once (batch version for efficiency) */
 	void QueueSpawnRequests(const TArray<FVector>& Positions, const TArray<FVector>& Velocities, int32 SourceID = -1);
 
+	/**
+	 * Queue a procedural spawn (lattice fill or stream layer) as one record; positions are generated on the GPU
+	 * @return Number of particles the descriptor spawns
+	 */
+	int32 QueueSpawnDescriptor(const FKawaiiFluidSpawnDescriptor& Descriptor);
+
 	/** Get number of pending spawn requests */
 	UFUNCTION(BlueprintPure, Category = "Spawn")
-	int32 GetPendingSpawnCount() const { return PendingSpawnRequests.Num(); }
+	int32 GetPendingSpawnCount() const { return PendingSpawnRequests.Num() + PendingSpawnPlanParticleCount; }
 
 	/** Clear all pending spawn requests */
 	UFUNCTION(BlueprintCallable, Category = "Spawn")
-	void ClearPendingSpawnRequests() { PendingSpawnRequests.Empty(); }
+	void ClearPendingSpawnRequests()
+	{
+		PendingSpawnRequests.Empty();
+		PendingSpawnPlans.Empty();
+		PendingSpawnPlanParticleCount = 0;
+	}
 
 	/** Clear pending spawn requests for a specific SourceID */
 	UFUNCTION(BlueprintCallable, Category = "Spawn")
@@ -194,6 +209,15 @@ public:
 		{
 			return Request.SourceID == SourceID;
 		});
+		PendingSpawnPlans.RemoveAll([this, SourceID](const FKawaiiFluidSpawnPlan& Plan)
+		{
+			if (Plan.GetDescriptor().SourceID != SourceID)
+			{
+				return false;
+			}
+			PendingSpawnPlanParticleCount -= Plan.Num();
+			return true;
+		});
 	}
 
 	/** Process pending spawn requests (called automatically during simulation) */
@@ -242,6 +266,12 @@ protected:
 	/** Pending spawn requests to be processed in the next simulation tick */
 	TArray<FGPUSpawnRequest> PendingSpawnRequests;
 
+	/** Pending procedural spawn plans, forwarded with the requests */
+	TArray<FKawaiiFluidSpawnPlan> PendingSpawnPlans;
+
+	/** Total particles of PendingSpawnPlans */
+	int32 PendingSpawnPlanParticleCount = 0;
+
 	//========================================
 	// Internal
 	//========================================
@@ -307,6 +337,24 @@ private:
 
 	/** Flag to track if editor rendering is initialized */
 	bool bEditorRenderingInitialized = false;
+
+	/** Seconds the fluid must stay below the sleep speed before brush-mode simulation pauses */
+	static constexpr float EditorSleepDelaySeconds = 0.5f;
+
+	/** Resume brush-mode simulation (strokes, brush removal, entering brush mode) */
+	void WakeEditorSimulation();
+
+	/** Brush-mode simulation runs only while awake */
+	bool bEditorSimulationAwake = false;
+
+	/** Seconds the readback max speed has stayed below the sleep speed */
+	float EditorSettledSeconds = 0.0f;
+
+	/** Max speed readback serial seen last tick (detects stale readbacks) */
+	uint32 EditorMaxSpeedSerial = 0;
+
+	/** Brush mode state of the last tick (enables max speed feedback on change) */
+	bool bEditorBrushModeWasActive = false;
 #endif
 
 	/** Compute debug color for a particle */
@@ -329,6 +377,12 @@ private:
 	/** Cached neighbor counts for isolation detection */
 	TArray<int32> CachedNeighborCounts;
 
+	/** Cached persistent particle IDs (aligned with CachedShadowPositions) for stable shadow instances */
+	TArray<int32> CachedShadowParticleIDs;
+
+	/** Cached particle flags (aligned with CachedShadowPositions) for sleep detection */
+	TArray<uint32> CachedShadowFlags;
+
 	/** Previous frame neighbor counts for state change detection (non-isolated -> isolated) */
 	TArray<int32> PrevNeighborCounts;
 
@@ -349,4 +403,14 @@ private:
 
 	/** Buffer for shadow position prediction to avoid per-frame allocation */
 	TArray<FVector> ShadowPredictionBuffer;
+
+	/** Particle IDs aligned with ShadowPredictionBuffer for the current frame */
+	TArray<int32> ShadowParticleIDBuffer;
+
+	/** Positions/IDs last registered for shadows, re-registered on throttled frames */
+	TArray<FVector> LastRegisteredShadowPositions;
+	TArray<int32> LastRegisteredShadowParticleIDs;
+
+	/** Frame of the last fresh (non-throttled) shadow registration */
+	uint64 LastShadowRegisterFrame = 0;
 };
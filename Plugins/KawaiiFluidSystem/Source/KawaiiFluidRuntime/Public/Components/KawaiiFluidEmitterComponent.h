@@ -11,6 +11,7 @@ class AKawaiiFluidVolume;
 class UKawaiiFluidSimulationModule;
 class UBillboardComponent;
 class APawn;
+struct FKawaiiFluidSpawnDescriptor;
 
 /**
  * @brief Emitter type for KawaiiFluidEmitterComponent.
@@ -52,6 +53,7 @@ enum class EKawaiiFluidEmitterShapeType : uint8
  * @param bUseWorldSpaceVelocity Whether velocity direction is world or local space
  * @param InitialVelocityDirection Direction vector for spawned particles
  * @param InitialSpeed Initial speed in cm/s
+ * @param RandomSeed Seed of the spawn jitter; the same seed replays the same particles every play session
  * @param MaxParticleCount Particle budget for this emitter (0 = unlimited)
  * @param bRecycleOldestParticles Whether to recycle particles when limit is reached
  * @param bAutoStartSpawning Start spawning automatically on BeginPlay
@@ -79,6 +81,7 @@ enum class EKawaiiFluidEmitterShapeType : uint8
  * @param ParticleCount Manual particle count setting
  * @param bUseJitter Internal toggle for jitter
  * @param JitterAmount Jitter magnitude
+ * @param SpawnJitterSeed Spawn calls since BeginPlay (random stream of the next descriptor)
  * @param SpawnOffset World position offset
  * @param SpawnDirection Direction vector for stream
  * @param StreamParticleSpacing Internal spacing cache
@@ -160,6 +163,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Emitter|Velocity", meta = (ClampMin = "0.0"))
 	float InitialSpeed = 250.0f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Emitter")
+	int32 RandomSeed = 0;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Emitter|Limits", meta = (ClampMin = "0"))
 	int32 MaxParticleCount = 100000;
 
@@ -227,6 +233,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Emitter")
 	bool IsStreamSpawning() const { return bStreamSpawning; }
 
+	UFUNCTION(BlueprintPure, Category = "Emitter")
+	int32 GetSourceID() const { return CachedSourceID; }
+
 protected:
 	float SpawnAccumulator = 0.0f;
 
@@ -262,11 +271,7 @@ protected:
 
 	void SpawnStreamLayer(FVector Position, FVector LayerDirection, FVector VelocityDirection, float Speed, float Radius, float Spacing);
 
-	void SpawnStreamLayerBatch(FVector Position, FVector LayerDirection, FVector VelocityDirection, 
-	                           float Speed, float Radius, float Spacing,
-	                           TArray<FVector>& OutPositions, TArray<FVector>& OutVelocities);
-
-	void QueueSpawnRequest(const TArray<FVector>& Positions, const TArray<FVector>& Velocities);
+	int32 QueueSpawnDescriptor(FKawaiiFluidSpawnDescriptor& Descriptor, bool bApplyParticleLimit = true);
 
 	UKawaiiFluidSimulationModule* GetSimulationModule() const;
 
@@ -301,6 +306,7 @@ protected:
 	int32 ParticleCount = 500;
 	bool bUseJitter = true;
 	float JitterAmount = 0.2f;
+	uint32 SpawnJitterSeed = 0;
 	
 	FVector SpawnOffset = FVector::ZeroVector;
 	FVector SpawnDirection = FVector(0, 0, -1);
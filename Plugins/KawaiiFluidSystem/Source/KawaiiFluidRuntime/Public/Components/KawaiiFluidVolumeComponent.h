@@ -34,6 +34,8 @@ class UNiagaraSystem;
  * @param ShadowMeshQuality Polygon detail for shadow spheres
  * @param ShadowCullDistance Max distance for shadow rendering
  * @param ShadowRadiusOffset Size adjustment for shadow spheres
+ * @param ShadowThrottleDistance Camera distance beyond which shadow updates are throttled (0 = never)
+ * @param ShadowThrottleInterval Frames between shadow updates while throttled
  * @param SplashVFX Niagara system for splash effects
  * @param SplashVelocityThreshold Speed required to trigger splash
  * @param MaxSplashVFXPerFrame Budget for splash spawning
@@ -148,6 +150,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Rendering", meta = (EditCondition = "bEnableShadow", ClampMin = "-50.0", ClampMax = "50.0"))
 	float ShadowRadiusOffset = 0.0f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Rendering", meta = (EditCondition = "bEnableShadow", ClampMin = "0"))
+	float ShadowThrottleDistance = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Rendering", meta = (EditCondition = "bEnableShadow && ShadowThrottleDistance > 0", ClampMin = "1", ClampMax = "60"))
+	int32 ShadowThrottleInterval = 4;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|VFX")
 	TObjectPtr<UNiagaraSystem> SplashVFX;
 
@@ -23,6 +23,8 @@
  * @param bJustDetached Flag to prevent immediate reattachment after detaching.
  * @param bNearGround Flag indicating proximity to world geometry.
  * @param bNearBoundary Flag indicating proximity to boundary particles.
+ * @param bIsSleeping Whether the particle is asleep and frozen in place (CPU sleeping).
+ * @param SleepCounter Consecutive substeps spent below the sleep velocity threshold.
  * @param ParticleID Unique identifier for the particle.
  * @param NeighborIndices List of neighbor particle indices found in the spatial hash.
  * @param SourceID Combined identifier for preset and component source.
@@ -71,6 +73,11 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticle
 
 	bool bNearBoundary;
 
+	UPROPERTY(BlueprintReadOnly, Category = "Particle")
+	bool bIsSleeping;
+
+	int32 SleepCounter;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Particle")
 	int32 ParticleID;
 
@@ -100,6 +107,8 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticle
 		, bJustDetached(false)
 		, bNearGround(false)
 		, bNearBoundary(false)
+		, bIsSleeping(false)
+		, SleepCounter(0)
 		, ParticleID(-1)
 		, SourceID(-1)
 		, bIsSurfaceParticle(false)
@@ -122,6 +131,8 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticle
 		, bJustDetached(false)
 		, bNearGround(false)
 		, bNearBoundary(false)
+		, bIsSleeping(false)
+		, SleepCounter(0)
 		, ParticleID(InID)
 		, SourceID(-1)
 		, bIsSurfaceParticle(false)
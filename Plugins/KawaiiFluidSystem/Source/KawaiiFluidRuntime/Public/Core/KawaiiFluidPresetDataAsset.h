@@ -13,6 +13,45 @@ class UKawaiiFluidPresetDataAsset;
 /** @brief Delegate broadcast when preset properties change (SmoothingRadius, etc.) */
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPresetPropertyChanged, UKawaiiFluidPresetDataAsset*);
 
+/**
+ * @struct FKawaiiFluidSolverRecommendation
+ * @brief Solver counts suggested by the preset auto-tuner, applied only on request.
+ *
+ * @param bValid A tuning run produced this recommendation.
+ * @param bMeetsTarget The recommendation reached TuningTargetDensityError in the canonical scene.
+ * @param SolverIterations Recommended XPBD iterations.
+ * @param SubstepDeltaTime Recommended substep length.
+ * @param MaxSubsteps Recommended substep cap.
+ * @param EstimatedMsPer10kParticles Predicted CPU solver cost per frame for 10k particles.
+ * @param DensityError Mean density error measured in the canonical scene.
+ */
+USTRUCT(BlueprintType)
+struct FKawaiiFluidSolverRecommendation
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	bool bValid = false;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	bool bMeetsTarget = false;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	int32 SolverIterations = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	float SubstepDeltaTime = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	int32 MaxSubsteps = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	float EstimatedMsPer10kParticles = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	float DensityError = 0.0f;
+};
+
 /**
  * @class UKawaiiFluidPresetDataAsset
  * @brief Data Asset that stores physics and rendering parameters for a specific fluid type.
@@ -39,6 +78,13 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnPresetPropertyChanged, UKawaiiFluidPreset
  * @param EstimatedNeighborCount Predicted number of neighbors within the smoothing radius.
  * @param SubstepDeltaTime Target time step for simulation stability.
  * @param MaxSubsteps Upper limit on the number of substeps per frame.
+ * @param bDecoupledSimulationRate Run simulation ticks at SimulationRate and interpolate rendering between the last two ticks.
+ * @param SimulationRate Fixed simulation tick rate (Hz) in decoupled mode.
+ * @param MaxSimulationTicksPerFrame Catch-up limit in decoupled mode; older accumulated time is dropped.
+ * @param bAdaptiveSubsteps Choose the substep count each frame from a CFL limit on max particle speed (ignored in decoupled mode).
+ * @param CFLNumber Fraction of ParticleRadius a particle may travel per substep in adaptive mode.
+ * @param SubstepHysteresis Relative CFL headroom required before the adaptive substep count drops.
+ * @param SubstepDownshiftFrames Frames the lower count must stay valid before the adaptive substep count drops.
  * @param SolverIterations XPBD constraint solver iterations (4-6 recommended for water).
  * @param ComplianceExponent Scaling factor for compressibility based on SmoothingRadius.
  * @param Gravity Acceleration vector applied to all fluid particles.
@@ -70,6 +116,10 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnPresetPropertyChanged, UKawaiiFluidPreset
  * @param MaxSurfaceTensionCorrectionPerIteration Stability limit for position correction.
  * @param SurfaceTensionVelocityDamping Under-relaxation factor for surface tension.
  * @param SurfaceTensionTolerance Dead zone around activation distance.
+ * @param TuningTargetDensityError Mean density error the auto-tuner must reach (editor only).
+ * @param TuningBudgetMsPer10kParticles CPU solver cost limit per frame for 10k particles for the auto-tuner (editor only).
+ * @param EstimatedMsPer10kParticles Cost model estimate for the current solver settings (editor only).
+ * @param SolverRecommendation Last auto-tuner result; ApplySolverRecommendation copies it into the solver settings (editor only).
  * @param ThumbnailInfo Metadata for editor thumbnail generation.
  * @param OnPropertyChanged Broadcasted when properties are modified in the editor.
  */
@@ -155,6 +205,27 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (ClampMin = "1", ClampMax = "16"))
 	int32 MaxSubsteps = 8;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver")
+	bool bDecoupledSimulationRate = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (EditCondition = "bDecoupledSimulationRate", ClampMin = "10.0", ClampMax = "240.0", Units = "Hz"))
+	float SimulationRate = 30.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (EditCondition = "bDecoupledSimulationRate", ClampMin = "1", ClampMax = "8"))
+	int32 MaxSimulationTicksPerFrame = 2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver")
+	bool bAdaptiveSubsteps = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (EditCondition = "bAdaptiveSubsteps", ClampMin = "0.1", ClampMax = "2.0"))
+	float CFLNumber = 0.8f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (EditCondition = "bAdaptiveSubsteps", ClampMin = "0.0", ClampMax = "0.9"))
+	float SubstepHysteresis = 0.2f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (EditCondition = "bAdaptiveSubsteps", ClampMin = "1", ClampMax = "120"))
+	int32 SubstepDownshiftFrames = 15;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (ClampMin = "1", ClampMax = "10"))
 	int32 SolverIterations = 3;
 
@@ -273,6 +344,38 @@ public:
 
 	float SurfaceTensionTolerance = 1.0f;
 
+#if WITH_EDITORONLY_DATA
+	//========================================
+	// Performance (Editor)
+	//========================================
+
+	UPROPERTY(EditAnywhere, Category = "Performance", meta = (ClampMin = "0.001", ClampMax = "1.0"))
+	float TuningTargetDensityError = 0.05f;
+
+	UPROPERTY(EditAnywhere, Category = "Performance", meta = (ClampMin = "0.01", Units = "ms"))
+	float TuningBudgetMsPer10kParticles = 4.0f;
+
+	UPROPERTY(VisibleAnywhere, Transient, Category = "Performance", meta = (Units = "ms"))
+	float EstimatedMsPer10kParticles = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, Category = "Performance")
+	FKawaiiFluidSolverRecommendation SolverRecommendation;
+#endif
+
+#if WITH_EDITOR
+	/** Price the current solver settings with the session cost model (calibrates it on first use) */
+	UFUNCTION(CallInEditor, Category = "Performance")
+	void EstimateSolverCost();
+
+	/** Search iterations and substeps reaching TuningTargetDensityError within the budget; stores SolverRecommendation */
+	UFUNCTION(CallInEditor, Category = "Performance")
+	void AutoTuneSolver();
+
+	/** Copy SolverRecommendation into the solver settings */
+	UFUNCTION(CallInEditor, Category = "Performance")
+	void ApplySolverRecommendation();
+#endif
+
 	//========================================
 	// Utility Functions
 	//========================================
@@ -9,6 +9,7 @@
 #include "Simulation/Resources/GPUFluidParticle.h"
 #include "Core/KawaiiFluidPresetDataAsset.h"
 #include "Components/KawaiiFluidVolumeComponent.h"
+#include "Simulation/Utils/KawaiiFluidAdaptiveSubsteps.h"
 #include "KawaiiFluidSimulationContext.generated.h"
 
 // Forward declarations
@@ -17,6 +18,7 @@ class FKawaiiFluidDensityConstraint;
 class FKawaiiFluidViscositySolver;
 class FKawaiiFluidAdhesionSolver;
 class FKawaiiFluidStackPressureSolver;
+class FKawaiiFluidSleepSolver;
 class FGPUFluidSimulator;
 class FKawaiiFluidRenderResource;
 struct FGPUFluidSimulationParams;
@@ -31,9 +33,12 @@ struct FGPUFluidSimulationParams;
  * @param ViscositySolver Solver for applying XSPH-based viscosity.
  * @param AdhesionSolver Solver for surface tension and cohesion forces.
  * @param StackPressureSolver Solver for transferring weight between stacked attached particles.
+ * @param SleepSolver Particle sleeping and cell deactivation for the CPU substep.
  * @param bSolversInitialized Internal flag indicating if the solvers have been initialized.
  * @param GPUSimulator The GPU simulator instance for compute-shader based simulation.
  * @param RenderResource Shared resources for batched rendering across multiple components.
+ * @param AdaptiveSubstepState Hysteresis state for CFL-driven adaptive substeps.
+ * @param LastSubstepDecision Substep count and time step chosen in the last simulated frame (for stats).
  * @param PersistentBoneTransforms Bone transforms from the previous frame used for velocity calculation.
  * @param PersistentBoneNameToIndex Mapping of bone names to indices for consistent tracking.
  * @param CachedPreset Weak reference to the preset currently being used.
@@ -42,6 +47,8 @@ struct FGPUFluidSimulationParams;
  * @param CachedGPUWorldCollisionBounds The world-space bounds for the current collision cache.
  * @param CachedGPUWorldCollisionWorld The world associated with the current collision cache.
  * @param bGPUWorldCollisionCacheDirty Flag to trigger a rebuild of the world collision cache.
+ * @param GPUCollisionExportSignature Colliders, shape revisions and material of the last non-bone collision upload; empty forces an export.
+ * @param bGPUCollisionExportHasPrimitives The last collision export produced primitives.
  * @param bStaticBoundaryParticlesDirty Flag to trigger regeneration of static boundary particles.
  * @param CachedLandscapeHeightmap Sampled heightmap data for landscape collision.
  * @param CachedHeightmapWidth Width of the cached heightmap texture.
@@ -90,6 +97,9 @@ public:
 
 	void SetTargetVolumeComponent(UKawaiiFluidVolumeComponent* InVolumeComponent) { TargetVolumeComponent = InVolumeComponent; }
 
+	/** Substep count and time step of the last simulated frame (zero before the first) */
+	const FKawaiiFluidSubstepDecision& GetLastSubstepDecision() const { return LastSubstepDecision; }
+
 	//========================================
 	// Render Resource (for batch rendering)
 	//========================================
@@ -132,6 +142,14 @@ protected:
 	// Simulation Steps
 	//========================================
 
+	virtual void RunSubstepSteps(
+		TArray<FKawaiiFluidParticle>& Particles,
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		FKawaiiFluidSpatialHash& SpatialHash,
+		float SubstepDT
+	);
+
 	virtual void PredictPositions(
 		TArray<FKawaiiFluidParticle>& Particles,
 		const UKawaiiFluidPresetDataAsset* Preset,
@@ -237,6 +255,14 @@ protected:
 		const TSet<const AActor*>& FluidColliderOwners
 	);
 
+	bool BuildGPUCollisionExportSignature(
+		const FKawaiiFluidSimulationParams& Params,
+		const FBox& QueryBounds,
+		float DefaultFriction,
+		float DefaultRestitution,
+		TArray<uint32>& OutSignature
+	) const;
+
 protected:
 	//========================================
 	// Cached Solvers
@@ -250,6 +276,8 @@ protected:
 
 	TSharedPtr<FKawaiiFluidStackPressureSolver> StackPressureSolver;
 
+	TSharedPtr<FKawaiiFluidSleepSolver> SleepSolver;
+
 	bool bSolversInitialized = false;
 
 	void EnsureSolversInitialized(const UKawaiiFluidPresetDataAsset* Preset);
@@ -266,6 +294,14 @@ protected:
 
 	TSharedPtr<FKawaiiFluidRenderResource> RenderResource;
 
+	//========================================
+	// Adaptive Substeps
+	//========================================
+
+	FKawaiiFluidAdaptiveSubstepState AdaptiveSubstepState;
+
+	FKawaiiFluidSubstepDecision LastSubstepDecision;
+
 	virtual void SimulateGPU(
 		TArray<FKawaiiFluidParticle>& Particles,
 		const UKawaiiFluidPresetDataAsset* Preset,
@@ -315,6 +351,10 @@ protected:
 
 	bool bGPUWorldCollisionCacheDirty = true;
 
+	TArray<uint32> GPUCollisionExportSignature;
+
+	bool bGPUCollisionExportHasPrimitives = false;
+
 	bool bStaticBoundaryParticlesDirty = true;
 
 	//========================================
@@ -16,11 +16,17 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Cohesion"), STAT_FluidCohesion, STATGROUP_Kawaii
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Collision"), STAT_FluidCollision, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("GPU Simulation"), STAT_FluidGPUSimulation, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("GPU Readback"), STAT_FluidGPUReadback, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Shadow Clustering"), STAT_FluidShadowClustering, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Shadow Instance Update"), STAT_FluidShadowInstanceUpdate, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Particle Count"), STAT_FluidParticleCount, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Particles"), STAT_FluidActiveParticles, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Attached Particles"), STAT_FluidAttachedParticles, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Substep Count"), STAT_FluidSubstepCount, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Substep dt (ms)"), STAT_FluidSubstepDeltaTime, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("CFL dt (ms)"), STAT_FluidCFLTimeStep, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shadow Particles"), STAT_FluidShadowParticles, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shadow Instances"), STAT_FluidShadowInstances, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 
 DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Avg Velocity (cm/s)"), STAT_FluidAvgVelocity, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Max Velocity (cm/s)"), STAT_FluidMaxVelocity, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
@@ -64,6 +70,9 @@ DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Stability Score"), STAT_FluidStabilitySc
  * @param PrimitiveCollisionCount Number of collisions with explicitly registered colliders.
  * @param GroundContactCount Number of particles in contact with the world geometry/ground.
  * @param SubstepCount Number of substeps executed in the current frame.
+ * @param SubstepDeltaTime Time step of each substep in seconds.
+ * @param CFLTimeStep CFL-limited time step in seconds (adaptive mode, 0 if unconstrained).
+ * @param bAdaptiveSubsteps Flag indicating the substep count was chosen by the CFL condition.
  * @param SolverIterations Number of solver iterations per substep.
  * @param TotalSimulationTimeMs Total CPU/GPU time for simulation in milliseconds.
  * @param SpatialHashTimeMs Time spent building and querying the spatial hash.
@@ -111,6 +120,9 @@ public:
 	int32 GroundContactCount = 0;
 
 	int32 SubstepCount = 0;
+	float SubstepDeltaTime = 0.0f;
+	float CFLTimeStep = 0.0f;
+	bool bAdaptiveSubsteps = false;
 	int32 SolverIterations = 0;
 
 	double TotalSimulationTimeMs = 0.0;
@@ -214,6 +226,13 @@ public:
 
 	void SetSubstepCount(int32 Count) { CurrentStats.SubstepCount = Count; }
 
+	void SetSubstepTiming(float SubstepDT, float CFLDT, bool bAdaptive)
+	{
+		CurrentStats.SubstepDeltaTime = SubstepDT;
+		CurrentStats.CFLTimeStep = CFLDT;
+		CurrentStats.bAdaptiveSubsteps = bAdaptive;
+	}
+
 	void SetSolverIterations(int32 Iterations) { CurrentStats.SolverIterations = Iterations; }
 
 	void SetGPUSimulation(bool bGPU) { CurrentStats.bIsGPUSimulation = bGPU; }
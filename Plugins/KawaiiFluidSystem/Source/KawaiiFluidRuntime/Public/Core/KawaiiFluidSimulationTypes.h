@@ -163,6 +163,29 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidCollisionEvent
 	float HitSpeed = 0.0f;
 };
 
+/**
+ * @struct FKawaiiFluidParticleRecord
+ * @brief Lightweight particle snapshot returned by world-level particle queries.
+ * 
+ * @param Position World-space particle position.
+ * @param Velocity Particle velocity (zero when the backend did not read velocities back).
+ * @param SourceID ID of the component that spawned the particle.
+ */
+USTRUCT(BlueprintType)
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticleRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Query")
+	FVector Position = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Query")
+	FVector Velocity = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Query")
+	int32 SourceID = -1;
+};
+
 DECLARE_DELEGATE_OneParam(FOnFluidCollisionEvent, const FKawaiiFluidCollisionEvent&);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
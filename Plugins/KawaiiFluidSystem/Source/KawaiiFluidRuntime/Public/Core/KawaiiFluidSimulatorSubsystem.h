@@ -8,14 +8,17 @@
 #include "Core/KawaiiFluidSimulationTypes.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidParticleQueryIndex.h"
 #include "KawaiiFluidSimulatorSubsystem.generated.h"
 
 class UKawaiiFluidSimulationModule;
 class UKawaiiFluidSimulationContext;
 class UKawaiiFluidPresetDataAsset;
 class UKawaiiFluidVolumeComponent;
+struct FGPUFluidMemoryStats;
 class AKawaiiFluidVolume;
 class AKawaiiFluidEmitter;
+class UKawaiiFluidEmitterComponent;
 class UKawaiiFluidCollider;
 class UKawaiiFluidInteractionComponent;
 class AActor;
@@ -24,6 +27,61 @@ class FKawaiiFluidSpatialHash;
 struct FKawaiiFluidParticle;
 class FGPUFluidSimulator;
 
+/**
+ * @enum EKawaiiFluidBudgetTier
+ * @brief Simulation tier assigned to a context by the world budget arbiter.
+ */
+UENUM(BlueprintType)
+enum class EKawaiiFluidBudgetTier : uint8
+{
+	Full		UMETA(DisplayName = "Full"),
+	Throttled	UMETA(DisplayName = "Throttled"),
+	Suspended	UMETA(DisplayName = "Suspended")
+};
+
+/**
+ * @struct FKawaiiFluidBudgetStats
+ * @brief Per-frame snapshot of the world-level particle and compute budget.
+ * 
+ * @param ParticleBudget Effective particle cap this frame (0 = unlimited).
+ * @param TotalParticleCount Live + pending particles summed over all GPU simulators.
+ * @param WorkBudget Simulation work budget per frame in particles x substeps (0 = unlimited).
+ * @param EstimatedWork Particles x substeps summed over all GPU simulators.
+ * @param SimulatedWork Estimated work of the contexts that are not suspended.
+ * @param FullCount Number of contexts simulated without restriction.
+ * @param ThrottledCount Number of contexts whose emitters are capped to fit the particle budget.
+ * @param SuspendedCount Number of contexts whose simulation is skipped to fit the work budget.
+ */
+USTRUCT(BlueprintType)
+struct FKawaiiFluidBudgetStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Budget")
+	int32 ParticleBudget = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Budget")
+	int32 TotalParticleCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Budget")
+	int64 WorkBudget = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Budget")
+	int64 EstimatedWork = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Budget")
+	int64 SimulatedWork = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Budget")
+	int32 FullCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Budget")
+	int32 ThrottledCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Budget")
+	int32 SuspendedCount = 0;
+};
+
 /**
  * @struct FContextCacheKey
  * @brief Cache key for looking up simulation contexts based on volume and preset.
@@ -88,6 +146,14 @@ struct FContextCacheKey
  * @param OnLevelAddedHandle Delegate handle for tracking level addition.
  * @param OnLevelRemovedHandle Delegate handle for tracking level removal.
  * @param OnPostActorTickHandle Delegate handle for the post-actor tick simulation pass.
+ * @param BudgetStats Latest world budget snapshot.
+ * @param ContextBudgetTiers Tier assigned to each context by the last budget update.
+ * @param AppliedSourceCaps Per-source emitter caps currently imposed by the budget arbiter.
+ * @param BudgetReleaseFrames Throttled contexts and how many consecutive frames their spare budget exceeded the release margin.
+ * @param ParticleQueryIndex Spatial index over all particles, rebuilt lazily once per frame on first query.
+ * @param ParticleQueryIndexFrame GFrameCounter value the query index was built for.
+ * @param LastParticleQueryFrame Last frame a query was issued (drives query readback shutdown).
+ * @param bQueryReadbackActive True while GPU simulators are asked to keep the query readback alive.
  */
 UCLASS()
 class KAWAIIFLUIDRUNTIME_API UKawaiiFluidSimulatorSubsystem : public UTickableWorldSubsystem
@@ -185,6 +251,21 @@ public:
 	UFUNCTION(BlueprintPure, Category = "KawaiiFluid|Query")
 	UKawaiiFluidPresetDataAsset* GetPresetBySourceID(int32 SourceID) const;
 
+	UFUNCTION(BlueprintCallable, Category = "KawaiiFluid|Query")
+	TArray<FKawaiiFluidParticleRecord> QueryParticlesInSphere(FVector Location, float Radius) const;
+
+	UFUNCTION(BlueprintCallable, Category = "KawaiiFluid|Query")
+	TArray<FKawaiiFluidParticleRecord> QueryParticlesInBox(FVector Center, FVector Extent) const;
+
+	UFUNCTION(BlueprintCallable, Category = "KawaiiFluid|Query")
+	TArray<FKawaiiFluidParticleRecord> QueryNearestParticles(FVector Location, int32 Count, float MaxDistance = 0.0f) const;
+
+	UFUNCTION(BlueprintCallable, Category = "KawaiiFluid|Query")
+	bool RaycastParticles(FVector Start, FVector End, float HitRadius, FKawaiiFluidParticleRecord& OutRecord, float& OutDistance) const;
+
+	/** Spatial index for batched C++ queries (game thread only, valid for the current frame) */
+	const FKawaiiFluidParticleQueryIndex& GetParticleQueryIndex() const;
+
 	UKawaiiFluidSimulationModule* GetModuleBySourceID(int32 SourceID) const;
 
 	//========================================
@@ -200,6 +281,18 @@ public:
 
 	void GetAllGPUSimulators(TArray<FGPUFluidSimulator*>& OutSimulators) const;
 
+	/** GPU memory reserved vs used per volume (nullptr key = contexts without a volume) */
+	void GetVolumeMemoryStats(TArray<TPair<UKawaiiFluidVolumeComponent*, FGPUFluidMemoryStats>>& OutStats) const;
+
+	//========================================
+	// World Budget
+	//========================================
+
+	UFUNCTION(BlueprintPure, Category = "KawaiiFluid|Budget")
+	FKawaiiFluidBudgetStats GetBudgetStats() const { return BudgetStats; }
+
+	EKawaiiFluidBudgetTier GetContextBudgetTier(const UKawaiiFluidSimulationContext* Context) const;
+
 private:
 	//========================================
 	// Module Management
@@ -266,6 +359,56 @@ private:
 
 	FCriticalSection CPUCollisionFeedbackLock;
 
+	//========================================
+	// World Budget State
+	//========================================
+
+	/**
+	 * @struct FAppliedSourceCap
+	 * @brief Budget-imposed emitter cap for one SourceID.
+	 */
+	struct FAppliedSourceCap
+	{
+		TWeakPtr<FGPUFluidSimulator> Simulator;
+		int32 AppliedCap = 0;
+	};
+
+	FKawaiiFluidBudgetStats BudgetStats;
+
+	TMap<const UKawaiiFluidSimulationContext*, EKawaiiFluidBudgetTier> ContextBudgetTiers;
+
+	TMap<int32, FAppliedSourceCap> AppliedSourceCaps;
+
+	TMap<const UKawaiiFluidSimulationContext*, int32> BudgetReleaseFrames;
+
+	void UpdateSimulationBudget();
+
+	void ApplyContextParticleGrant(UKawaiiFluidSimulationContext* Context, int32 ContextParticleCount, int32 Grant, TMap<int32, FAppliedSourceCap>& OutCaps);
+
+	void HoldContextCaps(const UKawaiiFluidSimulationContext* Context, TMap<int32, FAppliedSourceCap>& OutCaps) const;
+
+	void ReleaseBudgetCaps();
+
+	static int32 GetEmitterRecycleCap(const UKawaiiFluidEmitterComponent* EmitterComp);
+
+	bool ResolveSourceBaseCap(int32 SourceID, int32& OutBaseCap) const;
+
+	void RestoreSourceCap(int32 SourceID, const FAppliedSourceCap& Applied) const;
+
+	//========================================
+	// Particle Query State
+	//========================================
+
+	mutable FKawaiiFluidParticleQueryIndex ParticleQueryIndex;
+
+	mutable uint64 ParticleQueryIndexFrame = MAX_uint64;
+
+	mutable uint64 LastParticleQueryFrame = 0;
+
+	mutable bool bQueryReadbackActive = false;
+
+	void UpdateQueryReadback();
+
 	//========================================
 	// Simulation Methods
 	//========================================
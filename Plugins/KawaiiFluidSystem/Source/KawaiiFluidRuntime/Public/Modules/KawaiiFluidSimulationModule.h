@@ -8,6 +8,7 @@
 #include "Core/KawaiiFluidSimulationTypes.h"
 #include "Core/IKawaiiFluidDataProvider.h"
 #include "Simulation/GPUFluidSimulator.h"
+#include "Simulation/Utils/KawaiiFluidSpawnRandom.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
 #include "KawaiiFluidSimulationModule.generated.h"
 
@@ -21,6 +22,7 @@ class UKawaiiFluidInteractionComponent;
 class UKawaiiFluidSimulationContext;
 class UKawaiiFluidVolumeComponent;
 class AKawaiiFluidVolume;
+struct FKawaiiFluidLatticeTemplateKey;
 
 /**
  * @class UKawaiiFluidSimulationModule
@@ -46,6 +48,7 @@ class AKawaiiFluidVolume;
  * @param VolumeWireframeColor Color of the simulation bounds box in the editor.
  * @param bShowZOrderSpaceWireframe Visualization flag for internal grid partitions.
  * @param ZOrderSpaceWireframeColor Color of the internal grid wireframe.
+ * @param SpawnRandomSeed Seed of the spawn jitter; the same seed and spawn calls reproduce the same particles.
  * @param bEnableCollisionEvents Enable emission of collision event data.
  * @param MinVelocityForEvent Speed threshold required to trigger an event callback.
  * @param MaxEventsPerFrame Limit on the number of events processed per frame.
@@ -69,6 +72,7 @@ class AKawaiiFluidVolume;
  * @param PreviousRegisteredVolume Tracking reference for volume re-registration in the editor.
  * @param bBoundToVolumeDestroyed Internal state for volume destruction event tracking.
  * @param CachedSourceID Assigned unique identifier for GPU-side source tracking.
+ * @param SpawnRandomStream Spawn calls made since initialization (random stream index of the next call).
  */
 UCLASS(DefaultToInstanced, EditInlineNew, BlueprintType)
 class KAWAIIFLUIDRUNTIME_API UKawaiiFluidSimulationModule : public UObject, public IKawaiiFluidDataProvider
@@ -271,6 +275,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Fluid")
 	void ClearAllParticles();
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Spawn")
+	int32 SpawnRandomSeed = 0;
+
+	UFUNCTION(BlueprintCallable, Category = "Fluid|Spawn")
+	void ResetSpawnRandom(int32 Seed);
+
+	/** Seeded random stream for one spawn call (advances the stream counter) */
+	FKawaiiFluidSpawnRandom NextSpawnRandom();
+
 	UFUNCTION(BlueprintCallable, Category = "Fluid")
 	void DespawnByBrushGPU(FVector Center, float Radius);
 
@@ -457,6 +470,10 @@ public:
 	int32 GetSourceID() const { return CachedSourceID; }
 
 private:
+	/** Spawn a cached lattice template at Center/Rotation with uniform local jitter */
+	int32 SpawnLatticeTemplate(const FKawaiiFluidLatticeTemplateKey& Key, const FVector& Center, const FQuat& Rotation,
+	                           const FVector& Velocity, float JitterRange);
+
 	TWeakPtr<FGPUFluidSimulator> WeakGPUSimulator;
 
 	bool bGPUSimulationActive = false;
@@ -497,4 +514,6 @@ private:
 #endif
 
 	int32 CachedSourceID = -1;
+
+	uint32 SpawnRandomStream = 0;
 };
\ No newline at end of file
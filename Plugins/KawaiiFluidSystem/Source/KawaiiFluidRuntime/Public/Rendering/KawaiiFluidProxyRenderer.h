@@ -28,6 +28,9 @@ class IKawaiiFluidDataProvider;
  * @param CachedWorld Cached pointer to the world context.
  * @param CachedOwnerComponent Component to which the internal instances are attached.
  * @param CachedPreset The data asset containing fluid physical properties.
+ * @param InstanceTransforms Instance transforms of the last update, rebuilt in place every frame.
+ * @param InstanceCustomData Per-instance RGBA velocity colors of the last update.
+ * @param RegisteredReadbackFields Readback fields currently registered with the GPU simulator (None when unregistered).
  */
 UCLASS()
 class KAWAIIFLUIDRUNTIME_API UKawaiiFluidProxyRenderer : public UObject
@@ -43,6 +46,9 @@ public:
 
 	void UpdateRendering(const IKawaiiFluidDataProvider* DataProvider, float DeltaTime);
 
+	/** Stop the GPU readback this renderer requested (call when it will not be updated) */
+	void ReleaseReadback(const IKawaiiFluidDataProvider* DataProvider);
+
 	bool IsEnabled() const { return bEnabled; }
 
 	void SetEnabled(bool bInEnabled);
@@ -104,6 +110,18 @@ protected:
 
 	void InitializeISM();
 
+	/** EGPUReadbackField bits the current settings read (velocity only for color or rotation) */
+	uint32 GetReadbackFields() const;
+
+	/** Push InstanceTransforms / InstanceCustomData to the ISM, in place when the instance count is unchanged */
+	void ApplyInstances(bool bWriteColors);
+
+	TArray<FTransform> InstanceTransforms;
+
+	TArray<float> InstanceCustomData;
+
+	uint32 RegisteredReadbackFields = 0;
+
 	UStaticMesh* GetDefaultParticleMesh();
 
 	UMaterialInterface* GetDefaultParticleMaterial();
@@ -7,6 +7,8 @@
 #include "Tickable.h"
 #include "Parameters/KawaiiFluidRenderingParameters.h"
 #include "Core/KawaiiFluidRenderingTypes.h"
+#include "Rendering/KawaiiFluidShadowClusterer.h"
+#include "Rendering/KawaiiFluidShadowInstanceTracker.h"
 #include "KawaiiFluidRendererSubsystem.generated.h"
 
 class FKawaiiFluidSceneViewExtension;
@@ -29,13 +31,25 @@ static constexpr int32 NUM_SHADOW_QUALITY_LEVELS = 3;
  * @param ViewExtension Scene view extension for pipeline injection.
  * @param bEnableISMShadow Toggle for particle-based shadow casting via ISM.
  * @param ParticleSkipFactor Optimization factor for shadow instance conversion.
+ * @param bEnableShadowClustering Merge nearby shadow particles into ellipsoid blobs (one instance per grid cell).
+ * @param ShadowClusterCellScale Cluster cell edge length in particle diameters.
+ * @param ShadowClusterMinParticles Cells with fewer particles keep one sphere per particle.
+ * @param ShadowUpdateTolerance Instances that moved or resized less than this (cm) are not re-uploaded.
  * @param ShadowProxyActor Internal actor holding the shadow ISM components.
  * @param ShadowInstanceComponents Array of ISM components per shadow quality level.
  * @param ShadowSphereMeshes Cached low-poly meshes for shadow spheres.
  * @param AggregatedPositions Buffered particle positions for the current frame's shadow pass.
  * @param AggregatedRadius Current frame's max particle radius per quality level.
  * @param bHasParticlesThisFrame Tracking flag for shadow buffer status.
+ * @param AggregatedKeys Buffered stable particle keys (owner << 32 | ParticleID), aligned with AggregatedPositions.
+ * @param bAllSettledThisFrame True while every registration of the frame reported settled (sleeping or throttled) particles.
+ * @param FrameSignature Hash of the frame's registrations (owners, counts, radius).
+ * @param SettledSignature Signature of the last flushed frame if it was settled, 0 otherwise.
  * @param CachedInstanceTransforms Reusable transform buffer for batch ISM updates.
+ * @param CachedInstanceKeys Reusable instance key buffer, aligned with CachedInstanceTransforms.
+ * @param ShadowClusterer Grid clusterer with persistent scratch buffers.
+ * @param CachedShadowBlobs Reusable blob buffer for the current quality level.
+ * @param ShadowTrackers Slot assignment per quality level; leading ISM instances are tracker slots, the rest are parked at zero scale.
  */
 UCLASS()
 class KAWAIIFLUIDRUNTIME_API UKawaiiFluidRendererSubsystem : public UWorldSubsystem, public FTickableGameObject
@@ -98,7 +112,30 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1", ClampMax = "10", ToolTip = "Skip factor for particle-to-instance conversion. Higher values improve performance but reduce shadow detail."))
 	int32 ParticleSkipFactor = 1;
 
-	void RegisterShadowParticles(const FVector* ParticlePositions, int32 NumParticles, float ParticleRadius, EFluidShadowMeshQuality Quality);
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ToolTip = "Merge nearby particles into larger ellipsoid shadow blobs. Greatly reduces instance count; shadow outlines become slightly softer."))
+	bool bEnableShadowClustering = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1.0", ClampMax = "8.0", EditCondition = "bEnableShadowClustering", ToolTip = "Cluster cell size in particle diameters. Each occupied cell becomes one shadow instance."))
+	float ShadowClusterCellScale = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1", ClampMax = "64", EditCondition = "bEnableShadowClustering", ToolTip = "Cells with fewer particles than this keep one sphere per particle, so isolated droplets still cast their own shadow."))
+	int32 ShadowClusterMinParticles = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "0.0", ClampMax = "10.0", ToolTip = "Shadow instances that moved or resized less than this distance (cm) keep their previous transform and are not re-uploaded."))
+	float ShadowUpdateTolerance = 0.5f;
+
+	/**
+	 * Register shadow particles for aggregation (flushed in Tick)
+	 * @param ParticlePositions Particle world positions
+	 * @param NumParticles Number of particles
+	 * @param ParticleRadius Shadow radius of each particle
+	 * @param Quality Shadow mesh quality level
+	 * @param ParticleIDs Persistent particle IDs aligned with positions (keeps instances in stable slots), or nullptr
+	 * @param OwnerKey Identifies the registering volume so IDs of different volumes do not collide
+	 * @param bSettled Positions are unchanged since the previous registration (sleeping or throttled volume)
+	 */
+	void RegisterShadowParticles(const FVector* ParticlePositions, int32 NumParticles, float ParticleRadius, EFluidShadowMeshQuality Quality,
+		const int32* ParticleIDs = nullptr, uint32 OwnerKey = 0, bool bSettled = false);
 
 private:
 	UPROPERTY(Transient)
@@ -124,10 +161,28 @@ private:
 
 	bool bHasParticlesThisFrame[NUM_SHADOW_QUALITY_LEVELS] = { false, false, false };
 
+	TArray<uint64> AggregatedKeys[NUM_SHADOW_QUALITY_LEVELS];
+
+	bool bAllSettledThisFrame[NUM_SHADOW_QUALITY_LEVELS] = { true, true, true };
+
+	uint64 FrameSignature[NUM_SHADOW_QUALITY_LEVELS] = { 0, 0, 0 };
+
+	uint64 SettledSignature[NUM_SHADOW_QUALITY_LEVELS] = { 0, 0, 0 };
+
 	TArray<FTransform> CachedInstanceTransforms;
 
+	TArray<uint64> CachedInstanceKeys;
+
+	FKawaiiFluidShadowClusterer ShadowClusterer;
+
+	TArray<FKawaiiFluidShadowBlob> CachedShadowBlobs;
+
+	FKawaiiFluidShadowInstanceTracker ShadowTrackers[NUM_SHADOW_QUALITY_LEVELS];
+
 	void FlushShadowInstances();
 
+	void ApplyShadowInstanceUpdates(UInstancedStaticMeshComponent* ISM, int32 QualityIndex);
+
 	void ClearAggregationBuffers();
 
 	void CleanupShadowResources();
@@ -0,0 +1,88 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FKawaiiFluidShadowClusterParams
+ * @brief Settings for merging shadow particles into blobs.
+ *
+ * @param ParticleRadius Shadow radius of a single particle (cm).
+ * @param CellSizeScale Cluster cell edge length as a multiple of the particle diameter.
+ * @param MinClusterParticles Cells with fewer particles emit them individually (isolated droplets keep their own shadow).
+ */
+struct FKawaiiFluidShadowClusterParams
+{
+	float ParticleRadius = 5.0f;
+	float CellSizeScale = 2.0f;
+	int32 MinClusterParticles = 4;
+
+	float GetCellSize() const { return FMath::Max(ParticleRadius * 2.0f * CellSizeScale, UE_KINDA_SMALL_NUMBER); }
+};
+
+/**
+ * @struct FKawaiiFluidShadowBlob
+ * @brief One shadow proxy instance: an axis-aligned ellipsoid.
+ *
+ * @param Center Blob center (world space).
+ * @param HalfExtent Ellipsoid semi-axes (cm).
+ * @param Key Stable identity across frames: the grid cell for clusters (ClusterKeyBit set), the particle key otherwise.
+ */
+struct FKawaiiFluidShadowBlob
+{
+	/** Set in Key of blobs that stand for a whole cell */
+	static constexpr uint64 ClusterKeyBit = 1ull << 63;
+
+	FVector Center = FVector::ZeroVector;
+	FVector HalfExtent = FVector::ZeroVector;
+	uint64 Key = 0;
+};
+
+/**
+ * @class FKawaiiFluidShadowClusterer
+ * @brief Merges shadow particles on a uniform grid into one ellipsoid blob per occupied cell.
+ *
+ * Each blob is centered on its particles' centroid with semi-axes from their per-axis spread, then
+ * shrunk when the cell holds less fluid than the blob would cover, so sparse spray casts a lighter
+ * shadow than a filled cell. Output order follows first occurrence in the input, which keeps instance
+ * indices stable for spatially sorted (Z-order) particle arrays. Blob keys let FKawaiiFluidShadowInstanceTracker
+ * keep each cell/droplet in the same instance slot across frames. Scratch buffers persist between calls.
+ *
+ * @param CellKeys Packed cell coordinate per particle.
+ * @param ParticleClusters Cluster index per particle.
+ * @param Clusters Per-cell accumulators.
+ * @param CellToCluster Cell key -> cluster index.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidShadowClusterer
+{
+public:
+	/**
+	 * Build shadow blobs for a particle set
+	 * @param Positions Particle world positions
+	 * @param ParticleKeys Stable key per particle (top bit clear) for blobs emitted per particle, or empty to use the index
+	 * @param Params Clustering settings
+	 * @param OutBlobs Receives the blobs (reset first)
+	 */
+	void Cluster(TConstArrayView<FVector> Positions, TConstArrayView<uint64> ParticleKeys, const FKawaiiFluidShadowClusterParams& Params, TArray<FKawaiiFluidShadowBlob>& OutBlobs);
+
+	void Cluster(TConstArrayView<FVector> Positions, const FKawaiiFluidShadowClusterParams& Params, TArray<FKawaiiFluidShadowBlob>& OutBlobs)
+	{
+		Cluster(Positions, {}, Params, OutBlobs);
+	}
+
+private:
+	struct FClusterAccum
+	{
+		uint64 CellKey = 0;
+		FVector Origin = FVector::ZeroVector;
+		FVector Sum = FVector::ZeroVector;
+		FVector SumSq = FVector::ZeroVector;
+		int32 Count = 0;
+	};
+
+	TArray<uint64> CellKeys;
+	TArray<int32> ParticleClusters;
+	TArray<FClusterAccum> Clusters;
+	TMap<uint64, int32> CellToCluster;
+};
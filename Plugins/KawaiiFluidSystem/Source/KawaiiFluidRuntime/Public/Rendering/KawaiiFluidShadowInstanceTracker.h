@@ -0,0 +1,62 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FKawaiiFluidShadowInstanceTracker
+ * @brief Keeps shadow instances in stable slots keyed by particle/cluster identity and reports only the slots that changed.
+ *
+ * Each Update reconciles this frame's (key, transform) list with the previous one:
+ * - known keys keep their slot and are marked dirty only when they moved beyond the tolerance,
+ * - vanished keys free their slot, which is refilled by a new key or by swap-removing the last slot,
+ * - remaining new keys are appended.
+ * The slot count therefore changes by exactly the net instance delta and untouched slots are never rewritten.
+ *
+ * @param KeyToSlot Instance key -> slot.
+ * @param SlotKeys Key per slot.
+ * @param SlotTransforms Last uploaded transform per slot.
+ * @param SlotSeenEpoch Epoch a slot was last matched in.
+ * @param DirtySlots Slots to upload after the last Update (ascending).
+ * @param NewInputs Scratch: input indices without a slot.
+ * @param StaleSlots Scratch: slots whose key vanished.
+ * @param Epoch Update counter.
+ * @param PrevNumSlots Slot count before the last Update.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidShadowInstanceTracker
+{
+public:
+	/**
+	 * Reconcile the frame's instances with the tracked slots
+	 * @param Keys Stable identity per instance (duplicates after the first are ignored)
+	 * @param Transforms Desired transform per instance
+	 * @param Tolerance Minimum translation or extent change (cm) that triggers a rewrite
+	 * @param MeshRadius Radius of the instanced mesh, converts scale changes to cm
+	 */
+	void Update(TConstArrayView<uint64> Keys, TConstArrayView<FTransform> Transforms, float Tolerance, float MeshRadius);
+
+	/** Forget every slot (next Update treats all keys as new) */
+	void Reset();
+
+	int32 GetNumSlots() const { return SlotKeys.Num(); }
+
+	int32 GetPrevNumSlots() const { return PrevNumSlots; }
+
+	TConstArrayView<int32> GetDirtySlots() const { return DirtySlots; }
+
+	const TArray<FTransform>& GetSlotTransforms() const { return SlotTransforms; }
+
+	TConstArrayView<uint64> GetSlotKeys() const { return SlotKeys; }
+
+private:
+	TMap<uint64, int32> KeyToSlot;
+	TArray<uint64> SlotKeys;
+	TArray<FTransform> SlotTransforms;
+	TArray<uint32> SlotSeenEpoch;
+	TArray<int32> DirtySlots;
+	TArray<int32> NewInputs;
+	TArray<int32> StaleSlots;
+	uint32 Epoch = 0;
+	int32 PrevNumSlots = 0;
+};
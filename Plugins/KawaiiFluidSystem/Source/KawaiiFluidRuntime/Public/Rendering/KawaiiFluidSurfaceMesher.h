@@ -0,0 +1,158 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMeshDescription;
+
+/**
+ * @struct FKawaiiFluidSurfaceMeshParams
+ * @brief Surface reconstruction settings.
+ *
+ * @param ParticleRadius Particle radius (cm).
+ * @param SmoothingRadiusScale Kernel support radius as a multiple of ParticleRadius.
+ * @param CellSize Grid cell edge length (cm), <= 0 for half the particle radius.
+ * @param IsoThreshold Field value of the surface; with the defaults an isolated particle meshes at ~0.9 ParticleRadius.
+ * @param bUseAnisotropy Stretch each particle's kernel by its anisotropy axes when they are provided.
+ * @param bEnableBlockCache Reuse the previous mesh of blocks whose contributing particles did not change.
+ */
+struct FKawaiiFluidSurfaceMeshParams
+{
+	float ParticleRadius = 5.0f;
+	float SmoothingRadiusScale = 2.0f;
+	float CellSize = 0.0f;
+	float IsoThreshold = 0.5f;
+	bool bUseAnisotropy = true;
+	bool bEnableBlockCache = true;
+
+	float GetCellSize() const { return CellSize > 0.0f ? CellSize : ParticleRadius * 0.5f; }
+
+	float GetSmoothingRadius() const { return ParticleRadius * SmoothingRadiusScale; }
+};
+
+/**
+ * @struct FKawaiiFluidSurfaceMesh
+ * @brief Welded triangle mesh of the fluid surface.
+ *
+ * Triangles wind so that Cross(B - A, C - A) points out of the fluid; normals are area-weighted
+ * face normals accumulated per vertex.
+ *
+ * @param Positions Vertex positions (world space).
+ * @param Normals Outward unit normals, one per vertex.
+ * @param Indices Triangle vertex indices (3 per triangle).
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSurfaceMesh
+{
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Normals;
+	TArray<uint32> Indices;
+
+	int32 NumVertices() const { return Positions.Num(); }
+
+	int32 NumTriangles() const { return Indices.Num() / 3; }
+
+	void Reset();
+
+	/**
+	 * Fill a mesh description (static mesh attributes registered) for collision cooking or export
+	 * Triangles are re-wound to the engine's front-face convention
+	 */
+	void BuildMeshDescription(FMeshDescription& OutMeshDescription) const;
+};
+
+/**
+ * @struct FKawaiiFluidSurfaceMeshStats
+ * @brief Counters of the last FKawaiiFluidSurfaceMesher::Build.
+ *
+ * @param NumParticles Particles splatted.
+ * @param NumBlocks Sparse blocks touched by at least one particle kernel.
+ * @param NumSurfaceBlocks Blocks that produced triangles.
+ * @param NumReusedBlocks Blocks taken from the cache without re-meshing.
+ * @param BuildMs Wall time of the build (ms).
+ */
+struct FKawaiiFluidSurfaceMeshStats
+{
+	int32 NumParticles = 0;
+	int32 NumBlocks = 0;
+	int32 NumSurfaceBlocks = 0;
+	int32 NumReusedBlocks = 0;
+	double BuildMs = 0.0;
+};
+
+/**
+ * @class FKawaiiFluidSurfaceMesher
+ * @brief CPU surface reconstruction: particle kernels splatted onto a sparse block grid, meshed with marching cubes.
+ *
+ * Only blocks of BlockCells^3 cells overlapped by some particle kernel exist, so memory and work follow
+ * the fluid instead of its bounds. Blocks are meshed in parallel and welded along block faces into one
+ * closed mesh. Each block remembers an order-independent hash of its contributing particles; when the
+ * hash matches on the next build, its triangles are reused instead of re-splatted (resting pools and
+ * sleeping islands cost only the hash). Not thread-safe; use one mesher per consumer.
+ *
+ * @param BlockCache Per-block meshes of the previous build, keyed by packed block coordinate.
+ * @param CachedParams Parameters the cache was built with (cache is dropped when they change).
+ * @param LastStats Counters of the last build.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSurfaceMesher
+{
+public:
+	/** Cells per block edge */
+	static constexpr int32 BlockCells = 8;
+
+	/**
+	 * Reconstruct the surface of a particle set
+	 * @param Positions Particle positions
+	 * @param AnisotropyAxis1 First ellipsoid axis per particle (xyz = unit direction, w = scale), or empty for spheres
+	 * @param AnisotropyAxis2 Second ellipsoid axis
+	 * @param AnisotropyAxis3 Third ellipsoid axis
+	 * @param Params Reconstruction settings
+	 * @param OutMesh Receives the welded surface mesh
+	 */
+	void Build(TConstArrayView<FVector3f> Positions,
+		TConstArrayView<FVector4f> AnisotropyAxis1,
+		TConstArrayView<FVector4f> AnisotropyAxis2,
+		TConstArrayView<FVector4f> AnisotropyAxis3,
+		const FKawaiiFluidSurfaceMeshParams& Params,
+		FKawaiiFluidSurfaceMesh& OutMesh);
+
+	/** Build with spherical kernels */
+	void Build(TConstArrayView<FVector3f> Positions, const FKawaiiFluidSurfaceMeshParams& Params, FKawaiiFluidSurfaceMesh& OutMesh)
+	{
+		Build(Positions, {}, {}, {}, Params, OutMesh);
+	}
+
+	/** Drop every cached block */
+	void ClearCache();
+
+	const FKawaiiFluidSurfaceMeshStats& GetLastStats() const { return LastStats; }
+
+private:
+	/**
+	 * Triangles of one block before welding
+	 * EdgeKeys identify each vertex's grid edge globally; bOnFace marks vertices shared with neighbor blocks
+	 */
+	struct FBlockMesh
+	{
+		TArray<FVector3f> Positions;
+		TArray<uint64> EdgeKeys;
+		TArray<bool> bOnFace;
+		TArray<int32> Indices;
+	};
+
+	struct FCachedBlock
+	{
+		uint64 Hash = 0;
+		FBlockMesh Mesh;
+	};
+
+	TMap<uint64, FCachedBlock> BlockCache;
+	FKawaiiFluidSurfaceMeshParams CachedParams;
+	FKawaiiFluidSurfaceMeshStats LastStats;
+
+	bool IsCacheCompatible(const FKawaiiFluidSurfaceMeshParams& Params) const;
+
+	static void MeshBlock(const FIntVector& BlockCoord, TConstArrayView<int32> ParticleIndices,
+		TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> InvAxes, TConstArrayView<FVector3f> Extents,
+		const FKawaiiFluidSurfaceMeshParams& Params, FBlockMesh& OutMesh);
+};
@@ -0,0 +1,94 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Quantized render particle format (CPU mirror of FluidRenderPacking.ush)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FKawaiiFluidPackedRenderParticle
+ * @brief 12-byte render particle: position quantized to the particle AABB plus octahedral velocity.
+ *
+ * @param PositionXY unorm16 X (low) and Y (high), relative to the bounds the particle was packed with.
+ * @param PositionZSpeed unorm16 Z (low) and half-precision speed (high).
+ * @param Direction snorm16x2 octahedral velocity direction; X == CulledDirection marks an invalid particle.
+ */
+struct FKawaiiFluidPackedRenderParticle
+{
+	uint32 PositionXY = 0;
+	uint32 PositionZSpeed = 0;
+	uint32 Direction = 0;
+};
+
+static_assert(sizeof(FKawaiiFluidPackedRenderParticle) == 12, "FKawaiiFluidPackedRenderParticle must match the 12-byte HLSL struct.");
+
+/**
+ * @struct FKawaiiFluidPackedAnisotropy
+ * @brief 8-byte ellipsoid: smallest-three quaternion rotating the unit axes onto Axis1..3, plus three scales.
+ *
+ * @param Rotation Largest component index (2 bits) and the other three components as unorm10.
+ * @param Scales Axis scales relative to the particle radius, unorm10 over [0, MaxAnisotropyScale].
+ */
+struct FKawaiiFluidPackedAnisotropy
+{
+	uint32 Rotation = 0;
+	uint32 Scales = 0;
+};
+
+static_assert(sizeof(FKawaiiFluidPackedAnisotropy) == 8, "FKawaiiFluidPackedAnisotropy must match the 8-byte HLSL struct.");
+
+/**
+ * Encode/decode for the packed render format. Every function mirrors FluidRenderPacking.ush
+ * operation for operation, so CPU round-trip tests cover what the extract and depth shaders do.
+ */
+namespace KawaiiFluidRenderPacking
+{
+	/** Direction X code reserved for culled particles (snorm16 -32768, never produced by EncodeOctahedral) */
+	constexpr uint32 CulledDirection = 0x8000;
+
+	/** Upper bound of the quantized anisotropy scales (MaxStretch is clamped to 5) */
+	constexpr float MaxAnisotropyScale = 8.0f;
+
+	/** Quantization box size: never below 1 cm so empty or flat bounds stay invertible */
+	KAWAIIFLUIDRUNTIME_API FVector3f GetBoundsExtent(const FVector3f& BoundsMin, const FVector3f& BoundsMax);
+
+	/** Octahedral mapping of a non-zero direction onto [-1, 1]^2 */
+	KAWAIIFLUIDRUNTIME_API FVector2f EncodeOctahedral(const FVector3f& Direction);
+
+	/** Inverse of EncodeOctahedral (normalized) */
+	KAWAIIFLUIDRUNTIME_API FVector3f DecodeOctahedral(const FVector2f& Encoded);
+
+	/**
+	 * Pack one particle
+	 * @param Position World position (clamped to the bounds)
+	 * @param Velocity World velocity
+	 * @param BoundsMin Quantization box minimum
+	 * @param BoundsExtent Quantization box size (GetBoundsExtent)
+	 */
+	KAWAIIFLUIDRUNTIME_API FKawaiiFluidPackedRenderParticle PackParticle(const FVector3f& Position, const FVector3f& Velocity, const FVector3f& BoundsMin, const FVector3f& BoundsExtent);
+
+	/** Particle that the depth and thickness passes push out of view */
+	KAWAIIFLUIDRUNTIME_API FKawaiiFluidPackedRenderParticle MakeCulledParticle();
+
+	/**
+	 * Unpack one particle
+	 * @return False for culled particles (outputs untouched)
+	 */
+	KAWAIIFLUIDRUNTIME_API bool UnpackParticle(const FKawaiiFluidPackedRenderParticle& Packed, const FVector3f& BoundsMin, const FVector3f& BoundsExtent, FVector3f& OutPosition, FVector3f& OutVelocity);
+
+	/** Smallest-three quaternion, 2-bit index + 3 x unorm10 (q and -q pack identically) */
+	KAWAIIFLUIDRUNTIME_API uint32 PackQuaternion(const FQuat4f& Rotation);
+
+	KAWAIIFLUIDRUNTIME_API FQuat4f UnpackQuaternion(uint32 Packed);
+
+	/** Rotation taking X/Y/Z onto the given orthonormal axes; a left-handed basis flips Axis3 (ellipsoids are symmetric) */
+	KAWAIIFLUIDRUNTIME_API FQuat4f AxesToQuaternion(const FVector3f& Axis1, const FVector3f& Axis2, const FVector3f& Axis3);
+
+	/**
+	 * Pack anisotropy axes as written by the anisotropy pass
+	 * @param Axis1 Direction (xyz) and scale relative to the particle radius (w), likewise Axis2/Axis3
+	 */
+	KAWAIIFLUIDRUNTIME_API FKawaiiFluidPackedAnisotropy PackAnisotropy(const FVector4f& Axis1, const FVector4f& Axis2, const FVector4f& Axis3);
+
+	KAWAIIFLUIDRUNTIME_API void UnpackAnisotropy(const FKawaiiFluidPackedAnisotropy& Packed, FVector4f& OutAxis1, FVector4f& OutAxis2, FVector4f& OutAxis3);
+}
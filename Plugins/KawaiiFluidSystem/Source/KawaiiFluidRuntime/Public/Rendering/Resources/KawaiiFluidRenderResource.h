@@ -7,6 +7,7 @@
 #include "RHIResources.h"
 #include "RenderGraphResources.h"
 #include "Core/KawaiiFluidRenderParticle.h"
+#include "Rendering/Resources/KawaiiFluidPackedRenderParticle.h"
 #include <atomic>
 
 class FGPUFluidSimulator;
@@ -28,6 +29,10 @@ class FRDGBuilder;
  * @param PooledBoundsBuffer Min/Max world-space bounds of the active particle set.
  * @param PooledRenderParticleBuffer Buffer containing formatted render-ready particles.
  * @param PooledParticleCountBuffer GPU-side atomic counter for the current particle set.
+ * @param PooledPackedParticleBuffer Quantized positions/velocities (FKawaiiFluidPackedRenderParticle, 12B).
+ * @param PooledPackedAnisotropyBuffer Quantized anisotropy rotation/scales (FKawaiiFluidPackedAnisotropy, 8B).
+ * @param bPackedBuffersWritten Atomic flag indicating the packed buffers hold this frame's particles.
+ * @param bPackedAnisotropyWritten Atomic flag indicating the packed anisotropy buffer was written too.
  * @param ParticleCount Number of valid particles currently stored in the buffer.
  * @param BufferCapacity Maximum number of particles the current GPU buffer can hold.
  * @param bBufferReadyForRendering Atomic flag indicating if the GPU extract pass has completed.
@@ -96,6 +101,31 @@ public:
 		return PooledPositionBuffer.IsValid() && ParticleCount > 0 && bBufferReadyForRendering.load();
 	}
 
+	//========================================
+	// Packed (quantized) buffer access
+	//========================================
+
+	/** r.Fluid.PackedRenderParticles: extract the quantized format and draw depth/thickness from it */
+	static bool IsPackedFormatRequested();
+
+	TRefCountPtr<FRDGPooledBuffer> GetPooledPackedParticleBuffer() const { return PooledPackedParticleBuffer; }
+
+	TRefCountPtr<FRDGPooledBuffer> GetPooledPackedAnisotropyBuffer() const { return PooledPackedAnisotropyBuffer; }
+
+	void SetPackedBuffersWritten(bool bWritten, bool bAnisotropyWritten)
+	{
+		bPackedBuffersWritten = bWritten;
+		bPackedAnisotropyWritten = bWritten && bAnisotropyWritten;
+	}
+
+	/** True when this frame's extraction wrote the packed buffers (quantized against PooledBoundsBuffer) */
+	bool HasValidPackedBuffers() const
+	{
+		return PooledPackedParticleBuffer.IsValid() && PooledBoundsBuffer.IsValid() && bPackedBuffersWritten.load();
+	}
+
+	bool HasValidPackedAnisotropy() const { return HasValidPackedBuffers() && bPackedAnisotropyWritten.load(); }
+
 	//========================================
 	// GPU simulator interface
 	//========================================
@@ -191,6 +221,18 @@ private:
 
 	TRefCountPtr<FRDGPooledBuffer> PooledParticleCountBuffer;
 
+	//========================================
+	// Packed (quantized) buffers
+	//========================================
+
+	TRefCountPtr<FRDGPooledBuffer> PooledPackedParticleBuffer;
+
+	TRefCountPtr<FRDGPooledBuffer> PooledPackedAnisotropyBuffer;
+
+	std::atomic<bool> bPackedBuffersWritten{false};
+
+	std::atomic<bool> bPackedAnisotropyWritten{false};
+
 	int32 ParticleCount;
 
 	int32 BufferCapacity;
@@ -31,6 +31,9 @@ class FUseAnisotropyDim : SHADER_PERMUTATION_BOOL("USE_ANISOTROPY");
  * @param AnisotropyAxis1 Major axis vector and scale for anisotropic ellipsoids.
  * @param AnisotropyAxis2 Intermediate axis vector and scale.
  * @param AnisotropyAxis3 Minor axis vector and scale.
+ * @param PackedParticles Quantized positions/velocities (USE_PACKED_PARTICLES).
+ * @param PackedAnisotropy Quantized anisotropy rotation and scales (USE_PACKED_PARTICLES).
+ * @param PackedBounds Quantization box [Min, Max] the packed particles were written against.
  * @param IndirectArgsBuffer RDG buffer containing arguments for DrawPrimitiveIndirect.
  */
 BEGIN_SHADER_PARAMETER_STRUCT(FFluidDepthParameters, )
@@ -64,6 +67,13 @@ BEGIN_SHADER_PARAMETER_STRUCT(FFluidDepthParameters, )
 	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, AnisotropyAxis2)
 	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, AnisotropyAxis3)
 
+	//=============================================================================
+	// Packed render format
+	//=============================================================================
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FPackedRenderParticle>, PackedParticles)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FPackedAnisotropy>, PackedAnisotropy)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, PackedBounds)
+
 	//=============================================================================
 	// Indirect Arguments
 	//=============================================================================
@@ -80,8 +90,11 @@ class FKawaiiFluidDepthVS : public FGlobalShader
 	DECLARE_GLOBAL_SHADER(FKawaiiFluidDepthVS);
 	SHADER_USE_PARAMETER_STRUCT(FKawaiiFluidDepthVS, FGlobalShader);
 
+	/** Read the quantized render format instead of the full-precision SoA/anisotropy buffers */
+	class FUsePackedParticlesDim : SHADER_PERMUTATION_BOOL("USE_PACKED_PARTICLES");
+
 	using FParameters = FFluidDepthParameters;
-	using FPermutationDomain = TShaderPermutationDomain<FUseAnisotropyDim>;
+	using FPermutationDomain = TShaderPermutationDomain<FUseAnisotropyDim, FUsePackedParticlesDim>;
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
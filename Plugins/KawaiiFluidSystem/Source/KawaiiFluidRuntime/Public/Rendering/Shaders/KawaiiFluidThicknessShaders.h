@@ -12,6 +12,8 @@
  * @brief Shared parameter structure for fluid thickness accumulation passes.
  * 
  * @param ParticlePositions Buffer containing world-space particle positions.
+ * @param PackedParticles Quantized positions/velocities (USE_PACKED_PARTICLES).
+ * @param PackedBounds Quantization box [Min, Max] the packed particles were written against.
  * @param ParticleRadius The physical radius of fluid particles.
  * @param ViewMatrix Camera view matrix.
  * @param ProjectionMatrix Camera projection matrix.
@@ -24,6 +26,8 @@
  */
 BEGIN_SHADER_PARAMETER_STRUCT(FFluidThicknessParameters, )
 	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, ParticlePositions)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FPackedRenderParticle>, PackedParticles)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, PackedBounds)
 	SHADER_PARAMETER(float, ParticleRadius)
 	SHADER_PARAMETER(FMatrix44f, ViewMatrix)
 	SHADER_PARAMETER(FMatrix44f, ProjectionMatrix)
@@ -45,7 +49,11 @@ class FKawaiiFluidThicknessVS : public FGlobalShader
 	DECLARE_GLOBAL_SHADER(FKawaiiFluidThicknessVS);
 	SHADER_USE_PARAMETER_STRUCT(FKawaiiFluidThicknessVS, FGlobalShader);
 
+	/** Read the quantized render format instead of the full-precision position buffer */
+	class FUsePackedParticlesDim : SHADER_PERMUTATION_BOOL("USE_PACKED_PARTICLES");
+
 	using FParameters = FFluidThicknessParameters;
+	using FPermutationDomain = TShaderPermutationDomain<FUsePackedParticlesDim>;
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
@@ -0,0 +1,168 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "PhysicsEngine/AggregateGeom.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * @brief Sphere in body space.
+ * @param Center Center relative to the body (bone or component)
+ * @param Radius Unscaled radius, margin not applied
+ * @param BodyIndex Index into FKawaiiFluidCollisionShapeSet::BodyBoneNames
+ */
+struct FKawaiiFluidLocalSphere
+{
+	FVector Center;
+	float Radius;
+	int32 BodyIndex;
+};
+
+/**
+ * @brief Capsule in body space.
+ * @param Center Center relative to the body
+ * @param Axis Unit axis of the segment
+ * @param HalfLength Half segment length (unscaled)
+ * @param Radius Unscaled radius, margin not applied
+ * @param BodyIndex Index into FKawaiiFluidCollisionShapeSet::BodyBoneNames
+ */
+struct FKawaiiFluidLocalCapsule
+{
+	FVector Center;
+	FVector Axis;
+	float HalfLength;
+	float Radius;
+	int32 BodyIndex;
+};
+
+/**
+ * @brief Box in body space.
+ * @param Center Center relative to the body
+ * @param Rotation Rotation relative to the body
+ * @param HalfExtent Unscaled half extents, margin not applied
+ * @param BodyIndex Index into FKawaiiFluidCollisionShapeSet::BodyBoneNames
+ */
+struct FKawaiiFluidLocalBox
+{
+	FVector Center;
+	FQuat Rotation;
+	FVector HalfExtent;
+	int32 BodyIndex;
+};
+
+/**
+ * @brief Convex plane in body space (Dot(P, Normal) = Distance on the plane).
+ * @param Normal Outward-facing unit normal
+ * @param Distance Signed distance from the body origin
+ */
+struct FKawaiiFluidLocalPlane
+{
+	FVector Normal;
+	float Distance;
+};
+
+/**
+ * @brief Convex hull in body space.
+ * @param Center Vertex centroid relative to the body
+ * @param BoundingRadius Unscaled bounding sphere radius around Center
+ * @param PlaneStart First plane in FKawaiiFluidCollisionShapeSet::ConvexPlanes
+ * @param PlaneCount Number of planes (at least 4)
+ * @param BodyIndex Index into FKawaiiFluidCollisionShapeSet::BodyBoneNames
+ */
+struct FKawaiiFluidLocalConvex
+{
+	FVector Center;
+	float BoundingRadius;
+	int32 PlaneStart;
+	int32 PlaneCount;
+	int32 BodyIndex;
+};
+
+/**
+ * @brief Simple collision of one mesh asset in body space, shared by every collider using the asset.
+ * Static meshes have a single body (NAME_None); physics assets one body per skeletal body setup.
+ * @param BodyBoneNames Bone each body follows (NAME_None = component transform)
+ * @param Spheres Sphere elements
+ * @param Capsules Capsule (sphyl) elements
+ * @param Boxes Box elements
+ * @param Convexes Convex elements with at least 4 planes
+ * @param ConvexPlanes Planes of all convexes
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidCollisionShapeSet
+{
+	TArray<FName> BodyBoneNames;
+	TArray<FKawaiiFluidLocalSphere> Spheres;
+	TArray<FKawaiiFluidLocalCapsule> Capsules;
+	TArray<FKawaiiFluidLocalBox> Boxes;
+	TArray<FKawaiiFluidLocalConvex> Convexes;
+	TArray<FKawaiiFluidLocalPlane> ConvexPlanes;
+
+	int32 GetNumShapes() const { return Spheres.Num() + Capsules.Num() + Boxes.Num() + Convexes.Num(); }
+
+	bool IsEmpty() const { return GetNumShapes() == 0; }
+
+	/** Extract the shapes of each body and generate convex planes (any thread) */
+	static FKawaiiFluidCollisionShapeSet Build(const TArray<FKAggregateGeom>& BodyGeometry, const TArray<FName>& BodyBoneNames);
+};
+
+/**
+ * @brief Process-wide cache of FKawaiiFluidCollisionShapeSet keyed by mesh asset (UStaticMesh or UPhysicsAsset).
+ *
+ * Extraction and convex plane generation run once per asset, on a worker thread when prefetched, and every
+ * collider using the asset shares the result. Aggregate geometry is copied on the game thread before the worker
+ * starts, so the asset is never read off the game thread. Entries of garbage collected assets are dropped after
+ * each collection, and in the editor, modifying an asset or one of its body setups drops its entry. The instance
+ * lives between StartupModule and ShutdownModule of the runtime module.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidCollisionShapeCache
+{
+public:
+	using FShapeSetPtr = TSharedPtr<const FKawaiiFluidCollisionShapeSet, ESPMode::ThreadSafe>;
+
+	static FKawaiiFluidCollisionShapeCache& Get();
+
+	/** Create the instance (module startup) */
+	static void Startup();
+
+	/** Destroy the instance and unregister its delegates (module shutdown) */
+	static void Shutdown();
+
+	~FKawaiiFluidCollisionShapeCache();
+
+	/** Start extracting the shapes of Asset on a worker thread if they are not cached (game thread) */
+	void Prefetch(const UObject* Asset);
+
+	/** Shapes of Asset: waits for a pending extraction, or extracts now if never requested (game thread) */
+	FShapeSetPtr FindOrBuild(const UObject* Asset);
+
+	/** Drop the entry of Asset (game thread) */
+	void Invalidate(const UObject* Asset);
+
+	/** Drop every entry (game thread) */
+	void Reset();
+
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	FKawaiiFluidCollisionShapeCache();
+
+	static bool GatherBodyGeometry(const UObject* Asset, TArray<FKAggregateGeom>& OutBodyGeometry, TArray<FName>& OutBodyBoneNames);
+
+	TSharedFuture<FShapeSetPtr>* FindOrLaunch(const UObject* Asset, bool bAsync);
+
+	void PruneStaleEntries();
+
+	TMap<FObjectKey, TSharedFuture<FShapeSetPtr>> Entries;
+
+	FDelegateHandle PostGarbageCollectHandle;
+
+#if WITH_EDITOR
+	void OnObjectModified(UObject* Object);
+
+	FDelegateHandle ObjectModifiedHandle;
+
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Simulation/Collision/KawaiiFluidCollider.h"
+#include "Simulation/Collision/KawaiiFluidCollisionShapeCache.h"
 #include "KawaiiFluidMeshCollider.generated.h"
 
 /**
@@ -94,6 +95,8 @@ struct FCachedConvex
 /**
  * @brief Mesh-based fluid collider.
  * Handles collision with characters or complex objects using simplified collision shapes.
+ * Body-space shapes come from FKawaiiFluidCollisionShapeCache (shared per mesh asset); each frame they are only
+ * transformed into the persistent world-space arrays, and not even that while bone and component transforms hold still.
  * @param TargetMeshComponent The mesh component to extract collision from
  * @param bAutoFindMesh Whether to automatically find a mesh on the owner
  * @param bUseSimplifiedCollision Whether to use simplified shapes (spheres, capsules, boxes)
@@ -131,6 +134,9 @@ public:
 
 	virtual bool IsCacheValid() const override { return bCacheValid; }
 
+	/** Incremented whenever the world-space shapes change; equal revisions export identical primitives */
+	uint32 GetShapeRevision() const { return ShapeRevision; }
+
 	void ExportToGPUPrimitives(
 		TArray<struct FGPUCollisionSphere>& OutSpheres,
 		TArray<struct FGPUCollisionCapsule>& OutCapsules,
@@ -161,6 +167,14 @@ protected:
 private:
 	void AutoFindMeshComponent();
 
+	void PrefetchCollisionShapes() const;
+
+	void ResetCachedShapes();
+
+	bool AcquireShapeSet(const UObject* Asset);
+
+	bool UpdateWorldShapes(const TArray<FTransform>& BodyTransforms, bool bBodyScalesShapes);
+
 	TArray<FCachedCapsule> CachedCapsules;
 	TArray<FCachedSphere> CachedSpheres;
 	TArray<FCachedBox> CachedBoxes;
@@ -168,7 +182,27 @@ private:
 	FBox CachedBounds;
 	bool bCacheValid;
 
-	void CacheStaticMeshCollision(UStaticMeshComponent* StaticMesh);
+	/** Body-space shapes shared with every collider of the same mesh asset */
+	FKawaiiFluidCollisionShapeCache::FShapeSetPtr ShapeSet;
+
+	/** Skeleton bone per body of ShapeSet (INDEX_NONE = body skipped), resolved for ResolvedSkinnedAsset */
+	TArray<int32> BodyBoneIndices;
+	TWeakObjectPtr<const UObject> ResolvedSkinnedAsset;
+
+	/** Shapes of ShapeSet whose body is active, per type */
+	TArray<int32> ActiveSphereIndices;
+	TArray<int32> ActiveCapsuleIndices;
+	TArray<int32> ActiveBoxIndices;
+	TArray<int32> ActiveConvexIndices;
+
+	/** Body transforms and margin the world-space shapes were last built from */
+	TArray<FTransform> CachedBodyTransforms;
+	TArray<FTransform> ScratchBodyTransforms;
+	float CachedMargin = 0.0f;
+
+	uint32 ShapeRevision = 0;
+
+	bool CacheStaticMeshCollision(UStaticMeshComponent* StaticMesh);
 
-	void CacheSkeletalMeshCollision(USkeletalMeshComponent* SkelMesh);
+	bool CacheSkeletalMeshCollision(USkeletalMeshComponent* SkelMesh);
 };
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include "RenderResource.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
 #include "Simulation/Resources/GPUFluidSpatialData.h"
+#include "Simulation/Resources/GPUFluidReadbackSnapshot.h"
+#include "Simulation/Resources/GPUFluidReadbackFormat.h"
 #include "Simulation/Managers/GPUSpawnManager.h"
 #include "Simulation/Managers/GPUCollisionManager.h"
 #include "Simulation/Managers/GPUZOrderSortManager.h"
@@ -27,6 +29,25 @@ class FRDGBuilder;
 class FRHIGPUBufferReadback;
 class USkeletalMeshComponent;
 
+/**
+ * @struct FGPUFluidMemoryStats
+ * @brief GPU memory accounting snapshot for one simulator (refreshed on the render thread each frame).
+ * 
+ * @param MaxParticleCount Hard capacity limit configured on the volume.
+ * @param AllocatedCapacity Particle capacity currently backed by GPU buffers.
+ * @param ParticleCount Live particle count.
+ * @param ReservedBytes Bytes held by persistent per-particle buffers.
+ * @param UsedBytes Portion of ReservedBytes occupied by live particles.
+ */
+struct FGPUFluidMemoryStats
+{
+	int32 MaxParticleCount = 0;
+	int32 AllocatedCapacity = 0;
+	int32 ParticleCount = 0;
+	int64 ReservedBytes = 0;
+	int64 UsedBytes = 0;
+};
+
 /**
  * @class FGPUFluidSimulator
  * @brief High-performance GPU-based SPH fluid simulation engine.
@@ -36,6 +57,9 @@ class USkeletalMeshComponent;
  * 
  * @param bIsInitialized Whether the simulator is initialized and ready.
  * @param MaxParticleCount Maximum number of particles allowed.
+ * @param AllocatedCapacity Particle capacity currently allocated (grows lazily up to MaxParticleCount).
+ * @param LowOccupancyFrames Consecutive frames with occupancy below the shrink threshold.
+ * @param CachedMemoryStats Memory accounting snapshot (guarded by BufferLock).
  * @param CurrentParticleCount Actual number of active particles.
  * @param PreviousParticleCount Particle count from the previous frame.
  * @param ExternalForce Global force vector applied to all particles.
@@ -89,6 +113,15 @@ public:
 	 */
 	void FinalizeUpload();
 
+	/**
+	 * Queue particles for a streaming upload: converted in parallel into upload chunks that are
+	 * appended to the live buffer over the next frames within r.Fluid.StreamingUploadBudgetKB.
+	 * Already-resident particles keep simulating meanwhile. IDs must already be allocated.
+	 * @param CPUParticles - Source particles (converted to GPU format)
+	 * @return Number of particles queued, 0 if they do not fit
+	 */
+	int32 QueueParticleUpload(const TArray<FKawaiiFluidParticle>& CPUParticles);
+
 	/**
 	 * Clear accumulated particles (call before batch upload begins)
 	 * Resets CachedGPUParticles for fresh batch upload
@@ -138,6 +171,16 @@ public:
 	 */
 	int32 GetMaxParticleCount() const { return MaxParticleCount; }
 
+	/**
+	 * Get particle capacity currently backed by GPU buffers (grows on demand up to MaxParticleCount)
+	 */
+	int32 GetAllocatedCapacity() const { return AllocatedCapacity.load(); }
+
+	/**
+	 * Get GPU memory accounting (bytes reserved vs. used by live particles)
+	 */
+	FGPUFluidMemoryStats GetMemoryStats() const;
+
 	/**
 	 * Clear all particles on GPU (resets CurrentParticleCount and PersistentParticleCount)
 	 */
@@ -174,8 +217,8 @@ public:
 	/** Execute full GPU simulation for one substep */
 	void SimulateSubstep(const FGPUFluidSimulationParams& Params);
 
-	/** Execute GPU simulation using RDG */
-	void SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FGPUFluidSimulationParams& Params);
+	/** Execute GPU simulation using RDG (bCaptureTickStart: snapshot positions for render interpolation) */
+	void SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FGPUFluidSimulationParams& Params, bool bCaptureTickStart = false);
 
 	/** Run single initialization simulation step */
 	void RunInitializationSimulation(const FGPUFluidSimulationParams& Params);
@@ -226,7 +269,7 @@ public:
 		return PersistentCellStartBuffer.IsValid() && PersistentCellEndBuffer.IsValid();
 	}
 
-	/** Access previous frame position buffer (for history trails) */
+	/** Access previous simulation tick position buffer (render interpolation source) */
 	TRefCountPtr<FRDGPooledBuffer>& AccessPreviousPositionsBuffer() { return PreviousPositionsBuffer; }
 
 	/** Get previous position count */
@@ -252,6 +295,27 @@ public:
 		PreviousPositionsBuffer.SafeRelease();
 	}
 
+	//=============================================================================
+	// Fixed-Timestep Render Interpolation
+	//=============================================================================
+
+	/** Enable capture of tick-start positions so rendering can interpolate between simulation ticks */
+	void SetRenderInterpolationEnabled(bool bEnabled) { bRenderInterpolationEnabled.store(bEnabled); }
+	bool IsRenderInterpolationEnabled() const { return bRenderInterpolationEnabled.load(); }
+
+	/** Set blend factor between the previous (0) and latest (1) simulation tick */
+	void SetRenderInterpolationAlpha(float Alpha) { RenderInterpolationAlpha.store(FMath::Clamp(Alpha, 0.0f, 1.0f)); }
+	float GetRenderInterpolationAlpha() const { return RenderInterpolationAlpha.load(); }
+
+	/** Mark the next substep as the first of a simulation tick (game thread) */
+	void MarkSimulationTickStart() { bCaptureTickStartPending = true; }
+
+	/** Render thread: true when PreviousPositionsBuffer holds tick-start positions matching the particle order */
+	bool HasRenderInterpolationSource() const
+	{
+		return bRenderInterpolationEnabled.load() && bPreviousPositionsValid && PreviousPositionsBuffer.IsValid() && PreviousPositionsCount > 0;
+	}
+
 	//=============================================================================
 	// Configuration
 	//=============================================================================
@@ -675,10 +739,22 @@ public:
 	void AddSpawnRequest(const FVector3f& Position, const FVector3f& Velocity, float Mass = 1.0f);
 
 	/**
-	 * Add multiple spawn requests at once (thread-safe, more efficient than individual calls)
-	 * @param Requests - Array of spawn requests to add
+	 * Add a fully specified spawn request (thread-safe, lock-free)
+	 * @param Request - Spawn request (radius, mass and source ID are kept as given)
+	 */
+	void AddSpawnRequest(const FGPUSpawnRequest& Request);
+
+	/**
+	 * Add multiple spawn requests at once (thread-safe, lock-free, kept in order)
+	 * @param Requests - Spawn requests to add
 	 */
-	void AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests);
+	void AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests);
+
+	/**
+	 * Queue a procedural spawn plan (thread-safe); expanded on the GPU after the frame's requests
+	 * @param Plan - Built spawn plan
+	 */
+	void AddSpawnPlan(FKawaiiFluidSpawnPlan&& Plan);
 
 	/**
 	 * Add GPU brush despawn request - removes particles within radius (thread-safe)
@@ -701,9 +777,17 @@ public:
 	 */
 	void SetSourceEmitterMax(int32 SourceID, int32 MaxCount);
 
+	/**
+	 * Zero-copy, lock-free access to the latest published readback (positions, IDs, flags, velocities, neighbor counts)
+	 * The returned view pins its snapshot until destroyed; keep it for a frame at most
+	 * @return View of the latest snapshot, empty if no readback has been published
+	 */
+	FGPUFluidReadbackSnapshotView AcquireReadbackSnapshot() const { return ReadbackSnapshots.Acquire(); }
+
 	/**
 	 * Lightweight API for despawn operations - returns positions, IDs and source IDs
-	 * Uses cached data from ProcessStatsReadback (no sync GPU readback needed)
+	 * Copies the latest readback snapshot (prefer AcquireReadbackSnapshot to avoid the copy)
+	 * IDs are only read back while some consumer registers EGPUReadbackField::ParticleID / SourceID
 	 * @param OutPositions - Output array of particle positions
 	 * @param OutParticleIDs - Output array of particle IDs (same index as positions)
 	 * @param OutSourceIDs - Output array of source IDs (same index as positions)
@@ -713,7 +797,7 @@ public:
 
 	/**
 	 * Lightweight API for ISM rendering - returns positions and velocities only
-	 * Much faster than GetAllGPUParticles (24 bytes vs 64 bytes per particle)
+	 * Copies the latest readback snapshot (prefer AcquireReadbackSnapshot to avoid the copy)
 	 * @param OutPositions - Output array of positions
 	 * @param OutVelocities - Output array of velocities
 	 * @return true if valid data was copied
@@ -721,33 +805,80 @@ public:
 	bool GetParticlePositionsAndVelocities(TArray<FVector3f>& OutPositions, TArray<FVector3f>& OutVelocities);
 
 	/**
-	 * Enable/disable velocity readback for ISM rendering
-	 * When enabled, CachedParticleVelocities is populated during ProcessStatsReadback
+	 * Zero-copy access to the readback snapshot for world particle queries
+	 * Visitor runs with the snapshot pinned, given positions, velocities (empty unless velocity readback is on) and source IDs
+	 * @return true if valid data was visited
 	 */
-	void SetFullReadbackEnabled(bool bEnabled) { bFullReadbackEnabled.store(bEnabled); }
+	bool ReadParticleQueryData(TFunctionRef<void(TConstArrayView<FVector3f>, TConstArrayView<FVector3f>, TConstArrayView<int32>)> Visitor) const;
 
 	/**
-	 * Get particle IDs for a specific SourceID from cached readback data
-	 * Returns nullptr if no cached data or SourceID not found
-	 * Uses CachedSourceIDToParticleIDs built during readback processing
-	 * @param SourceID - Source component ID to query
-	 * @return Pointer to array of particle IDs, or nullptr if not available
+	 * Enable/disable readback for world particle queries
+	 * When enabled, ProcessStatsReadback runs every frame and keeps positions, velocities and source IDs cached
 	 */
-	const TArray<int32>* GetParticleIDsBySourceID(int32 SourceID) const;
+	void SetQueryReadbackEnabled(bool bEnabled)
+	{
+		bQueryReadbackEnabled.store(bEnabled);
+		SetReadbackConsumerFields(EGPUReadbackConsumer::Query, bEnabled
+			? EGPUReadbackField::Position | EGPUReadbackField::Velocity | EGPUReadbackField::SourceID
+			: EGPUReadbackField::None);
+	}
+
+	bool IsQueryReadbackEnabled() const { return bQueryReadbackEnabled.load(); }
 
 	/**
-	 * Get all particle IDs from cached readback data
-	 * Returns nullptr if no cached data available
-	 * @return Pointer to array of all particle IDs, or nullptr if not available
+	 * Register the fields one readback consumer reads (EGPUReadbackField bits, None to unregister)
+	 * EndFrame packs the union of all consumers; Accept* bits allow 16-bit encodings when every reader of the field sets them
+	 * @param Consumer - EGPUReadbackConsumer slot
+	 * @param FieldMask - Requested fields plus optional Accept* precision bits
 	 */
-	const TArray<int32>* GetAllParticleIDs() const;
+	void SetReadbackConsumerFields(int32 Consumer, uint32 FieldMask)
+	{
+		if (Consumer >= 0 && Consumer < EGPUReadbackConsumer::Count)
+		{
+			ReadbackConsumerFields[Consumer].store(FieldMask);
+		}
+	}
+
+	/** Resolved field mask for the next packed readback (None if no consumer is registered) */
+	uint32 GetReadbackFieldMask() const;
 
 	/**
-	 * Get particle flags from cached readback data
-	 * Returns nullptr if no cached data available
-	 * @return Pointer to array of particle flags, or nullptr if not available
+	 * Enable/disable max particle speed feedback for one consumer
+	 * While any consumer is registered, ProcessStatsReadback runs every frame and records the max speed (2-3 frame latency)
+	 * @param bEnabled - Register or unregister the consumer
+	 * @param Consumer - EGPUReadbackConsumer slot (MaxVelocity for adaptive substeps, EditorSleep for the brush)
 	 */
-	const TArray<uint32>* GetParticleFlags() const;
+	void SetMaxVelocityFeedbackEnabled(bool bEnabled, int32 Consumer = EGPUReadbackConsumer::MaxVelocity)
+	{
+		const bool bWasEnabled = IsMaxVelocityFeedbackEnabled();
+		SetReadbackConsumerFields(Consumer, bEnabled ? EGPUReadbackField::Speed : EGPUReadbackField::None);
+		if (bWasEnabled && !IsMaxVelocityFeedbackEnabled())
+		{
+			ReadbackMaxVelocity.store(-1.0f);
+		}
+	}
+
+	/** True while any consumer requests max speed feedback */
+	bool IsMaxVelocityFeedbackEnabled() const
+	{
+		return ((ReadbackConsumerFields[EGPUReadbackConsumer::MaxVelocity].load()
+			| ReadbackConsumerFields[EGPUReadbackConsumer::EditorSleep].load()) & EGPUReadbackField::Speed) != 0;
+	}
+
+	/** Max particle speed (cm/s) from the latest stats readback, or negative if no readback has completed */
+	float GetReadbackMaxVelocity() const { return ReadbackMaxVelocity.load(); }
+
+	/** Incremented on every max speed readback; unchanged between calls means the value is stale */
+	uint32 GetReadbackMaxVelocitySerial() const { return ReadbackMaxVelocitySerial.load(); }
+
+	/**
+	 * Copies the particle IDs of a specific SourceID from the latest readback snapshot
+	 * (use AcquireReadbackSnapshot to read them, or all IDs and flags, without the copy)
+	 * @param SourceID - Source component ID to query
+	 * @param OutParticleIDs - Receives the IDs; empty if no snapshot, unknown SourceID or unregistered ParticleID/SourceID fields
+	 * @return true if a snapshot was available
+	 */
+	bool GetParticleIDsBySourceID(int32 SourceID, TArray<int32>& OutParticleIDs) const;
 
 	/**
 	 * Clear all pending spawn requests
@@ -812,6 +943,8 @@ private:
 		FRDGBufferSRVRef& OutPositionsSRV,
 		FRDGBufferUAVRef& OutPositionsUAV,
 		const FGPUFluidSimulationParams& Params,
+		// Bone arena of this substep (nullptr without boundary skinning)
+		FRDGBufferRef BoneArenaBuffer,
 		// Optional: BoneDeltaAttachment buffer to reorder along with particles during Z-Order sorting
 		FRDGBufferRef* InOutAttachmentBuffer = nullptr);
 
@@ -993,7 +1126,8 @@ private:
 	void AddBoundarySkinningPass(
 		FRDGBuilder& GraphBuilder,
 		FSimulationSpatialData& SpatialData,
-		const FGPUFluidSimulationParams& Params);
+		const FGPUFluidSimulationParams& Params,
+		FRDGBufferRef BoneArenaBuffer);
 
 	//=============================================================================
 	// Bone Delta Attachment System (NEW simplified bone-following)
@@ -1020,7 +1154,8 @@ private:
 	 * @param BoneDeltaAttachmentSRV - Attachment data (read only)
 	 * @param LocalBoundaryParticlesSRV - Local boundary particles (persistent)
 	 * @param BoundaryParticleCount - Number of boundary particles
-	 * @param BoneTransformsSRV - Bone transforms (same as BoundarySkinningCS uses)
+	 * @param BoneTransformsSRV - Bone arena (same as BoundarySkinningCS uses)
+	 * @param BoneOffset - First bone of this owner in the arena
 	 * @param BoneCount - Number of bones
 	 * @param ComponentTransform - Fallback transform for static meshes
 	 * @param DeltaTime - Frame delta time for velocity calculation
@@ -1032,6 +1167,7 @@ private:
 		FRDGBufferSRVRef LocalBoundaryParticlesSRV,
 		int32 BoundaryParticleCount,
 		FRDGBufferSRVRef BoneTransformsSRV,
+		int32 BoneOffset,
 		int32 BoneCount,
 		const FMatrix44f& ComponentTransform,
 		float DeltaTime);
@@ -1109,28 +1245,46 @@ private:
 	int32 MaxParticleCount;
 	int32 CurrentParticleCount;
 
-	bool bFrameActive = false;
+	// Lazy capacity growth: grown by both threads (max via CAS), shrunk only by the game thread in BeginFrame
+	std::atomic<int32> AllocatedCapacity{0};
+	int32 LowOccupancyFrames = 0;
+	FGPUFluidMemoryStats CachedMemoryStats;
 
-	TArray<FGPUFluidSimulationParams> PendingSimulationParams;
-	mutable FCriticalSection PendingSimulationLock;
+	/** Geometric growth from CurrentCapacity until RequiredCount fits (clamped to MaxParticleCount) */
+	int32 ComputeGrownCapacity(int32 CurrentCapacity, int32 RequiredCount) const;
 
-	TArray<FGPUFluidParticle> CachedGPUParticles;
+	/** Game thread: grow ahead of pending spawns or shrink after sustained low occupancy */
+	int32 UpdateCapacityForFrame(int32 RequiredCount, bool bAllowShrink, bool& bOutShrink);
 
-	TArray<TArray<int32>> CachedSourceIDToParticleIDs;
+	/** Any thread: raise AllocatedCapacity to at least NewCapacity; returns true if it was raised */
+	bool RaiseAllocatedCapacity(int32 NewCapacity);
 
-	TArray<int32> CachedAllParticleIDs;
+	/** Game thread: lower AllocatedCapacity from ExpectedCapacity; fails if another thread grew it meanwhile */
+	bool TryShrinkAllocatedCapacity(int32 ExpectedCapacity, int32 NewCapacity);
 
-	TArray<FVector3f> CachedParticlePositions;
+	/** Allocation size for per-particle transient/persistent buffers */
+	int32 GetParticleAllocCount() const { return FMath::Max(AllocatedCapacity.load(), CurrentParticleCount); }
 
-	TArray<int32> CachedParticleSourceIDs;
+	/** Render thread: move particles into a smaller buffer and drop oversized side buffers */
+	void AddShrinkParticleBufferPass(FRDGBuilder& GraphBuilder, FRDGBufferRef& InOutParticleBuffer, FRDGBufferRef ParticleCountBuffer, int32 NewCapacity);
 
-	TArray<FVector3f> CachedParticleVelocities;
+	/** Render thread: refresh CachedMemoryStats from persistent pooled buffers */
+	void UpdateMemoryAccounting();
 
-	TArray<uint32> CachedParticleFlags;
+	bool bFrameActive = false;
 
-	std::atomic<bool> bHasValidGPUResults{false};
+	TArray<FGPUFluidSimulationParams> PendingSimulationParams;
+	mutable FCriticalSection PendingSimulationLock;
+
+	TArray<FGPUFluidParticle> CachedGPUParticles;
 
-	std::atomic<bool> bFullReadbackEnabled{false};
+	/** Triple-buffered readback snapshots published by ProcessStatsReadback and FinalizeUpload */
+	FGPUFluidReadbackSnapshotBuffer ReadbackSnapshots;
+
+	/** Render thread scratch target when every spare snapshot slot is pinned (stats still update, publish dropped) */
+	FGPUFluidReadbackSnapshot DroppedReadbackSnapshot;
+
+	std::atomic<bool> bHasValidGPUResults{false};
 
 	TRefCountPtr<FRDGPooledBuffer> PersistentParticleBuffer;
 
@@ -1190,11 +1344,15 @@ private:
 	// Rendering Buffers
 	//=============================================================================
 
-	// Previous positions buffer for rendering history trails
+	// Tick-start positions for render interpolation (reordered with particles during Z-Order sorting)
 	TRefCountPtr<FRDGPooledBuffer> PreviousPositionsBuffer;
 	int32 PreviousPositionsCount = 0;
 	bool bPreviousPositionsValid = false;
 
+	std::atomic<bool> bRenderInterpolationEnabled{false};
+	std::atomic<float> RenderInterpolationAlpha{1.0f};
+	bool bCaptureTickStartPending = false;  // Game thread: consumed by next SimulateSubstep
+
 	//=============================================================================
 	// GPU Particle Spawn System (Delegated to FGPUSpawnManager)
 	//=============================================================================
@@ -1230,6 +1388,9 @@ private:
 	/** Transient: IndirectArgs buffer valid only during SimulateSubstep_RDG scope */
 	FRDGBufferRef CurrentIndirectArgsBuffer = nullptr;
 
+	/** Transient: tick-start positions valid only during SimulateSubstep_RDG scope (replaced by sorted copy) */
+	FRDGBufferRef CurrentPreviousPositionsBuffer = nullptr;
+
 	/** Register PersistentParticleCountBuffer as RDG external buffer, creating if needed */
 	FRDGBufferRef RegisterParticleCountBuffer(FRDGBuilder& GraphBuilder);
 
@@ -1288,23 +1449,27 @@ private:
 	int32 BoneDeltaAttachmentCapacity = 0;
 
 	//=============================================================================
-	// Shadow Data (extracted from StatsReadback in ProcessStatsReadback)
+	// Shadow Data (positions/velocities/neighbor counts live in ReadbackSnapshots)
 	//=============================================================================
 
-	/** Ready positions (extracted from StatsReadback) */
-	TArray<FVector3f> ReadyShadowPositions;
+	/** Enable flag for shadow data extraction */
+	std::atomic<bool> bShadowReadbackEnabled{false};
 
-	/** Ready velocities (extracted from StatsReadback, for prediction) */
-	TArray<FVector3f> ReadyShadowVelocities;
+	/** Max particle speed from the latest stats readback (negative = unknown) */
+	std::atomic<float> ReadbackMaxVelocity{-1.0f};
 
-	/** Ready neighbor counts (extracted from StatsReadback, for isolation detection) */
-	TArray<uint32> ReadyShadowNeighborCounts;
+	/** Number of max speed readbacks published */
+	std::atomic<uint32> ReadbackMaxVelocitySerial{0};
 
-	/** Frame number of ready shadow data */
-	std::atomic<uint64> ReadyShadowPositionsFrame{0};
+	/** Store a fresh max speed from a readback */
+	void PublishReadbackMaxVelocity(float MaxSpeed)
+	{
+		ReadbackMaxVelocity.store(MaxSpeed);
+		ReadbackMaxVelocitySerial.fetch_add(1);
+	}
 
-	/** Enable flag for shadow data extraction */
-	std::atomic<bool> bShadowReadbackEnabled{false};
+	/** Enable flag for world particle query readback (positions + velocities) */
+	std::atomic<bool> bQueryReadbackEnabled{false};
 
 	//=============================================================================
 	// Anisotropy Readback (Async GPU→CPU for Ellipsoid ISM Shadows)
@@ -1352,8 +1517,11 @@ private:
 	/** Particle count for each stats readback buffer */
 	int32 StatsReadbackParticleCounts[NUM_STATS_READBACK_BUFFERS] = { 0 };
 
-	/** Compact stats readback mode tracking (true = compact 32-byte, false = full 64-byte) */
-	bool bStatsReadbackCompactMode[NUM_STATS_READBACK_BUFFERS] = { false };
+	/** Packed layout of each stats readback buffer (TotalBytes == 0 = full 64-byte FGPUFluidParticle) */
+	FGPUReadbackLayout StatsReadbackLayouts[NUM_STATS_READBACK_BUFFERS];
+
+	/** Fields each readback consumer registered (EGPUReadbackConsumer slots) */
+	std::atomic<uint32> ReadbackConsumerFields[EGPUReadbackConsumer::Count] = {};
 
 	/** Persistent compact stats buffer for GPU extraction */
 	TRefCountPtr<FRDGPooledBuffer> PersistentCompactStatsBuffer;
@@ -1470,7 +1638,15 @@ public:
 	 * When enabled, particle positions are asynchronously read back for ISM shadows
 	 * @param bEnabled - true to enable async position readback
 	 */
-	void SetShadowReadbackEnabled(bool bEnabled) { bShadowReadbackEnabled.store(bEnabled); }
+	void SetShadowReadbackEnabled(bool bEnabled)
+	{
+		bShadowReadbackEnabled.store(bEnabled);
+		SetReadbackConsumerFields(EGPUReadbackConsumer::Shadow, bEnabled
+			? EGPUReadbackField::Position | EGPUReadbackField::Velocity | EGPUReadbackField::NeighborCount
+				| EGPUReadbackField::ParticleID | EGPUReadbackField::Flags
+				| EGPUReadbackField::AcceptQuantizedPosition | EGPUReadbackField::AcceptHalfVelocity
+			: EGPUReadbackField::None);
+	}
 
 	/**
 	 * Check if shadow readback is enabled
@@ -1481,7 +1657,7 @@ public:
 	 * Check if shadow positions are ready for use
 	 * @return true if async readback has completed and positions are available
 	 */
-	bool HasReadyShadowPositions() const { return ReadyShadowPositionsFrame.load() > 0 && ReadyShadowPositions.Num() > 0; }
+	bool HasReadyShadowPositions() const { return AcquireReadbackSnapshot().HasNeighborCounts(); }
 
 	/**
 	 * Get shadow positions (non-blocking, returns previously completed readback)
@@ -1498,10 +1674,19 @@ public:
 	 */
 	bool GetShadowPositionsAndVelocities(TArray<FVector>& OutPositions, TArray<FVector>& OutVelocities) const;
 
+	/**
+	 * Get persistent IDs and state flags of the shadow particles (non-blocking)
+	 * Aligned with GetShadowPositions when both are taken from the same snapshot; compare counts
+	 * @param OutParticleIDs - Output array of particle IDs
+	 * @param OutFlags - Output array of EGPUParticleFlags bits
+	 * @return true if valid data was retrieved
+	 */
+	bool GetShadowParticleStates(TArray<int32>& OutParticleIDs, TArray<uint32>& OutFlags) const;
+
 	/**
 	 * Get shadow position count
 	 */
-	int32 GetShadowPositionCount() const { return ReadyShadowPositions.Num(); }
+	int32 GetShadowPositionCount() const { return AcquireReadbackSnapshot().Num(); }
 
 	/**
 	 * Enable or disable anisotropy readback for ellipsoid shadows
@@ -1547,7 +1732,7 @@ public:
 	 * Check if neighbor count data is ready for use
 	 * @return true if shadow readback has completed (neighbor counts are included)
 	 */
-	bool HasReadyNeighborCountData() const { return ReadyShadowNeighborCounts.Num() > 0; }
+	bool HasReadyNeighborCountData() const { return AcquireReadbackSnapshot().HasNeighborCounts(); }
 
 	/**
 	 * Get neighbor counts (non-blocking, for isolation detection)
@@ -1600,7 +1785,8 @@ private:
 
 	void ReleaseStatsReadbackObjects();
 
-	void EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, bool bCompactMode = false);
+	/** PackedLayout nullptr = full 64-byte particles, otherwise the layout SourceBuffer was packed with */
+	void EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, const FGPUReadbackLayout* PackedLayout = nullptr);
 
 	void ProcessStatsReadback(FRHICommandListImmediate& RHICmdList);
 
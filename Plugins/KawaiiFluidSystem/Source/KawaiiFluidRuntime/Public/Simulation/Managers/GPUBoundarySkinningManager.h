@@ -7,6 +7,7 @@
 #include "RHIResources.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
 #include "Simulation/Resources/GPUFluidSpatialData.h"
+#include "Simulation/Resources/GPUBoundaryBoneArena.h"
 #include "Core/KawaiiFluidSimulationTypes.h"
 
 class USkeletalMeshComponent;
@@ -29,9 +30,15 @@ class FRDGBuilder;
  * @param PendingStaticBoundaryParticles CPU storage for particles waiting for GPU upload.
  * @param CachedBoundaryAdhesionParams Configuration for boundary adhesion.
  * @param BoundarySkinningDataMap Map of skinning data per mesh owner.
+ * @param BoneArena Bone transforms of all owners (game thread), shared with snapshots copy-on-write.
+ * @param ScratchBoneTransforms Reused conversion buffer for one owner's bones.
  * @param TotalLocalBoundaryParticleCount Sum of all local boundary particles.
  * @param PersistentLocalBoundaryBuffers Map of GPU buffers for local boundary particles.
  * @param PersistentWorldBoundaryBuffer GPU buffer for world-space boundary particles.
+ * @param PersistentBoneArenaBuffer GPU copy of the bone arena, patched with dirty ranges.
+ * @param BoneArenaBufferCapacity Capacity of the bone arena buffer in bones.
+ * @param UploadedBoneArenaLayoutRevision Arena layout the GPU copy matches (INDEX_NONE = none).
+ * @param PendingBoneUploadRanges Dirty ranges of consumed snapshots not uploaded yet.
  * @param PreviousWorldBoundaryBuffer Previous frame buffer for velocity calculation.
  * @param WorldBoundaryBufferCapacity Capacity of the world boundary buffer.
  * @param bHasPreviousFrame Whether previous frame data is available.
@@ -50,7 +57,7 @@ class FRDGBuilder;
  * @param BoundaryOwnerAABBs Map of world-space AABBs per mesh owner.
  * @param CombinedBoundaryAABB Unified AABB encompassing all owners.
  * @param bBoundaryAABBDirty Flag indicating combined AABB needs recalculation.
- * @param PendingBoneTransformSnapshots Queue of snapshotted bone transforms.
+ * @param PendingBoneTransformSnapshots Queue of bone arena snapshots (one per pending simulation).
  * @param ActiveSnapshot Currently active snapshot for simulation.
  * @param BoundarySkinningLock Critical section for thread-safe access.
  */
@@ -127,9 +134,9 @@ public:
 	// Bone Transform Access (for BoneDeltaAttachment system)
 	//=========================================================================
 
-	const TArray<FMatrix44f>* GetBoneTransforms(int32 OwnerID) const;
+	bool GetBoneTransforms(int32 OwnerID, TArray<FMatrix44f>& OutBoneTransforms) const;
 
-	const TArray<FMatrix44f>* GetFirstAvailableBoneTransforms(int32* OutOwnerID = nullptr) const;
+	bool GetFirstAvailableBoneTransforms(TArray<FMatrix44f>& OutBoneTransforms, int32* OutOwnerID = nullptr) const;
 
 	int32 GetBoneCount(int32 OwnerID) const;
 
@@ -163,12 +170,17 @@ public:
 	{
 		FRDGBufferRef LocalBoundaryParticlesBuffer = nullptr;
 		FRDGBufferRef BoneTransformsBuffer = nullptr;
+		int32 BoneOffset = 0;
 		int32 BoneCount = 0;
 		FMatrix44f ComponentTransform = FMatrix44f::Identity;
 	};
 
+	/** Pop the pending bone snapshot and upload the bone arena; once per substep, before any skinning pass */
+	FRDGBufferRef PrepareBoneArena(FRDGBuilder& GraphBuilder);
+
 	void AddBoundarySkinningPass(
 		FRDGBuilder& GraphBuilder,
+		FRDGBufferRef BoneArenaBuffer,
 		FRDGBufferRef& OutWorldBoundaryBuffer,
 		int32& OutBoundaryParticleCount,
 		float DeltaTime,
@@ -268,39 +280,18 @@ private:
 		int32 OwnerID = -1;
 		TArray<FGPUBoundaryParticleLocal> LocalParticles;
 
-		// =====================================================================
-		// ATOMIC SWAP DOUBLE BUFFER for thread-safe bone transform transfer
-		// Game Thread writes to Buffer[WriteIndex], then swaps WriteIndex
-		// Render Thread reads from Buffer[1 - WriteIndex] (the completed buffer)
-		// This prevents race conditions without expensive locks
-		// =====================================================================
-		TArray<FMatrix44f> BoneTransformsBuffer[2];       // Double buffer
-		FMatrix44f ComponentTransformBuffer[2];           // Double buffer
-		int32 WriteBufferIndex = 0;                       // Swap index (atomic not needed - see below)
-		// NOTE: We don't need TAtomic because:
-		// 1. Game Thread writes complete BEFORE Render Thread reads (Unreal's frame sync)
-		// 2. The index is only modified by Game Thread
-		// 3. int32 read/write is atomic on x64
-
-		// Legacy single buffer (kept for compatibility, will be removed)
-		TArray<FMatrix44f> BoneTransforms;
-		TArray<FMatrix44f> RenderBoneTransforms;
-		FMatrix44f ComponentTransform = FMatrix44f::Identity;
-		FMatrix44f RenderComponentTransform = FMatrix44f::Identity;
-
+		// Bone transforms live in BoneArena under the same OwnerID
 		TWeakObjectPtr<USkeletalMeshComponent> SkeletalMeshRef;  // For late bone refresh
 		bool bLocalParticlesUploaded = false;
-
-		FGPUBoundarySkinningData()
-		{
-			ComponentTransformBuffer[0] = FMatrix44f::Identity;
-			ComponentTransformBuffer[1] = FMatrix44f::Identity;
-		}
 	};
 
 	TMap<int32, FGPUBoundarySkinningData> BoundarySkinningDataMap;
 	int32 TotalLocalBoundaryParticleCount = 0;
 
+	// Written on the game thread only; the render thread reads snapshots
+	FGPUBoundaryBoneArena BoneArena;
+	TArray<FGPUBoundaryBoneTransform> ScratchBoneTransforms;
+
 	//=========================================================================
 	// Persistent Buffers
 	//=========================================================================
@@ -311,6 +302,15 @@ private:
 	int32 WorldBoundaryBufferCapacity = 0;
 	bool bHasPreviousFrame = false;  // True after first frame
 
+	// Bone arena on GPU (render thread)
+	TRefCountPtr<FRDGPooledBuffer> PersistentBoneArenaBuffer;
+	int32 BoneArenaBufferCapacity = 0;
+	int64 UploadedBoneArenaLayoutRevision = INDEX_NONE;
+	TArray<FGPUBoundaryBoneRange> PendingBoneUploadRanges;
+
+	/** Bring the GPU bone arena up to date with the active snapshot, uploading only dirty ranges */
+	FRDGBufferRef UploadBoneArena(FRDGBuilder& GraphBuilder);
+
 	//=========================================================================
 	// Dirty Tracking
 	//=========================================================================
@@ -354,38 +354,28 @@ private:
 	// Bone Transform Snapshot Queue (for deferred simulation execution)
 	// Prevents race condition: Game thread overwrites bone transforms before
 	// Render thread uses them. Each simulation enqueue captures a snapshot.
+	// Snapshots share the arena's bone array until the arena changes again.
 	//=========================================================================
 
-	/** Lightweight snapshot data (copyable, no atomics) */
-	struct FBoneTransformSnapshotData
-	{
-		int32 OwnerID = -1;
-		TArray<FMatrix44f> BoneTransforms;
-		FMatrix44f ComponentTransform = FMatrix44f::Identity;
-		bool bLocalParticlesUploaded = false;
-	};
-
-	/** Snapshotted bone transforms for a single pending simulation */
-	struct FBoneTransformSnapshot
-	{
-		TMap<int32, FBoneTransformSnapshotData> SkinningDataSnapshot;
-	};
+	/** Snapshots beyond this many are merged into the next one (render thread not consuming) */
+	static constexpr int32 MaxPendingBoneSnapshots = 8;
 
-	/** Queue of bone transform snapshots (one per pending simulation) */
-	TArray<FBoneTransformSnapshot> PendingBoneTransformSnapshots;
+	/** Queue of bone arena snapshots (one per pending simulation) */
+	TArray<FGPUBoundaryBoneArenaSnapshot> PendingBoneTransformSnapshots;
 
-	/** Currently active snapshot during AddBoundarySkinningPass execution */
-	TOptional<FBoneTransformSnapshot> ActiveSnapshot;
+	/** Snapshot used by the skinning passes; kept until PrepareBoneArena activates a newer one */
+	TOptional<FGPUBoundaryBoneArenaSnapshot> ActiveSnapshot;
 
 public:
 	/**
 	 * @brief Snapshot current bone transforms for deferred simulation execution.
-	 * Call this from EnqueueSimulation() to capture bone transforms at enqueue time.
+	 * Called by RefreshAllBoneTransforms() at enqueue time; shares the arena's bones instead of copying them.
 	 */
 	void SnapshotBoneTransformsForPendingSimulation();
 
 	/**
-	 * @brief Pop and activate a snapshotted bone transform for execution.
+	 * @brief Activate the newest snapshotted bone transforms for execution, dropping older queued snapshots.
+	 * The dirty ranges of every dropped snapshot are merged into it and queued for the next bone arena upload.
 	 * @return true if a snapshot was available and is now active.
 	 */
 	bool PopAndActivateSnapshot();
@@ -401,12 +391,15 @@ public:
 	 */
 	bool HasActiveSnapshot() const { return ActiveSnapshot.IsSet(); }
 
+	/** Active snapshot, nullptr if none (render thread or tests) */
+	const FGPUBoundaryBoneArenaSnapshot* GetActiveSnapshot() const { return ActiveSnapshot.GetPtrOrNull(); }
+
 	/**
-	 * @brief Get the active snapshot's skinning data for a specific owner.
+	 * @brief Get the active snapshot's bone range for a specific owner.
 	 * @param OwnerID Unique ID.
 	 * @return Pointer to snapshot data.
 	 */
-	const FBoneTransformSnapshotData* GetActiveSnapshotData(int32 OwnerID) const;
+	const FGPUBoundaryBoneOwner* GetActiveSnapshotData(int32 OwnerID) const;
 
 private:
 	//=========================================================================
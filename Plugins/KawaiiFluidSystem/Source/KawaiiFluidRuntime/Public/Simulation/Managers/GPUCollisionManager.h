@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <atomic>
 #include "RenderGraphResources.h"
 #include "RHIResources.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
@@ -28,6 +29,10 @@ class FRDGBuilder;
  * @param CachedConvexHeaders Headers for convex collision primitives.
  * @param CachedConvexPlanes Plane data for convex collision primitives.
  * @param CachedBoneTransforms Bone transforms for primitive attachment.
+ * @param PrimitivesRevision Incremented by UploadCollisionPrimitives when the primitive data changes.
+ * @param UploadedPrimitivesRevision Revision held by the pooled GPU buffers.
+ * @param SpheresPooledBuffer Persistent GPU copy of CachedSpheres (likewise for the other pooled buffers).
+ * @param UploadedSphereCount Element count of the pooled buffers (likewise for the other counts).
  * @param PrimitiveCollisionThreshold Search threshold for primitive collisions.
  * @param bCollisionPrimitivesValid Flag indicating valid primitive data.
  * @param bBoneTransformsValid Flag indicating valid bone transform data.
@@ -192,6 +197,21 @@ private:
 	bool bCollisionPrimitivesValid = false;
 	bool bBoneTransformsValid = false;
 
+	// Persistent GPU copies, re-uploaded only when the primitive data changed (render thread)
+	std::atomic<uint32> PrimitivesRevision{0};
+	uint32 UploadedPrimitivesRevision = 0;
+	TRefCountPtr<FRDGPooledBuffer> SpheresPooledBuffer;
+	TRefCountPtr<FRDGPooledBuffer> CapsulesPooledBuffer;
+	TRefCountPtr<FRDGPooledBuffer> BoxesPooledBuffer;
+	TRefCountPtr<FRDGPooledBuffer> ConvexesPooledBuffer;
+	TRefCountPtr<FRDGPooledBuffer> ConvexPlanesPooledBuffer;
+	TRefCountPtr<FRDGPooledBuffer> BoneTransformsPooledBuffer;
+	int32 UploadedSphereCount = 0;
+	int32 UploadedCapsuleCount = 0;
+	int32 UploadedBoxCount = 0;
+	int32 UploadedConvexCount = 0;
+	int32 UploadedBoneCount = 0;
+
 	//=========================================================================
 	// Collision Feedback
 	//=========================================================================
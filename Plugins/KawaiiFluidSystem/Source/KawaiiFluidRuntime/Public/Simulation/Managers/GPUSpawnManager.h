@@ -6,6 +6,8 @@
 #include "CoreMinimal.h"
 #include "RenderGraphResources.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidSpawnQueue.h"
+#include "Simulation/Utils/KawaiiFluidSpawnDescriptor.h"
 #include <atomic>
 
 class FRHIGPUBufferReadback;
@@ -14,13 +16,35 @@ class FRDGBuilder;
 /**
  * @class FGPUSpawnManager
  * @brief Manages thread-safe particle spawn requests for GPU fluid simulation.
+ *
+ * Producers (emitters, brushes, gameplay code on any thread) push into a lock-free per-producer
+ * SpawnQueue. SpawnLock is consumer-side only: it serializes the once-per-frame drain in SwapBuffers
+ * with cancel/clear calls, so producers never wait on it.
+ * Procedural fills and stream layers arrive as spawn plans (one record per shape, not per particle) and
+ * are expanded by FSpawnFromDescriptorCS, or on the render thread when r.Fluid.GPUSpawnDescriptors is 0.
+ * Large initial particle sets (level load) arrive as upload chunks of converted particles; SwapBuffers
+ * releases at most r.Fluid.StreamingUploadBudgetKB of them per frame and FAppendParticlesCS appends
+ * them to the live buffer, so already-resident particles keep simulating while the rest streams in.
  * 
  * @param bIsInitialized State of the manager.
  * @param MaxParticleCapacity Maximum number of particles the system can handle.
- * @param PendingSpawnRequests Queue for new spawn requests from any thread.
+ * @param ParticleCapacity Currently allocated particle capacity (<= MaxParticleCapacity).
+ * @param SpawnQueue Lock-free multi-producer queue for new spawn requests from any thread.
+ * @param PendingSpawnRequests Requests drained from SpawnQueue by a cancel but not yet swapped to active.
  * @param ActiveSpawnRequests Buffer for requests being processed by the render thread.
- * @param SpawnLock Critical section for spawn request thread safety.
- * @param bHasPendingSpawnRequests Atomic flag for quick pending check.
+ * @param SpawnLock Serializes SpawnQueue consumers and guards PendingSpawnRequests; never taken by producers.
+ * @param bHasPendingSpawnRequests Atomic flag set while PendingSpawnRequests is non-empty.
+ * @param PendingSpawnPlans Procedural spawn plans queued since the last swap.
+ * @param ActiveSpawnPlans Plans being expanded by the render thread (after ActiveSpawnRequests).
+ * @param ActiveSpawnPlanParticleCount Total particles of ActiveSpawnPlans.
+ * @param PendingSpawnPlanParticleCount Total particles of PendingSpawnPlans (lock-free reads).
+ * @param SpawnPlanLock Guards the plan arrays; held only to append or swap a plan.
+ * @param PendingUploadChunks Converted particle chunks waiting for upload budget, in queue order.
+ * @param ActiveUploadChunks Chunks appended by the render thread this frame (after spawn plans).
+ * @param FreeUploadChunks Recycled chunk allocations (persistent staging), at most MaxFreeUploadChunks.
+ * @param ActiveUploadParticleCount Total particles of ActiveUploadChunks.
+ * @param PendingUploadParticleCount Total particles of PendingUploadChunks (lock-free reads).
+ * @param UploadLock Guards the upload chunk arrays; never held during conversion.
  * @param PendingGPUBrushDespawns Queue for brush-based despawn requests.
  * @param ActiveGPUBrushDespawns Buffer for brush despawns being processed.
  * @param PendingGPUSourceDespawns Queue for source-based despawn requests.
@@ -68,13 +92,24 @@ public:
 
 	bool IsReady() const { return bIsInitialized; }
 
+	/** Set allocated particle capacity used to size compaction buffers (render thread; game thread only in Initialize, before any render command) */
+	void SetParticleCapacity(int32 InCapacity) { ParticleCapacity = FMath::Clamp(InCapacity, 1, MaxParticleCapacity); }
+
+	int32 GetParticleCapacity() const { return ParticleCapacity; }
+
+	/** Bytes held by persistent stream compaction buffers */
+	int64 GetStreamCompactionBytes() const;
+
 	void Reset()
 	{
 		FScopeLock SpawnGuard(&SpawnLock);
 		FScopeLock DespawnGuard(&GPUDespawnLock);
 
+		SpawnQueue.Discard();
 		PendingSpawnRequests.Empty();
 		ActiveSpawnRequests.Empty();
+		ClearSpawnPlans();
+		ClearUploadChunks();
 		PendingGPUBrushDespawns.Empty();
 		ActiveGPUBrushDespawns.Empty();
 		PendingGPUSourceDespawns.Empty();
@@ -101,7 +136,30 @@ public:
 
 	void AddSpawnRequest(const FVector3f& Position, const FVector3f& Velocity, float Mass = 1.0f);
 
-	void AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests);
+	void AddSpawnRequest(const FGPUSpawnRequest& Request);
+
+	void AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests);
+
+	/** Queue a built spawn plan; its particles spawn after this frame's individual requests */
+	void AddSpawnPlan(FKawaiiFluidSpawnPlan&& Plan);
+
+	/**
+	 * Build and queue a spawn plan for Descriptor
+	 * @return Number of particles the plan spawns
+	 */
+	int32 AddSpawnDescriptor(const FKawaiiFluidSpawnDescriptor& Descriptor);
+
+	/** Particles per upload chunk (1 MB of FGPUFluidParticle) */
+	static constexpr int32 UploadChunkSize = 16384;
+
+	/** Empty chunk for AddUploadChunks, reusing a recycled allocation when available */
+	TArray<FGPUFluidParticle> AcquireUploadChunk();
+
+	/** Queue converted particles (IDs already allocated); they become resident over the next frames */
+	void AddUploadChunks(TArray<TArray<FGPUFluidParticle>>&& Chunks);
+
+	/** Particles queued for upload but not yet appended */
+	int32 GetPendingUploadCount() const { return PendingUploadParticleCount.load(); }
 
 	void ClearSpawnRequests();
 
@@ -109,7 +167,10 @@ public:
 
 	int32 GetPendingSpawnCount() const;
 
-	bool HasPendingSpawnRequests() const { return bHasPendingSpawnRequests.load(); }
+	bool HasPendingSpawnRequests() const
+	{
+		return bHasPendingSpawnRequests.load() || PendingSpawnPlanParticleCount.load() > 0 || PendingUploadParticleCount.load() > 0 || !SpawnQueue.IsEmpty();
+	}
 
 	//=========================================================================
 	// GPU-Driven Despawn API (Thread-Safe)
@@ -186,13 +247,31 @@ public:
 
 	void SwapBuffers();
 
-	bool HasActiveRequests() const { return ActiveSpawnRequests.Num() > 0; }
+	/**
+	 * Move pending upload chunks totalling at most BudgetBytes (always at least one) to the active set
+	 * @return Number of particles moved
+	 */
+	int32 TakeUploadChunks(int64 BudgetBytes);
+
+	bool HasActiveRequests() const { return GetActiveRequestCount() > 0; }
+
+	/** Particles added this frame: individual requests, active plan totals and uploaded chunks */
+	int32 GetActiveRequestCount() const { return ActiveSpawnRequests.Num() + ActiveSpawnPlanParticleCount + ActiveUploadParticleCount; }
 
-	int32 GetActiveRequestCount() const { return ActiveSpawnRequests.Num(); }
+	int32 GetActiveUploadCount() const { return ActiveUploadParticleCount; }
 
 	const TArray<FGPUSpawnRequest>& GetActiveRequests() const { return ActiveSpawnRequests; }
 
-	void ClearActiveRequests() { ActiveSpawnRequests.Empty(); }
+	const TArray<FKawaiiFluidSpawnPlan>& GetActiveSpawnPlans() const { return ActiveSpawnPlans; }
+
+	/** Keeps the allocation; SwapBuffers hands it back to the drain next frame */
+	void ClearActiveRequests()
+	{
+		ActiveSpawnRequests.Reset();
+		ActiveSpawnPlans.Reset();
+		ActiveSpawnPlanParticleCount = 0;
+		RecycleActiveUploadChunks();
+	}
 
 	void AddSpawnParticlesPass(
 		FRDGBuilder& GraphBuilder,
@@ -209,10 +288,12 @@ private:
 
 	bool bIsInitialized = false;
 	int32 MaxParticleCapacity = 0;
+	int32 ParticleCapacity = 0;
 
 	//=========================================================================
 	// Double-Buffered Spawn Requests
 	//=========================================================================
+	FKawaiiFluidSpawnQueue SpawnQueue;
 	TArray<FGPUSpawnRequest> PendingSpawnRequests;
 	TArray<FGPUSpawnRequest> ActiveSpawnRequests;
 	mutable FCriticalSection SpawnLock;
@@ -220,6 +301,54 @@ private:
 	// Lock-free flag for quick pending check
 	std::atomic<bool> bHasPendingSpawnRequests{false};
 
+	//=========================================================================
+	// Double-Buffered Spawn Plans
+	//=========================================================================
+	TArray<FKawaiiFluidSpawnPlan> PendingSpawnPlans;
+	TArray<FKawaiiFluidSpawnPlan> ActiveSpawnPlans;
+	int32 ActiveSpawnPlanParticleCount = 0;
+	std::atomic<int32> PendingSpawnPlanParticleCount{0};
+	mutable FCriticalSection SpawnPlanLock;
+
+	void ClearSpawnPlans();
+
+	void AddSpawnPlanPasses(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferUAVRef ParticlesUAV,
+		FRDGBufferUAVRef ParticleCounterUAV,
+		FRDGBufferUAVRef SourceCounterUAV,
+		int32 MaxParticleCount);
+
+	void AddSpawnRequestPass(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferUAVRef ParticlesUAV,
+		FRDGBufferUAVRef ParticleCounterUAV,
+		FRDGBufferUAVRef SourceCounterUAV,
+		int32 MaxParticleCount);
+
+	//=========================================================================
+	// Streaming Particle Upload
+	//=========================================================================
+	static constexpr int32 MaxFreeUploadChunks = 8;
+
+	TArray<TArray<FGPUFluidParticle>> PendingUploadChunks;
+	TArray<TArray<FGPUFluidParticle>> ActiveUploadChunks;
+	TArray<TArray<FGPUFluidParticle>> FreeUploadChunks;
+	int32 ActiveUploadParticleCount = 0;
+	std::atomic<int32> PendingUploadParticleCount{0};
+	mutable FCriticalSection UploadLock;
+
+	void ClearUploadChunks();
+
+	void RecycleActiveUploadChunks();
+
+	void AddUploadChunkPasses(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferUAVRef ParticlesUAV,
+		FRDGBufferUAVRef ParticleCounterUAV,
+		FRDGBufferUAVRef SourceCounterUAV,
+		int32 MaxParticleCount);
+
 	//=========================================================================
 	// Double-Buffered GPU-Driven Despawn Requests
 	//=========================================================================
@@ -91,7 +91,10 @@ public:
 		// Optional: BoneDeltaAttachment buffer to reorder along with particles
 		FRDGBufferRef InAttachmentBuffer = nullptr,
 		FRDGBufferRef* OutSortedAttachmentBuffer = nullptr,
-		FRDGBufferRef IndirectArgsBuffer = nullptr);
+		FRDGBufferRef IndirectArgsBuffer = nullptr,
+		// Optional: tick-start positions (render interpolation) to reorder along with particles
+		FRDGBufferRef InPreviousPositionsBuffer = nullptr,
+		FRDGBufferRef* OutSortedPreviousPositionsBuffer = nullptr);
 
 private:
 	//=========================================================================
@@ -123,7 +126,10 @@ private:
 		// Optional: BoneDeltaAttachment reordering
 		FRDGBufferSRVRef OldAttachmentsSRV = nullptr,
 		FRDGBufferUAVRef SortedAttachmentsUAV = nullptr,
-		FRDGBufferRef IndirectArgsBuffer = nullptr);
+		FRDGBufferRef IndirectArgsBuffer = nullptr,
+		// Optional: tick-start position reordering
+		FRDGBufferSRVRef OldPreviousPositionsSRV = nullptr,
+		FRDGBufferUAVRef SortedPreviousPositionsUAV = nullptr);
 
 	void AddComputeCellStartEndPass(
 		FRDGBuilder& GraphBuilder,
@@ -0,0 +1,161 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidAnisotropy.h"
+#include "Core/KawaiiFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidParticleQueryIndex.h"
+
+/**
+ * @struct FKawaiiFluidSymmetric3x3
+ * @brief Upper triangle of a symmetric 3x3 matrix (covariance).
+ */
+struct FKawaiiFluidSymmetric3x3
+{
+	float XX = 0.0f;
+	float XY = 0.0f;
+	float XZ = 0.0f;
+	float YY = 0.0f;
+	float YZ = 0.0f;
+	float ZZ = 0.0f;
+
+	FVector3f Multiply(const FVector3f& V) const
+	{
+		return FVector3f(
+			XX * V.X + XY * V.Y + XZ * V.Z,
+			XY * V.X + YY * V.Y + YZ * V.Z,
+			XZ * V.X + YZ * V.Y + ZZ * V.Z);
+	}
+};
+
+/**
+ * @struct FKawaiiFluidEllipsoid
+ * @brief Ellipsoid of one particle in the layout of the GPU anisotropy buffers.
+ *
+ * @param Axis1 Unit direction of the first axis (largest covariance spread / velocity direction).
+ * @param Axis2 Unit direction of the second axis.
+ * @param Axis3 Unit direction of the third axis.
+ * @param Scales Axis scales relative to the particle radius.
+ */
+struct FKawaiiFluidEllipsoid
+{
+	FVector3f Axis1 = FVector3f(1.0f, 0.0f, 0.0f);
+	FVector3f Axis2 = FVector3f(0.0f, 1.0f, 0.0f);
+	FVector3f Axis3 = FVector3f(0.0f, 0.0f, 1.0f);
+	FVector3f Scales = FVector3f::OneVector;
+};
+
+/**
+ * CPU counterpart of FluidAnisotropyCompute.usf. Each function follows the shader function of the
+ * same name step for step, so the CPU stage doubles as a reference for validating the GPU pass.
+ */
+namespace KawaiiFluidAnisotropyMath
+{
+	/** Fewer neighbors than this keep the particle spherical (PCA needs at least 4) */
+	constexpr int32 MinNeighbors = 4;
+
+	/** Neighbor count at which anisotropy is applied in full */
+	constexpr int32 FullNeighbors = 6;
+
+	/** Yu & Turk eigenvalue ratio limit (smallest sigma >= largest / KR) */
+	constexpr float KR = 4.0f;
+
+	/** Unnormalized cubic spline (1 at the center, 0 at H) */
+	KAWAIIFLUIDRUNTIME_API float KernelWeight(float Distance, float H);
+
+	/** Frisvad orthonormal basis around a unit direction */
+	KAWAIIFLUIDRUNTIME_API void BuildOrthonormalBasis(const FVector3f& N, FVector3f& OutT, FVector3f& OutB);
+
+	/**
+	 * Analytical eigen-decomposition of a symmetric 3x3 matrix (Kopp 2008)
+	 * Scalar, one matrix per call like the shader; there is no SIMD batch variant, the solver parallelizes over particles instead
+	 * @param M Symmetric matrix
+	 * @param OutEigenValues Eigenvalues, descending
+	 * @param OutEigenVec0 Unit eigenvector of the largest eigenvalue, likewise 1 and 2 (right-handed)
+	 */
+	KAWAIIFLUIDRUNTIME_API void SymmetricEigen3x3(const FKawaiiFluidSymmetric3x3& M, FVector3f& OutEigenValues,
+		FVector3f& OutEigenVec0, FVector3f& OutEigenVec1, FVector3f& OutEigenVec2);
+
+	/** Ellipsoid stretched along the velocity */
+	KAWAIIFLUIDRUNTIME_API FKawaiiFluidEllipsoid CalculateVelocityBased(const FVector3f& Velocity, const FKawaiiFluidAnisotropyParams& Params);
+
+	/**
+	 * Ellipsoid from the weighted neighbor covariance
+	 * @param Covariance Weighted covariance of the neighbors around their smoothed center
+	 * @param NeighborCount Neighbors inside the smoothing radius (self included)
+	 * @param SmoothingRadius Kernel radius (only used without volume preservation)
+	 */
+	KAWAIIFLUIDRUNTIME_API FKawaiiFluidEllipsoid CalculateDensityBased(const FKawaiiFluidSymmetric3x3& Covariance, int32 NeighborCount,
+		float SmoothingRadius, const FKawaiiFluidAnisotropyParams& Params);
+
+	/** Hybrid mode: scales blended by DensityWeight, axes taken from the dominant side */
+	KAWAIIFLUIDRUNTIME_API FKawaiiFluidEllipsoid BlendHybrid(const FKawaiiFluidEllipsoid& Density, const FKawaiiFluidEllipsoid& Velocity,
+		const FKawaiiFluidAnisotropyParams& Params);
+
+	/** Blend with the previous ellipsoid (axis signs aligned first, scales in log space) */
+	KAWAIIFLUIDRUNTIME_API FKawaiiFluidEllipsoid ApplyTemporalSmoothing(const FKawaiiFluidEllipsoid& Current, const FVector4f& PrevAxis1,
+		const FVector4f& PrevAxis2, const FVector4f& PrevAxis3, float SmoothFactor);
+}
+
+/**
+ * @class FKawaiiFluidAnisotropySolver
+ * @brief Multithreaded CPU anisotropy stage producing the same Axis1..3 buffers as the GPU anisotropy pass.
+ *
+ * Neighbors come from a FKawaiiFluidParticleQueryIndex built over the input, and particles are processed
+ * in its cell order so neighbor reads stay cache-local. Like the GPU pass, results are only recomputed
+ * every UpdateInterval calls to Update and are blended with the previous result when temporal smoothing
+ * is on. Boundary-particle and collider-normal contributions are GPU-only and not reproduced here.
+ * No runtime path consumes it yet: the renderer reads the GPU pass buffers, so this stage serves as the
+ * CPU reference for that pass (automation tests and the anisotropy benchmark).
+ *
+ * @param NeighborIndex Cell-sorted copy of the input positions (SourceID = input index).
+ * @param Axis1 Result per input particle (xyz = direction, w = scale), likewise Axis2/Axis3.
+ * @param InputIndices Identity index list handed to the neighbor index as source IDs.
+ * @param ScratchPositions Float copy of particle positions for the particle-array overload.
+ * @param ScratchVelocities Float copy of particle velocities for the particle-array overload.
+ * @param FrameCounter Update calls since the last recompute.
+ * @param bHasResult True once Axis1..3 hold a computed result.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidAnisotropySolver
+{
+public:
+	/**
+	 * Recompute when UpdateInterval calls have passed (or the particle count changed)
+	 * @return True if the axes were recomputed by this call
+	 */
+	bool Update(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> Velocities,
+		const FKawaiiFluidAnisotropyParams& Params, float SmoothingRadius);
+
+	bool Update(const TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidAnisotropyParams& Params, float SmoothingRadius);
+
+	/** Recompute now, regardless of UpdateInterval */
+	void Compute(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> Velocities,
+		const FKawaiiFluidAnisotropyParams& Params, float SmoothingRadius);
+
+	void Reset();
+
+	bool HasResult() const { return bHasResult; }
+
+	int32 Num() const { return Axis1.Num(); }
+
+	TConstArrayView<FVector4f> GetAxis1() const { return Axis1; }
+
+	TConstArrayView<FVector4f> GetAxis2() const { return Axis2; }
+
+	TConstArrayView<FVector4f> GetAxis3() const { return Axis3; }
+
+private:
+	FKawaiiFluidParticleQueryIndex NeighborIndex;
+
+	TArray<FVector4f> Axis1;
+	TArray<FVector4f> Axis2;
+	TArray<FVector4f> Axis3;
+
+	TArray<int32> InputIndices;
+	TArray<FVector3f> ScratchPositions;
+	TArray<FVector3f> ScratchVelocities;
+
+	int32 FrameCounter = 0;
+	bool bHasResult = false;
+};
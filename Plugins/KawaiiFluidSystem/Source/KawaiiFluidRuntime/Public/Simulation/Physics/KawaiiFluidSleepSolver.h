@@ -0,0 +1,105 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidParticle.h"
+
+/**
+ * @struct FKawaiiFluidSleepParams
+ * @brief Sleep/wake thresholds for the CPU backend (same semantics as the GPU sleeping pass).
+ *
+ * @param SleepVelocityThreshold Speed (cm/s) below which a particle counts toward sleeping.
+ * @param SleepFrameThreshold Consecutive substeps below SleepVelocityThreshold before sleeping.
+ * @param WakeVelocityThreshold Speed (cm/s) of the particle or an awake neighbor that wakes a sleeper.
+ * @param CellSize Deactivation cell size (cm), normally the SmoothingRadius.
+ */
+struct FKawaiiFluidSleepParams
+{
+	float SleepVelocityThreshold = 5.0f;
+	int32 SleepFrameThreshold = 30;
+	float WakeVelocityThreshold = 20.0f;
+	float CellSize = 20.0f;
+};
+
+/**
+ * @struct FKawaiiFluidSleepStats
+ * @brief Occupancy of the last active set build.
+ *
+ * @param AwakeParticles Particles not sleeping.
+ * @param SimulatedParticles Particles in the working set (awake cells, their neighbors and the frozen halo).
+ * @param TotalCells Occupied deactivation cells.
+ * @param ActiveCells Cells containing an awake particle or adjacent to one.
+ */
+struct FKawaiiFluidSleepStats
+{
+	int32 AwakeParticles = 0;
+	int32 SimulatedParticles = 0;
+	int32 TotalCells = 0;
+	int32 ActiveCells = 0;
+};
+
+/**
+ * @class FKawaiiFluidSleepSolver
+ * @brief Particle sleeping and cell-level island deactivation for the CPU simulation path.
+ *
+ * Particles sleep after SleepFrameThreshold slow substeps and are frozen in place by PredictPositions
+ * and FinalizePositions. Cells are deactivated when neither they nor any of their 26 neighbors hold an
+ * awake particle; the substep then runs only on a compacted working set of active cells plus a one-cell
+ * halo of frozen sleepers, so settled pools cost a single early-out check. Colliders (WakeInBounds) and
+ * newly spawned fluid (WakeNearSpawned) wake the sleepers they reach.
+ *
+ * @param CellKeys Per-particle cell coordinate from the last build.
+ * @param CellIndexMap Cell coordinate to dense cell index.
+ * @param CellStarts Start offset of each cell in SortedIndices.
+ * @param SortedIndices Particle indices grouped by cell.
+ * @param CellLevels Per-cell activation level (0 = inactive, 1 = halo, 2 = active).
+ * @param WorkingToFull Working set index to full array index.
+ * @param WorkingParticles Reused compacted working set.
+ * @param CachedParticlesData Particle array identity for the all-asleep early out.
+ * @param CachedParticleCount Particle count for the all-asleep early out.
+ * @param bAllAsleep True when the last build found no awake particle.
+ * @param Stats Occupancy of the last build.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSleepSolver
+{
+public:
+	FKawaiiFluidSleepSolver();
+
+	int32 WakeInBounds(TArray<FKawaiiFluidParticle>& Particles, const FBox& Bounds);
+
+	int32 WakeNearSpawned(TArray<FKawaiiFluidParticle>& Particles, float CellSize);
+
+	bool BuildActiveSet(const TArray<FKawaiiFluidParticle>& Particles, float CellSize);
+
+	bool HasInactiveParticles() const { return WorkingToFull.Num() > 0; }
+
+	TArray<FKawaiiFluidParticle>& GatherWorkingSet(TArray<FKawaiiFluidParticle>& Particles);
+
+	void ScatterWorkingSet(TArray<FKawaiiFluidParticle>& Particles);
+
+	void UpdateSleepStates(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidSleepParams& Params);
+
+	const FKawaiiFluidSleepStats& GetStats() const { return Stats; }
+
+	void Reset();
+
+private:
+	TArray<FIntVector> CellKeys;
+	TMap<FIntVector, int32> CellIndexMap;
+	TArray<int32> CellStarts;
+	TArray<int32> SortedIndices;
+	TArray<uint8> CellLevels;
+
+	TArray<int32> WorkingToFull;
+	TArray<FKawaiiFluidParticle> WorkingParticles;
+
+	const FKawaiiFluidParticle* CachedParticlesData = nullptr;
+	int32 CachedParticleCount = -1;
+	float CachedCellSize = 0.0f;
+	bool bAllAsleep = false;
+
+	FKawaiiFluidSleepStats Stats;
+
+	void DilateCells(uint8 SourceLevel, uint8 TargetLevel);
+};
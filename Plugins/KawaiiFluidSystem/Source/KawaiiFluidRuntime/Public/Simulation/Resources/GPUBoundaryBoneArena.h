@@ -0,0 +1,142 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Persistent bone transform arena with copy-on-write snapshots and dirty-range tracking
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+
+/**
+ * @struct FGPUBoundaryBoneRange
+ * @brief Contiguous range of bones in the arena.
+ *
+ * @param Start First bone.
+ * @param Num Number of bones.
+ */
+struct FGPUBoundaryBoneRange
+{
+	int32 Start = 0;
+	int32 Num = 0;
+
+	int32 End() const { return Start + Num; }
+
+	/** Sort by start and merge overlapping or adjacent ranges in place */
+	static void Coalesce(TArray<FGPUBoundaryBoneRange>& Ranges);
+};
+
+/**
+ * @struct FGPUBoundaryBoneOwner
+ * @brief Where one owner's bones live in the arena.
+ *
+ * @param Offset First bone of the owner.
+ * @param Count Number of bones.
+ * @param ComponentTransform Component world matrix (fallback for particles without a bone).
+ */
+struct FGPUBoundaryBoneOwner
+{
+	int32 Offset = 0;
+	int32 Count = 0;
+	FMatrix44f ComponentTransform = FMatrix44f::Identity;
+};
+
+/**
+ * @struct FGPUBoundaryBoneArenaSnapshot
+ * @brief Immutable view of the arena for one pending simulation.
+ *
+ * Bones is shared with the arena until the arena next changes, so a snapshot of an unchanged
+ * arena copies only the owner table.
+ *
+ * @param Bones Bone transforms of every owner.
+ * @param Owners Range and component transform per owner ID.
+ * @param DirtyRanges Bones changed since the previous snapshot (coalesced).
+ * @param LayoutRevision Changes whenever owner ranges are compacted; dirty ranges only apply within one layout.
+ */
+struct FGPUBoundaryBoneArenaSnapshot
+{
+	TSharedPtr<const TArray<FGPUBoundaryBoneTransform>, ESPMode::ThreadSafe> Bones;
+	TMap<int32, FGPUBoundaryBoneOwner> Owners;
+	TArray<FGPUBoundaryBoneRange> DirtyRanges;
+	uint32 LayoutRevision = 0;
+
+	int32 NumBones() const { return Bones.IsValid() ? Bones->Num() : 0; }
+
+	/** Bones of one owner, empty if the owner is unknown */
+	TConstArrayView<FGPUBoundaryBoneTransform> GetOwnerBones(int32 OwnerID) const;
+};
+
+/**
+ * @class FGPUBoundaryBoneArena
+ * @brief Bone transforms of every boundary owner in one array, uploaded to one persistent GPU buffer.
+ *
+ * Each owner keeps a fixed range while its bone count is unchanged. Writes within tolerance of the
+ * stored bones are ignored, so a resting character produces no dirty range and its bones are never
+ * re-uploaded; an animated one dirties only the span between its first and last moved bone. Stored
+ * bones are only replaced when they move beyond tolerance, so drift never accumulates.
+ *
+ * The array is copy-on-write: snapshots share it, and the arena clones it only when it is written
+ * while a snapshot still holds it. Owners whose bone count changes move to the end of the array;
+ * once freed bones outweigh live ones the array is compacted and LayoutRevision bumped, which
+ * tells the GPU side to upload everything once.
+ *
+ * Game thread only; snapshots may be read and released on any thread.
+ *
+ * @param Bones Bone storage shared with snapshots.
+ * @param Owners Range and component transform per owner ID.
+ * @param DirtyRanges Bones changed since the last snapshot.
+ * @param FreeBoneCount Bones no longer owned (holes left by moved or removed owners).
+ * @param LayoutRevision Bumped on compaction.
+ */
+class KAWAIIFLUIDRUNTIME_API FGPUBoundaryBoneArena
+{
+public:
+	/** Compaction is skipped while the arena holds fewer freed bones than this */
+	static constexpr int32 MinFreeBonesForCompaction = 256;
+
+	/**
+	 * Store one owner's bones, recording the range that changed beyond tolerance
+	 * @param OwnerID Boundary owner
+	 * @param InBones Bone transforms (count may change between calls)
+	 * @param ComponentTransform Component world matrix
+	 * @param PositionTolerance Max translation difference per axis ignored (cm)
+	 * @param RotationTolerance Max quaternion and scale component difference ignored
+	 * @return True if any bone or the component transform changed
+	 */
+	bool WriteOwner(int32 OwnerID, TConstArrayView<FGPUBoundaryBoneTransform> InBones, const FMatrix44f& ComponentTransform,
+		float PositionTolerance, float RotationTolerance);
+
+	/** Free an owner's range; returns false if the owner is unknown */
+	bool RemoveOwner(int32 OwnerID);
+
+	/** Drop every owner and bump the layout revision */
+	void Reset();
+
+	/** Share the current bones with a new snapshot and hand it the dirty ranges gathered since the previous one */
+	FGPUBoundaryBoneArenaSnapshot TakeSnapshot();
+
+	const FGPUBoundaryBoneOwner* FindOwner(int32 OwnerID) const { return Owners.Find(OwnerID); }
+
+	/** Bones of one owner, empty if the owner is unknown */
+	TConstArrayView<FGPUBoundaryBoneTransform> GetOwnerBones(int32 OwnerID) const;
+
+	const TMap<int32, FGPUBoundaryBoneOwner>& GetOwners() const { return Owners; }
+
+	/** Arena size in bones, including freed ones */
+	int32 NumBones() const { return Bones.IsValid() ? Bones->Num() : 0; }
+
+	int32 GetFreeBoneCount() const { return FreeBoneCount; }
+
+	uint32 GetLayoutRevision() const { return LayoutRevision; }
+
+private:
+	/** Clone the bone array if a snapshot still shares it */
+	void MakeBonesWritable();
+
+	/** Move every owner to a contiguous range in ID order */
+	void Compact();
+
+	TSharedPtr<TArray<FGPUBoundaryBoneTransform>, ESPMode::ThreadSafe> Bones;
+	TMap<int32, FGPUBoundaryBoneOwner> Owners;
+	TArray<FGPUBoundaryBoneRange> DirtyRanges;
+	int32 FreeBoneCount = 0;
+	uint32 LayoutRevision = 0;
+};
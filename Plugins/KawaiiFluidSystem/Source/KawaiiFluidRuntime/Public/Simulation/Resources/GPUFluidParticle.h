@@ -685,6 +685,63 @@ struct FGPUBoneTransform
 };
 static_assert(sizeof(FGPUBoneTransform) == 64, "FGPUBoneTransform must be 64 bytes");
 
+/**
+ * @struct FGPUBoundaryBoneTransform
+ * @brief Compact bone transform for boundary skinning (40 bytes instead of a 64-byte matrix).
+ *
+ * @param Rotation World rotation quaternion (x, y, z, w).
+ * @param Translation Bone world position.
+ * @param Scale Non-uniform bone scale.
+ */
+struct FGPUBoundaryBoneTransform
+{
+	FVector4f Rotation;
+	FVector3f Translation;
+	FVector3f Scale;
+
+	FGPUBoundaryBoneTransform()
+		: Rotation(FVector4f(0.0f, 0.0f, 0.0f, 1.0f))
+		, Translation(FVector3f::ZeroVector)
+		, Scale(FVector3f::OneVector)
+	{
+	}
+
+	explicit FGPUBoundaryBoneTransform(const FTransform& InTransform)
+	{
+		SetFromTransform(InTransform);
+	}
+
+	void SetFromTransform(const FTransform& InTransform)
+	{
+		const FQuat Q = InTransform.GetRotation();
+		Rotation = FVector4f(Q.X, Q.Y, Q.Z, Q.W);
+		Translation = FVector3f(InTransform.GetLocation());
+		Scale = FVector3f(InTransform.GetScale3D());
+	}
+
+	/** Row-major matrix with scale, the same one the skinning shaders rebuild */
+	FMatrix44f ToMatrix() const
+	{
+		const FTransform3f Transform(FQuat4f(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W), Translation, Scale);
+		return Transform.ToMatrixWithScale();
+	}
+
+	/**
+	 * @brief Whether two bone transforms match within tolerance.
+	 * @param Other Transform to compare with.
+	 * @param PositionTolerance Max translation difference per axis (cm).
+	 * @param RotationTolerance Max quaternion and scale component difference.
+	 * @return True if equal within tolerance.
+	 */
+	bool Equals(const FGPUBoundaryBoneTransform& Other, float PositionTolerance, float RotationTolerance) const
+	{
+		return Translation.Equals(Other.Translation, PositionTolerance)
+			&& Rotation.Equals(Other.Rotation, RotationTolerance)
+			&& Scale.Equals(Other.Scale, RotationTolerance);
+	}
+};
+static_assert(sizeof(FGPUBoundaryBoneTransform) == 40, "FGPUBoundaryBoneTransform must be 40 bytes");
+
 /**
  * @struct FGPUParticleAttachment
  * @brief GPU Particle Attachment data managed as a separate buffer.
@@ -1440,7 +1497,7 @@ struct FCompactParticleStats
 	int32 SourceID;
 	uint32 NeighborCount;
 	uint32 Flags;
-	float Padding;
+	float Speed;
 
 	FCompactParticleStats()
 		: Position(FVector3f::ZeroVector)
@@ -1448,7 +1505,7 @@ struct FCompactParticleStats
 		, SourceID(-1)
 		, NeighborCount(0)
 		, Flags(0)
-		, Padding(0.0f)
+		, Speed(0.0f)
 	{
 	}
 };
@@ -0,0 +1,134 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Field-selective packed readback format (consumer field masks, stream layout, CPU unpackers)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGPUFluidParticle;
+struct FGPUFluidReadbackSnapshot;
+
+/**
+ * Readback field bits
+ * Low bits select fields; the Accept* bits tell the packer a consumer tolerates reduced precision.
+ */
+namespace EGPUReadbackField
+{
+	constexpr uint32 None = 0;
+	constexpr uint32 Position = 1 << 0;        // float3, or unorm16x3 relative to simulation bounds
+	constexpr uint32 Velocity = 1 << 1;        // float3, or half3
+	constexpr uint32 Speed = 1 << 2;           // float |Velocity| (CFL feedback)
+	constexpr uint32 ParticleID = 1 << 3;      // int32
+	constexpr uint32 SourceID = 1 << 4;        // int32
+	constexpr uint32 Flags = 1 << 5;           // uint32 (EGPUParticleFlags)
+	constexpr uint32 NeighborCount = 1 << 6;   // uint32
+	constexpr uint32 AllFields = (1 << 7) - 1;
+
+	constexpr uint32 AcceptQuantizedPosition = 1 << 16;  // 16-bit positions are precise enough for this consumer
+	constexpr uint32 AcceptHalfVelocity = 1 << 17;       // half velocities are precise enough for this consumer
+}
+
+/**
+ * Readback consumer slots; each registers the fields it reads from ProcessStatsReadback snapshots
+ */
+namespace EGPUReadbackConsumer
+{
+	constexpr int32 Shadow = 0;       // Volume ISM shadows / splash VFX (positions, velocities, neighbor counts)
+	constexpr int32 DebugDraw = 1;    // Volume point debug draw (positions, IDs, flags)
+	constexpr int32 Proxy = 2;        // Proxy ISM renderer (positions, velocities)
+	constexpr int32 Query = 3;        // World particle queries (positions, velocities, source IDs)
+	constexpr int32 MaxVelocity = 4;  // CFL adaptive substeps (speed)
+	constexpr int32 EditorSleep = 5;  // Volume editor brush settle detection (speed)
+	constexpr int32 Custom = 6;       // Game code
+	constexpr int32 Count = 7;
+}
+
+/**
+ * @struct FGPUReadbackLayout
+ * @brief Byte layout of one packed readback: one tightly packed stream per requested field.
+ *
+ * Streams are AoS within a field (so full-precision streams memcpy straight into snapshot arrays)
+ * and 16-byte aligned. 16-bit streams are written per particle pair (12 bytes), so their size rounds
+ * the particle count up to even.
+ *
+ * @param Fields EGPUReadbackField field bits present in the buffer.
+ * @param bQuantizedPositions Position stream is unorm16x3 relative to QuantizeMin/QuantizeExtent.
+ * @param bHalfVelocities Velocity stream is half3.
+ * @param QuantizeMin Lower corner of the quantization box.
+ * @param QuantizeExtent Size of the quantization box (> 0 on every axis).
+ * @param Capacity Particle count the layout was sized for.
+ * @param PositionOffset Byte offset of the position stream (INDEX_NONE if absent).
+ * @param VelocityOffset Byte offset of the velocity stream.
+ * @param SpeedOffset Byte offset of the speed stream.
+ * @param ParticleIDOffset Byte offset of the particle ID stream.
+ * @param SourceIDOffset Byte offset of the source ID stream.
+ * @param FlagsOffset Byte offset of the flags stream.
+ * @param NeighborCountOffset Byte offset of the neighbor count stream.
+ * @param TotalBytes Buffer size in bytes.
+ */
+struct KAWAIIFLUIDRUNTIME_API FGPUReadbackLayout
+{
+	uint32 Fields = EGPUReadbackField::None;
+	bool bQuantizedPositions = false;
+	bool bHalfVelocities = false;
+	FVector3f QuantizeMin = FVector3f::ZeroVector;
+	FVector3f QuantizeExtent = FVector3f::OneVector;
+	int32 Capacity = 0;
+
+	int32 PositionOffset = INDEX_NONE;
+	int32 VelocityOffset = INDEX_NONE;
+	int32 SpeedOffset = INDEX_NONE;
+	int32 ParticleIDOffset = INDEX_NONE;
+	int32 SourceIDOffset = INDEX_NONE;
+	int32 FlagsOffset = INDEX_NONE;
+	int32 NeighborCountOffset = INDEX_NONE;
+	int32 TotalBytes = 0;
+
+	/**
+	 * Build the layout for a resolved field mask
+	 * @param FieldMask EGPUReadbackField bits; Accept* bits enable quantization of their field
+	 * @param ParticleCount Number of particles to size the streams for
+	 * @param BoundsMin Quantization box minimum (simulation bounds)
+	 * @param BoundsMax Quantization box maximum
+	 */
+	static FGPUReadbackLayout Build(uint32 FieldMask, int32 ParticleCount, const FVector3f& BoundsMin, const FVector3f& BoundsMax);
+
+	/**
+	 * Resolve consumer registrations into one mask: fields are OR-ed, a precision reduction is kept
+	 * only if every consumer that reads the field accepts it
+	 */
+	static uint32 CombineConsumerMasks(TConstArrayView<uint32> ConsumerMasks);
+
+	bool HasField(uint32 Field) const { return (Fields & Field) != 0; }
+
+	/** Bytes per particle, for bandwidth stats */
+	float GetBytesPerParticle() const { return Capacity > 0 ? static_cast<float>(TotalBytes) / Capacity : 0.0f; }
+};
+
+/**
+ * CPU side of the packed readback: SIMD unpackers plus a scalar packer mirroring PackReadbackFieldsCS
+ */
+namespace GPUFluidReadbackUnpack
+{
+	/** Dequantize unorm16x3 (AoS) into float3 positions, 8 particles per SIMD iteration */
+	KAWAIIFLUIDRUNTIME_API void UnpackUnorm16x3(const uint16* Src, int32 Count, const FVector3f& Min, const FVector3f& Extent, FVector3f* Dst);
+
+	/** Convert half3 (AoS) into float3 velocities, 8 particles per SIMD iteration */
+	KAWAIIFLUIDRUNTIME_API void UnpackHalf3(const uint16* Src, int32 Count, FVector3f* Dst);
+
+	/** Max of a float stream (SIMD) */
+	KAWAIIFLUIDRUNTIME_API float MaxFloat(const float* Src, int32 Count);
+
+	/** Max |V| of a float3 stream */
+	KAWAIIFLUIDRUNTIME_API float MaxLength(const FVector3f* Src, int32 Count);
+
+	/**
+	 * Unpack every stream of a packed readback into snapshot arrays (fields absent from the layout stay empty)
+	 * Runs in parallel over particle blocks
+	 * @return Max particle speed from the speed or velocity stream, or -1 if neither was packed
+	 */
+	KAWAIIFLUIDRUNTIME_API float UnpackReadbackFields(const FGPUReadbackLayout& Layout, const void* Data, int32 Count, FGPUFluidReadbackSnapshot& OutSnapshot);
+
+	/** Reference packer mirroring PackReadbackFieldsCS (tests and CPU fallback) */
+	KAWAIIFLUIDRUNTIME_API void PackReadbackFields(const FGPUReadbackLayout& Layout, TConstArrayView<FGPUFluidParticle> Particles, TArray<uint8>& OutData);
+}
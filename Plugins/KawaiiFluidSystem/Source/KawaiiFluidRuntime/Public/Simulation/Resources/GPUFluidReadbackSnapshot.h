@@ -0,0 +1,209 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Triple-buffered immutable readback snapshots for lock-free CPU consumers
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include <atomic>
+
+/**
+ * @struct FGPUFluidSourceIndex
+ * @brief Particles grouped by source ID in one flat array, built with a parallel counting sort.
+ *
+ * Source IDs are bounded by EGPUParticleSource::MaxSourceCount, so grouping is two linear passes
+ * (per-chunk histograms, then stable scatter) with no per-source arrays. Storage is kept across
+ * rebuilds, so a steady-state rebuild allocates nothing. Particles with an out-of-range source ID
+ * are left out of the index.
+ *
+ * @param Offsets Start of each source's range in SortedIndices (NumSources + 1 entries).
+ * @param SortedIndices Particle array indices grouped by source, ascending within a source.
+ * @param SortedParticleIDs Particle IDs in SortedIndices order (empty if built without IDs).
+ * @param ChunkCounts Per-chunk histogram scratch, reused across builds.
+ */
+struct KAWAIIFLUIDRUNTIME_API FGPUFluidSourceIndex
+{
+	static constexpr int32 NumSources = EGPUParticleSource::MaxSourceCount;
+
+	TArray<int32> Offsets;
+	TArray<int32> SortedIndices;
+	TArray<int32> SortedParticleIDs;
+	TArray<int32> ChunkCounts;
+
+	/**
+	 * Rebuild the index
+	 * @param SourceIDs Source ID per particle
+	 * @param ParticleIDs Particle ID per particle (same length as SourceIDs), or empty to skip SortedParticleIDs
+	 */
+	void Build(TConstArrayView<int32> SourceIDs, TConstArrayView<int32> ParticleIDs);
+
+	/** Empty the index but keep its allocations */
+	void Reset();
+
+	bool IsBuilt() const { return Offsets.Num() == NumSources + 1; }
+
+	/** Number of indexed particles of one source (0 if out of range or not built) */
+	int32 Num(int32 SourceID) const
+	{
+		return (IsBuilt() && SourceID >= 0 && SourceID < NumSources) ? Offsets[SourceID + 1] - Offsets[SourceID] : 0;
+	}
+
+	/** Particle array indices of one source */
+	TConstArrayView<int32> GetIndices(int32 SourceID) const
+	{
+		return Num(SourceID) > 0 ? TConstArrayView<int32>(SortedIndices.GetData() + Offsets[SourceID], Num(SourceID)) : TConstArrayView<int32>();
+	}
+
+	/** Particle IDs of one source (empty if built without IDs) */
+	TConstArrayView<int32> GetParticleIDs(int32 SourceID) const
+	{
+		return (Num(SourceID) > 0 && SortedParticleIDs.Num() == SortedIndices.Num())
+			? TConstArrayView<int32>(SortedParticleIDs.GetData() + Offsets[SourceID], Num(SourceID)) : TConstArrayView<int32>();
+	}
+};
+
+/**
+ * @struct FGPUFluidReadbackSnapshot
+ * @brief One published particle readback; immutable while any view references it.
+ *
+ * All per-particle arrays share the same index space. Optional arrays are empty when
+ * the corresponding readback was not requested for the frame the snapshot was taken.
+ *
+ * @param Positions Particle positions.
+ * @param Velocities Particle velocities (empty unless velocity readback was enabled and in full mode).
+ * @param SourceIDs Particle source IDs.
+ * @param ParticleIDs Particle persistent IDs.
+ * @param Flags Particle state flags.
+ * @param NeighborCounts Particle neighbor counts (empty unless shadow readback was enabled).
+ * @param SourceIndex Particles grouped by source ID (built when both ID arrays are present).
+ * @param FrameNumber Render frame the readback was enqueued on (0 = uploaded from CPU data).
+ */
+struct FGPUFluidReadbackSnapshot
+{
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Velocities;
+	TArray<int32> SourceIDs;
+	TArray<int32> ParticleIDs;
+	TArray<uint32> Flags;
+	TArray<uint32> NeighborCounts;
+	FGPUFluidSourceIndex SourceIndex;
+	uint64 FrameNumber = 0;
+
+	/** Empty every array but keep its allocation for the next fill */
+	void Reset();
+};
+
+/**
+ * @class FGPUFluidReadbackSnapshotView
+ * @brief Ref-counted read-only handle to a published snapshot.
+ *
+ * Holding a view pins its snapshot slot: the writer never refills a slot that has live views,
+ * so the arrays stay valid and unchanged until the view is destroyed. Move-only; keep views
+ * short-lived (a frame at most) so the writer always finds a free slot.
+ *
+ * @param Snapshot Pinned snapshot, nullptr for an empty view.
+ * @param RefCount Reference count of the pinned slot.
+ */
+class KAWAIIFLUIDRUNTIME_API FGPUFluidReadbackSnapshotView
+{
+public:
+	FGPUFluidReadbackSnapshotView() = default;
+	FGPUFluidReadbackSnapshotView(const FGPUFluidReadbackSnapshot* InSnapshot, std::atomic<int32>* InRefCount)
+		: Snapshot(InSnapshot), RefCount(InRefCount) {}
+	~FGPUFluidReadbackSnapshotView() { Release(); }
+
+	FGPUFluidReadbackSnapshotView(FGPUFluidReadbackSnapshotView&& Other);
+	FGPUFluidReadbackSnapshotView& operator=(FGPUFluidReadbackSnapshotView&& Other);
+	FGPUFluidReadbackSnapshotView(const FGPUFluidReadbackSnapshotView&) = delete;
+	FGPUFluidReadbackSnapshotView& operator=(const FGPUFluidReadbackSnapshotView&) = delete;
+
+	bool IsValid() const { return Snapshot != nullptr; }
+
+	/** Pinned snapshot, nullptr for an empty view */
+	const FGPUFluidReadbackSnapshot* GetSnapshot() const { return Snapshot; }
+
+	int32 Num() const { return Snapshot ? Snapshot->Positions.Num() : 0; }
+
+	uint64 GetFrameNumber() const { return Snapshot ? Snapshot->FrameNumber : 0; }
+
+	TConstArrayView<FVector3f> GetPositions() const { return Snapshot ? TConstArrayView<FVector3f>(Snapshot->Positions) : TConstArrayView<FVector3f>(); }
+
+	/** Velocities aligned with positions, or empty if velocity readback was off for this snapshot */
+	TConstArrayView<FVector3f> GetVelocities() const { return HasVelocities() ? TConstArrayView<FVector3f>(Snapshot->Velocities) : TConstArrayView<FVector3f>(); }
+
+	TConstArrayView<int32> GetSourceIDs() const { return Snapshot ? TConstArrayView<int32>(Snapshot->SourceIDs) : TConstArrayView<int32>(); }
+
+	TConstArrayView<int32> GetParticleIDs() const { return Snapshot ? TConstArrayView<int32>(Snapshot->ParticleIDs) : TConstArrayView<int32>(); }
+
+	TConstArrayView<uint32> GetFlags() const { return Snapshot ? TConstArrayView<uint32>(Snapshot->Flags) : TConstArrayView<uint32>(); }
+
+	/** Neighbor counts aligned with positions, or empty if shadow readback was off for this snapshot */
+	TConstArrayView<uint32> GetNeighborCounts() const { return HasNeighborCounts() ? TConstArrayView<uint32>(Snapshot->NeighborCounts) : TConstArrayView<uint32>(); }
+
+	/** Particle IDs of one source, empty if the source has no particles */
+	TConstArrayView<int32> GetParticleIDsBySourceID(int32 SourceID) const { return Snapshot ? Snapshot->SourceIndex.GetParticleIDs(SourceID) : TConstArrayView<int32>(); }
+
+	/** Snapshot indices (into positions, velocities, ...) of one source's particles */
+	TConstArrayView<int32> GetIndicesBySourceID(int32 SourceID) const { return Snapshot ? Snapshot->SourceIndex.GetIndices(SourceID) : TConstArrayView<int32>(); }
+
+	bool HasVelocities() const { return Snapshot && Snapshot->Positions.Num() > 0 && Snapshot->Velocities.Num() == Snapshot->Positions.Num(); }
+
+	bool HasNeighborCounts() const { return Snapshot && Snapshot->Positions.Num() > 0 && Snapshot->NeighborCounts.Num() == Snapshot->Positions.Num(); }
+
+	/** Unpin the snapshot early; the view becomes empty */
+	void Release();
+
+private:
+	const FGPUFluidReadbackSnapshot* Snapshot = nullptr;
+	std::atomic<int32>* RefCount = nullptr;
+};
+
+/**
+ * @class FGPUFluidReadbackSnapshotBuffer
+ * @brief Triple-buffered snapshot publisher: one writer fills a free slot and swaps it in atomically.
+ *
+ * Readers never block: Acquire() pins the published slot by bumping its ref count and re-checking
+ * the published index. Writers are serialized by WriteLock (readback processing on the render thread
+ * and upload-time rebuilds on the game thread) and only fill slots that are neither published nor pinned.
+ * With three slots one is published, one may still be pinned by a slow reader and one is free to fill;
+ * if readers pin both spare slots, BeginWrite() returns nullptr and the update is dropped.
+ *
+ * @param Slots Snapshot storage, reused across publishes to keep array allocations.
+ * @param RefCounts Live view count per slot.
+ * @param PublishedIndex Slot handed out by Acquire(), INDEX_NONE when nothing is published.
+ * @param WritingIndex Slot claimed by BeginWrite(), INDEX_NONE outside a write.
+ * @param WriteLock Serializes writers; never taken by readers.
+ */
+class KAWAIIFLUIDRUNTIME_API FGPUFluidReadbackSnapshotBuffer
+{
+public:
+	static constexpr int32 NumSlots = 3;
+
+	/** Pin the latest published snapshot (empty view if none) */
+	FGPUFluidReadbackSnapshotView Acquire() const;
+
+	/**
+	 * Claim a free slot for writing; the returned snapshot is Reset() with capacity kept
+	 * Must be paired with Publish() or CancelWrite(); holds WriteLock until then
+	 * @return Snapshot to fill, or nullptr if every spare slot is pinned by readers
+	 */
+	FGPUFluidReadbackSnapshot* BeginWrite();
+
+	/** Publish the slot claimed by BeginWrite() */
+	void Publish();
+
+	/** Abandon the slot claimed by BeginWrite() without publishing */
+	void CancelWrite();
+
+	/** Unpublish; new views are empty, existing views keep their snapshot */
+	void Clear();
+
+	bool HasPublished() const { return PublishedIndex.load() != INDEX_NONE; }
+
+private:
+	FGPUFluidReadbackSnapshot Slots[NumSlots];
+	mutable std::atomic<int32> RefCounts[NumSlots] = {};
+	std::atomic<int32> PublishedIndex{INDEX_NONE};
+	int32 WritingIndex = INDEX_NONE;
+	FCriticalSection WriteLock;
+};
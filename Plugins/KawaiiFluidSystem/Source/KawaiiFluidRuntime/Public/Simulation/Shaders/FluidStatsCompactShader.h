@@ -69,3 +69,53 @@ public:
 		const FGlobalShaderPermutationParameters& Parameters,
 		FShaderCompilerEnvironment& OutEnvironment);
 };
+
+/**
+ * @class FPackReadbackFieldsCS
+ * @brief Field-selective readback packer (only the streams in FGPUReadbackLayout).
+ * 
+ * Writes one stream per requested field; positions optionally as unorm16 relative to the
+ * simulation bounds and velocities optionally as half.
+ * 
+ * @param InParticles Input particles buffer.
+ * @param OutPackedFields Output byte buffer (FGPUReadbackLayout::TotalBytes).
+ * @param ParticleCountBuffer GPU-accurate particle count buffer.
+ * @param PackedCapacity Particle count the layout was sized for (write bound).
+ * @param PackedPositionOffset Byte offset of the position stream (0xFFFFFFFF = absent), likewise for the other offsets.
+ * @param bPackQuantizedPositions Non-zero to write unorm16x3 positions.
+ * @param bPackHalfVelocities Non-zero to write half3 velocities.
+ * @param QuantizeMin Quantization box minimum.
+ * @param QuantizeInvExtent Reciprocal quantization box extent.
+ */
+class FPackReadbackFieldsCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FPackReadbackFieldsCS);
+	SHADER_USE_PARAMETER_STRUCT(FPackReadbackFieldsCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUFluidParticle>, InParticles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWByteAddressBuffer, OutPackedFields)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
+		SHADER_PARAMETER(uint32, PackedCapacity)
+		SHADER_PARAMETER(uint32, PackedPositionOffset)
+		SHADER_PARAMETER(uint32, PackedVelocityOffset)
+		SHADER_PARAMETER(uint32, PackedSpeedOffset)
+		SHADER_PARAMETER(uint32, PackedParticleIDOffset)
+		SHADER_PARAMETER(uint32, PackedSourceIDOffset)
+		SHADER_PARAMETER(uint32, PackedFlagsOffset)
+		SHADER_PARAMETER(uint32, PackedNeighborCountOffset)
+		SHADER_PARAMETER(uint32, bPackQuantizedPositions)
+		SHADER_PARAMETER(uint32, bPackHalfVelocities)
+		SHADER_PARAMETER(FVector3f, QuantizeMin)
+		SHADER_PARAMETER(FVector3f, QuantizeInvExtent)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment);
+};
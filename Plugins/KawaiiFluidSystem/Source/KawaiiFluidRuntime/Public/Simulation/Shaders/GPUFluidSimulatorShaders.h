@@ -1,4 +1,4 @@
-// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+﻿// Copyright 2026 Team_Bruteforce. All Rights Reserved.
 
 #pragma once
 
@@ -791,6 +791,9 @@ public:
  * @param RenderVelocities Output render velocities buffer.
  * @param ParticleCountBuffer GPU-accurate particle count buffer.
  * @param ParticleRadius Radius for rendering.
+ * @param PreviousPositions Tick-start positions for render interpolation.
+ * @param PreviousPositionCount Particles with valid previous positions (0 = no interpolation).
+ * @param InterpolationAlpha Blend from previous (0) to latest (1) simulation tick.
  */
 class FExtractRenderDataSoACS : public FGlobalShader
 {
@@ -804,6 +807,9 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FVector3f>, RenderVelocities)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 		SHADER_PARAMETER(float, ParticleRadius)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector3f>, PreviousPositions)
+		SHADER_PARAMETER(uint32, PreviousPositionCount)
+		SHADER_PARAMETER(float, InterpolationAlpha)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static constexpr int32 ThreadGroupSize = 256;
@@ -825,6 +831,9 @@ public:
  * @param ParticleCountBuffer GPU-accurate particle count buffer.
  * @param ParticleRadius Radius for rendering.
  * @param BoundsMargin Extra margin to expand computed bounds.
+ * @param PreviousPositions Tick-start positions for render interpolation.
+ * @param PreviousPositionCount Particles with valid previous positions (0 = no interpolation).
+ * @param InterpolationAlpha Blend from previous (0) to latest (1) simulation tick.
  */
 class FExtractRenderDataWithBoundsCS : public FGlobalShader
 {
@@ -848,6 +857,62 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 		SHADER_PARAMETER(float, ParticleRadius)
 		SHADER_PARAMETER(float, BoundsMargin)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector3f>, PreviousPositions)
+		SHADER_PARAMETER(uint32, PreviousPositionCount)
+		SHADER_PARAMETER(float, InterpolationAlpha)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment);
+};
+
+/**
+ * @class FExtractRenderDataPackedCS
+ * @brief Phase 2: Extract to the quantized render format (FluidRenderPacking.ush).
+ *
+ * Runs after FExtractRenderDataWithBoundsCS and quantizes positions to the AABB it wrote.
+ * The WRITE_ANISOTROPY permutation also packs the anisotropy axes and folds the render offset into positions.
+ *
+ * @param PhysicsParticles Physics particle buffer (input).
+ * @param PackedParticles Output packed position/velocity buffer (12B per particle).
+ * @param PackedAnisotropy Output packed rotation/scale buffer (8B per particle).
+ * @param PackedBounds Particle AABB [Min, Max] used as the quantization box.
+ * @param RenderOffset Surface particle render offset.
+ * @param AnisotropyAxis1 Major axis direction and scale.
+ * @param AnisotropyAxis2 Intermediate axis direction and scale.
+ * @param AnisotropyAxis3 Minor axis direction and scale.
+ * @param ParticleCountBuffer GPU-accurate particle count buffer.
+ * @param PreviousPositions Tick-start positions for render interpolation.
+ * @param PreviousPositionCount Particles with valid previous positions (0 = no interpolation).
+ * @param InterpolationAlpha Blend from previous (0) to latest (1) simulation tick.
+ */
+class FExtractRenderDataPackedCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FExtractRenderDataPackedCS);
+	SHADER_USE_PARAMETER_STRUCT(FExtractRenderDataPackedCS, FGlobalShader);
+
+	class FWriteAnisotropyDim : SHADER_PERMUTATION_BOOL("WRITE_ANISOTROPY");
+	using FPermutationDomain = TShaderPermutationDomain<FWriteAnisotropyDim>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUFluidParticle>, PhysicsParticles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FPackedRenderParticle>, PackedParticles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FPackedAnisotropy>, PackedAnisotropy)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector3f>, PackedBounds)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector3f>, RenderOffset)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector4f>, AnisotropyAxis1)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector4f>, AnisotropyAxis2)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector4f>, AnisotropyAxis3)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector3f>, PreviousPositions)
+		SHADER_PARAMETER(uint32, PreviousPositionCount)
+		SHADER_PARAMETER(float, InterpolationAlpha)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static constexpr int32 ThreadGroupSize = 256;
@@ -939,6 +1004,160 @@ public:
 		FShaderCompilerEnvironment& OutEnvironment);
 };
 
+/**
+ * @class FSpawnFromDescriptorCS
+ * @brief Expands one procedural spawn descriptor (FKawaiiFluidSpawnPlan) into particles on the GPU.
+ * 
+ * @param SpawnRows Row table of the plan (int4 per row, sentinel excluded from NumRows).
+ * @param Particles Main particle buffer to write into.
+ * @param ParticleCounter Global atomic counter for total particles.
+ * @param SourceCounters Per-source atomic counters.
+ * @param NumRows Number of lattice rows.
+ * @param SpawnCount Number of particles in the plan.
+ * @param Shape EKawaiiFluidSpawnShape.
+ * @param Center World-space shape center.
+ * @param AxisX World direction of local X, likewise AxisY/AxisZ.
+ * @param LatticeStart Local position of lattice index zero.
+ * @param LatticeStep Lattice step per axis.
+ * @param Extent Shape extent.
+ * @param YBase Row stagger base index.
+ * @param ZBase Layer stacking base index.
+ * @param JitterRange Maximum jitter (cm).
+ * @param JitterSeed Jitter hash seed.
+ * @param SpawnVelocity Initial velocity.
+ * @param SpawnMass Particle mass (0 = DefaultMass).
+ * @param SpawnSourceID Source identification.
+ * @param SpawnOccupancy Overlap rejection grid (see FMarkSpawnOccupancyCS).
+ * @param OccupancyMin World-space minimum corner of the grid.
+ * @param OccupancyCellSize Grid cell size.
+ * @param OccupancyDim Cells per axis, 0 = no overlap rejection.
+ * @param MaxParticleCount Maximum capacity.
+ * @param FirstParticleID ID of the plan's first particle.
+ * @param MaxSourceCount Maximum number of components.
+ * @param DefaultMass Default mass if unspecified.
+ */
+class FSpawnFromDescriptorCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FSpawnFromDescriptorCS);
+	SHADER_USE_PARAMETER_STRUCT(FSpawnFromDescriptorCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<int4>, SpawnRows)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUFluidParticle>, Particles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, ParticleCounter)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SourceCounters)
+		// float3 + scalar pairs keep every vector inside one 16-byte row
+		SHADER_PARAMETER(FVector3f, Center)
+		SHADER_PARAMETER(int32, NumRows)
+		SHADER_PARAMETER(FVector3f, AxisX)
+		SHADER_PARAMETER(int32, SpawnCount)
+		SHADER_PARAMETER(FVector3f, AxisY)
+		SHADER_PARAMETER(int32, Shape)
+		SHADER_PARAMETER(FVector3f, AxisZ)
+		SHADER_PARAMETER(int32, YBase)
+		SHADER_PARAMETER(FVector3f, LatticeStart)
+		SHADER_PARAMETER(int32, ZBase)
+		SHADER_PARAMETER(FVector3f, LatticeStep)
+		SHADER_PARAMETER(float, JitterRange)
+		SHADER_PARAMETER(FVector3f, Extent)
+		SHADER_PARAMETER(uint32, JitterSeed)
+		SHADER_PARAMETER(FVector3f, SpawnVelocity)
+		SHADER_PARAMETER(float, SpawnMass)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SpawnOccupancy)
+		SHADER_PARAMETER(FVector3f, OccupancyMin)
+		SHADER_PARAMETER(float, OccupancyCellSize)
+		SHADER_PARAMETER(int32, OccupancyDim)
+		SHADER_PARAMETER(int32, SpawnSourceID)
+		SHADER_PARAMETER(int32, MaxParticleCount)
+		SHADER_PARAMETER(int32, FirstParticleID)
+		SHADER_PARAMETER(int32, MaxSourceCount)
+		SHADER_PARAMETER(float, DefaultMass)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 64;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment);
+};
+
+/**
+ * @class FMarkSpawnOccupancyCS
+ * @brief Marks the occupancy grid cells of live particles before a spawn plan that rejects overlaps.
+ * 
+ * @param Particles Main particle buffer (read only).
+ * @param ParticleCounter Global atomic counter; bounds the live range.
+ * @param SpawnOccupancy Occupancy grid, one uint per cell (cleared beforehand).
+ * @param OccupancyMin World-space minimum corner of the grid.
+ * @param OccupancyCellSize Grid cell size.
+ * @param OccupancyDim Cells per axis.
+ * @param MaxParticleCount Maximum capacity (dispatch size).
+ */
+class FMarkSpawnOccupancyCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FMarkSpawnOccupancyCS);
+	SHADER_USE_PARAMETER_STRUCT(FMarkSpawnOccupancyCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUFluidParticle>, Particles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, ParticleCounter)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SpawnOccupancy)
+		SHADER_PARAMETER(FVector3f, OccupancyMin)
+		SHADER_PARAMETER(float, OccupancyCellSize)
+		SHADER_PARAMETER(int32, OccupancyDim)
+		SHADER_PARAMETER(int32, MaxParticleCount)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment);
+};
+
+/**
+ * @class FAppendParticlesCS
+ * @brief Appends one chunk of CPU-converted particles (streaming initial upload) to the particle buffer.
+ * 
+ * @param UploadParticles Uploaded particles with IDs already allocated.
+ * @param Particles Main particle buffer to write into.
+ * @param ParticleCounter Global atomic counter for total particles.
+ * @param SourceCounters Per-source atomic counters.
+ * @param UploadCount Number of particles in the chunk.
+ * @param MaxParticleCount Maximum capacity.
+ * @param MaxSourceCount Maximum number of components.
+ */
+class FAppendParticlesCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FAppendParticlesCS);
+	SHADER_USE_PARAMETER_STRUCT(FAppendParticlesCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUFluidParticle>, UploadParticles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUFluidParticle>, Particles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, ParticleCounter)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SourceCounters)
+		SHADER_PARAMETER(int32, UploadCount)
+		SHADER_PARAMETER(int32, MaxParticleCount)
+		SHADER_PARAMETER(int32, MaxSourceCount)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 64;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment);
+};
+
 
 //=============================================================================
 // GPU-Driven Despawn Compute Shaders
@@ -1303,7 +1522,10 @@ public:
 		FRDGBufferUAVRef BoundsBufferUAV,
 		FRDGBufferSRVRef ParticleCountBufferSRV,
 		float ParticleRadius,
-		float BoundsMargin);
+		float BoundsMargin,
+		FRDGBufferSRVRef PreviousPositionsSRV = nullptr,
+		int32 PreviousPositionCount = 0,
+		float InterpolationAlpha = 1.0f);
 
 	/** Add extract render data SoA pass (Memory bandwidth optimized) */
 	static void AddExtractRenderDataSoAPass(
@@ -1313,7 +1535,30 @@ public:
 	   FRDGBufferUAVRef RenderVelocitiesUAV,
 	   FRDGBufferSRVRef ParticleCountBufferSRV,
 	   int32 MaxParticleCount,
-	   float ParticleRadius);
+	   float ParticleRadius,
+	   FRDGBufferSRVRef PreviousPositionsSRV = nullptr,
+	   int32 PreviousPositionCount = 0,
+	   float InterpolationAlpha = 1.0f);
+
+	/**
+	 * Add extract render data packed pass (quantized render format, runs after the bounds pass)
+	 * Anisotropy SRVs are all-or-nothing; without them PackedAnisotropyUAV may be null
+	 */
+	static void AddExtractRenderDataPackedPass(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferSRVRef PhysicsParticlesSRV,
+		FRDGBufferUAVRef PackedParticlesUAV,
+		FRDGBufferUAVRef PackedAnisotropyUAV,
+		FRDGBufferSRVRef BoundsBufferSRV,
+		FRDGBufferSRVRef RenderOffsetSRV,
+		FRDGBufferSRVRef AnisotropyAxis1SRV,
+		FRDGBufferSRVRef AnisotropyAxis2SRV,
+		FRDGBufferSRVRef AnisotropyAxis3SRV,
+		FRDGBufferSRVRef ParticleCountBufferSRV,
+		int32 MaxParticleCount,
+		FRDGBufferSRVRef PreviousPositionsSRV = nullptr,
+		int32 PreviousPositionCount = 0,
+		float InterpolationAlpha = 1.0f);
 
 };
 
@@ -1725,9 +1970,10 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUBoundaryParticle>, WorldBoundaryParticles)
 		// Previous frame positions for velocity calculation
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUBoundaryParticle>, PreviousWorldBoundaryParticles)
-		// Bone transforms (uploaded each frame)
-		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4x4>, BoneTransforms)
+		// Bone arena of all owners (only changed ranges are uploaded); this owner's bones start at BoneOffset
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUBoundaryBoneTransform>, BoneTransforms)
 		SHADER_PARAMETER(int32, BoundaryParticleCount)
+		SHADER_PARAMETER(int32, BoneOffset)
 		SHADER_PARAMETER(int32, BoneCount)
 		SHADER_PARAMETER(int32, OwnerID)
 		SHADER_PARAMETER(int32, bHasPreviousFrame)
@@ -2091,6 +2337,9 @@ public:
  * @param OldBoneDeltaAttachments Original attachment buffer.
  * @param SortedBoneDeltaAttachments Output sorted attachment buffer.
  * @param bReorderAttachments Whether to reorder attachment buffer.
+ * @param OldPreviousPositions Original tick-start position buffer (render interpolation).
+ * @param SortedPreviousPositions Output sorted tick-start position buffer.
+ * @param bReorderPreviousPositions Whether to reorder tick-start positions.
  * @param ParticleCount Number of particles to process.
  * @param ParticleCountBuffer GPU-accurate particle count buffer.
  */
@@ -2107,6 +2356,9 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUBoneDeltaAttachment>, OldBoneDeltaAttachments)
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUBoneDeltaAttachment>, SortedBoneDeltaAttachments)
 		SHADER_PARAMETER(int32, bReorderAttachments)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector3f>, OldPreviousPositions)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FVector3f>, SortedPreviousPositions)
+		SHADER_PARAMETER(int32, bReorderPreviousPositions)
 		SHADER_PARAMETER(int32, ParticleCount)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 	END_SHADER_PARAMETER_STRUCT()
@@ -2375,8 +2627,9 @@ public:
  * @param BoneDeltaAttachments Read-only access to attachment data.
  * @param LocalBoundaryParticles Local boundary particles for PERFECT sync.
  * @param BoundaryParticleCount Number of boundary particles.
- * @param BoneTransforms Current bone matrices.
- * @param BoneCount Number of matrices in bone buffer.
+ * @param BoneTransforms Bone arena (rotation, translation, scale per bone).
+ * @param BoneOffset First bone of the owner in the arena.
+ * @param BoneCount Number of bones of the owner.
  * @param ComponentTransform Fallback component world matrix.
  * @param DeltaTime Substep delta time.
  * @param ParticleCountBuffer GPU-accurate particle count buffer.
@@ -2393,7 +2646,8 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUBoneDeltaAttachment>, BoneDeltaAttachments)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUBoundaryParticleLocal>, LocalBoundaryParticles)
 		SHADER_PARAMETER(int32, BoundaryParticleCount)
-		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FMatrix44f>, BoneTransforms)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUBoundaryBoneTransform>, BoneTransforms)
+		SHADER_PARAMETER(int32, BoneOffset)
 		SHADER_PARAMETER(int32, BoneCount)
 		SHADER_PARAMETER(FMatrix44f, ComponentTransform)
 		SHADER_PARAMETER(float, DeltaTime)
@@ -0,0 +1,82 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FKawaiiFluidAdaptiveSubstepSettings
+ * @brief Inputs for CFL-driven substep selection.
+ *
+ * @param CFLNumber Fraction of ParticleRadius a particle may travel per substep.
+ * @param ParticleRadius Particle radius (cm) used as the CFL length scale.
+ * @param GravityMagnitude Gravity magnitude (cm/s^2), added as velocity gained over the frame.
+ * @param MaxSubsteps Upper bound on substeps per frame.
+ * @param FallbackSubstepDeltaTime Fixed substep dt used while no velocity sample is available.
+ * @param HysteresisRatio Relative CFL headroom required before the substep count may drop.
+ * @param DownshiftFrames Consecutive frames the lower count must hold before it is applied.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidAdaptiveSubstepSettings
+{
+	float CFLNumber = 0.8f;
+	float ParticleRadius = 5.0f;
+	float GravityMagnitude = 980.0f;
+	int32 MaxSubsteps = 8;
+	float FallbackSubstepDeltaTime = 1.0f / 120.0f;
+	float HysteresisRatio = 0.2f;
+	int32 DownshiftFrames = 15;
+};
+
+/**
+ * @struct FKawaiiFluidAdaptiveSubstepState
+ * @brief Per-simulation hysteresis state carried between frames.
+ *
+ * @param CurrentSubsteps Substep count chosen last frame (0 = not yet initialized).
+ * @param DownshiftCounter Consecutive frames a lower count has been acceptable.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidAdaptiveSubstepState
+{
+	int32 CurrentSubsteps = 0;
+	int32 DownshiftCounter = 0;
+
+	void Reset() { *this = FKawaiiFluidAdaptiveSubstepState(); }
+};
+
+/**
+ * @struct FKawaiiFluidSubstepDecision
+ * @brief Result of a substep selection for one frame.
+ *
+ * @param SubstepCount Number of substeps to run this frame.
+ * @param SubstepDeltaTime Time step of each substep (s).
+ * @param CFLTimeStep CFL-limited time step (s), 0 when unconstrained or unknown.
+ * @param MaxVelocity Velocity sample the decision was based on (cm/s), negative when unknown.
+ * @param bAdaptive True if the count came from the CFL path rather than the fixed scheme.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSubstepDecision
+{
+	int32 SubstepCount = 0;
+	float SubstepDeltaTime = 0.0f;
+	float CFLTimeStep = 0.0f;
+	float MaxVelocity = -1.0f;
+	bool bAdaptive = false;
+};
+
+/**
+ * @class FKawaiiFluidAdaptiveSubsteps
+ * @brief Chooses the per-frame substep count from a CFL limit with hysteresis.
+ *
+ * Increases take effect immediately (stability first); decreases require the lower
+ * count to satisfy the CFL limit with HysteresisRatio headroom for DownshiftFrames
+ * consecutive frames, which prevents oscillation around a count boundary.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidAdaptiveSubsteps
+{
+public:
+	static float ComputeCFLTimeStep(const FKawaiiFluidAdaptiveSubstepSettings& Settings, float MaxVelocity, float FrameTime);
+
+	static FKawaiiFluidSubstepDecision SelectSubsteps(
+		FKawaiiFluidAdaptiveSubstepState& State,
+		const FKawaiiFluidAdaptiveSubstepSettings& Settings,
+		float FrameTime,
+		float MaxVelocity);
+};
@@ -0,0 +1,131 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Cached shape-local spawn lattices (LRU, byte-bounded)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidSpawnDescriptor.h"
+#include "Simulation/Utils/KawaiiFluidSpawnRandom.h"
+
+/**
+ * @struct FKawaiiFluidLatticeTemplateKey
+ * @brief Identifies one shape-local lattice; center, rotation and jitter are applied per spawn.
+ *
+ * @param Shape Lattice shape.
+ * @param Extent Box half size; Sphere (R, R, R); Cylinder (R, R, HalfHeight); Disc (R, R, 0).
+ * @param Spacing Particle spacing before HCP compensation (3D shapes) or in-plane spacing (Disc).
+ */
+struct FKawaiiFluidLatticeTemplateKey
+{
+	EKawaiiFluidSpawnShape Shape = EKawaiiFluidSpawnShape::Sphere;
+	FVector3f Extent = FVector3f::ZeroVector;
+	float Spacing = 0.0f;
+
+	bool operator==(const FKawaiiFluidLatticeTemplateKey& Other) const
+	{
+		return Shape == Other.Shape && Extent == Other.Extent && Spacing == Other.Spacing;
+	}
+
+	friend uint32 GetTypeHash(const FKawaiiFluidLatticeTemplateKey& Key)
+	{
+		return HashCombineFast(HashCombineFast(GetTypeHash(static_cast<uint8>(Key.Shape)), GetTypeHash(Key.Extent)), GetTypeHash(Key.Spacing));
+	}
+};
+
+/**
+ * @struct FKawaiiFluidLatticeTemplate
+ * @brief Shape-local lattice points in SoA form, padded with zeros to a multiple of 4 for SIMD.
+ *
+ * The point order and positions match the per-point loops the *Hexagonal spawn functions of
+ * UKawaiiFluidSimulationModule have always used, so cached and uncached spawns are identical.
+ *
+ * @param Key Key the template was built for.
+ * @param NumPoints Number of lattice points (X/Y/Z may be longer due to padding).
+ * @param X Local X coordinates, likewise Y/Z.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidLatticeTemplate
+{
+	FKawaiiFluidLatticeTemplateKey Key;
+	int32 NumPoints = 0;
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+
+	/** Generate the lattice of Key (the uncached path) */
+	static TSharedRef<const FKawaiiFluidLatticeTemplate, ESPMode::ThreadSafe> Build(const FKawaiiFluidLatticeTemplateKey& InKey);
+
+	int32 Num() const { return NumPoints; }
+
+	SIZE_T GetAllocatedSize() const { return X.GetAllocatedSize() + Y.GetAllocatedSize() + Z.GetAllocatedSize(); }
+
+	/**
+	 * Transform every point to world space (4 points per SIMD step) and append one request per point.
+	 * Jitter is uniform in [-JitterRange, JitterRange) per local axis, drawn from Random at the point
+	 * index. Points whose jittered local XY leaves ClipRadiusXY are dropped (negative = keep all),
+	 * matching the stream hex layer.
+	 * @return Number of appended requests
+	 */
+	int32 AppendSpawnRequests(const FVector3f& Origin, const FVector3f& AxisX, const FVector3f& AxisY, const FVector3f& AxisZ,
+	                          const FVector3f& JitterRange, const FKawaiiFluidSpawnRandom& Random, float ClipRadiusXY,
+	                          const FGPUSpawnRequest& Prototype, TArray<FGPUSpawnRequest>& OutRequests) const;
+};
+
+using FKawaiiFluidLatticeTemplateRef = TSharedRef<const FKawaiiFluidLatticeTemplate, ESPMode::ThreadSafe>;
+
+/**
+ * @class FKawaiiFluidLatticeTemplateCache
+ * @brief Process-wide LRU cache of lattice templates, bounded by entry count and by bytes.
+ *
+ * Repeated fills and stream layers with unchanged shape, size and spacing reuse the cached points
+ * instead of regenerating the lattice. Templates are immutable and shared, so eviction never
+ * invalidates a template a caller is still transforming. Thread-safe.
+ *
+ * @param Templates LRU map from key to template.
+ * @param CachedBytes Sum of GetAllocatedSize() over cached templates.
+ * @param Hits Lookups served from the cache, likewise Misses and Evictions.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidLatticeTemplateCache
+{
+public:
+	/** Maximum number of cached templates */
+	static constexpr int32 MaxTemplates = 64;
+
+	explicit FKawaiiFluidLatticeTemplateCache(int64 InMaxBytes = 0);
+
+	/** Shared cache; its byte budget follows r.Fluid.LatticeTemplateCacheKB */
+	static FKawaiiFluidLatticeTemplateCache& Get();
+
+	/** Cached template of Key, built and inserted on a miss */
+	FKawaiiFluidLatticeTemplateRef FindOrBuild(const FKawaiiFluidLatticeTemplateKey& Key);
+
+	/** Byte budget, 0 = use r.Fluid.LatticeTemplateCacheKB */
+	void SetMaxBytes(int64 InMaxBytes);
+
+	void Empty();
+
+	int32 Num() const;
+
+	int64 GetCachedBytes() const;
+
+	uint64 GetHits() const { return Hits; }
+
+	uint64 GetMisses() const { return Misses; }
+
+	uint64 GetEvictions() const { return Evictions; }
+
+private:
+	int64 GetMaxBytes() const;
+
+	/** Evict least recently used templates until Incoming more bytes and one more entry fit */
+	void EvictFor(int64 IncomingBytes);
+
+	mutable FCriticalSection Lock;
+	TLruCache<FKawaiiFluidLatticeTemplateKey, TSharedPtr<const FKawaiiFluidLatticeTemplate, ESPMode::ThreadSafe>> Templates;
+	int64 MaxBytes = 0;
+	int64 CachedBytes = 0;
+	uint64 Hits = 0;
+	uint64 Misses = 0;
+	uint64 Evictions = 0;
+};
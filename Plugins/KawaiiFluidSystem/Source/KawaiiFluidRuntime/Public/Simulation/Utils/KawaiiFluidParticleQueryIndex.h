@@ -0,0 +1,174 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
+
+/**
+ * @struct FKawaiiFluidSphereQuery
+ * @brief One sphere overlap query of a batch.
+ *
+ * @param Center World-space sphere center.
+ * @param Radius Sphere radius (cm).
+ */
+struct FKawaiiFluidSphereQuery
+{
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.0f;
+};
+
+/**
+ * @struct FKawaiiFluidRayQuery
+ * @brief One segment query of a batch; particles are treated as spheres of HitRadius.
+ *
+ * @param Start Segment start.
+ * @param End Segment end.
+ * @param HitRadius Particle sphere radius used for hit testing (cm).
+ */
+struct FKawaiiFluidRayQuery
+{
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	float HitRadius = 0.0f;
+};
+
+/**
+ * @struct FKawaiiFluidNearestQuery
+ * @brief One nearest-K query of a batch.
+ *
+ * @param Location World-space query point.
+ * @param Count Maximum number of particles to return (K).
+ * @param MaxDistance Search radius limit (cm), <= 0 for unlimited.
+ */
+struct FKawaiiFluidNearestQuery
+{
+	FVector Location = FVector::ZeroVector;
+	int32 Count = 1;
+	float MaxDistance = 0.0f;
+};
+
+/**
+ * @struct FKawaiiFluidRayQueryHit
+ * @brief First particle hit along a segment.
+ *
+ * @param Index Index of the hit particle in the query index, INDEX_NONE on miss.
+ * @param Distance Distance from the segment start to the sphere entry point (cm).
+ */
+struct FKawaiiFluidRayQueryHit
+{
+	int32 Index = INDEX_NONE;
+	float Distance = 0.0f;
+
+	bool IsValidHit() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * @class FKawaiiFluidParticleQueryIndex
+ * @brief Read-only sparse uniform grid over a particle snapshot for gameplay queries.
+ *
+ * Particles are appended from any number of sources (GPU readback caches, CPU particle arrays),
+ * then Build() counting-sorts them into a sparse hashed grid, so stray splash particles far from
+ * the pool do not coarsen the cells. Query results are indices into the sorted snapshot, valid
+ * until the next Reset(); use GetPosition/GetVelocity/GetSourceID or GetRecords to resolve them.
+ * All queries are const and safe to run concurrently; the batched variants run their queries in parallel.
+ *
+ * @param StagingPositions Positions appended since the last Reset.
+ * @param StagingVelocities Velocities appended since the last Reset.
+ * @param StagingSourceIDs Source IDs appended since the last Reset.
+ * @param Positions Positions sorted by cell.
+ * @param Velocities Velocities sorted by cell.
+ * @param SourceIDs Source IDs sorted by cell.
+ * @param CellStarts Start offset of each occupied cell (NumCells + 1 entries).
+ * @param CellCoords Coordinate of each occupied cell.
+ * @param HashKeys Open-addressing table of packed cell coordinates.
+ * @param HashCells Occupied cell index per hash slot (INDEX_NONE = empty).
+ * @param CellBoundsMin Smallest occupied cell coordinate.
+ * @param CellBoundsMax Largest occupied cell coordinate.
+ * @param CellSize Grid cell edge length (cm).
+ * @param InvCellSize Reciprocal of CellSize.
+ * @param bBuilt True once Build() has run on the current snapshot.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticleQueryIndex
+{
+public:
+	void Reset();
+
+	void AddParticles(TConstArrayView<FVector3f> InPositions, TConstArrayView<FVector3f> InVelocities, TConstArrayView<int32> InSourceIDs);
+
+	void AddParticle(const FVector& Position, const FVector& Velocity, int32 SourceID);
+
+	void Build(float InCellSize);
+
+	bool IsBuilt() const { return bBuilt; }
+
+	int32 Num() const { return Positions.Num(); }
+
+	float GetCellSize() const { return CellSize; }
+
+	//========================================
+	// Single Queries (append to OutIndices)
+	//========================================
+
+	int32 QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutIndices) const;
+
+	int32 QueryBox(const FBox& Box, TArray<int32>& OutIndices) const;
+
+	FKawaiiFluidRayQueryHit Raycast(const FVector& Start, const FVector& End, float HitRadius) const;
+
+	int32 QueryNearest(const FVector& Location, int32 Count, float MaxDistance, TArray<int32>& OutIndices) const;
+
+	//========================================
+	// Batched Queries
+	//========================================
+
+	void QuerySpheres(TConstArrayView<FKawaiiFluidSphereQuery> Queries, TArray<int32>& OutIndices, TArray<int32>& OutOffsets) const;
+
+	void QueryBoxes(TConstArrayView<FBox> Queries, TArray<int32>& OutIndices, TArray<int32>& OutOffsets) const;
+
+	void Raycasts(TConstArrayView<FKawaiiFluidRayQuery> Queries, TArray<FKawaiiFluidRayQueryHit>& OutHits) const;
+
+	void QueryNearestBatch(TConstArrayView<FKawaiiFluidNearestQuery> Queries, TArray<int32>& OutIndices, TArray<int32>& OutOffsets) const;
+
+	//========================================
+	// Result Access
+	//========================================
+
+	FVector GetPosition(int32 Index) const { return FVector(Positions[Index]); }
+
+	FVector GetVelocity(int32 Index) const { return FVector(Velocities[Index]); }
+
+	int32 GetSourceID(int32 Index) const { return SourceIDs[Index]; }
+
+	FKawaiiFluidParticleRecord GetRecord(int32 Index) const;
+
+	void GetRecords(TConstArrayView<int32> Indices, TArray<FKawaiiFluidParticleRecord>& OutRecords) const;
+
+private:
+	TArray<FVector3f> StagingPositions;
+	TArray<FVector3f> StagingVelocities;
+	TArray<int32> StagingSourceIDs;
+
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Velocities;
+	TArray<int32> SourceIDs;
+	TArray<int32> CellStarts;
+	TArray<FIntVector> CellCoords;
+	TArray<uint64> HashKeys;
+	TArray<int32> HashCells;
+
+	FIntVector CellBoundsMin = FIntVector::ZeroValue;
+	FIntVector CellBoundsMax = FIntVector::ZeroValue;
+	float CellSize = 0.0f;
+	float InvCellSize = 0.0f;
+	bool bBuilt = false;
+
+	FIntVector ToCell(const FVector3f& Location) const;
+
+	int32 FindCell(const FIntVector& Cell) const;
+
+	bool ClampCellRange(const FVector& Min, const FVector& Max, FIntVector& OutMin, FIntVector& OutMax) const;
+
+	template <typename FunctorType>
+	void ForEachCellInRange(const FIntVector& MinCell, const FIntVector& MaxCell, FunctorType&& Functor) const;
+};
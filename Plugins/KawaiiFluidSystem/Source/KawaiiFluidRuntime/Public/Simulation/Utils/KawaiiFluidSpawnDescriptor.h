@@ -0,0 +1,179 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Procedural spawn descriptors (CPU mirror of FluidSpawnDescriptor.usf)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+
+/** Lattice shape of a spawn descriptor */
+enum class EKawaiiFluidSpawnShape : uint8
+{
+	/** HCP lattice inside a sphere (Extent.X = radius) */
+	Sphere,
+
+	/** HCP lattice inside a box (Extent = half size) */
+	Box,
+
+	/** HCP lattice inside a cylinder along local Z (Extent.X = radius, Extent.Z = half height) */
+	Cylinder,
+
+	/** Single hexagonal layer inside a disc in the local XY plane (Extent.X = radius) */
+	Disc,
+
+	/** MaxCount random samples in a hemispherical shell above local XY (Extent.X = outer, Extent.Y = inner radius) */
+	Hemisphere
+};
+
+/**
+ * @struct FKawaiiFluidSpawnDescriptor
+ * @brief One procedural spawn queued as a single record instead of one request per particle.
+ *
+ * @param Shape Lattice shape.
+ * @param Center World-space shape center.
+ * @param Rotation Shape orientation (local axes onto world axes).
+ * @param Extent Shape size, see EKawaiiFluidSpawnShape.
+ * @param Spacing Particle spacing before HCP compensation (3D shapes) or row spacing (Disc).
+ * @param JitterRange Maximum jitter offset (cm), scaled down toward the surface; 0 disables jitter.
+ * @param JitterSeed Seed of the counter-based jitter hash (the sample hash for Hemisphere).
+ * @param Velocity Initial velocity of every particle.
+ * @param Mass Particle mass, 0 = simulator default.
+ * @param MaxCount Particle limit in lattice order, 0 = unlimited.
+ * @param SourceID Source identification of the spawned particles.
+ * @param MinSeparation GPU expansion only: drop particles landing in an occupied cell of this size, 0 = off.
+ */
+struct FKawaiiFluidSpawnDescriptor
+{
+	EKawaiiFluidSpawnShape Shape = EKawaiiFluidSpawnShape::Sphere;
+	FVector Center = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Extent = FVector::ZeroVector;
+	float Spacing = 0.0f;
+	float JitterRange = 0.0f;
+	uint32 JitterSeed = 0;
+	FVector3f Velocity = FVector3f::ZeroVector;
+	float Mass = 0.0f;
+	int32 MaxCount = 0;
+	int32 SourceID = EGPUParticleSource::InvalidSourceID;
+	float MinSeparation = 0.0f;
+};
+
+/**
+ * @struct FKawaiiFluidSpawnRow
+ * @brief Contiguous run of lattice points along local X (matches the int4 rows of FluidSpawnDescriptor.usf).
+ *
+ * @param FirstX Lattice X index of the first point.
+ * @param Y Lattice Y index.
+ * @param Z Lattice Z index.
+ * @param Offset Index of the first point within the plan; the next row's Offset ends this row.
+ */
+struct FKawaiiFluidSpawnRow
+{
+	int32 FirstX = 0;
+	int32 Y = 0;
+	int32 Z = 0;
+	int32 Offset = 0;
+};
+
+static_assert(sizeof(FKawaiiFluidSpawnRow) == 16, "FKawaiiFluidSpawnRow must match the int4 HLSL row.");
+
+/**
+ * @class FKawaiiFluidSpawnPlan
+ * @brief Row table of a spawn descriptor; particle i is a pure function of the plan and i.
+ *
+ * Build() walks the lattice rows once and finds each row's inside range analytically (O(rows), not
+ * O(particles)), so the exact count is known on the game thread in microseconds. Positions are only
+ * produced on expansion: by FSpawnFromDescriptorCS on the GPU, or by Expand() in parallel on the CPU.
+ * Both use the same lattice and jitter hash, so the result does not depend on thread scheduling.
+ * Hemisphere plans are a single row of MaxCount hashed samples instead of a lattice.
+ *
+ * @param Descriptor Source descriptor.
+ * @param Rows Non-empty rows in lattice order, plus a sentinel row whose Offset is the total count.
+ * @param Start Local position of lattice index (0, 0, 0) before row/layer offsets.
+ * @param Step Lattice step along X (spacing), Y (row spacing) and Z (layer spacing).
+ * @param AxisX World direction of local X, likewise AxisY/AxisZ.
+ * @param YBase Y index of the even row of the stagger pattern.
+ * @param ZBase Z index of the first layer of the ABC stacking pattern.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSpawnPlan
+{
+public:
+	/** Build the row table (clears any previous plan) */
+	void Build(const FKawaiiFluidSpawnDescriptor& InDescriptor);
+
+	int32 Num() const { return Rows.Num() > 0 ? Rows.Last().Offset : 0; }
+
+	bool IsEmpty() const { return Num() == 0; }
+
+	/** Rows including the trailing sentinel (uploaded as-is to the GPU kernel) */
+	TConstArrayView<FKawaiiFluidSpawnRow> GetRows() const { return Rows; }
+
+	const FKawaiiFluidSpawnDescriptor& GetDescriptor() const { return Descriptor; }
+
+	const FVector3f& GetStart() const { return Start; }
+
+	const FVector3f& GetStep() const { return Step; }
+
+	const FVector3f& GetAxisX() const { return AxisX; }
+
+	const FVector3f& GetAxisY() const { return AxisY; }
+
+	const FVector3f& GetAxisZ() const { return AxisZ; }
+
+	int32 GetYBase() const { return YBase; }
+
+	int32 GetZBase() const { return ZBase; }
+
+	/** World position of particle Index (jitter included) */
+	FVector3f GetPosition(int32 Index) const;
+
+	/** Write every particle as a spawn request (OutRequests.Num() must equal Num()), in parallel */
+	void Expand(TArrayView<FGPUSpawnRequest> OutRequests) const;
+
+	/** Cells per axis of the overlap rejection grid */
+	static constexpr int32 MaxOccupancyDim = 64;
+
+	/**
+	 * Cubic occupancy grid around the shape used to reject overlaps (MinSeparation > 0)
+	 * @return False if the plan does not reject overlaps
+	 */
+	bool GetOccupancyGrid(FVector3f& OutMin, float& OutCellSize, int32& OutDim) const;
+
+private:
+	FVector3f GetLocalPosition(int32 X, int32 Y, int32 Z) const;
+
+	bool IsInside(const FVector3f& Local) const;
+
+	FVector3f GetWorldPosition(const FVector3f& Local, int32 X, int32 Y, int32 Z) const;
+
+	FKawaiiFluidSpawnDescriptor Descriptor;
+	TArray<FKawaiiFluidSpawnRow> Rows;
+	FVector3f Start = FVector3f::ZeroVector;
+	FVector3f Step = FVector3f::ZeroVector;
+	FVector3f AxisX = FVector3f(1.0f, 0.0f, 0.0f);
+	FVector3f AxisY = FVector3f(0.0f, 1.0f, 0.0f);
+	FVector3f AxisZ = FVector3f(0.0f, 0.0f, 1.0f);
+	int32 YBase = 0;
+	int32 ZBase = 0;
+};
+
+/**
+ * Lattice helpers shared by FKawaiiFluidSpawnPlan and FluidSpawnDescriptor.usf
+ */
+namespace KawaiiFluidSpawnLattice
+{
+	/** Density compensation of the HCP lattice relative to a cubic one (3D shapes only) */
+	constexpr float HCPCompensation = 1.122f;
+
+	/** Counter-based hash (PCG3D) of a lattice point and seed; three independent 32-bit outputs */
+	KAWAIIFLUIDRUNTIME_API FUintVector3 Hash(int32 X, int32 Y, int32 Z, uint32 Seed);
+
+	/** Hash output mapped to [-1, 1) with 24-bit resolution */
+	KAWAIIFLUIDRUNTIME_API float ToSignedUnit(uint32 Value);
+
+	/** Descriptor for a disc layer facing Normal, with the in-plane axes the stream emitter has always used */
+	KAWAIIFLUIDRUNTIME_API FQuat MakeDiscRotation(const FVector& Normal);
+
+	/** Rotation whose local Z is Normal (Hemisphere descriptors) */
+	KAWAIIFLUIDRUNTIME_API FQuat MakeHemisphereRotation(const FVector& Normal);
+}
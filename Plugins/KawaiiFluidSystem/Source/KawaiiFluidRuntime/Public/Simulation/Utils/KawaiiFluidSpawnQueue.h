@@ -0,0 +1,128 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include <atomic>
+
+/**
+ * @class FKawaiiFluidSpawnQueue
+ * @brief Lock-free multi-producer / single-consumer queue of spawn requests built from per-producer chunks.
+ *
+ * Each producer thread claims a slot on first use (keyed by thread ID) and appends into its own chain of
+ * fixed-size chunks, publishing progress with a release store of the chunk's committed count. Producers
+ * never share a cache line, take a lock or touch a shared counter, so emitters, brushes and gameplay code
+ * on different threads do not contend. The consumer walks every claimed slot and copies the committed
+ * ranges out; fully read chunks go back to their producer through a single-pointer handoff, so steady-state
+ * enqueues do not allocate. Requests keep their order per producer, not across producers.
+ * Threads beyond MaxProducers fall back to pushing standalone chunks onto a shared lock-free list.
+ *
+ * Consumer-side calls (DrainTo, Discard) must not run concurrently with each other; callers serialize them.
+ * The queue must outlive its producers.
+ *
+ * @param Slots Per-producer chunk chains.
+ * @param OverflowChunks Standalone chunks from producers that found no free slot (Treiber stack).
+ * @param OverflowEnqueued Requests pushed through the overflow list.
+ * @param OverflowDequeued Overflow requests consumed.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSpawnQueue
+{
+public:
+	/** Requests per chunk (48 KB) */
+	static constexpr int32 ChunkCapacity = 1024;
+
+	/** Producer slots; further threads use the overflow list */
+	static constexpr int32 MaxProducers = 64;
+
+	FKawaiiFluidSpawnQueue();
+	~FKawaiiFluidSpawnQueue();
+
+	FKawaiiFluidSpawnQueue(const FKawaiiFluidSpawnQueue&) = delete;
+	FKawaiiFluidSpawnQueue& operator=(const FKawaiiFluidSpawnQueue&) = delete;
+
+	//=========================================================================
+	// Producer API (any thread, lock-free)
+	//=========================================================================
+
+	void Enqueue(const FGPUSpawnRequest& Request);
+
+	void Enqueue(TConstArrayView<FGPUSpawnRequest> Requests);
+
+	//=========================================================================
+	// Consumer API (one thread at a time)
+	//=========================================================================
+
+	/**
+	 * Move every committed request to the end of OutRequests
+	 * @return Number of requests appended
+	 */
+	int32 DrainTo(TArray<FGPUSpawnRequest>& OutRequests);
+
+	/**
+	 * Drop every committed request
+	 * @return Number of requests dropped
+	 */
+	int32 Discard();
+
+	//=========================================================================
+	// Queries (any thread; approximate while producers are active)
+	//=========================================================================
+
+	int32 Num() const;
+
+	bool IsEmpty() const { return Num() == 0; }
+
+	int32 GetNumProducers() const;
+
+private:
+	struct FChunk
+	{
+		FGPUSpawnRequest Requests[ChunkCapacity];
+		std::atomic<int32> Committed{0};
+		std::atomic<FChunk*> Next{nullptr};
+	};
+
+	/** Producer-written and consumer-written fields live on separate cache lines */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FProducerSlot
+	{
+		// Thread ID + 1 of the owning producer, 0 while unclaimed
+		std::atomic<uint64> OwnerKey{0};
+
+		// First chunk, published by the producer when it claims the slot
+		std::atomic<FChunk*> FirstChunk{nullptr};
+
+		// Producer side
+		FChunk* Tail = nullptr;
+		FChunk* FreeChunks = nullptr;
+		std::atomic<int64> Enqueued{0};
+
+		// Consumer -> producer handoff of recycled chunks (only stored into while null)
+		std::atomic<FChunk*> ReturnedChunks{nullptr};
+
+		// Consumer side
+		alignas(PLATFORM_CACHE_LINE_SIZE) FChunk* Head = nullptr;
+		int32 ReadIndex = 0;
+		FChunk* RetiredChunks = nullptr;
+		std::atomic<int64> Dequeued{0};
+	};
+
+	FProducerSlot* FindOrClaimSlot();
+
+	void AppendToSlot(FProducerSlot& Slot, const FGPUSpawnRequest* Requests, int32 Count);
+
+	void AppendToOverflow(const FGPUSpawnRequest* Requests, int32 Count);
+
+	static FChunk* AcquireChunk(FProducerSlot& Slot);
+
+	template <typename ConsumeFn>
+	int32 ConsumeAll(ConsumeFn&& Consume);
+
+	static void DeleteChain(FChunk* Chunk);
+
+	FProducerSlot Slots[MaxProducers];
+
+	std::atomic<FChunk*> OverflowChunks{nullptr};
+	std::atomic<int64> OverflowEnqueued{0};
+	std::atomic<int64> OverflowDequeued{0};
+};
@@ -0,0 +1,90 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Seeded, counter-based random numbers for particle spawning
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/Utils/KawaiiFluidSpawnDescriptor.h"
+
+/**
+ * @struct FKawaiiFluidSpawnRandom
+ * @brief Stateless spawn RNG: every value is a pure function of (Seed, Stream, Index).
+ *
+ * Uses the PCG3D hash that FKawaiiFluidSpawnPlan and FluidSpawnRandom.ush share, so a spawn source
+ * gets the same particles on the CPU and GPU paths, for any thread count and evaluation order.
+ * A source owns the seed and advances Stream once per spawn call; Index is the particle or lattice
+ * point within that call.
+ *
+ * @param Seed Per-source seed (see MakeSeed).
+ * @param Stream Spawn call counter of the source.
+ */
+struct FKawaiiFluidSpawnRandom
+{
+	uint32 Seed = 0;
+	uint32 Stream = 0;
+
+	FKawaiiFluidSpawnRandom() = default;
+
+	FKawaiiFluidSpawnRandom(uint32 InSeed, uint32 InStream)
+		: Seed(InSeed)
+		, Stream(InStream)
+	{
+	}
+
+	/** Per-source seed from a user seed and the source ID */
+	static uint32 MakeSeed(int32 UserSeed, int32 SourceID)
+	{
+		return HashCombineFast(GetTypeHash(UserSeed), GetTypeHash(SourceID));
+	}
+
+	/** Single 32-bit seed for this stream, e.g. FKawaiiFluidSpawnDescriptor::JitterSeed */
+	uint32 GetStreamSeed() const
+	{
+		return KawaiiFluidSpawnLattice::Hash(0, static_cast<int32>(Stream), -1, Seed).X;
+	}
+
+	/** Three independent 32-bit words for Index */
+	FUintVector3 Hash(uint32 Index) const
+	{
+		return KawaiiFluidSpawnLattice::Hash(static_cast<int32>(Index), static_cast<int32>(Stream), 0, Seed);
+	}
+
+	/** Three values in [0, 1) for Index */
+	FVector3f Unit(uint32 Index) const
+	{
+		const FUintVector3 Words = Hash(Index);
+		return FVector3f(ToUnit(Words.X), ToUnit(Words.Y), ToUnit(Words.Z));
+	}
+
+	/** Three values in [-1, 1) for Index */
+	FVector3f SignedUnit(uint32 Index) const
+	{
+		const FUintVector3 Words = Hash(Index);
+		return FVector3f(
+			KawaiiFluidSpawnLattice::ToSignedUnit(Words.X),
+			KawaiiFluidSpawnLattice::ToSignedUnit(Words.Y),
+			KawaiiFluidSpawnLattice::ToSignedUnit(Words.Z));
+	}
+
+	/** Uniform offset in [-Range, Range) per axis */
+	FVector3f Jitter(uint32 Index, const FVector3f& Range) const
+	{
+		return SignedUnit(Index) * Range;
+	}
+
+	/** Hash word mapped to [0, 1) with 24-bit resolution */
+	static float ToUnit(uint32 Value)
+	{
+		return static_cast<float>(Value >> 8) * (1.0f / 16777216.0f);
+	}
+
+	/** Uniformly distributed direction from two values in [0, 1) */
+	static FVector3f ToUnitVector(float U, float V)
+	{
+		const float CosTheta = 1.0f - 2.0f * U;
+		const float SinTheta = FMath::Sqrt(FMath::Max(0.0f, 1.0f - CosTheta * CosTheta));
+		float SinPhi, CosPhi;
+		FMath::SinCos(&SinPhi, &CosPhi, 2.0f * PI * V);
+		return FVector3f(SinTheta * CosPhi, SinTheta * SinPhi, CosTheta);
+	}
+};
@@ -0,0 +1,99 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tests/KawaiiFluidPresetEvaluator.h"
+
+class UKawaiiFluidPresetDataAsset;
+
+/**
+ * @struct FKawaiiFluidPresetCostModel
+ * @brief Linear model of the CPU solver cost of a preset, calibrated from the evaluator's canonical scene.
+ *
+ * Per particle and substep: Base + PerNeighbor * Neighbors + PerNeighborIteration * Neighbors * SolverIterations.
+ * Neighbor search, viscosity and cohesion scale with the neighbor count; the density solve also with the iterations.
+ * Predictions use the preset's EstimatedNeighborCount and the substeps a frame runs at the given frame rate.
+ *
+ * @param BaseMs Cost of the neighbor-independent stages per particle-substep (ms).
+ * @param PerNeighborMs Cost of neighbor search, viscosity and cohesion per particle-substep and neighbor (ms).
+ * @param PerNeighborIterationMs Cost of one density iteration per particle-substep and neighbor (ms).
+ * @param bCalibrated Coefficients were measured on this machine.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidPresetCostModel
+{
+	double BaseMs = 0.0;
+	double PerNeighborMs = 0.0;
+	double PerNeighborIterationMs = 0.0;
+	bool bCalibrated = false;
+
+	/** Average substeps per frame with the runtime accumulator (steady state) */
+	static float GetSubstepsPerFrame(float SubstepDeltaTime, int32 MaxSubsteps, float FrameDeltaTime);
+
+	double PredictMsPerFrame(int32 NumParticles, float Neighbors, int32 SolverIterations, float SubstepsPerFrame) const;
+
+	double PredictMsPer10kParticles(const UKawaiiFluidPresetDataAsset& Preset, float FrameDeltaTime = 1.0f / 60.0f) const;
+
+	/** Fit the coefficients from canonical scene runs of Reference at two spacings (neighbor counts) and iteration counts */
+	static FKawaiiFluidPresetCostModel Calibrate(
+		const UKawaiiFluidPresetDataAsset* Reference,
+		const FKawaiiFluidPresetEvaluationSettings& Settings);
+
+	/** Model calibrated once per session on a default preset (game thread) */
+	static const FKawaiiFluidPresetCostModel& GetSessionModel();
+
+	/** Session model if it has been calibrated already, nullptr otherwise (never runs the calibration) */
+	static const FKawaiiFluidPresetCostModel* FindSessionModel();
+};
+
+/**
+ * @struct FKawaiiFluidPresetTuningResult
+ * @brief Solver counts chosen by FKawaiiFluidPresetAutoTuner.
+ *
+ * @param bFound A candidate within budget was evaluated.
+ * @param bMeetsTarget The chosen candidate reached the target density error (otherwise it is the most accurate one tried).
+ * @param SolverIterations Recommended XPBD iterations.
+ * @param SubstepsPerFrame Recommended substeps per frame at the tuning frame rate.
+ * @param SubstepDeltaTime Substep length giving SubstepsPerFrame.
+ * @param MaxSubsteps Substep cap that allows SubstepsPerFrame (never lowered below the preset's).
+ * @param PredictedMsPer10kParticles Cost model prediction for the recommendation.
+ * @param MeasuredMsPer10kParticles Cost measured in the canonical scene.
+ * @param DensityError Mean density error measured in the canonical scene.
+ * @param Evaluations Canonical scene runs spent on the search.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidPresetTuningResult
+{
+	bool bFound = false;
+	bool bMeetsTarget = false;
+	int32 SolverIterations = 0;
+	int32 SubstepsPerFrame = 0;
+	float SubstepDeltaTime = 0.0f;
+	int32 MaxSubsteps = 0;
+	double PredictedMsPer10kParticles = 0.0;
+	double MeasuredMsPer10kParticles = 0.0;
+	float DensityError = 0.0f;
+	int32 Evaluations = 0;
+};
+
+/**
+ * @class FKawaiiFluidPresetAutoTuner
+ * @brief Searches solver iteration and substep counts that reach a target density error within a cost budget.
+ *
+ * Candidates over budget (by the cost model) are dropped; the rest are evaluated cheapest first on a transient copy
+ * of the preset, and the first one reaching the target wins. A failed candidate rules out every candidate with no
+ * more iterations and no more substeps, so few runs are needed. The preset itself is not modified.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidPresetAutoTuner
+{
+public:
+	static constexpr int32 MaxTunedIterations = 10;
+	static constexpr int32 MaxTunedSubsteps = 8;
+
+	static FKawaiiFluidPresetTuningResult Tune(
+		const UKawaiiFluidPresetDataAsset* Preset,
+		float TargetDensityError,
+		float BudgetMsPer10kParticles,
+		const FKawaiiFluidPresetCostModel& Model,
+		const FKawaiiFluidPresetEvaluationSettings& Settings = FKawaiiFluidPresetEvaluationSettings(),
+		int32 MaxEvaluations = 8);
+};
@@ -0,0 +1,218 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Tests/KawaiiFluidTestMetrics.h"
+#include "KawaiiFluidPresetEvaluator.generated.h"
+
+class UKawaiiFluidPresetDataAsset;
+
+/**
+ * @struct FKawaiiFluidPresetEvaluationSettings
+ * @brief Canonical headless scene: a block of fluid dropped into an open-top arena and simulated on the CPU solver.
+ *
+ * @param SimulatedSeconds Simulated time per preset.
+ * @param FrameDeltaTime Fixed frame step; substeps per frame follow the preset like the runtime (fixed accumulator, or
+ * CFL-driven when the preset uses adaptive substeps, fed the previous frame's max speed like the async readback).
+ * @param FillHalfExtent Half size of the initial fluid block (cm).
+ * @param DropHeight Gap between the floor and the bottom of the block (cm).
+ * @param ArenaHalfWidth Half width of the square arena floor (cm); particles are clamped to its walls.
+ * @param MaxParticles Fill limit in lattice order, keeps finely spaced presets bounded.
+ * @param SettleWindowFrames Trailing frames checked for equilibrium.
+ * @param SettleVelocity Mean speed (cm/s) below which the fluid counts as settled.
+ * @param SettleDensityVariance Variance of the mean density over the window below which density counts as stable.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidPresetEvaluationSettings
+{
+	float SimulatedSeconds = 4.0f;
+	float FrameDeltaTime = 1.0f / 60.0f;
+	FVector FillHalfExtent = FVector(30.0);
+	float DropHeight = 20.0f;
+	float ArenaHalfWidth = 100.0f;
+	int32 MaxParticles = 16384;
+	int32 SettleWindowFrames = 30;
+	float SettleVelocity = 10.0f;
+	float SettleDensityVariance = 5.0f;
+
+	/** Small block in a small arena, for automation tests and quick probes */
+	static FKawaiiFluidPresetEvaluationSettings MakeSmallScene(float InSimulatedSeconds)
+	{
+		FKawaiiFluidPresetEvaluationSettings Settings;
+		Settings.SimulatedSeconds = InSimulatedSeconds;
+		Settings.FillHalfExtent = FVector(20.0);
+		Settings.ArenaHalfWidth = 60.0f;
+		Settings.MaxParticles = 2000;
+		return Settings;
+	}
+};
+
+/**
+ * @struct FKawaiiFluidStageTimings
+ * @brief Wall time (ms) of each CPU solver stage, summed over all substeps.
+ *
+ * @param PredictMs Gravity and position prediction.
+ * @param NeighborMs Spatial hash rebuild and neighbor lists.
+ * @param DensityMs XPBD density constraint iterations.
+ * @param CollisionMs Collider and arena collision.
+ * @param FinalizeMs Velocity update from corrected positions.
+ * @param ViscosityMs XSPH viscosity.
+ * @param CohesionMs Surface tension between particles.
+ * @param TotalMs Whole substeps, including stages without their own entry (stack pressure, sleeping).
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidStageTimings
+{
+	double PredictMs = 0.0;
+	double NeighborMs = 0.0;
+	double DensityMs = 0.0;
+	double CollisionMs = 0.0;
+	double FinalizeMs = 0.0;
+	double ViscosityMs = 0.0;
+	double CohesionMs = 0.0;
+	double TotalMs = 0.0;
+
+	/** Time not covered by a named stage */
+	double GetOtherMs() const
+	{
+		return FMath::Max(TotalMs - (PredictMs + NeighborMs + DensityMs + CollisionMs + FinalizeMs + ViscosityMs + CohesionMs), 0.0);
+	}
+
+	void Reset()
+	{
+		*this = FKawaiiFluidStageTimings();
+	}
+};
+
+/**
+ * @struct FKawaiiFluidPresetEvaluation
+ * @brief Settled-state metrics and cost of one preset in the canonical scene.
+ *
+ * @param Final Metrics of the last frame; constraint errors filled in, timing fields hold per-frame averages, and
+ * ParticlesOutOfBounds counts arena escapes over the whole run (see UKawaiiFluidPresetEvaluationContext).
+ * @param ParticleCount Particles in the scene.
+ * @param Frames Frames simulated (fewer than requested if the simulation blew up).
+ * @param Substeps Substeps simulated in total.
+ * @param SimulatedSeconds Simulated time covered by Frames.
+ * @param WallSeconds Wall clock spent in the solver.
+ * @param bSettled Fluid is in equilibrium at the end (FKawaiiFluidMetricsCollector::IsInEquilibrium).
+ * @param SettleSeconds Simulated time at which equilibrium was first reached, negative if never.
+ * @param Spread Final XY footprint of the particle bounds over the initial block footprint.
+ * @param PeakMaxVelocity Highest per-frame max speed (cm/s).
+ * @param MeanDensityError Mean over frames of |average density / rest density - 1|.
+ * @param PeakDensityError Highest per-frame |average density / rest density - 1|.
+ * @param Timings Per-stage solver time.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidPresetEvaluation
+{
+	FKawaiiFluidTestMetrics Final;
+	int32 ParticleCount = 0;
+	int32 Frames = 0;
+	int32 Substeps = 0;
+	float SimulatedSeconds = 0.0f;
+	double WallSeconds = 0.0;
+	bool bSettled = false;
+	float SettleSeconds = -1.0f;
+	float Spread = 0.0f;
+	float PeakMaxVelocity = 0.0f;
+	float MeanDensityError = 0.0f;
+	float PeakDensityError = 0.0f;
+	FKawaiiFluidStageTimings Timings;
+
+	/** No NaNs, no runaway speeds and no particle escaped the arena */
+	bool IsStable() const
+	{
+		return ParticleCount > 0 && Final.IsNumericallyStable() && Final.ParticlesOutOfBounds == 0;
+	}
+
+	/** Simulated seconds per wall-clock second */
+	double GetRealTimeFactor() const
+	{
+		return WallSeconds > 0.0 ? SimulatedSeconds / WallSeconds : 0.0;
+	}
+
+	/** Solver cost per simulated frame (ms) */
+	double GetMsPerFrame() const
+	{
+		return Frames > 0 ? Timings.TotalMs / Frames : 0.0;
+	}
+};
+
+/**
+ * @class UKawaiiFluidPresetEvaluationContext
+ * @brief CPU simulation context that times every solver stage and keeps particles inside an arena box.
+ *
+ * @param Timings Accumulated stage timings since the last reset.
+ * @param ArenaBounds Box the particle centers are clamped to (already shrunk by the particle radius).
+ * @param ArenaFriction Fraction of tangential motion removed on wall contact.
+ * @param ArenaParticleRadius Penetration depth past ArenaBounds at which a clamp counts as an escape.
+ * @param ArenaEscapes Clamps of particles whose center had passed through a wall, since the last SetArena.
+ */
+UCLASS(Transient)
+class KAWAIIFLUIDRUNTIME_API UKawaiiFluidPresetEvaluationContext : public UKawaiiFluidSimulationContext
+{
+	GENERATED_BODY()
+
+public:
+	void SetArena(const FBox& Bounds, float ParticleRadius, float Friction);
+
+	const FKawaiiFluidStageTimings& GetTimings() const { return Timings; }
+
+	/** Particles pulled back after their center crossed an arena wall (the clamp hides them from bounds checks) */
+	int32 GetArenaEscapes() const { return ArenaEscapes; }
+
+	void ResetTimings() { Timings.Reset(); }
+
+	virtual void SimulateSubstep(
+		TArray<FKawaiiFluidParticle>& Particles,
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		FKawaiiFluidSpatialHash& SpatialHash,
+		float SubstepDT
+	) override;
+
+protected:
+	virtual void PredictPositions(TArray<FKawaiiFluidParticle>& Particles, const UKawaiiFluidPresetDataAsset* Preset,
+		const FVector& ExternalForce, float DeltaTime) override;
+
+	virtual void UpdateNeighbors(TArray<FKawaiiFluidParticle>& Particles, FKawaiiFluidSpatialHash& SpatialHash,
+		float SmoothingRadius) override;
+
+	virtual void SolveDensityConstraints(TArray<FKawaiiFluidParticle>& Particles, const UKawaiiFluidPresetDataAsset* Preset,
+		float DeltaTime) override;
+
+	virtual void HandleCollisions(TArray<FKawaiiFluidParticle>& Particles, const TArray<TObjectPtr<UKawaiiFluidCollider>>& Colliders,
+		float SubstepDT) override;
+
+	virtual void FinalizePositions(TArray<FKawaiiFluidParticle>& Particles, float DeltaTime) override;
+
+	virtual void ApplyViscosity(TArray<FKawaiiFluidParticle>& Particles, const UKawaiiFluidPresetDataAsset* Preset) override;
+
+	virtual void ApplyCohesion(TArray<FKawaiiFluidParticle>& Particles, const UKawaiiFluidPresetDataAsset* Preset) override;
+
+private:
+	FKawaiiFluidStageTimings Timings;
+
+	FBox ArenaBounds = FBox(ForceInit);
+
+	float ArenaFriction = 0.0f;
+
+	float ArenaParticleRadius = 0.0f;
+
+	int32 ArenaEscapes = 0;
+};
+
+/**
+ * @class FKawaiiFluidPresetEvaluator
+ * @brief Runs a preset headless in the canonical scene, faster than real time on the multi-threaded CPU solver.
+ *
+ * No world, viewport or GPU is needed, so it runs from commandlets and automation tests. Must be called on the
+ * game thread (it creates a transient context); the solver stages themselves run in parallel.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidPresetEvaluator
+{
+public:
+	static FKawaiiFluidPresetEvaluation Evaluate(
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidPresetEvaluationSettings& Settings = FKawaiiFluidPresetEvaluationSettings());
+};